@@ -7,19 +7,21 @@ presets="
   clang.release.ninja
   clang.release-symbols.make
   clang.release-symbols.ninja
+  clang.release-m32.ninja
   gcc.debug.make
   gcc.debug.ninja
   gcc.release.make
   gcc.release.ninja
   gcc.release-symbols.make
   gcc.release-symbols.ninja
+  gcc.release-m32.ninja
 "
 
 for preset in ${presets}
   do
     cmake --preset ${preset}
     cmake --build build/${preset}
-    if [[ ${preset} == *".release.ninja" ]]; then
+    if [[ ${preset} == *".release.ninja" || ${preset} == *".release-m32.ninja" ]]; then
       ./build/${preset}/bin/test
     fi
   done
@@ -0,0 +1,264 @@
+# SPDX-License-Identifier: APACHE-2.0
+# SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#-------------------------------------------------------------------------------
+# Generates teju_all.h, a single header with the decoders and implementations
+# of Tejú Jaguá for the types supported by the library. All functions in it are
+# static inline.
+#
+# Usage:
+#
+#     cmake -Dsource_dir=<top level directory> -Doutput=<path of teju_all.h> \
+#       -P amalgamate.cmake
+#
+# Generated sources are included one after the other. Since they define the
+# same macros and static names (e.g., teju_width, multipliers and the helpers
+# in teju/src/teju.h), each one is surrounded by macros renaming the static
+# names with a prefix and, afterwards, all macros are undefined.
+#-------------------------------------------------------------------------------
+
+cmake_minimum_required(VERSION 3.31)
+
+if (NOT DEFINED source_dir OR NOT DEFINED output)
+  message(FATAL_ERROR "Usage: cmake -Dsource_dir=<dir> -Doutput=<file> -P "
+    "amalgamate.cmake")
+endif()
+
+# Headers included once per generated source.
+set(per_source_headers
+  teju/src/div10.h
+  teju/src/mshift.h
+  teju/src/teju.h
+)
+
+# Static data and types defined by generated sources and teju/src/teju.h.
+set(static_data
+  corrections
+  decimals
+  mantissa_uncentred
+  minverse
+  multipliers
+  multipliers_hot
+  multipliers_range
+  pow5
+  teju_multiplier_t
+)
+
+set_property(GLOBAL PROPERTY emitted "")
+
+#-------------------------------------------------------------------------------
+# Gets the contents of a file with its includes of other files in the
+# repository recursively expanded.
+#
+# Each file is expanded only once, except for those in per_source_headers.
+# Includes of generated headers are dropped since they only declare the
+# functions defined by generated sources.
+#
+# path                      Path of the file relative to source_dir.
+# result                    Name of the variable receiving the contents.
+#-------------------------------------------------------------------------------
+function(expand path result)
+
+  get_property(emitted GLOBAL PROPERTY emitted)
+
+  if (path MATCHES "^teju/src/generated/.*\\.h$" OR
+    (path IN_LIST emitted AND NOT path IN_LIST per_source_headers))
+    set(${result} "" PARENT_SCOPE)
+    return()
+  endif()
+
+  set_property(GLOBAL APPEND PROPERTY emitted ${path})
+
+  file(READ "${source_dir}/${path}" contents)
+
+  # The SPDX header is written only once at the top.
+  string(REGEX REPLACE "^// SPDX-License-Identifier:[^\n]*\n// SPDX-[^\n]*\n\n"
+    "" contents "${contents}")
+
+  get_filename_component(directory ${path} DIRECTORY)
+  string(REGEX MATCHALL "#include \"[^\"]+\"" includes "${contents}")
+
+  foreach (include IN LISTS includes)
+
+    string(REGEX REPLACE "#include \"([^\"]+)\"" "\\1" name "${include}")
+
+    if (name MATCHES "^\\./")
+      string(REGEX REPLACE "^\\./" "${directory}/" name "${name}")
+    elseif (EXISTS "${source_dir}/teju/include/${name}")
+      set(name "teju/include/${name}")
+    elseif (NOT EXISTS "${source_dir}/${name}")
+      message(FATAL_ERROR "${path}: cannot find ${name}.")
+    endif()
+
+    expand(${name} expansion)
+    string(REPLACE "${include}" "${expansion}" contents "${contents}")
+
+  endforeach()
+
+  set(${result} "//---- ${path}\n\n${contents}" PARENT_SCOPE)
+
+endfunction()
+
+#-------------------------------------------------------------------------------
+# Gets the contents of a generated source with its static names prefixed and
+# followed by undefinitions of all macros it defines.
+#
+# path                      Path of the generated source relative to
+#                           source_dir.
+# result                    Name of the variable receiving the contents.
+#-------------------------------------------------------------------------------
+function(expand_generated path result)
+
+  file(READ "${source_dir}/${path}" source)
+  string(REGEX MATCH "#define teju_function +([a-z_0-9]+)" match "${source}")
+  set(prefix ${CMAKE_MATCH_1})
+
+  # Static names are those in static_data and the functions defined (at the
+  # beginning of a line) in per_source_headers.
+  set(names ${static_data})
+  set(guards "")
+  foreach (header IN LISTS per_source_headers)
+    file(READ "${source_dir}/${header}" contents)
+    string(REGEX MATCHALL "\n[a-z_][a-z_0-9]*\\(" functions "${contents}")
+    foreach (function IN LISTS functions)
+      string(REGEX REPLACE "\n([a-z_0-9]+)\\(" "\\1" function "${function}")
+      if (NOT function MATCHES "^teju_(range_)?function$")
+        list(APPEND names ${function})
+      endif()
+    endforeach()
+    string(REGEX MATCH "#define (TEJU_[A-Z_0-9]+_H_)" guard "${contents}")
+    list(APPEND guards ${CMAKE_MATCH_1})
+  endforeach()
+  list(REMOVE_DUPLICATES names)
+
+  set(renames "")
+  set(undefs  "")
+  foreach (name IN LISTS names)
+    string(APPEND renames "#define ${name} ${prefix}_${name}\n")
+    string(APPEND undefs  "#undef ${name}\n")
+  endforeach()
+
+  # Macros defined by the generated source.
+  string(REGEX MATCHALL "#define +teju_[a-z_0-9]+" macros "${source}")
+  foreach (macro IN LISTS macros)
+    string(REGEX REPLACE "#define +" "" macro "${macro}")
+    string(APPEND undefs "#undef ${macro}\n")
+  endforeach()
+
+  # Allows per_source_headers to be included again.
+  foreach (guard IN LISTS guards)
+    string(APPEND undefs "#undef ${guard}\n")
+  endforeach()
+
+  expand(${path} contents)
+  set(${result} "${renames}\n${contents}\n${undefs}" PARENT_SCOPE)
+
+endfunction()
+
+#-------------------------------------------------------------------------------
+# teju_all.h
+#-------------------------------------------------------------------------------
+
+expand(teju/src/config.h  config)
+expand(teju/src/common.h  common)
+expand(teju/src/literal.h literal)
+
+expand_generated(teju/src/generated/bfloat16.c            bfloat16)
+expand_generated(teju/src/generated/fp8_e4m3.c            fp8_e4m3)
+expand_generated(teju/src/generated/fp8_e5m2.c            fp8_e5m2)
+expand_generated(teju/src/generated/ieee16_with_uint128.c ieee16_with_uint128)
+expand_generated(teju/src/generated/ieee16_no_uint128.c   ieee16_no_uint128)
+expand_generated(teju/src/generated/ieee32_with_uint128.c ieee32_with_uint128)
+expand_generated(teju/src/generated/ieee32_no_uint128.c   ieee32_no_uint128)
+expand_generated(teju/src/generated/ieee64_with_uint128.c ieee64_with_uint128)
+expand_generated(teju/src/generated/ieee64_no_uint128.c   ieee64_no_uint128)
+expand_generated(teju/src/generated/double_double.c       double_double)
+expand_generated(teju/src/generated/ieee128.c             ieee128)
+expand_generated(teju/src/generated/x86_extended.c        x86_extended)
+
+expand(teju/include/teju/bfloat16.h      bfloat16_h)
+expand(teju/include/teju/float16.h       float16_h)
+expand(teju/include/teju/float.h         float_h)
+expand(teju/include/teju/double.h        double_h)
+expand(teju/include/teju/double_double.h double_double_h)
+expand(teju/include/teju/fp8.h           fp8_h)
+expand(teju/include/teju/float128.h      float128_h)
+expand(teju/include/teju/long_double.h   long_double_h)
+expand(teju/include/teju/constexpr.h     constexpr_h)
+
+file(WRITE "${output}" "\
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated by cmake/amalgamate.cmake. DO NOT EDIT IT.
+
+/**
+ * @file teju_all.h
+ *
+ * Single header with the decoders and implementations of Tejú Jaguá for
+ * FP8 (E4M3 and E5M2), bfloat16, float16_t, float, double, double-double,
+ * float128_t and long double (x86 extended) values.
+ *
+ * All functions are static inline and can be inlined into callers without
+ * link-time optimisation. Macros teju_has_uint128, teju_has_float16,
+ * teju_has_float128 and teju_has_x86_extended must be defined according to the
+ * platform capabilities as when building the library.
+ *
+ * When compiled as C++20 by gcc or clang, the implementations of Tejú Jaguá and
+ * the decoders of bfloat16, float, double and FP8 values are constexpr. So are
+ * teju::to_decimal and teju::to_chars (see teju/constexpr.h).
+ */
+
+#ifndef TEJU_TEJU_ALL_H_
+#define TEJU_TEJU_ALL_H_
+
+#define teju_static_inline
+
+${config}
+${common}
+${literal}
+${bfloat16}
+${fp8_e4m3}
+${fp8_e5m2}
+#if defined(teju_has_float16)
+  #if defined(teju_has_uint128)
+
+${ieee16_with_uint128}
+  #else
+
+${ieee16_no_uint128}
+  #endif
+#endif
+
+#if defined(teju_has_uint128)
+
+${ieee32_with_uint128}
+${ieee64_with_uint128}
+${double_double}
+#else
+
+${ieee32_no_uint128}
+${ieee64_no_uint128}
+#endif
+
+#if defined(teju_has_float128)
+
+${ieee128}
+#endif
+
+#if defined(teju_has_x86_extended)
+
+${x86_extended}
+#endif
+
+${bfloat16_h}
+${float16_h}
+${float_h}
+${double_h}
+${double_double_h}
+${fp8_h}
+${float128_h}
+${long_double_h}
+${constexpr_h}
+#endif // TEJU_TEJU_ALL_H_
+")
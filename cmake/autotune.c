@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @brief Times teju_mshift and teju_div10 as Tejú Jaguá calls them for the
+ *        centred case.
+ *
+ * Macros teju_width, teju_mantissa_width, teju_calculation_div10 and
+ * teju_calculation_mshift must be defined on the command line and the program
+ * prints the time taken per iteration in picoseconds. (See autotune.cmake.)
+ */
+
+#include "teju/src/config.h"
+
+#if teju_width == 16u
+  #define teju_u1_t teju16_u1_t
+  #define teju_u2_t teju16_u2_t
+  #define teju_u4_t teju16_u4_t
+#elif teju_width == 32u
+  #define teju_u1_t teju32_u1_t
+  #define teju_u2_t teju32_u2_t
+  #if defined(teju32_u4_t)
+    #define teju_u4_t teju32_u4_t
+  #endif
+#elif teju_width == 64u
+  #define teju_u1_t teju64_u1_t
+  #if defined(teju64_u2_t)
+    #define teju_u2_t teju64_u2_t
+  #endif
+#elif teju_width == 128u
+  #define teju_u1_t teju128_u1_t
+#else
+  #error "Width not supported by autotune."
+#endif
+
+typedef struct {
+  teju_u1_t upper;
+  teju_u1_t lower;
+} teju_multiplier_t;
+
+#include "teju/src/div10.h"
+#include "teju/src/mshift.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#define n_values      1024u
+#define n_multipliers 64u
+#define n_iterations  (1u << 24u)
+#define n_repetitions 5u
+
+/**
+ * @brief Returns a pseudo-random value (xorshift64).
+ *
+ * @param  state            The state of the generator.
+ *
+ * @returns The pseudo-random value.
+ */
+static
+teju_u1_t
+random_value(uint64_t* const state) {
+  teju_u1_t value = 0u;
+  uint32_t  i;
+  for (i = 0; i < teju_width; i += 64u) {
+    *state ^= *state << 13u;
+    *state ^= *state >> 7u;
+    *state ^= *state << 17u;
+    value |= (teju_u1_t) ((teju_u1_t) *state << i);
+  }
+  return value;
+}
+
+int main(void) {
+
+  static teju_u1_t         values[n_values];
+  static teju_multiplier_t multipliers[n_multipliers];
+
+  // Values are as m_b = (2 * m + 1) << r. (See to_decimal_centred.)
+  uint32_t  const shift = teju_width - teju_mantissa_width - 4u;
+  uint64_t        state = 0x9e3779b97f4a7c15u;
+  uint32_t        i, j;
+  clock_t         best  = 0;
+  teju_u1_t       sum   = 0u;
+
+  for (i = 0; i < n_values; ++i)
+    values[i] = (teju_u1_t) (random_value(&state) >> shift);
+
+  for (i = 0; i < n_multipliers; ++i) {
+    multipliers[i].upper = random_value(&state);
+    multipliers[i].lower = random_value(&state);
+  }
+
+  for (j = 0; j < n_repetitions; ++j) {
+
+    clock_t const start = clock();
+
+    // Each iteration depends on the previous one, as calls to Tejú Jaguá
+    // depend on their inputs, and this prevents vectorisation.
+    for (i = 0; i < n_iterations; ++i) {
+      teju_u1_t const m = values[(i + (uint32_t) (sum % 2u)) % n_values];
+      teju_u1_t const b = teju_mshift(m, multipliers[i % n_multipliers]);
+      sum += teju_div10(b);
+    }
+
+    clock_t const time = clock() - start;
+    if (j == 0 || time < best)
+      best = time;
+  }
+
+  printf("%.0f %u\n", 1e12 * (double) best / CLOCKS_PER_SEC / n_iterations,
+    (unsigned) (sum % 2u));
+  return 0;
+}
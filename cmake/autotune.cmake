@@ -0,0 +1,131 @@
+# SPDX-License-Identifier: APACHE-2.0
+# SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#-------------------------------------------------------------------------------
+# Picks the calculation methods of div10 and mshift of a generated source that
+# are the fastest on the build host.
+#
+# Multipliers don't depend on these methods and the generated sources define
+# them only if not yet defined. Hence, the generator doesn't need to run again:
+# the methods are passed as compile definitions of the source.
+#
+# Each combination of methods is timed by autotune.c which is compiled with the
+# flags of the build. Combinations that don't compile (e.g., built_in_2 when
+# there's no 2-limb type) are skipped. Results are cached in
+# teju_autotune_<function> and, to tune again, this variable must be removed
+# from the cache.
+#
+# source                    Path of the generated source relative to the
+#                           current source directory.
+#-------------------------------------------------------------------------------
+function(teju_autotune source)
+
+  file(READ "${CMAKE_CURRENT_SOURCE_DIR}/${source}" contents)
+
+  string(REGEX MATCH "#define teju_function +([a-z_0-9]+)" match
+    "${contents}")
+  set(function ${CMAKE_MATCH_1})
+
+  string(REGEX MATCH "#define teju_width +([0-9]+)u" match "${contents}")
+  set(width ${CMAKE_MATCH_1})
+
+  string(REGEX MATCH "#define teju_mantissa_width +([0-9]+)u" match
+    "${contents}")
+  set(mantissa_width ${CMAKE_MATCH_1})
+
+  string(REGEX MATCH "#define teju_calculation_div10 +(teju_[a-z_0-9]+)" match
+    "${contents}")
+  set(div10 ${CMAKE_MATCH_1})
+
+  string(REGEX MATCH "#define teju_calculation_mshift +(teju_[a-z_0-9]+)" match
+    "${contents}")
+  set(mshift ${CMAKE_MATCH_1})
+
+  # div10 can be overridden only if the generated source allows it. Otherwise,
+  # the generated method is timed (when undefined, div10 is as built_in_1.)
+  if ("${contents}" MATCHES "#if !defined\\(teju_calculation_div10\\)")
+    set(div10_overridable ON)
+    set(div10s teju_built_in_1 teju_synthetic_1 teju_built_in_2)
+  elseif (div10)
+    set(div10_overridable OFF)
+    set(div10s ${div10})
+  else()
+    set(div10_overridable OFF)
+    set(div10s teju_built_in_1)
+  endif()
+
+  set(mshifts teju_built_in_1 teju_synthetic_1 teju_built_in_2
+    teju_synthetic_2 teju_built_in_4)
+
+  if (NOT DEFINED teju_autotune_${function})
+
+    if (CMAKE_CROSSCOMPILING)
+      message(STATUS "Autotuning ${function}: skipped when cross-compiling")
+      return()
+    endif()
+
+    # The flags of the build except generator expressions and those for
+    # profile-guided optimisation.
+    get_directory_property(options COMPILE_OPTIONS)
+    get_directory_property(definitions COMPILE_DEFINITIONS)
+    list(FILTER options EXCLUDE REGEX "^\\$<|profile")
+    list(FILTER definitions EXCLUDE REGEX "^\\$<")
+    list(TRANSFORM definitions PREPEND -D)
+    if (MSVC)
+      set(werror /WX)
+    else()
+      set(werror -Werror)
+    endif()
+    set(CMAKE_TRY_COMPILE_CONFIGURATION Release)
+
+    set(best_time "")
+    foreach (div10_i IN LISTS div10s)
+      foreach (mshift_i IN LISTS mshifts)
+
+        try_run(run_result compile_result
+          ${CMAKE_BINARY_DIR}
+          ${PROJECT_SOURCE_DIR}/cmake/autotune.c
+          CMAKE_FLAGS "-DINCLUDE_DIRECTORIES=${PROJECT_SOURCE_DIR}"
+          COMPILE_DEFINITIONS ${options} ${definitions} ${werror}
+            -Dteju_width=${width}u
+            -Dteju_mantissa_width=${mantissa_width}u
+            -Dteju_calculation_div10=${div10_i}
+            -Dteju_calculation_mshift=${mshift_i}
+          RUN_OUTPUT_VARIABLE output
+        )
+
+        if (compile_result AND run_result EQUAL 0)
+          string(REGEX MATCH "^[0-9]+" time "${output}")
+          message(STATUS "Autotuning ${function}: div10 = ${div10_i}, "
+            "mshift = ${mshift_i}: ${time} ps")
+          if (best_time STREQUAL "" OR time LESS best_time)
+            set(best_time ${time})
+            set(best "${div10_i};${mshift_i}")
+          endif()
+        endif()
+
+      endforeach()
+    endforeach()
+
+    if (best_time STREQUAL "")
+      message(FATAL_ERROR "Autotuning ${function}: no method works.")
+    endif()
+
+    set(teju_autotune_${function} "${best}" CACHE INTERNAL
+      "Calculation methods of div10 and mshift for ${function}.")
+
+  endif()
+
+  list(GET teju_autotune_${function} 0 div10)
+  list(GET teju_autotune_${function} 1 mshift)
+  message(STATUS "Autotuning ${function}: div10 = ${div10}, "
+    "mshift = ${mshift}")
+
+  if (div10_overridable)
+    set_property(SOURCE ${source} APPEND PROPERTY COMPILE_DEFINITIONS
+      teju_calculation_div10=${div10})
+  endif()
+  set_property(SOURCE ${source} APPEND PROPERTY COMPILE_DEFINITIONS
+    teju_calculation_mshift=${mshift})
+
+endfunction()
@@ -0,0 +1,12 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @brief Checks existence of unsigned _BitInt(256) and unsigned _BitInt(512).
+ */
+
+typedef unsigned _BitInt(256) uint256_t;
+typedef unsigned _BitInt(512) uint512_t;
+
+int main() {
+}
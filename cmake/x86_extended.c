@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @brief Checks whether long double is the x86 80-bit extended type.
+ */
+
+#include <float.h>
+
+#if !defined(__x86_64__) && !defined(__i386__)
+  #error "Not an x86 platform."
+#endif
+
+#if LDBL_MANT_DIG != 64 || LDBL_MIN_EXP != -16381 || LDBL_MAX_EXP != 16384
+  #error "long double is not the x86 80-bit extended type."
+#endif
+
+int main() {
+}
@@ -11,7 +11,13 @@
 
 #include "common/exception.hpp"
 #include "common/traits.hpp"
+#include "teju/double.h"
+#include "teju/fp8.h"
+#include "teju/parallel.h"
 #include "teju/src/common.h"
+#include "teju/src/generated/ieee64_compressed.h"
+#include "teju/src/generated/ieee64_hot.h"
+#include "teju/src/generated/ieee64_with_uint128.h"
 
 #include <gtest/gtest.h>
 #include <nanobench.h>
@@ -20,10 +26,12 @@
 #include <charconv>
 #include <cstring>
 #include <fstream>
-#include <limits>
 #include <random>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #if defined(__unix__)
   #include <unistd.h>
@@ -51,6 +59,30 @@ auto constexpr str_csv       = std::string_view{
 
 auto const to_chars_failure = teju::exception_t{"to_chars failed."};
 
+/**
+ * @brief Checks whether Dragonbox supports a given floating-point number type.
+ *
+ * @tparam TFloat           The floating-point number type.
+ */
+template <typename TFloat, typename = void>
+auto constexpr has_dragonbox = false;
+
+template <typename TFloat>
+auto constexpr has_dragonbox<TFloat, std::void_t<decltype(
+  teju::traits_t<TFloat>::dragonbox_raw(TFloat{}))>> = true;
+
+/**
+ * @brief Checks whether Ryu supports a given floating-point number type.
+ *
+ * @tparam TFloat           The floating-point number type.
+ */
+template <typename TFloat, typename = void>
+auto constexpr has_ryu = false;
+
+template <typename TFloat>
+auto constexpr has_ryu<TFloat, std::void_t<decltype(
+  teju::traits_t<TFloat>::ryu_raw(TFloat{}))>> = true;
+
 /**
  * @brief Converts an integer into chars. (Does not write a null terminator.)
  *
@@ -154,7 +186,7 @@ void
 benchmark(nanobench::Bench& bench, TFloat const value) {
 
   using      traits_t = teju::traits_t<TFloat>;
-  using      buffer_t = char[40];
+  using      buffer_t = char[64];
 
   auto const binary   = traits_t::to_binary(value);
   auto const decimal  = traits_t::teju(value);
@@ -174,7 +206,7 @@ benchmark(nanobench::Bench& bench, TFloat const value) {
         nanobench::doNotOptimizeAway(traits_t::teju_raw(value));
       });
 
-  if constexpr (run_dragonbox)
+  if constexpr (run_dragonbox && has_dragonbox<TFloat>)
     bench
       .context(str_algorithm, str_dragonbox.data()    )
       .context(str_binary   , std::data(binary_chars) )
@@ -183,7 +215,7 @@ benchmark(nanobench::Bench& bench, TFloat const value) {
         nanobench::doNotOptimizeAway(traits_t::dragonbox_raw(value));
       });
 
-  if constexpr (run_ryu)
+  if constexpr (run_ryu && has_ryu<TFloat>)
     bench
       .context(str_algorithm, str_ryu.data()          )
       .context(str_binary   , std::data(binary_chars) )
@@ -197,12 +229,18 @@ benchmark(nanobench::Bench& bench, TFloat const value) {
  * @brief Streams out detailed benchmarks results to a given file and a summary
  *        to std::cout.
  *
+ * @tparam TFloat           The floating-point number type.
+ *
  * @param  bench            The benchmark object recording the results.
  * @param  filename         The name of the output file.
  */
+template <typename TFloat>
 void
 output(nanobench::Bench const& bench, std::string_view const filename) {
 
+  auto constexpr with_dragonbox = run_dragonbox && has_dragonbox<TFloat>;
+  auto constexpr with_ryu       = run_ryu       && has_ryu<TFloat>;
+
   // Save detailed results in a csv file.
   {
     auto out = std::ofstream{filename.data()};
@@ -227,15 +265,15 @@ output(nanobench::Bench const& bench, std::string_view const filename) {
 
       if (run_teju && result.context(str_algorithm) == str_teju)
         teju.update(value);
-      else if (run_dragonbox && result.context(str_algorithm) == str_dragonbox)
+      else if (with_dragonbox && result.context(str_algorithm) == str_dragonbox)
         dragonbox.update(value);
-      else if (run_ryu &&  result.context(str_algorithm) == str_ryu)
+      else if (with_ryu && result.context(str_algorithm) == str_ryu)
         ryu.update(value);
     }
 
-    auto const     teju_mean      = run_teju      ? teju.mean()      : 1;
-    auto const     dragonbox_mean = run_dragonbox ? dragonbox.mean() : 1;
-    auto const     ryu_mean       = run_ryu       ? ryu.mean()       : 1;
+    auto const     teju_mean      = run_teju       ? teju.mean()      : 1;
+    auto const     dragonbox_mean = with_dragonbox ? dragonbox.mean() : 1;
+    auto const     ryu_mean       = with_ryu       ? ryu.mean()       : 1;
     auto const     baseline       = double(teju_mean);
     auto constexpr scale          = 0.001;
 
@@ -251,7 +289,7 @@ output(nanobench::Bench const& bench, std::string_view const filename) {
         "          (rel.  ) = " << teju_field(teju_mean / baseline      ) <<
         "\n\n";
 
-    if constexpr (run_dragonbox)
+    if constexpr (with_dragonbox)
       std::cout << std::setprecision(3) << std::fixed <<
         "dragonbox (mean  ) = " << teju_field(scale * dragonbox_mean    ) <<
         " ns\n"
@@ -260,7 +298,7 @@ output(nanobench::Bench const& bench, std::string_view const filename) {
         "          (rel.  ) = " << teju_field(dragonbox_mean / baseline ) <<
         "\n\n";
 
-    if constexpr (run_ryu)
+    if constexpr (with_ryu)
       std::cout << std::setprecision(3) << std::fixed <<
         "ryu       (mean  ) = " << teju_field(scale * ryu_mean          ) <<
         " ns\n"
@@ -304,7 +342,7 @@ benchmark_integers(std::string_view const filename) {
   test(TFloat{1}, TFloat{1'000});
   test(TFloat{max} - TFloat{1'000}, TFloat{max});
 
-  output(bench, filename);
+  output<TFloat>(bench, filename);
 }
 
 TEST(float, integers) {
@@ -315,6 +353,22 @@ TEST(double, integers) {
   benchmark_integers<double>("double_integers.csv");
 }
 
+#if defined(teju_has_float128)
+
+TEST(float128, integers) {
+  benchmark_integers<float128_t>("float128_integers.csv");
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+TEST(long_double, integers) {
+  benchmark_integers<long double>("long_double_integers.csv");
+}
+
+#endif // defined(teju_has_x86_extended)
+
 /**
  * @brief Benchmarks conversion centred floating-point numbers to their decimal
  *        representations. Streams out detailed benchmarks results to a given
@@ -355,7 +409,7 @@ benchmark_centred(std::string_view const filename, unsigned n_samples) {
     benchmark(bench, value);
   }
 
-  output(bench, filename);
+  output<TFloat>(bench, filename);
 }
 
 TEST(float, centred) {
@@ -366,6 +420,22 @@ TEST(double, centred) {
   benchmark_centred<double>("double_centred.csv", 2'000);
 }
 
+#if defined(teju_has_float128)
+
+TEST(float128, centred) {
+  benchmark_centred<float128_t>("float128_centred.csv", 2'000);
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+TEST(long_double, centred) {
+  benchmark_centred<long double>("long_double_centred.csv", 2'000);
+}
+
+#endif // defined(teju_has_x86_extended)
+
 /**
  * @brief Benchmarks conversion of uncentred floating-point numbers to their
  *        decimal representations. Streams out detailed benchmarks results to a
@@ -398,7 +468,7 @@ benchmark_uncentred(std::string_view const filename) {
     benchmark(bench, value);
   }
 
-  output(bench, filename);
+  output<TFloat>(bench, filename);
 }
 
 TEST(float, uncentred) {
@@ -409,6 +479,73 @@ TEST(double, uncentred) {
   benchmark_uncentred<double>("double_uncentred.csv");
 }
 
+#if defined(teju_has_float128)
+
+TEST(float128, uncentred) {
+  benchmark_uncentred<float128_t>("float128_uncentred.csv");
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+TEST(long_double, uncentred) {
+  benchmark_uncentred<long double>("long_double_uncentred.csv");
+}
+
+#endif // defined(teju_has_x86_extended)
+
+/**
+ * @brief Gets uniformly distributed random bit patterns of finite and strictly
+ *        positive floating-point numbers.
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  n_samples        The quantity of floating-point numbers.
+ *
+ * @returns The floating-point numbers.
+ */
+template <typename TFloat>
+std::vector<TFloat>
+get_random_values(unsigned const n_samples) {
+
+  using          traits_t       = teju::traits_t<TFloat>;
+  using          u1_t           = typename traits_t::u1_t;
+  auto constexpr mantissa_width = traits_t::mantissa_width;
+  auto constexpr exponent_min   = traits_t::exponent_min;
+  auto constexpr exponent_max   = traits_t::exponent_max;
+  auto constexpr integer_bit    = teju_pow2(u1_t, mantissa_width - 1);
+
+  // Uniformly distributed bit patterns have uniformly distributed biased
+  // exponents and fractions. Below, exponent_min - 1 stands for the biased
+  // exponent of subnormal values. (This works for types with an explicit
+  // integer bit, e.g., long double, and for which std::numeric_limits is not
+  // specialised, e.g., float128_t.)
+  auto device                = std::mt19937_64{};
+  auto exponent_distribution =
+    std::uniform_int_distribution<std::int32_t>{exponent_min - 1, exponent_max};
+  auto fraction_distribution =
+    std::uniform_int_distribution<u1_t>{0u, integer_bit - 1u};
+
+  std::vector<TFloat> values;
+  values.reserve(n_samples);
+
+  while (values.size() < n_samples) {
+
+    auto const exponent = exponent_distribution(device);
+    auto const fraction = fraction_distribution(device);
+
+    if (exponent >= exponent_min)
+      values.push_back(traits_t::to_value(teju::binary_t<TFloat>{exponent,
+        integer_bit | fraction}));
+    else if (fraction != 0u)
+      values.push_back(traits_t::to_value(teju::binary_t<TFloat>{exponent_min,
+        fraction}));
+  }
+
+  return values;
+}
+
 /**
  * @brief Benchmarks conversion floating-point numbers to their decimal
  *        representation.
@@ -420,41 +557,15 @@ TEST(double, uncentred) {
  */
 template <typename TFloat>
 void
-benchmark_simple(unsigned n_samples) {
+benchmark_simple(unsigned const n_samples) {
 
   auto bench = nanobench::Bench()
     .batch(n_samples)
     .unit("run")
     .epochs(11);
 
-  using          traits_t = teju::traits_t<TFloat>;
-  using          u1_t     = typename traits_t::u1_t;
-  auto constexpr min      = std::numeric_limits<TFloat>::denorm_min();
-  auto constexpr max      = std::numeric_limits<TFloat>::max();
-
-  auto to_bits = [](TFloat value) {
-    u1_t bits{};
-    std::memcpy(&bits, &value, sizeof(value));
-    return bits;
-  };
-
-  auto const min_bits = to_bits(min);
-  auto const max_bits = to_bits(max);
-
-  auto device       = std::mt19937_64{};
-  auto distribution = std::uniform_int_distribution<u1_t>{min_bits, max_bits};
-
-  auto to_value = [](u1_t bits) {
-    TFloat value{};
-    std::memcpy(&value, &bits, sizeof(value));
-    return value;
-  };
-
-  std::vector<TFloat> values;
-  values.reserve(n_samples);
-
-  while (n_samples--)
-    values.push_back(to_value(distribution(device)));
+  using      traits_t = teju::traits_t<TFloat>;
+  auto const values   = get_random_values<TFloat>(n_samples);
 
   if constexpr (run_teju)
     bench.relative(true).run("teju", [&]() {
@@ -462,13 +573,13 @@ benchmark_simple(unsigned n_samples) {
         nanobench::doNotOptimizeAway(traits_t::teju_raw(value));
     });
 
-  if constexpr (run_dragonbox)
+  if constexpr (run_dragonbox && has_dragonbox<TFloat>)
     bench.run("dragonbox", [&]() {
       for (auto const value : values)
         nanobench::doNotOptimizeAway(traits_t::dragonbox_raw(value));
     });
 
-  if constexpr (run_ryu)
+  if constexpr (run_ryu && has_ryu<TFloat>)
     bench.run("ryu", [&]() {
       for (auto const value : values)
         nanobench::doNotOptimizeAway(traits_t::ryu_raw(value));
@@ -483,6 +594,330 @@ TEST(double, simple) {
   benchmark_simple<double>(1u << 24);
 }
 
+#if defined(teju_has_float128)
+
+TEST(float128, simple) {
+  benchmark_simple<float128_t>(1u << 22);
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+TEST(long_double, simple) {
+  benchmark_simple<long double>(1u << 22);
+}
+
+#endif // defined(teju_has_x86_extended)
+
+#if defined(teju_has_uint128)
+
+/**
+ * @brief Benchmarks the implementation for double with a compressed table of
+ *        multipliers against the one with the full table.
+ *
+ * The full table (config/ieee64_with_uint128.json) takes 9,872 bytes whereas
+ * the compressed one (config/ieee64_compressed.json) takes 908 bytes, including
+ * powers of 5 and corrections, but needs an extra multiplication.
+ *
+ * In the "warm" case, values are converted in a tight loop and the tables stay
+ * in cache. In the "cold" case, each conversion is preceded by a walk through a
+ * buffer larger than the L1 data cache which evicts the tables. The time of
+ * the walk alone ("evict") must be discounted from the "cold" timings.
+ *
+ * @param  n_samples        The quantity of floating-point numbers to be
+ *                          converted.
+ */
+void
+benchmark_compressed(unsigned const n_samples) {
+
+  auto binaries = std::vector<teju64_fields_t>{};
+  binaries.reserve(n_samples);
+  for (auto const value : get_random_values<double>(n_samples))
+    binaries.push_back(teju_double_to_binary(value));
+
+  auto buffer = std::vector<char>(std::size_t{1} << 16u);
+  auto evict  = [&]() {
+    for (std::size_t i = 0; i < buffer.size(); i += 64)
+      nanobench::doNotOptimizeAway(buffer[i]);
+  };
+
+  auto warm = nanobench::Bench()
+    .batch(n_samples)
+    .unit("number")
+    .epochs(11);
+
+  warm.relative(true).run("full (warm)", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_with_uint128(binary));
+  });
+
+  warm.run("compressed (warm)", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_compressed(binary));
+  });
+
+  auto const n_cold = std::min(n_samples, 1u << 14);
+
+  auto cold = nanobench::Bench()
+    .batch(n_cold)
+    .unit("number")
+    .epochs(11);
+
+  cold.relative(true).run("evict", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(binaries[i]);
+    }
+  });
+
+  cold.run("full (cold)", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(teju_ieee64_with_uint128(binaries[i]));
+    }
+  });
+
+  cold.run("compressed (cold)", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(teju_ieee64_compressed(binaries[i]));
+    }
+  });
+}
+
+TEST(double, compressed) {
+  benchmark_compressed(1u << 24);
+}
+
+/**
+ * @brief Benchmarks the implementation for double with a hot table of
+ *        multipliers against the one with a single table.
+ *
+ * The hot table (config/ieee64_hot.json) holds the 19 multipliers (5 cache
+ * lines) for values in [1e-6, 1e12], is cache line aligned and is placed in
+ * section teju_hot. The workload is mixed: 15 out of 16 values are in this
+ * range and the others are random. Timings are taken as in
+ * benchmark_compressed.
+ *
+ * @param  n_samples        The quantity of floating-point numbers to be
+ *                          converted.
+ */
+void
+benchmark_hot(unsigned const n_samples) {
+
+  auto constexpr integer_bit = std::uint64_t{1} << 52u;
+
+  auto device   = std::mt19937_64{};
+  auto exponent = std::uniform_int_distribution<std::int32_t>{-72, -13};
+  auto fraction = std::uniform_int_distribution<std::uint64_t>{0,
+    integer_bit - 1u};
+
+  auto const others = get_random_values<double>(n_samples / 16u + 1u);
+  auto binaries     = std::vector<teju64_fields_t>{};
+  binaries.reserve(n_samples);
+  for (unsigned i = 0; i < n_samples; ++i)
+    binaries.push_back(i % 16u == 0u ?
+      teju_double_to_binary(others[i / 16u]) :
+      teju64_fields_t{exponent(device), integer_bit | fraction(device)});
+
+  auto buffer = std::vector<char>(std::size_t{1} << 16u);
+  auto evict  = [&]() {
+    for (std::size_t i = 0; i < buffer.size(); i += 64)
+      nanobench::doNotOptimizeAway(buffer[i]);
+  };
+
+  auto warm = nanobench::Bench()
+    .batch(n_samples)
+    .unit("number")
+    .epochs(11);
+
+  warm.relative(true).run("single (warm)", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_with_uint128(binary));
+  });
+
+  warm.run("hot (warm)", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_hot(binary));
+  });
+
+  auto const n_cold = std::min(n_samples, 1u << 14);
+
+  auto cold = nanobench::Bench()
+    .batch(n_cold)
+    .unit("number")
+    .epochs(11);
+
+  cold.relative(true).run("evict", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(binaries[i]);
+    }
+  });
+
+  cold.run("single (cold)", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(teju_ieee64_with_uint128(binaries[i]));
+    }
+  });
+
+  cold.run("hot (cold)", [&]() {
+    for (unsigned i = 0; i < n_cold; ++i) {
+      evict();
+      nanobench::doNotOptimizeAway(teju_ieee64_hot(binaries[i]));
+    }
+  });
+}
+
+TEST(double, hot) {
+  benchmark_hot(1u << 24);
+}
+
+/**
+ * @brief Benchmarks the function for double specialised for values in [1e-4,
+ *        1e9] against the general ones.
+ *
+ * The specialised function (config/ieee64_compressed.json) reads the 14
+ * multipliers for this window from a separate table and falls back to the
+ * compressed table for other values. All values are in the window.
+ *
+ * @param  n_samples        The quantity of floating-point numbers to be
+ *                          converted.
+ */
+void
+benchmark_range(unsigned const n_samples) {
+
+  auto constexpr integer_bit = std::uint64_t{1} << 52u;
+
+  auto device   = std::mt19937_64{};
+  auto exponent = std::uniform_int_distribution<std::int32_t>{-66, -23};
+  auto fraction = std::uniform_int_distribution<std::uint64_t>{1,
+    integer_bit - 1u};
+
+  auto binaries = std::vector<teju64_fields_t>{};
+  binaries.reserve(n_samples);
+  for (unsigned i = 0; i < n_samples; ++i)
+    binaries.push_back({exponent(device), integer_bit | fraction(device)});
+
+  auto bench = nanobench::Bench()
+    .batch(n_samples)
+    .unit("number")
+    .epochs(11);
+
+  bench.relative(true).run("full", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_with_uint128(binary));
+  });
+
+  bench.run("compressed", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_compressed(binary));
+  });
+
+  bench.run("range", [&]() {
+    for (auto const binary : binaries)
+      nanobench::doNotOptimizeAway(teju_ieee64_compressed_range(binary));
+  });
+}
+
+TEST(double, range) {
+  benchmark_range(1u << 24);
+}
+
+#endif // defined(teju_has_uint128)
+
+/**
+ * @brief Benchmarks the conversions of E4M3 values backed by the lookup table
+ *        against Tejú Jaguá.
+ *
+ * The workload consists of all finite and strictly positive values repeated
+ * in random order.
+ *
+ * @param  n_samples        The quantity of floating-point numbers to be
+ *                          converted.
+ */
+void
+benchmark_fp8(unsigned const n_samples) {
+
+  auto device = std::mt19937_64{};
+  auto bits   = std::uniform_int_distribution<unsigned>{1u, 0x7eu};
+
+  auto values = std::vector<std::uint8_t>(n_samples);
+  for (auto& value : values)
+    value = static_cast<std::uint8_t>(bits(device));
+
+  auto bench = nanobench::Bench()
+    .batch(n_samples)
+    .unit("number")
+    .epochs(11);
+
+  bench.relative(true).run("teju", [&]() {
+    for (auto const value : values)
+      nanobench::doNotOptimizeAway(teju_fp8_e4m3(
+        teju_fp8_e4m3_to_binary(value)));
+  });
+
+  bench.run("lut", [&]() {
+    for (auto const value : values)
+      nanobench::doNotOptimizeAway(teju_fp8_e4m3_to_decimal(value));
+  });
+}
+
+TEST(fp8, lut) {
+  benchmark_fp8(1u << 24);
+}
+
+/**
+ * @brief Benchmarks the parallel conversion of floating-point numbers to their
+ *        decimal representations for 1 to N threads, where N is the number of
+ *        CPUs.
+ *
+ * Notice that pinning the execution to a CPU (see main below) makes all
+ * threads share it.
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  n_samples        The quantity of floating-point numbers to be
+ *                          converted.
+ */
+template <typename TFloat>
+void
+benchmark_parallel(unsigned const n_samples) {
+
+  auto bench = nanobench::Bench()
+    .batch(n_samples)
+    .unit("number")
+    .epochs(5);
+
+  using      traits_t = teju::traits_t<TFloat>;
+  using      fields_t = decltype(traits_t::teju_raw(TFloat{}));
+  auto const values   = get_random_values<TFloat>(n_samples);
+  auto       decimals = std::vector<fields_t>(n_samples);
+
+  auto const n_cpus   = std::max(1u, std::thread::hardware_concurrency());
+
+  bench.relative(true);
+
+  for (unsigned threads = 1; threads <= n_cpus; ++threads) {
+    auto const name = "threads = " + std::to_string(threads);
+    bench.run(name, [&]() {
+      teju::to_decimal_parallel(values.data(), decimals.data(), n_samples,
+        threads);
+      nanobench::doNotOptimizeAway(decimals.data());
+    });
+  }
+}
+
+TEST(float, parallel) {
+  benchmark_parallel<float>(1u << 24);
+}
+
+TEST(double, parallel) {
+  benchmark_parallel<double>(1u << 24);
+}
+
 } // namespace <anonymous>
 
 // On Linux, the following should help to reduce variance of benchmark results.
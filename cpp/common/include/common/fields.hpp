@@ -12,22 +12,39 @@
 
 #include "teju/src/config.h"
 
-#if defined(teju_has_float128)
+#if defined(teju_has_float128) || defined(teju_has_x86_extended)
   #include <boost/multiprecision/cpp_int.hpp>
 #endif
 
+#include <cstdint>
 #include <iosfwd>
 
 namespace teju {
 
+/**
+ * @brief A bfloat16 value given by its bit pattern.
+ *
+ * There's no portable bfloat16 type and this wrapper serves to select
+ * specialisations like cpp_fields_t<bfloat16_t> and traits_t<bfloat16_t>.
+ */
+struct bfloat16_t {
+  std::uint16_t bits;
+};
+
 /**
  * @brief C++ wrapper around the C fields of floating-point representation.
  *
- * Instantiations are provided for float, double and float128_t (if supported).
+ * Instantiations are provided for float, double, float128_t and long double
+ * (if supported).
  */
 template <typename /*TFloat*/>
 struct cpp_fields_t;
 
+template <>
+struct cpp_fields_t<bfloat16_t> : teju16_fields_t {
+  using streamable_t = std::uint32_t;
+};
+
 #if defined(teju_has_float16)
 template <>
 struct cpp_fields_t<float16_t> : teju32_fields_t {
@@ -52,6 +69,13 @@ struct cpp_fields_t<float128_t> : teju128_fields_t {
 };
 #endif // defined(teju_has_float128)
 
+#if defined(teju_has_x86_extended)
+template <>
+struct cpp_fields_t<long double> : teju128_fields_t {
+  using streamable_t = boost::multiprecision::uint128_t;
+};
+#endif // defined(teju_has_x86_extended)
+
 template <typename TFloat, unsigned base>
 struct fields_t : cpp_fields_t<TFloat> {
 };
@@ -13,10 +13,12 @@
 #include "common/ryu.hpp"
 #include "common/fields.hpp"
 #include "common/dragonbox.hpp"
+#include "teju/bfloat16.h"
 #include "teju/double.h"
 #include "teju/float.h"
 #include "teju/float16.h"
 #include "teju/float128.h"
+#include "teju/long_double.h"
 #include "teju/src/config.h"
 
 namespace teju {
@@ -34,6 +36,13 @@ namespace detail {
   TFloat
   to_value(binary_t<TFloat> binary);
 
+  #if defined(teju_has_x86_extended)
+    // The x86 extended format has an explicit integer bit.
+    template <>
+    long double
+    to_value(binary_t<long double> binary);
+  #endif
+
 } // namespace detail
 
 /**
@@ -78,6 +87,46 @@ namespace detail {
 template <typename TFloat>
 struct traits_t;
 
+// Specialisation of traits_t for bfloat16_t.
+template <>
+struct traits_t<bfloat16_t> {
+
+  using u1_t      = teju16_u1_t;
+  using decimal_t = teju::decimal_t<bfloat16_t>;
+  using binary_t  = teju::binary_t<bfloat16_t>;
+
+  static auto constexpr mantissa_width =    8u;
+  static auto constexpr exponent_min   = -133;
+  static auto constexpr exponent_max   =  120;
+
+  static
+  binary_t
+  to_binary(bfloat16_t const value) {
+    auto const binary = teju_bfloat16_to_binary(value.bits);
+    return binary_t{binary.exponent, binary.mantissa};
+  }
+
+  static
+  bfloat16_t
+  to_value(binary_t const binary) {
+    return detail::to_value(binary);
+  }
+
+  static
+  auto
+  teju_raw(bfloat16_t const value) {
+    return teju_bfloat16_to_decimal(value.bits);
+  }
+
+  static
+  decimal_t
+  teju(bfloat16_t const value) {
+    auto const decimal = teju_raw(value);
+    return {decimal.exponent, decimal.mantissa};
+  }
+
+}; // traits_t<bfloat16_t>
+
 #if defined(teju_has_float16)
 
 // Specialisation of traits_t for float16_t.
@@ -262,10 +311,22 @@ struct traits_t<float128_t> {
     return binary_t{binary.exponent, binary.mantissa};
   }
 
+  static
+  float128_t
+  to_value(binary_t const binary) {
+    return detail::to_value(binary);
+  }
+
+  static
+  auto
+  teju_raw(float128_t const value) {
+    return teju_float128_to_decimal(value);
+  }
+
   static
   decimal_t
   teju(float128_t const value) {
-    auto const decimal = teju_float128_to_decimal(value);
+    auto const decimal = teju_raw(value);
     return {decimal.exponent, decimal.mantissa};
   }
 
@@ -273,6 +334,50 @@ struct traits_t<float128_t> {
 
 #endif // defined(teju_has_float128)
 
+#if defined(teju_has_x86_extended)
+
+// Specialisation of traits_t for long double (x86 extended).
+template <>
+struct traits_t<long double> {
+
+  using u1_t      = teju128_u1_t;
+  using decimal_t = teju::decimal_t<long double>;
+  using binary_t  = teju::binary_t<long double>;
+
+  static auto constexpr mantissa_width =     64u;
+  static auto constexpr exponent_min   = -16445;
+  static auto constexpr exponent_max   =  16320;
+
+  static
+  binary_t
+  to_binary(long double const value) {
+    auto const binary = teju_long_double_to_binary(value);
+    return binary_t{binary.exponent, binary.mantissa};
+  }
+
+  static
+  long double
+  to_value(binary_t const binary) {
+    return detail::to_value(binary);
+  }
+
+  static
+  auto
+  teju_raw(long double const value) {
+    return teju_long_double_to_decimal(value);
+  }
+
+  static
+  decimal_t
+  teju(long double const value) {
+    auto const decimal = teju_raw(value);
+    return {decimal.exponent, decimal.mantissa};
+  }
+
+}; // traits_t<long double>
+
+#endif // defined(teju_has_x86_extended)
+
 } // namespace teju
 
 #endif // TEJU_CPP_COMMON_INCLUDE_COMMON_TRAITS_HPP_
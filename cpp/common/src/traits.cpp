@@ -23,7 +23,7 @@ namespace teju::detail {
     auto constexpr exponent_min   = traits_t::exponent_min;
     auto constexpr mantissa_width = traits_t::mantissa_width;
 
-    auto const bits = binary.exponent == exponent_min
+    u1_t const bits = binary.exponent == exponent_min
         ? u1_t(binary.mantissa)
         : (u1_t(binary.exponent - exponent_min + 1) << (mantissa_width - 1)) +
             teju_lsb(u1_t, binary.mantissa, mantissa_width - 1);
@@ -34,7 +34,39 @@ namespace teju::detail {
     return value;
   }
 
-  template float  to_value(binary_t<float >);
-  template double to_value(binary_t<double>);
+  template bfloat16_t to_value(binary_t<bfloat16_t>);
+  template float      to_value(binary_t<float     >);
+  template double     to_value(binary_t<double    >);
+
+  #if defined(teju_has_float128)
+    template float128_t to_value(binary_t<float128_t>);
+  #endif
+
+  #if defined(teju_has_x86_extended)
+
+    template <>
+    long double
+    to_value(binary_t<long double> const binary) {
+
+      using traits_t                = teju::traits_t<long double>;
+      using u1_t                    = typename traits_t::u1_t;
+      auto constexpr exponent_min   = traits_t::exponent_min;
+      auto constexpr mantissa_width = traits_t::mantissa_width;
+
+      // The mantissa keeps its integer bit which, for exponent_min, tells
+      // whether the biased exponent is 0 (subnormal) or 1 (normal).
+      auto const mantissa = u1_t(binary.mantissa);
+      auto const exponent = binary.exponent == exponent_min
+        ? mantissa >> (mantissa_width - 1)
+        : u1_t(binary.exponent - exponent_min + 1);
+      auto const bits     = exponent << mantissa_width | mantissa;
+
+      long double value;
+      std::memcpy(&value, &bits, sizeof(value));
+
+      return value;
+    }
+
+  #endif
 
 } // namespace teju::detail
@@ -0,0 +1,517 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file cpp/convert/main.cpp
+ *
+ * Converter of raw binary floating-point dumps into text.
+ */
+
+#include "common/exception.hpp"
+#include "teju/chars.h"
+#include "teju/src/config.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+  #define teju_has_mmap
+#endif
+
+namespace teju {
+
+namespace {
+
+void
+report_usage(const char* const prog) noexcept {
+  std::fprintf(stderr, "Usage: %s [OPTION]... TYPE INPUT [OUTPUT]\n"
+    "Convert the raw binary floating-point values in file INPUT to text, one "
+    "value per line, and save them in file OUTPUT (or write them to the "
+    "standard output if OUTPUT is omitted.)\n"
+    "\n"
+    "TYPE is one of float16, bfloat16, float, double, float128 or long_double "
+    "(x86 extended stored in 16 bytes.)\n"
+    "\n"
+    "Options:\n"
+    "  -b, --big-endian   INPUT is big-endian (default is little-endian.)\n"
+    "  -j, --jobs N       Use N threads (default is the number of CPUs.)\n",
+    prog);
+}
+
+/**
+ * @brief Number of values converted per block.
+ *
+ * Each block is split among the threads and, while a block is being converted,
+ * the text of the previous one is being written.
+ */
+std::size_t constexpr block_size = std::size_t{1} << 20;
+
+/**
+ * @brief Alignment of output buffers.
+ */
+std::size_t constexpr buffer_alignment = 4096;
+
+/**
+ * @brief Read-only view of a whole input file.
+ *
+ * Where available, the file is memory-mapped. Otherwise, it's read into memory.
+ */
+struct input_t {
+
+  /**
+   * @brief Constructor.
+   *
+   * @param  filename       The name of the input file.
+   */
+  explicit input_t(char const* filename) {
+
+    #if defined(teju_has_mmap)
+
+      int const fd = ::open(filename, O_RDONLY);
+      require(fd != -1, "Cannot open input file.");
+
+      struct stat info;
+      if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw exception_t{"Cannot get the size of input file."};
+      }
+
+      size_ = static_cast<std::size_t>(info.st_size);
+
+      if (size_ != 0) {
+        void* const data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd,
+          0);
+        if (data == MAP_FAILED) {
+          ::close(fd);
+          throw exception_t{"Cannot map input file."};
+        }
+        ::madvise(data, size_, MADV_SEQUENTIAL);
+        data_ = static_cast<unsigned char const*>(data);
+      }
+
+      ::close(fd);
+
+    #else
+
+      auto file = std::ifstream{filename, std::ios::binary | std::ios::ate};
+      require(file.is_open(), "Cannot open input file.");
+
+      size_ = static_cast<std::size_t>(file.tellg());
+      buffer_.resize(size_);
+      file.seekg(0);
+      file.read(reinterpret_cast<char*>(buffer_.data()),
+        static_cast<std::streamsize>(size_));
+      require(file.good(), "Cannot read input file.");
+
+      data_ = buffer_.data();
+
+    #endif
+  }
+
+  input_t(input_t const&) = delete;
+  input_t& operator=(input_t const&) = delete;
+
+  /**
+   * @brief Destructor.
+   */
+  ~input_t() {
+    #if defined(teju_has_mmap)
+      if (data_ != nullptr)
+        ::munmap(const_cast<unsigned char*>(data_), size_);
+    #endif
+  }
+
+  /**
+   * @brief Gets a pointer to the beginning of the content.
+   */
+  [[nodiscard]] unsigned char const*
+  data() const {
+    return data_;
+  }
+
+  /**
+   * @brief Gets the size (in bytes) of the content.
+   */
+  [[nodiscard]] std::size_t
+  size() const {
+    return size_;
+  }
+
+private:
+
+  unsigned char const*       data_ = nullptr;
+  std::size_t                size_ = 0;
+
+  #if !defined(teju_has_mmap)
+    std::vector<unsigned char> buffer_;
+  #endif
+};
+
+/**
+ * @brief Output file written through large, aligned and unbuffered writes.
+ */
+struct output_t {
+
+  /**
+   * @brief Constructor.
+   *
+   * @param  filename       The name of the output file or nullptr for the
+   *                        standard output.
+   */
+  explicit output_t(char const* filename) {
+    if (filename == nullptr)
+      file_ = stdout;
+    else {
+      file_ = std::fopen(filename, "wb");
+      require(file_ != nullptr, "Cannot open output file.");
+    }
+    // Writes are done in large blocks and stdio buffering only gets in the way.
+    std::setvbuf(file_, nullptr, _IONBF, 0);
+  }
+
+  output_t(output_t const&) = delete;
+  output_t& operator=(output_t const&) = delete;
+
+  /**
+   * @brief Destructor.
+   */
+  ~output_t() {
+    if (file_ != stdout)
+      std::fclose(file_);
+  }
+
+  /**
+   * @brief Writes a given number of chars.
+   *
+   * @param  chars          The chars to be written.
+   * @param  size           The number of chars.
+   */
+  void
+  write(char const* chars, std::size_t size) const {
+
+    #if defined(teju_has_mmap)
+
+      int const fd = ::fileno(file_);
+      while (size != 0) {
+        auto const n = ::write(fd, chars, size);
+        require(n > 0, "Cannot write to output file.");
+        chars += n;
+        size  -= static_cast<std::size_t>(n);
+      }
+
+    #else
+
+      require(std::fwrite(chars, 1, size, file_) == size,
+        "Cannot write to output file.");
+
+    #endif
+  }
+
+private:
+  std::FILE* file_;
+};
+
+/**
+ * @brief Aligned buffer of chars.
+ */
+struct buffer_t {
+
+  /**
+   * @brief Reserves room for at least a given number of chars.
+   *
+   * @param  size           The given number of chars.
+   */
+  void
+  reserve(std::size_t size) {
+    size = (size + buffer_alignment - 1) / buffer_alignment * buffer_alignment;
+    if (size <= capacity_)
+      return;
+    data_.reset(static_cast<char*>(::operator new[](size,
+      std::align_val_t{buffer_alignment})));
+    capacity_ = size;
+  }
+
+  /**
+   * @brief Gets a pointer to the beginning of the buffer.
+   */
+  [[nodiscard]] char*
+  data() const {
+    return data_.get();
+  }
+
+  std::size_t size = 0;
+
+private:
+
+  struct deleter_t {
+    void operator()(char* const p) const {
+      ::operator delete[](p, std::align_val_t{buffer_alignment});
+    }
+  };
+
+  std::unique_ptr<char[], deleter_t> data_;
+  std::size_t                        capacity_ = 0;
+};
+
+/**
+ * @brief Tells whether the platform is little-endian.
+ */
+bool
+is_little_endian() {
+  std::uint16_t const one = 1;
+  unsigned char first;
+  std::memcpy(&first, &one, 1);
+  return first == 1;
+}
+
+/**
+ * @brief Converts a single value to chars.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TBits            The unsigned integer type holding TFloat's bits.
+ * @tparam to_chars         Tejú Jaguá's function converting TFloat to chars.
+ */
+template <typename TFloat, typename TBits, char* (*to_chars)(char*, TFloat)>
+struct converter_t {
+
+  static std::size_t constexpr size = sizeof(TBits);
+
+  /**
+   * @brief Converts the value stored in a given address to chars.
+   *
+   * @param  chars          The beginning of the output buffer.
+   * @param  bytes          The address of the value.
+   * @param  swap           Whether the bytes of the value must be swapped.
+   *
+   * @returns Pointer to one-past-the-end of chars written.
+   */
+  static char*
+  convert(char* const chars, unsigned char const* bytes, bool const swap) {
+
+    unsigned char swapped[size];
+    if (swap) {
+      std::reverse_copy(bytes, bytes + size, swapped);
+      bytes = swapped;
+    }
+
+    TFloat value;
+    std::memcpy(&value, bytes, size);
+    return to_chars(chars, value);
+  }
+};
+
+/**
+ * @brief Converts a range of values to chars, one value per line.
+ *
+ * @tparam TConverter       The converter of single values.
+ *
+ * @param  buffer           The output buffer.
+ * @param  bytes            The address of the first value.
+ * @param  n                The number of values.
+ * @param  swap             Whether the bytes of the values must be swapped.
+ */
+template <typename TConverter>
+void
+convert_range(buffer_t& buffer, unsigned char const* bytes, std::size_t n,
+  bool const swap) {
+
+  buffer.reserve(n * (teju_chars_max + 1));
+
+  auto chars = buffer.data();
+  for (; n != 0; --n, bytes += TConverter::size) {
+    chars    = TConverter::convert(chars, bytes, swap);
+    *chars++ = '\n';
+  }
+
+  buffer.size = static_cast<std::size_t>(chars - buffer.data());
+}
+
+/**
+ * @brief Converts the whole input to text and writes it to the output.
+ *
+ * @tparam TConverter       The converter of single values.
+ *
+ * @param  input            The input.
+ * @param  output           The output.
+ * @param  swap             Whether the bytes of the values must be swapped.
+ * @param  jobs             The number of threads.
+ */
+template <typename TConverter>
+void
+convert(input_t const& input, output_t const& output, bool const swap,
+  unsigned const jobs) {
+
+  require(input.size() % TConverter::size == 0,
+    "The size of input file isn't a multiple of the size of TYPE.");
+
+  auto const n_values = input.size() / TConverter::size;
+
+  // Two sets of buffers: while one is being written, the other is being
+  // filled.
+  std::vector<buffer_t> buffers[2] = {
+    std::vector<buffer_t>(jobs), std::vector<buffer_t>(jobs)
+  };
+
+  std::future<void> writing;
+  std::size_t       current = 0;
+
+  for (std::size_t first = 0; first < n_values; first += block_size) {
+
+    auto const size       = std::min(block_size, n_values - first);
+    auto const slice_size = (size + jobs - 1) / jobs;
+    auto&      block      = buffers[current];
+
+    std::vector<std::thread> threads;
+    threads.reserve(jobs);
+
+    for (unsigned job = 0; job < jobs; ++job) {
+
+      auto const begin = std::min(size, job * slice_size);
+      auto const end   = std::min(size, begin + slice_size);
+      auto const bytes = input.data() + (first + begin) * TConverter::size;
+
+      threads.emplace_back(convert_range<TConverter>, std::ref(block[job]),
+        bytes, end - begin, swap);
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    if (writing.valid())
+      writing.get();
+
+    writing = std::async(std::launch::async, [&output, &block]() {
+      for (auto const& buffer : block)
+        output.write(buffer.data(), buffer.size);
+    });
+
+    current ^= 1;
+  }
+
+  if (writing.valid())
+    writing.get();
+}
+
+/**
+ * @brief Converts the whole input, given the name of its type, to text and
+ *        writes it to the output.
+ *
+ * @param  type             The name of the type of values in input.
+ * @param  input            The input.
+ * @param  output           The output.
+ * @param  swap             Whether the bytes of the values must be swapped.
+ * @param  jobs             The number of threads.
+ */
+void
+convert(std::string_view const type, input_t const& input,
+  output_t const& output, bool const swap, unsigned const jobs) {
+
+  #if defined(teju_has_float16)
+    if (type == "float16")
+      return convert<converter_t<float16_t, std::uint16_t,
+        teju_float16_to_chars>>(input, output, swap, jobs);
+  #endif
+
+  if (type == "bfloat16")
+    return convert<converter_t<std::uint16_t, std::uint16_t,
+      teju_bfloat16_to_chars>>(input, output, swap, jobs);
+
+  if (type == "float")
+    return convert<converter_t<float, std::uint32_t,
+      teju_float_to_chars>>(input, output, swap, jobs);
+
+  if (type == "double")
+    return convert<converter_t<double, std::uint64_t,
+      teju_double_to_chars>>(input, output, swap, jobs);
+
+  #if defined(teju_has_float128)
+    if (type == "float128")
+      return convert<converter_t<float128_t, uint128_t,
+        teju_float128_to_chars>>(input, output, swap, jobs);
+  #endif
+
+  #if defined(teju_has_x86_extended)
+    if (type == "long_double")
+      return convert<converter_t<long double, uint128_t,
+        teju_long_double_to_chars>>(input, output, swap, jobs);
+  #endif
+
+  throw exception_t{"Unsupported TYPE."};
+}
+
+} // namespace <anonymous>
+
+} // namespace teju
+
+int
+main(int const argc, const char* const argv[]) {
+
+  using namespace teju;
+
+  try {
+
+    auto is_big_endian = false;
+    auto jobs          = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<char const*> arguments;
+
+    for (int i = 1; i < argc; ++i) {
+
+      auto const argument = std::string_view{argv[i]};
+
+      if (argument == "-b" || argument == "--big-endian")
+        is_big_endian = true;
+
+      else if (argument == "-j" || argument == "--jobs") {
+        require(++i < argc, "Missing value of option --jobs.");
+        auto const n = std::strtoul(argv[i], nullptr, 10);
+        require(0 < n && n <= 1024, "Invalid value of option --jobs.");
+        jobs = static_cast<unsigned>(n);
+      }
+
+      else
+        arguments.push_back(argv[i]);
+    }
+
+    if (arguments.size() == 2 || arguments.size() == 3) {
+      auto const input  = input_t{arguments[1]};
+      auto const output = output_t{arguments.size() == 3 ? arguments[2] :
+        nullptr};
+      auto const swap   = is_big_endian == is_little_endian();
+      convert(arguments[0], input, output, swap, jobs);
+      return 0;
+    }
+
+    report_error(argv[0], "expected two or three arguments");
+    std::fprintf(stderr, "\n");
+    report_usage(argv[0]);
+  }
+
+  catch (exception_t const& e) {
+    report_error(argv[0], e.what());
+  }
+
+  catch (std::exception const& e) {
+    report_error(argv[0], e.what());
+  }
+
+  catch (...) {
+    report_error(argv[0], "unknown error");
+  }
+
+  return -1;
+}
@@ -0,0 +1,437 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file cpp/engine/engine.cpp
+ *
+ * Tejú Jaguá for binary floating-point formats defined at runtime.
+ */
+
+#include "cpp/engine/engine.hpp"
+#include "cpp/generator/config.hpp"
+#include "cpp/generator/generator.hpp"
+
+#include "common/exception.hpp"
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <cassert>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace teju {
+
+namespace {
+
+namespace mp = boost::multiprecision;
+
+/**
+ * @brief Unsigned integer of N bits for which there's no built-in type.
+ *
+ * As built-in unsigned integers, arithmetic wraps around modulo pow(2, N).
+ */
+template <unsigned N>
+using uint_t = mp::number<mp::cpp_int_backend<N, N, mp::unsigned_magnitude,
+  mp::unchecked, void>, mp::et_off>;
+
+#if defined(teju_has_uint128)
+  using u128_t = uint128_t;
+#else
+  using u128_t = uint_t<128>;
+#endif
+
+/**
+ * @brief Tejú Jaguá for a binary floating-point format defined at runtime.
+ *
+ * This mirrors teju/src/teju.h where macros are replaced by members and the
+ * multiply-and-shift by teju_built_in_2. (See teju/src/mshift.h.)
+ *
+ * @tparam u1_t             The 1-limb unsigned integer type.
+ * @tparam u2_t             The 2-limb unsigned integer type.
+ * @tparam N                The width of u1_t.
+ */
+template <typename u1_t, typename u2_t, std::uint32_t N>
+struct engine_impl_t final : engine_t {
+
+  struct fields_t {
+    std::int32_t exponent;
+    u1_t         mantissa;
+  };
+
+  struct multiplier_t {
+    u1_t upper;
+    u1_t lower;
+  };
+
+  struct minverse_t {
+    u1_t multiplier;
+    u1_t bound;
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param  format         The format.
+   */
+  explicit
+  engine_impl_t(format_t const& format) :
+    engine_t           {format, N},
+    index_offset_      {teju_log10_pow2_wide(format.exponent_min)},
+    mantissa_uncentred_{u1_t{1} << (format.mantissa_width - 1u)} {
+
+    auto const config = config_t{
+      /* id          */ "engine",
+      /* width       */ N,
+      /* spdx        */ {},
+      /* exponent    */ {format.exponent_min, format.exponent_max},
+      /* mantissa    */ {format.mantissa_width},
+      /* storage     */ {1u, "little", 1u, std::nullopt, false},
+      /* calculation */ {"", "built_in_2", 0u},
+      /* range       */ std::nullopt
+    };
+    validate(config);
+
+    auto const generator   = generator_t{config, ""};
+    auto const multipliers = generator.get_multipliers();
+    auto const mask        = (integer_t{1} << N) - 1;
+
+    sorted_ = multipliers.sorted;
+
+    multipliers_.reserve(multipliers.Us.size());
+    for (std::size_t i = 0; i < multipliers.Us.size(); ++i) {
+      require(multipliers.fs[i] == index_offset_ + std::int32_t(i),
+        "BUG: Multipliers aren't indexed by consecutive exponents.");
+      auto const& U = multipliers.Us[i];
+      multipliers_.push_back({to_u1(U >> N), to_u1(U & mask)});
+    }
+
+    for (auto const& minverse : generator.get_minverses())
+      minverses_.push_back({to_u1(minverse.multiplier),
+        to_u1(minverse.bound)});
+  }
+
+  std::int32_t
+  to_decimal(std::int32_t const exponent, std::uint64_t const* const mantissa,
+    std::uint64_t* const decimal) const override {
+
+    auto m = u1_t{0};
+    for (std::uint32_t i = 0; i < n_limbs(); ++i)
+      m |= u1_t(u1_t(mantissa[i]) << (64u * i));
+
+    assert(format().exponent_min <= exponent &&
+      exponent <= format().exponent_max && 0u < m &&
+      (m >> format().mantissa_width) == 0u &&
+      (exponent == format().exponent_min || m >= mantissa_uncentred_) &&
+      "Invalid value.");
+
+    auto const result = teju(exponent, m);
+
+    for (std::uint32_t i = 0; i < n_limbs(); ++i)
+      decimal[i] = static_cast<std::uint64_t>(u1_t(result.mantissa >>
+        (64u * i)) & ~std::uint64_t{0});
+
+    return result.exponent;
+  }
+
+private:
+
+  /**
+   * @brief Converts n to u1_t.
+   *
+   * @param  n              The number n.
+   *
+   * @pre 0 <= n && n < pow(2, N).
+   *
+   * @returns n as u1_t.
+   */
+  static u1_t
+  to_u1(integer_t const& n) {
+    auto result = u1_t{0};
+    for (auto i = N / 32u; i-- > 0;)
+      result = u1_t(result << 16u << 16u) |
+        u1_t(std::uint32_t((n >> (32u * i)) & 0xffffffffu));
+    return result;
+  }
+
+  //----------------------------------------------------------------------------
+  // Helper functions.
+  //----------------------------------------------------------------------------
+
+  static bool
+  is_multiple_of_pow2(std::int32_t const e, u1_t const n) {
+    assert(0 <= e && std::uint32_t(e) < N);
+    return u1_t(n >> e << e) == n;
+  }
+
+  bool
+  is_multiple_of_pow5(std::int32_t const f, u1_t const n) const {
+    assert(0 <= f && std::size_t(f) < minverses_.size());
+    return u1_t(n * minverses_[f].multiplier) <= minverses_[f].bound;
+  }
+
+  static u1_t
+  ror(u1_t const n) {
+    return u1_t(n << (N - 1u)) | u1_t(n >> 1u);
+  }
+
+  static u1_t
+  mshift(u1_t const m, multiplier_t const& M) {
+    auto const s01 = u2_t(u2_t(M.lower) * u2_t(m)) >> N;
+    auto const s1  = u2_t(M.upper) * u2_t(m);
+    return u1_t(u2_t(s1 + s01) >> N);
+  }
+
+  static u1_t
+  mshift_pow2(std::uint32_t const k, multiplier_t const& M) {
+    auto const s = std::int32_t(k - N);
+    if (s <= 0)
+      return u1_t(M.upper >> -s);
+    return u1_t(M.upper << s) | u1_t(M.lower >> (N - s));
+  }
+
+  multiplier_t const&
+  get_multiplier(std::int32_t const f) const {
+    return multipliers_[f - index_offset_];
+  }
+
+  static fields_t
+  remove_trailing_zeros(std::int32_t f, u1_t m) {
+    auto const max   = u1_t(~u1_t{0});
+    auto const minv5 = u1_t(u1_t{0} - max / 5u);
+    auto const bound = u1_t(max / 10u + 1u);
+    while (true) {
+      auto const q = ror(u1_t(m * minv5));
+      if (q >= bound)
+        return {f, m};
+      ++f;
+      m = q;
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Tejú Jaguá
+  //----------------------------------------------------------------------------
+
+  bool
+  is_small_integer(std::int32_t const e, u1_t const m) const {
+    return 0 <= -e && std::uint32_t(-e) < format().mantissa_width &&
+      is_multiple_of_pow2(-e, m);
+  }
+
+  bool
+  is_centred(std::int32_t const e, u1_t const m) const {
+    return m != mantissa_uncentred_ || e == format().exponent_min;
+  }
+
+  bool
+  allows_ties(std::int32_t const f) const {
+    return 0 <= f && std::size_t(f) < minverses_.size();
+  }
+
+  bool
+  is_tie(std::int32_t const f, u1_t const m) const {
+    return allows_ties(f) && is_multiple_of_pow5(f, m);
+  }
+
+  bool
+  is_tie_uncentred(std::int32_t const f, u1_t const m) const {
+    return m % 5u == 0u && is_tie(f, m);
+  }
+
+  static bool
+  wins_tiebreak(u1_t const m) {
+    return m % 2u == 0u;
+  }
+
+  static bool
+  is_closer_to_left(u1_t const c_2) {
+    return c_2 % 2u == 0u;
+  }
+
+  fields_t
+  to_decimal_centred(std::int32_t const e, u1_t const m) const {
+
+    auto const  f   = teju_log10_pow2_wide(e);
+    auto const  r   = teju_log10_pow2_residual_wide(e);
+    auto const& M   = get_multiplier(f);
+    auto const  m_b = u1_t(u1_t(2u * m + 1u) << r);
+    auto const  m_a = u1_t(u1_t(2u * m - 1u) << r);
+    auto const  b   = mshift(m_b, M);
+    auto const  a   = mshift(m_a, M);
+    auto const  q   = u1_t(b / 10u);
+    auto const  s   = u1_t(10u * q);
+
+    if (allows_ties(f)) {
+      bool const shortest =
+        s == b ? !is_tie(f, m_b) || wins_tiebreak(m) :
+        s == a ?  is_tie(f, m_a) && wins_tiebreak(m) :
+        /*else*/ s > a;
+      if (shortest)
+        return remove_trailing_zeros(f + 1, q);
+    }
+    else if (s > a)
+      return remove_trailing_zeros(f + 1, q);
+
+    auto const m_c       = u1_t(u1_t(4u * m) << r);
+    auto const c_2       = mshift(m_c, M);
+    auto const c         = u1_t(c_2 / 2u);
+    auto const pick_left = (is_tie(-f, c_2) && wins_tiebreak(c)) ||
+      is_closer_to_left(c_2);
+
+    return {f, u1_t(c + (pick_left ? 0u : 1u))};
+  }
+
+  fields_t
+  to_decimal_uncentred(std::int32_t const e) const {
+
+    auto const  m   = mantissa_uncentred_;
+    auto const  f   = teju_log10_pow2_wide(e);
+    auto const  r   = teju_log10_pow2_residual_wide(e);
+    auto const& M   = get_multiplier(f);
+    auto const  m_a = u1_t(u1_t(4u * m - 1u) << r);
+    auto const  m_b = u1_t(u1_t(2u * m + 1u) << r);
+    auto const  b   = mshift(m_b, M);
+    auto const  a   = u1_t(mshift(m_a, M) / 2u);
+    auto const  q   = u1_t(b / 10u);
+    auto const  s   = u1_t(10u * q);
+
+    if (sorted_ || a < b) {
+
+      if (allows_ties(f)) {
+        bool const shortest =
+          s == b ? !is_tie_uncentred(f, m_b) || wins_tiebreak(m) :
+          s == a ?  is_tie_uncentred(f, m_a) && wins_tiebreak(m) :
+          /*else*/ s > a;
+        if (shortest)
+          return remove_trailing_zeros(f + 1, q);
+      }
+      else if (s > a)
+        return remove_trailing_zeros(f + 1, q);
+
+      auto const log2_m_c = format().mantissa_width + r + 1u;
+      auto const c_2      = mshift_pow2(log2_m_c, M);
+      auto const c        = u1_t(c_2 / 2u);
+
+      if (c == a && !is_tie_uncentred(f, m_a))
+        return {f, u1_t(c + 1u)};
+
+      auto const pick_left = (is_tie(-f, c_2) && wins_tiebreak(c)) ||
+        is_closer_to_left(c_2);
+
+      return {f, u1_t(c + (pick_left ? 0u : 1u))};
+    }
+
+    if (is_tie_uncentred(f, m_a) && wins_tiebreak(m))
+      return remove_trailing_zeros(f, a);
+
+    auto const m_c       = u1_t(u1_t(40u * m) << r);
+    auto const c_2       = mshift(m_c, M);
+    auto const c         = u1_t(c_2 / 2u);
+    auto const pick_left = (is_tie(-f, c_2) && wins_tiebreak(c)) ||
+      is_closer_to_left(c_2);
+
+    return {f - 1, u1_t(c + (pick_left ? 0u : 1u))};
+  }
+
+  fields_t
+  teju(std::int32_t const e, u1_t const m) const {
+
+    if (is_small_integer(e, m))
+      return remove_trailing_zeros(0, u1_t(m >> -e));
+
+    if (is_centred(e, m))
+      return to_decimal_centred(e, m);
+
+    return to_decimal_uncentred(e);
+  }
+
+  std::int32_t              index_offset_;
+  u1_t                      mantissa_uncentred_;
+  bool                      sorted_;
+  std::vector<multiplier_t> multipliers_;
+  std::vector<minverse_t>   minverses_;
+
+}; // struct engine_impl_t
+
+/**
+ * @brief Creates the engine for a given format.
+ *
+ * The width of the unsigned integers is the narrowest that allows for all
+ * calculations done by Tejú Jaguá. (See
+ * generator_t::check_uncentred_refined_calculations.)
+ *
+ * @param  format           The given format.
+ *
+ * @returns The engine.
+ */
+std::unique_ptr<engine_t const>
+make_engine(engine_t::format_t const& format) {
+
+  auto const width = format.mantissa_width;
+
+  require(0u < width && width <= 248u,
+    "Constraint violation: 0 < mantissa_width && mantissa_width <= 248");
+
+  if (width + 8u <= 32u)
+    return std::make_unique<engine_impl_t<std::uint32_t, std::uint64_t, 32u>>(
+      format);
+  if (width + 8u <= 64u)
+    return std::make_unique<engine_impl_t<std::uint64_t, u128_t, 64u>>(format);
+  if (width + 8u <= 128u)
+    return std::make_unique<engine_impl_t<u128_t, uint_t<256>, 128u>>(format);
+  return std::make_unique<engine_impl_t<uint_t<256>, uint_t<512>, 256u>>(
+    format);
+}
+
+} // namespace <anonymous>
+
+//------------------------------------------------------------------------------
+// engine_t
+//------------------------------------------------------------------------------
+
+engine_t const&
+engine_t::get(format_t const& format) {
+
+  using key_t = std::tuple<std::uint32_t, std::int32_t, std::int32_t>;
+
+  static auto mutex   = std::mutex{};
+  static auto engines = std::map<key_t, std::unique_ptr<engine_t const>>{};
+
+  auto const key  = key_t{format.mantissa_width, format.exponent_min,
+    format.exponent_max};
+  auto const lock = std::lock_guard{mutex};
+
+  auto& engine = engines[key];
+  if (!engine)
+    engine = make_engine(format);
+  return *engine;
+}
+
+engine_t::engine_t(format_t const& format, std::uint32_t const width) :
+  format_{format},
+  width_ {width } {
+}
+
+engine_t::format_t const&
+engine_t::format() const {
+  return format_;
+}
+
+std::uint32_t
+engine_t::width() const {
+  return width_;
+}
+
+std::uint32_t
+engine_t::n_limbs() const {
+  return (width_ + 63u) / 64u;
+}
+
+} // namespace teju
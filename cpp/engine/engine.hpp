@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file cpp/engine/engine.hpp
+ *
+ * Tejú Jaguá for binary floating-point formats defined at runtime.
+ */
+
+#ifndef TEJU_CPP_ENGINE_ENGINE_HPP_
+#define TEJU_CPP_ENGINE_ENGINE_HPP_
+
+#include <cstdint>
+
+namespace teju {
+
+/**
+ * @brief Tejú Jaguá for a binary floating-point format defined at runtime.
+ *
+ * Values of the format are x = m * pow(2, e), where exponent_min <= e <=
+ * exponent_max, 0 < m < pow(2, mantissa_width) and, if e != exponent_min, then
+ * pow(2, mantissa_width - 1) <= m. (This is how decoders, e.g.,
+ * teju_double_to_binary, represent values of built-in types.)
+ *
+ * When an engine is created, the generator's logic (see
+ * cpp/generator/generator.hpp) calculates the multipliers in memory and, as
+ * for generated implementations, proves that they yield correct results.
+ * Engines work on unsigned integers of 32, 64, 128 or 256 bits, whichever is
+ * the narrowest for the mantissa width, and take and return mantissas as
+ * little-endian arrays of 64-bit limbs.
+ */
+struct engine_t {
+
+  /**
+   * @brief A binary floating-point format.
+   */
+  struct format_t {
+    std::uint32_t mantissa_width;
+    std::int32_t  exponent_min;
+    std::int32_t  exponent_max;
+  };
+
+  /**
+   * @brief Gets the engine for a given format.
+   *
+   * Engines are created on first use and cached. This function is thread-safe.
+   *
+   * @param  format         The given format.
+   *
+   * @pre 0 < format.mantissa_width && format.mantissa_width <= 248 and
+   *      format.exponent_min <= format.exponent_max.
+   *
+   * @returns The engine for the given format.
+   */
+  [[nodiscard]] static engine_t const&
+  get(format_t const& format);
+
+  /**
+   * @brief Destructor.
+   */
+  virtual
+  ~engine_t() = default;
+
+  /**
+   * @brief Returns the format.
+   */
+  [[nodiscard]] format_t const&
+  format() const;
+
+  /**
+   * @brief Returns the width of the unsigned integers used in calculations.
+   */
+  [[nodiscard]] std::uint32_t
+  width() const;
+
+  /**
+   * @brief Returns the number of 64-bit limbs of mantissas.
+   */
+  [[nodiscard]] std::uint32_t
+  n_limbs() const;
+
+  /**
+   * @brief Finds the shortest decimal representation of x = m * pow(2, e).
+   *
+   * @param  exponent       The exponent e.
+   * @param  mantissa       The n_limbs() limbs of m.
+   * @param  decimal        On exit, the n_limbs() limbs of the decimal
+   *                        mantissa.
+   *
+   * @pre m * pow(2, e) is a value of the format.
+   *
+   * @returns The decimal exponent.
+   */
+  [[nodiscard]] virtual std::int32_t
+  to_decimal(std::int32_t exponent, std::uint64_t const* mantissa,
+    std::uint64_t* decimal) const = 0;
+
+protected:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param  format         The format.
+   * @param  width          The width of the unsigned integers used in
+   *                        calculations.
+   */
+  engine_t(format_t const& format, std::uint32_t width);
+
+private:
+
+  format_t      format_;
+  std::uint32_t width_;
+
+}; // struct engine_t
+
+} // namespace teju
+
+#endif // TEJU_CPP_ENGINE_ENGINE_HPP_
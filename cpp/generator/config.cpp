@@ -39,6 +39,10 @@ void
 from_json(nlohmann::json const& src, config_t::storage_t& tgt) {
   src.at("split").get_to(tgt.split);
   src.at("endianness").get_to(tgt.endianness);
+  tgt.compression = src.value("compression", 1u);
+  if (src.contains("hot"))
+    tgt.hot = src["hot"].get<config_t::exponent_t>();
+  tgt.lut = src.value("lut", false);
 }
 
 void
@@ -46,6 +50,7 @@ from_json(nlohmann::json const& src, config_t::calculation_t& tgt) {
   if (src.contains("div10"))
     src["div10"].get_to(tgt.div10);
   src.at("mshift").get_to(tgt.mshift);
+  tgt.shift = src.value("shift", 0u);
 }
 
 void
@@ -57,28 +62,38 @@ from_json(nlohmann::json const& src, config_t& tgt) {
   src.at("mantissa"   ).get_to(tgt.mantissa   );
   src.at("storage"    ).get_to(tgt.storage    );
   src.at("calculation").get_to(tgt.calculation);
+  if (src.contains("range"))
+    tgt.range = src["range"].get<config_t::exponent_t>();
 }
 
 void
 validate(config_t const& json) {
 
   require(json.width == 16 || json.width == 32 || json.width == 64 ||
-    json.width == 128,
-    "Constraint violation: width in { 16, 32, 64, 128 }");
+    json.width == 128 || json.width == 256,
+    "Constraint violation: width in { 16, 32, 64, 128, 256 }");
 
   require(json.exponent.minimum <= json.exponent.maximum,
     "Constraint violation: exponent.minimum <= exponent.maximum");
 
-  std::int32_t min = teju_log10_pow2_min;
+  std::int32_t min = teju_log10_pow2_wide_min;
 
   require(json.exponent.minimum >= min,
     "Constraint violation: json.exponent.minimum >= min");
 
-  std::int32_t max = teju_log10_pow2_max;
+  std::int32_t max = teju_log10_pow2_wide_max;
 
   require(json.exponent.maximum <= max,
     "Constraint violation: json.exponent.maximum <= max");
 
+  // Multipliers are indexed by f = teju_log10_pow2_wide(e) and the generator
+  // (and compressed tables) need teju_log2_pow10(f).
+  require(teju_log10_pow2_wide(json.exponent.minimum) >= teju_log2_pow10_min &&
+    teju_log10_pow2_wide(json.exponent.maximum) <= teju_log2_pow10_max,
+    "Constraint violation: teju_log2_pow10_min <= "
+    "teju_log10_pow2_wide(exponent.minimum) and "
+    "teju_log10_pow2_wide(exponent.maximum) <= teju_log2_pow10_max");
+
   require(json.mantissa.width > 0u,
     "Constraint violation: json.mantissa.width > 0");
 
@@ -90,6 +105,37 @@ validate(config_t const& json) {
     json.storage.endianness == "big",
     "Constraint violation: storage.endianness in { \"little\", \"big\" }");
 
+  require(json.storage.compression >= 1,
+    "Constraint violation: storage.compression >= 1");
+
+  if (json.storage.hot) {
+
+    require(json.exponent.minimum <= json.storage.hot->minimum &&
+      json.storage.hot->minimum <= json.storage.hot->maximum &&
+      json.storage.hot->maximum <= json.exponent.maximum,
+      "Constraint violation: exponent.minimum <= storage.hot.minimum <= "
+      "storage.hot.maximum <= exponent.maximum");
+
+    require(json.storage.compression == 1,
+      "Constraint violation: storage.compression == 1 when storage.hot is "
+      "given");
+  }
+
+  if (json.range)
+    require(json.exponent.minimum <= json.range->minimum &&
+      json.range->minimum <= json.range->maximum &&
+      json.range->maximum <= json.exponent.maximum,
+      "Constraint violation: exponent.minimum <= range.minimum <= "
+      "range.maximum <= exponent.maximum");
+
+  // Number of bit patterns in the lookup table.
+  require(!json.storage.lut || (json.mantissa.width <= 16 &&
+    std::int64_t{json.exponent.maximum - json.exponent.minimum + 2} <<
+    (json.mantissa.width - 1) <= 65536),
+    "Constraint violation: storage.lut implies "
+    "(exponent.maximum - exponent.minimum + 2) * pow(2, mantissa.width - 1) "
+    "<= 65536");
+
   std::string const multiply_types[] = {
     "", "built_in_1", "synthetic_1", "built_in_2", "synthetic_2",
     "built_in_4"
@@ -110,6 +156,16 @@ validate(config_t const& json) {
   require(0 < i_mshift && i_mshift <= 5,
     "Constraint violation: calculation.mshift in { \"built_in_1\", "
     "\"synthetic_1\", \"built_in_2\", \"synthetic_2\", \"built_in_4\" }");
+
+  require(json.calculation.shift == 0 || (json.width < json.calculation.shift
+    && json.calculation.shift <= 2 * json.width),
+    "Constraint violation: calculation.shift == 0 || "
+    "(width < calculation.shift && calculation.shift <= 2 * width)");
+
+  require(json.calculation.shift == 0 || json.calculation.shift == 2 *
+    json.width || json.storage.compression == 1,
+    "Constraint violation: calculation.shift in { 0, 2 * width } || "
+    "storage.compression == 1");
 }
 
 } // namespace teju
@@ -15,6 +15,7 @@
 #include <nlohmann/json.hpp>
 
 #include <cstdint>
+#include <optional>
 #include <string>
 
 namespace teju {
@@ -68,6 +69,25 @@ struct config_t {
     // target system, but there might be a performance penalty if it does not.
     std::string endianness;
 
+    // Only every compression-th multiplier is stored and the others are
+    // reconstructed at runtime from the closest stored one above. This trades
+    // one extra multiplication for a table about compression times smaller.
+    // (The value 1, which is the default, means no compression.)
+    std::uint32_t compression;
+
+    // Optional window of binary exponents whose multipliers are frequently
+    // used (e.g., those of values in [1e-6, 1e12].) They are stored in a
+    // separate table, placed in its own section, so that hot multipliers of
+    // all types share as few cache lines and pages as possible. (Requires
+    // compression == 1.)
+    std::optional<exponent_t> hot;
+
+    // When true, a lookup table with the decimal representations of all
+    // (non-negative) bit patterns of finite values is also generated. This is
+    // meant for tiny formats (e.g., FP8) whose tables fit in the L2 cache.
+    // (The value false is the default.)
+    bool lut;
+
   } storage;
 
   struct calculation_t {
@@ -81,7 +101,22 @@ struct config_t {
     // "synthetic_2" or "built_in_4".
     std::string mshift;
 
+    // The shift k in the multiply-and-shift M * m >> k used to evaluate
+    // floor(alpha * m / delta). It must be in ]width, 2 * width] and the
+    // default, 0, means 2 * width. Multipliers are stored multiplied by
+    // pow(2, 2 * width - k) so that teju_mshift is unchanged.
+    std::uint32_t shift;
+
   } calculation;
+
+  // Optional window of binary exponents of values that are frequently
+  // converted (e.g., prices in [1e-4, 1e9].) If given, a function named as
+  // Tejú Jaguá's function with suffix "_range" is also generated. It reads a
+  // separate table with the multipliers for this window only, skips checks
+  // that the window rules out and falls back to Tejú Jaguá's function for
+  // exponents outside the window and for uncentred values.
+  std::optional<exponent_t> range;
+
 }; // struct config_t
 
 void
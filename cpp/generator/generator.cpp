@@ -15,7 +15,15 @@
 #include "teju/src/common.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <exception>
 #include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace teju {
 
@@ -43,6 +51,8 @@ get_prefix(std::uint32_t const width) {
       return "teju64_";
     case 128:
       return "teju128_";
+    case 256:
+      return "teju256_";
   }
   throw exception_t{"BUG: Unrecognised width."};
 }
@@ -108,6 +118,32 @@ minverse5(std::uint32_t k) {
   return m;
 }
 
+/**
+ * @brief Returns the fraction n / (a * d) simplified by a when n is multiple
+ *        of a.
+ *
+ * The maximisers found by get_maximum_1 and get_maximum_2 are, in general,
+ * such that n is multiple of a. Dividing by a keeps numerators and
+ * denominators at the size of the maximisation parameters instead of growing
+ * with the depth of the recursion.
+ *
+ * @param  n                The numerator n.
+ * @param  a                The factor a.
+ * @param  d                The factor d.
+ *
+ * @pre 0 < a && 0 < d.
+ *
+ * @returns The fraction n / (a * d).
+ */
+fraction_t
+make_fraction(integer_t n, integer_t const& a, integer_t const& d) {
+  integer_t q, r;
+  divide_qr(n, a, q, r);
+  if (r == 0)
+    return {std::move(q), d};
+  return {std::move(n), a * d};
+}
+
 /**
  * @brief The objective function of the primary maximisation problem:
  *
@@ -119,7 +155,7 @@ minverse5(std::uint32_t k) {
  *
  * @returns The value of phi_1(n).
  */
-rational_t
+fraction_t
 phi_1(integer_t const& alpha_1, integer_t const& delta_1,
   integer_t const& n) {
   return {n, delta_1 - alpha_1 * n % delta_1};
@@ -136,7 +172,7 @@ phi_1(integer_t const& alpha_1, integer_t const& delta_1,
  *
  * @returns The value of phi_2(n).
  */
-rational_t
+fraction_t
 phi_2(integer_t const& alpha_2, integer_t const& delta_2,
   integer_t const& n) {
   return {n, 1 + (alpha_2 * n - 1) % delta_2};
@@ -155,7 +191,7 @@ phi_2(integer_t const& alpha_2, integer_t const& delta_2,
  *
  * @returns The maximiser of phi_1(m) over [L_1, U_1].
  */
-rational_t
+fraction_t
 get_maximum_1(integer_t const& alpha_1, integer_t const& delta_1,
   integer_t const& L_1, integer_t const& U_1);
 
@@ -172,11 +208,11 @@ get_maximum_1(integer_t const& alpha_1, integer_t const& delta_1,
  *
  * @returns The maximiser of phi_2(m) over [L_2, U_2].
  */
-rational_t
+fraction_t
 get_maximum_2(integer_t const& alpha_2, integer_t const& delta_2,
   integer_t const& L_2, integer_t const& U_2);
 
-rational_t
+fraction_t
 get_maximum_1(integer_t const& alpha_1, integer_t const& delta_1,
   integer_t const& L_1, integer_t const& U_1) {
 
@@ -195,19 +231,18 @@ get_maximum_1(integer_t const& alpha_1, integer_t const& delta_1,
   auto const& delta_2 = alpha_1;
   auto const  other   = get_maximum_2(alpha_2, delta_2, L_2, U_2);
 
-  auto const  maximum_2 = rational_t{
-    delta_1 * numerator(other) - denominator(other),
-      alpha_1 * denominator(other)};
+  auto const  maximum_2 = make_fraction(delta_1 * other.numerator -
+    other.denominator, alpha_1, other.denominator);
 
   return std::max(maximum_1, maximum_2);
 }
 
-rational_t
+fraction_t
 get_maximum_2(integer_t const& alpha_2,
   integer_t const& delta_2, integer_t const& L_2, integer_t const& U_2) {
 
   if (alpha_2 == 0)
-    return U_2;
+    return {U_2, 1};
 
   auto maximum_1 = phi_2(alpha_2, delta_2, L_2);
 
@@ -224,13 +259,86 @@ get_maximum_2(integer_t const& alpha_2,
   auto const& delta1 = alpha_2;
   auto const  other  = get_maximum_1(alpha1, delta1, L_1, U_1);
 
-  auto const  maximum_2 = rational_t{
-    delta_2 * numerator(other) + denominator(other),
-    alpha_2 * denominator(other)};
+  auto const  maximum_2 = make_fraction(delta_2 * other.numerator +
+    other.denominator, alpha_2, other.denominator);
 
   return std::max(maximum_1, maximum_2);
 }
 
+/**
+ * @brief Gets the shortest decimal representation of m * pow(2, e) by brute
+ *        force.
+ *
+ * The shortest representation is the one with the fewest digits among the
+ * decimals in the rounding interval of m * pow(2, e). Ties are broken by
+ * picking the closest decimal and, if still tied, the one with even mantissa.
+ * (This is what Tejú Jaguá yields.)
+ *
+ * @param  e                The exponent e.
+ * @param  m                The mantissa m.
+ * @param  is_uncentred     Tells whether m * pow(2, e) is uncentred (i.e.,
+ *                          whether its lower neighbour is at pow(2, e - 2).)
+ *
+ * @pre 0 < m.
+ *
+ * @returns The decimal representation (exponent, mantissa).
+ */
+std::pair<std::int32_t, integer_t>
+get_shortest(std::int32_t const e, std::uint32_t const m,
+  bool const is_uncentred) {
+
+  // In units of pow(2, e - 2), the value is x and its rounding interval has
+  // bounds a and b.
+  auto const x         = integer_t{4 * m};
+  auto const a         = integer_t{x - (is_uncentred ? 1 : 2)};
+  auto const b         = integer_t{x + 2};
+  auto const is_closed = m % 2 == 0;
+
+  // pow(10, f) > b * pow(2, e - 2) and no decimal with exponent f is inside
+  // the interval.
+  auto f = teju_log10_pow2_wide(std::int32_t(msb(b)) + e - 1) + 1;
+
+  for (;; --f) {
+
+    // pow(10, f) == num / den in units of pow(2, e - 2).
+    auto const num = integer_t{(f >= 0 ? integer_t{pow5(f) << f} :
+      integer_t{1}) << (e <= 2 ? 2 - e : 0)};
+    auto const den = integer_t{(f <  0 ? integer_t{pow5(-f) << -f} :
+      integer_t{1}) << (e >  2 ? e - 2 : 0)};
+
+    auto const is_inside = [&](integer_t const& y) {
+      return is_closed ? a * den <= y && y <= b * den :
+        a * den < y && y < b * den;
+    };
+
+    auto best = integer_t{0};
+
+    auto const c_min = integer_t{(a * den + num - 1) / num};
+    auto const c_max = integer_t{b * den / num};
+
+    for (auto c = c_min; c <= c_max; ++c) {
+      if (c == 0 || !is_inside(integer_t{c * num}))
+        continue;
+      if (best == 0)
+        best = c;
+      else {
+        auto const d_c    = integer_t{abs(c * num - x * den)};
+        auto const d_best = integer_t{abs(best * num - x * den)};
+        if (d_c < d_best || (d_c == d_best && c % 2 == 0))
+          best = c;
+      }
+    }
+
+    if (best != 0) {
+      while (best % 10 == 0) {
+        best /= 10;
+        ++f;
+      }
+      return {f, best};
+    }
+  }
+}
+
 } // namespace <anonymous>
 
 //------------------------------------------------------------------------------
@@ -243,7 +351,7 @@ generator_t::generator_t(config_t config, std::string directory) :
   function_    {"teju_" + id()                 },
   mantissa_min_{pow2(mantissa_width() - 1u)    },
   mantissa_max_{pow2(mantissa_width()) - 1u    },
-  index_offset_{teju_log10_pow2(exponent_min())},
+  index_offset_{teju_log10_pow2_wide(exponent_min())},
   directory_   {std::move(directory)           },
   dot_h_       {id() + ".h"                    },
   dot_c_       {id() + ".c"                    } {
@@ -337,6 +445,26 @@ generator_t::storage_endianness() const {
   return config_.storage.endianness;
 }
 
+std::uint32_t
+generator_t::storage_compression() const {
+  return config_.storage.compression;
+}
+
+std::optional<config_t::exponent_t> const&
+generator_t::storage_hot() const {
+  return config_.storage.hot;
+}
+
+std::optional<config_t::exponent_t> const&
+generator_t::range() const {
+  return config_.range;
+}
+
+bool
+generator_t::storage_lut() const {
+  return config_.storage.lut;
+}
+
 std::int32_t
 generator_t::index_offset() const {
   return index_offset_;
@@ -352,6 +480,12 @@ generator_t::calculation_mshift() const {
   return config_.calculation.mshift;
 }
 
+std::uint32_t
+generator_t::calculation_shift() const {
+  return config_.calculation.shift == 0 ? 2 * width() :
+    config_.calculation.shift;
+}
+
 std::string const&
 generator_t::directory() const {
   return directory_;
@@ -397,9 +531,24 @@ generator_t::generate_dot_h(std::ostream& stream) const {
     "#ifdef __cplusplus\n"
     "extern \"C\" {\n"
     "#endif\n"
-    "\n" << prefix() << "fields_t\n" <<
+    "\n"
+    "teju_export\n" << prefix() << "fields_t\n" <<
     function() << '(' << prefix() << "fields_t binary);\n"
-    "\n" <<
+    "\n";
+
+  if (range())
+    stream <<
+      "teju_export\n" << prefix() << "fields_t\n" <<
+      function() << "_range(" << prefix() << "fields_t binary);\n"
+      "\n";
+
+  if (storage_lut())
+    stream <<
+      "teju_export\n" << prefix() << "fields_t\n" <<
+      function() << "_lut(" << prefix() << "u1_t bits);\n"
+      "\n";
+
+  stream <<
     "#ifdef __cplusplus\n"
     "}\n"
     "#endif\n"
@@ -437,20 +586,69 @@ generator_t::generate_dot_c(std::ostream& stream) const {
     "#define teju_mantissa_width       " << mantissa_width() << "u\n"
     "#define teju_storage_index_offset " << index_offset()   << "\n";
 
+  if (storage_compression() > 1)
+    stream <<
+      "#define teju_storage_compression  " << storage_compression() << "u\n"
+      "#define teju_storage_index_top    " <<
+      teju_log10_pow2_wide(exponent_max()) << "\n";
+
+  // Hot multipliers are those for f in [hot_min, hot_max].
+  auto const& hot     = storage_hot();
+  auto const  hot_min = hot ? teju_log10_pow2_wide(hot->minimum) : 0;
+  auto const  hot_max = hot ? teju_log10_pow2_wide(hot->maximum) : -1;
+
+  if (hot)
+    stream <<
+      "#define teju_storage_hot_min      " << hot_min << "\n"
+      "#define teju_storage_hot_size     " << hot_max - hot_min + 1 << "u\n";
+
+  // Multipliers of the specialised function are those for f in [range_min,
+  // range_max]. Its window contains small integers if it intersects
+  // [1 - mantissa_width(), 0]. (See is_small_integer in teju/src/teju.h.)
+  auto const& range     = this->range();
+  auto const  range_min = range ? teju_log10_pow2_wide(range->minimum) : 0;
+  auto const  range_max = range ? teju_log10_pow2_wide(range->maximum) : -1;
+
+  if (range) {
+    auto const has_small_integers = range->minimum <= 0 &&
+      range->maximum >= 1 - std::int32_t(mantissa_width());
+    stream <<
+      "#define teju_range_function       " << function() << "_range\n"
+      "#define teju_range_minimum        " << range->minimum << "\n"
+      "#define teju_range_maximum        " << range->maximum << "\n"
+      "#define teju_range_index_offset   " << range_min << "\n"
+      "#define teju_range_small_integers " << has_small_integers << "u\n";
+  }
+
+  // The build might override the calculation methods with others that are
+  // faster on the host. (See cmake/autotune.cmake.) All methods for mshift are
+  // safe but, for div10, built_in_2 and synthetic_1 are safe only if
+  // check_div10_algorithm() holds and, otherwise, div10 can't be overridden.
+  stream << "\n";
+
   if (!calculation_div10().empty()) {
 
+    auto const is_div10_overridable = check_div10_algorithm();
+
     if (calculation_div10() == "built_in_2" ||
       calculation_div10() == "synthetic_1") {
-      require(check_div10_algorithm(),
+      require(is_div10_overridable,
         "Can't use the selected algorithm for div10.");
     }
-    stream <<
-      "#define teju_calculation_div10    teju_" << calculation_div10() << "\n";
-  }
 
-  // The optimal runtime shift is twice the carrier width because it avoids
-  // teju_mshift to work on partial limbs.
-  auto const shift = 2 * width();
+    if (is_div10_overridable)
+      stream <<
+        "#if !defined(teju_calculation_div10)\n"
+        "  #define teju_calculation_div10  teju_" << calculation_div10() <<
+        "\n"
+        "#endif\n"
+        "\n";
+    else
+      stream <<
+        "#define teju_calculation_div10    teju_" << calculation_div10() <<
+        "\n"
+        "\n";
+  }
 
   auto const upper_str = "upper";
   auto const lower_str = "lower";
@@ -459,7 +657,9 @@ generator_t::generate_dot_c(std::ostream& stream) const {
   auto const last      = is_little ? upper_str : lower_str;
 
   stream <<
-    "#define teju_calculation_mshift   teju_" << calculation_mshift() << "\n"
+    "#if !defined(teju_calculation_mshift)\n"
+    "  #define teju_calculation_mshift teju_" << calculation_mshift() << "\n"
+    "#endif\n"
     "\n"
     "#define teju_function             " << function() << "\n"
     "#define teju_fields_t             " << prefix()   << "fields_t\n"
@@ -477,60 +677,264 @@ generator_t::generate_dot_c(std::ostream& stream) const {
     "  teju_u1_t const " << first << ";\n"
     "  teju_u1_t const " << last  << ";\n"
     "} teju_multiplier_t;\n"
-    "\n"
-    "static const teju_multiplier_t multipliers[] = {\n";
+    "\n";
+
+  if (storage_compression() > 1)
+    stream <<
+      "#define teju_multiplier(upper, lower) { " << first << ", " << last <<
+      " }\n"
+      "\n";
+
+  stream <<
+    "static teju_constexpr const teju_aligned teju_multiplier_t "
+    "multipliers[] = {\n";
 
   auto const p2width  = pow2(width());
   auto const mask     = p2width - 1;
   auto const splitter = splitter_t{width(), storage_split()};
-  bool       sorted   = true;
-
-  auto const get_e_0  = [](int32_t const e) {
-    return e - int32_t(teju_log10_pow2_residual(e));
-  };
-
-  auto const e_0_min  = get_e_0(exponent_min());
-  auto const e_0_max  = get_e_0(exponent_max());
-
-  for (auto e_0 = e_0_min; e_0 <= e_0_max; e_0 = get_e_0(e_0 + 4)) {
-
-    auto U = get_fast_eaf_numerator(e_0, e_0 == e_0_min);
 
-    sorted &= std::invoke([&]{
-      auto const m_a = 4 * mantissa_min() - 1;
-      auto const a   = m_a * U >> (shift + 1);
-      auto const m_b = 2 * mantissa_min() + 1;
-      auto const b   = m_b * U >> shift;
-      return a < b;
-    });
+  auto const  multipliers = get_multipliers();
+  auto const& fs          = multipliers.fs;
+  auto const& Us          = multipliers.Us;
+  auto const  sorted      = multipliers.sorted;
 
-    // Output
+  // Output
 
-    integer_t       upper = U >> width();
-    integer_t       lower = std::move(U &= mask);
-    int32_t   const f     = teju_log10_pow2(e_0);
+  auto const output = [&](integer_t U, std::int32_t const f) {
 
-    require(upper < p2width, "A multiplier is out of range.");
+    integer_t upper = U >> width();
+    integer_t lower = std::move(U &= mask);
 
     stream << "  { " <<
       (is_little ? splitter(std::move(lower)) : splitter(std::move(upper))) <<
       ", " <<
       (is_little ? splitter(std::move(upper)) : splitter(std::move(lower))) <<
       " }, // " << std::dec << f << '\n';
+  };
+
+  auto const compression = storage_compression();
+
+  if (compression == 1) {
+
+    auto const is_hot = [&](std::int32_t const f) {
+      return hot_min <= f && f <= hot_max;
+    };
+
+    for (std::size_t i = 0; i < Us.size(); ++i)
+      if (!is_hot(fs[i]))
+        output(Us[i], fs[i]);
+    stream << "};\n";
+
+    if (hot) {
+
+      stream <<
+        "\n"
+        "static teju_constexpr const teju_aligned teju_hot_section "
+        "teju_multiplier_t multipliers_hot[] = {\n";
+
+      for (std::size_t i = 0; i < Us.size(); ++i)
+        if (is_hot(fs[i]))
+          output(Us[i], fs[i]);
+      stream << "};\n";
+    }
+  }
+
+  else {
+
+    // Multipliers are indexed by t = teju_storage_index_top - f and only those
+    // for t % compression == 0 are stored (decremented by 1). For f = f_b - j,
+    // where f_b is the exponent of the stored multiplier B, teju.h reconstructs
+    // U = (B * pow(5, j) >> s) + c, where s = e_0(f_b) - e_0(f) - j and the
+    // correction c in [1, 3] is stored in 2 bits.
+
+    require(pow5(compression - 1) < p2width,
+      "Compression is too large: pow(5, compression - 1) doesn't fit a limb.");
+
+    auto const n = Us.size();
+    auto corrections = std::vector<std::uint32_t>((n + 15) / 16);
+
+    for (std::size_t t = 0; t < n; ++t) {
+
+      auto const j   = std::uint32_t(t % compression);
+      auto const i   = n - 1 - t;
+      auto const i_b = i + j;
+
+      auto const s   = std::uint32_t(teju_log2_pow10(fs[i_b]) -
+        teju_log2_pow10(fs[i]) - std::int32_t(j));
+      require(s < width(), "Compression is too large: shift is out of range.");
+
+      integer_t const B = Us[i_b] - 1;
+      integer_t const R = B * pow5(j) >> s;
+      integer_t const c = Us[i] - R;
+      require(1 <= c && c <= 3, "BUG: correction is out of range.");
+
+      corrections[t / 16] |= c.convert_to<std::uint32_t>() << (2 * (t % 16));
+
+      if (j == 0)
+        output(B, fs[i]);
+    }
+
+    stream << "};\n"
+      "\n"
+      "static teju_constexpr const teju_u1_t pow5[] = {\n";
+
+    auto p5 = integer_t{1};
+    for (std::uint32_t j = 0; j < compression; ++j) {
+      stream << "  " << splitter(p5) << ", // " << std::dec << j << '\n';
+      p5 *= 5;
+    }
+
+    stream << "};\n"
+      "\n"
+      "static teju_constexpr const uint32_t corrections[] = {\n";
+
+    for (auto const correction : corrections)
+      stream << "  0x" << std::hex << std::setw(8) << std::setfill('0') <<
+        correction << ",\n";
+
+    stream << std::dec << "};\n";
+  }
+
+  if (range) {
+
+    stream <<
+      "\n"
+      "static teju_constexpr const teju_aligned teju_multiplier_t "
+      "multipliers_range[] = {\n";
+
+    for (std::size_t i = 0; i < Us.size(); ++i)
+      if (range_min <= fs[i] && fs[i] <= range_max)
+        output(Us[i], fs[i]);
+    stream << "};\n";
   }
 
   require(sorted || check_uncentred_refined_calculations(),
     "Uncentred refined calculation could overflow.");
 
-  stream << "};\n"
+  stream <<
     "\n"
     "#define teju_calculation_sorted " << sorted << "u\n"
     "\n"
-    "static struct {\n"
+    "static teju_constexpr struct {\n"
     "  teju_u1_t const multiplier;\n"
     "  teju_u1_t const bound;\n"
     "} const minverse[] = {\n";
 
+  auto const minverses = get_minverses();
+  for (std::size_t f = 0; f < minverses.size(); ++f)
+    stream << "  { " << splitter(minverses[f].multiplier) << ", " <<
+      splitter(minverses[f].bound) << " }, // " << std::dec << f << '\n';
+
+  stream << std::dec <<
+    "};\n"
+    "\n"
+    "#include \"teju/src/teju.h\"\n";
+
+  if (storage_lut())
+    generate_lut(stream);
+
+  stream <<
+    "\n"
+    "#ifdef __cplusplus\n"
+    "}\n"
+    "#endif\n";
+}
+
+void
+generator_t::generate_lut(std::ostream& stream) const {
+
+  // Bit patterns are split into a biased exponent (0 for subnormals) and the
+  // fraction, i.e., the mantissa without its integer bit. The table stops at
+  // the largest biased exponent of finite values.
+  auto const fraction_width = mantissa_width() - 1;
+  auto const n_exponents    = std::uint32_t(exponent_max() - exponent_min() + 2);
+  auto const n_patterns     = n_exponents << fraction_width;
+  auto const integer_bit    = std::uint32_t{1} << fraction_width;
+
+  stream <<
+    "\n"
+    "static teju_constexpr const teju_aligned " << prefix() <<
+    "fields_t decimals[] = {\n"
+    "  { 0, 0 }, // 0x" << std::hex << std::setw(4) << std::setfill('0') <<
+    0 << '\n';
+
+  for (std::uint32_t bits = 1; bits < n_patterns; ++bits) {
+
+    auto const biased   = bits >> fraction_width;
+    auto const fraction = bits % integer_bit;
+    auto const exponent = exponent_min() + std::int32_t(std::max(biased, 1u)) -
+      1;
+    auto const mantissa = biased == 0 ? fraction : fraction | integer_bit;
+
+    auto const [f, c] = get_shortest(exponent, mantissa, biased > 1 &&
+      fraction == 0);
+
+    stream << std::dec << "  { " << f << ", " << c << " }, // 0x" <<
+      std::hex << std::setw(4) << std::setfill('0') << bits << '\n';
+  }
+
+  stream << std::dec <<
+    "};\n"
+    "\n"
+    "teju_function_specifier\n" << prefix() << "fields_t\n" <<
+    function() << "_lut(" << prefix() << "u1_t const bits) {\n"
+    "  assert(bits < sizeof(decimals) / sizeof(decimals[0]));\n"
+    "  return decimals[bits];\n"
+    "}\n";
+}
+
+generator_t::multipliers_t
+generator_t::get_multipliers() const {
+
+  // The optimal runtime shift is twice the carrier width because it avoids
+  // teju_mshift to work on partial limbs. A smaller shift is emulated by
+  // storing U * pow(2, 2 * width() - shift) since, for all m,
+  // floor(U * pow(2, 2 * width() - shift) * m / pow(2, 2 * width())) ==
+  // floor(U * m / pow(2, shift)).
+  auto const shift   = calculation_shift();
+  auto const p2width = pow2(width());
+
+  auto const get_e_0 = [](int32_t const e) {
+    return e - int32_t(teju_log10_pow2_residual_wide(e));
+  };
+
+  auto const e_0_min = get_e_0(exponent_min());
+  auto const e_0_max = get_e_0(exponent_max());
+
+  std::vector<std::int32_t> e_0s;
+  for (auto e_0 = e_0_min; e_0 <= e_0_max; e_0 = get_e_0(e_0 + 4))
+    e_0s.push_back(e_0);
+
+  // Multipliers for increasing values of f (one per e_0).
+  auto multipliers = multipliers_t{{}, get_fast_eaf_numerators(e_0s), true};
+
+  for (std::size_t i = 0; i < e_0s.size(); ++i) {
+
+    auto const e_0 = e_0s[i];
+    auto&      U   = multipliers.Us[i];
+
+    multipliers.sorted &= std::invoke([&]{
+      auto const m_a = 4 * mantissa_min() - 1;
+      auto const a   = m_a * U >> (shift + 1);
+      auto const m_b = 2 * mantissa_min() + 1;
+      auto const b   = m_b * U >> shift;
+      return a < b;
+    });
+
+    U <<= 2 * width() - shift;
+    require(U >> width() < p2width, "A multiplier is out of range.");
+    require(teju_log2_pow10(teju_log10_pow2_wide(e_0)) == e_0,
+      "BUG: teju_log2_pow10 doesn't match e_0.");
+
+    multipliers.fs.push_back(teju_log10_pow2_wide(e_0));
+  }
+
+  return multipliers;
+}
+
+std::vector<generator_t::minverse_t>
+generator_t::get_minverses() const {
+
   // Let M = mantissa_max(). Tejú Jaguá might call is_multiple_of_pow5(n, f) for
   // the following values of  n:
   //
@@ -549,30 +953,24 @@ generator_t::generate_dot_c(std::ostream& stream) const {
   // follows that n is not multiple of pow(5, f), that is,
   // is_multiple_of_pow5(n, f) == false.
 
+  auto const p2width    = pow2(width());
+  auto const mask       = p2width - 1;
   auto const bound      = 320 * mantissa_max();
   auto const minv5      = minverse5(width());
   auto       multiplier = integer_t{1};
   auto       p5         = integer_t{1};
-  for (std::int32_t f = 0; p5 < bound; ++f) {
 
-    auto bnd = p2width / p5 - (f == 0);
+  std::vector<minverse_t> minverses;
+  for (std::int32_t f = 0; p5 < bound; ++f) {
 
-    stream << "  { " << splitter(multiplier) << ", " <<
-      splitter(std::move(bnd)) << " }, // " << std::dec << f << '\n';
+    minverses.push_back({multiplier, p2width / p5 - (f == 0)});
 
     multiplier *= minv5;
     multiplier &= mask;
     p5         *= 5;
   }
 
-  stream << std::dec <<
-    "};\n"
-    "\n"
-    "#include \"teju/src/teju.h\"\n"
-    "\n"
-    "#ifdef __cplusplus\n"
-    "}\n"
-    "#endif\n";
+  return minverses;
 }
 
 bool
@@ -626,21 +1024,78 @@ generator_t::check_uncentred_refined_calculations() const {
   return 8 + mantissa_width() <= width();
 }
 
-integer_t
-generator_t::get_fast_eaf_numerator(int32_t const e_0, bool const is_min)
+std::vector<integer_t>
+generator_t::get_fast_eaf_numerators(std::vector<std::int32_t> const& e_0s)
   const {
 
-  auto const shift = 2 * width();
-  auto const f     = teju_log10_pow2(e_0);
+  if (e_0s.empty())
+    return {};
+
+  // Powers of 5 are calculated incrementally (rather than by
+  // exponentiation) and shared by all threads.
+  auto const f_min = teju_log10_pow2_wide(e_0s.front());
+  auto const f_max = teju_log10_pow2_wide(e_0s.back());
+  auto pow5s = std::vector<integer_t>(std::max(-f_min, f_max) + 1);
+  pow5s[0] = 1;
+  for (std::size_t i = 1; i < pow5s.size(); ++i)
+    pow5s[i] = 5 * pow5s[i - 1];
+
+  // Blocks of exponents are calculated in parallel. Each thread picks the
+  // next available block since calculations for larger exponents are slower.
+  auto constexpr block_size = std::size_t{16};
+
+  auto Us        = std::vector<integer_t>(e_0s.size());
+  auto next      = std::atomic<std::size_t>{0};
+  auto failure   = std::exception_ptr{};
+  auto failure_m = std::mutex{};
+
+  auto const work = [&]() {
+    try {
+      for (auto begin = next.fetch_add(block_size); begin < e_0s.size();
+        begin = next.fetch_add(block_size)) {
+        auto const end = std::min(begin + block_size, e_0s.size());
+        for (auto i = begin; i < end; ++i) {
+          auto const f = teju_log10_pow2_wide(e_0s[i]);
+          Us[i] = get_fast_eaf_numerator(e_0s[i], i == 0, pow5s[std::abs(f)]);
+        }
+      }
+    }
+    catch (...) {
+      auto const lock = std::lock_guard{failure_m};
+      failure = std::current_exception();
+      next    = e_0s.size();
+    }
+  };
+
+  auto const n_threads = std::max(1u, std::thread::hardware_concurrency());
+  auto threads = std::vector<std::thread>{};
+  for (unsigned i = 1; i < n_threads; ++i)
+    threads.emplace_back(work);
+  work();
+  for (auto& thread : threads)
+    thread.join();
+
+  if (failure)
+    std::rethrow_exception(failure);
+
+  return Us;
+}
+
+integer_t
+generator_t::get_fast_eaf_numerator(int32_t const e_0, bool const is_min,
+  integer_t const& pow5_f) const {
+
+  auto const shift = calculation_shift();
+  auto const f     = teju_log10_pow2_wide(e_0);
 
   integer_t alpha, delta;
   if (f <= 0) {
-    alpha = pow5(-f);
+    alpha = pow5_f;
     delta = pow2(-(e_0 - 1 - f));
   }
   else {
     alpha = pow2(e_0 - 1 - f);
-    delta = pow5(f);
+    delta = pow5_f;
   }
 
   auto const maximum = get_maximum(alpha, delta, is_min);
@@ -648,13 +1103,13 @@ generator_t::get_fast_eaf_numerator(int32_t const e_0, bool const is_min)
   integer_t q, r;
   divide_qr(alpha << shift, delta, q, r);
 
-  require(maximum < rational_t{pow2(shift), delta - r},
-    "Unable to use shift that is twice the width.");
+  require(maximum < fraction_t{pow2(shift), delta - r},
+    "Unable to use the configured shift (calculation.shift).");
 
   return q + 1;
 }
 
-rational_t
+fraction_t
 generator_t::get_maximum(integer_t alpha, integer_t const& delta,
   bool const is_min) const {
 
@@ -14,7 +14,9 @@
 #include "multiprecision.hpp"
 
 #include <cstdint>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace teju {
 
@@ -38,6 +40,50 @@ struct generator_t {
   void
   generate() const;
 
+  /**
+   * @brief Multipliers for all decimal exponents f yielded by Tejú Jaguá.
+   */
+  struct multipliers_t {
+
+    // The exponents f in increasing order.
+    std::vector<std::int32_t> fs;
+
+    // The multipliers (2-limb integers) for the exponents in fs.
+    std::vector<integer_t> Us;
+
+    // Tells whether the uncentred case is sorted, i.e., whether a < b for all
+    // exponents. (See teju_calculation_sorted in teju/src/teju.h.)
+    bool sorted;
+
+  };
+
+  /**
+   * @brief Modular inverse of pow(5, f) and bound used by is_multiple_of_pow5.
+   */
+  struct minverse_t {
+    integer_t multiplier;
+    integer_t bound;
+  };
+
+  /**
+   * @brief Calculates the multipliers.
+   *
+   * This is also used at runtime by the engine (see cpp/engine/engine.hpp).
+   *
+   * @returns The multipliers.
+   */
+  [[nodiscard]] multipliers_t
+  get_multipliers() const;
+
+  /**
+   * @brief Calculates the modular inverses of pow(5, f) for all f such that
+   *        is_multiple_of_pow5(n, f) might not be trivially false.
+   *
+   * @returns The modular inverses and bounds indexed by f.
+   */
+  [[nodiscard]] std::vector<minverse_t>
+  get_minverses() const;
+
 private:
 
   /**
@@ -118,6 +164,31 @@ private:
   [[nodiscard]] std::string const&
   storage_endianness() const;
 
+  /**
+   * @brief Returns the compression factor of the storage.
+   */
+  [[nodiscard]] std::uint32_t
+  storage_compression() const;
+
+  /**
+   * @brief Returns the window of binary exponents of hot multipliers (if any).
+   */
+  [[nodiscard]] std::optional<config_t::exponent_t> const&
+  storage_hot() const;
+
+  /**
+   * @brief Returns the window of binary exponents of the specialised function
+   *        (if any).
+   */
+  [[nodiscard]] std::optional<config_t::exponent_t> const&
+  range() const;
+
+  /**
+   * @brief Returns whether a lookup table is generated.
+   */
+  [[nodiscard]] bool
+  storage_lut() const;
+
   /**
    * @brief Returns the index offset.
    */
@@ -136,6 +207,12 @@ private:
   [[nodiscard]] std::string const&
   calculation_mshift() const;
 
+  /**
+   * @brief Returns the shift used in the calculation of multipliers.
+   */
+  [[nodiscard]] std::uint32_t
+  calculation_shift() const;
+
   /**
    * @brief Returns the directory where generated files are saved.
    */
@@ -180,6 +257,17 @@ private:
   void
   generate_dot_c(std::ostream& stream) const;
 
+  /**
+   * @brief Streams out the lookup table and the function that reads it.
+   *
+   * The table has the decimal representations of all bit patterns of
+   * non-negative finite values, calculated by brute force.
+   *
+   * @param  stream         Output stream to receive the content.
+   */
+  void
+  generate_lut(std::ostream& stream) const;
+
   /**
    * @brief Check whether Tejú Jaguá can use the algorithm of Theorem 4 [1] to
    *        perform division by 10.
@@ -228,15 +316,30 @@ private:
    *
    * This function returns an integer U such that
    *   U * n / 2^k == n * 2^(e0 - 1) / 10^f,
-   * where k = 2 * width().
+   * where k = calculation_shift().
    *
    * @param  e_0            The binary exponent.
    * @param  is_min         Tells whether the exponent e_0 is the minimal one.
+   * @param  pow5_f         The value of pow(5, |f|).
    *
    * @returns The numerator of the fast EAF.
    */
   [[nodiscard]] integer_t
-  get_fast_eaf_numerator(int32_t e_0, bool is_min) const;
+  get_fast_eaf_numerator(int32_t e_0, bool is_min, integer_t const& pow5_f)
+    const;
+
+  /**
+   * @brief Gets the numerators of the fast EAFs for given binary exponents.
+   *
+   * Exponents are split into blocks which are processed in parallel.
+   *
+   * @param  e_0s           The binary exponents in increasing order. (The
+   *                        first one is the minimal one.)
+   *
+   * @returns The numerators of the fast EAFs (see get_fast_eaf_numerator).
+   */
+  [[nodiscard]] std::vector<integer_t>
+  get_fast_eaf_numerators(std::vector<std::int32_t> const& e_0s) const;
 
   /**
    * @brief Given alpha and delta, this function calculates the maximum of
@@ -254,7 +357,7 @@ private:
    *
    * @returns The maximum of phi_1(n) over the relevant set of values.
    */
-  [[nodiscard]] rational_t
+  [[nodiscard]] fraction_t
   get_maximum(integer_t alpha, integer_t const& delta, bool is_min) const;
 
   config_t     config_;
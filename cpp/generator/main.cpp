@@ -23,8 +23,8 @@ namespace teju {
 
 void
 report_usage(const char* const prog) noexcept {
-  std::fprintf(stderr, "Usage: %s [OPTION]... CONFIG DIR\n"
-    "Generate Tejú Jaguá source files for the given JSON configuration file "
+  std::fprintf(stderr, "Usage: %s [OPTION]... CONFIG... DIR\n"
+    "Generate Tejú Jaguá source files for the given JSON configuration files "
     "CONFIG. The files are saved in directory DIR.\n",
     prog);
 }
@@ -60,13 +60,16 @@ main(int const argc, const char* const argv[]) {
 
   try {
 
-    if (argc == 3) {
-      auto const generator = parse(argv[1], argv[2]);
-      generator.generate();
+    if (argc >= 3) {
+      auto const dir = argv[argc - 1];
+      for (int i = 1; i < argc - 1; ++i) {
+        auto const generator = parse(argv[i], dir);
+        generator.generate();
+      }
       return 0;
     }
 
-    report_error(argv[0], "expected two arguments");
+    report_error(argv[0], "expected at least two arguments");
     std::fprintf(stderr, "\n");
     report_usage(argv[0]);
 
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "teju_all.h"
+
+#include "amalgamated.hpp"
+
+namespace teju {
+namespace test {
+namespace amalgamated {
+
+teju16_fields_t
+bfloat16_to_decimal(std::uint16_t const bits) {
+  return teju_bfloat16_to_decimal(bits);
+}
+
+#if defined(teju_has_float16)
+teju32_fields_t
+to_decimal(float16_t const value) {
+  return teju_float16_to_decimal(value);
+}
+#endif // defined(teju_has_float16)
+
+teju32_fields_t
+to_decimal(float const value) {
+  return teju_float_to_decimal(value);
+}
+
+teju64_fields_t
+to_decimal(double const value) {
+  return teju_double_to_decimal(value);
+}
+
+#if defined(teju_has_float128)
+teju128_fields_t
+to_decimal(float128_t const value) {
+  return teju_float128_to_decimal(value);
+}
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+teju128_fields_t
+to_decimal(long double const value) {
+  return teju_long_double_to_decimal(value);
+}
+#endif // defined(teju_has_x86_extended)
+
+} // namespace amalgamated
+} // namespace test
+} // namespace teju
@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file cpp/test/amalgamated.hpp
+ *
+ * Wrappers around the decoders and implementations in teju_all.h.
+ *
+ * They're defined in a separate translation unit since teju_all.h and the
+ * library headers define functions with the same names.
+ */
+
+#ifndef TEJU_CPP_TEST_AMALGAMATED_HPP_
+#define TEJU_CPP_TEST_AMALGAMATED_HPP_
+
+#include "teju/src/config.h"
+
+#include <cstdint>
+
+namespace teju {
+namespace test {
+namespace amalgamated {
+
+teju16_fields_t
+bfloat16_to_decimal(std::uint16_t bits);
+
+#if defined(teju_has_float16)
+teju32_fields_t
+to_decimal(float16_t value);
+#endif // defined(teju_has_float16)
+
+teju32_fields_t
+to_decimal(float value);
+
+teju64_fields_t
+to_decimal(double value);
+
+#if defined(teju_has_float128)
+teju128_fields_t
+to_decimal(float128_t value);
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+teju128_fields_t
+to_decimal(long double value);
+#endif // defined(teju_has_x86_extended)
+
+} // namespace amalgamated
+} // namespace test
+} // namespace teju
+
+#endif // TEJU_CPP_TEST_AMALGAMATED_HPP_
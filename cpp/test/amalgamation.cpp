@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "amalgamated.hpp"
+
+#include "teju/bfloat16.h"
+#include "teju/double.h"
+#include "teju/float.h"
+#include "teju/float128.h"
+#include "teju/float16.h"
+#include "teju/long_double.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+namespace {
+
+namespace amalgamated = teju::test::amalgamated;
+
+/**
+ * @brief Gets a value from its bit pattern.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TU1              The unsigned integer type of the same size.
+ *
+ * @param  bits             The bit pattern.
+ *
+ * @returns The value.
+ */
+template <typename TFloat, typename TU1>
+TFloat
+from_bits(TU1 const bits) {
+  static_assert(sizeof(TFloat) == sizeof(TU1));
+  TFloat value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+TEST(amalgamation, bfloat16) {
+  for (std::uint16_t bits = 1; bits < 0x7f80; ++bits) {
+    auto const expected = teju_bfloat16_to_decimal(bits);
+    auto const actual   = amalgamated::bfloat16_to_decimal(bits);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << bits;
+  }
+}
+
+#if defined(teju_has_float16)
+
+TEST(amalgamation, float16) {
+  for (std::uint16_t bits = 1; bits < 0x7c00; ++bits) {
+    auto const value    = from_bits<float16_t>(bits);
+    auto const expected = teju_float16_to_decimal(value);
+    auto const actual   = amalgamated::to_decimal(value);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << bits;
+  }
+}
+
+#endif // defined(teju_has_float16)
+
+TEST(amalgamation, float) {
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint32_t>{1,
+    0x7f7fffff};
+  for (int i = 0; i < 100'000; ++i) {
+    auto const bits     = distribution(device);
+    auto const value    = from_bits<float>(bits);
+    auto const expected = teju_float_to_decimal(value);
+    auto const actual   = amalgamated::to_decimal(value);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << bits;
+  }
+}
+
+TEST(amalgamation, double) {
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{1,
+    0x7fefffffffffffff};
+  for (int i = 0; i < 100'000; ++i) {
+    auto const bits     = distribution(device);
+    auto const value    = from_bits<double>(bits);
+    auto const expected = teju_double_to_decimal(value);
+    auto const actual   = amalgamated::to_decimal(value);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << bits;
+  }
+}
+
+#if defined(teju_has_float128)
+
+TEST(amalgamation, float128) {
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{0,
+    0x7ffeffffffffffff};
+  for (int i = 0; i < 10'000; ++i) {
+    auto const bits     = uint128_t{distribution(device)} << 64 | device();
+    if (bits == 0u)
+      continue;
+    auto const value    = from_bits<float128_t>(bits);
+    auto const expected = teju_float128_to_decimal(value);
+    auto const actual   = amalgamated::to_decimal(value);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "i = " << i;
+    ASSERT_TRUE(actual.mantissa == expected.mantissa) << "i = " << i;
+  }
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+TEST(amalgamation, long_double) {
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint16_t>{1, 0x7ffe};
+  for (int i = 0; i < 10'000; ++i) {
+    // Normal values have the integer bit set.
+    auto const bits     = uint128_t{distribution(device)} << 64 | device() |
+      std::uint64_t{1} << 63;
+    auto const value    = from_bits<long double>(bits);
+    auto const expected = teju_long_double_to_decimal(value);
+    auto const actual   = amalgamated::to_decimal(value);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "i = " << i;
+    ASSERT_TRUE(actual.mantissa == expected.mantissa) << "i = " << i;
+  }
+}
+
+#endif // defined(teju_has_x86_extended)
+
+} // namespace <anonymous>
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "common/traits.hpp"
+#include "reference.hpp"
+#include "teju/bfloat16.h"
+#include "teju/float16.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Gets the shortest decimal representation of a given value by brute
+ *        force (see teju::test::reference).
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  binary           The binary representation of the value.
+ *
+ * @returns The decimal representation of the given value (exponent, mantissa).
+ */
+template <typename TFloat>
+std::pair<std::int32_t, std::uint32_t>
+reference(teju::binary_t<TFloat> const binary) {
+
+  using traits_t = teju::traits_t<TFloat>;
+
+  auto const m = std::uint32_t{binary.mantissa};
+  auto const e = std::int32_t{binary.exponent};
+
+  auto const is_uncentred = m == 1u << (traits_t::mantissa_width - 1) &&
+    e != traits_t::exponent_min;
+
+  auto const [f, c] = teju::test::reference(e, m, is_uncentred);
+  return std::make_pair(f, static_cast<std::uint32_t>(c));
+}
+
+/**
+ * @brief Checks a batch conversion over all 16-bit patterns against the
+ *        reference and the scalar conversion.
+ *
+ * Tails and unaligned inputs are covered by a second conversion that skips the
+ * first pattern.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TFields          The type of decimal representations.
+ *
+ * @param  batch            The batch conversion.
+ * @param  exponent_mask    The bits of the biased exponent.
+ */
+template <typename TFloat, typename TFields>
+void
+test_exhaustive(void (*batch)(std::uint16_t const*, TFields*, std::size_t),
+  std::uint16_t const exponent_mask) {
+
+  using traits_t = teju::traits_t<TFloat>;
+
+  auto constexpr n = std::size_t{1} << 16;
+
+  auto bits = std::vector<std::uint16_t>(n);
+  for (std::size_t i = 0; i < n; ++i)
+    bits[i] = static_cast<std::uint16_t>(i);
+
+  auto decimals = std::vector<TFields>(n);
+  batch(bits.data(), decimals.data(), n);
+
+  auto shifted = std::vector<TFields>(n - 1);
+  batch(bits.data() + 1, shifted.data(), n - 1);
+
+  for (std::size_t i = 0; i < n; ++i) {
+
+    auto const abs     = static_cast<std::uint16_t>(bits[i] & 0x7fffu);
+    auto const decimal = decimals[i];
+
+    if (i != 0) {
+      ASSERT_EQ(shifted[i - 1].exponent, decimal.exponent) << "bits = " << i;
+      ASSERT_EQ(shifted[i - 1].mantissa, decimal.mantissa) << "bits = " << i;
+    }
+
+    if (abs == 0u || (abs & exponent_mask) == exponent_mask) {
+      ASSERT_EQ(decimal.exponent, 0) << "bits = " << i;
+      ASSERT_EQ(decimal.mantissa, 0u) << "bits = " << i;
+      continue;
+    }
+
+    // Values are symmetric and only positive ones are checked thoroughly.
+    if (abs != bits[i])
+      continue;
+
+    TFloat value;
+    std::memcpy(&value, &abs, sizeof(value));
+
+    auto const scalar = traits_t::teju(value);
+    ASSERT_EQ(decimal.exponent, scalar.exponent) << "bits = " << i;
+    ASSERT_EQ(decimal.mantissa, scalar.mantissa) << "bits = " << i;
+
+    auto const [exponent, mantissa] = reference<TFloat>(
+      traits_t::to_binary(value));
+    ASSERT_EQ(decimal.exponent, exponent) << "bits = " << i;
+    ASSERT_EQ(decimal.mantissa, mantissa) << "bits = " << i;
+  }
+}
+
+TEST(batch, bfloat16) {
+  test_exhaustive<teju::bfloat16_t>(teju_bfloat16_to_decimal_batch, 0x7f80u);
+}
+
+#if defined(teju_has_float16)
+
+TEST(batch, float16) {
+  test_exhaustive<float16_t>(teju_float16_to_decimal_batch, 0x7c00u);
+}
+
+#endif // defined(teju_has_float16)
+
+} // namespace <anonymous>
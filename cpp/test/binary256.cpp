@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks the implementation for binary256 against the brute-force reference.
+// Unless the platform supports unsigned _BitInt(256) in C++, the implementation
+// is instantiated with Boost.Multiprecision's fixed-width integers.
+
+#include "reference.hpp"
+#include "teju/src/config.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+#if !defined(teju_has_uint256)
+
+  namespace mp = boost::multiprecision;
+
+  using uint256_t = mp::number<mp::cpp_int_backend<256, 256,
+    mp::unsigned_magnitude, mp::unchecked, void>>;
+  using uint512_t = mp::number<mp::cpp_int_backend<512, 512,
+    mp::unsigned_magnitude, mp::unchecked, void>>;
+
+  #define teju256_u1_t uint256_t
+  #define teju256_u2_t uint512_t
+
+  typedef struct {
+    int32_t      exponent;
+    teju256_u1_t mantissa;
+  } teju256_fields_t;
+
+#endif
+
+// Renaming teju_ieee256 and teju_multiplier_t avoids clashes with the library
+// and ODR violations with other test files which also include generated
+// sources.
+#define teju_ieee256      teju_ieee256_test
+#define teju_multiplier_t teju_ieee256_multiplier_t
+#include "teju/src/generated/ieee256.c"
+
+namespace {
+
+using teju::test::integer_t;
+
+TEST(binary256, reference) {
+
+  auto constexpr exponent_min   = std::int32_t{-262378};
+  auto constexpr exponent_max   = std::int32_t{ 261907};
+  auto const     integer_bit    = integer_t{1} << 236u;
+
+  auto device   = std::mt19937_64{};
+  auto exponent = std::uniform_int_distribution<std::int32_t>{exponent_min,
+    exponent_max};
+
+  auto test = [](std::int32_t const e, integer_t const& m) {
+    auto const is_uncentred = m == (integer_t{1} << 236u) && e != exponent_min;
+    auto const expected     = teju::test::reference(e, m, is_uncentred);
+    auto const binary       = teju256_fields_t{e, teju256_u1_t{m}};
+    auto const actual       = teju_ieee256_test(binary);
+    ASSERT_EQ(actual.exponent, expected.first) << "e = " << e << ", m = " <<
+      m;
+    ASSERT_EQ(integer_t{actual.mantissa}, expected.second) << "e = " << e <<
+      ", m = " << m;
+  };
+
+  // Extremes, subnormals and integers.
+  test(exponent_min, 1u);
+  test(exponent_min, integer_bit - 1u);
+  test(exponent_max, integer_bit);
+  test(exponent_max, 2u * integer_bit - 1u);
+  for (std::int32_t e = -236; e < 0; e += 5)
+    test(e, integer_bit);
+  test(-200, integer_bit | integer_t{12345} << 200u);
+
+  // For random exponents, the uncentred, the smallest and largest centred and
+  // a random mantissa are tested.
+  for (int i = 0; i < 50; ++i) {
+
+    auto const e = exponent(device);
+
+    auto fraction = integer_t{0};
+    for (int j = 0; j < 4; ++j)
+      fraction = fraction << 64u | device();
+    fraction %= integer_bit;
+
+    test(e, integer_bit);
+    test(e, integer_bit + 1u);
+    test(e, 2u * integer_bit - 1u);
+    test(e, integer_bit | fraction);
+  }
+}
+
+} // namespace <anonymous>
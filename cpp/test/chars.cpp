@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "teju/chars.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+/**
+ * @brief Converts a double value to a std::string using teju_double_to_chars.
+ *
+ * @param  value            The value to be converted.
+ *
+ * @returns The std::string.
+ */
+std::string
+to_string(double const value) {
+  char chars[teju_chars_max];
+  auto const end = teju_double_to_chars(chars, value);
+  return std::string(chars, end);
+}
+
+TEST(chars, teju64_to_chars) {
+
+  struct test_data_t {
+    teju64_fields_t decimal;
+    char const*     expected;
+    int             line;
+  };
+
+  test_data_t data[] = {
+    { {   0,                    1 }, "1"                     , __LINE__ },
+    { {   0,                   15 }, "1.5e1"                 , __LINE__ },
+    { {   9,                   15 }, "1.5e10"                , __LINE__ },
+    { {  -3,                    1 }, "1e-3"                  , __LINE__ },
+    { {  -1,                   15 }, "1.5"                   , __LINE__ },
+    { {  -2,                   15 }, "1.5e-1"                , __LINE__ },
+    { {  -2,                  123 }, "1.23"                  , __LINE__ },
+    { {  -5,                  123 }, "1.23e-3"               , __LINE__ },
+    { {-324,                    5 }, "5e-324"                , __LINE__ },
+    { { 292,    17976931348623157 }, "1.7976931348623157e308", __LINE__ },
+    { {   0, 18446744073709551615u}, "1.8446744073709551615e19", __LINE__ },
+  };
+
+  for (auto const& [decimal, expected, line] : data) {
+
+    char chars[teju_chars_max];
+    auto const end    = teju64_to_chars(chars, decimal);
+    auto const actual = std::string(chars, end);
+
+    EXPECT_EQ(actual, expected) << "    Note: test case line = " << line;
+    EXPECT_EQ(teju64_chars_size(decimal), actual.size()) <<
+      "    Note: test case line = " << line;
+  }
+}
+
+TEST(chars, double_special_values) {
+
+  using limits_t = std::numeric_limits<double>;
+
+  EXPECT_EQ(to_string( 0.0                ), "0"   );
+  EXPECT_EQ(to_string(-0.0                ), "-0"  );
+  EXPECT_EQ(to_string( limits_t::infinity()), "inf" );
+  EXPECT_EQ(to_string(-limits_t::infinity()), "-inf");
+  EXPECT_EQ(to_string( limits_t::quiet_NaN()), "nan" );
+  EXPECT_EQ(to_string(-1.0                ), "-1"  );
+  EXPECT_EQ(to_string( 0.1                ), "1e-1");
+}
+
+// Checks that strtod reads back the value written by teju_double_to_chars.
+TEST(chars, double_round_trip) {
+
+  using traits_t = std::numeric_limits<std::uint64_t>;
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{0,
+    traits_t::max()};
+
+  for (auto i = 0; i < 1'000'000 && !HasFailure(); ++i) {
+
+    auto const bits = distribution(device);
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    if (value != value)
+      continue;
+
+    auto const chars = to_string(value);
+    auto const back  = std::strtod(chars.c_str(), nullptr);
+    std::uint64_t back_bits;
+    std::memcpy(&back_bits, &back, sizeof(back));
+
+    ASSERT_EQ(bits, back_bits) << "Value = " << chars;
+  }
+}
+
+TEST(chars, bfloat16) {
+
+  char chars[teju_chars_max];
+
+  // 1.0, 0.1 ~= 0x3dcd and the largest finite value.
+  auto end = teju_bfloat16_to_chars(chars, 0x3f80);
+  EXPECT_EQ(std::string(chars, end), "1");
+
+  end = teju_bfloat16_to_chars(chars, 0x3dcd);
+  EXPECT_EQ(std::string(chars, end), "1e-1");
+
+  end = teju_bfloat16_to_chars(chars, 0x7f7f);
+  EXPECT_EQ(std::string(chars, end), "3.39e38");
+
+  end = teju_bfloat16_to_chars(chars, 0xff80);
+  EXPECT_EQ(std::string(chars, end), "-inf");
+}
+
+#if defined(teju_has_x86_extended)
+
+TEST(chars, long_double) {
+
+  using limits_t = std::numeric_limits<long double>;
+
+  auto to_string = [](long double const value) {
+    char chars[teju_chars_max];
+    auto const end = teju_long_double_to_chars(chars, value);
+    return std::string(chars, end);
+  };
+
+  EXPECT_EQ(to_string( 0.0L                 ), "0"   );
+  EXPECT_EQ(to_string(-0.0L                 ), "-0"  );
+  EXPECT_EQ(to_string( limits_t::infinity() ), "inf" );
+  EXPECT_EQ(to_string(-limits_t::infinity() ), "-inf");
+  EXPECT_EQ(to_string( limits_t::quiet_NaN()), "nan" );
+  EXPECT_EQ(to_string(-1.0L                 ), "-1"  );
+  EXPECT_EQ(to_string( 0.1L                 ), "1e-1");
+  EXPECT_EQ(to_string( limits_t::denorm_min()), "4e-4951");
+  EXPECT_EQ(to_string( limits_t::max()      ), "1.189731495357231765e4932");
+
+  // Checks that strtold reads back the value.
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 1'000'000 && !HasFailure(); ++i) {
+
+    auto const mantissa = device();
+    auto const exponent = std::uint16_t(device());
+
+    // Skips values whose integer bit doesn't match the biased exponent. They
+    // are either invalid on modern x86 CPUs or non-canonical.
+    if ((mantissa >> 63u) != ((exponent & 0x7fffu) != 0u))
+      continue;
+
+    long double value = 0;
+    std::memcpy(&value, &mantissa, sizeof(mantissa));
+    std::memcpy(reinterpret_cast<char*>(&value) + sizeof(mantissa), &exponent,
+      sizeof(exponent));
+
+    if (value != value)
+      continue;
+
+    auto const chars = to_string(value);
+    auto const back  = std::strtold(chars.c_str(), nullptr);
+
+    ASSERT_EQ(std::memcmp(&value, &back, 10), 0) << "Value = " << chars;
+  }
+}
+
+#endif // defined(teju_has_x86_extended)
+
+} // namespace <anonymous>
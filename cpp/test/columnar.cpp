@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "teju/chars.h"
+#include "teju/columnar.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Converts a value to a std::string using teju_{float,double}_to_chars.
+ *
+ * @param  value            The value to be converted.
+ *
+ * @returns The std::string.
+ */
+std::string
+to_string(float const value) {
+  char chars[teju_chars_max];
+  return std::string(chars, teju_float_to_chars(chars, value));
+}
+
+/**
+ * @copydoc to_string(float)
+ */
+std::string
+to_string(double const value) {
+  char chars[teju_chars_max];
+  return std::string(chars, teju_double_to_chars(chars, value));
+}
+
+/**
+ * @brief Forwards to teju_{float,double}_column_offsets.
+ */
+bool
+column_offsets(float const* const values, std::uint8_t const* const validity,
+  std::size_t const n, std::int32_t* const offsets,
+  teju32_fields_t* const decimals) {
+  return teju_float_column_offsets(values, validity, n, offsets, decimals);
+}
+
+/**
+ * @copydoc column_offsets(float const*, std::uint8_t const*, std::size_t,
+ *          std::int32_t*, teju32_fields_t*)
+ */
+bool
+column_offsets(double const* const values, std::uint8_t const* const validity,
+  std::size_t const n, std::int32_t* const offsets,
+  teju64_fields_t* const decimals) {
+  return teju_double_column_offsets(values, validity, n, offsets, decimals);
+}
+
+/**
+ * @brief Forwards to teju_{float,double}_column_to_chars.
+ */
+void
+column_to_chars(float const* const values, std::uint8_t const* const validity,
+  std::size_t const n, std::int32_t const* const offsets,
+  teju32_fields_t const* const decimals, char* const data) {
+  teju_float_column_to_chars(values, validity, n, offsets, decimals, data);
+}
+
+/**
+ * @copydoc column_to_chars(float const*, std::uint8_t const*, std::size_t,
+ *          std::int32_t const*, teju32_fields_t const*, char*)
+ */
+void
+column_to_chars(double const* const values, std::uint8_t const* const validity,
+  std::size_t const n, std::int32_t const* const offsets,
+  teju64_fields_t const* const decimals, char* const data) {
+  teju_double_column_to_chars(values, validity, n, offsets, decimals, data);
+}
+
+/**
+ * @brief Checks that the columnar conversion matches value-by-value conversion
+ *        for random bit patterns (including zeros, infinities and NaNs) with
+ *        and without validity bitmap and decimals buffer.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TFields          The type of decimal representations.
+ */
+template <typename TFloat, typename TFields>
+void
+test_column() {
+
+  using u1_t     = std::conditional_t<sizeof(TFloat) == 4, std::uint32_t,
+    std::uint64_t>;
+  using limits_t = std::numeric_limits<TFloat>;
+
+  auto constexpr n = std::size_t{10'000};
+
+  auto device = std::mt19937_64{};
+  auto values = std::vector<TFloat>(n);
+
+  for (auto& value : values) {
+    auto const bits = static_cast<u1_t>(device());
+    std::memcpy(&value, &bits, sizeof(value));
+  }
+
+  values[0] =  TFloat{0};
+  values[1] = -TFloat{0};
+  values[2] =  limits_t::infinity();
+  values[3] = -limits_t::infinity();
+  values[4] =  limits_t::quiet_NaN();
+  values[5] = -limits_t::quiet_NaN();
+
+  auto validity = std::vector<std::uint8_t>((n + 7) / 8);
+  for (auto& byte : validity)
+    byte = static_cast<std::uint8_t>(device());
+
+  for (auto const use_validity : { false, true }) {
+    for (auto const use_decimals : { false, true }) {
+
+      auto const base = std::int32_t{use_validity ? 17 : 0};
+      auto const is_valid = [&](std::size_t const i) {
+        return !use_validity || (validity[i / 8] >> (i % 8) & 1) != 0;
+      };
+
+      auto offsets  = std::vector<std::int32_t>(n + 1);
+      auto decimals = std::vector<TFields>(n);
+      offsets[0]    = base;
+
+      ASSERT_TRUE(column_offsets(values.data(), use_validity ?
+        validity.data() : nullptr, n, offsets.data(), use_decimals ?
+        decimals.data() : nullptr));
+
+      auto data = std::string(static_cast<std::size_t>(offsets[n]), '?');
+
+      column_to_chars(values.data(), use_validity ? validity.data() : nullptr,
+        n, offsets.data(), use_decimals ? decimals.data() : nullptr,
+        data.data());
+
+      for (std::size_t i = 0; i < n; ++i) {
+        auto const actual   = data.substr(offsets[i], offsets[i + 1] -
+          offsets[i]);
+        auto const expected = is_valid(i) ? to_string(values[i]) : "";
+        ASSERT_EQ(actual, expected) << "i = " << i << ", validity = " <<
+          use_validity << ", decimals = " << use_decimals;
+      }
+    }
+  }
+}
+
+TEST(columnar, float) {
+  test_column<float, teju32_fields_t>();
+}
+
+TEST(columnar, double) {
+  test_column<double, teju64_fields_t>();
+}
+
+TEST(columnar, overflow) {
+
+  auto const value   = -1.2345678901234567e-300;
+  std::int32_t offsets[2] = { std::numeric_limits<std::int32_t>::max() - 8 };
+
+  EXPECT_FALSE(teju_double_column_offsets(&value, nullptr, 1, offsets,
+    nullptr));
+}
+
+} // namespace <anonymous>
@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks the implementations for double and float128_t with compressed tables
+// of multipliers against those with the full tables. (Unless teju is built with
+// teju_compressed_tables, in which case the latter is also compressed.)
+
+#if defined(teju_has_uint128)
+
+#if defined(teju_has_float128)
+  // Renaming teju_multiplier_t avoids ODR violations with other test files
+  // which also include generated sources.
+  #define teju_ieee128_compressed teju_ieee128_compressed_test
+  #define teju_multiplier_t       teju_ieee128_multiplier_t
+  #include "teju/src/generated/ieee128_compressed.c"
+  #include "teju/src/generated/ieee128.h"
+#endif
+
+#include "teju/src/generated/ieee64_compressed.h"
+#include "teju/src/generated/ieee64_with_uint128.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace {
+
+TEST(compressed, double) {
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{0,
+    0xfffffffffffff};
+
+  auto test = [](std::int32_t const exponent, std::uint64_t const mantissa) {
+    auto const binary   = teju64_fields_t{exponent, mantissa};
+    auto const expected = teju_ieee64_with_uint128(binary);
+    auto const actual   = teju_ieee64_compressed(binary);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "exponent = " <<
+      exponent << ", mantissa = " << mantissa;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "exponent = " <<
+      exponent << ", mantissa = " << mantissa;
+  };
+
+  // Every exponent uses a different multiplier and, for each of them, the
+  // uncentred, the smallest and largest centred and random mantissas are
+  // tested.
+  for (std::int32_t exponent = -1074; exponent <= 971; ++exponent) {
+
+    auto constexpr integer_bit = std::uint64_t{1} << 52u;
+
+    test(exponent, integer_bit);
+    test(exponent, integer_bit + 1u);
+    test(exponent, 2u * integer_bit - 1u);
+
+    for (int i = 0; i < 1'000; ++i)
+      test(exponent, integer_bit | distribution(device));
+  }
+
+  // Subnormals.
+  for (int i = 0; i < 100'000; ++i) {
+    auto const mantissa = distribution(device);
+    if (mantissa != 0u)
+      test(-1074, mantissa);
+  }
+}
+
+#if defined(teju_has_float128)
+
+TEST(compressed, float128) {
+
+  auto device = std::mt19937_64{};
+
+  auto test = [](std::int32_t const exponent, uint128_t const mantissa) {
+    auto const binary   = teju128_fields_t{exponent, mantissa};
+    auto const expected = teju_ieee128(binary);
+    auto const actual   = teju_ieee128_compressed_test(binary);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "exponent = " <<
+      exponent;
+    ASSERT_TRUE(actual.mantissa == expected.mantissa) << "exponent = " <<
+      exponent;
+  };
+
+  auto constexpr integer_bit = uint128_t{1} << 112u;
+
+  for (std::int32_t exponent = -16494; exponent <= 16271; ++exponent) {
+
+    test(exponent, integer_bit);
+    test(exponent, integer_bit + 1u);
+    test(exponent, 2u * integer_bit - 1u);
+
+    for (int i = 0; i < 3; ++i) {
+      auto const fraction = (uint128_t{device()} << 64u | device()) %
+        integer_bit;
+      test(exponent, integer_bit | fraction);
+    }
+  }
+}
+
+#endif // defined(teju_has_float128)
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_uint128)
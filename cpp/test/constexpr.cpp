@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks teju::to_decimal and teju::to_chars of the amalgamation in constant
+// expressions and against the library at runtime. (Compiled as C++20.)
+
+#include "teju_all.h"
+
+#include "teju/chars.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string_view>
+
+#if defined(teju_has_constexpr)
+
+namespace {
+
+/**
+ * @brief Writes a given value to a null-terminated array of chars.
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  value            The given value.
+ *
+ * @returns The array of chars.
+ */
+template <typename TFloat>
+constexpr
+std::array<char, teju::chars_max + 1u>
+to_array(TFloat const value) {
+  auto chars = std::array<char, teju::chars_max + 1u>{};
+  teju::to_chars(chars.data(), value);
+  return chars;
+}
+
+/**
+ * @brief Checks whether the array written for a given value is a given string.
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  value            The given value.
+ * @param  expected         The given string.
+ *
+ * @returns true if the strings match and false, otherwise.
+ */
+template <typename TFloat>
+constexpr
+bool
+writes(TFloat const value, std::string_view const expected) {
+  return std::string_view{to_array(value).data()} == expected;
+}
+
+static_assert(teju::to_decimal(1.5).exponent == -1);
+static_assert(teju::to_decimal(1.5).mantissa == 15u);
+static_assert(teju::to_decimal(0.3f).mantissa == 3u);
+
+static_assert(writes(0.1, "1e-1"));
+static_assert(writes(3.14159, "3.14159"));
+static_assert(writes(-1e300, "-1e300"));
+static_assert(writes(5e-324, "5e-324"));
+static_assert(writes(1.7976931348623157e308, "1.7976931348623157e308"));
+static_assert(writes(123456.0f, "1.23456e5"));
+static_assert(writes(0.0, "0"));
+static_assert(writes(-0.0f, "-0"));
+static_assert(writes(-__builtin_inf(), "-inf"));
+static_assert(writes(__builtin_nanf(""), "nan"));
+
+TEST(constant_expression, double) {
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 1'000'000 && !HasFailure(); ++i) {
+
+    auto const bits  = device();
+    auto       value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    char expected[teju_chars_max];
+    char actual[teju::chars_max];
+    auto const expected_end = teju_double_to_chars(expected, value);
+    auto const actual_end   = teju::to_chars(actual, value);
+
+    ASSERT_EQ(std::string_view(actual, actual_end - actual),
+      std::string_view(expected, expected_end - expected)) << "bits = " << bits;
+  }
+}
+
+TEST(constant_expression, float) {
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 1'000'000 && !HasFailure(); ++i) {
+
+    auto const bits  = static_cast<std::uint32_t>(device());
+    auto       value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    char expected[teju_chars_max];
+    char actual[teju::chars_max];
+    auto const expected_end = teju_float_to_chars(expected, value);
+    auto const actual_end   = teju::to_chars(actual, value);
+
+    ASSERT_EQ(std::string_view(actual, actual_end - actual),
+      std::string_view(expected, expected_end - expected)) << "bits = " << bits;
+  }
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_constexpr)
@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "teju/dispatch.h"
+
+#if defined(teju_has_dispatch)
+
+#include "teju/double.h"
+#include "teju/float.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Restores the ISA level in use on destruction.
+ */
+struct isa_guard_t {
+  teju_isa_t const isa = teju_get_isa();
+  ~isa_guard_t() { teju_set_isa(isa); }
+};
+
+/**
+ * @brief Checks that all ISA levels supported by the CPU produce the same
+ *        results for random values.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TU1              The unsigned integer type of the same size.
+ * @tparam TFields          The type of decimal representations.
+ *
+ * @param  to_decimal       Tejú Jaguá's function converting TFloat.
+ */
+template <typename TFloat, typename TU1, typename TFields>
+void
+test_levels(TFields (*to_decimal)(TFloat)) {
+
+  using limits_t = std::numeric_limits<TFloat>;
+
+  auto to_bits = [](TFloat const value) {
+    TU1 bits;
+    std::memcpy(&bits, &value, sizeof(value));
+    return bits;
+  };
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<TU1>{
+    to_bits(limits_t::denorm_min()), to_bits(limits_t::max())};
+
+  auto values = std::vector<TFloat>(10'000);
+  for (auto& value : values) {
+    auto const bits = distribution(device);
+    std::memcpy(&value, &bits, sizeof(value));
+  }
+
+  auto const guard = isa_guard_t{};
+
+  ASSERT_TRUE(teju_set_isa(teju_isa_x86_64));
+  EXPECT_EQ(teju_get_isa(), teju_isa_x86_64);
+
+  auto expected = std::vector<TFields>{};
+  for (auto const value : values)
+    expected.push_back(to_decimal(value));
+
+  for (auto const isa : { teju_isa_x86_64_v3, teju_isa_x86_64_v4 }) {
+
+    if (!teju_set_isa(isa))
+      continue;
+
+    EXPECT_EQ(teju_get_isa(), isa);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      auto const actual = to_decimal(values[i]);
+      ASSERT_EQ(actual.exponent, expected[i].exponent) << "isa = " << isa;
+      ASSERT_EQ(actual.mantissa, expected[i].mantissa) << "isa = " << isa;
+    }
+  }
+}
+
+TEST(dispatch, float) {
+  test_levels<float, std::uint32_t>(teju_float_to_decimal);
+}
+
+TEST(dispatch, double) {
+  test_levels<double, std::uint64_t>(teju_double_to_decimal);
+}
+
+TEST(dispatch, invalid) {
+  EXPECT_FALSE(teju_set_isa(static_cast<teju_isa_t>(3)));
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_dispatch)
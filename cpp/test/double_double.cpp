@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks the decoder of double-double values against exact calculations and
+// Tejú Jaguá's results for them against the brute-force reference.
+
+#if defined(teju_has_uint128)
+
+#include "reference.hpp"
+#include "teju/double_double.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <utility>
+
+namespace {
+
+using teju::test::integer_t;
+using u1_t = teju128_u1_t;
+
+auto constexpr exponent_min = std::int32_t{-1074};
+auto constexpr integer_bit  = teju_pow2(u1_t, 106u);
+
+/**
+ * @brief Gets m * pow(2, e + 1200) as an integer.
+ *
+ * @param  e                The exponent e.
+ * @param  m                The mantissa m.
+ *
+ * @pre -1200 <= e.
+ *
+ * @returns The integer m * pow(2, e + 1200).
+ */
+integer_t
+to_integer(std::int32_t const e, integer_t const& m) {
+  return integer_t{m << unsigned(e + 1200)};
+}
+
+/**
+ * @brief Gets the exact value of a given double multiplied by pow(2, 1200).
+ *
+ * @param  value            The given value.
+ *
+ * @returns The exact value multiplied by pow(2, 1200).
+ */
+integer_t
+to_integer(double const value) {
+  if (value == 0)
+    return 0;
+  auto const binary = teju_double_to_binary(std::fabs(value));
+  auto const result = to_integer(binary.exponent, binary.mantissa);
+  return value < 0 ? integer_t{-result} : result;
+}
+
+/**
+ * @brief Gets a random double-double value whose trailing component is at
+ *        most pow(2, -gap) times the half ulp of the leading one.
+ *
+ * @param  device           The random number generator.
+ * @param  gap              The value of gap.
+ *
+ * @returns The pair (hi, lo) or (hi, 0) if the random lo isn't normalised.
+ */
+std::pair<double, double>
+random_value(std::mt19937_64& device, int const gap) {
+
+  auto const max = std::numeric_limits<double>::max();
+  auto bits = std::uint64_t{0};
+  auto hi   = 0.0;
+  while (!(hi > 0 && hi <= max)) {
+    bits = device() >> 1u;
+    std::memcpy(&hi, &bits, sizeof(hi));
+  }
+
+  auto const ulp      = std::nextafter(hi, 2 * max) - hi;
+  auto const fraction = std::ldexp(double(std::int64_t(device())), -64 - gap);
+  auto const lo       = std::isfinite(ulp) ? fraction * ulp : 0.0;
+  return {hi, hi + lo == hi ? lo : 0.0};
+}
+
+TEST(double_double, to_binary) {
+
+  struct test_data_t {
+    double           hi;
+    double           lo;
+    teju128_fields_t binary;
+    int              line;
+  };
+
+  auto const max = std::numeric_limits<double>::max();
+  auto const den = std::numeric_limits<double>::denorm_min();
+
+  auto const a = integer_bit;
+  auto const b = 2 * integer_bit;
+
+  test_data_t const data[] = {
+    { 1.0      ,  0.0       , {  -106, a                         }, __LINE__ },
+    { 1.0      ,  0x1p-60   , {  -106, a + teju_pow2(u1_t, 46u)  }, __LINE__ },
+    // Power of 2 and lo < 0.
+    { 1.0      , -0x1p-60   , {  -107, b - teju_pow2(u1_t, 47u)  }, __LINE__ },
+    // Rounding with carry.
+    { 1.0      , -0x1p-200  , {  -106, a                         }, __LINE__ },
+    // Rounding ties to even.
+    { 1.0      ,  0x1p-107  , {  -106, a                         }, __LINE__ },
+    { 1.0      ,  0x1.8p-107, {  -106, a + 1u                    }, __LINE__ },
+    { 1.0      ,  0x1.8p-106, {  -106, a + 2u                    }, __LINE__ },
+    // Subnormals.
+    { den      ,  0.0       , { -1074, 1u                        }, __LINE__ },
+    { 0x1p-1000,  0x1p-1070 , { -1074, teju_pow2(u1_t, 74u) + 16u}, __LINE__ },
+    { max      ,  0.0       , {   917, b - teju_pow2(u1_t, 54u)  }, __LINE__ },
+  };
+
+  for (auto const& [hi, lo, binary, line] : data) {
+    auto const actual = teju_double_double_to_binary(hi, lo);
+    EXPECT_EQ(actual.exponent, binary.exponent) <<
+      "    Note: test case line = " << line;
+    EXPECT_TRUE(actual.mantissa == binary.mantissa) <<
+      "    Note: test case line = " << line;
+  }
+}
+
+TEST(double_double, to_binary_rounding) {
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 100'000 && !HasFailure(); ++i) {
+
+    auto const [hi, lo] = random_value(device, int(device() % 80u));
+    auto const binary   = teju_double_double_to_binary(hi, lo);
+
+    auto const exact  = integer_t{to_integer(hi) + to_integer(lo)};
+    auto const actual = to_integer(binary.exponent, binary.mantissa);
+    auto const error  = integer_t{abs(actual - exact)};
+    auto const half   = to_integer(binary.exponent - 1, 1);
+
+    ASSERT_TRUE(binary.mantissa < 2 * integer_bit) << hi << " + " << lo;
+    ASSERT_TRUE(binary.mantissa >= integer_bit ||
+      binary.exponent == exponent_min) << hi << " + " << lo;
+    ASSERT_TRUE(error < half || (error == half &&
+      binary.mantissa % 2u == 0u)) << hi << " + " << lo;
+  }
+}
+
+TEST(double_double, hard_coded_values) {
+
+  struct test_data_t {
+    double           hi;
+    double           lo;
+    std::int32_t     exponent;
+    integer_t        mantissa;
+    int              line;
+  };
+
+  test_data_t const data[] = {
+    { 1.0                    ,  0.0                    ,   0, 1, __LINE__ },
+    { 0x1.999999999999ap-4   , -0x1.999999999999ap-58  ,  -1, 1, __LINE__ },
+    { 0x1.7e43c8800759cp+996 , -0x1.698fdc7ace0cap+942 , 300, 1, __LINE__ },
+    { 0x1.5555555555555p-2   ,  0x1.5555555555555p-56  , -33,
+      integer_t{"333333333333333333333333333333332"}, __LINE__ },
+  };
+
+  for (auto const& [hi, lo, exponent, mantissa, line] : data) {
+    auto const actual = teju_double_double_to_decimal(hi, lo);
+    EXPECT_EQ(actual.exponent, exponent) <<
+      "    Note: test case line = " << line;
+    EXPECT_EQ(integer_t{actual.mantissa}, mantissa) <<
+      "    Note: test case line = " << line;
+  }
+}
+
+TEST(double_double, comparison_to_reference) {
+
+  auto test = [](double const hi, double const lo) {
+
+    auto const binary = teju_double_double_to_binary(hi, lo);
+    auto const m      = integer_t{binary.mantissa};
+
+    auto const is_uncentred = binary.mantissa == integer_bit &&
+      binary.exponent != exponent_min;
+    auto const expected = teju::test::reference(binary.exponent, m,
+      is_uncentred);
+    auto const actual   = teju_double_double(binary);
+
+    ASSERT_EQ(actual.exponent, expected.first) << hi << " + " << lo;
+    ASSERT_EQ(integer_t{actual.mantissa}, expected.second) << hi << " + " <<
+      lo;
+  };
+
+  // Powers of 2, i.e., all uncentred values.
+  for (auto e = -1074; e <= 1023 && !HasFailure(); ++e)
+    test(std::ldexp(1.0, e), 0.0);
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 100'000 && !HasFailure(); ++i) {
+    auto const [hi, lo] = random_value(device, int(device() % 80u));
+    test(hi, lo);
+  }
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_uint128)
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks engines for formats defined at runtime against the generated
+// implementations and against the brute-force reference.
+
+#include "reference.hpp"
+#include "common/exception.hpp"
+#include "cpp/engine/engine.hpp"
+#include "teju/double.h"
+#include "teju/float.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace {
+
+using teju::test::integer_t;
+using engine_t = teju::engine_t;
+
+/**
+ * @brief Calls engine.to_decimal for m * pow(2, e).
+ *
+ * @param  engine           The engine.
+ * @param  e                The exponent e.
+ * @param  m                The mantissa m.
+ *
+ * @returns The decimal representation (exponent, mantissa).
+ */
+std::pair<std::int32_t, integer_t>
+to_decimal(engine_t const& engine, std::int32_t const e, integer_t const& m) {
+
+  auto mantissa = std::vector<std::uint64_t>(engine.n_limbs());
+  auto decimal  = std::vector<std::uint64_t>(engine.n_limbs());
+
+  for (std::uint32_t i = 0; i < engine.n_limbs(); ++i)
+    mantissa[i] = static_cast<std::uint64_t>(integer_t{m >> (64u * i)} &
+      ~std::uint64_t{0});
+
+  auto const exponent = engine.to_decimal(e, mantissa.data(), decimal.data());
+
+  auto result = integer_t{0};
+  for (auto i = engine.n_limbs(); i-- > 0;)
+    result = integer_t{result << 64u} + decimal[i];
+
+  return {exponent, result};
+}
+
+TEST(engine, float) {
+
+  auto const& engine = engine_t::get({24, -149, 104});
+  EXPECT_EQ(engine.width(), 32u);
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 100'000 && !HasFailure(); ++i) {
+
+    auto const bits  = static_cast<std::uint32_t>(device()) >> 1u;
+    auto       value = 0.0f;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (!(value > 0 && std::isfinite(value)))
+      continue;
+
+    auto const binary   = teju_float_to_binary(value);
+    auto const expected = teju_float_to_decimal(value);
+    auto const actual   = to_decimal(engine, binary.exponent, binary.mantissa);
+
+    ASSERT_EQ(actual.first, expected.exponent) << value;
+    ASSERT_EQ(actual.second, expected.mantissa) << value;
+  }
+}
+
+TEST(engine, double) {
+
+  auto const& engine = engine_t::get({53, -1074, 971});
+  EXPECT_EQ(engine.width(), 64u);
+
+  auto test = [&](double const value) {
+    auto const binary   = teju_double_to_binary(value);
+    auto const expected = teju_double_to_decimal(value);
+    auto const actual   = to_decimal(engine, binary.exponent, binary.mantissa);
+    ASSERT_EQ(actual.first, expected.exponent) << value;
+    ASSERT_EQ(actual.second, expected.mantissa) << value;
+  };
+
+  // Powers of 2, i.e., all uncentred values.
+  for (auto e = -1074; e <= 1023 && !HasFailure(); ++e)
+    test(std::ldexp(1.0, e));
+
+  auto device = std::mt19937_64{};
+
+  for (auto i = 0; i < 100'000 && !HasFailure(); ++i) {
+
+    auto const bits  = device() >> 1u;
+    auto       value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+    if (!(value > 0 && std::isfinite(value)))
+      continue;
+
+    test(value);
+  }
+}
+
+TEST(engine, reference) {
+
+  // Formats that no generated implementation covers, including one whose
+  // mantissa spans several limbs.
+  engine_t::format_t const formats[] = {
+    {100,   -300,   300},
+    {200, -10000, 10000},
+  };
+
+  auto device = std::mt19937_64{};
+
+  for (auto const& format : formats) {
+
+    auto const& engine      = engine_t::get(format);
+    auto const  integer_bit = integer_t{1} << (format.mantissa_width - 1u);
+
+    auto test = [&](std::int32_t const e, integer_t const& m) {
+      auto const is_uncentred = m == integer_bit && e != format.exponent_min;
+      auto const expected     = teju::test::reference(e, m, is_uncentred);
+      auto const actual       = to_decimal(engine, e, m);
+      ASSERT_EQ(actual.first, expected.first) << m << " * 2^" << e;
+      ASSERT_EQ(actual.second, expected.second) << m << " * 2^" << e;
+    };
+
+    // Uncentred values.
+    for (auto e = format.exponent_min; e <= format.exponent_max &&
+      !HasFailure(); e += 7)
+      test(e, integer_bit);
+
+    auto exponent = std::uniform_int_distribution<std::int32_t>{
+      format.exponent_min, format.exponent_max};
+
+    for (auto i = 0; i < 10'000 && !HasFailure(); ++i) {
+
+      auto m = integer_t{0};
+      for (auto j = 0u; j < format.mantissa_width; j += 64u)
+        m = integer_t{m << 64u} + device();
+      m = integer_t{m % integer_bit + integer_bit};
+
+      test(exponent(device), m);
+    }
+  }
+}
+
+TEST(engine, cache) {
+  auto const& engine = engine_t::get({53, -1074, 971});
+  EXPECT_EQ(&engine, &engine_t::get({53, -1074, 971}));
+  EXPECT_NE(&engine, &engine_t::get({53, -1074, 970}));
+  EXPECT_EQ(engine.n_limbs(), 1u);
+  EXPECT_EQ(engine_t::get({200, -10000, 10000}).n_limbs(), 4u);
+}
+
+TEST(engine, invalid_format) {
+  EXPECT_THROW((void) engine_t::get({  0, -10, 10}), teju::exception_t);
+  EXPECT_THROW((void) engine_t::get({249, -10, 10}), teju::exception_t);
+  EXPECT_THROW((void) engine_t::get({ 53,  10, -10}), teju::exception_t);
+}
+
+} // namespace <anonymous>
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks the lookup tables for E4M3 and E5M2 against Tejú Jaguá for all finite
+// and strictly positive values. The tables are calculated by the generator by
+// brute force and, therefore, independently of Tejú Jaguá.
+
+#include "teju/fp8.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace {
+
+/**
+ * @brief Checks the decimal representations read from the lookup table
+ *        against those calculated by Tejú Jaguá for all values in (0, limit).
+ *
+ * @param  to_binary        The decoder of bit patterns.
+ * @param  to_decimal       The conversion backed by the lookup table.
+ * @param  teju             Tejú Jaguá.
+ * @param  limit            The smallest invalid bit pattern.
+ */
+void
+test_exhaustive(teju16_fields_t (*to_binary)(std::uint8_t),
+  teju16_fields_t (*to_decimal)(std::uint8_t),
+  teju16_fields_t (*teju)(teju16_fields_t), std::uint8_t const limit) {
+
+  for (std::uint8_t bits = 1; bits < limit; ++bits) {
+    auto const expected = teju(to_binary(bits));
+    auto const actual   = to_decimal(bits);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << +bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << +bits;
+  }
+}
+
+TEST(fp8, e4m3) {
+  test_exhaustive(teju_fp8_e4m3_to_binary, teju_fp8_e4m3_to_decimal,
+    teju_fp8_e4m3, 0x7f);
+}
+
+TEST(fp8, e5m2) {
+  test_exhaustive(teju_fp8_e5m2_to_binary, teju_fp8_e5m2_to_decimal,
+    teju_fp8_e5m2, 0x7c);
+}
+
+TEST(fp8, e4m3_values) {
+  // 0x01 = 2^-9 ~= 2e-3, 0x38 = 1 and 0x7e = 448 ~= 45e1.
+  auto const min = teju_fp8_e4m3_to_decimal(0x01);
+  EXPECT_EQ(min.exponent, -3);
+  EXPECT_EQ(min.mantissa, 2u);
+  auto const one = teju_fp8_e4m3_to_decimal(0x38);
+  EXPECT_EQ(one.exponent, 0);
+  EXPECT_EQ(one.mantissa, 1u);
+  auto const max = teju_fp8_e4m3_to_decimal(0x7e);
+  EXPECT_EQ(max.exponent, 1);
+  EXPECT_EQ(max.mantissa, 45u);
+}
+
+TEST(fp8, e5m2_values) {
+  // 0x3c = 1 and 0x7b = 57344 ~= 6e4.
+  auto const one = teju_fp8_e5m2_to_decimal(0x3c);
+  EXPECT_EQ(one.exponent, 0);
+  EXPECT_EQ(one.mantissa, 1u);
+  auto const max = teju_fp8_e5m2_to_decimal(0x7b);
+  EXPECT_EQ(max.exponent, 4);
+  EXPECT_EQ(max.mantissa, 6u);
+}
+
+} // namespace <anonymous>
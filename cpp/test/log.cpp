@@ -8,6 +8,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <limits>
 
@@ -83,6 +84,63 @@ TEST(log, teju_log10_pow2_backward) {
   EXPECT_NE(teju_log10_pow2(e), f) << "Minimum " << min << " isn't sharp.";
 }
 
+TEST(log, teju_log2_pow10_forward) {
+
+  // f in [0, max]
+  auto constexpr max = std::int32_t{teju_log2_pow10_max};
+
+  // Loop invariant: 2^(e - 1) < 10^f <= 2^e
+
+  // f == 0:
+  auto e     = std::int32_t{0};
+  auto pow10 = mp_int_t{1}; // 10^f
+  auto pow2  = mp_int_t{1}; // 2^e
+
+  for (std::int32_t f = 0; f <= max; ++f) {
+
+    ASSERT_EQ(teju_log2_pow10(f), e) << "Note f = " << f;
+
+    // Restore loop invariant for next iteration.
+    pow10 *= 10;
+    while (pow2 < pow10) {
+      pow2 *= 2;
+      ++e;
+    }
+  }
+
+  auto constexpr f = max + 1;
+  EXPECT_NE(teju_log2_pow10(f), e) << "Maximum " << max << " isn't sharp.";
+}
+
+TEST(log, teju_log2_pow10_backward) {
+
+  // f in [min, 0]
+  auto constexpr min = std::int32_t{teju_log2_pow10_min};
+
+  // Loop invariant: 2^(e - 1)  < 10^f    <= 2^e
+  //                 2^(-e + 1) > 10^(-f) >= 2^(-e)
+
+  // f == 0:
+  auto e     = std::int32_t{0};
+  auto pow10 = mp_int_t{1}; // 10^(-f)
+  auto pow2  = mp_int_t{1}; // 2^(-e)
+
+  for (std::int32_t f = 0; f >= min; --f) {
+
+    ASSERT_EQ(teju_log2_pow10(f), e) << "Note f = " << f;
+
+    // Restore loop invariant for next iteration.
+    pow10 *= 10;
+    while (2 * pow2 <= pow10) {
+      pow2 *= 2;
+      --e;
+    }
+  }
+
+  auto constexpr f = min - 1;
+  EXPECT_NE(teju_log2_pow10(f), e) << "Minimum " << min << " isn't sharp.";
+}
+
 TEST(log, teju_log10_pow2_residual) {
 
   auto constexpr min = std::int32_t{teju_log10_pow2_min};
@@ -107,4 +165,58 @@ TEST(log, teju_log10_pow2_residual) {
   }
 }
 
+/**
+ * @brief Gets the integer part of log_10(pow(2, e)) in double precision.
+ *
+ * For 0 < |e| < pow(2, 21), the distance from e * log_10(2) to the closest
+ * integer is larger than 1.5e-7 (the minimum is attained at e = 325147) which
+ * is much larger than the rounding error of e * log_10(2) in double precision.
+ * Hence, the integer part is exact.
+ */
+std::int32_t
+log10_pow2_reference(std::int32_t const e) {
+  return static_cast<std::int32_t>(std::floor(e * 0.30102999566398119521));
+}
+
+TEST(log, teju_log10_pow2_wide) {
+
+  auto constexpr min = std::int32_t{teju_log10_pow2_wide_min};
+  auto constexpr max = std::int32_t{teju_log10_pow2_wide_max};
+
+  // Sanity checks for the test itself.
+  ASSERT_LT(max, std::int32_t{1} << 21);
+  ASSERT_GT(min, -(std::int32_t{1} << 21));
+
+  for (std::int32_t e = min; e <= max; ++e)
+    ASSERT_EQ(teju_log10_pow2_wide(e), log10_pow2_reference(e)) <<
+      "Note e = " << e;
+
+  EXPECT_NE(teju_log10_pow2_wide(max + 1), log10_pow2_reference(max + 1)) <<
+    "Maximum " << max << " isn't sharp.";
+  EXPECT_NE(teju_log10_pow2_wide(min - 1), log10_pow2_reference(min - 1)) <<
+    "Minimum " << min << " isn't sharp.";
+}
+
+TEST(log, teju_log10_pow2_residual_wide) {
+
+  auto constexpr min = std::int32_t{teju_log10_pow2_wide_min};
+  auto constexpr max = std::int32_t{teju_log10_pow2_wide_max};
+
+  // Since r <= 3, e0 - 1 >= e - 4 is in the range of teju_log10_pow2_wide.
+  for (std::int32_t e = min + 4; e <= max; ++e) {
+
+    auto const f  = teju_log10_pow2_wide(e);
+    auto const r  = teju_log10_pow2_residual_wide(e);
+
+    // r = e - e0, where e0 is the smallest value such that
+    // teju_log10_pow2_wide(e0) = f.
+    auto const e0 = e - static_cast<std::int32_t>(r);
+    auto const f0 = teju_log10_pow2_wide(e0);
+    auto const f1 = teju_log10_pow2_wide(e0 - 1);
+
+    ASSERT_EQ(f0, f) << "Note: e = " << e << ", e0 = " << e0;
+    ASSERT_LT(f1, f) << "Note: e = " << e << ", e0 = " << e0;
+  }
+}
+
 } // namespace <anonymous>
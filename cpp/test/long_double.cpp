@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks Tejú Jaguá's results for long double (x86 extended) values against
+// those of std::to_chars which, in its shortest form, also yields a shortest
+// decimal representation of the value. However, std::to_chars (libstdc++ 12)
+// doesn't always pick the closest to the value among the shortest ones. It also
+// checks the implementation with a compressed table of multipliers.
+
+#if defined(teju_has_x86_extended)
+
+// Renaming teju_multiplier_t avoids ODR violations with other test files
+// which also include generated sources.
+#define teju_x86_extended_compressed teju_x86_extended_compressed_test
+#define teju_multiplier_t            teju_x86_extended_multiplier_t
+#include "teju/src/generated/x86_extended_compressed.c"
+
+#include "common/traits.hpp"
+#include "teju/chars.h"
+#include "teju/long_double.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <gtest/gtest.h>
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+
+namespace {
+
+using traits_t  = teju::traits_t<long double>;
+using binary_t  = traits_t::binary_t;
+using decimal_t = traits_t::decimal_t;
+using u1_t      = traits_t::u1_t;
+using rational_t = boost::multiprecision::cpp_rational;
+
+/**
+ * @brief Gets the decimal representation of a value from std::to_chars.
+ *
+ * @param  value            The value.
+ *
+ * @returns The decimal representation.
+ */
+decimal_t
+reference(long double const value) {
+
+  char chars[64];
+  auto const result = std::to_chars(chars, chars + sizeof(chars), value,
+    std::chars_format::scientific);
+  EXPECT_EQ(result.ec, std::errc{});
+
+  // Parses d[.ddd]e±xx.
+  u1_t         mantissa = 0u;
+  std::int32_t n_digits = 0;
+  char const*  ptr      = chars;
+  for (; *ptr != 'e'; ++ptr) {
+    if (*ptr != '.') {
+      mantissa = 10u * mantissa + u1_t(*ptr - '0');
+      ++n_digits;
+    }
+  }
+
+  // Skips 'e' and '+' which std::from_chars doesn't accept.
+  ptr += ptr[1] == '+' ? 2 : 1;
+  std::int32_t exponent = 0;
+  std::from_chars(ptr, result.ptr, exponent);
+  return {exponent - n_digits + 1, mantissa};
+}
+
+/**
+ * @brief Gets the exact value of m * pow(base, e).
+ *
+ * @param  m                The mantissa m.
+ * @param  base             The base.
+ * @param  e                The exponent e.
+ *
+ * @returns The exact value.
+ */
+rational_t
+to_rational(u1_t const m, unsigned const base, std::int32_t const e) {
+  using integer_t = boost::multiprecision::cpp_int;
+  // Boost's expression templates don't play well with auto.
+  integer_t const mantissa = m;
+  integer_t const power    = pow(integer_t{base}, unsigned(e < 0 ? -e : e));
+  return e < 0 ? rational_t{mantissa, power} : rational_t{mantissa * power};
+}
+
+/**
+ * @brief Gets the number of decimal digits of n.
+ *
+ * @param  n                The number n.
+ *
+ * @returns The number of decimal digits of n.
+ */
+unsigned
+digits_size(u1_t n) {
+  auto size = 1u;
+  while (n >= 10u) {
+    n /= 10u;
+    ++size;
+  }
+  return size;
+}
+
+/**
+ * @brief Checks Tejú Jaguá's result for a given value.
+ *
+ * Tejú Jaguá's result must match the reference or, otherwise, be as short as
+ * the reference, strictly closer to the value and read back as the value.
+ *
+ * @param  value            The given value.
+ */
+void
+compare_to_reference(long double const value) {
+
+  auto const expected = reference(value);
+  auto const actual   = traits_t::teju(value);
+
+  if (expected == actual)
+    return;
+
+  auto const binary = traits_t::to_binary(value);
+
+  ASSERT_EQ(digits_size(expected.mantissa), digits_size(actual.mantissa)) <<
+    "Value = " << binary;
+
+  rational_t const exact = to_rational(binary.mantissa, 2, binary.exponent);
+  rational_t const error = abs(to_rational(actual.mantissa, 10,
+    actual.exponent) - exact);
+  rational_t const other = abs(to_rational(expected.mantissa, 10,
+    expected.exponent) - exact);
+
+  ASSERT_LT(error, other) << "Value = " << binary;
+
+  char chars[teju_chars_max];
+  *teju128_to_chars(chars, actual) = '\0';
+  auto const back = std::strtold(chars, nullptr);
+
+  ASSERT_EQ(std::memcmp(&value, &back, 10), 0) << "Value = " << binary;
+}
+
+TEST(long_double, to_binary) {
+
+  using limits_t = std::numeric_limits<long double>;
+
+  auto constexpr integer_bit = teju_pow2(u1_t, 63u);
+
+  struct test_data_t {
+    long double value;
+    binary_t    binary;
+    int         line;
+  };
+
+  test_data_t const data[] = {
+    { 1.0L                  , { -63   , integer_bit       }, __LINE__ },
+    { 3.0L                  , { -62   , 3 * integer_bit/2 }, __LINE__ },
+    { limits_t::denorm_min(), { -16445, 1u                }, __LINE__ },
+    { limits_t::min()       , { -16445, integer_bit       }, __LINE__ },
+    { limits_t::max()       , {  16320, 2 * integer_bit-1 }, __LINE__ },
+  };
+
+  for (auto const& [value, binary, line] : data) {
+    EXPECT_EQ(traits_t::to_binary(value), binary) <<
+      "    Note: test case line = " << line;
+    EXPECT_EQ(traits_t::to_value(binary), value) <<
+      "    Note: test case line = " << line;
+  }
+}
+
+TEST(long_double, hard_coded_values) {
+
+  struct test_data_t {
+    long double value;
+    decimal_t   decimal;
+    int         line;
+  };
+
+  test_data_t const data[] = {
+    { 1.0L   , {  0,                    1 }, __LINE__ },
+    { 10.0L  , {  1,                    1 }, __LINE__ },
+    { 123.0L , {  0,                  123 }, __LINE__ },
+    { 0.5L   , { -1,                    5 }, __LINE__ },
+    { 0.1L   , { -1,                    1 }, __LINE__ },
+    { 0.3L   , { -1,                    3 }, __LINE__ },
+    { 1e4000L, {  4000,                 1 }, __LINE__ },
+  };
+
+  for (auto const& [value, decimal, line] : data)
+    EXPECT_EQ(traits_t::teju(value), decimal) <<
+      "    Note: test case line = " << line;
+}
+
+TEST(long_double, mantissa_min_all_exponents) {
+  auto constexpr mantissa = teju_pow2(u1_t, traits_t::mantissa_width - 1);
+  for (auto exponent = traits_t::exponent_min; !HasFailure() &&
+    exponent <= traits_t::exponent_max; ++exponent)
+    compare_to_reference(traits_t::to_value(binary_t{exponent, mantissa}));
+}
+
+TEST(long_double, integers) {
+  auto const max = 0x1p63L;
+  for (auto value = 1.0L; value < 1'000'000.0L && !HasFailure(); ++value)
+    compare_to_reference(value);
+  for (auto value = max - 1'000'000.0L; value < max && !HasFailure(); ++value)
+    compare_to_reference(value);
+}
+
+TEST(long_double, random_comparison_to_reference) {
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::int32_t>{
+    traits_t::exponent_min, traits_t::exponent_max};
+
+  for (auto i = 0; i < 1'000'000 && !HasFailure(); ++i) {
+
+    auto const exponent = distribution(device);
+    auto       mantissa = u1_t(device());
+
+    if (exponent != traits_t::exponent_min)
+      mantissa |= teju_pow2(u1_t, traits_t::mantissa_width - 1);
+    else if (mantissa == 0u)
+      continue;
+
+    compare_to_reference(traits_t::to_value(binary_t{exponent, mantissa}));
+  }
+}
+
+TEST(long_double, compressed) {
+
+  auto device = std::mt19937_64{};
+
+  auto test = [](std::int32_t const exponent, u1_t const mantissa) {
+    auto const binary   = teju128_fields_t{exponent, mantissa};
+    auto const expected = teju_x86_extended(binary);
+    auto const actual   = teju_x86_extended_compressed_test(binary);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "exponent = " <<
+      exponent;
+    ASSERT_TRUE(actual.mantissa == expected.mantissa) << "exponent = " <<
+      exponent;
+  };
+
+  auto constexpr integer_bit = teju_pow2(u1_t, traits_t::mantissa_width - 1);
+
+  for (auto exponent = traits_t::exponent_min; exponent <=
+    traits_t::exponent_max; ++exponent) {
+
+    test(exponent, integer_bit);
+    test(exponent, integer_bit + 1u);
+    test(exponent, 2u * integer_bit - 1u);
+
+    for (int i = 0; i < 3; ++i)
+      test(exponent, integer_bit | u1_t(device() >> 1u));
+  }
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_x86_extended)
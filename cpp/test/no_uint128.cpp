@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Builds the implementation for double used by platforms without __uint128_t
+// (e.g., 32-bit x86 and Arm), where teju_multiply is synthesised from 32-bits
+// products, and checks it against the one using __uint128_t.
+
+#if defined(teju_has_uint128)
+
+// Renaming teju_multiplier_t avoids ODR violations with other test files
+// which also include generated sources.
+#undef teju_has_uint128
+#define teju_ieee64_no_uint128 teju_ieee64_no_uint128_test
+#define teju_multiplier_t      teju_ieee64_multiplier_t
+
+#include "teju/src/generated/ieee64_no_uint128.c"
+#include "teju/src/generated/ieee64_with_uint128.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace {
+
+TEST(no_uint128, teju_multiply) {
+
+  auto test = [](std::uint64_t const a, std::uint64_t const b) {
+    auto const expected = __uint128_t{a} * b;
+    std::uint64_t upper;
+    std::uint64_t const lower = teju_multiply(a, b, &upper);
+    ASSERT_EQ(lower, std::uint64_t(expected)) << a << " * " << b;
+    ASSERT_EQ(upper, std::uint64_t(expected >> 64u)) << a << " * " << b;
+  };
+
+  auto constexpr max = std::uint64_t(-1);
+  test(0u, 0u);
+  test(max, max);
+  test(max, 1u);
+  test(max, 0xffffffff);
+  test(0xffffffff, 0xffffffff);
+
+  auto device = std::mt19937_64{};
+  for (int i = 0; i < 1'000'000; ++i)
+    test(device(), device());
+}
+
+TEST(no_uint128, double) {
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{1,
+    0x7fefffffffffffff};
+
+  for (int i = 0; i < 1'000'000; ++i) {
+
+    auto const bits     = distribution(device);
+    auto       mantissa = bits & 0xfffffffffffff;
+    auto const exponent = std::int32_t(bits >> 52u);
+
+    if (exponent != 0)
+      mantissa |= 0x10000000000000;
+
+    auto const binary   = teju64_fields_t{(exponent == 0 ? 0 : exponent - 1) -
+      1074, mantissa};
+    auto const expected = teju_ieee64_with_uint128(binary);
+    auto const actual   = teju_ieee64_no_uint128_test(binary);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "bits = " << bits;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "bits = " << bits;
+  }
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_uint128)
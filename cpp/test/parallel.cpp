@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+#include "teju/double.h"
+#include "teju/float.h"
+#include "teju/parallel.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Gets the decimal representation of a given value sequentially.
+ *
+ * @param  value            The given value.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju32_fields_t
+to_decimal(float const value) {
+  return teju_float_to_decimal(value);
+}
+
+/**
+ * @brief Gets the decimal representation of a given value sequentially.
+ *
+ * @param  value            The given value.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju64_fields_t
+to_decimal(double const value) {
+  return teju_double_to_decimal(value);
+}
+
+/**
+ * @brief Gets random finite and strictly positive values.
+ *
+ * @tparam TFloat           The floating-point number type.
+ *
+ * @param  n                The number of values.
+ *
+ * @returns The values.
+ */
+template <typename TFloat>
+std::vector<TFloat>
+get_values(std::size_t const n) {
+
+  using u1_t     = std::conditional_t<sizeof(TFloat) == 4, std::uint32_t,
+    std::uint64_t>;
+  using limits_t = std::numeric_limits<TFloat>;
+
+  auto to_bits = [](TFloat const value) {
+    u1_t bits{};
+    std::memcpy(&bits, &value, sizeof(value));
+    return bits;
+  };
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<u1_t>{
+    to_bits(limits_t::denorm_min()), to_bits(limits_t::max())};
+
+  auto values = std::vector<TFloat>(n);
+  for (auto& value : values) {
+    auto const bits = distribution(device);
+    std::memcpy(&value, &bits, sizeof(value));
+  }
+
+  return values;
+}
+
+/**
+ * @brief Checks that the parallel conversion matches the sequential one for
+ *        different numbers of values and threads.
+ *
+ * @tparam TFloat           The floating-point number type.
+ */
+template <typename TFloat>
+void
+test_parallel() {
+
+  using fields_t = decltype(to_decimal(TFloat{}));
+
+  // Numbers of values below, at and above chunk boundaries.
+  std::size_t const sizes[]   = { 0, 1, 4095, 4096, 8192, 100'003,
+    1'000'000 };
+  unsigned    const threads[] = { 0, 1, 2, 3, 8, 64 };
+
+  for (auto const n : sizes) {
+
+    auto const values = get_values<TFloat>(n);
+
+    auto expected = std::vector<fields_t>(n);
+    for (std::size_t i = 0; i < n; ++i)
+      expected[i] = to_decimal(values[i]);
+
+    for (auto const t : threads) {
+
+      auto actual = std::vector<fields_t>(n, fields_t{0, 0});
+      teju::to_decimal_parallel(values.data(), actual.data(), n, t);
+
+      for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(actual[i].exponent, expected[i].exponent) << "n = " << n <<
+          ", threads = " << t << ", i = " << i;
+        ASSERT_EQ(actual[i].mantissa, expected[i].mantissa) << "n = " << n <<
+          ", threads = " << t << ", i = " << i;
+      }
+    }
+  }
+}
+
+TEST(parallel, float) {
+  test_parallel<float>();
+}
+
+TEST(parallel, double) {
+  test_parallel<double>();
+}
+
+} // namespace <anonymous>
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// Checks the function for double specialised for a window of exponents against
+// the implementation with a single table.
+
+#if defined(teju_has_uint128)
+
+#include "teju/src/generated/ieee64_compressed.h"
+#include "teju/src/generated/ieee64_with_uint128.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace {
+
+TEST(range, double) {
+
+  auto device       = std::mt19937_64{};
+  auto distribution = std::uniform_int_distribution<std::uint64_t>{0,
+    0xfffffffffffff};
+
+  auto test = [](std::int32_t const exponent, std::uint64_t const mantissa) {
+    auto const binary   = teju64_fields_t{exponent, mantissa};
+    auto const expected = teju_ieee64_with_uint128(binary);
+    auto const actual   = teju_ieee64_compressed_range(binary);
+    ASSERT_EQ(actual.exponent, expected.exponent) << "exponent = " <<
+      exponent << ", mantissa = " << mantissa;
+    ASSERT_EQ(actual.mantissa, expected.mantissa) << "exponent = " <<
+      exponent << ", mantissa = " << mantissa;
+  };
+
+  // Every exponent, inside and outside the window, is tested with the
+  // uncentred, the smallest and largest centred and random mantissas.
+  for (std::int32_t exponent = -1074; exponent <= 971; ++exponent) {
+
+    auto constexpr integer_bit = std::uint64_t{1} << 52u;
+
+    test(exponent, integer_bit);
+    test(exponent, integer_bit + 1u);
+    test(exponent, 2u * integer_bit - 1u);
+
+    for (int i = 0; i < 100; ++i)
+      test(exponent, integer_bit | distribution(device));
+
+    // Small integers.
+    if (-52 <= exponent && exponent <= 0)
+      for (int i = 0; i < 100; ++i)
+        test(exponent, (integer_bit | distribution(device)) >> -exponent <<
+          -exponent);
+  }
+}
+
+} // namespace <anonymous>
+
+#endif // defined(teju_has_uint128)
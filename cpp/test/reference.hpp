@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file cpp/test/reference.hpp
+ *
+ * Brute-force calculation of shortest decimal representations used as reference
+ * for types without alternative implementations.
+ */
+
+#ifndef TEJU_CPP_TEST_REFERENCE_HPP
+#define TEJU_CPP_TEST_REFERENCE_HPP
+
+#include "teju/src/common.h"
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace teju {
+namespace test {
+
+using integer_t = boost::multiprecision::cpp_int;
+
+/**
+ * @brief Gets the shortest decimal representation of m * pow(2, e) by brute
+ *        force.
+ *
+ * The shortest representation is the one with the fewest digits among the
+ * decimals that round to m * pow(2, e). Ties are broken by picking the closest
+ * decimal and, if still tied, the one with even mantissa.
+ *
+ * Calculations are on integers multiples of pow(2, e - 2) / den, where den is
+ * the denominator of pow(10, f) in units of pow(2, e - 2), rather than on
+ * rationals whose normalisations are slow for large exponents (e.g., those of
+ * binary256).
+ *
+ * @param  e                The exponent e.
+ * @param  m                The mantissa m.
+ * @param  is_uncentred     Tells whether m * pow(2, e) is uncentred (i.e.,
+ *                          whether its lower neighbour is at pow(2, e - 2).)
+ *
+ * @pre 0 < m.
+ *
+ * @returns The decimal representation (exponent, mantissa).
+ */
+inline
+std::pair<std::int32_t, integer_t>
+reference(std::int32_t const e, integer_t const& m, bool const is_uncentred) {
+
+  // In units of pow(2, e - 2), the value is x and its rounding interval has
+  // bounds a and b.
+  auto const x         = integer_t{4 * m};
+  auto const a         = integer_t{x - (is_uncentred ? 1 : 2)};
+  auto const b         = integer_t{x + 2};
+  auto const is_closed = m % 2u == 0u;
+
+  // b * pow(2, e - 2) < pow(2, msb(b) + e - 1) <= pow(10, f).
+  auto f = teju_log10_pow2_wide(static_cast<std::int32_t>(
+    boost::multiprecision::msb(b)) + e - 1) + 1;
+
+  auto const pow5 = [](std::int32_t const k) {
+    return integer_t{boost::multiprecision::pow(integer_t{5},
+      static_cast<unsigned>(k))};
+  };
+
+  for (;; --f) {
+
+    // pow(10, f) == num / den in units of pow(2, e - 2).
+    auto const num = integer_t{(f >= 0 ? integer_t{pow5(f) << f} :
+      integer_t{1}) << (e <= 2 ? 2 - e : 0)};
+    auto const den = integer_t{(f <  0 ? integer_t{pow5(-f) << -f} :
+      integer_t{1}) << (e >  2 ? e - 2 : 0)};
+
+    auto const a_den = integer_t{a * den};
+    auto const b_den = integer_t{b * den};
+    auto const x_den = integer_t{x * den};
+
+    auto const is_inside = [&](integer_t const& y) {
+      return is_closed ? a_den <= y && y <= b_den : a_den < y && y < b_den;
+    };
+
+    auto best = integer_t{0};
+
+    auto const c_min = integer_t{(a_den + num - 1) / num};
+    auto const c_max = integer_t{b_den / num};
+
+    for (auto c = c_min; c <= c_max; ++c) {
+      if (c == 0 || !is_inside(integer_t{c * num}))
+        continue;
+      if (best == 0)
+        best = c;
+      else {
+        auto const d_c    = integer_t{abs(c * num - x_den)};
+        auto const d_best = integer_t{abs(best * num - x_den)};
+        if (d_c < d_best || (d_c == d_best && c % 2 == 0))
+          best = c;
+      }
+    }
+
+    if (best != 0) {
+      while (best % 10 == 0) {
+        best /= 10;
+        ++f;
+      }
+      return std::make_pair(f, best);
+    }
+  }
+}
+
+} // namespace test
+} // namespace teju
+
+#endif // TEJU_CPP_TEST_REFERENCE_HPP
@@ -0,0 +1,87 @@
+#!/bin/bash
+# SPDX-License-Identifier: APACHE-2.0
+# SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+# Builds the benchmark with profile-guided optimisation and compares Tejú
+# Jaguá's timings against those of the plain release build.
+#
+# Usage:
+#
+#     $ ./pgo.sh [COMPILER [BUILDER [CPU]]]
+#
+# where COMPILER is gcc (default) or clang, BUILDER is make (default) or ninja
+# and CPU, if given, is the CPU that the benchmark is pinned to. (See
+# cpp/benchmark/main.cpp.)
+#
+# The training runs the simple, centred, uncentred and integers benchmarks on
+# the instrumented build. Logs of the benchmark runs are saved in
+# build/<COMPILER>.pgo.<BUILDER>/{training,release,pgo}.log.
+
+set -ex
+
+compiler=${1:-gcc}
+builder=${2:-make}
+cpu=${3:-}
+
+workloads="*.simple:*.centred:*.uncentred:*.integers"
+pgo_dir=build/${compiler}.pgo.${builder}
+release_dir=build/${compiler}.release.${builder}
+
+# Runs the benchmark workloads.
+#
+# $1                        The build directory.
+# $2                        The log file.
+run() {
+  mkdir -p "$1/results"
+  ( cd "$1/results" && ../bin/benchmark --gtest_filter="${workloads}" ${cpu} ) |
+    tee "$2"
+}
+
+# Prints the mean time (in ns) taken by Tejú Jaguá in each benchmark of a log.
+#
+# $1                        The log file.
+summarise() {
+  awk '
+    /^\[ RUN      \]/   { test = $4 }
+    /^teju +\(mean  \)/ { print test, $5 }
+    /`teju`/            { split($0, f, "|"); gsub(/[ ,]/, "", f[3]);
+                          print test, f[3] }
+  ' "$1"
+}
+
+# Instrumented build and training.
+rm -rf "${pgo_dir}/pgo"
+cmake --preset "${compiler}.pgo-generate.${builder}"
+cmake --build "${pgo_dir}" --target benchmark
+run "${pgo_dir}" "${pgo_dir}/training.log"
+
+if [[ ${compiler} == clang ]]; then
+  llvm-profdata merge -output="${pgo_dir}/pgo/teju.profdata" \
+    "${pgo_dir}"/pgo/*.profraw
+fi
+
+# Profile-guided build.
+cmake --preset "${compiler}.pgo-use.${builder}"
+cmake --build "${pgo_dir}" --target benchmark
+run "${pgo_dir}" "${pgo_dir}/pgo.log"
+
+# Plain release build.
+cmake --preset "${compiler}.release.${builder}"
+cmake --build "${release_dir}" --target benchmark
+run "${release_dir}" "${pgo_dir}/release.log"
+
+set +x
+
+awk '
+  NR == FNR { release[$1] = $2; tests[++n] = $1; next }
+            { pgo[$1] = $2 }
+  END {
+    printf "\n%-20s %12s %12s %8s\n", "benchmark", "release (ns)", "pgo (ns)",
+      "pgo/rel."
+    for (i = 1; i <= n; ++i) {
+      test = tests[i]
+      printf "%-20s %12.3f %12.3f %8.3f\n", test, release[test], pgo[test],
+        pgo[test] / release[test]
+    }
+  }
+' <(summarise "${pgo_dir}/release.log") <(summarise "${pgo_dir}/pgo.log")
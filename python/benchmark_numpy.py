@@ -0,0 +1,80 @@
+# SPDX-License-Identifier: APACHE-2.0
+# SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+"""
+Benchmarks the teju extension module against numpy.savetxt and a plain repr
+loop when formatting arrays of random floating-point numbers.
+
+The module is built by configuring CMake with -Dteju_build_python=ON. Run with
+
+    $ PYTHONPATH=build/<preset-name>/python python python/benchmark_numpy.py
+"""
+
+import argparse
+import os
+import tempfile
+import timeit
+
+import numpy
+import teju
+
+def random_values(dtype, n, seed):
+    """Returns n random finite values of the given dtype."""
+    bits_dtype = { 'float16': numpy.uint16, 'float32': numpy.uint32,
+        'float64': numpy.uint64 }[dtype]
+    rng    = numpy.random.default_rng(seed)
+    bits   = rng.integers(0, numpy.iinfo(bits_dtype).max, size = 2 * n,
+        dtype = bits_dtype, endpoint = True)
+    values = bits.view(dtype)
+    return values[numpy.isfinite(values)][:n]
+
+def best(function, repeat):
+    """Returns the best time in seconds of repeat calls to function."""
+    return min(timeit.repeat(function, number = 1, repeat = repeat))
+
+def main():
+
+    parser = argparse.ArgumentParser(description = __doc__,
+        formatter_class = argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-n', type = int, default = 1_000_000,
+        help = 'number of values (default: %(default)s)')
+    parser.add_argument('-r', '--repeat', type = int, default = 5,
+        help = 'number of repetitions (default: %(default)s)')
+    parser.add_argument('--dtype', nargs = '+',
+        default = ['float16', 'float32', 'float64'],
+        help = 'dtypes to benchmark (default: %(default)s)')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+
+        filename = os.path.join(directory, 'values.txt')
+
+        for dtype in args.dtype:
+
+            values = random_values(dtype, args.n, seed = 0)
+
+            # Sanity check: teju's output must round trip.
+            strings = teju.format(values).split('\n')
+            parsed  = numpy.array(strings, dtype = numpy.float64).astype(dtype)
+            assert numpy.array_equal(parsed, values), 'round trip failed'
+
+            candidates = {
+                'teju.format'   : lambda: teju.format(values),
+                'teju.savetxt'  : lambda: teju.savetxt(filename, values),
+                'numpy.savetxt' : lambda: numpy.savetxt(filename, values),
+                'repr loop'     : lambda: '\n'.join(map(repr, values.tolist())),
+            }
+
+            times    = { name : best(function, args.repeat)
+                for name, function in candidates.items() }
+            baseline = times['teju.format']
+
+            print(f'{dtype} ({len(values):,} values)')
+            for name, time in times.items():
+                print(f'  {name:<14} {time * 1e3:10.3f} ms '
+                    f'{time / len(values) * 1e9:8.1f} ns/value '
+                    f'{time / baseline:8.2f}x')
+            print()
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,376 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file python/tejumodule.c
+ *
+ * CPython extension module formatting NumPy arrays of float16, float32 and
+ * float64 values in their shortest decimal representations.
+ *
+ * Values are written in the format of teju/chars.h with the GIL released.
+ *
+ *     >>> import numpy, teju
+ *     >>> teju.format(numpy.array([1.0, 0.1, -2.5e-300]))
+ *     '1\n1e-1\n-2.5e-300'
+ *     >>> teju.savetxt('values.txt', numpy.array([1.0, 0.1, -2.5e-300]))
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#define NPY_NO_DEPRECATED_API NPY_1_7_API_VERSION
+#include <numpy/arrayobject.h>
+
+#include "teju/chars.h"
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+//------------------------------------------------------------------------------
+// Helper functions.
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Writes a single value to chars.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  value            Pointer to the value.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+typedef char* (*to_chars_t)(char* chars, char const* value);
+
+#if defined(teju_has_float16)
+
+static
+char*
+float16_to_chars(char* const chars, char const* const value) {
+  float16_t x;
+  memcpy(&x, value, sizeof(x));
+  return teju_float16_to_chars(chars, x);
+}
+
+#endif // defined(teju_has_float16)
+
+static
+char*
+float_to_chars(char* const chars, char const* const value) {
+  float x;
+  memcpy(&x, value, sizeof(x));
+  return teju_float_to_chars(chars, x);
+}
+
+static
+char*
+double_to_chars(char* const chars, char const* const value) {
+  double x;
+  memcpy(&x, value, sizeof(x));
+  return teju_double_to_chars(chars, x);
+}
+
+/**
+ * @brief Details on how to convert the elements of an array.
+ */
+typedef struct {
+  to_chars_t to_chars;  // Converts a single element.
+  size_t     item_size; // The size of an element.
+  size_t     max_size;  // The maximum number of chars written per element.
+} converter_t;
+
+/**
+ * @brief Gets a C-contiguous, aligned and native-endian array with the
+ *        elements of a given object and the converter for its elements.
+ *
+ * @param  obj              The given object.
+ * @param  converter        On success, receives the converter.
+ *
+ * @returns A new reference to the array on success and NULL (with an exception
+ *          set) otherwise.
+ */
+static
+PyArrayObject*
+get_array(PyObject* const obj, converter_t* const converter) {
+
+  PyArrayObject* const array = (PyArrayObject*) PyArray_FROM_OF(obj,
+    NPY_ARRAY_IN_ARRAY | NPY_ARRAY_NOTSWAPPED);
+
+  if (array == NULL)
+    return NULL;
+
+  // Maximum sizes are for values like "-1.0009e-5", "-1.00000005e-38" and
+  // "-1.0000000000000002e-308".
+  switch (PyArray_TYPE(array)) {
+
+    #if defined(teju_has_float16)
+    case NPY_HALF:
+      converter->to_chars  = float16_to_chars;
+      converter->item_size = 2u;
+      converter->max_size  = 10u;
+      return array;
+    #endif
+
+    case NPY_FLOAT:
+      converter->to_chars  = float_to_chars;
+      converter->item_size = 4u;
+      converter->max_size  = 15u;
+      return array;
+
+    case NPY_DOUBLE:
+      converter->to_chars  = double_to_chars;
+      converter->item_size = 8u;
+      converter->max_size  = 24u;
+      return array;
+  }
+
+  Py_DECREF(array);
+  PyErr_SetString(PyExc_TypeError, "Unsupported dtype. (Supported dtypes are "
+    #if defined(teju_has_float16)
+      "float16, "
+    #endif
+    "float32 and float64.)");
+  return NULL;
+}
+
+/**
+ * @brief Writes the elements of an array to chars, each followed by a
+ *        separator except, optionally, the last one.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  values           Pointer to the first element.
+ * @param  n                The number of elements.
+ * @param  converter        The converter for the elements.
+ * @param  sep              The separator.
+ * @param  sep_size         The size of the separator.
+ * @param  last_sep         Whether the separator is written after the last
+ *                          element.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+static
+char*
+values_to_chars(char* chars, char const* values, size_t const n,
+  converter_t const* const converter, char const* const sep,
+  size_t const sep_size, bool const last_sep) {
+
+  for (size_t i = 0; i < n; ++i) {
+    chars   = converter->to_chars(chars, values);
+    values += converter->item_size;
+    if (last_sep || i + 1 < n) {
+      memcpy(chars, sep, sep_size);
+      chars += sep_size;
+    }
+  }
+
+  return chars;
+}
+
+/**
+ * @brief Checks whether a given separator is made of ASCII chars only.
+ *
+ * @param  sep              The given separator.
+ * @param  sep_size         The size of the separator.
+ *
+ * @returns true if the separator is ASCII and false (with an exception set)
+ *          otherwise.
+ */
+static
+bool
+check_sep(char const* const sep, Py_ssize_t const sep_size) {
+  for (Py_ssize_t i = 0; i < sep_size; ++i) {
+    if ((unsigned char) sep[i] >= 128u) {
+      PyErr_SetString(PyExc_ValueError, "Separator must be ASCII.");
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Module functions.
+//------------------------------------------------------------------------------
+
+PyDoc_STRVAR(format_doc,
+  "format(a, sep='\\n')\n"
+  "--\n"
+  "\n"
+  "Returns a str with the shortest representations of the elements of a\n"
+  "float16, float32 or float64 array (in C order) separated by sep.");
+
+static
+PyObject*
+teju_format(PyObject* const self, PyObject* const args,
+  PyObject* const kwargs) {
+
+  (void) self;
+
+  static char* keywords[] = { (char*) "a", (char*) "sep", NULL };
+
+  PyObject*   obj;
+  char const* sep      = "\n";
+  Py_ssize_t  sep_size = 1;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|s#:format", keywords,
+    &obj, &sep, &sep_size) || !check_sep(sep, sep_size))
+    return NULL;
+
+  converter_t converter;
+  PyArrayObject* const array = get_array(obj, &converter);
+  if (array == NULL)
+    return NULL;
+
+  size_t const n         = (size_t) PyArray_SIZE(array);
+  size_t const item_size = converter.max_size + (size_t) sep_size;
+
+  if (n > (size_t) PY_SSIZE_T_MAX / item_size) {
+    Py_DECREF(array);
+    return PyErr_NoMemory();
+  }
+
+  // The str is allocated with an upper bound on its size and shrunk at the end.
+  PyObject* str = PyUnicode_New((Py_ssize_t) (n * item_size), 127);
+  if (str == NULL) {
+    Py_DECREF(array);
+    return NULL;
+  }
+
+  char* const begin = (char*) PyUnicode_1BYTE_DATA(str);
+  char*       end;
+
+  Py_BEGIN_ALLOW_THREADS
+  end = values_to_chars(begin, (char const*) PyArray_DATA(array), n,
+    &converter, sep, (size_t) sep_size, false);
+  Py_END_ALLOW_THREADS
+
+  Py_DECREF(array);
+
+  if (PyUnicode_Resize(&str, end - begin) != 0)
+    return NULL;
+
+  return str;
+}
+
+PyDoc_STRVAR(savetxt_doc,
+  "savetxt(fname, a, sep='\\n')\n"
+  "--\n"
+  "\n"
+  "Writes to the file fname the shortest representations of the elements of\n"
+  "a float16, float32 or float64 array (in C order) each followed by sep.");
+
+static
+PyObject*
+teju_savetxt(PyObject* const self, PyObject* const args,
+  PyObject* const kwargs) {
+
+  (void) self;
+
+  static char* keywords[] = { (char*) "fname", (char*) "a", (char*) "sep",
+    NULL };
+
+  PyObject*   fname;
+  PyObject*   obj;
+  char const* sep      = "\n";
+  Py_ssize_t  sep_size = 1;
+
+  if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O&O|s#:savetxt", keywords,
+    PyUnicode_FSConverter, &fname, &obj, &sep, &sep_size))
+    return NULL;
+
+  if (!check_sep(sep, sep_size)) {
+    Py_DECREF(fname);
+    return NULL;
+  }
+
+  converter_t converter;
+  PyArrayObject* const array = get_array(obj, &converter);
+  if (array == NULL) {
+    Py_DECREF(fname);
+    return NULL;
+  }
+
+  // Values are written in blocks to bound the memory usage.
+  size_t const block_size = 1u << 16;
+  size_t const item_size  = converter.max_size + (size_t) sep_size;
+
+  char* const buffer = (char*) PyMem_RawMalloc(block_size * item_size);
+  if (buffer == NULL) {
+    Py_DECREF(array);
+    Py_DECREF(fname);
+    return PyErr_NoMemory();
+  }
+
+  char const* values  = (char const*) PyArray_DATA(array);
+  size_t      n       = (size_t) PyArray_SIZE(array);
+  int         error   = 0;
+
+  Py_BEGIN_ALLOW_THREADS
+
+  FILE* const file = fopen(PyBytes_AS_STRING(fname), "wb");
+
+  if (file == NULL)
+    error = errno;
+
+  else {
+
+    while (n != 0 && error == 0) {
+      size_t const m    = n < block_size ? n : block_size;
+      char* const  end  = values_to_chars(buffer, values, m, &converter, sep,
+        (size_t) sep_size, true);
+      size_t const size = (size_t) (end - buffer);
+      if (fwrite(buffer, 1u, size, file) != size)
+        error = errno != 0 ? errno : EIO;
+      values += m * converter.item_size;
+      n      -= m;
+    }
+
+    if (fclose(file) != 0 && error == 0)
+      error = errno != 0 ? errno : EIO;
+  }
+
+  Py_END_ALLOW_THREADS
+
+  PyMem_RawFree(buffer);
+  Py_DECREF(array);
+
+  if (error != 0) {
+    errno = error;
+    PyErr_SetFromErrnoWithFilename(PyExc_OSError, PyBytes_AS_STRING(fname));
+    Py_DECREF(fname);
+    return NULL;
+  }
+
+  Py_DECREF(fname);
+  Py_RETURN_NONE;
+}
+
+//------------------------------------------------------------------------------
+// Module definition.
+//------------------------------------------------------------------------------
+
+static PyMethodDef methods[] = {
+  { "format" , (PyCFunction)(void(*)(void)) teju_format,
+    METH_VARARGS | METH_KEYWORDS, format_doc  },
+  { "savetxt", (PyCFunction)(void(*)(void)) teju_savetxt,
+    METH_VARARGS | METH_KEYWORDS, savetxt_doc },
+  { NULL, NULL, 0, NULL }
+};
+
+static struct PyModuleDef module = {
+  PyModuleDef_HEAD_INIT,
+  "teju",
+  "Tejú Jaguá: shortest decimal representations of NumPy arrays.",
+  -1,
+  methods,
+  NULL,
+  NULL,
+  NULL,
+  NULL
+};
+
+PyMODINIT_FUNC
+PyInit_teju(void) {
+  import_array();
+  return PyModule_Create(&module);
+}
@@ -0,0 +1,106 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/bfloat16.h
+ *
+ * Tejú Jaguá and helpers for bfloat16 values.
+ *
+ * There's no portable bfloat16 type in C and, for this reason, values are given
+ * by their bit patterns stored in uint16_t objects.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_BFLOAT16_H_
+#define TEJU_TEJU_INCLUDE_TEJU_BFLOAT16_H_
+
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include "teju/src/generated/bfloat16.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the binary representation of a given value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7f80.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_bfloat16_to_binary(uint16_t bits) {
+
+  assert(0 < bits && bits < 0x7f80 && "Invalid bfloat16 value.");
+
+  typedef teju16_fields_t teju_fields_t;
+  typedef teju16_u1_t     teju_u1_t;
+
+  uint32_t const mantissa_width =    8u;
+  int32_t  const exponent_min   = -133;
+
+  teju_u1_t mantissa = teju_lsb(teju_u1_t, bits, mantissa_width - 1u);
+  bits >>= (mantissa_width - 1u);
+
+  int32_t exponent = (int32_t) bits;
+
+  if (exponent != 0) {
+    exponent -= 1;
+    mantissa |= teju_pow2(teju_u1_t, mantissa_width - 1u);
+  }
+
+  exponent += exponent_min;
+  teju_fields_t binary = {exponent, mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7f80.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_bfloat16_to_decimal(uint16_t const bits) {
+  teju16_fields_t binary = teju_bfloat16_to_binary(bits);
+  return teju_bfloat16(binary);
+}
+
+/**
+ * @brief Gets the decimal representations of the absolute values of an array
+ *        of bfloat16 values.
+ *
+ * The conversion is vectorised when AVX2 is available.
+ *
+ * @param  bits             The bit patterns of the values.
+ * @param  decimals         The output array of decimal representations.
+ * @param  n                The number of values.
+ *
+ * @pre bits and decimals point to arrays of n elements.
+ *
+ * @post decimals[i] is {0, 0} when bits[i] encodes zero, infinity or NaN.
+ */
+teju_export
+void
+teju_bfloat16_to_decimal_batch(uint16_t const* bits, teju16_fields_t* decimals,
+  size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_BFLOAT16_H_
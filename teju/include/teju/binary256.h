@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/binary256.h
+ *
+ * Tejú Jaguá and helpers for IEEE-754 binary256 (octuple precision) values.
+ *
+ * There's no built-in binary256 type in C and, for this reason, values are
+ * given by their bit patterns stored in uint256_t objects (e.g., copied with
+ * memcpy from the software floating-point type). This requires
+ * unsigned _BitInt(256) and, therefore, C23.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_BINARY256_H_
+#define TEJU_TEJU_INCLUDE_TEJU_BINARY256_H_
+
+#if defined(teju_has_uint256)
+
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include "teju/src/generated/ieee256.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the binary representation of a given binary256 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7ffff << 236.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline
+teju256_fields_t
+teju_binary256_to_binary(uint256_t bits) {
+
+  typedef teju256_fields_t teju_fields_t;
+  typedef teju256_u1_t     teju_u1_t;
+
+  uint32_t const mantissa_width =     237u;
+  int32_t  const exponent_min   = -262378;
+
+  assert(0 < bits && bits < (teju_u1_t) 0x7ffffu << (mantissa_width - 1u) &&
+    "Invalid binary256 value.");
+
+  teju_u1_t mantissa = teju_lsb(teju_u1_t, bits, mantissa_width - 1u);
+  bits >>= (mantissa_width - 1u);
+
+  int32_t exponent = (int32_t) bits;
+
+  if (exponent != 0) {
+    exponent -= 1;
+    mantissa |= teju_pow2(teju_u1_t, mantissa_width - 1u);
+  }
+
+  exponent += exponent_min;
+  teju_fields_t binary = {exponent, mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given binary256 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7ffff << 236.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline
+teju256_fields_t
+teju_binary256_to_decimal(uint256_t const bits) {
+  teju256_fields_t binary = teju_binary256_to_binary(bits);
+  return teju_ieee256(binary);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // defined(teju_has_uint256)
+#endif // TEJU_TEJU_INCLUDE_TEJU_BINARY256_H_
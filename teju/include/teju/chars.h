@@ -0,0 +1,188 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/chars.h
+ *
+ * Conversion of decimal representations and floating-point values to chars.
+ *
+ * Decimal representations m * pow(10, f) are written in scientific notation
+ * where the mantissa has a single digit before the decimal point. The exponent
+ * part is omitted when it's zero. No null terminator is written. For instance:
+ *
+ *     { f = 0, m = 1 }     -> "1"
+ *     { f = -1, m = 15 }   -> "1.5"
+ *     { f = 9, m = 15 }    -> "1.5e10"
+ *     { f = -3, m = 1 }    -> "1e-3"
+ *
+ * Functions taking floating-point values also handle negative values, zero,
+ * infinities and NaNs, which are written as "-", "0", "inf" and "nan".
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_CHARS_H_
+#define TEJU_TEJU_INCLUDE_TEJU_CHARS_H_
+
+#include "teju/src/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The maximum number of chars written by any function in this file.
+ */
+#define teju_chars_max 48u
+
+//------------------------------------------------------------------------------
+// Decimal representations
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Gets the number of chars needed to write a decimal representation.
+ *
+ * @param  decimal          The decimal representation.
+ *
+ * @pre decimal.mantissa > 0.
+ *
+ * @returns The number of chars.
+ */
+teju_export
+size_t
+teju16_chars_size(teju16_fields_t decimal);
+
+/**
+ * @brief Writes a decimal representation to chars.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  decimal          The decimal representation.
+ *
+ * @pre decimal.mantissa > 0 and the buffer has room for
+ *      teju16_chars_size(decimal) chars.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+teju_export
+char*
+teju16_to_chars(char* chars, teju16_fields_t decimal);
+
+/**
+ * @brief Same as teju16_chars_size but for teju32_fields_t.
+ */
+teju_export
+size_t
+teju32_chars_size(teju32_fields_t decimal);
+
+/**
+ * @brief Same as teju16_to_chars but for teju32_fields_t.
+ */
+teju_export
+char*
+teju32_to_chars(char* chars, teju32_fields_t decimal);
+
+/**
+ * @brief Same as teju16_chars_size but for teju64_fields_t.
+ */
+teju_export
+size_t
+teju64_chars_size(teju64_fields_t decimal);
+
+/**
+ * @brief Same as teju16_to_chars but for teju64_fields_t.
+ */
+teju_export
+char*
+teju64_to_chars(char* chars, teju64_fields_t decimal);
+
+#if defined(teju_has_uint128)
+
+/**
+ * @brief Same as teju16_chars_size but for teju128_fields_t.
+ */
+teju_export
+size_t
+teju128_chars_size(teju128_fields_t decimal);
+
+/**
+ * @brief Same as teju16_to_chars but for teju128_fields_t.
+ */
+teju_export
+char*
+teju128_to_chars(char* chars, teju128_fields_t decimal);
+
+#endif // defined(teju_has_uint128)
+
+//------------------------------------------------------------------------------
+// Floating-point values
+//------------------------------------------------------------------------------
+
+#if defined(teju_has_float16)
+
+/**
+ * @brief Writes the shortest representation of a given value to chars.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  value            The given value.
+ *
+ * @pre The buffer has room for teju_chars_max chars.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+teju_export
+char*
+teju_float16_to_chars(char* chars, float16_t value);
+
+#endif // defined(teju_has_float16)
+
+/**
+ * @brief Same as teju_float16_to_chars but for bfloat16 values given by their
+ *        bit patterns.
+ */
+teju_export
+char*
+teju_bfloat16_to_chars(char* chars, uint16_t bits);
+
+/**
+ * @brief Same as teju_float16_to_chars but for float values.
+ */
+teju_export
+char*
+teju_float_to_chars(char* chars, float value);
+
+/**
+ * @brief Same as teju_float16_to_chars but for double values.
+ */
+teju_export
+char*
+teju_double_to_chars(char* chars, double value);
+
+#if defined(teju_has_float128)
+
+/**
+ * @brief Same as teju_float16_to_chars but for float128_t values.
+ */
+teju_export
+char*
+teju_float128_to_chars(char* chars, float128_t value);
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+/**
+ * @brief Same as teju_float16_to_chars but for long double values in the x86
+ *        80-bit extended format.
+ */
+teju_export
+char*
+teju_long_double_to_chars(char* chars, long double value);
+
+#endif // defined(teju_has_x86_extended)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_CHARS_H_
@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/columnar.h
+ *
+ * Conversion of columns of floating-point values to Arrow-style string arrays,
+ * that is, an int32_t offsets buffer plus a contiguous data buffer where the
+ * i-th string is data[offsets[i], offsets[i + 1]).
+ *
+ * The conversion is done in two passes. The first one computes the offsets
+ * and, hence, the exact size of the data buffer which the caller allocates
+ * before the second pass writes the strings. Values are written in the format
+ * of teju/chars.h without any per-value allocation or copy.
+ *
+ * Optionally, the first pass stores the decimal representations it computes
+ * into a caller provided buffer that the second pass reuses to avoid running
+ * Tejú Jaguá twice. This trades n * sizeof(decimal) bytes of memory traffic
+ * for computation.
+ *
+ * Validity bitmaps, when given, follow Arrow's layout: the i-th value is valid
+ * if bit (i % 8) of validity[i / 8] is set. Null values get empty strings.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_COLUMNAR_H_
+#define TEJU_TEJU_INCLUDE_TEJU_COLUMNAR_H_
+
+#include "teju/src/config.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the offsets of the strings representing given values.
+ *
+ * @param  values           The given values.
+ * @param  validity         The validity bitmap or NULL if all values are valid.
+ * @param  n                The number of values.
+ * @param  offsets          The offsets buffer. On entry, offsets[0] holds the
+ *                          offset of the first string and, on successful exit,
+ *                          offsets[1], ..., offsets[n] are set.
+ * @param  decimals         Buffer to receive the decimal representations or
+ *                          NULL.
+ *
+ * @pre offsets has room for n + 1 elements and offsets[0] >= 0.
+ * @pre decimals is NULL or has room for n elements.
+ *
+ * @returns true on success and false if an offset would exceed INT32_MAX.
+ */
+teju_export
+bool
+teju_double_column_offsets(double const* values, uint8_t const* validity,
+  size_t n, int32_t* offsets, teju64_fields_t* decimals);
+
+/**
+ * @brief Writes the strings representing given values.
+ *
+ * @param  values           The given values.
+ * @param  validity         The validity bitmap or NULL if all values are valid.
+ * @param  n                The number of values.
+ * @param  offsets          The offsets computed by teju_double_column_offsets.
+ * @param  decimals         The decimal representations computed by
+ *                          teju_double_column_offsets or NULL.
+ * @param  data             The data buffer.
+ *
+ * @pre data has room for offsets[n] chars.
+ */
+teju_export
+void
+teju_double_column_to_chars(double const* values, uint8_t const* validity,
+  size_t n, int32_t const* offsets, teju64_fields_t const* decimals,
+  char* data);
+
+/**
+ * @brief Same as teju_double_column_offsets but for float values.
+ */
+teju_export
+bool
+teju_float_column_offsets(float const* values, uint8_t const* validity,
+  size_t n, int32_t* offsets, teju32_fields_t* decimals);
+
+/**
+ * @brief Same as teju_double_column_to_chars but for float values.
+ */
+teju_export
+void
+teju_float_column_to_chars(float const* values, uint8_t const* validity,
+  size_t n, int32_t const* offsets, teju32_fields_t const* decimals,
+  char* data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_COLUMNAR_H_
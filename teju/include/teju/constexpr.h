@@ -0,0 +1,231 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/constexpr.h
+ *
+ * Conversions of float and double values that can be evaluated in C++ constant
+ * expressions.
+ *
+ * The functions in this file are available in the amalgamation teju_all.h only
+ * and when teju_has_constexpr is defined (see teju/src/config.h), that is, when
+ * it is compiled as C++20 by gcc or clang. For instance:
+ *
+ *     constexpr auto pi = [] {
+ *       auto chars = std::array<char, teju::chars_max + 1u>{};
+ *       teju::to_chars(chars.data(), 3.14159);
+ *       return chars;
+ *     }();
+ *
+ * initialises pi with the null-terminated string "3.14159" with no runtime
+ * cost. Decimal representations and special values are written as by
+ * teju_double_to_chars (see teju/chars.h).
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_CONSTEXPR_H_
+#define TEJU_TEJU_INCLUDE_TEJU_CONSTEXPR_H_
+
+#include "teju/double.h"
+#include "teju/float.h"
+#include "teju/src/config.h"
+
+#include <stdint.h>
+
+#if defined(__cplusplus) && defined(teju_has_constexpr)
+
+namespace teju {
+
+/**
+ * @brief The maximum number of chars written by to_chars. (This is
+ *        teju_chars_max in teju/chars.h.)
+ */
+inline constexpr uint32_t chars_max = 48u;
+
+/**
+ * @brief Same as teju_float_to_decimal.
+ */
+constexpr
+teju32_fields_t
+to_decimal(float const value) {
+  return teju_float_to_decimal(value);
+}
+
+/**
+ * @brief Same as teju_double_to_decimal.
+ */
+constexpr
+teju64_fields_t
+to_decimal(double const value) {
+  return teju_double_to_decimal(value);
+}
+
+namespace detail {
+
+/**
+ * @brief Gets the number of decimal digits of n.
+ *
+ * @param  n                The number n.
+ *
+ * @returns The number of decimal digits of n.
+ */
+constexpr
+uint32_t
+digits_size(uint64_t n) {
+  uint32_t size = 1u;
+  while (n >= 10u) {
+    n /= 10u;
+    ++size;
+  }
+  return size;
+}
+
+/**
+ * @brief Writes the decimal digits of n backwards, that is, the last digit is
+ *        written to last[-1], the one before to last[-2], etc.
+ *
+ * @param  last             Pointer to one-past-the-end of the digits.
+ * @param  n                The number n.
+ */
+constexpr
+void
+digits_to_chars(char* last, uint64_t n) {
+  do {
+    *--last = static_cast<char>('0' + n % 10u);
+    n /= 10u;
+  } while (n != 0u);
+}
+
+/**
+ * @brief Writes a decimal representation in scientific notation.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  exponent         The decimal exponent.
+ * @param  mantissa         The decimal mantissa.
+ *
+ * @pre mantissa > 0.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+constexpr
+char*
+decimal_to_chars(char* chars, int32_t const exponent,
+  uint64_t const mantissa) {
+
+  // The digits are written to chars[1], ..., chars[n] and, then, the first is
+  // moved to chars[0] to make room for the decimal point.
+  uint32_t const n = digits_size(mantissa);
+  digits_to_chars(chars + 1u + n, mantissa);
+
+  chars[0] = chars[1];
+  if (n > 1u) {
+    chars[1] = '.';
+    chars   += n + 1u;
+  }
+  else
+    chars += 1;
+
+  int32_t const e = exponent + static_cast<int32_t>(n) - 1;
+  if (e == 0)
+    return chars;
+
+  *chars++ = 'e';
+  if (e < 0)
+    *chars++ = '-';
+
+  uint32_t const abs_e = e < 0 ? 0u - static_cast<uint32_t>(e) :
+    static_cast<uint32_t>(e);
+  chars += digits_size(abs_e);
+  digits_to_chars(chars, abs_e);
+  return chars;
+}
+
+/**
+ * @brief Writes a given value to chars.
+ *
+ * @tparam TFloat           The floating-point number type.
+ * @tparam TU1              The unsigned integer type of the same size.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  value            The given value.
+ * @param  exponent_mask    The mask of the bits of the biased exponent.
+ * @param  mantissa_mask    The mask of the bits of the mantissa.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+template <typename TFloat, typename TU1>
+constexpr
+char*
+value_to_chars(char* chars, TFloat const value, TU1 const exponent_mask,
+  TU1 const mantissa_mask) {
+
+  TU1 const sign_mask = ~(exponent_mask | mantissa_mask);
+  TU1 const bits      = __builtin_bit_cast(TU1, value);
+
+  if ((bits & exponent_mask) == exponent_mask && (bits & mantissa_mask) != 0u) {
+    *chars++ = 'n';
+    *chars++ = 'a';
+    *chars++ = 'n';
+    return chars;
+  }
+
+  if ((bits & sign_mask) != 0u)
+    *chars++ = '-';
+
+  if ((bits & exponent_mask) == exponent_mask) {
+    *chars++ = 'i';
+    *chars++ = 'n';
+    *chars++ = 'f';
+    return chars;
+  }
+
+  if ((bits & ~sign_mask) == 0u) {
+    *chars++ = '0';
+    return chars;
+  }
+
+  auto const decimal = to_decimal(__builtin_bit_cast(TFloat,
+    static_cast<TU1>(bits & ~sign_mask)));
+  return decimal_to_chars(chars, decimal.exponent, decimal.mantissa);
+}
+
+} // namespace detail
+
+/**
+ * @brief Same as teju_float_to_chars.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  value            The given value.
+ *
+ * @pre The buffer has room for chars_max chars.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+constexpr
+char*
+to_chars(char* const chars, float const value) {
+  return detail::value_to_chars(chars, value, uint32_t{0x7f800000u},
+    uint32_t{0x007fffffu});
+}
+
+/**
+ * @brief Same as teju_double_to_chars.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  value            The given value.
+ *
+ * @pre The buffer has room for chars_max chars.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+constexpr
+char*
+to_chars(char* const chars, double const value) {
+  return detail::value_to_chars(chars, value, uint64_t{0x7ff0000000000000u},
+    uint64_t{0x000fffffffffffffu});
+}
+
+} // namespace teju
+
+#endif // defined(__cplusplus) && defined(teju_has_constexpr)
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_CONSTEXPR_H_
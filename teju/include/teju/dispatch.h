@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/dispatch.h
+ *
+ * Runtime selection of the x86-64 ISA level used by Tejú Jaguá for float and
+ * double values.
+ *
+ * When the library is configured with -Dteju_native=OFF on x86-64, the
+ * implementations for float and double are compiled for each of the levels
+ * below and the best one supported by the CPU is picked once at startup.
+ * Setting the environment variable TEJU_ISA to "x86-64", "x86-64-v3" or
+ * "x86-64-v4" caps the level (e.g., for benchmarking).
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_DISPATCH_H_
+#define TEJU_TEJU_INCLUDE_TEJU_DISPATCH_H_
+
+#if defined(teju_has_dispatch)
+
+#include "teju/src/config.h"
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief x86-64 ISA levels.
+ */
+typedef enum {
+  teju_isa_x86_64    = 0, // Baseline (SSE2).
+  teju_isa_x86_64_v3 = 1, // AVX2, BMI1, BMI2 and FMA.
+  teju_isa_x86_64_v4 = 2, // AVX-512 F, BW, CD, DQ and VL.
+} teju_isa_t;
+
+/**
+ * @brief Gets the ISA level in use.
+ *
+ * @returns The ISA level in use.
+ */
+teju_export
+teju_isa_t
+teju_get_isa(void);
+
+/**
+ * @brief Sets the ISA level in use.
+ *
+ * This function must not be called concurrently with conversions.
+ *
+ * @param  isa              The ISA level.
+ *
+ * @returns true if the level is supported by the CPU (and set) and false
+ *          otherwise.
+ */
+teju_export
+bool
+teju_set_isa(teju_isa_t isa);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // defined(teju_has_dispatch)
+#endif // TEJU_TEJU_INCLUDE_TEJU_DISPATCH_H_
@@ -37,7 +37,7 @@ extern "C" {
  *
  * @returns The binary representation of the given value.
  */
-inline
+teju_inline teju_constexpr
 teju64_fields_t
 teju_double_to_binary(double const value) {
 
@@ -49,8 +49,12 @@ teju_double_to_binary(double const value) {
   uint32_t const mantissa_width =   53u;
   int32_t  const exponent_min   = -1074;
 
-  teju_u1_t bits;
-  memcpy(&bits, &value, sizeof(value));
+  #if defined(teju_has_constexpr)
+    teju_u1_t bits = __builtin_bit_cast(teju_u1_t, value);
+  #else
+    teju_u1_t bits;
+    memcpy(&bits, &value, sizeof(value));
+  #endif
 
   teju_u1_t mantissa = teju_lsb(teju_u1_t, bits, mantissa_width - 1u);
   bits >>= (mantissa_width - 1u);
@@ -76,7 +80,7 @@ teju_double_to_binary(double const value) {
  *
  * @returns The decimal representation of the given value.
  */
-inline
+teju_inline teju_constexpr
 teju64_fields_t
 teju_double_to_decimal(double const value) {
   teju64_fields_t binary = teju_double_to_binary(value);
@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/double_double.h
+ *
+ * Tejú Jaguá and helpers for double-double values, i.e., unevaluated sums
+ * hi + lo of two double values.
+ *
+ * Double-doubles are seen as a binary floating-point format with a 107-bit
+ * mantissa and the exponent range of double. The values of most normalised
+ * pairs belong to this format. For the others, lo has significant bits far
+ * below those of hi and hi + lo is rounded to 107 bits (to nearest, ties to
+ * even).
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_DOUBLE_DOUBLE_H_
+#define TEJU_TEJU_INCLUDE_TEJU_DOUBLE_DOUBLE_H_
+
+#if defined(teju_has_uint128)
+
+#include "teju/double.h"
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include "teju/src/generated/double_double.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the binary representation of a given double-double value.
+ *
+ * @param  hi               The leading component of the given value.
+ * @param  lo               The trailing component of the given value.
+ *
+ * @pre isfinite(hi) && hi > 0 && hi + lo == hi.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline
+teju128_fields_t
+teju_double_double_to_binary(double const hi, double const lo) {
+
+  assert(isfinite(hi) && hi > 0 && hi + lo == hi &&
+    "Invalid double-double value.");
+
+  typedef teju128_fields_t teju_fields_t;
+  typedef teju128_u1_t     teju_u1_t;
+
+  uint32_t const mantissa_width = 107u;
+  int32_t  const exponent_min   = -1074;
+
+  teju64_fields_t const upper = teju_double_to_binary(hi);
+
+  // The mantissa of hi is shifted to leave mantissa_width - 53 bits for lo.
+  // When hi is a power of 2 and lo < 0, hi + lo is in the binade below and
+  // one more bit is left.
+  int32_t exponent = upper.exponent - (int32_t) (mantissa_width - 53u);
+  if (upper.mantissa == teju_pow2(uint64_t, 52u) && lo < 0)
+    exponent -= 1;
+  if (exponent < exponent_min)
+    exponent = exponent_min;
+
+  teju_u1_t mantissa = (teju_u1_t) upper.mantissa <<
+    (uint32_t) (upper.exponent - exponent);
+
+  if (lo != 0) {
+
+    teju64_fields_t const lower = teju_double_to_binary(fabs(lo));
+    teju_u1_t             delta = 0u;
+
+    if (lower.exponent >= exponent)
+      delta = (teju_u1_t) lower.mantissa <<
+        (uint32_t) (lower.exponent - exponent);
+
+    // Otherwise, exponent > exponent_min, the mantissa of hi was shifted by
+    // more than 53 bits and the parity of mantissa +/- delta is that of delta.
+    // Hence, rounding delta to nearest, ties to even, rounds hi + lo likewise.
+    // (If the shift is larger than 53 bits, then delta rounds to 0.)
+    else if (exponent - lower.exponent <= 53) {
+      uint32_t const shift = (uint32_t) (exponent - lower.exponent);
+      uint64_t const half  = teju_pow2(uint64_t, shift - 1u);
+      uint64_t const rest  = teju_lsb(uint64_t, lower.mantissa, shift);
+      delta = lower.mantissa >> shift;
+      if (rest > half || (rest == half && delta % 2u == 1u))
+        delta += 1u;
+    }
+
+    mantissa = lo > 0 ? mantissa + delta : mantissa - delta;
+  }
+
+  // Rounding might have carried into the binade of hi.
+  if (mantissa == teju_pow2(teju_u1_t, mantissa_width)) {
+    mantissa >>= 1u;
+    exponent  += 1;
+  }
+
+  teju_fields_t binary = {exponent, mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given double-double value.
+ *
+ * @param  hi               The leading component of the given value.
+ * @param  lo               The trailing component of the given value.
+ *
+ * @pre isfinite(hi) && hi > 0 && hi + lo == hi.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline
+teju128_fields_t
+teju_double_double_to_decimal(double const hi, double const lo) {
+  teju128_fields_t binary = teju_double_double_to_binary(hi, lo);
+  return teju_double_double(binary);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // defined(teju_has_uint128)
+#endif // TEJU_TEJU_INCLUDE_TEJU_DOUBLE_DOUBLE_H_
@@ -35,7 +35,7 @@ extern "C" {
  *
  * @returns The binary representation of the given value.
  */
-inline
+teju_inline
 teju128_fields_t
 teju_float128_to_binary(float128_t const value) {
 
@@ -80,7 +80,7 @@ teju_float128_to_binary(float128_t const value) {
  *
  * @returns The decimal representation of the given value.
  */
-inline
+teju_inline
 teju128_fields_t
 teju_float128_to_decimal(float128_t const value) {
   teju128_fields_t binary = teju_float128_to_binary(value);
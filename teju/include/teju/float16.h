@@ -23,6 +23,7 @@
 
 #include <assert.h>
 #include <math.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -39,7 +40,7 @@ extern "C" {
  *
  * @returns The binary representation of the given value.
  */
-inline
+teju_inline
 teju32_fields_t
 teju_float16_to_binary(float16_t const value) {
 
@@ -84,7 +85,7 @@ teju_float16_to_binary(float16_t const value) {
  *
  * @returns The decimal representation of the given value.
  */
-inline
+teju_inline
 teju32_fields_t
 teju_float16_to_decimal(float16_t const value) {
   teju32_fields_t binary = teju_float16_to_binary(value);
@@ -95,6 +96,26 @@ teju_float16_to_decimal(float16_t const value) {
   #endif
 }
 
+/**
+ * @brief Gets the decimal representations of the absolute values of an array
+ *        of float16_t values.
+ *
+ * Values are given by their bit patterns and the conversion is vectorised when
+ * AVX2 is available.
+ *
+ * @param  bits             The bit patterns of the values.
+ * @param  decimals         The output array of decimal representations.
+ * @param  n                The number of values.
+ *
+ * @pre bits and decimals point to arrays of n elements.
+ *
+ * @post decimals[i] is {0, 0} when bits[i] encodes zero, infinity or NaN.
+ */
+teju_export
+void
+teju_float16_to_decimal_batch(uint16_t const* bits, teju32_fields_t* decimals,
+  size_t n);
+
 #ifdef __cplusplus
 }
 #endif
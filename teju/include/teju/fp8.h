@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/fp8.h
+ *
+ * Tejú Jaguá and helpers for the OCP 8-bit floating-point formats E4M3 and
+ * E5M2.
+ *
+ * There's no portable 8-bit floating-point type in C and, for this reason,
+ * values are given by their bit patterns stored in uint8_t objects.
+ *
+ * The decimal representations of all values are stored in lookup tables
+ * (config/fp8_e4m3.json and config/fp8_e5m2.json set storage.lut) and
+ * teju_fp8_e4m3_to_decimal and teju_fp8_e5m2_to_decimal read them. The results
+ * match those of Tejú Jaguá, i.e., teju_fp8_e4m3 and teju_fp8_e5m2.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_FP8_H_
+#define TEJU_TEJU_INCLUDE_TEJU_FP8_H_
+
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include "teju/src/generated/fp8_e4m3.h"
+#include "teju/src/generated/fp8_e5m2.h"
+
+#include <assert.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the binary representation of a given E4M3 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7f.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_fp8_e4m3_to_binary(uint8_t const bits) {
+
+  assert(0 < bits && bits < 0x7f && "Invalid E4M3 value.");
+
+  typedef teju16_fields_t teju_fields_t;
+  typedef teju16_u1_t     teju_u1_t;
+
+  uint32_t const mantissa_width =  4u;
+  int32_t  const exponent_min   = -9;
+
+  teju_u1_t mantissa = teju_lsb(teju_u1_t, bits, mantissa_width - 1u);
+  int32_t   exponent = (int32_t) (bits >> (mantissa_width - 1u));
+
+  if (exponent != 0) {
+    exponent -= 1;
+    mantissa |= teju_pow2(teju_u1_t, mantissa_width - 1u);
+  }
+
+  exponent += exponent_min;
+  teju_fields_t binary = {exponent, mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given E4M3 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7f.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_fp8_e4m3_to_decimal(uint8_t const bits) {
+  assert(0 < bits && bits < 0x7f && "Invalid E4M3 value.");
+  return teju_fp8_e4m3_lut(bits);
+}
+
+/**
+ * @brief Gets the binary representation of a given E5M2 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7c.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_fp8_e5m2_to_binary(uint8_t const bits) {
+
+  assert(0 < bits && bits < 0x7c && "Invalid E5M2 value.");
+
+  typedef teju16_fields_t teju_fields_t;
+  typedef teju16_u1_t     teju_u1_t;
+
+  uint32_t const mantissa_width =   3u;
+  int32_t  const exponent_min   = -16;
+
+  teju_u1_t mantissa = teju_lsb(teju_u1_t, bits, mantissa_width - 1u);
+  int32_t   exponent = (int32_t) (bits >> (mantissa_width - 1u));
+
+  if (exponent != 0) {
+    exponent -= 1;
+    mantissa |= teju_pow2(teju_u1_t, mantissa_width - 1u);
+  }
+
+  exponent += exponent_min;
+  teju_fields_t binary = {exponent, mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given E5M2 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @pre The given value is finite and strictly positive, i.e.,
+ *      0 < bits && bits < 0x7c.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline teju_constexpr
+teju16_fields_t
+teju_fp8_e5m2_to_decimal(uint8_t const bits) {
+  assert(0 < bits && bits < 0x7c && "Invalid E5M2 value.");
+  return teju_fp8_e5m2_lut(bits);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_FP8_H_
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/long_double.h
+ *
+ * Tejú Jaguá and helpers for long double values in the x86 80-bit extended
+ * format.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_LONG_DOUBLE_H_
+#define TEJU_TEJU_INCLUDE_TEJU_LONG_DOUBLE_H_
+
+#if defined(teju_has_x86_extended)
+
+#include "teju/src/common.h"
+#include "teju/src/config.h"
+
+#include "teju/src/generated/x86_extended.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the binary representation of a given value.
+ *
+ * Contrary to IEEE-754 binary formats, the x86 extended format stores the
+ * integer bit of the mantissa explicitly. The value occupies the lowest 10
+ * bytes of its storage: the 64-bits mantissa is followed by 15-bits of biased
+ * exponent and the sign bit. The remaining bytes are padding.
+ *
+ * @param  value            The given value.
+ *
+ * @pre isfinite(value) && value > 0.
+ *
+ * @returns The binary representation of the given value.
+ */
+teju_inline
+teju128_fields_t
+teju_long_double_to_binary(long double const value) {
+
+  assert(isfinite(value) && value > 0 && "Invalid long double value.");
+
+  typedef teju128_fields_t teju_fields_t;
+  typedef teju128_u1_t     teju_u1_t;
+
+  int32_t const exponent_min = -16445;
+
+  uint64_t mantissa;
+  memcpy(&mantissa, &value, sizeof(mantissa));
+
+  uint16_t bits;
+  memcpy(&bits, (char const*) &value + sizeof(mantissa), sizeof(bits));
+
+  int32_t exponent = (int32_t) bits;
+
+  // The integer bit is already set in the mantissa of normal values. Subnormal
+  // values (exponent == 0) have the same exponent as the smallest normal ones.
+  if (exponent != 0)
+    exponent -= 1;
+
+  exponent += exponent_min;
+  teju_fields_t binary = {exponent, (teju_u1_t) mantissa};
+  return binary;
+}
+
+/**
+ * @brief Gets the decimal representation of a given value.
+ *
+ * @param  value            The given value.
+ *
+ * @pre isfinite(value) && value > 0.
+ *
+ * @returns The decimal representation of the given value.
+ */
+teju_inline
+teju128_fields_t
+teju_long_double_to_decimal(long double const value) {
+  teju128_fields_t binary = teju_long_double_to_binary(value);
+  return teju_x86_extended(binary);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // defined(teju_has_x86_extended)
+#endif // TEJU_TEJU_INCLUDE_TEJU_LONG_DOUBLE_H_
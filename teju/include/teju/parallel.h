@@ -0,0 +1,86 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/parallel.h
+ *
+ * Parallel conversion of arrays of floating-point values to their decimal
+ * representations.
+ *
+ * The input is split into chunks small enough for a chunk and its output to
+ * stay in L1/L2 caches. Each thread owns a contiguous range of chunks and, once
+ * it's done with its own range, it steals chunks from the back of the others'.
+ * Hence, threads running on busy cores don't hold up the whole job. Ranges are
+ * updated with a single compare-and-swap and no locks are taken.
+ */
+
+#ifndef TEJU_TEJU_INCLUDE_TEJU_PARALLEL_H_
+#define TEJU_TEJU_INCLUDE_TEJU_PARALLEL_H_
+
+#include "teju/src/config.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the decimal representations of given values using a given number
+ *        of threads.
+ *
+ * The calling thread takes part in the conversion and counts towards the
+ * number of threads. If threads cannot be created, then the job is completed by
+ * those already running.
+ *
+ * @param  values           The given values.
+ * @param  decimals         The output array of decimal representations.
+ * @param  n                The number of values.
+ * @param  threads          The number of threads or 0 for the number of CPUs.
+ *
+ * @pre For all i in [0, n), isfinite(values[i]) && values[i] > 0.
+ * @pre decimals has room for n elements and doesn't overlap with values.
+ */
+teju_export
+void
+teju_double_to_decimal_parallel(double const* values,
+  teju64_fields_t* decimals, size_t n, unsigned threads);
+
+/**
+ * @brief Same as teju_double_to_decimal_parallel but for float values.
+ */
+teju_export
+void
+teju_float_to_decimal_parallel(float const* values,
+  teju32_fields_t* decimals, size_t n, unsigned threads);
+
+#ifdef __cplusplus
+}
+
+namespace teju {
+
+/**
+ * @brief Same as teju_double_to_decimal_parallel.
+ */
+inline
+void
+to_decimal_parallel(double const* const values,
+  teju64_fields_t* const decimals, size_t const n, unsigned const threads = 0) {
+  teju_double_to_decimal_parallel(values, decimals, n, threads);
+}
+
+/**
+ * @brief Same as teju_float_to_decimal_parallel.
+ */
+inline
+void
+to_decimal_parallel(float const* const values,
+  teju32_fields_t* const decimals, size_t const n, unsigned const threads = 0) {
+  teju_float_to_decimal_parallel(values, decimals, n, threads);
+}
+
+} // namespace teju
+
+#endif
+
+#endif // TEJU_TEJU_INCLUDE_TEJU_PARALLEL_H_
@@ -0,0 +1,416 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/batch_bfloat16.c
+ *
+ * Tejú Jaguá for bfloat16 values, including the batch conversion.
+ *
+ * This translation unit includes the generated implementation so that the
+ * batch kernel can use its tables and helpers. Hence, it replaces
+ * teju/src/generated/bfloat16.c in the build.
+ *
+ * When AVX2 is available, the batch kernel converts 16 values at a time, one
+ * per 16-bit lane. The minverse table has only 8 entries of 16 bits and fits
+ * in a single 128-bit register where it's looked up with byte shuffles. The
+ * multipliers are gathered from memory but the whole table spans only a few
+ * cache lines. Uncentred values are rare (1 in 128) and are delegated to the
+ * scalar implementation.
+ */
+
+#include "teju/src/generated/bfloat16.c"
+
+#include "teju/bfloat16.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the decimal representation of the absolute value of a given
+ *        bfloat16 value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @returns The decimal representation of the absolute value of the given value
+ *          if it's finite and non-zero and {0, 0} otherwise.
+ */
+static inline
+teju16_fields_t
+to_decimal_scalar(uint16_t bits) {
+
+  bits &= 0x7fffu;
+
+  if (bits == 0u || bits >= 0x7f80u) {
+    teju16_fields_t const decimal = {0, 0};
+    return decimal;
+  }
+
+  return teju_bfloat16(teju_bfloat16_to_binary(bits));
+}
+
+#if defined(__AVX2__)
+
+/**
+ * @brief Tables used by the AVX2 kernel.
+ */
+typedef struct {
+  __m256i minverse_multiplier; // minverse[i].multiplier, i in [0, 8[.
+  __m256i minverse_bound;      // minverse[i].bound     , i in [0, 8[.
+  __m256i pow2_minus_1;        // pow(2, i) - 1         , i in [0, 8[.
+  __m256i pow2_8_minus;        // pow(2, 8 - i)         , i in [0, 8[.
+  __m256i pow2;                // pow(2, i)             , i in [0, 8[.
+} tables_t;
+
+/**
+ * @brief Broadcasts a table of 8 entries of 16 bits to both 128-bit lanes.
+ *
+ * @param  table            The table.
+ *
+ * @returns The broadcast table.
+ */
+static inline
+__m256i
+broadcast_table(uint16_t const table[8]) {
+  __m128i const lane = _mm_loadu_si128((__m128i const*) table);
+  return _mm256_broadcastsi128_si256(lane);
+}
+
+/**
+ * @brief Gets the tables used by the AVX2 kernel.
+ *
+ * @returns The tables.
+ */
+static inline
+tables_t
+get_tables(void) {
+
+  size_t const n = sizeof(minverse) / sizeof(minverse[0]);
+  assert(n <= 8u);
+
+  uint16_t multiplier[8] = {0};
+  uint16_t bound[8]      = {0};
+
+  for (size_t i = 0; i < n; ++i) {
+    multiplier[i] = minverse[i].multiplier;
+    bound[i]      = minverse[i].bound;
+  }
+
+  uint16_t const pow2_minus_1[8] = {   0,   1,  3,  7, 15, 31, 63, 127 };
+  uint16_t const pow2_8_minus[8] = { 256, 128, 64, 32, 16,  8,  4,   2 };
+  uint16_t const pow2[8]         = {   1,   2,  4,  8, 16, 32, 64, 128 };
+
+  tables_t tables;
+  tables.minverse_multiplier = broadcast_table(multiplier);
+  tables.minverse_bound      = broadcast_table(bound);
+  tables.pow2_minus_1        = broadcast_table(pow2_minus_1);
+  tables.pow2_8_minus        = broadcast_table(pow2_8_minus);
+  tables.pow2                = broadcast_table(pow2);
+  return tables;
+}
+
+/**
+ * @brief Looks up a broadcast table of 8 entries of 16 bits.
+ *
+ * @param  table            The broadcast table.
+ * @param  i                The indices.
+ *
+ * @pre All lanes of i are in [0, 8[.
+ *
+ * @returns The values table[i] in each lane.
+ */
+static inline
+__m256i
+lookup(__m256i const table, __m256i const i) {
+  // Bytes 2 * i and 2 * i + 1 make the i-th entry of table.
+  __m256i const bytes = _mm256_add_epi16(_mm256_mullo_epi16(i,
+    _mm256_set1_epi16(0x0202)), _mm256_set1_epi16(0x0100));
+  return _mm256_shuffle_epi8(table, bytes);
+}
+
+/**
+ * @brief Unsigned comparison x < y.
+ */
+static inline
+__m256i
+less(__m256i const x, __m256i const y) {
+  __m256i const sign = _mm256_set1_epi16((short) 0x8000);
+  return _mm256_cmpgt_epi16(_mm256_xor_si256(y, sign),
+    _mm256_xor_si256(x, sign));
+}
+
+/**
+ * @brief Unsigned comparison x <= y.
+ */
+static inline
+__m256i
+less_equal(__m256i const x, __m256i const y) {
+  return _mm256_cmpeq_epi16(_mm256_max_epu16(x, y), y);
+}
+
+/**
+ * @brief Bitwise not.
+ */
+static inline
+__m256i
+bit_not(__m256i const x) {
+  return _mm256_xor_si256(x, _mm256_set1_epi16(-1));
+}
+
+/**
+ * @brief Checks whether n is multiple of pow(5, f) for f in [0, 8[.
+ *
+ * @param  tables           The tables.
+ * @param  f                The exponent f.
+ * @param  n                The number n.
+ *
+ * @returns All bits set in lanes where 0 <= f < 8 and n is multiple of
+ *          pow(5, f) and all bits unset in the others.
+ */
+static inline
+__m256i
+is_tie_vector(tables_t const* const tables, __m256i const f, __m256i const n) {
+  __m256i const allows     = _mm256_andnot_si256(_mm256_cmpgt_epi16(
+    _mm256_setzero_si256(), f), _mm256_cmpgt_epi16(_mm256_set1_epi16(8), f));
+  __m256i const i          = _mm256_and_si256(f, _mm256_set1_epi16(7));
+  __m256i const multiplier = lookup(tables->minverse_multiplier, i);
+  __m256i const bound      = lookup(tables->minverse_bound, i);
+  return _mm256_and_si256(allows,
+    less_equal(_mm256_mullo_epi16(n, multiplier), bound));
+}
+
+/**
+ * @brief Vector version of teju_mshift.
+ *
+ * @param  m                The multiplicand m.
+ * @param  upper            The upper part of the multiplicand M.
+ * @param  lower            The lower part of the multiplicand M.
+ *
+ * @returns M * m >> 32.
+ */
+static inline
+__m256i
+mshift_vector(__m256i const m, __m256i const upper, __m256i const lower) {
+  // (upper * x + lower) * m >> 32 = (upper * m + (lower * m >> 16)) >> 16.
+  __m256i const ul    = _mm256_mullo_epi16(upper, m);
+  __m256i const uh    = _mm256_mulhi_epu16(upper, m);
+  __m256i const lh    = _mm256_mulhi_epu16(lower, m);
+  __m256i const sum   = _mm256_add_epi16(ul, lh);
+  __m256i const carry = less(sum, ul);
+  return _mm256_sub_epi16(uh, carry);
+}
+
+/**
+ * @brief Gathers the multipliers for 16 indices.
+ *
+ * @param  i                The indices.
+ * @param  upper            On exit, the upper parts of the multipliers.
+ * @param  lower            On exit, the lower parts of the multipliers.
+ */
+static inline
+void
+gather_multipliers(__m256i const i, __m256i* const upper,
+  __m256i* const lower) {
+
+  // Each multiplier is read as a 32-bit word: lower | upper << 16.
+  int const* const base = (int const*) multipliers;
+  __m256i const i_0 = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(i));
+  __m256i const i_1 = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(i, 1));
+  __m256i const w_0 = _mm256_i32gather_epi32(base, i_0, 4);
+  __m256i const w_1 = _mm256_i32gather_epi32(base, i_1, 4);
+
+  __m256i const mask = _mm256_set1_epi32(0xffff);
+  __m256i const l    = _mm256_packus_epi32(_mm256_and_si256(w_0, mask),
+    _mm256_and_si256(w_1, mask));
+  __m256i const u    = _mm256_packus_epi32(_mm256_srli_epi32(w_0, 16),
+    _mm256_srli_epi32(w_1, 16));
+
+  // packus interleaves 128-bit lanes.
+  *lower = _mm256_permute4x64_epi64(l, 0xd8);
+  *upper = _mm256_permute4x64_epi64(u, 0xd8);
+}
+
+/**
+ * @brief Gets the decimal representations of 16 values.
+ *
+ * @param  tables           The tables.
+ * @param  bits             The bit patterns of the values.
+ * @param  decimals         The output array of decimal representations.
+ */
+static inline
+void
+to_decimal_avx2(tables_t const* const tables, uint16_t const* const bits,
+  teju16_fields_t* const decimals) {
+
+  __m256i const zero  = _mm256_setzero_si256();
+  __m256i const one   = _mm256_set1_epi16(1);
+  __m256i const seven = _mm256_set1_epi16(7);
+
+  // Decoding.
+
+  __m256i const value     = _mm256_loadu_si256((__m256i const*) bits);
+  __m256i const abs       = _mm256_and_si256(value, _mm256_set1_epi16(0x7fff));
+  __m256i const biased    = _mm256_srli_epi16(abs, 7);
+  __m256i const is_normal = bit_not(_mm256_cmpeq_epi16(biased, zero));
+  __m256i const m         = _mm256_or_si256(
+    _mm256_and_si256(abs, _mm256_set1_epi16(0x7f)),
+    _mm256_and_si256(is_normal, _mm256_set1_epi16(0x80)));
+  __m256i const e         = _mm256_add_epi16(_mm256_add_epi16(biased,
+    is_normal), _mm256_set1_epi16(teju_exponent_min));
+
+  __m256i const is_special = _mm256_or_si256(
+    _mm256_cmpeq_epi16(biased, _mm256_set1_epi16(0xff)),
+    _mm256_cmpeq_epi16(abs, zero));
+
+  __m256i const is_uncentred = _mm256_andnot_si256(
+    _mm256_cmpeq_epi16(e, _mm256_set1_epi16(teju_exponent_min)),
+    _mm256_cmpeq_epi16(m, _mm256_set1_epi16(0x80)));
+
+  // Small integers: -e in [0, 8[ and m multiple of pow(2, -e).
+
+  __m256i const minus_e  = _mm256_sub_epi16(zero, e);
+  __m256i const k        = _mm256_and_si256(minus_e, seven);
+  __m256i const is_small = _mm256_and_si256(_mm256_and_si256(
+      _mm256_cmpgt_epi16(e, _mm256_set1_epi16(-8)),
+      _mm256_cmpgt_epi16(one, e)),
+    _mm256_cmpeq_epi16(_mm256_and_si256(m, lookup(tables->pow2_minus_1, k)),
+      zero));
+  __m256i const small    = _mm256_srli_epi16(_mm256_mullo_epi16(m,
+    lookup(tables->pow2_8_minus, k)), 8);
+
+  // f = teju_log10_pow2(e) and r = teju_log10_pow2_residual(e). For e in the
+  // range of bfloat16, 19728 / pow(2, 16) is a good enough approximation of
+  // 1292913987 / pow(2, 32).
+
+  __m256i const c_log   = _mm256_set1_epi16(19728);
+  __m256i const f       = _mm256_mulhi_epi16(e, c_log);
+  __m256i const p       = _mm256_mullo_epi16(e, c_log);
+  __m256i const r       = _mm256_sub_epi16(zero, _mm256_add_epi16(
+    _mm256_add_epi16(
+      less_equal(_mm256_set1_epi16(19728), p),
+      less_equal(_mm256_set1_epi16(39456), p)),
+      less_equal(_mm256_set1_epi16((short) 59184), p)));
+  __m256i const pow2_r  = lookup(tables->pow2, r);
+
+  // Lanes of special values might be out of range.
+  __m256i const n_multipliers =
+    _mm256_set1_epi16(sizeof(multipliers) / sizeof(multipliers[0]) - 1);
+  __m256i const index = _mm256_min_epi16(_mm256_max_epi16(_mm256_sub_epi16(f,
+    _mm256_set1_epi16(teju_storage_index_offset)), zero), n_multipliers);
+
+  __m256i upper, lower;
+  gather_multipliers(index, &upper, &lower);
+
+  // Centred case.
+
+  __m256i const m_2 = _mm256_add_epi16(m, m);
+  __m256i const m_b = _mm256_mullo_epi16(_mm256_add_epi16(m_2, one), pow2_r);
+  __m256i const m_a = _mm256_mullo_epi16(_mm256_sub_epi16(m_2, one), pow2_r);
+  __m256i const b   = mshift_vector(m_b, upper, lower);
+  __m256i const a   = mshift_vector(m_a, upper, lower);
+  __m256i const q   = _mm256_srli_epi16(_mm256_mulhi_epu16(b,
+    _mm256_set1_epi16((short) 0xcccd)), 3);
+  __m256i const s   = _mm256_mullo_epi16(q, _mm256_set1_epi16(10));
+
+  __m256i const allows_ties = _mm256_andnot_si256(_mm256_cmpgt_epi16(zero, f),
+    _mm256_cmpgt_epi16(_mm256_set1_epi16(8), f));
+  __m256i const wins        = _mm256_cmpeq_epi16(_mm256_and_si256(m, one),
+    zero);
+  __m256i const is_tie_b    = is_tie_vector(tables, f, m_b);
+  __m256i const is_tie_a    = is_tie_vector(tables, f, m_a);
+  __m256i const s_eq_b      = _mm256_and_si256(allows_ties,
+    _mm256_cmpeq_epi16(s, b));
+  __m256i const s_eq_a      = _mm256_and_si256(allows_ties,
+    _mm256_cmpeq_epi16(s, a));
+
+  __m256i const shortest = _mm256_blendv_epi8(
+    _mm256_blendv_epi8(less(a, s), _mm256_and_si256(is_tie_a, wins), s_eq_a),
+    _mm256_or_si256(bit_not(is_tie_b), wins), s_eq_b);
+
+  __m256i const m_c       = _mm256_mullo_epi16(_mm256_slli_epi16(m, 2),
+    pow2_r);
+  __m256i const c_2       = mshift_vector(m_c, upper, lower);
+  __m256i const c         = _mm256_srli_epi16(c_2, 1);
+  __m256i const pick_left = _mm256_or_si256(
+    _mm256_and_si256(is_tie_vector(tables, _mm256_sub_epi16(zero, f), c_2),
+      _mm256_cmpeq_epi16(_mm256_and_si256(c, one), zero)),
+    _mm256_cmpeq_epi16(_mm256_and_si256(c_2, one), zero));
+  __m256i const closest   = _mm256_sub_epi16(c, bit_not(pick_left));
+
+  // Merging cases.
+
+  __m256i mantissa = _mm256_blendv_epi8(closest, q, shortest);
+  __m256i exponent = _mm256_sub_epi16(f, shortest);
+  mantissa         = _mm256_blendv_epi8(mantissa, small, is_small);
+  exponent         = _mm256_andnot_si256(is_small, exponent);
+
+  // Removal of trailing zeros.
+
+  __m256i const minv5 = _mm256_set1_epi16((short) 0xcccd);
+  __m256i const bound = _mm256_set1_epi16(0xffff / 10 + 1);
+  __m256i active      = _mm256_or_si256(shortest, is_small);
+
+  for (;;) {
+    __m256i const t    = _mm256_mullo_epi16(mantissa, minv5);
+    __m256i const quot = _mm256_or_si256(_mm256_slli_epi16(t, 15),
+      _mm256_srli_epi16(t, 1));
+    active = _mm256_and_si256(active, less(quot, bound));
+    if (_mm256_testz_si256(active, active))
+      break;
+    mantissa = _mm256_blendv_epi8(mantissa, quot, active);
+    exponent = _mm256_sub_epi16(exponent, active);
+  }
+
+  // Storing.
+
+  int16_t  exponents[16];
+  uint16_t mantissas[16];
+  _mm256_storeu_si256((__m256i*) exponents, exponent);
+  _mm256_storeu_si256((__m256i*) mantissas, mantissa);
+
+  for (unsigned i = 0; i < 16u; ++i) {
+    decimals[i].exponent = exponents[i];
+    decimals[i].mantissa = mantissas[i];
+  }
+
+  // Each lane sets two bits of the mask.
+  __m256i const fallback = _mm256_or_si256(is_special,
+    _mm256_andnot_si256(is_small, is_uncentred));
+  uint32_t const mask = (uint32_t) _mm256_movemask_epi8(fallback);
+
+  if (mask != 0u) {
+    for (unsigned i = 0; i < 16u; ++i)
+      if ((mask >> (2u * i) & 1u) != 0u)
+        decimals[i] = to_decimal_scalar(bits[i]);
+  }
+}
+
+#endif // defined(__AVX2__)
+
+void
+teju_bfloat16_to_decimal_batch(uint16_t const* const bits,
+  teju16_fields_t* const decimals, size_t const n) {
+
+  size_t i = 0;
+
+  #if defined(__AVX2__)
+    tables_t const tables = get_tables();
+    for (; i + 16u <= n; i += 16u)
+      to_decimal_avx2(&tables, bits + i, decimals + i);
+  #endif
+
+  for (; i < n; ++i)
+    decimals[i] = to_decimal_scalar(bits[i]);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/batch_float16.c
+ *
+ * Tejú Jaguá for float16_t values, including the batch conversion.
+ *
+ * This translation unit includes the generated implementation so that the
+ * batch kernel can use its tables and helpers. Hence, it replaces
+ * teju/src/generated/ieee16_{with,no}_uint128.c in the build.
+ *
+ * Since the generated implementation works on 32-bit limbs, when AVX2 is
+ * available, the batch kernel converts 8 values at a time, one per 32-bit
+ * lane. Uncentred values are rare (1 in 1024) and are delegated to the scalar
+ * implementation.
+ */
+
+#if defined(teju_has_uint128)
+  #include "teju/src/generated/ieee16_with_uint128.c"
+#else
+  #include "teju/src/generated/ieee16_no_uint128.c"
+#endif
+
+#include "teju/float16.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Gets the decimal representation of the absolute value of a given
+ *        float16_t value.
+ *
+ * @param  bits             The bit pattern of the given value.
+ *
+ * @returns The decimal representation of the absolute value of the given value
+ *          if it's finite and non-zero and {0, 0} otherwise.
+ */
+static inline
+teju32_fields_t
+to_decimal_scalar(uint16_t bits) {
+
+  bits &= 0x7fffu;
+
+  if (bits == 0u || bits >= 0x7c00u) {
+    teju32_fields_t const decimal = {0, 0};
+    return decimal;
+  }
+
+  float16_t value;
+  memcpy(&value, &bits, sizeof(value));
+  return teju_function(teju_float16_to_binary(value));
+}
+
+#if defined(__AVX2__)
+
+/**
+ * @brief Unsigned comparison x < y.
+ */
+static inline
+__m256i
+less(__m256i const x, __m256i const y) {
+  __m256i const sign = _mm256_set1_epi32(INT32_MIN);
+  return _mm256_cmpgt_epi32(_mm256_xor_si256(y, sign),
+    _mm256_xor_si256(x, sign));
+}
+
+/**
+ * @brief Unsigned comparison x <= y.
+ */
+static inline
+__m256i
+less_equal(__m256i const x, __m256i const y) {
+  return _mm256_cmpeq_epi32(_mm256_max_epu32(x, y), y);
+}
+
+/**
+ * @brief Bitwise not.
+ */
+static inline
+__m256i
+bit_not(__m256i const x) {
+  return _mm256_xor_si256(x, _mm256_set1_epi32(-1));
+}
+
+/**
+ * @brief Gets the upper halves of the 64-bit products of the odd and even
+ *        32-bit lanes of x and y.
+ */
+static inline
+__m256i
+mulhi_epu32(__m256i const x, __m256i const y) {
+  __m256i const even = _mm256_srli_epi64(_mm256_mul_epu32(x, y), 32);
+  __m256i const odd  = _mm256_mul_epu32(_mm256_srli_epi64(x, 32),
+    _mm256_srli_epi64(y, 32));
+  return _mm256_blend_epi32(even, odd, 0xaa);
+}
+
+/**
+ * @brief Vector version of teju_mshift.
+ *
+ * @param  m                The multiplicand m.
+ * @param  upper            The upper part of the multiplicand M.
+ * @param  lower            The lower part of the multiplicand M.
+ *
+ * @pre All lanes of m are smaller than pow(2, 16).
+ *
+ * @returns M * m >> 64.
+ */
+static inline
+__m256i
+mshift_vector(__m256i const m, __m256i const upper, __m256i const lower) {
+  // (upper * x + lower) * m >> 64 = (upper * m + (lower * m >> 32)) >> 32 and
+  // the inner sum doesn't overflow since upper * m < pow(2, 48).
+  __m256i const l      = mulhi_epu32(lower, m);
+  __m256i const even   = _mm256_add_epi64(_mm256_mul_epu32(upper, m),
+    _mm256_and_si256(l, _mm256_set1_epi64x(0xffffffff)));
+  __m256i const odd    = _mm256_add_epi64(_mm256_mul_epu32(
+    _mm256_srli_epi64(upper, 32), _mm256_srli_epi64(m, 32)),
+    _mm256_srli_epi64(l, 32));
+  return _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xaa);
+}
+
+/**
+ * @brief Checks whether n is multiple of pow(5, f) for f in the range of the
+ *        minverse table.
+ *
+ * @param  f                The exponent f.
+ * @param  n                The number n.
+ *
+ * @returns All bits set in lanes where f is in the range of minverse and n is
+ *          multiple of pow(5, f) and all bits unset in the others.
+ */
+static inline
+__m256i
+is_tie_vector(__m256i const f, __m256i const n) {
+  int const size = (int) (sizeof(minverse) / sizeof(minverse[0]));
+  int const* const base = (int const*) minverse;
+
+  // Lanes where f is out of range read minverse[0].
+  __m256i const allows     = _mm256_andnot_si256(_mm256_cmpgt_epi32(
+    _mm256_setzero_si256(), f), _mm256_cmpgt_epi32(_mm256_set1_epi32(size),
+    f));
+  __m256i const i          = _mm256_and_si256(allows, _mm256_add_epi32(f, f));
+  __m256i const multiplier = _mm256_i32gather_epi32(base, i, 4);
+  __m256i const bound      = _mm256_i32gather_epi32(base + 1, i, 4);
+  return _mm256_and_si256(allows,
+    less_equal(_mm256_mullo_epi32(n, multiplier), bound));
+}
+
+/**
+ * @brief Gets the decimal representations of 8 values.
+ *
+ * @param  bits             The bit patterns of the values.
+ * @param  decimals         The output array of decimal representations.
+ */
+static inline
+void
+to_decimal_avx2(uint16_t const* const bits, teju32_fields_t* const decimals) {
+
+  __m256i const zero = _mm256_setzero_si256();
+  __m256i const one  = _mm256_set1_epi32(1);
+
+  // Decoding.
+
+  __m256i const value     = _mm256_cvtepu16_epi32(
+    _mm_loadu_si128((__m128i const*) bits));
+  __m256i const abs       = _mm256_and_si256(value, _mm256_set1_epi32(0x7fff));
+  __m256i const biased    = _mm256_srli_epi32(abs, 10);
+  __m256i const is_normal = bit_not(_mm256_cmpeq_epi32(biased, zero));
+  __m256i const m         = _mm256_or_si256(
+    _mm256_and_si256(abs, _mm256_set1_epi32(0x3ff)),
+    _mm256_and_si256(is_normal, _mm256_set1_epi32(0x400)));
+  __m256i const e         = _mm256_add_epi32(_mm256_add_epi32(biased,
+    is_normal), _mm256_set1_epi32(teju_exponent_min));
+
+  __m256i const is_special = _mm256_or_si256(
+    _mm256_cmpeq_epi32(biased, _mm256_set1_epi32(0x1f)),
+    _mm256_cmpeq_epi32(abs, zero));
+
+  __m256i const is_uncentred = _mm256_andnot_si256(
+    _mm256_cmpeq_epi32(e, _mm256_set1_epi32(teju_exponent_min)),
+    _mm256_cmpeq_epi32(m, _mm256_set1_epi32(0x400)));
+
+  // Small integers: -e in [0, 11[ and m multiple of pow(2, -e).
+
+  __m256i const minus_e  = _mm256_sub_epi32(zero, e);
+  __m256i const is_small = _mm256_and_si256(_mm256_and_si256(
+      _mm256_cmpgt_epi32(e, _mm256_set1_epi32(-(int) teju_mantissa_width)),
+      _mm256_cmpgt_epi32(one, e)),
+    _mm256_cmpeq_epi32(_mm256_and_si256(m, _mm256_sub_epi32(
+      _mm256_sllv_epi32(one, minus_e), one)), zero));
+  __m256i const small    = _mm256_srlv_epi32(m, minus_e);
+
+  // f = teju_log10_pow2(e) and r = teju_log10_pow2_residual(e). For e in the
+  // range of float16_t, 19728 / pow(2, 16) is a good enough approximation of
+  // 1292913987 / pow(2, 32).
+
+  __m256i const p = _mm256_mullo_epi32(e, _mm256_set1_epi32(19728));
+  __m256i const f = _mm256_srai_epi32(p, 16);
+  __m256i const l = _mm256_and_si256(p, _mm256_set1_epi32(0xffff));
+  __m256i const r = _mm256_sub_epi32(zero, _mm256_add_epi32(_mm256_add_epi32(
+    _mm256_cmpgt_epi32(l, _mm256_set1_epi32(19727)),
+    _mm256_cmpgt_epi32(l, _mm256_set1_epi32(39455))),
+    _mm256_cmpgt_epi32(l, _mm256_set1_epi32(59183))));
+
+  // Lanes of special values might be out of range.
+  int const n_multipliers = (int) (sizeof(multipliers) /
+    sizeof(multipliers[0]));
+  __m256i const index = _mm256_min_epi32(_mm256_max_epi32(_mm256_sub_epi32(f,
+    _mm256_set1_epi32(teju_storage_index_offset)), zero),
+    _mm256_set1_epi32(n_multipliers - 1));
+
+  int const* const base  = (int const*) multipliers;
+  __m256i const    i_2   = _mm256_add_epi32(index, index);
+  __m256i const    lower = _mm256_i32gather_epi32(base, i_2, 4);
+  __m256i const    upper = _mm256_i32gather_epi32(base + 1, i_2, 4);
+
+  // Centred case.
+
+  __m256i const m_2 = _mm256_add_epi32(m, m);
+  __m256i const m_b = _mm256_sllv_epi32(_mm256_add_epi32(m_2, one), r);
+  __m256i const m_a = _mm256_sllv_epi32(_mm256_sub_epi32(m_2, one), r);
+  __m256i const b   = mshift_vector(m_b, upper, lower);
+  __m256i const a   = mshift_vector(m_a, upper, lower);
+  __m256i const q   = _mm256_srli_epi32(mulhi_epu32(b,
+    _mm256_set1_epi32((int) 0xcccccccd)), 3);
+  __m256i const s   = _mm256_mullo_epi32(q, _mm256_set1_epi32(10));
+
+  int const n_minverse = (int) (sizeof(minverse) / sizeof(minverse[0]));
+  __m256i const allows_ties = _mm256_andnot_si256(_mm256_cmpgt_epi32(zero, f),
+    _mm256_cmpgt_epi32(_mm256_set1_epi32(n_minverse), f));
+  __m256i const wins        = _mm256_cmpeq_epi32(_mm256_and_si256(m, one),
+    zero);
+  __m256i const is_tie_b    = is_tie_vector(f, m_b);
+  __m256i const is_tie_a    = is_tie_vector(f, m_a);
+  __m256i const s_eq_b      = _mm256_and_si256(allows_ties,
+    _mm256_cmpeq_epi32(s, b));
+  __m256i const s_eq_a      = _mm256_and_si256(allows_ties,
+    _mm256_cmpeq_epi32(s, a));
+
+  __m256i const shortest = _mm256_blendv_epi8(
+    _mm256_blendv_epi8(less(a, s), _mm256_and_si256(is_tie_a, wins), s_eq_a),
+    _mm256_or_si256(bit_not(is_tie_b), wins), s_eq_b);
+
+  __m256i const m_c       = _mm256_sllv_epi32(_mm256_slli_epi32(m, 2), r);
+  __m256i const c_2       = mshift_vector(m_c, upper, lower);
+  __m256i const c         = _mm256_srli_epi32(c_2, 1);
+  __m256i const pick_left = _mm256_or_si256(
+    _mm256_and_si256(is_tie_vector(_mm256_sub_epi32(zero, f), c_2),
+      _mm256_cmpeq_epi32(_mm256_and_si256(c, one), zero)),
+    _mm256_cmpeq_epi32(_mm256_and_si256(c_2, one), zero));
+  __m256i const closest   = _mm256_sub_epi32(c, bit_not(pick_left));
+
+  // Merging cases.
+
+  __m256i mantissa = _mm256_blendv_epi8(closest, q, shortest);
+  __m256i exponent = _mm256_sub_epi32(f, shortest);
+  mantissa         = _mm256_blendv_epi8(mantissa, small, is_small);
+  exponent         = _mm256_andnot_si256(is_small, exponent);
+
+  // Removal of trailing zeros.
+
+  __m256i const minv5 = _mm256_set1_epi32((int) 0xcccccccd);
+  __m256i const bound = _mm256_set1_epi32(0xffffffff / 10 + 1);
+  __m256i active      = _mm256_or_si256(shortest, is_small);
+
+  for (;;) {
+    __m256i const t    = _mm256_mullo_epi32(mantissa, minv5);
+    __m256i const quot = _mm256_or_si256(_mm256_slli_epi32(t, 31),
+      _mm256_srli_epi32(t, 1));
+    active = _mm256_and_si256(active, less(quot, bound));
+    if (_mm256_testz_si256(active, active))
+      break;
+    mantissa = _mm256_blendv_epi8(mantissa, quot, active);
+    exponent = _mm256_sub_epi32(exponent, active);
+  }
+
+  // Storing.
+
+  int32_t  exponents[8];
+  uint32_t mantissas[8];
+  _mm256_storeu_si256((__m256i*) exponents, exponent);
+  _mm256_storeu_si256((__m256i*) mantissas, mantissa);
+
+  for (unsigned i = 0; i < 8u; ++i) {
+    decimals[i].exponent = exponents[i];
+    decimals[i].mantissa = mantissas[i];
+  }
+
+  __m256i const fallback = _mm256_or_si256(is_special,
+    _mm256_andnot_si256(is_small, is_uncentred));
+  uint32_t const mask = (uint32_t) _mm256_movemask_ps(
+    _mm256_castsi256_ps(fallback));
+
+  if (mask != 0u) {
+    for (unsigned i = 0; i < 8u; ++i)
+      if ((mask >> i & 1u) != 0u)
+        decimals[i] = to_decimal_scalar(bits[i]);
+  }
+}
+
+#endif // defined(__AVX2__)
+
+void
+teju_float16_to_decimal_batch(uint16_t const* const bits,
+  teju32_fields_t* const decimals, size_t const n) {
+
+  size_t i = 0;
+
+  #if defined(__AVX2__)
+    for (; i + 8u <= n; i += 8u)
+      to_decimal_avx2(bits + i, decimals + i);
+  #endif
+
+  for (; i < n; ++i)
+    decimals[i] = to_decimal_scalar(bits[i]);
+}
+
+#ifdef __cplusplus
+}
+#endif
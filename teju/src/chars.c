@@ -0,0 +1,463 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/chars.c
+ *
+ * Conversion of decimal representations and floating-point values to chars.
+ */
+
+#include "teju/chars.h"
+
+#include "teju/bfloat16.h"
+#include "teju/double.h"
+#include "teju/float.h"
+#include "teju/float16.h"
+#include "teju/float128.h"
+#include "teju/long_double.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Helper functions.
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Pairs of decimal digits from "00" to "99".
+ */
+static char const digit_pairs[] =
+  "00010203040506070809"
+  "10111213141516171819"
+  "20212223242526272829"
+  "30313233343536373839"
+  "40414243444546474849"
+  "50515253545556575859"
+  "60616263646566676869"
+  "70717273747576777879"
+  "80818283848586878889"
+  "90919293949596979899";
+
+/**
+ * @brief Powers of 10 that fit in uint64_t.
+ */
+static uint64_t const powers_of_10[] = {
+  UINT64_C(1),
+  UINT64_C(10),
+  UINT64_C(100),
+  UINT64_C(1000),
+  UINT64_C(10000),
+  UINT64_C(100000),
+  UINT64_C(1000000),
+  UINT64_C(10000000),
+  UINT64_C(100000000),
+  UINT64_C(1000000000),
+  UINT64_C(10000000000),
+  UINT64_C(100000000000),
+  UINT64_C(1000000000000),
+  UINT64_C(10000000000000),
+  UINT64_C(100000000000000),
+  UINT64_C(1000000000000000),
+  UINT64_C(10000000000000000),
+  UINT64_C(100000000000000000),
+  UINT64_C(1000000000000000000),
+  UINT64_C(10000000000000000000),
+};
+
+/**
+ * @brief Gets the number of decimal digits of n.
+ *
+ * @param  n                The number n.
+ *
+ * @returns The number of decimal digits of n.
+ */
+static inline
+uint32_t
+digits_size(uint64_t const n) {
+  uint32_t const max  = sizeof(powers_of_10) / sizeof(powers_of_10[0]);
+  uint32_t       size = 1u;
+  while (size < max && n >= powers_of_10[size])
+    ++size;
+  return size;
+}
+
+/**
+ * @brief Writes the decimal digits of n backwards, that is, the last digit is
+ *        written to last[-1], the one before to last[-2], etc.
+ *
+ * @param  last             Pointer to one-past-the-end of the digits.
+ * @param  n                The number n.
+ *
+ * @returns Pointer to the first digit written.
+ */
+static inline
+char*
+digits_to_chars(char* last, uint64_t n) {
+
+  while (n >= 100u) {
+    uint32_t const r = (uint32_t) (n % 100u);
+    n    /= 100u;
+    last -= 2;
+    memcpy(last, digit_pairs + 2u * r, 2u);
+  }
+
+  if (n >= 10u) {
+    last -= 2;
+    memcpy(last, digit_pairs + 2u * n, 2u);
+  }
+  else
+    *--last = (char) ('0' + n);
+
+  return last;
+}
+
+/**
+ * @brief Gets the number of chars needed to write the exponent part of the
+ *        scientific notation.
+ *
+ * @param  e                The exponent in scientific notation.
+ *
+ * @returns The number of chars.
+ */
+static inline
+size_t
+exponent_size(int32_t const e) {
+  if (e == 0)
+    return 0u;
+  uint32_t const abs_e = e < 0 ? 0u - (uint32_t) e : (uint32_t) e;
+  return 1u + (e < 0) + digits_size(abs_e);
+}
+
+/**
+ * @brief Gets the number of chars needed to write n digits of mantissa in
+ *        scientific notation and decimal exponent f.
+ *
+ * @param  n                The number of digits of the mantissa.
+ * @param  f                The decimal exponent.
+ *
+ * @returns The number of chars.
+ */
+static inline
+size_t
+scientific_size(uint32_t const n, int32_t const f) {
+  return n + (n > 1u) + exponent_size(f + (int32_t) n - 1);
+}
+
+/**
+ * @brief Finishes writing a decimal representation in scientific notation.
+ *
+ * On entry, the n digits of the mantissa are in chars[1], ..., chars[n]. On
+ * exit, the first digit is moved to chars[0], the decimal point (if needed) is
+ * inserted and the exponent part (if needed) is appended.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  n                The number of digits of the mantissa.
+ * @param  f                The decimal exponent.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+static inline
+char*
+scientific_to_chars(char* chars, uint32_t const n, int32_t const f) {
+
+  chars[0] = chars[1];
+  if (n > 1u) {
+    chars[1] = '.';
+    chars   += n + 1u;
+  }
+  else
+    chars += 1;
+
+  int32_t const e = f + (int32_t) n - 1;
+  if (e == 0)
+    return chars;
+
+  *chars++ = 'e';
+  if (e < 0)
+    *chars++ = '-';
+
+  uint32_t const abs_e = e < 0 ? 0u - (uint32_t) e : (uint32_t) e;
+  chars += digits_size(abs_e);
+  digits_to_chars(chars, abs_e);
+  return chars;
+}
+
+/**
+ * @brief Writes the sign of a floating-point value and handles values that
+ *        Tejú Jaguá doesn't, namely, zeros, infinities and NaNs.
+ *
+ * @param  chars            The beginning of the output buffer.
+ * @param  is_negative      Whether the sign bit is set.
+ * @param  is_special       Whether the biased exponent has all bits set.
+ * @param  is_zero          Whether the bits other than the sign are all unset.
+ * @param  is_nan           Whether the value is a NaN.
+ * @param  done             On exit, tells whether the value has been fully
+ *                          written.
+ *
+ * @returns Pointer to one-past-the-end of chars written.
+ */
+static inline
+char*
+prefix_to_chars(char* chars, bool const is_negative, bool const is_special,
+  bool const is_zero, bool const is_nan, bool* done) {
+
+  *done = true;
+
+  if (is_special && is_nan)
+    return (char*) memcpy(chars, "nan", 3u) + 3;
+
+  if (is_negative)
+    *chars++ = '-';
+
+  if (is_special)
+    return (char*) memcpy(chars, "inf", 3u) + 3;
+
+  if (is_zero) {
+    *chars++ = '0';
+    return chars;
+  }
+
+  *done = false;
+  return chars;
+}
+
+//------------------------------------------------------------------------------
+// Decimal representations
+//------------------------------------------------------------------------------
+
+size_t
+teju16_chars_size(teju16_fields_t const decimal) {
+  return scientific_size(digits_size(decimal.mantissa), decimal.exponent);
+}
+
+char*
+teju16_to_chars(char* const chars, teju16_fields_t const decimal) {
+  uint32_t const n = digits_size(decimal.mantissa);
+  digits_to_chars(chars + 1u + n, decimal.mantissa);
+  return scientific_to_chars(chars, n, decimal.exponent);
+}
+
+size_t
+teju32_chars_size(teju32_fields_t const decimal) {
+  return scientific_size(digits_size(decimal.mantissa), decimal.exponent);
+}
+
+char*
+teju32_to_chars(char* const chars, teju32_fields_t const decimal) {
+  uint32_t const n = digits_size(decimal.mantissa);
+  digits_to_chars(chars + 1u + n, decimal.mantissa);
+  return scientific_to_chars(chars, n, decimal.exponent);
+}
+
+size_t
+teju64_chars_size(teju64_fields_t const decimal) {
+  return scientific_size(digits_size(decimal.mantissa), decimal.exponent);
+}
+
+char*
+teju64_to_chars(char* const chars, teju64_fields_t const decimal) {
+  uint32_t const n = digits_size(decimal.mantissa);
+  digits_to_chars(chars + 1u + n, decimal.mantissa);
+  return scientific_to_chars(chars, n, decimal.exponent);
+}
+
+#if defined(teju_has_uint128)
+
+/**
+ * @brief 10^19, the largest power of 10 that fits in uint64_t.
+ */
+static uint64_t const pow10_19 = UINT64_C(10000000000000000000);
+
+/**
+ * @brief Gets the number of decimal digits of n.
+ *
+ * @param  n                The number n.
+ *
+ * @returns The number of decimal digits of n.
+ */
+static inline
+uint32_t
+digits_size_128(uint128_t n) {
+  uint32_t size = 0u;
+  while (n > UINT64_MAX) {
+    n    /= pow10_19;
+    size += 19u;
+  }
+  return size + digits_size((uint64_t) n);
+}
+
+/**
+ * @brief Same as digits_to_chars but for uint128_t.
+ */
+static inline
+char*
+digits_to_chars_128(char* last, uint128_t n) {
+  while (n > UINT64_MAX) {
+    uint64_t const r     = (uint64_t) (n % pow10_19);
+    char*    const first = digits_to_chars(last, r);
+    n    /= pow10_19;
+    last -= 19;
+    memset(last, '0', (size_t) (first - last));
+  }
+  return digits_to_chars(last, (uint64_t) n);
+}
+
+size_t
+teju128_chars_size(teju128_fields_t const decimal) {
+  return scientific_size(digits_size_128(decimal.mantissa), decimal.exponent);
+}
+
+char*
+teju128_to_chars(char* const chars, teju128_fields_t const decimal) {
+  uint32_t const n = digits_size_128(decimal.mantissa);
+  digits_to_chars_128(chars + 1u + n, decimal.mantissa);
+  return scientific_to_chars(chars, n, decimal.exponent);
+}
+
+#endif // defined(teju_has_uint128)
+
+//------------------------------------------------------------------------------
+// Floating-point values
+//------------------------------------------------------------------------------
+
+#if defined(teju_has_float16)
+
+char*
+teju_float16_to_chars(char* chars, float16_t value) {
+
+  uint16_t bits;
+  memcpy(&bits, &value, sizeof(value));
+
+  bool done;
+  chars = prefix_to_chars(chars, bits >> 15u, (bits & 0x7c00u) == 0x7c00u,
+    (bits & 0x7fffu) == 0u, (bits & 0x03ffu) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= 0x7fffu;
+  memcpy(&value, &bits, sizeof(value));
+  return teju32_to_chars(chars, teju_float16_to_decimal(value));
+}
+
+#endif // defined(teju_has_float16)
+
+char*
+teju_bfloat16_to_chars(char* chars, uint16_t bits) {
+
+  bool done;
+  chars = prefix_to_chars(chars, bits >> 15u, (bits & 0x7f80u) == 0x7f80u,
+    (bits & 0x7fffu) == 0u, (bits & 0x007fu) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= 0x7fffu;
+  return teju16_to_chars(chars, teju_bfloat16_to_decimal(bits));
+}
+
+char*
+teju_float_to_chars(char* chars, float value) {
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(value));
+
+  bool done;
+  chars = prefix_to_chars(chars, bits >> 31u,
+    (bits & 0x7f800000u) == 0x7f800000u, (bits & 0x7fffffffu) == 0u,
+    (bits & 0x007fffffu) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= 0x7fffffffu;
+  memcpy(&value, &bits, sizeof(value));
+  return teju32_to_chars(chars, teju_float_to_decimal(value));
+}
+
+char*
+teju_double_to_chars(char* chars, double value) {
+
+  uint64_t const sign_mask     = UINT64_C(0x8000000000000000);
+  uint64_t const exponent_mask = UINT64_C(0x7ff0000000000000);
+  uint64_t const mantissa_mask = UINT64_C(0x000fffffffffffff);
+
+  uint64_t bits;
+  memcpy(&bits, &value, sizeof(value));
+
+  bool done;
+  chars = prefix_to_chars(chars, (bits & sign_mask) != 0u,
+    (bits & exponent_mask) == exponent_mask, (bits & ~sign_mask) == 0u,
+    (bits & mantissa_mask) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= ~sign_mask;
+  memcpy(&value, &bits, sizeof(value));
+  return teju64_to_chars(chars, teju_double_to_decimal(value));
+}
+
+#if defined(teju_has_float128)
+
+char*
+teju_float128_to_chars(char* chars, float128_t value) {
+
+  uint128_t const one           = 1u;
+  uint128_t const sign_mask     = one << 127u;
+  uint128_t const exponent_mask = ((one << 15u) - 1u) << 112u;
+  uint128_t const mantissa_mask = (one << 112u) - 1u;
+
+  uint128_t bits;
+  memcpy(&bits, &value, sizeof(value));
+
+  bool done;
+  chars = prefix_to_chars(chars, (bits & sign_mask) != 0u,
+    (bits & exponent_mask) == exponent_mask, (bits & ~sign_mask) == 0u,
+    (bits & mantissa_mask) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= ~sign_mask;
+  memcpy(&value, &bits, sizeof(value));
+  return teju128_to_chars(chars, teju_float128_to_decimal(value));
+}
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+char*
+teju_long_double_to_chars(char* chars, long double value) {
+
+  uint16_t const sign_mask     = 0x8000u;
+  uint16_t const exponent_mask = 0x7fffu;
+  uint64_t const fraction_mask = UINT64_C(0x7fffffffffffffff);
+
+  // The mantissa (with the explicit integer bit) is followed by the sign and
+  // the biased exponent. (See teju_long_double_to_binary.)
+  uint64_t mantissa;
+  memcpy(&mantissa, &value, sizeof(mantissa));
+
+  uint16_t bits;
+  memcpy(&bits, (char const*) &value + sizeof(mantissa), sizeof(bits));
+
+  bool done;
+  chars = prefix_to_chars(chars, (bits & sign_mask) != 0u,
+    (bits & exponent_mask) == exponent_mask,
+    (bits & exponent_mask) == 0u && mantissa == 0u,
+    (mantissa & fraction_mask) != 0u, &done);
+  if (done)
+    return chars;
+
+  bits &= exponent_mask;
+  memcpy((char*) &value + sizeof(mantissa), &bits, sizeof(bits));
+  return teju128_to_chars(chars, teju_long_double_to_decimal(value));
+}
+
+#endif // defined(teju_has_x86_extended)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/columnar.c
+ *
+ * Conversion of columns of floating-point values to Arrow-style string arrays.
+ */
+
+#include "teju/columnar.h"
+
+#include "teju/chars.h"
+#include "teju/double.h"
+#include "teju/float.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//------------------------------------------------------------------------------
+// Helper functions.
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Checks whether the i-th value is valid.
+ *
+ * @param  validity         The validity bitmap or NULL if all values are valid.
+ * @param  i                The index of the value.
+ *
+ * @returns true if the i-th value is valid and false otherwise.
+ */
+static inline
+bool
+is_valid(uint8_t const* const validity, size_t const i) {
+  return validity == NULL || (validity[i / 8u] >> (i % 8u) & 1u) != 0u;
+}
+
+//------------------------------------------------------------------------------
+// double
+//------------------------------------------------------------------------------
+
+bool
+teju_double_column_offsets(double const* const values,
+  uint8_t const* const validity, size_t const n, int32_t* const offsets,
+  teju64_fields_t* const decimals) {
+
+  uint64_t const sign_mask     = UINT64_C(0x8000000000000000);
+  uint64_t const exponent_mask = UINT64_C(0x7ff0000000000000);
+
+  int64_t offset = offsets[0];
+
+  for (size_t i = 0; i < n; ++i) {
+
+    if (is_valid(validity, i)) {
+
+      uint64_t bits;
+      memcpy(&bits, &values[i], sizeof(bits));
+
+      uint64_t const abs_bits = bits & ~sign_mask;
+
+      if (abs_bits > exponent_mask)
+        offset += 3; // "nan"
+      else if (abs_bits == exponent_mask)
+        offset += bits != abs_bits ? 4 : 3; // "-inf" or "inf"
+      else if (abs_bits == 0u)
+        offset += bits != abs_bits ? 2 : 1; // "-0" or "0"
+      else {
+        offset += bits != abs_bits;
+        double value;
+        memcpy(&value, &abs_bits, sizeof(value));
+        teju64_fields_t const decimal = teju_double_to_decimal(value);
+        if (decimals != NULL)
+          decimals[i] = decimal;
+        offset += (int64_t) teju64_chars_size(decimal);
+      }
+
+      if (offset > INT32_MAX)
+        return false;
+    }
+
+    offsets[i + 1] = (int32_t) offset;
+  }
+
+  return true;
+}
+
+void
+teju_double_column_to_chars(double const* const values,
+  uint8_t const* const validity, size_t const n, int32_t const* const offsets,
+  teju64_fields_t const* const decimals, char* const data) {
+
+  uint64_t const sign_mask     = UINT64_C(0x8000000000000000);
+  uint64_t const exponent_mask = UINT64_C(0x7ff0000000000000);
+
+  for (size_t i = 0; i < n; ++i) {
+
+    if (!is_valid(validity, i))
+      continue;
+
+    char* chars = data + offsets[i];
+
+    uint64_t bits;
+    memcpy(&bits, &values[i], sizeof(bits));
+
+    uint64_t const abs_bits = bits & ~sign_mask;
+
+    if (decimals == NULL || (abs_bits & exponent_mask) == exponent_mask ||
+      abs_bits == 0u) {
+      teju_double_to_chars(chars, values[i]);
+      continue;
+    }
+
+    if (bits != abs_bits)
+      *chars++ = '-';
+    teju64_to_chars(chars, decimals[i]);
+  }
+}
+
+//------------------------------------------------------------------------------
+// float
+//------------------------------------------------------------------------------
+
+bool
+teju_float_column_offsets(float const* const values,
+  uint8_t const* const validity, size_t const n, int32_t* const offsets,
+  teju32_fields_t* const decimals) {
+
+  uint32_t const sign_mask     = UINT32_C(0x80000000);
+  uint32_t const exponent_mask = UINT32_C(0x7f800000);
+
+  int64_t offset = offsets[0];
+
+  for (size_t i = 0; i < n; ++i) {
+
+    if (is_valid(validity, i)) {
+
+      uint32_t bits;
+      memcpy(&bits, &values[i], sizeof(bits));
+
+      uint32_t const abs_bits = bits & ~sign_mask;
+
+      if (abs_bits > exponent_mask)
+        offset += 3; // "nan"
+      else if (abs_bits == exponent_mask)
+        offset += bits != abs_bits ? 4 : 3; // "-inf" or "inf"
+      else if (abs_bits == 0u)
+        offset += bits != abs_bits ? 2 : 1; // "-0" or "0"
+      else {
+        offset += bits != abs_bits;
+        float value;
+        memcpy(&value, &abs_bits, sizeof(value));
+        teju32_fields_t const decimal = teju_float_to_decimal(value);
+        if (decimals != NULL)
+          decimals[i] = decimal;
+        offset += (int64_t) teju32_chars_size(decimal);
+      }
+
+      if (offset > INT32_MAX)
+        return false;
+    }
+
+    offsets[i + 1] = (int32_t) offset;
+  }
+
+  return true;
+}
+
+void
+teju_float_column_to_chars(float const* const values,
+  uint8_t const* const validity, size_t const n, int32_t const* const offsets,
+  teju32_fields_t const* const decimals, char* const data) {
+
+  uint32_t const sign_mask     = UINT32_C(0x80000000);
+  uint32_t const exponent_mask = UINT32_C(0x7f800000);
+
+  for (size_t i = 0; i < n; ++i) {
+
+    if (!is_valid(validity, i))
+      continue;
+
+    char* chars = data + offsets[i];
+
+    uint32_t bits;
+    memcpy(&bits, &values[i], sizeof(bits));
+
+    uint32_t const abs_bits = bits & ~sign_mask;
+
+    if (decimals == NULL || (abs_bits & exponent_mask) == exponent_mask ||
+      abs_bits == 0u) {
+      teju_float_to_chars(chars, values[i]);
+      continue;
+    }
+
+    if (bits != abs_bits)
+      *chars++ = '-';
+    teju32_to_chars(chars, decimals[i]);
+  }
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -10,6 +10,8 @@
 #ifndef TEJU_TEJU_SRC_COMMON_H_
 #define TEJU_TEJU_SRC_COMMON_H_
 
+#include "teju/src/config.h"
+
 #include <assert.h>
 #include <stdint.h>
 
@@ -17,6 +19,32 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Specifiers of the inline helpers in public headers (e.g.,
+ *        teju_double_to_decimal) and of the implementations of Tejú Jaguá
+ *        (e.g., teju_ieee64_with_uint128).
+ *
+ * By default, the former are inline and the latter have external linkage. The
+ * amalgamation teju_all.h defines teju_static_inline to make all of them static
+ * inline so that they can be inlined into callers without link-time
+ * optimisation.
+ *
+ * The inline helpers are exported since C++ translation units (e.g.,
+ * src/parallel.cpp) emit their own copies of them which, otherwise, would hide
+ * the external definitions provided by src/inline.c.
+ *
+ * The implementations of Tejú Jaguá are also teju_constexpr (see config.h) and
+ * so are the inline helpers whose definitions are valid in constant
+ * expressions, e.g., teju_double_to_binary, but not teju_long_double_to_binary.
+ */
+#if defined(teju_static_inline)
+  #define teju_inline             static inline
+  #define teju_function_specifier static inline teju_constexpr
+#else
+  #define teju_inline             teju_export inline
+  #define teju_function_specifier
+#endif
+
 /**
  * @brief Returns pow(2, e) as a given unsigned integer type.
  *
@@ -56,7 +84,7 @@ extern "C" {
  *
  * @returns The exponent f.
  */
-static inline
+static inline teju_constexpr
 int32_t
 teju_log10_pow2(int32_t const e) {
   assert(teju_log10_pow2_min <= e && e <= teju_log10_pow2_max);
@@ -74,13 +102,81 @@ teju_log10_pow2(int32_t const e) {
  *
  * @returns The residual r.
  */
-static inline
+static inline teju_constexpr
 uint32_t
 teju_log10_pow2_residual(int32_t const e) {
   assert(teju_log10_pow2_min <= e && e <= teju_log10_pow2_max);
   return (uint32_t) ((int64_t) 1292913987u * e) / 1292913987u;
 }
 
+// Argument bounds of teju_log10_pow2_wide.
+#define teju_log10_pow2_wide_min (-1554957)
+#define teju_log10_pow2_wide_max   1554957
+
+/**
+ * @brief Returns the largest exponent f such that pow(10, f) <= pow(2, e),
+ *        i.e., the integer part of log_10(pow(2, e)).
+ *
+ * This is teju_log10_pow2 for a wider range of exponents (e.g., those of
+ * binary256) at the cost of more precision in the calculation.
+ *
+ * @param  e                 The exponent e.
+ *
+ * @pre teju_log10_pow2_wide_min <= e && e <= teju_log10_pow2_wide_max.
+ *
+ * @returns The exponent f.
+ */
+static inline teju_constexpr
+int32_t
+teju_log10_pow2_wide(int32_t const e) {
+  assert(teju_log10_pow2_wide_min <= e && e <= teju_log10_pow2_wide_max);
+  return (int32_t) ((int64_t) 5171655946u * e >> 34u);
+}
+
+/**
+ * @brief Returns the residual r = e - e_0, where e_0 is the smallest exponent
+ *        such that the integer parts of log_10(pow(2, e_0)) and
+ *        log_10(pow(2, e)) match.
+ *
+ * This is teju_log10_pow2_residual for the range of teju_log10_pow2_wide.
+ *
+ * @param  e                The exponent e.
+ *
+ * @pre teju_log10_pow2_wide_min <= e && e <= teju_log10_pow2_wide_max.
+ *
+ * @returns The residual r.
+ */
+static inline teju_constexpr
+uint32_t
+teju_log10_pow2_residual_wide(int32_t const e) {
+  assert(teju_log10_pow2_wide_min <= e && e <= teju_log10_pow2_wide_max);
+  return (uint32_t) (teju_lsb(uint64_t, (uint64_t) ((int64_t) 5171655946u * e),
+    34u) / 5171655946u);
+}
+
+// Argument bounds of teju_log2_pow10.
+#define teju_log2_pow10_min (-97878)
+#define teju_log2_pow10_max   97878
+
+/**
+ * @brief Returns the smallest exponent e such that pow(2, e) >= pow(10, f),
+ *        i.e., the ceiling of log_2(pow(10, f)).
+ *
+ * Equivalently, e is the smallest exponent such that teju_log10_pow2(e) == f.
+ *
+ * @param  f                The exponent f.
+ *
+ * @pre teju_log2_pow10_min <= f && f <= teju_log2_pow10_max.
+ *
+ * @returns The exponent e.
+ */
+static inline teju_constexpr
+int32_t
+teju_log2_pow10(int32_t const f) {
+  assert(teju_log2_pow10_min <= f && f <= teju_log2_pow10_max);
+  return (int32_t) -((int64_t) -891723283 * f >> 28u);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,8 +23,16 @@ extern "C" {
 #if defined(teju_has_uint128)
   typedef __uint128_t uint128_t;
 #else
-  // Cannot support float128_t if uint128_t is not defined.
+  // Cannot support float128_t and long double (x86 extended) if uint128_t is
+  // not defined.
   #undef teju_has_float128
+  #undef teju_has_x86_extended
+#endif
+
+#if defined(teju_has_uint256)
+  // C23's bit-precise integers are lowered by compilers to 64-bit limbs.
+  typedef unsigned _BitInt(256) uint256_t;
+  typedef unsigned _BitInt(512) uint512_t;
 #endif
 
 #if defined(teju_has_float16)
@@ -35,6 +43,85 @@ extern "C" {
   typedef __float128 float128_t;
 #endif
 
+//------------------------------------------------------------------------------
+// Symbol visibility
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Specifier of the functions exported by the library.
+ *
+ * The library is built with hidden visibility and only the functions declared
+ * with teju_export are exported by the shared library. Macro teju_shared is
+ * defined when building or using the shared library and teju_EXPORTS is
+ * defined by CMake when building it. A definition of teju_export provided prior
+ * to including this file takes precedence.
+ */
+#if !defined(teju_export)
+  #if !defined(teju_shared)
+    #define teju_export
+  #elif defined(_WIN32) && defined(teju_EXPORTS)
+    #define teju_export __declspec(dllexport)
+  #elif defined(_WIN32)
+    #define teju_export __declspec(dllimport)
+  #else
+    #define teju_export __attribute__((visibility("default")))
+  #endif
+#endif
+
+//------------------------------------------------------------------------------
+// Constant expressions
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Specifier of the helpers, tables and implementations of Tejú Jaguá
+ *        that can be evaluated in C++ constant expressions.
+ *
+ * In the amalgamation teju_all.h (see teju_static_inline in common.h) compiled
+ * as C++20 by gcc or clang, macro teju_has_constexpr is defined and
+ * teju_constexpr expands to constexpr. Otherwise, it expands to nothing.
+ */
+#if defined(teju_static_inline) && defined(__cplusplus) && \
+  __cplusplus >= 202002L && defined(__GNUC__)
+  #define teju_has_constexpr
+  #define teju_constexpr constexpr
+#else
+  #define teju_constexpr
+#endif
+
+//------------------------------------------------------------------------------
+// Table layout
+//------------------------------------------------------------------------------
+
+/**
+ * @brief Specifier of the tables of multipliers which aligns them to cache
+ *        lines of teju_cache_line_size bytes.
+ */
+#if !defined(teju_cache_line_size)
+  #define teju_cache_line_size 64
+#endif
+
+#if defined(_MSC_VER)
+  #define teju_aligned __declspec(align(teju_cache_line_size))
+#elif defined(__GNUC__)
+  #define teju_aligned __attribute__((aligned(teju_cache_line_size)))
+#else
+  #define teju_aligned
+#endif
+
+/**
+ * @brief Specifier of the tables of hot multipliers (see storage.hot in
+ *        cpp/generator/config.hpp).
+ *
+ * On ELF platforms they are placed in section teju_hot which the linker
+ * concatenates across translation units. Hence, the hot multipliers of all
+ * types are contiguous and touch as few cache lines and pages as possible.
+ */
+#if defined(__GNUC__) && defined(__ELF__)
+  #define teju_hot_section __attribute__((section("teju_hot")))
+#else
+  #define teju_hot_section
+#endif
+
 //------------------------------------------------------------------------------
 // Flags indicating the platform's multiplication capability.
 //------------------------------------------------------------------------------
@@ -149,7 +236,7 @@ typedef struct {
   #define teju32_u4_t          uint128_t
   #define teju32_multiply_type teju_built_in_4
 
-#elif defined(_MSC_VER)
+#else
 
   #define teju32_multiply_type teju_synthetic_2
 
@@ -171,7 +258,7 @@ typedef struct {
   #define teju64_u2_t          uint128_t
   #define teju64_multiply_type teju_built_in_2
 
-#elif defined(_MSC_VER)
+#else
 
   #define teju64_multiply_type teju_synthetic_1
 
@@ -186,10 +273,10 @@ typedef struct {
 // 128 bits //
 //----------//
 
-#if defined(teju_has_float128)
+#if defined(teju_has_uint128)
 
   #define teju128_u1_t          uint128_t
-  #define teju128_multiply_type teju_built_in_1
+  #define teju128_multiply_type teju_synthetic_1
 
   typedef struct {
     int32_t      exponent;
@@ -198,6 +285,23 @@ typedef struct {
 
 #endif
 
+//----------//
+// 256 bits //
+//----------//
+
+#if defined(teju_has_uint256)
+
+  #define teju256_u1_t          uint256_t
+  #define teju256_u2_t          uint512_t
+  #define teju256_multiply_type teju_built_in_2
+
+  typedef struct {
+    int32_t      exponent;
+    teju256_u1_t mantissa;
+  } teju256_fields_t;
+
+#endif
+
 //------------------------------------------------------------------------------
 // teju_multiply
 //------------------------------------------------------------------------------
@@ -206,25 +310,107 @@ typedef struct {
 // be able to implement their own (e.g., for testing). For this, it suffices to
 // define macro teju_do_not_define_teju_multiply prior to including this file.
 
-#if defined(_MSC_VER) && !defined(teju_do_not_define_teju_multiply)
-
-  /**
-   * @brief Calculates the 128-bits product of two 64-bits unsigned numbers.
-   *
-   * @param  a              The 1st multiplicand.
-   * @param  b              The 2nd multiplicand.
-   * @param  upper          On exit the value of the highest 64-bits of the
-   *                        product.
-   *
-   * @returns The lower 64-bits value of the product.
-   */
-  inline static
-  uint64_t
-  teju_multiply(uint64_t const a, uint64_t const b, uint64_t* upper) {
-    return _umul128(a, b, upper);
-  }
-
-#endif // defined(_MSC_VER)
+#if !defined(teju_do_not_define_teju_multiply)
+
+  #if defined(_MSC_VER) && defined(_M_X64)
+
+    /**
+     * @brief Calculates the 128-bits product of two 64-bits unsigned numbers.
+     *
+     * @param  a            The 1st multiplicand.
+     * @param  b            The 2nd multiplicand.
+     * @param  upper        On exit the value of the highest 64-bits of the
+     *                      product.
+     *
+     * @returns The lower 64-bits value of the product.
+     */
+    inline static
+    uint64_t
+    teju_multiply(uint64_t const a, uint64_t const b, uint64_t* upper) {
+      return _umul128(a, b, upper);
+    }
+
+  #elif !defined(teju_has_uint128)
+
+    /**
+     * @brief Calculates the 128-bits product of two 64-bits unsigned numbers.
+     *
+     * This is the implementation for platforms without a 64 x 64 -> 128
+     * multiplication (e.g., 32-bit x86 and Arm). It splits the multiplicands
+     * into 32-bits halves and, on these platforms, each of the four 32 x 32 ->
+     * 64 partial products is a single instruction.
+     *
+     * @param  a            The 1st multiplicand.
+     * @param  b            The 2nd multiplicand.
+     * @param  upper        On exit the value of the highest 64-bits of the
+     *                      product.
+     *
+     * @returns The lower 64-bits value of the product.
+     */
+    inline static teju_constexpr
+    uint64_t
+    teju_multiply(uint64_t const a, uint64_t const b, uint64_t* upper) {
+
+      uint64_t const a0 = (uint32_t) a;
+      uint64_t const a1 = a >> 32u;
+      uint64_t const b0 = (uint32_t) b;
+      uint64_t const b1 = b >> 32u;
+
+      uint64_t const p00 = a0 * b0;
+      uint64_t const p01 = a0 * b1;
+      uint64_t const p10 = a1 * b0;
+      uint64_t const p11 = a1 * b1;
+
+      // This sum doesn't wraparound: it's at most
+      // (pow(2, 32) - 1)^2 + 2 * (pow(2, 32) - 1) = pow(2, 64) - 1.
+      uint64_t const middle = p10 + (p00 >> 32u) + (uint32_t) p01;
+
+      *upper = p11 + (middle >> 32u) + (p01 >> 32u);
+      return (middle << 32u) | (uint32_t) p00;
+    }
+
+  #else
+
+    /**
+     * @brief Calculates the 256-bits product of two 128-bits unsigned
+     *        numbers.
+     *
+     * This is used by 128-bits limbs (e.g., for float128_t). It splits the
+     * multiplicands into 64-bits halves and each of the four 64 x 64 -> 128
+     * partial products is a single instruction (e.g., mul or mulx on x86-64).
+     *
+     * @param  a            The 1st multiplicand.
+     * @param  b            The 2nd multiplicand.
+     * @param  upper        On exit the value of the highest 128-bits of the
+     *                      product.
+     *
+     * @returns The lower 128-bits value of the product.
+     */
+    inline static teju_constexpr
+    uint128_t
+    teju_multiply(uint128_t const a, uint128_t const b, uint128_t* upper) {
+
+      uint128_t const a0 = (uint64_t) a;
+      uint128_t const a1 = a >> 64u;
+      uint128_t const b0 = (uint64_t) b;
+      uint128_t const b1 = b >> 64u;
+
+      uint128_t const p00 = a0 * b0;
+      uint128_t const p01 = a0 * b1;
+      uint128_t const p10 = a1 * b0;
+      uint128_t const p11 = a1 * b1;
+
+      // This sum doesn't wraparound: it's at most
+      // (pow(2, 64) - 1)^2 + 2 * (pow(2, 64) - 1) = pow(2, 128) - 1.
+      uint128_t const middle = p10 + (p00 >> 64u) + (uint64_t) p01;
+
+      *upper = p11 + (middle >> 64u) + (p01 >> 64u);
+      return (middle << 64u) | (uint64_t) p00;
+    }
+
+  #endif
+
+#endif // !defined(teju_do_not_define_teju_multiply)
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/dispatch.c
+ *
+ * Runtime dispatch of the implementations for float and double values.
+ *
+ * The generated sources for float and double are compiled once per ISA level
+ * with -march=<level> and the function name suffixed by the level (see
+ * teju/CMakeLists.txt). This translation unit defines the unsuffixed functions
+ * which forward to the implementation for the selected level.
+ *
+ * The selection is made by a constructor before main. Calls made earlier (e.g.,
+ * from other constructors) go through resolvers that make the selection.
+ */
+
+#include "teju/dispatch.h"
+
+#if defined(teju_has_uint128)
+  #include "teju/src/generated/ieee32_with_uint128.h"
+  #include "teju/src/generated/ieee64_with_uint128.h"
+#else
+  #include "teju/src/generated/ieee32_no_uint128.h"
+  #include "teju/src/generated/ieee64_no_uint128.h"
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(teju_has_uint128)
+  #define teju_ieee32 teju_ieee32_with_uint128
+  #define teju_ieee64 teju_ieee64_with_uint128
+#else
+  #define teju_ieee32 teju_ieee32_no_uint128
+  #define teju_ieee64 teju_ieee64_no_uint128
+#endif
+
+#define teju_concat(a, b)  teju_concat_(a, b)
+#define teju_concat_(a, b) a ## b
+
+#define teju_declare_levels(function, fields)              \
+  fields teju_concat(function, _x86_64   )(fields binary); \
+  fields teju_concat(function, _x86_64_v3)(fields binary); \
+  fields teju_concat(function, _x86_64_v4)(fields binary)
+
+teju_declare_levels(teju_ieee32, teju32_fields_t);
+teju_declare_levels(teju_ieee64, teju64_fields_t);
+
+typedef teju32_fields_t (*ieee32_t)(teju32_fields_t binary);
+typedef teju64_fields_t (*ieee64_t)(teju64_fields_t binary);
+
+// Implementations indexed by teju_isa_t.
+
+static ieee32_t const ieee32_levels[] = {
+  teju_concat(teju_ieee32, _x86_64   ),
+  teju_concat(teju_ieee32, _x86_64_v3),
+  teju_concat(teju_ieee32, _x86_64_v4),
+};
+
+static ieee64_t const ieee64_levels[] = {
+  teju_concat(teju_ieee64, _x86_64   ),
+  teju_concat(teju_ieee64, _x86_64_v3),
+  teju_concat(teju_ieee64, _x86_64_v4),
+};
+
+static teju32_fields_t ieee32_resolve(teju32_fields_t binary);
+static teju64_fields_t ieee64_resolve(teju64_fields_t binary);
+
+// Implementations in use.
+static ieee32_t   ieee32 = ieee32_resolve;
+static ieee64_t   ieee64 = ieee64_resolve;
+static teju_isa_t isa    = teju_isa_x86_64;
+
+/**
+ * @brief Gets the highest ISA level supported by the CPU.
+ *
+ * @returns The highest ISA level supported by the CPU.
+ */
+static
+teju_isa_t
+get_isa_supported(void) {
+
+  __builtin_cpu_init();
+
+  bool const v3 = __builtin_cpu_supports("avx2") &&
+    __builtin_cpu_supports("bmi") && __builtin_cpu_supports("bmi2") &&
+    __builtin_cpu_supports("fma");
+
+  bool const v4 = v3 && __builtin_cpu_supports("avx512f") &&
+    __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512cd") &&
+    __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl");
+
+  return v4 ? teju_isa_x86_64_v4 : v3 ? teju_isa_x86_64_v3 : teju_isa_x86_64;
+}
+
+/**
+ * @brief Selects the highest ISA level supported by the CPU and not above the
+ *        one set by the environment variable TEJU_ISA (if any).
+ */
+static
+void
+resolve(void) {
+
+  static char const* const names[] = { "x86-64", "x86-64-v3", "x86-64-v4" };
+
+  teju_isa_t  level = get_isa_supported();
+  char const* name  = getenv("TEJU_ISA");
+
+  if (name != NULL) {
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i) {
+      if (strcmp(name, names[i]) == 0 && (teju_isa_t) i < level)
+        level = (teju_isa_t) i;
+    }
+  }
+
+  teju_set_isa(level);
+}
+
+static
+teju32_fields_t
+ieee32_resolve(teju32_fields_t const binary) {
+  resolve();
+  return ieee32(binary);
+}
+
+static
+teju64_fields_t
+ieee64_resolve(teju64_fields_t const binary) {
+  resolve();
+  return ieee64(binary);
+}
+
+__attribute__((constructor))
+static
+void
+initialise(void) {
+  resolve();
+}
+
+teju_isa_t
+teju_get_isa(void) {
+  if (ieee32 == ieee32_resolve)
+    resolve();
+  return isa;
+}
+
+bool
+teju_set_isa(teju_isa_t const level) {
+
+  if (level < teju_isa_x86_64 || level > get_isa_supported())
+    return false;
+
+  ieee32 = ieee32_levels[level];
+  ieee64 = ieee64_levels[level];
+  isa    = level;
+  return true;
+}
+
+teju32_fields_t
+teju_ieee32(teju32_fields_t const binary) {
+  return ieee32(binary);
+}
+
+teju64_fields_t
+teju_ieee64(teju64_fields_t const binary) {
+  return ieee64(binary);
+}
+
+#ifdef __cplusplus
+}
+#endif
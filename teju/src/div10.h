@@ -23,7 +23,7 @@ extern "C" {
  *
  * @returns n / 10.
  */
-static inline
+static inline teju_constexpr
 teju_u1_t
 teju_div10(teju_u1_t const n) {
 
@@ -46,7 +46,7 @@ teju_div10(teju_u1_t const n) {
     teju_u1_t const a = ((teju_u1_t) -1) / 10u + 1u;
 
     #if teju_calculation_div10 == teju_built_in_2
-      return (1u * a * ((teju_u2_t) n)) >> teju_width;
+      return (teju_u1_t) ((1u * a * ((teju_u2_t) n)) >> teju_width);
     #else // teju_calculation_div10 == teju_synthetic_1
       teju_u1_t upper;
       (void) teju_multiply(a, n, &upper);
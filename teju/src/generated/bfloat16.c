@@ -15,8 +15,14 @@ extern "C" {
 #define teju_exponent_min         -133
 #define teju_mantissa_width       8u
 #define teju_storage_index_offset -41
-#define teju_calculation_div10    teju_built_in_2
-#define teju_calculation_mshift   teju_built_in_4
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_4
+#endif
 
 #define teju_function             teju_bfloat16
 #define teju_fields_t             teju16_fields_t
@@ -35,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { 0xd1b9, 0x92ef }, // -41
   { 0x4f8f, 0xeb19 }, // -40
   { 0x3fa5, 0xbc14 }, // -39
@@ -118,7 +124,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 0u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
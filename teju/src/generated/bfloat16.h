@@ -12,6 +12,7 @@
 extern "C" {
 #endif
 
+teju_export
 teju16_fields_t
 teju_bfloat16(teju16_fields_t binary);
 
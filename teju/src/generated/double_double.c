@@ -0,0 +1,710 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./double_double.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                128u
+#define teju_exponent_min         -1074
+#define teju_mantissa_width       107u
+#define teju_storage_index_offset -324
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_synthetic_1
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_synthetic_1
+#endif
+
+#define teju_function             teju_double_double
+#define teju_fields_t             teju128_fields_t
+#define teju_u1_t                 teju128_u1_t
+
+#if defined(teju128_u2_t)
+  #define teju_u2_t               teju128_u2_t
+#endif
+
+#if defined(teju128_u4_t)
+  #define teju_u4_t               teju128_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { teju_literal2(0x4944d9f52cd0dec2, 0xaefc86c50710cdca), teju_literal2(0x9e19db92b4e31ba9, 0x6c07a2c26a8346d1) }, // -324
+  { teju_literal2(0x4207c321e14e3137, 0x7e60d7a1a4e7afa9), teju_literal2(0xfcf62c1dee382c42, 0x46729e03dd9ed7b5) }, // -323
+  { teju_literal2(0x34d30281810b5a92, 0xcb80ac8150b95954), teju_literal2(0xca5e89b18b602368, 0x385bb19cb14bdfc4) }, // -322
+  { teju_literal2(0x2a4268679a6f7ba8, 0xa2cd56cdda2de110), teju_literal2(0xa1e53af46f801c53, 0x60495ae3c1097fd0) }, // -321
+  { teju_literal2(0x21ceb9ec7b8c62ed, 0x4f0aabd7e1be4da7), teju_literal2(0x81842f29f2cce375, 0xe6a1158300d46640) }, // -320
+  { teju_literal2(0x36178fe0c5ad6b15, 0x4b44462635fd490a), teju_literal2(0xcf39e50feae16bef, 0xd768226b34870a00) }, // -319
+  { teju_literal2(0x2b460cb3d15788dd, 0xd5d0381e91976da2), teju_literal2(0xa5c7ea73224deff3, 0x12b9b522906c0800) }, // -318
+  { teju_literal2(0x55d1a3c30ddfa0b1, 0x77d9c67edadf8ae8), teju_literal2(0x849feec281d7f328, 0xdbc7c41ba6bcd333) }, // -317
+  { teju_literal2(0xbc829f9e7c99011b, 0xf2f60a649165ab0d), teju_literal2(0xd433179d9c8cb841, 0x5fa60692a46151eb) }, // -316
+  { teju_literal2(0xfd354c7eca1400e3, 0x28c4d51d411e2271), teju_literal2(0xa9c2794ae3a3c69a, 0xb2eb3875504ddb22) }, // -315
+  { teju_literal2(0x975dd6cbd4dccd82, 0x8703ddb100e4e85a), teju_literal2(0x87cec76f1c830548, 0x8f2293910d0b15b5) }, // -314
+  { teju_literal2(0x2562f146216148d0, 0xd8062f819b07da2a), teju_literal2(0xd94ad8b1c7380874, 0x18375281ae7822bc) }, // -313
+  { teju_literal2(0x511bf4381ab43a40, 0xacd1bf9ae26cae88), teju_literal2(0xadd57a27d29339f6, 0x79c5db9af1f9b563) }, // -312
+  { teju_literal2(0xa749902ce229c833, 0xbd749948b523bed3), teju_literal2(0x8b112e86420f6191, 0xfb04afaf27faf782) }, // -311
+  { teju_literal2(0x0ba8e6ae36a94052, 0xc8ba8edabb6c6485), teju_literal2(0xde81e40a034bcf4f, 0xf8077f7ea65e58d1) }, // -310
+  { teju_literal2(0x6fba5224f88766a8, 0xa0953f1562bd1d37), teju_literal2(0xb201833b35d63f73, 0x2cd2cc6551e513da) }, // -309
+  { teju_literal2(0x5961db50c6d2b886, 0xe6ddcc111bca7dc6), teju_literal2(0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648) }, // -308
+  { teju_literal2(0xf5695ee7a4845a71, 0x7162e01b5faa62d6), teju_literal2(0xe3d8f9e563a198e5, 0x58180fddd97723a6) }, // -307
+  { teju_literal2(0x5dede5861d36aec1, 0x27824ce2b2eeb578), teju_literal2(0xb6472e511c81471d, 0xe0133fe4adf8e952) }, // -306
+  { teju_literal2(0xe4be5138175ef234, 0x1f9b70b55bf22ac6), teju_literal2(0x91d28b7416cdd27e, 0x4cdc331d57fa5441) }, // -305
+  { teju_literal2(0x6dfd4ec02564b6b9, 0xcc2be788931d113d), teju_literal2(0xe950df20247c83fd, 0x47c6b82ef32a2069) }, // -304
+  { teju_literal2(0xbe643f001dea2bc7, 0xd6898606dc1740fe), teju_literal2(0xbaa718e68396cffd, 0xd30560258f54e6ba) }, // -303
+  { teju_literal2(0x985032667e54efd3, 0x12079e6be345cd98), teju_literal2(0x95527a5202df0ccb, 0x0f37801e0c43ebc8) }, // -302
+  { teju_literal2(0x26e6b70a63bb1951, 0xb6729713053c7c26), teju_literal2(0xeeea5d5004981478, 0x1858ccfce06cac74) }, // -301
+  { teju_literal2(0x52522c084fc8e10e, 0x2b8edf426a96c9b8), teju_literal2(0xbf21e44003acdd2c, 0xe0470a63e6bd56c3) }, // -300
+  { teju_literal2(0x41db566d0ca0b40b, 0x560be5cebbabd493), teju_literal2(0x98e7e9cccfbd7dbd, 0x8038d51cb897789c) }, // -299
+  { teju_literal2(0x02f88a4814345345, 0x56796fb12c4620ec), teju_literal2(0xf4a642e14c6262c8, 0xcd27bb612758c0fa) }, // -298
+  { teju_literal2(0x02606ea01029dc37, 0x78612627569e80bd), teju_literal2(0xc3b8358109e84f07, 0x0a862f80ec4700c8) }, // -297
+  { teju_literal2(0x3519f219a687e35f, 0x9380eb52abb20097), teju_literal2(0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3) }, // -296
+  { teju_literal2(0xee8fe9c2a40c9eff, 0x5267deeaac5000f1), teju_literal2(0xfa856334878fc150, 0xb14f98f6f0feb951) }, // -295
+  { teju_literal2(0xf20cbb021cd6e599, 0x0eb97f22237333f4), teju_literal2(0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7) }, // -294
+  { teju_literal2(0xf4d6fc01b0abeae0, 0xd89465b4e928f65d), teju_literal2(0xa0555e361951c366, 0xd7e105bcc332621f) }, // -293
+  { teju_literal2(0x2a459667c08988b3, 0xe076b7c3edba5eb1), teju_literal2(0x80444b5e7aa7cf85, 0x7980d163cf5b81b3) }, // -292
+  { teju_literal2(0x76d5bd72cda8dab9, 0x672459397c5d644e), teju_literal2(0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb) }, // -291
+  { teju_literal2(0xf8aafdf57153e22d, 0xec1d142dfd178372), teju_literal2(0xa42e74f3d032f525, 0xba3e7ca8b77f5e55) }, // -290
+  { teju_literal2(0x2d5597f78ddcb4f1, 0x89b0dcf1974602c2), teju_literal2(0x83585d8fd9c25db7, 0xc831fd53c5ff7eab) }, // -289
+  { teju_literal2(0xe2228cbf49612182, 0x75e7c7e8f2099e02), teju_literal2(0xd226fc195c6a2f8c, 0x73832eec6fff3111) }, // -288
+  { teju_literal2(0xb4e870990780e79b, 0x918639872807b19b), teju_literal2(0xa81f301449ee8c70, 0x5c68f256bfff5a74) }, // -287
+  { teju_literal2(0x5d86c07a6c671faf, 0xa79e946c200627b0), teju_literal2(0x867f59a9d4bed6c0, 0x49ed8eabcccc485d) }, // -286
+  { teju_literal2(0x627133f713d832b2, 0xa5ca871366703f7f), teju_literal2(0xd732290fbacaf133, 0xa97c177947ad4095) }, // -285
+  { teju_literal2(0x4ec0f65f43135bc2, 0x1e3b9f42b859cc66), teju_literal2(0xac2820d9623bf429, 0x546345fa9fbdcd44) }, // -284
+  { teju_literal2(0x0bcd91e5cf42afce, 0x7e9619022d14a385), teju_literal2(0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d) }, // -283
+  { teju_literal2(0x4615b63c7ed1194a, 0x64235b36ae876c07), teju_literal2(0xdc5c5301c56b75f7, 0x7641a140cc7810fb) }, // -282
+  { teju_literal2(0x9e77c4fd3240e108, 0x501c48f88b9f899f), teju_literal2(0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62) }, // -281
+  { teju_literal2(0x7ec63730f500b406, 0xa67d072d3c7fa14c), teju_literal2(0x8d07e33455637eb2, 0xdb0b487b6423e1e8) }, // -280
+  { teju_literal2(0xfe09f1e7ee678671, 0x0a61a5152d990214), teju_literal2(0xe1a63853bbd26451, 0x5e7873f8a0396973) }, // -279
+  { teju_literal2(0x64d4c1865852d1f4, 0x084e1daa8ae0ce76), teju_literal2(0xb484f9dc9641e9da, 0xb1f9f660802dedf6) }, // -278
+  { teju_literal2(0x1d77013846a8a7f6, 0x6d0b4aeed580a52b), teju_literal2(0x906a617d450187e2, 0x27fb2b80668b24c5) }, // -277
+  { teju_literal2(0xfbf19b8d3ddaa657, 0x14dede4aef343b78), teju_literal2(0xe7109bfba19c0c9d, 0x0cc512670a783ad4) }, // -276
+  { teju_literal2(0xfcc1493dcb1551df, 0x43e57ea258f695fa), teju_literal2(0xb8da1662e7b00a17, 0x3d6a751f3b936243) }, // -275
+  { teju_literal2(0x309aa0fe3c110e4c, 0x3651321b7a5ede62), teju_literal2(0x93e1ab8252f33b45, 0xcabb90e5c942b503) }, // -274
+  { teju_literal2(0xb42a9b30601b4a13, 0x8a1b835f2a3163cf), teju_literal2(0xec9c459d51852ba2, 0xddf8e7d60ed1219e) }, // -273
+  { teju_literal2(0x902215c04ce2a1a9, 0x3b4935e5bb5ab640), teju_literal2(0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18) }, // -272
+  { teju_literal2(0xa681ab003d821aed, 0xc9075e5162aef833), teju_literal2(0x976e41088617ca01, 0xd5be0503e085d813) }, // -271
+  { teju_literal2(0x3d9c44cd2f36917c, 0x74d896e89de4c051), teju_literal2(0xf24a01a73cf2dccf, 0xbc633b39673c8cec) }, // -270
+  { teju_literal2(0x3149d0a425c54130, 0x5d7a1253b183cd0e), teju_literal2(0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0) }, // -269
+  { teju_literal2(0x8dd4a6e9b7d100f3, 0x7dfb41dc8e030a72), teju_literal2(0x9b10a4e5e9913128, 0xca7cf2b4191c8326) }, // -268
+  { teju_literal2(0x7c877175f2e80185, 0x965ecfc7499e771c), teju_literal2(0xf81aa16fdc1b81da, 0xdd94b7868e94050a) }, // -267
+  { teju_literal2(0x306c5ac4c253346a, 0xdeb23fd2a14b927d), teju_literal2(0xc67bb4597ce2ce48, 0xb143c6053edcd0d5) }, // -266
+  { teju_literal2(0x8d237bd09b75c388, 0xb228330ee76fa864), teju_literal2(0x9ec95d1463e8a506, 0xf4363804324a40aa) }, // -265
+  { teju_literal2(0xe1d25fb42bef9f41, 0x1d0d1e7e3f190d6c), teju_literal2(0xfe0efb53d30dd4d7, 0xed238cd383aa0110) }, // -264
+  { teju_literal2(0xe7db7fc356594c34, 0x173db1fe98e0d78a), teju_literal2(0xcb3f2f7642717713, 0x241c70a936219a73) }, // -263
+  { teju_literal2(0xecaf996911e109c3, 0x45caf4cbad80ac6f), teju_literal2(0xa298f2c501f45f42, 0x8349f3ba91b47b8f) }, // -262
+  { teju_literal2(0x23bfadeda7e73b02, 0x9e3bf709579a238c), teju_literal2(0x8213f56a67f6b29b, 0x9c3b29620e29fc73) }, // -261
+  { teju_literal2(0x05ff7caf730b919d, 0xc9f98b4225c36c12), teju_literal2(0xd01fef10a657842c, 0x2d2b7569b0432d85) }, // -260
+  { teju_literal2(0x37ff96f2c26fa7b1, 0x6e613c34eb02bcdc), teju_literal2(0xa67ff273b8460356, 0x8a892abaf368f137) }, // -259
+  { teju_literal2(0x5fffabf5685952f4, 0x584dc9c3ef3563e3), teju_literal2(0x8533285c936b35de, 0xd53a88958f87275f) }, // -258
+  { teju_literal2(0x6665dfef0d5bb7ed, 0x5a160f9fe522396b), teju_literal2(0xd51ea6fa85785631, 0x552a74227f3ea565) }, // -257
+  { teju_literal2(0x851e4cbf3de2f98a, 0xae780c7fea81c789), teju_literal2(0xaa7eebfb9df9de8d, 0xddbb901b98feeab7) }, // -256
+  { teju_literal2(0xd0e50a3297e8c7a2, 0x252cd6ccbb9b0607), teju_literal2(0x8865899617fb1871, 0x7e2fa67c7a658892) }, // -255
+  { teju_literal2(0x1b081050f30e0c36, 0xa1e157adf8f809a5), teju_literal2(0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e) }, // -254
+  { teju_literal2(0xaf39a6a728d809c5, 0x4e4ddfbe60c66e1e), teju_literal2(0xae9672aba3d0c320, 0xa184ac2473b529b1) }, // -253
+  { teju_literal2(0x25c7b885ba466e37, 0x71d7e631e70524e5), teju_literal2(0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e) }, // -252
+  { teju_literal2(0xa2d9273c5d3d7d25, 0x82f309e971a1d4a1), teju_literal2(0xdf78e4b2bd342cf6, 0x914da9246b255416) }, // -251
+  { teju_literal2(0x1be0ec304a979751, 0x358f3b2127b4aa1a), teju_literal2(0xb2c71d5bca9023f8, 0x743e20e9ef511012) }, // -250
+  { teju_literal2(0x7cb3f026a212df74, 0x2ad8fc1a862a21af), teju_literal2(0x8f05b1163ba6832d, 0x29cb4d87f2a7400e) }, // -249
+  { teju_literal2(0x611fe6a4368498b9, 0xde27f9c409dd02b1), teju_literal2(0xe4d5e82392a40515, 0x0fabaf3feaa5334a) }, // -248
+  { teju_literal2(0xe74cb8835ed07a2e, 0x4b532e366e4a688d), teju_literal2(0xb7118682dbb66a77, 0x3fbc8c33221dc2a1) }, // -247
+  { teju_literal2(0xb90a2d35e57394f1, 0xd5dc24f8583b86d8), teju_literal2(0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4) }, // -246
+  { teju_literal2(0xf4dd152308b8ee4f, 0xbc936e5a26c5a48c), teju_literal2(0xea53df5fd18d5513, 0x84c86189216dc5ed) }, // -245
+  { teju_literal2(0x90b0ddb5a093f1d9, 0x63a92514ebd15070), teju_literal2(0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1) }, // -244
+  { teju_literal2(0x0d5a4af7b3a98e47, 0x82edb743efdaa6c0), teju_literal2(0x95f83d0a1fb69cd9, 0x4abdaf101564f98e) }, // -243
+  { teju_literal2(0x155d44bf85dc16d8, 0xd17c586cb2f77133), teju_literal2(0xeff394dcff8a948e, 0xddfc4b4cef07f5b0) }, // -242
+  { teju_literal2(0x444a9d6604b01247, 0x0dfd138a28c5f429), teju_literal2(0xbff610b0cc6edd3f, 0x17fd090a58d32af3) }, // -241
+  { teju_literal2(0x036ee4519d59a838, 0xd7fda93b53d19021), teju_literal2(0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29) }, // -240
+  { teju_literal2(0x38b16d4f62290d27, 0xbffc41f8861c19ce), teju_literal2(0xf5b5d7ec8acb58a2, 0xae10af696774b1db) }, // -239
+  { teju_literal2(0x93c1243f81ba70ec, 0x99969b2d38167b0b), teju_literal2(0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2) }, // -238
+  { teju_literal2(0xdc9a83660161f3f0, 0x7adee28a93452f3c), teju_literal2(0x9d412e0806e88aa5, 0x8e1f289560ee864e) }, // -237
+  { teju_literal2(0x60f738a33569864d, 0x91649daa853b7ec7), teju_literal2(0xfb9b7cd9a4a7443c, 0x169840ef017da3b1) }, // -236
+  { teju_literal2(0x80c5c6e8f7879ea4, 0x74507e22042f989f), teju_literal2(0xc94930ae1d529cfc, 0xdee033f26797b627) }, // -235
+  { teju_literal2(0x9a37d253f9394bb6, 0xc373981b368c7a19), teju_literal2(0xa1075a24e4421730, 0xb24cf65b8612f81f) }, // -234
+  { teju_literal2(0x482ca8432dc76fc5, 0x6929467c2ba394e1), teju_literal2(0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019) }, // -233
+  { teju_literal2(0xd9e10d38493f193b, 0xdb753d937905bb01), teju_literal2(0xce1de40642e3f4b9, 0x36251260ab9d668e) }, // -232
+  { teju_literal2(0x14b40a936dcc142f, 0xe2c43142c737c8ce), teju_literal2(0xa4e4b66b68b65d60, 0xf81da84d5617853f) }, // -231
+  { teju_literal2(0x76f66edc57d6768c, 0xb569c10238f96d71), teju_literal2(0x83ea2b892091e44d, 0x934aed0aab460432) }, // -230
+  { teju_literal2(0xbe5717c6f2f0bdad, 0xef0f9b36c18f1582), teju_literal2(0xd31045a8341ca07c, 0x1ede48111209a050) }, // -229
+  { teju_literal2(0x6512796bf58d648b, 0x25a615c567a5aacf), teju_literal2(0xa8d9d1535ce3b396, 0x7f1839a741a14d0d) }, // -228
+  { teju_literal2(0x1da861232ad783a2, 0x8484de37861e223f), teju_literal2(0x8714a775e3e95c78, 0x65acfaec34810a71) }, // -227
+  { teju_literal2(0x95da35051158d29d, 0xa0d496bf3cfd0398), teju_literal2(0xd8210befd30efa5a, 0x3c47f7e05401aa4e) }, // -226
+  { teju_literal2(0xab14f7374113dbb1, 0x4d76deff63fd9c79), teju_literal2(0xace73cbfdc0bfb7b, 0x636cc64d1001550b) }, // -225
+  { teju_literal2(0xbc10c5c5cda97c8d, 0xd7924bff833149fb), teju_literal2(0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f) }, // -224
+  { teju_literal2(0x2ce7a2d615dbfa7c, 0x8c1d46659eb5432b), teju_literal2(0xdd50f1996b947518, 0xd12f124e28f77719) }, // -223
+  { teju_literal2(0x571fb578117cc863, 0xa34a9eb7b22a9c22), teju_literal2(0xb10d8e1456105dad, 0x7425a83e872c5f47) }, // -222
+  { teju_literal2(0xac195df9a79706b6, 0x1c3bb22c8e887ce8), teju_literal2(0x8da471a9de737e24, 0x5ceaecfed289e5d2) }, // -221
+  { teju_literal2(0xe028965c3f580abc, 0xf9f91d141740c7da), teju_literal2(0xe2a0b5dc971f303a, 0x2e44ae64840fd61d) }, // -220
+  { teju_literal2(0x19ba11e365e00897, 0x2e60e410129a397b), teju_literal2(0xb54d5e4a127f59c8, 0x2503beb6d00cab4b) }, // -219
+  { teju_literal2(0x7afb4182b7e66d45, 0xbeb3e9a675482dfc), teju_literal2(0x910ab1d4db9914a0, 0x1d9c9892400a22a2) }, // -218
+  { teju_literal2(0x2b2b9c045970aed5, 0xfdeca90a55404993), teju_literal2(0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437) }, // -217
+  { teju_literal2(0x88efb0037ac08bde, 0x64bd540844336e0f), teju_literal2(0xb9a74a0637ce2ee1, 0x6d953e2bd7173692) }, // -216
+  { teju_literal2(0x6d8c8ccf9566d64b, 0x83caa9a0368f8b40), teju_literal2(0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8) }, // -215
+  { teju_literal2(0xe27a7ae5bbd7bd45, 0x9faaa900574c11ff), teju_literal2(0xeda2ee1c7064130c, 0x1162def06f79df73) }, // -214
+  { teju_literal2(0xb52ec8b7c9796437, 0xb2eeed99df700e66), teju_literal2(0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c) }, // -213
+  { teju_literal2(0x2a8bd3c63ac7835f, 0xc258be14b2c00b85), teju_literal2(0x98165af37b2153de, 0xc3727a337a8b704a) }, // -212
+  { teju_literal2(0x77461fa3913f3899, 0x36f46354513345a1), teju_literal2(0xf356f7ebf83552fe, 0x0583f6b8c4124d43) }, // -211
+  { teju_literal2(0xf904e61c743293ad, 0xc5904f76a75c37b4), teju_literal2(0xc2abf989935ddbfe, 0x6acff893d00ea435) }, // -210
+  { teju_literal2(0x9403eb49f68edc8b, 0x047372c552b02c90), teju_literal2(0x9bbcc7a142b17ccb, 0x88a66076400bb691) }, // -209
+  { teju_literal2(0x866caba98a7e2dab, 0x3a52513bb780474d), teju_literal2(0xf92e0c3537826145, 0xa7709a56ccdf8a82) }, // -208
+  { teju_literal2(0x6b8a22ee0864f155, 0xc841da962c669f71), teju_literal2(0xc75809c42c684dd1, 0x52c07b78a3e60868) }, // -207
+  { teju_literal2(0xbc6e825806b72777, 0xd367e211bd1ee5f4), teju_literal2(0x9f79a169bd203e41, 0x0f0062c6e984d386) }, // -206
+  { teju_literal2(0x2d7d9d59a4583f26, 0x1f0c9ce92e97d652), teju_literal2(0xff290242c83396ce, 0x7e67047175a15271) }, // -205
+  { teju_literal2(0x24647de1504698eb, 0x4c0a1720f21311dc), teju_literal2(0xcc20ce9bd35c78a5, 0x31ec038df7b441f4) }, // -204
+  { teju_literal2(0x1d1d31810d054722, 0xa33b45b3f4dc0e49), teju_literal2(0xa34d721642b06084, 0x27f002d7f95d0190) }, // -203
+  { teju_literal2(0x4a7dc1340a6a9f4e, 0xe8fc37c32a49a508), teju_literal2(0x82a45b450226b39c, 0xecc0024661173473) }, // -202
+  { teju_literal2(0x10c9352010aa987e, 0x41938c6b76dc3b3f), teju_literal2(0xd106f86e69d785c7, 0xe13336d701beba52) }, // -201
+  { teju_literal2(0x40a0f74cda221398, 0x347609ef9249c8ff), teju_literal2(0xa738c6bebb12d16c, 0xb428f8ac016561db) }, // -200
+  { teju_literal2(0x0080c5d714e80fac, 0xf6c4d4bfa83b0733), teju_literal2(0x85c7056562757456, 0xf6872d5667844e49) }, // -199
+  { teju_literal2(0xcd9ad624ee401914, 0xbe07bacc405e71eb), teju_literal2(0xd60b3bd56a5586f1, 0x8a71e223d8d3b074) }, // -198
+  { teju_literal2(0xd7af11b725001410, 0x98062f09cd185b22), teju_literal2(0xab3c2fddeeaad25a, 0xd527e81cad7626c3) }, // -197
+  { teju_literal2(0x12f274928400100d, 0x466b58d4a4137c1b), teju_literal2(0x88fcf317f22241e2, 0x441fece3bdf81f03) }, // -196
+  { teju_literal2(0x84b720ea6ccce67b, 0xa3def4876cebf9c5), teju_literal2(0xdb2e51bfe9d0696a, 0x06997b05fcc0319e) }, // -195
+  { teju_literal2(0x03c5b3eebd70b862, 0xe97f2a05f0bcc7d1), teju_literal2(0xaf58416654a6babb, 0x387ac8d1970027b2) }, // -194
+  { teju_literal2(0x696af658978d604f, 0x21328804c0970641), teju_literal2(0x8c469ab843b89562, 0x93956d7478ccec8e) }, // -193
+  { teju_literal2(0x0f118a2758e233b1, 0xceb740079a8b3d34), teju_literal2(0xe070f78d3927556a, 0x85bbe253f47b1417) }, // -192
+  { teju_literal2(0x0c0e081f7a4e8fc1, 0x722c3339486f642a), teju_literal2(0xb38d92d760ec4455, 0x37c981dcc395a9ac) }, // -191
+  { teju_literal2(0xd671a0192ea53fcd, 0xf4f028faa0591cef), teju_literal2(0x8fa475791a569d10, 0xf96e017d694487bc) }, // -190
+  { teju_literal2(0xf0b5ccf5176ecc7c, 0xbb19db2a9a282e4a), teju_literal2(0xe5d3ef282a242e81, 0x8f1668c8a86da5fa) }, // -189
+  { teju_literal2(0x26f7d72a79257063, 0xc8e17c2214ecf1d5), teju_literal2(0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f) }, // -188
+  { teju_literal2(0x8593128860eac04f, 0xd3e79681aa5727de), teju_literal2(0x9316ff75dd87cbd8, 0x09a7f12442d588f2) }, // -187
+  { teju_literal2(0x6f51b7409b1133b2, 0xeca5bd9c43bea62f), teju_literal2(0xeb57ff22fc0c7959, 0xa90cb506d155a7ea) }, // -186
+  { teju_literal2(0xbf74929a15a75c8f, 0x23b7cae3696551c0), teju_literal2(0xbc4665b596706114, 0x873d5d9f0dde1fee) }, // -185
+  { teju_literal2(0x65f6dbae77b916d8, 0xe95fd582bab77499), teju_literal2(0x969eb7c47859e743, 0x9f644ae5a4b1b325) }, // -184
+  { teju_literal2(0x6ff15f7d8c5b57c1, 0x7566226ac458ba8f), teju_literal2(0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5) }, // -183
+  { teju_literal2(0xf3277f97a37c4634, 0x5deb4ebbd046fba5), teju_literal2(0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd) }, // -182
+  { teju_literal2(0x28ec6612e9303829, 0xe4bc3efca69f2fb8), teju_literal2(0x9a3c2087a63f6399, 0x36ac54e2f678864b) }, // -181
+  { teju_literal2(0x0e4709b7db8059dc, 0xa12d31943dcb7f8c), teju_literal2(0xf6c69a72a3989f5b, 0x8aad549e57273d45) }, // -180
+  { teju_literal2(0xd838d493160047e3, 0xb42427a9cb0932d6), teju_literal2(0xc56baec21c7a1916, 0x088aaa1845b8fdd0) }, // -179
+  { teju_literal2(0x1360aa0f44cd064f, 0xc3501fbb08d428ac), teju_literal2(0x9defbf01b061adab, 0x3a0888136afa64a7) }, // -178
+  { teju_literal2(0x8567767ed47b3d4c, 0x6bb365f80e204112), teju_literal2(0xfcb2cb35e702af78, 0x5cda735244c3d43e) }, // -177
+  { teju_literal2(0xd11f91ff10629770, 0x56291e600b4d00dc), teju_literal2(0xca28a291859bbf93, 0x7d7b8f7503cfdcfe) }, // -176
+  { teju_literal2(0x40e60e65a6b545f3, 0x7820e519a2a400b0), teju_literal2(0xa1ba1ba79e1632dc, 0x6462d92a69731732) }, // -175
+  { teju_literal2(0x00b80b84855dd18f, 0x934d8414821ccd59), teju_literal2(0x8161afb94b44f57d, 0x1d1be0eebac278f5) }, // -174
+  { teju_literal2(0x3459ac073bc94f4c, 0x1ee26ced9cfae228), teju_literal2(0xcf02b2c21207ef2e, 0x94f967e45e03f4bb) }, // -173
+  { teju_literal2(0xc37af005c96dd909, 0xb24ebd8ae3fbe820), teju_literal2(0xa59bc234db398c25, 0x43fab9837e699095) }, // -172
+  { teju_literal2(0x692f266b078b1407, 0xc1d897a24ffcb9b4), teju_literal2(0x847c9b5d7c2e09b7, 0x69956135febada11) }, // -171
+  { teju_literal2(0xa84b70ab3f44ecd9, 0x36275903b32df5ec), teju_literal2(0xd3fa922f2d1675f2, 0x42889b8997915ce8) }, // -170
+  { teju_literal2(0xb9d5f3bc329d8a47, 0x5e85e0cfc28b2b23), teju_literal2(0xa99541bf57452b28, 0x353a1607ac744a53) }, // -169
+  { teju_literal2(0xfb118fc9c217a1d2, 0xb204b3d9686f55b6), teju_literal2(0x87aa9aff79042286, 0x90fb44d2f05d0842) }, // -168
+  { teju_literal2(0xc4e8e60f9cf29c84, 0x50078628a7188923), teju_literal2(0xd910f7ff28069da4, 0x1b2ba1518094da04) }, // -167
+  { teju_literal2(0x3720b80c7d8ee39d, 0x0cd2d1ba1f46d41c), teju_literal2(0xada72ccc20054ae9, 0xaf561aa79a10ae6a) }, // -166
+  { teju_literal2(0xf8e6f9a397a582e4, 0x0a424161b29f1016), teju_literal2(0x8aec23d680043bee, 0x25de7bb9480d5854) }, // -165
+  { teju_literal2(0x27d7f5d28c3c04a0, 0x106a0235ea9819bd), teju_literal2(0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb) }, // -164
+  { teju_literal2(0xecacc4a8703003b3, 0x4054ce918879ae31), teju_literal2(0xb1d219647ae6b31c, 0x596eb2d8ae258fc8) }, // -163
+  { teju_literal2(0x23bd6a2059c002f5, 0xcd10a54139faf1c1), teju_literal2(0x8e41ade9fbebc27d, 0x14588f13be847307) }, // -162
+  { teju_literal2(0x6c624366f60004bc, 0x7b4dd535299182ce), teju_literal2(0xe39c49765fdf9d94, 0xed5a7e85fda0b80b) }, // -161
+  { teju_literal2(0x2381cf8591999d63, 0x95d7ddc421413572), teju_literal2(0xb616a12b7fe617aa, 0x577b986b314d6009) }, // -160
+  { teju_literal2(0x82ce3f9e0e147de9, 0x44acb169b4342ac1), teju_literal2(0x91abb422ccb812ee, 0xac62e055c10ab33a) }, // -159
+  { teju_literal2(0x9e16cc3016872fdb, 0xa1144f0f86b9de02), teju_literal2(0xe912b9d1478ceb17, 0x7a37cd5601aab85d) }, // -158
+  { teju_literal2(0x7e78a359ab9f597c, 0x80dd0c0c6bc7e4cf), teju_literal2(0xba756174393d88df, 0x94f971119aeef9e4) }, // -157
+  { teju_literal2(0x986082ae22e5e130, 0x67173cd6bc9fea3f), teju_literal2(0x952ab45cfa97a0b2, 0xdd945a747bf26183) }, // -156
+  { teju_literal2(0xf3cd9de36b09684d, 0x71bec7bdfa9976cb), teju_literal2(0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38) }, // -155
+  { teju_literal2(0x5ca47e4f88d45371, 0x27cbd2fe62145f09), teju_literal2(0xbeeefb584aff8603, 0xaafb550ffacfd8fa) }, // -154
+  { teju_literal2(0xe3b6cb72d3dd0f8d, 0xb96fdbfeb4dd18d4), teju_literal2(0x98bf2f79d5993802, 0xef2f773ffbd97a61) }, // -153
+  { teju_literal2(0x6c57abeaec94e5af, 0x8f195ffdee2e8e20), teju_literal2(0xf46518c2ef5b8cd1, 0x7eb258665fc25d69) }, // -152
+  { teju_literal2(0xbd12efef23aa5159, 0x3f477ffe58253e80), teju_literal2(0xc38413cf25e2d70d, 0xfef5138519684aba) }, // -151
+  { teju_literal2(0xca758cbf4fbb7447, 0x65d2cccb79b76533), teju_literal2(0x9c69a97284b578d7, 0xff2a760414536efb) }, // -150
+  { teju_literal2(0x43ef47987f9253a5, 0x6fb7ae125c58a1eb), teju_literal2(0xfa42a8b73abbf48c, 0xcb772339ba1f17f9) }, // -149
+  { teju_literal2(0x698c3946cc750fb7, 0x8c92f1a849e08189), teju_literal2(0xc83553c5c8965d3d, 0x6f92829494e5acc7) }, // -148
+  { teju_literal2(0x54702dd23d2a72f9, 0x3d425aed07e6ce07), teju_literal2(0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c) }, // -147
+  { teju_literal2(0xdd268b0e975528c7, 0x6435158a6cb8a4d3), teju_literal2(0x802221226be55a64, 0xc2494954da2c9789) }, // -146
+  { teju_literal2(0xc83dab4a8bbb7472, 0x39ee88dd7ac107b7), teju_literal2(0xcd036837130890a1, 0x36dba887c37a8c0f) }, // -145
+  { teju_literal2(0x39caef6ed62f905b, 0x618ba0b12f00d2f9), teju_literal2(0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6) }, // -144
+  { teju_literal2(0x2e3bf2bf11bfa6af, 0x813c808dbf33dbfb), teju_literal2(0x8335616aed761f1f, 0x7f44e6bd49e807b8) }, // -143
+  { teju_literal2(0xb05feacb4f990ab2, 0x6860cdaf9852f991), teju_literal2(0xd1ef0244af2364ff, 0x3207d795430cd926) }, // -142
+  { teju_literal2(0xf37fef090c7a6ef5, 0x204d715946a8c7a7), teju_literal2(0xa7f26836f282b732, 0x8e6cac7768d7141e) }, // -141
+  { teju_literal2(0x5c6658d409fb8bf7, 0x4d0ac1143887061f), teju_literal2(0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2) }, // -140
+  { teju_literal2(0xfa3d5aecdcc5acbe, 0xe1aace86c0d809cb), teju_literal2(0xd6f8d7509292d603, 0x45a9d2845d3c42b6) }, // -139
+  { teju_literal2(0x61caaf23e3d156ff, 0x1aef0b9f00acd4a3), teju_literal2(0xabfa45da0edbde69, 0x0487db9d17636892) }, // -138
+  { teju_literal2(0x4e3bbf4fe9744598, 0xe258d618cd571082), teju_literal2(0x899504ae72497eba, 0x6a06494a791c53a8) }, // -137
+  { teju_literal2(0xb05f987fdbed3c27, 0xd08e235ae224e737), teju_literal2(0xdc21a1171d42645d, 0x76707543f4fa1f73) }, // -136
+  { teju_literal2(0xc04c79ffe324301f, 0xda0b4f7be81d85c5), teju_literal2(0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f) }, // -135
+  { teju_literal2(0x99d6c7ffe8e9c019, 0x7b3c3f96534ad16b), teju_literal2(0x8ce2529e2734bb1d, 0x1899e4a65f58660c) }, // -134
+  { teju_literal2(0x8fbe0ccca7dc668f, 0x2b9398f085448244), teju_literal2(0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a) }, // -133
+  { teju_literal2(0xa631a3d6ecb0520c, 0x22dc7a5a0436ce9d), teju_literal2(0xb454e4a179dd1877, 0x29babe4598c311fb) }, // -132
+  { teju_literal2(0xb827b6458a26a809, 0xb57d2eae69c57217), teju_literal2(0x9043ea1ac7e41392, 0x87c89837ad68db2f) }, // -131
+  { teju_literal2(0xf372bd3c103dd9a9, 0x2261e44a42d58358), teju_literal2(0xe6d3102ad96cec1d, 0xa60dc059157491e5) }, // -130
+  { teju_literal2(0xc2c230fcd9cb1487, 0x4eb4b6a1cf1135e0), teju_literal2(0xb8a8d9bbe123f017, 0xb80b0047445d4184) }, // -129
+  { teju_literal2(0x0234f3fd7b08dd39, 0x0bc3c54e3f40f7e7), teju_literal2(0x93ba47c980e98cdf, 0xc66f336c36b10137) }, // -128
+  { teju_literal2(0x69ee532f2b4161f4, 0xdf9fa216cb9b263e), teju_literal2(0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe) }, // -127
+  { teju_literal2(0x54bea8f289011b2a, 0x4c7fb4df0948eb65), teju_literal2(0xbd176620a501fbff, 0xb650e5a93bc3d898) }, // -126
+  { teju_literal2(0x43cbba5ba0cdaf55, 0x09ffc3e5a10722b7), teju_literal2(0x9745eb4d50ce6332, 0xf840b7ba963646e0) }, // -125
+  { teju_literal2(0x0612c3c5ce15e554, 0xdccc6ca29b3e9df1), teju_literal2(0xf209787bb47d6b84, 0xc0678c5dbd23a49a) }, // -124
+  { teju_literal2(0x6b423637d8118443, 0xe3d6bd4ee2987e5b), teju_literal2(0xc1a12d2fc3978937, 0x0052d6b1641c83ae) }, // -123
+  { teju_literal2(0x55ce91c6467469cf, 0xe97897724ee06516), teju_literal2(0x9ae757596946075f, 0x3375788de9b06958) }, // -122
+  { teju_literal2(0xefb0e93d3d870fb3, 0x0f2758b6e49a3b55), teju_literal2(0xf7d88bc24209a565, 0x1f225a7ca91a4226) }, // -121
+  { teju_literal2(0xbfc0ba97646c0c8f, 0x3f52ad5f1d482f78), teju_literal2(0xc646d63501a1511d, 0xb281e1fd541501b8) }, // -120
+  { teju_literal2(0x33009545e9f00a0c, 0x32a88ab27dd3592d), teju_literal2(0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa) }, // -119
+  { teju_literal2(0xb800eed64319a9ad, 0x1dda7783fc855b7a), teju_literal2(0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6) }, // -118
+  { teju_literal2(0x6000bf11cf47baf0, 0xe4aec603306aaf95), teju_literal2(0xcb090c8001ab551c, 0x5cadf5bfd3072cc5) }, // -117
+  { teju_literal2(0xe666ff41729fc8c0, 0xb6f238028d222611), teju_literal2(0xa26da3999aef7749, 0xe3be5e330f38f09d) }, // -116
+  { teju_literal2(0x51ebff678ee63a33, 0xc58e93353db4eb41), teju_literal2(0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e) }, // -115
+  { teju_literal2(0xb64665727e3d29ec, 0x6f4a8521fc54ab9b), teju_literal2(0xcfe87f7cef46ff16, 0xe612641865679a63) }, // -114
+  { teju_literal2(0x91d1eac1fe9754bd, 0x25d5374e6376efaf), teju_literal2(0xa6539930bf6bff45, 0x84db8346b786151c) }, // -113
+  { teju_literal2(0x74a7ef0198791097, 0x51775f71e92bf2f3), teju_literal2(0x850fadc09923329e, 0x03e2cf6bc604ddb0) }, // -112
+  { teju_literal2(0x543fe4cf5a5b4dbe, 0xe8beff1ca8465184), teju_literal2(0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a) }, // -111
+  { teju_literal2(0x10331d72aeaf7165, 0x86ff327d536b746a), teju_literal2(0xaa51823e34a7eede, 0xbd4b46f0599fd415) }, // -110
+  { teju_literal2(0xa68f4ac225592784, 0x6bff5b9775ef9055), teju_literal2(0x884134fe908658b2, 0x3109058d147fdcdd) }, // -109
+  { teju_literal2(0xd74baad03bc1d8d3, 0xdffef8f2564c1a21), teju_literal2(0xda01ee641a708de9, 0xe80e6f4820cc9495) }, // -108
+  { teju_literal2(0x7909557363017a43, 0x1998c7284509ae81), teju_literal2(0xae67f1e9aec07187, 0xecd8590680a3aa11) }, // -107
+  { teju_literal2(0x60d4445c4f3461cf, 0x47ad6c20373af201), teju_literal2(0x8b865b215899f46c, 0xbd79e0d20082ee74) }, // -106
+  { teju_literal2(0x67ba06fa1853cfb2, 0x0c48ad00585e5001), teju_literal2(0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed) }, // -105
+  { teju_literal2(0x862e6bfb46a972f4, 0xd6a08a66ad184001), teju_literal2(0xb2977ee300c50fe7, 0x58edec91ec2cb657) }, // -104
+  { teju_literal2(0x6b5856629eedf590, 0xabb3a1ebbdad0001), teju_literal2(0x8edf98b59a373fec, 0x4724bd4189bd5eac) }, // -103
+  { teju_literal2(0x1226f09dcb1655b4, 0x45ec3645fc480001), teju_literal2(0xe498f455c38b997a, 0x0b6dfb9c0f956447) }, // -102
+  { teju_literal2(0x0e858d4b08deaaf6, 0x9e5691d196a00001), teju_literal2(0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c) }, // -101
+  { teju_literal2(0x72047108d3e55592, 0x1845417478800001), teju_literal2(0x924d692ca61be758, 0x593c2626705f9c56) }, // -100
+  { teju_literal2(0x833a4e74863bbc1c, 0xf3a20253f4000001), teju_literal2(0xea1575143cf97226, 0xf52d09d71a3293bd) }, // -99
+  { teju_literal2(0x9c2ea52a04fc967d, 0x8fb4cea990000001), teju_literal2(0xbb445da9ca61281f, 0x2a8a6e45ae8edc97) }, // -98
+  { teju_literal2(0xe35884219d96deca, 0xd95d722140000001), teju_literal2(0x95d04aee3b80ece5, 0xbba1f1d158724a12) }, // -97
+  { teju_literal2(0x388da035c8f16477, 0xc22f1d0200000001), teju_literal2(0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e) }, // -96
+  { teju_literal2(0x93a4802b07278393, 0x01bf4a6800000001), teju_literal2(0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e) }, // -95
+  { teju_literal2(0xa9506688d28602dc, 0x0165d52000000001), teju_literal2(0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb) }, // -94
+  { teju_literal2(0x0ee70a7484099e2c, 0xcf09550000000001), teju_literal2(0xf5746577930d6500, 0xca8f44ec7ee36479) }, // -93
+  { teju_literal2(0x0bec085d366e1823, 0xd8d4440000000001), teju_literal2(0xc45d1df942711d9a, 0x3ba5d0bd324f8394) }, // -92
+  { teju_literal2(0x6ff006b0f858134f, 0xe0a9d00000000001), teju_literal2(0x9d174b2dcec0e47b, 0x62eb0d64283f9c76) }, // -91
+  { teju_literal2(0xe64cd7818d59b87f, 0xcddc800000000001), teju_literal2(0xfb5878494ace3a5f, 0x04ab48a04065c723) }, // -90
+  { teju_literal2(0x850a46013de16066, 0x3e4a000000000001), teju_literal2(0xc913936dd571c84c, 0x03bc3a19cd1e38e9) }, // -89
+  { teju_literal2(0x373b6b34318119eb, 0x6508000000000001), teju_literal2(0xa0dc75f1778e39d6, 0x696361ae3db1c721) }, // -88
+  { teju_literal2(0x2c2f88f68e00e189, 0x1da0000000000001), teju_literal2(0x80b05e5ac60b6178, 0x544f8158315b05b4) }, // -87
+  { teju_literal2(0xad18db241667cf41, 0xc900000000000001), teju_literal2(0xcde6fd5e09abcf26, 0xed4c0226b55e6f86) }, // -86
+  { teju_literal2(0x8a7a48e9ab863f67, 0xd400000000000001), teju_literal2(0xa4b8cab1a1563f52, 0x577001b891185938) }, // -85
+  { teju_literal2(0x0861d3ee22d1cc53, 0x1000000000000001), teju_literal2(0x83c7088e1aab65db, 0x792667c6da79e0fa) }, // -84
+  { teju_literal2(0x0d6953169e1c7a1e, 0x8000000000000001), teju_literal2(0xd2d80db02aabd62b, 0xf50a3fa490c30190) }, // -83
+  { teju_literal2(0xd78775abb1b061b2, 0x0000000000000001), teju_literal2(0xa8acd7c0222311bc, 0xc40832ea0d68ce0c) }, // -82
+  { teju_literal2(0xdf9f915627c04e28, 0x0000000000000001), teju_literal2(0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3) }, // -81
+  { teju_literal2(0x3298e889d933b040, 0x0000000000000001), teju_literal2(0xd7e77a8f87daf7fb, 0xdc33745ec97be906) }, // -80
+  { teju_literal2(0xf547206e475c8d00, 0x0000000000000001), teju_literal2(0xacb92ed9397bf996, 0x49c2c37f07965404) }, // -79
+  { teju_literal2(0x2a9f4d2505e3a400, 0x0000000000000001), teju_literal2(0x8a2dbf142dfcc7ab, 0x6e3569326c784337) }, // -78
+  { teju_literal2(0xaa987b6e6fd2a000, 0x0000000000000001), teju_literal2(0xdd15fe86affad912, 0x49ef0eb713f39ebe) }, // -77
+  { teju_literal2(0xbbad2f8b8ca88000, 0x0000000000000001), teju_literal2(0xb0de65388cc8ada8, 0x3b25a55f43294bcb) }, // -76
+  { teju_literal2(0xfc8a8c6fa3ba0000, 0x0000000000000001), teju_literal2(0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2) }, // -75
+  { teju_literal2(0x9410e0b29f900000, 0x0000000000000001), teju_literal2(0xe264589a4dcdab14, 0xc696963c7eed2dd1) }, // -74
+  { teju_literal2(0x4340b3c219400000, 0x0000000000000001), teju_literal2(0xb51d13aea4a488dd, 0x6babab6398bdbe41) }, // -73
+  { teju_literal2(0xcf66f634e1000000, 0x0000000000000001), teju_literal2(0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd) }, // -72
+  { teju_literal2(0x18a4bd2168000000, 0x0000000000000001), teju_literal2(0xe7d34c64a9c85d44, 0x60dbbca87196b616) }, // -71
+  { teju_literal2(0xe083ca8120000000, 0x0000000000000001), teju_literal2(0xb975d6b6ee39e436, 0xb3e2fd538e122b44) }, // -70
+  { teju_literal2(0x4d363b9a80000000, 0x0000000000000001), teju_literal2(0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a) }, // -69
+  { teju_literal2(0x4856c5c400000000, 0x0000000000000001), teju_literal2(0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd) }, // -68
+  { teju_literal2(0x6d1237d000000000, 0x0000000000000001), teju_literal2(0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317) }, // -67
+  { teju_literal2(0x5741c64000000000, 0x0000000000000001), teju_literal2(0x97edd871cfda3a56, 0x97758bf0e3cbb5ac) }, // -66
+  { teju_literal2(0x25360a0000000000, 0x0000000000000001), teju_literal2(0xf316271c7fc3908a, 0x8bef464e3945ef7a) }, // -65
+  { teju_literal2(0x50f8080000000000, 0x0000000000000001), teju_literal2(0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb) }, // -64
+  { teju_literal2(0x73f9a00000000000, 0x0000000000000001), teju_literal2(0x9b934c3b330c8577, 0x63cc55f49f88eb2f) }, // -63
+  { teju_literal2(0x5329000000000000, 0x0000000000000001), teju_literal2(0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2) }, // -62
+  { teju_literal2(0x0f54000000000000, 0x0000000000000001), teju_literal2(0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5) }, // -61
+  { teju_literal2(0xd910000000000000, 0x0000000000000001), teju_literal2(0x9f4f2726179a2245, 0x01d762422c946590) }, // -60
+  { teju_literal2(0x8e80000000000000, 0x0000000000000001), teju_literal2(0xfee50b7025c36a08, 0x02f236d04753d5b4) }, // -59
+  { teju_literal2(0x7200000000000000, 0x0000000000000001), teju_literal2(0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490) }, // -58
+  { teju_literal2(0x2800000000000000, 0x0000000000000001), teju_literal2(0xa321f2d7226895c7, 0xaff72d52192b6a0d) }, // -57
+  { teju_literal2(0x2000000000000000, 0x0000000000000001), teju_literal2(0x82818f1281ed449f, 0xbff8f10e7a8921a4) }, // -56
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d) }, // -55
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xa70c3c40a64e6c51, 0x999090b65f67d924) }, // -54
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x85a36366eb71f041, 0x47a6da2b7f864750) }, // -53
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xd5d238a4abe98068, 0x72a4904598d6d880) }, // -52
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xab0e93b6efee0053, 0x8eea0d047a457a00) }, // -51
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x88d8762bf324cd0f, 0xa5880a69fb6ac800) }, // -50
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xdaf3f04651d47b4c, 0x3c0cdd765f114000) }, // -49
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xaf298d050e4395d6, 0x9670b12b7f410000) }, // -48
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x8c213d9da502de45, 0x4526f422cc340000) }, // -47
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xe0352f62a19e306e, 0xd50b2037ad200000) }, // -46
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xb35dbf821ae4f38b, 0xdda2802c8a800000) }, // -45
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x8f7e32ce7bea5c6f, 0xe4820023a2000000) }, // -44
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xe596b7b0c643c719, 0x6d9ccd05d0000000) }, // -43
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xb7abc627050305ad, 0xf14a3d9e40000000) }, // -42
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x92efd1b8d0cf37be, 0x5aa1cae500000000) }, // -41
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xeb194f8e1ae525fd, 0x5dcfab0800000000) }, // -40
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xbc143fa4e250eb31, 0x17d955a000000000) }, // -39
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x96769950b50d88f4, 0x1314448000000000) }, // -38
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xf0bdc21abb48db20, 0x1e86d40000000000) }, // -37
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xc097ce7bc90715b3, 0x4b9f100000000000) }, // -36
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9a130b963a6c115c, 0x3c7f400000000000) }, // -35
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xf684df56c3e01bc6, 0xc732000000000000) }, // -34
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xc5371912364ce305, 0x6c28000000000000) }, // -33
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9dc5ada82b70b59d, 0xf020000000000000) }, // -32
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xfc6f7c4045812296, 0x4d00000000000000) }, // -31
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xc9f2c9cd04674ede, 0xa400000000000000) }, // -30
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xa18f07d736b90be5, 0x5000000000000000) }, // -29
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x813f3978f8940984, 0x4000000000000000) }, // -28
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xcecb8f27f4200f3a, 0x0000000000000000) }, // -27
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xa56fa5b99019a5c8, 0x0000000000000000) }, // -26
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x84595161401484a0, 0x0000000000000000) }, // -25
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xd3c21bcecceda100, 0x0000000000000000) }, // -24
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xa968163f0a57b400, 0x0000000000000000) }, // -23
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x878678326eac9000, 0x0000000000000000) }, // -22
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xd8d726b7177a8000, 0x0000000000000000) }, // -21
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xad78ebc5ac620000, 0x0000000000000000) }, // -20
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x8ac7230489e80000, 0x0000000000000000) }, // -19
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xde0b6b3a76400000, 0x0000000000000000) }, // -18
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xb1a2bc2ec5000000, 0x0000000000000000) }, // -17
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x8e1bc9bf04000000, 0x0000000000000000) }, // -16
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xe35fa931a0000000, 0x0000000000000000) }, // -15
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xb5e620f480000000, 0x0000000000000000) }, // -14
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9184e72a00000000, 0x0000000000000000) }, // -13
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xe8d4a51000000000, 0x0000000000000000) }, // -12
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xba43b74000000000, 0x0000000000000000) }, // -11
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9502f90000000000, 0x0000000000000000) }, // -10
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xee6b280000000000, 0x0000000000000000) }, // -9
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xbebc200000000000, 0x0000000000000000) }, // -8
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9896800000000000, 0x0000000000000000) }, // -7
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xf424000000000000, 0x0000000000000000) }, // -6
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xc350000000000000, 0x0000000000000000) }, // -5
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x9c40000000000000, 0x0000000000000000) }, // -4
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xfa00000000000000, 0x0000000000000000) }, // -3
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xc800000000000000, 0x0000000000000000) }, // -2
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xa000000000000000, 0x0000000000000000) }, // -1
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0x8000000000000000, 0x0000000000000000) }, // 0
+  { teju_literal2(0xcccccccccccccccc, 0xcccccccccccccccd), teju_literal2(0xcccccccccccccccc, 0xcccccccccccccccc) }, // 1
+  { teju_literal2(0xd70a3d70a3d70a3d, 0x70a3d70a3d70a3d8), teju_literal2(0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a3) }, // 2
+  { teju_literal2(0x78d4fdf3b645a1ca, 0xc083126e978d4fe0), teju_literal2(0x83126e978d4fdf3b, 0x645a1cac083126e9) }, // 3
+  { teju_literal2(0xc154c985f06f6944, 0x67381d7dbf487fcc), teju_literal2(0xd1b71758e219652b, 0xd3c36113404ea4a8) }, // 4
+  { teju_literal2(0xcddd6e04c0592103, 0x85c67dfe32a0663d), teju_literal2(0xa7c5ac471b478423, 0x0fcf80dc33721d53) }, // 5
+  { teju_literal2(0xd7e45803cd141a69, 0x37d1fe64f54d1e97), teju_literal2(0x8637bd05af6c69b5, 0xa63f9a49c2c1b10f) }, // 6
+  { teju_literal2(0x8ca08cd2e1b9c3db, 0x8c8330a1887b6425), teju_literal2(0xd6bf94d5e57a42bc, 0x3d32907604691b4c) }, // 7
+  { teju_literal2(0x3d4d3d758161697c, 0x7068f3b46d2f8351), teju_literal2(0xabcc77118461cefc, 0xfdc20d2b36ba7c3d) }, // 8
+  { teju_literal2(0xfdd7645e011abac9, 0xf387295d242602a7), teju_literal2(0x89705f4136b4a597, 0x31680a88f8953030) }, // 9
+  { teju_literal2(0x2fbf06fcce912adc, 0xb8d8422ea03cd10b), teju_literal2(0xdbe6fecebdedd5be, 0xb573440e5a884d1b) }, // 10
+  { teju_literal2(0xf2ff38ca3eda88b0, 0x93e034f219ca40d6), teju_literal2(0xafebff0bcb24aafe, 0xf78f69a51539d748) }, // 11
+  { teju_literal2(0xf598fa3b657ba08d, 0x4319c3f4e16e9a45), teju_literal2(0x8cbccc096f5088cb, 0xf93f87b7442e45d3) }, // 12
+  { teju_literal2(0x88f4c3923bf900e2, 0x04f606549be42a07), teju_literal2(0xe12e13424bb40e13, 0x2865a5f206b06fb9) }, // 13
+  { teju_literal2(0x6d909c74fcc733e8, 0x03f805107cb68806), teju_literal2(0xb424dc35095cd80f, 0x538484c19ef38c94) }, // 14
+  { teju_literal2(0x57a6e390ca38f653, 0x3660040d3092066b), teju_literal2(0x901d7cf73ab0acd9, 0x0f9d37014bf60a10) }, // 15
+  { teju_literal2(0xbf716c1add27f085, 0x23ccd3484db670ab), teju_literal2(0xe69594bec44de15b, 0x4c2ebe687989a9b3) }, // 16
+  { teju_literal2(0xff8df0157db98d37, 0x4fd70f6d0af85a23), teju_literal2(0xb877aa3236a4b449, 0x09befeb9fad487c2) }, // 17
+  { teju_literal2(0x32d7f344649470f9, 0x0cac0c573bf9e1b6), teju_literal2(0x9392ee8e921d5d07, 0x3aff322e62439fcf) }, // 18
+  { teju_literal2(0x1e2652070753e7f4, 0xe11346f1f98fcf89), teju_literal2(0xec1e4a7db69561a5, 0x2b31e9e3d06c32e5) }, // 19
+  { teju_literal2(0x181ea8059f76532a, 0x4da9058e613fd93a), teju_literal2(0xbce5086492111aea, 0x88f4bb1ca6bcf584) }, // 20
+  { teju_literal2(0x467eecd14c5ea8ee, 0xa48737a51a997a95), teju_literal2(0x971da05074da7bee, 0xd3f6fc16ebca5e03) }, // 21
+  { teju_literal2(0x70cb148213caa7e4, 0x3a71f2a1c428c421), teju_literal2(0xf1c90080baf72cb1, 0x5324c68b12dd6338) }, // 22
+  { teju_literal2(0x8d6f439b43088650, 0x2ec18ee7d0209ce8), teju_literal2(0xc16d9a0095928a27, 0x75b7053c0f178293) }, // 23
+  { teju_literal2(0xd78c3615cf3a050c, 0xf23472530ce6e3ed), teju_literal2(0x9abe14cd44753b52, 0xc4926a9672793542) }, // 24
+  { teju_literal2(0x8c1389bc7ec33b47, 0xe9ed83b814a49fe1), teju_literal2(0xf79687aed3eec551, 0x3a83ddbd83f52204) }, // 25
+  { teju_literal2(0x3cdc6e306568fc39, 0x87f1362cdd507fe7), teju_literal2(0xc612062576589dda, 0x95364afe032a819d) }, // 26
+  { teju_literal2(0xca49f1c05120c9c7, 0x9ff42b5717739986), teju_literal2(0x9e74d1b791e07e48, 0x775ea264cf55347d) }, // 27
+  { teju_literal2(0x76dcb60081ce0fa5, 0xccb9def1bf1f5c09), teju_literal2(0xfd87b5f28300ca0d, 0x8bca9d6e188853fc) }, // 28
+  { teju_literal2(0x5f16f80067d80c84, 0xa3c7e58e327f7cd4), teju_literal2(0xcad2f7f5359a3b3e, 0x096ee45813a04330) }, // 29
+  { teju_literal2(0x18df2ccd1fe00a03, 0xb6398471c1ff9710), teju_literal2(0xa2425ff75e14fc31, 0xa1258379a94d028d) }, // 30
+  { teju_literal2(0x4718f0a419800802, 0xf82e038e34cc78da), teju_literal2(0x81ceb32c4b43fcf4, 0x80eacf948770ced7) }, // 31
+  { teju_literal2(0x0b5b1aa028ccd99e, 0x59e338e387ad8e29), teju_literal2(0xcfb11ead453994ba, 0x67de18eda5814af2) }, // 32
+  { teju_literal2(0x6f7c154ced70ae18, 0x47e8fa4f9fbe0b54), teju_literal2(0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e) }, // 33
+  { teju_literal2(0xbf967770bdf3be79, 0xd320c83fb2fe6f76), teju_literal2(0x84ec3c97da624ab4, 0xbd5af13bef0b113e) }, // 34
+  { teju_literal2(0x65bd8be79652ca5c, 0x85014065eb30b257), teju_literal2(0xd4ad2dbfc3d07787, 0x955e4ec64b44e864) }, // 35
+  { teju_literal2(0xeafe098611dbd516, 0xd0cdcd1e55c08eac), teju_literal2(0xaa242499697392d2, 0xdde50bd1d5d0b9e9) }, // 36
+  { teju_literal2(0xbbfe6e04db164412, 0x40a4a418449a0bbd), teju_literal2(0x881cea14545c7575, 0x7e50d64177da2e54) }, // 37
+  { teju_literal2(0x2cca49a15e8a0683, 0x9aa1068d3a9012c8), teju_literal2(0xd9c7dced53c72255, 0x96e7bd358c904a21) }, // 38
+  { teju_literal2(0x8a3b6e1ab2080536, 0x154d9ed7620cdbd3), teju_literal2(0xae397d8aa96c1b77, 0xabec975e0a0d081a) }, // 39
+  { teju_literal2(0x3b62be7bc1a0042b, 0x443e18ac4e70afdc), teju_literal2(0x8b61313bbabce2c6, 0x2323ac4b3b3da015) }, // 40
+  { teju_literal2(0x5f0463f935ccd378, 0x6d30277a171ab2f9), teju_literal2(0xdf01e85f912e37a3, 0x6b6c46dec52f6688) }, // 41
+  { teju_literal2(0x7f36b660f7d70f93, 0x8a8cec61ac155bfb), teju_literal2(0xb267ed1940f1c61c, 0x55f038b237591ed3) }, // 42
+  { teju_literal2(0xcc2bc51a5fdf3fa9, 0x3ba3f04e23444996), teju_literal2(0x8eb98a7a9a5b04e3, 0x77f3608e92adb242) }, // 43
+  { teju_literal2(0xe046082a32fecc41, 0xf9064d49d206dc22), teju_literal2(0xe45c10c42a2b3b05, 0x8cb89a7db77c506a) }, // 44
+  { teju_literal2(0x4d04d354f598a367, 0xfa6b7107db38b01b), teju_literal2(0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22) }, // 45
+  { teju_literal2(0x3d9d75dd9146e91f, 0xfb8927397c2d59b0), teju_literal2(0x9226712162ab070d, 0xcab3961304ca70e8) }, // 46
+  { teju_literal2(0xc8fbefc8e87174ff, 0xf8db71f5937bc2b2), teju_literal2(0xe9d71b689dde71af, 0xaab8f01e6e10b4a6) }, // 47
+  { teju_literal2(0x3a63263a538df733, 0x2d7c5b2adc630228), teju_literal2(0xbb127c53b17ec159, 0x5560c018580d5d52) }, // 48
+  { teju_literal2(0x2eb5b82ea93e5f5c, 0x24637c2249e8ce87), teju_literal2(0x95a8637627989aad, 0xdde7001379a44aa8) }, // 49
+  { teju_literal2(0x4abc59e441fd6560, 0x3a38c69d430e173e), teju_literal2(0xef73d256a5c0f77c, 0x963e66858f6d4440) }, // 50
+  { teju_literal2(0x6efd14b69b311de6, 0x94fa387dcf3e78fe), teju_literal2(0xbf8fdb78849a5f96, 0xde98520472bdd033) }, // 51
+  { teju_literal2(0x259743c548f417eb, 0xaa61c6cb0c31fa65), teju_literal2(0x993fe2c6d07b7fab, 0xe546a8038efe4029) }, // 52
+  { teju_literal2(0x3c25393ba7ecf312, 0xaa360ade79e990a2), teju_literal2(0xf53304714d9265df, 0xd53dd99f4b3066a8) }, // 53
+  { teju_literal2(0x96842dc95323f5a8, 0x882b3be52e5473b5), teju_literal2(0xc428d05aa4751e4c, 0xaa97e14c3c26b886) }, // 54
+  { teju_literal2(0xab9cf16ddc1cc486, 0xd355c98425105c91), teju_literal2(0x9ced737bb6c4183d, 0x55464dd69685606b) }, // 55
+  { teju_literal2(0xac2e4f162cfad40a, 0xebbc75a03b4d60e7), teju_literal2(0xfb158592be068d2e, 0xeed6e2f0f0d56712) }, // 56
+  { teju_literal2(0x568b727823fbdcd5, 0x8963914cfc3de71f), teju_literal2(0xc8de047564d20a8b, 0xf245825a5a445275) }, // 57
+  { teju_literal2(0x453c5b934ffcb0aa, 0xd44fa770c9cb1f4c), teju_literal2(0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4) }, // 58
+  { teju_literal2(0x37637c75d996f3bb, 0xdd0c85f3d4a27f70), teju_literal2(0x808e17555f3ebf11, 0xe2bbd88bbee40bd0) }, // 59
+  { teju_literal2(0x256bfa5628f185f9, 0x61ada31fba9d98b3), teju_literal2(0xcdb02555653131b6, 0x3792f412cb06794d) }, // 60
+  { teju_literal2(0x51232eab53f46b2d, 0xe7be1c196217ad5c), teju_literal2(0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7) }, // 61
+  { teju_literal2(0x40e8f222a99055be, 0x52fe7ce11b46244a), teju_literal2(0x83a3eeeef9153e89, 0x1953cf68300424ac) }, // 62
+  { teju_literal2(0x34a7e9d10f4d55fd, 0x51972e34f8703a10), teju_literal2(0xd29fe4b18e88640e, 0x8eec7f0d19a03aad) }, // 63
+  { teju_literal2(0x2a1fee40d90aab31, 0x0e128b5d938cfb40), teju_literal2(0xa87fea27a539e9a5, 0x3f2398d747b36224) }, // 64
+  { teju_literal2(0xbb4cbe9a473bbc27, 0x3e753c4adc70c900), teju_literal2(0x86ccbb52ea94baea, 0x98e947129fc2b4e9) }, // 65
+  { teju_literal2(0x9214642a0b92c6a5, 0x30bb93aafa4e0e66), teju_literal2(0xd7adf884aa879177, 0x5b0ed81dcc6abb0f) }, // 66
+  { teju_literal2(0xa8105021a2dbd21d, 0xc0960fbbfb71a51f), teju_literal2(0xac8b2d36eed2dac5, 0xe272467e3d222f3f) }, // 67
+  { teju_literal2(0xb9a6a6814f1641b1, 0x66de72fcc927b74c), teju_literal2(0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff) }, // 68
+  { teju_literal2(0xf5d770cee4f0691b, 0xd7ca5194750c5879), teju_literal2(0xdcdb1b2798182244, 0xf8e431456cf88e65) }, // 69
+  { teju_literal2(0x9179270bea59edaf, 0xdfd50e105da379fa), teju_literal2(0xb0af48ec79ace837, 0x2d835a9df0c6d851) }, // 70
+  { teju_literal2(0x0dfa85a321e18af3, 0x19773e737e1c6195), teju_literal2(0x8d590723948a535f, 0x579c487e5a38ad0e) }, // 71
+  { teju_literal2(0x165da29e9c9c1184, 0xf58b971f302d68ef), teju_literal2(0xe2280b6c20dd5232, 0x25c6da63c38de1b0) }, // 72
+  { teju_literal2(0x4517b54bb07cdad0, 0xc46fac18f3578725), teju_literal2(0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3) }, // 73
+  { teju_literal2(0x9dac910959fd7bda, 0x36bfbce0c2ac6c1e), teju_literal2(0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2) }, // 74
+  { teju_literal2(0x2f7a81a88ffbf95d, 0x2465fb01377a4696), teju_literal2(0xe7958cb87392c2c2, 0xb60b1d1230b20e04) }, // 75
+  { teju_literal2(0xbf953486d9966117, 0x5051959a92c83878), teju_literal2(0xb94470938fa89bce, 0xf808e40e8d5b3e69) }, // 76
+  { teju_literal2(0x6610f6d247ab80df, 0x737477aedbd36060), teju_literal2(0x9436c0760c86e30b, 0xf9a0b6720aaf6521) }, // 77
+  { teju_literal2(0xa34e57b6d91267cb, 0xebed8c4af95233cd), teju_literal2(0xed246723473e3813, 0x290123e9aab23b68) }, // 78
+  { teju_literal2(0x82a512f8ada85309, 0x898ad6a2610e8fd7), teju_literal2(0xbdb6b8e905cb600f, 0x5400e987bbc1c920) }, // 79
+  { teju_literal2(0x021da8c6f15375a1, 0x3ad57881e73ed979), teju_literal2(0x97c560ba6b0919a5, 0xdccd879fc967d41a) }, // 80
+  { teju_literal2(0x3695dad7e8858901, 0xf7bbf4030b97c25b), teju_literal2(0xf2d56790ab41c2a2, 0xfae27299423fb9c3) }, // 81
+  { teju_literal2(0xf877e246539e0734, 0xc62ff668d61301e2), teju_literal2(0xc24452da229b021b, 0xfbe85badce996168) }, // 82
+  { teju_literal2(0x605fe83842e4d290, 0x9e8cc520ab4267e8), teju_literal2(0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba) }, // 83
+  { teju_literal2(0x33cca6c06b07b74d, 0xca7ad5011203d974), teju_literal2(0xf8a95fcf88747d94, 0x75a44c6397ce912a) }, // 84
+  { teju_literal2(0x5ca3b899ef395f71, 0x6ec8aa67419cadf6), teju_literal2(0xc6ede63fa05d3143, 0x91503d1c79720dbb) }, // 85
+  { teju_literal2(0x16e9607b25c77f8d, 0xf23a21ec347d57f8), teju_literal2(0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9) }, // 86
+  { teju_literal2(0x24a89a5ea2d8cc16, 0x505d0313872ef327), teju_literal2(0xfea126b7d78186bc, 0xe2f610c84987bfa8) }, // 87
+  { teju_literal2(0xb6ed484bb57a3cde, 0xa6b0cf42d28bf5b9), teju_literal2(0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9) }, // 88
+  { teju_literal2(0xf8bdd36fc461ca4b, 0xb88d729bdba32afa), teju_literal2(0xa2f67f2dfa90563b, 0x728900802f0f32fa) }, // 89
+  { teju_literal2(0xc6fe42bfd04e3b6f, 0xc6d78ee3161c2262), teju_literal2(0x825ecc24c873782f, 0x8ed400668c0c28c8) }, // 90
+  { teju_literal2(0xa4ca04661a16c57f, 0xa48c17d1bcf9d09c), teju_literal2(0xd097ad07a71f26b2, 0x7e2000a41346a7a7) }, // 91
+  { teju_literal2(0xea3b36b814df0466, 0x1d3cdfdafd94a6e3), teju_literal2(0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952) }, // 92
+  { teju_literal2(0xee95c56010b269eb, 0x4a97197bfe108583), teju_literal2(0x857fcae62d8493a5, 0x6f70a4400c562ddb) }, // 93
+  { teju_literal2(0xe422d566811d7645, 0x4424f593301a6f38), teju_literal2(0xd59944a37c0752a2, 0x4be76d3346f0495f) }, // 94
+  { teju_literal2(0x834f111ecdb12b6a, 0x9cea5e0f59aebf60), teju_literal2(0xaae103b5fcd2a881, 0xd652bdc29f26a119) }, // 95
+  { teju_literal2(0x690c0db23e2755ee, 0xe3eeb1a5e1589919), teju_literal2(0x88b402f7fd75539b, 0x11dbcb0218ebb414) }, // 96
+  { teju_literal2(0x74e015e9fd0bbcb1, 0x6cb11c3c9bc0f4f5), teju_literal2(0xdab99e59958885c4, 0xe95fab368e45eced) }, // 97
+  { teju_literal2(0x2a4cde54ca6fca27, 0x8a2749ca1633f72b), teju_literal2(0xaefae51477a06b03, 0xede622920b6b23f1) }, // 98
+  { teju_literal2(0x883d7eaa3b8ca1b9, 0x3b52a16e78299289), teju_literal2(0x8bfbea76c619ef36, 0x57eb4edb3c55b65a) }, // 99
+  { teju_literal2(0x40626443927a9c5b, 0x921dcf1726a8ea74), teju_literal2(0xdff9772470297ebd, 0x59787e2b93bc56f7) }, // 100
+  { teju_literal2(0x004eb69c752ee37c, 0x74e4a5ac1eed885d), teju_literal2(0xb32df8e9f3546564, 0x47939822dc96abf9) }, // 101
+  { teju_literal2(0x99d89216c42582c9, 0xf71d51567f246d17), teju_literal2(0x8f57fa54c2a9eab6, 0x9fa946824a12232d) }, // 102
+  { teju_literal2(0xc2f41cf139d59e0f, 0xf1c88223fea0ae8b), teju_literal2(0xe55990879ddcaabd, 0xcc420a6a101d0515) }, // 103
+  { teju_literal2(0x9bf67d8dc7de180c, 0xc16d34e998808ba3), teju_literal2(0xb77ada0617e3bbcb, 0x09ce6ebb40173744) }, // 104
+  { teju_literal2(0x4991fe0b064b4670, 0x9abdc3ee139a094f), teju_literal2(0x92c8ae6b464fc96f, 0x3b0b8bc90012929d) }, // 105
+  { teju_literal2(0xdc1cc9ab3d453d80, 0xf7960649b8f6754b), teju_literal2(0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e) }, // 106
+  { teju_literal2(0xe34a3aef64376467, 0x2c780507c72b9109), teju_literal2(0xbbe226efb628afea, 0x890489f70a55368b) }, // 107
+  { teju_literal2(0xe9082f25e9c5e9ec, 0x239337396c22da6e), teju_literal2(0x964e858c91ba2655, 0x3a6a07f8d510f86f) }, // 108
+  { teju_literal2(0xa80d183ca93ca979, 0xd2852528ad0490af), teju_literal2(0xf07da27a82c37088, 0x5d767327bb4e5a4c) }, // 109
+  { teju_literal2(0xecd74696edca212e, 0x42041dba2403a6f3), teju_literal2(0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6) }, // 110
+  { teju_literal2(0x8a45d21257d4e758, 0x34d017c81ccfb8c2), teju_literal2(0x99ea0196163fa42e, 0x504bced1bf8e4e45) }, // 111
+  { teju_literal2(0xaa09501d5954a559, 0xee19bfa6947f8e03), teju_literal2(0xf64335bcf065d37d, 0x4d4617b5ff4a16d5) }, // 112
+  { teju_literal2(0x54d440177aaa1de1, 0x8b47cc8543993e69), teju_literal2(0xc5029163f384a931, 0x0a9e795e65d4df11) }, // 113
+  { teju_literal2(0xdd7699ac6221b181, 0x3c39706a9c7a9854), teju_literal2(0x9d9ba7832936edc0, 0xd54b944b84aa4c0d) }, // 114
+  { teju_literal2(0xfbf0f5e09d02b59b, 0x938f1a442d90f3b9), teju_literal2(0xfc2c3f3841f17c67, 0xbbac2078d443ace2) }, // 115
+  { teju_literal2(0x965a5e4d4a689149, 0x42d8e1d02473f62e), teju_literal2(0xc9bcff6034c13052, 0xfc89b393dd02f0b5) }, // 116
+  { teju_literal2(0xab7b7ea43b86daa1, 0x02471b0ce9f65e8b), teju_literal2(0xa163ff802a3426a8, 0xca07c2dcb0cf26f7) }, // 117
+  { teju_literal2(0xbc62cbb696057bb4, 0x01d27c0a54c51870), teju_literal2(0x811ccc668829b887, 0x0806357d5a3f525f) }, // 118
+  { teju_literal2(0xc7047924233bf920, 0x02ea601087a1c0b2), teju_literal2(0xce947a3da6a9273e, 0x733d226229feea32) }, // 119
+  { teju_literal2(0x9f36c7501c2ffa80, 0x025519a6d2e7cd5b), teju_literal2(0xa54394fe1eedb8fe, 0xc2974eb4ee658828) }, // 120
+  { teju_literal2(0x18f89f7349bffb99, 0x9b7747b8a8b97116), teju_literal2(0x843610cb4bf160cb, 0xcedf722a585139ba) }, // 121
+  { teju_literal2(0x5b27658542ccc5c2, 0x925872c10df581bd), teju_literal2(0xd389b47879823479, 0x4aff1d108d4ec2c3) }, // 122
+  { teju_literal2(0x7c1f846a9bd7049b, 0xa846c2340b2ace31), teju_literal2(0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf) }, // 123
+  { teju_literal2(0xc9b2d0554978d07c, 0x869f01c33c223e8d), teju_literal2(0x87625f056c7c4a8b, 0x11471cd764ad4972) }, // 124
+  { teju_literal2(0xa91e1a220f27b3fa, 0x70fe69386036ca7c), teju_literal2(0xd89d64d57a607744, 0xe871c7bf077ba8b7) }, // 125
+  { teju_literal2(0x20e4e1b4d8ec8ffb, 0x8d98542d19c56ec9), teju_literal2(0xad4ab7112eb3929d, 0x86c16c98d2c953c6) }, // 126
+  { teju_literal2(0x4d83e7c3e0bd3ffc, 0x7146a9bdae378bd4), teju_literal2(0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b) }, // 127
+  { teju_literal2(0xe26ca6063461fffa, 0x4ed775fc49f27953), teju_literal2(0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde) }, // 128
+  { teju_literal2(0x4ebd519e904e6661, 0xd8ac5e636e5b9443), teju_literal2(0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2) }, // 129
+  { teju_literal2(0xd897747ed9d851e7, 0xe089e51c58494369), teju_literal2(0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1) }, // 130
+  { teju_literal2(0x5a8bed97c2f3b63f, 0xcda96e93c07538a7), teju_literal2(0xe3231912d5bf60e6, 0x10e1fff697ed6c69) }, // 131
+  { teju_literal2(0xaed657ac9bf62b66, 0x3e212543005dc6ec), teju_literal2(0xb5b5ada8aaff80b8, 0x0d819992132456ba) }, // 132
+  { teju_literal2(0xf24512f07cc4ef84, 0xfe80ea9c004b058a), teju_literal2(0x915e2486ef32cd60, 0x0ace1474dc1d122e) }, // 133
+  { teju_literal2(0xea081e4d946e4c07, 0xfd9b10f99a11a276), teju_literal2(0xe896a0d7e51e1566, 0x77b020baf9c81d17) }, // 134
+  { teju_literal2(0x21a0183e10583cd3, 0x3148da61480e1b92), teju_literal2(0xba121a4650e4ddeb, 0x92f34d62616ce413) }, // 135
+  { teju_literal2(0x1ae679cb4046970f, 0x5aa0aeb439a4e2db), teju_literal2(0x94db483840b717ef, 0xa8c2a44eb4571cdc) }, // 136
+  { teju_literal2(0xf7d7294533a424e5, 0x5dcde4538f6e37c5), teju_literal2(0xee2ba6c0678b597f, 0x746aa07ded582e2c) }, // 137
+  { teju_literal2(0xf978edd0f61cea51, 0x17d7e9dc72be9304), teju_literal2(0xbe89523386091465, 0xf6bbb397f1135823) }, // 138
+  { teju_literal2(0xc793f173f81721da, 0x797987e38efedc03), teju_literal2(0x986ddb5c6b3a76b7, 0xf89629465a75e01c) }, // 139
+  { teju_literal2(0xd8ecb58659be9c90, 0xc25c0c9f4b316005), teju_literal2(0xf3e2f893dec3f126, 0x5a89dba3c3efccfa) }, // 140
+  { teju_literal2(0x4723c46b7afee3a7, 0x01e33d4c3c278004), teju_literal2(0xc31bfa0fe5698db8, 0x486e494fcff30a62) }, // 141
+  { teju_literal2(0x9f4fd055fbff1c85, 0x9b1c3109c9b93336), teju_literal2(0x9c1661a651213e2d, 0x06bea10ca65c084e) }, // 142
+  { teju_literal2(0xfee61a232ccb60d5, 0xc4f9e80fa92851f0), teju_literal2(0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0) }, // 143
+  { teju_literal2(0xcbeb481c23d5e711, 0x6a618672edb9db27), teju_literal2(0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0) }, // 144
+  { teju_literal2(0xd655d349b644b8da, 0xbb81385bf1617c1f), teju_literal2(0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633) }, // 145
+  { teju_literal2(0xf089520f8a078e2a, 0xc59b8d5fe89bf9cb), teju_literal2(0xffbbcfe994e5c61f, 0xfdf17746497f7052) }, // 146
+  { teju_literal2(0xc06ddb3fa19fa4ef, 0x047c711986e32e3c), teju_literal2(0xcc963fee10b7d1b3, 0x318df905079926a8) }, // 147
+  { teju_literal2(0x338b15cc814c83f2, 0x69fd27479f1c24fd), teju_literal2(0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba) }, // 148
+  { teju_literal2(0x5c6f44a39aa39cc1, 0xee641f6c7f49b731), teju_literal2(0x82ef85133de648c4, 0x9a984d73dbe722fb) }, // 149
+  { teju_literal2(0x60b2076c2a9f6136, 0x4a39cbe0cba9251b), teju_literal2(0xd17f3b51fca3a7a0, 0xf75a15862ca504c5) }, // 150
+  { teju_literal2(0x4d5b3923554c4dc5, 0x082e3cb3d620ea7c), teju_literal2(0xa798fc4196e952e7, 0x2c48113823b73704) }, // 151
+  { teju_literal2(0xa448fa82aaa3716a, 0x6cf1ca29781a5530), teju_literal2(0x8613fd0145877585, 0xbd06742ce95f5f36) }, // 152
+  { teju_literal2(0xd3a7f737776be8aa, 0x47e943758cf6eeb3), teju_literal2(0xd686619ba27255a2, 0xc80a537b0efefebd) }, // 153
+  { teju_literal2(0xa9532c2c5f8986ee, 0x9fedcf913d92588f), teju_literal2(0xab9eb47c81f5114f, 0x066ea92f3f326564) }, // 154
+  { teju_literal2(0xbaa8f0237fa138be, 0xe657d940fe0ead40), teju_literal2(0x894bc396ce5da772, 0x6b8bba8c328eb783) }, // 155
+  { teju_literal2(0x2aa7e69f329b8dfe, 0x3d595b9b30177b99), teju_literal2(0xdbac6c247d62a583, 0xdf45f746b74abf39) }, // 156
+  { teju_literal2(0x88865218f5493e64, 0xfde11615c012c947), teju_literal2(0xafbd2350644eeacf, 0xe5d1929ef90898fa) }, // 157
+  { teju_literal2(0xa06b74e0c43a9850, 0xcb1a781166756dd2), teju_literal2(0x8c974f7383725573, 0x1e414218c73a13fb) }, // 158
+  { teju_literal2(0x33df2167a05dc081, 0x44f726823d88afb7), teju_literal2(0xe0f218b8d25088b8, 0x306869c13ec3532c) }, // 159
+  { teju_literal2(0x8fe5b452e6b166cd, 0xd0c5b868313a262c), teju_literal2(0xb3f4e093db73a093, 0x59ed216765690f56) }, // 160
+  { teju_literal2(0xa6515d0f1ef4523e, 0x409e2d202761b823), teju_literal2(0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab) }, // 161
+  { teju_literal2(0xa3b561b1cb208396, 0xcdc9e1cd0bcf8d05), teju_literal2(0xe65829b3046b0afa, 0x0cb4a5a3112a5112) }, // 162
+  { teju_literal2(0x1c911af4a2806945, 0x716e4e3da30c70d1), teju_literal2(0xb84687c269ef3bfb, 0x3d5d514f40eea742) }, // 163
+  { teju_literal2(0xe3a748c3b533876a, 0xc1250b6482705a41), teju_literal2(0x936b9fcebb25c995, 0xcab10dd900beec34) }, // 164
+  { teju_literal2(0x6c3edad2bb85a577, 0x9b6e78a0d0b3c39b), teju_literal2(0xebdf661791d60f56, 0x111b495b3464ad21) }, // 165
+  { teju_literal2(0x89cbe2422f9e1df9, 0x49252d4d73c302e2), teju_literal2(0xbcb2b812db11a5de, 0x7415d448f6b6f0e7) }, // 166
+  { teju_literal2(0x3b0981ce8c7e7e61, 0x0750f10ac30268b5), teju_literal2(0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9) }, // 167
+  { teju_literal2(0xf80f36174730ca34, 0xd88181aad19d7455), teju_literal2(0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1) }, // 168
+  { teju_literal2(0x933f5e7905c0a1c3, 0xe0679aef0e179044), teju_literal2(0xc13a148e3032d6e7, 0xe36a52363c1faf01) }, // 169
+  { teju_literal2(0x0f65e52d9e33b49c, 0xb386158c0b460d03), teju_literal2(0x9a94dd3e8cf578b9, 0x82bb74f8301958ce) }, // 170
+  { teju_literal2(0xe56fd515c9ec542d, 0xec09bc13453ce19e), teju_literal2(0xf7549530e188c128, 0xd12bee59e68ef47c) }, // 171
+  { teju_literal2(0x84597744a189dcf1, 0x89a163429dca4e18), teju_literal2(0xc5dd44271ad3cdba, 0x40eff1e1853f29fd) }, // 172
+  { teju_literal2(0x037ac5d0813b1727, 0xa14de90217d50b47), teju_literal2(0x9e4a9cec15763e2e, 0x9a598e4e043287fe) }, // 173
+  { teju_literal2(0x38c46fb401f8250c, 0x354974d02621aba4), teju_literal2(0xfd442e4688bd304a, 0x908f4a166d1da663) }, // 174
+  { teju_literal2(0x2d69f2f667f9b73c, 0xf76df70ceb4e22ea), teju_literal2(0xca9cf1d206fdc03b, 0xa6d90811f0e4851c) }, // 175
+  { teju_literal2(0xf1218f2b86615f63, 0xf924c5a3ef71b588), teju_literal2(0xa21727db38cb002f, 0xb8ada00e5a506a7c) }, // 176
+  { teju_literal2(0xc0e7a5bc6b81191c, 0xc7509e1cbf8e2ad3), teju_literal2(0x81ac1fe293d599bf, 0xc6f14cd848405530) }, // 177
+  { teju_literal2(0x67d9092d78ce8e94, 0x721a969465b04485), teju_literal2(0xcf79cc9db955c2cc, 0x7182148d4066eeb4) }, // 178
+  { teju_literal2(0x5314075793d87210, 0x5b487876b7c036d1), teju_literal2(0xa5fb0a17c777cf09, 0xf468107100525890) }, // 179
+  { teju_literal2(0x75a99f7943138e73, 0x7c39f9f893002bda), teju_literal2(0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073) }, // 180
+  { teju_literal2(0x22a8ff286b527d85, 0x938ff65a84cd12f7), teju_literal2(0xd47487cc8470652b, 0x7647c3200069671f) }, // 181
+  { teju_literal2(0x1bba65b9ef753137, 0xa93ff8486a3da8c5), teju_literal2(0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c) }, // 182
+  { teju_literal2(0x7c951e2e592a8dc6, 0x20fff9d3883153d1), teju_literal2(0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6) }, // 183
+  { teju_literal2(0x2dbb637d5b77493d, 0x01998fb8d9e8861b), teju_literal2(0xd98ddaee19068c76, 0x3badd624dd9b0957) }, // 184
+  { teju_literal2(0xbe2f82caaf92a0fd, 0x9ae13fc714ba04e3), teju_literal2(0xae0b158b4738705e, 0x9624ab50b148d445) }, // 185
+  { teju_literal2(0x9826023bbfa880ca, 0xe24dcc9f43c803e9), teju_literal2(0x8b3c113c38f9f37e, 0xde83bc408dd3dd04) }, // 186
+  { teju_literal2(0x26a336c5ff740144, 0x9d49476539400641), teju_literal2(0xdec681f9f4c31f31, 0x6405fa00e2ec94d4) }, // 187
+  { teju_literal2(0x521c2bd199299a9d, 0x4aa105ea94333834), teju_literal2(0xb23867fb2a35b28d, 0xe99e619a4f23aa43) }, // 188
+  { teju_literal2(0x41b0230e1421487d, 0xd54d9e55435c2cf6), teju_literal2(0x8e938662882af53e, 0x547eb47b7282ee9c) }, // 189
+  { teju_literal2(0x9c4d04e3536873fc, 0x887c30886bc6ae57), teju_literal2(0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93) }, // 190
+  { teju_literal2(0xe370d0b5dc538ffd, 0x39fcf3a056388b79), teju_literal2(0xb67f6455292cbf08, 0x1a3bc84c17b1d542) }, // 191
+  { teju_literal2(0x1c5a40917d0fa664, 0x2e63f619de93a2c7), teju_literal2(0x91ff83775423cc06, 0x7b6306a34627ddcf) }, // 192
+  { teju_literal2(0x6090674f2e7f70a0, 0x4a3989c2fdb90471), teju_literal2(0xe998d258869facd7, 0x2bd1a438703fc94b) }, // 193
+  { teju_literal2(0x1a0d1f728b9926e6, 0xa1c7a168cafa69f4), teju_literal2(0xbae0a846d2195712, 0x8974836059cca109) }, // 194
+  { teju_literal2(0xe1a419286fadb8b8, 0x816c8120a261ee5d), teju_literal2(0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0) }, // 195
+  { teju_literal2(0x9c39c1da4c49278d, 0x9be0ce9a9d697d62), teju_literal2(0xef340a98172aace4, 0x86fb897116c87c34) }, // 196
+  { teju_literal2(0x49c7ce483d0752d7, 0xafe70baee454644e), teju_literal2(0xbf5cd54678eef0b6, 0xd262d45a78a0635d) }, // 197
+  { teju_literal2(0xa16ca50697390f12, 0xf31f3c8be9dd1d0c), teju_literal2(0x991711052d8bf3c5, 0x751bdd152d4d1c4a) }, // 198
+  { teju_literal2(0x357aa1a42528181e, 0x51cb94130fc82e79), teju_literal2(0xf4f1b4d515acb93b, 0xee92fb5515482d44) }, // 199
+  { teju_literal2(0xf7954e1cea8679b1, 0xdb09434273068b94), teju_literal2(0xc3f490aa77bd60fc, 0xbedbfc4411068a9c) }, // 200
+  { teju_literal2(0xc6110b4a5538615b, 0x15a1029b8f386faa), teju_literal2(0x9cc3a6eec6311a63, 0xcbe3303674053bb0) }, // 201
+  { teju_literal2(0x3ce81210885a355e, 0x89019dc5b1f3e5dc), teju_literal2(0xfad2a4b13d1b5d6c, 0x796b805720085f81) }, // 202
+  { teju_literal2(0xca5341a6d37b5de5, 0x3a67b16af4c31e49), teju_literal2(0xc8a883c0fdaf7df0, 0x6122cd128006b2cd) }, // 203
+  { teju_literal2(0xa1dc348575fc4b1d, 0xc852f455909c183b), teju_literal2(0xa086cfcd97bf97f3, 0x80e8a40eccd228a4) }, // 204
+  { teju_literal2(0xe7e35d379196a27e, 0x39dbf6aada1679c9), teju_literal2(0x806bd9714632dff6, 0x00ba1cd8a3db53b6) }, // 205
+  { teju_literal2(0x0c9efb8c1c243730, 0x5c9324449023f60e), teju_literal2(0xcd795be870516656, 0x67902e276c921f8b) }, // 206
+  { teju_literal2(0xd6e59609b01cf8f3, 0x7d42836a0ce991a5), teju_literal2(0xa46116538d0deb78, 0x52d9be85f074e608) }, // 207
+  { teju_literal2(0x78b7ab3af34a60c2, 0xca9b9c54d7214151), teju_literal2(0x8380dea93da4bc60, 0x4247cb9e59f71e6d) }, // 208
+  { teju_literal2(0xf45911f7ebaa346a, 0xddc5c6ee2502021a), teju_literal2(0xd267caa862a12d66, 0xd072df63c324fd7b) }, // 209
+  { teju_literal2(0xc37a74c65621c388, 0xb16b058b50ce6815), teju_literal2(0xa8530886b54dbdeb, 0xd9f57f830283fdfc) }, // 210
+  { teju_literal2(0x02c85d6b781b02d3, 0xc1226ad5da3eb9ab), teju_literal2(0x86a8d39ef77164bc, 0xae5dff9c02033197) }, // 211
+  { teju_literal2(0x37a6fbdf26919e1f, 0x9b6a44895d312911), teju_literal2(0xd77485cb25823ac7, 0x7d633293366b828b) }, // 212
+  { teju_literal2(0xc61f2fe5b8747e7f, 0xaf8836d44a8dba74), teju_literal2(0xac5d37d5b79b6239, 0x311c2875c522ced5) }, // 213
+  { teju_literal2(0x9e7f598493906532, 0xf2d35f103ba4952a), teju_literal2(0x89e42caaf9491b60, 0xf41686c49db57244) }, // 214
+  { teju_literal2(0xfd988f3a85b3d51e, 0x515231b392a0eea9), teju_literal2(0xdca04777f541c567, 0xecf0d7a0fc5583a0) }, // 215
+  { teju_literal2(0xfe13a5c86af64418, 0x410e8e29421a5887), teju_literal2(0xb080392cc4349dec, 0xbd8d794d96aacfb3) }, // 216
+  { teju_literal2(0xcb42eb06bbf83679, 0xcda53e876815139f), teju_literal2(0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c) }, // 217
+  { teju_literal2(0x786b11a45ff38a5c, 0x7c3b973f0cee85cb), teju_literal2(0xe1ebce4dc7f16dfb, 0xd3e8495912c62894) }, // 218
+  { teju_literal2(0xf9ef41504cc2d516, 0xc9c945cc0a586b09), teju_literal2(0xb4bca50b065abe63, 0x0fed077a756b53a9) }, // 219
+  { teju_literal2(0x94bf6773709bddab, 0xd4a104a33b79ef3b), teju_literal2(0x9096ea6f3848984f, 0x3ff0d2c85def7621) }, // 220
+  { teju_literal2(0x546572524dc62f79, 0x5434d4385f297ec4), teju_literal2(0xe757dd7ec07426e5, 0x331aeada2fe589cf) }, // 221
+  { teju_literal2(0x76b78ea83e3825fa, 0xa9c3dcf9e5bacbd0), teju_literal2(0xb913179899f68584, 0x28e2557b59846e3f) }, // 222
+  { teju_literal2(0x2bc60bb9cb601e62, 0x21697d94b7c8a30d), teju_literal2(0x940f4613ae5ed136, 0x871b7795e136be99) }, // 223
+  { teju_literal2(0x4609ac5c7899ca36, 0x9bdbfc21260dd1ae), teju_literal2(0xece53cec4a314ebd, 0xa4f8bf5635246428) }, // 224
+  { teju_literal2(0x6b3af049fa14a1c5, 0x497cc9b41e71748b), teju_literal2(0xbd8430bd08277231, 0x50c6ff782a838353) }, // 225
+  { teju_literal2(0xbc2f26a194dd4e37, 0x6dfd6e29b1f45d3c), teju_literal2(0x979cf3ca6cec5b5a, 0xa705992ceecf9c42) }, // 226
+  { teju_literal2(0xf9e50a9c216216bf, 0x166249dc4fed61fa), teju_literal2(0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d) }, // 227
+  { teju_literal2(0xc7ea6ee34de81232, 0x784ea17d0cbde7fb), teju_literal2(0xc21094364dfb5636, 0x985915fc12f542e4) }, // 228
+  { teju_literal2(0x6cbb8be90b200e8e, 0xc6a54dfda3cb1ffc), teju_literal2(0x9b407691d7fc44f8, 0x79e0de63425dcf1d) }, // 229
+  { teju_literal2(0x47927974de99b0e4, 0x71087cc90611ccc7), teju_literal2(0xf867241c8cc6d4c0, 0xc30163d203c94b62) }, // 230
+  { teju_literal2(0x6c752df7187af3e9, 0xf406ca3a6b41709f), teju_literal2(0xc6b8e9b0709f109a, 0x359ab6419ca1091b) }, // 231
+  { teju_literal2(0x89f757f8e0625cbb, 0x299f082ebc345a19), teju_literal2(0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf) }, // 232
+  { teju_literal2(0x0ff2265b009d612b, 0x75cb404ac6ba29c1), teju_literal2(0xfe5d54150b090b02, 0xd3f93b35435d7c4c) }, // 233
+  { teju_literal2(0xa65b51e266e44dbc, 0x5e3c336f0561bb01), teju_literal2(0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09) }, // 234
+  { teju_literal2(0x1eaf74b51f1d0afd, 0x183029259de7c8ce), teju_literal2(0xa2cb1717b52481ed, 0x54768c4b0c64ca6e) }, // 235
+  { teju_literal2(0x188c5d5db27da264, 0x1359ba847e53070b), teju_literal2(0x823c12795db6ce57, 0x76c53d08d6b70858) }, // 236
+  { teju_literal2(0x8dad622f83fc3706, 0x855c5da0ca1e71ab), teju_literal2(0xd0601d8efc57b08b, 0xf13b94daf124da26) }, // 237
+  { teju_literal2(0xd7bde82603302c05, 0x377d17b3d4e527bc), teju_literal2(0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e) }, // 238
+  { teju_literal2(0x12fe53519c26899d, 0xc5fdac8fdd841fca), teju_literal2(0x855c3be0a17fcd26, 0x5cf2eea09a55067f) }, // 239
+  { teju_literal2(0xeb30854f603da8fc, 0x6ffc474c95a032dc), teju_literal2(0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64) }, // 240
+  { teju_literal2(0xef5a043f803153fd, 0x26636c3d448028b0), teju_literal2(0xaab37fd7d8f58178, 0xc8e5087ba6d33b83) }, // 241
+  { teju_literal2(0x25e19cff99c10ffd, 0xb84f89ca9d3353c0), teju_literal2(0x888f99797a5e012d, 0x6d8406c952429603) }, // 242
+  { teju_literal2(0xa30294cc2934e662, 0xc07f42ddc8521f9a), teju_literal2(0xda7f5bf590966848, 0xaf39a475506a899e) }, // 243
+  { teju_literal2(0x82687709ba90b84f, 0x0065cf17d374e615), teju_literal2(0xaecc49914078536d, 0x58fae9f773886e18) }, // 244
+  { teju_literal2(0x6853926e2eda2d0c, 0x0051727975f71e77), teju_literal2(0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0) }, // 245
+  { teju_literal2(0x4085b716b15d14e0, 0x008250c2565830be), teju_literal2(0xdfbdcece67006ac9, 0x67a791e093e1d49a) }, // 246
+  { teju_literal2(0x006af8def44a7719, 0x9a01da3511e026ff), teju_literal2(0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15) }, // 247
+  { teju_literal2(0xcd2260b25d085f47, 0xae67e1c40e4cebff), teju_literal2(0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810) }, // 248
+  { teju_literal2(0xe1d09ab6fb409872, 0xb0a636067d47dffe), teju_literal2(0xe51c79a85916f484, 0x82b7e12780e7401a) }, // 249
+  { teju_literal2(0xe7da155f2f66e05b, 0xc084f80531064ccb), teju_literal2(0xb749faed14125d36, 0xcef980ec671f667b) }, // 250
+  { teju_literal2(0x86481118f2b8b37c, 0x9a03f99dc0d1d709), teju_literal2(0x92a1958a7675175f, 0x0bfacd89ec191ec9) }, // 251
+  { teju_literal2(0x0a0ce827eac11f2d, 0xc3398f62ce1c8b42), teju_literal2(0xea9c227723ee8bcb, 0x465e15a979c1cadc) }, // 252
+  { teju_literal2(0x6e70b9b9889a7f57, 0xcf613f823e7d3c35), teju_literal2(0xbbb01b9283253ca2, 0x9eb1aaedfb016f16) }, // 253
+  { teju_literal2(0xbec094946d4865df, 0xd91a9934feca9691), teju_literal2(0x96267c7535b763b5, 0x4bc1558b2f3458de) }, // 254
+  { teju_literal2(0xcacdba871540a2ff, 0xc1c42854caddbdb4), teju_literal2(0xf03d93eebc589f88, 0x793555ab7eba27ca) }, // 255
+  { teju_literal2(0xa23e2ed27766e8cc, 0x9b03537708b16490), teju_literal2(0xc0314325637a1939, 0xfa911155fefb5308) }, // 256
+  { teju_literal2(0x4e9825752c5253d6, 0xe2690f926d5ab6da), teju_literal2(0x99c102844f94e0fb, 0x2eda7444cbfc426d) }, // 257
+  { teju_literal2(0x7dc03beead508624, 0x9d74e5b7155df15c), teju_literal2(0xf6019da07f549b2b, 0x7e2a53a146606a48) }, // 258
+  { teju_literal2(0x97ccfcbef10d381d, 0x4ac3eaf8dde4c116), teju_literal2(0xc4ce17b399107c22, 0xcb550fb4384d21d3) }, // 259
+  { teju_literal2(0x463d96ff273dc67d, 0xd56988c717ea3412), teju_literal2(0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9) }, // 260
+  { teju_literal2(0x70628b31d862d72f, 0xbbdc0e0b5976b9b6), teju_literal2(0xfbe9141915d7a922, 0x4bf1ff9f0062baa8) }, // 261
+  { teju_literal2(0x59e86f5b138245bf, 0xc97cd809145efaf8), teju_literal2(0xc987434744ac874e, 0xa327ffb266b56220) }, // 262
+  { teju_literal2(0x47ed25e27601d166, 0x3aca466da9e59594), teju_literal2(0xa139029f6a239f72, 0x1c1fffc1ebc44e80) }, // 263
+  { teju_literal2(0xd3241e4ec4ce411e, 0x956e9ebe218477a9), teju_literal2(0x80fa687f881c7f8e, 0x7ce66634bc9d0b99) }, // 264
+  { teju_literal2(0xb839ca17a14a01ca, 0x88b0fdfd026d8c42), teju_literal2(0xce5d73ff402d98e3, 0xfb0a3d212dc8128f) }, // 265
+  { teju_literal2(0xf9c7d4dfb43b34a2, 0x06f3fe6401f13d02), teju_literal2(0xa5178fff668ae0b6, 0x626e974dbe39a872) }, // 266
+  { teju_literal2(0x616caa4c902f5d4e, 0x6bf6651cce5a9735), teju_literal2(0x8412d9991ed58091, 0xe858790afe9486c2) }, // 267
+  { teju_literal2(0xcf1443adb37efbb0, 0xacbd6e947d5dbeba), teju_literal2(0xd3515c2831559a83, 0x0d5a5b44ca873e03) }, // 268
+  { teju_literal2(0x3f436957c2cbfc8d, 0x56fdf210644afefb), teju_literal2(0xa90de3535aaae202, 0x711515d0a205cb36) }, // 269
+  { teju_literal2(0xcc35eddfcf0996d7, 0x78cb280d1d08cbfc), teju_literal2(0x873e4f75e2224e68, 0x5a7744a6e804a291) }, // 270
+  { teju_literal2(0xe0564966180f57bf, 0x27ab73482e747994), teju_literal2(0xd863b256369d4a40, 0x90bed43e40076a82) }, // 271
+  { teju_literal2(0x19dea11e79a5dfcc, 0x1fbc5c39bec39476), teju_literal2(0xad1c8eab5ee43b66, 0xda3243650005eecf) }, // 272
+  { teju_literal2(0x7b1880e52e1e4ca3, 0x4c96b02e3236105f), teju_literal2(0x8a7d3eef7f1cfc52, 0x482835ea666b2572) }, // 273
+  { teju_literal2(0xf82734a1e363add2, 0x14244d16b6bce6fe), teju_literal2(0xdd95317f31c7fa1d, 0x40405643d711d583) }, // 274
+  { teju_literal2(0xc685c3b4b5e957db, 0x43503dabc563ebfe), teju_literal2(0xb1442798f49ffb4a, 0x99cd11cfdf41779c) }, // 275
+  { teju_literal2(0xd2049c909187797c, 0x35d9caefd11cbccb), teju_literal2(0x8dd01fad907ffc3b, 0xae3da7d97f6792e3) }, // 276
+};
+
+#define teju_calculation_sorted 0u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xffffffffffffffff, 0xffffffffffffffff) }, // 0
+  { teju_literal2(0xcccccccccccccccc, 0xcccccccccccccccd), teju_literal2(0x3333333333333333, 0x3333333333333333) }, // 1
+  { teju_literal2(0x28f5c28f5c28f5c2, 0x8f5c28f5c28f5c29), teju_literal2(0x0a3d70a3d70a3d70, 0xa3d70a3d70a3d70a) }, // 2
+  { teju_literal2(0x6e978d4fdf3b645a, 0x1cac083126e978d5), teju_literal2(0x020c49ba5e353f7c, 0xed916872b020c49b) }, // 3
+  { teju_literal2(0x495182a9930be0de, 0xd288ce703afb7e91), teju_literal2(0x0068db8bac710cb2, 0x95e9e1b089a02752) }, // 4
+  { teju_literal2(0xdb76b3bb83cf2cf9, 0x5d4e8fb00bcbe61d), teju_literal2(0x0014f8b588e368f0, 0x8461f9f01b866e43) }, // 5
+  { teju_literal2(0xc57e23f24d8fd5cb, 0x790fb65668c26139), teju_literal2(0x000431bde82d7b63, 0x4dad31fcd24e160d) }, // 6
+  { teju_literal2(0xc1193a63a91cc45b, 0xe5032477ae8d46a5), teju_literal2(0x0000d6bf94d5e57a, 0x42bc3d3290760469) }, // 7
+  { teju_literal2(0xf36b7213ee9f5a78, 0xc767074b22e90e21), teju_literal2(0x00002af31dc46118, 0x73bf3f70834acdae) }, // 8
+  { teju_literal2(0x97157d372fb9787e, 0x8e47ce423a2e9c6d), teju_literal2(0x0000089705f4136b, 0x4a59731680a88f89) }, // 9
+  { teju_literal2(0x516ab2a4a3251819, 0x4fa7f60d3ed61f49), teju_literal2(0x000001b7cdfd9d7b, 0xdbab7d6ae6881cb5) }, // 10
+  { teju_literal2(0x76aef08753d43805, 0x0fee64690c913975), teju_literal2(0x00000057f5ff85e5, 0x92557f7bc7b4d28a) }, // 11
+  { teju_literal2(0xb156301b10c40b34, 0x3662e0e1cf503eb1), teju_literal2(0x000000119799812d, 0xea11197f27f0f6e8) }, // 12
+  { teju_literal2(0x2377a3389cf4023d, 0xa47a2cf9f6433fbd), teju_literal2(0x0000000384b84d09, 0x2ed0384ca19697c8) }, // 13
+  { teju_literal2(0x0717ed71b8fd9a0c, 0x54186f653140a659), teju_literal2(0x00000000b424dc35, 0x095cd80f538484c1) }, // 14
+  { teju_literal2(0xce37fc49f1cc5202, 0x7738164770402145), teju_literal2(0x0000000024075f3d, 0xceac2b3643e74dc0) }, // 15
+  { teju_literal2(0xf60b3275305c1066, 0xe4a4d1417cd9a041), teju_literal2(0x000000000734aca5, 0xf6226f0ada6175f3) }, // 16
+  { teju_literal2(0x6468a3b109ac0347, 0xc75429d9e5c5200d), teju_literal2(0x000000000170ef54, 0x646d496892137dfd) }, // 17
+  { teju_literal2(0xe0e1ba569b88cd74, 0xc1773b91fac10669), teju_literal2(0x000000000049c977, 0x47490eae839d7f99) }, // 18
+  { teju_literal2(0x93605877b8b4f5e4, 0x26b172506559ce15), teju_literal2(0x00000000000ec1e4, 0xa7db69561a52b31e) }, // 19
+  { teju_literal2(0x83e011b18b576460, 0xd489e3a9addec2d1), teju_literal2(0x000000000002f394, 0x219248446baa23d2) }, // 20
+  { teju_literal2(0x4d9336bd1bde4746, 0x90e860bb892c8d5d), teju_literal2(0x000000000000971d, 0xa05074da7beed3f6) }, // 21
+  { teju_literal2(0xdc50a48c38c60e41, 0x502e79bf1b6f4f79), teju_literal2(0x0000000000001e39, 0x2010175ee5962a64) }, // 22
+  { teju_literal2(0x9276874f3e8e02d9, 0xdcd618596be30fe5), teju_literal2(0x000000000000060b, 0x6cd004ac94513bad) }, // 23
+  { teju_literal2(0xea17b4a972e933c5, 0x2c2ad1ab7bfa3661), teju_literal2(0x0000000000000135, 0x7c299a88ea76a589) }, // 24
+  { teju_literal2(0xfb9e575516fb70c1, 0x08d55d224bfed7ad), teju_literal2(0x000000000000003d, 0xe5a1ebb4fbb1544e) }, // 25
+  { teju_literal2(0x658611776aff168d, 0x01c445d3a8cc9189), teju_literal2(0x000000000000000c, 0x612062576589dda9) }, // 26
+  { teju_literal2(0xe11ad04b156637b5, 0xcd27412a54f5b6b5), teju_literal2(0x0000000000000002, 0x79d346de4781f921) }, // 27
+  { teju_literal2(0xf9d229a89de13e57, 0x8f6e403baa978af1), teju_literal2(0x0000000000000000, 0x7ec3daf941806506) }, // 28
+  { teju_literal2(0x31f6d521b92d0c77, 0xe97c733f221e4efd), teju_literal2(0x0000000000000000, 0x195a5efea6b34767) }, // 29
+  { teju_literal2(0xa397c439f1d5cf4b, 0x2eb27d7306d2dc99), teju_literal2(0x0000000000000000, 0x051212ffbaf0a7e1) }, // 30
+  { teju_literal2(0xed84c0d863912975, 0x6fbd4c4a34909285), teju_literal2(0x0000000000000000, 0x01039d66589687f9) }, // 31
+  { teju_literal2(0x62b42691ad836eb1, 0x16590f420a835081), teju_literal2(0x0000000000000000, 0x0033ec47ab514e65) }, // 32
+  { teju_literal2(0x46f0d483891a4956, 0x9e11cfda021a434d), teju_literal2(0x0000000000000000, 0x000a6274bbdd0fad) }, // 33
+  { teju_literal2(0xa7c9c41a4e9edb77, 0xb936c32b9a0540a9), teju_literal2(0x0000000000000000, 0x000213b0f25f6989) }, // 34
+  { teju_literal2(0x87f52738761fc57e, 0x583e2708b8677355), teju_literal2(0x0000000000000000, 0x00006a5696dfe1e8) }, // 35
+  { teju_literal2(0xe7fdd4a4e46cc119, 0x44d93b01be7b1711), teju_literal2(0x0000000000000000, 0x0000154484932d2e) }, // 36
+  { teju_literal2(0xc7ff90edc748f36b, 0x742b72338c7f049d), teju_literal2(0x0000000000000000, 0x00000440e750a2a2) }, // 37
+  { teju_literal2(0x8e66502f8e41ca48, 0xb0d57d3d827fcdb9), teju_literal2(0x0000000000000000, 0x000000d9c7dced53) }, // 38
+  { teju_literal2(0x4fae100982d9f541, 0xbcf77f72b3b32925), teju_literal2(0x0000000000000000, 0x0000002b8e5f62aa) }, // 39
+  { teju_literal2(0xa98936684d5ecaa6, 0xbf64b316f0bd6ea1), teju_literal2(0x0000000000000000, 0x00000008b61313bb) }, // 40
+  { teju_literal2(0x21e83e14dc462887, 0xbfe0f09e3025e2ed), teju_literal2(0x0000000000000000, 0x00000001be03d0bf) }, // 41
+  { teju_literal2(0x6d2e72d0f8dad4e7, 0xf32cfcec700793c9), teju_literal2(0x0000000000000000, 0x000000005933f68c) }, // 42
+  { teju_literal2(0x7c3c7d5cfe922a94, 0xca3c3295b00183f5), teju_literal2(0x0000000000000000, 0x0000000011d7314f) }, // 43
+  { teju_literal2(0x18d8e5df661d3bb7, 0x5ba5a3b78999e731), teju_literal2(0x0000000000000000, 0x0000000003917043) }, // 44
+  { teju_literal2(0x9e91c793146c3f24, 0xabeded8b1b852e3d), teju_literal2(0x0000000000000000, 0x0000000000b6b00d) }, // 45
+  { teju_literal2(0xb9505b1d6a7c0ca0, 0xef2f95e89f1aa2d9), teju_literal2(0x0000000000000000, 0x000000000024899c) }, // 46
+  { teju_literal2(0x8b76789f7bb268ec, 0xfca31dfb530553c5), teju_literal2(0x0000000000000000, 0x0000000000074eb8) }, // 47
+  { teju_literal2(0x1be47e864bf07b62, 0x98ed6c65770110c1), teju_literal2(0x0000000000000000, 0x0000000000017624) }, // 48
+  { teju_literal2(0x6bfa7fb475967f13, 0xb82f7c144b00368d), teju_literal2(0x0000000000000000, 0x0000000000004ad4) }, // 49
+};
+
+#include "teju/src/teju.h"
+
+#ifdef __cplusplus
+}
+#endif
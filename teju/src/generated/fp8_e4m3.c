@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./fp8_e4m3.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                16u
+#define teju_exponent_min         -9
+#define teju_mantissa_width       4u
+#define teju_storage_index_offset -3
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_4
+#endif
+
+#define teju_function             teju_fp8_e4m3
+#define teju_fields_t             teju16_fields_t
+#define teju_u1_t                 teju16_u1_t
+
+#if defined(teju16_u2_t)
+  #define teju_u2_t               teju16_u2_t
+#endif
+
+#if defined(teju16_u4_t)
+  #define teju_u4_t               teju16_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { 0x0001, 0xfa00 }, // -3
+  { 0x0001, 0xc800 }, // -2
+  { 0x0001, 0xa000 }, // -1
+  { 0x0001, 0x8000 }, // 0
+  { 0xcccd, 0xcccc }, // 1
+};
+
+#define teju_calculation_sorted 1u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { 0x0001, 0xffff }, // 0
+  { 0xcccd, 0x3333 }, // 1
+  { 0x5c29, 0x0a3d }, // 2
+  { 0x78d5, 0x020c }, // 3
+  { 0x7e91, 0x0068 }, // 4
+  { 0xe61d, 0x0014 }, // 5
+};
+
+#include "teju/src/teju.h"
+
+static teju_constexpr const teju_aligned teju16_fields_t decimals[] = {
+  { 0, 0 }, // 0x0000
+  { -3, 2 }, // 0x0001
+  { -3, 4 }, // 0x0002
+  { -3, 6 }, // 0x0003
+  { -3, 8 }, // 0x0004
+  { -2, 1 }, // 0x0005
+  { -3, 12 }, // 0x0006
+  { -3, 14 }, // 0x0007
+  { -3, 16 }, // 0x0008
+  { -3, 18 }, // 0x0009
+  { -2, 2 }, // 0x000a
+  { -3, 21 }, // 0x000b
+  { -3, 23 }, // 0x000c
+  { -3, 25 }, // 0x000d
+  { -3, 27 }, // 0x000e
+  { -2, 3 }, // 0x000f
+  { -3, 31 }, // 0x0010
+  { -3, 35 }, // 0x0011
+  { -2, 4 }, // 0x0012
+  { -3, 43 }, // 0x0013
+  { -3, 47 }, // 0x0014
+  { -2, 5 }, // 0x0015
+  { -3, 55 }, // 0x0016
+  { -2, 6 }, // 0x0017
+  { -3, 62 }, // 0x0018
+  { -2, 7 }, // 0x0019
+  { -2, 8 }, // 0x001a
+  { -3, 86 }, // 0x001b
+  { -2, 9 }, // 0x001c
+  { -1, 1 }, // 0x001d
+  { -2, 11 }, // 0x001e
+  { -2, 12 }, // 0x001f
+  { -2, 13 }, // 0x0020
+  { -2, 14 }, // 0x0021
+  { -2, 16 }, // 0x0022
+  { -2, 17 }, // 0x0023
+  { -2, 19 }, // 0x0024
+  { -1, 2 }, // 0x0025
+  { -2, 22 }, // 0x0026
+  { -2, 23 }, // 0x0027
+  { -2, 25 }, // 0x0028
+  { -2, 28 }, // 0x0029
+  { -1, 3 }, // 0x002a
+  { -2, 34 }, // 0x002b
+  { -2, 38 }, // 0x002c
+  { -1, 4 }, // 0x002d
+  { -2, 44 }, // 0x002e
+  { -2, 47 }, // 0x002f
+  { -1, 5 }, // 0x0030
+  { -2, 56 }, // 0x0031
+  { -1, 6 }, // 0x0032
+  { -1, 7 }, // 0x0033
+  { -2, 75 }, // 0x0034
+  { -1, 8 }, // 0x0035
+  { -1, 9 }, // 0x0036
+  { -2, 94 }, // 0x0037
+  { 0, 1 }, // 0x0038
+  { -1, 11 }, // 0x0039
+  { -1, 12 }, // 0x003a
+  { -1, 14 }, // 0x003b
+  { -1, 15 }, // 0x003c
+  { -1, 16 }, // 0x003d
+  { -1, 18 }, // 0x003e
+  { -1, 19 }, // 0x003f
+  { 0, 2 }, // 0x0040
+  { -1, 22 }, // 0x0041
+  { -1, 25 }, // 0x0042
+  { -1, 28 }, // 0x0043
+  { 0, 3 }, // 0x0044
+  { -1, 32 }, // 0x0045
+  { -1, 35 }, // 0x0046
+  { -1, 38 }, // 0x0047
+  { 0, 4 }, // 0x0048
+  { -1, 45 }, // 0x0049
+  { 0, 5 }, // 0x004a
+  { -1, 55 }, // 0x004b
+  { 0, 6 }, // 0x004c
+  { -1, 65 }, // 0x004d
+  { 0, 7 }, // 0x004e
+  { -1, 75 }, // 0x004f
+  { 0, 8 }, // 0x0050
+  { 0, 9 }, // 0x0051
+  { 1, 1 }, // 0x0052
+  { 0, 11 }, // 0x0053
+  { 0, 12 }, // 0x0054
+  { 0, 13 }, // 0x0055
+  { 0, 14 }, // 0x0056
+  { 0, 15 }, // 0x0057
+  { 0, 16 }, // 0x0058
+  { 0, 18 }, // 0x0059
+  { 1, 2 }, // 0x005a
+  { 0, 22 }, // 0x005b
+  { 0, 24 }, // 0x005c
+  { 0, 26 }, // 0x005d
+  { 0, 28 }, // 0x005e
+  { 1, 3 }, // 0x005f
+  { 0, 32 }, // 0x0060
+  { 0, 36 }, // 0x0061
+  { 1, 4 }, // 0x0062
+  { 0, 44 }, // 0x0063
+  { 1, 5 }, // 0x0064
+  { 0, 52 }, // 0x0065
+  { 0, 56 }, // 0x0066
+  { 1, 6 }, // 0x0067
+  { 0, 64 }, // 0x0068
+  { 1, 7 }, // 0x0069
+  { 1, 8 }, // 0x006a
+  { 1, 9 }, // 0x006b
+  { 2, 1 }, // 0x006c
+  { 0, 104 }, // 0x006d
+  { 1, 11 }, // 0x006e
+  { 1, 12 }, // 0x006f
+  { 1, 13 }, // 0x0070
+  { 1, 14 }, // 0x0071
+  { 1, 16 }, // 0x0072
+  { 1, 18 }, // 0x0073
+  { 2, 2 }, // 0x0074
+  { 1, 21 }, // 0x0075
+  { 1, 22 }, // 0x0076
+  { 1, 24 }, // 0x0077
+  { 1, 26 }, // 0x0078
+  { 2, 3 }, // 0x0079
+  { 1, 32 }, // 0x007a
+  { 1, 35 }, // 0x007b
+  { 2, 4 }, // 0x007c
+  { 1, 42 }, // 0x007d
+  { 1, 45 }, // 0x007e
+  { 1, 48 }, // 0x007f
+};
+
+teju_function_specifier
+teju16_fields_t
+teju_fp8_e4m3_lut(teju16_u1_t const bits) {
+  assert(bits < sizeof(decimals) / sizeof(decimals[0]));
+  return decimals[bits];
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#ifndef TEJU_TEJU_GENERATED_FP8_E4M3_H_
+#define TEJU_TEJU_GENERATED_FP8_E4M3_H_
+
+#include "teju/src/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+teju_export
+teju16_fields_t
+teju_fp8_e4m3(teju16_fields_t binary);
+
+teju_export
+teju16_fields_t
+teju_fp8_e4m3_lut(teju16_u1_t bits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_GENERATED_FP8_E4M3_H_
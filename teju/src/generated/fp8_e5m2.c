@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./fp8_e5m2.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                16u
+#define teju_exponent_min         -16
+#define teju_mantissa_width       3u
+#define teju_storage_index_offset -5
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_4
+#endif
+
+#define teju_function             teju_fp8_e5m2
+#define teju_fields_t             teju16_fields_t
+#define teju_u1_t                 teju16_u1_t
+
+#if defined(teju16_u2_t)
+  #define teju_u2_t               teju16_u2_t
+#endif
+
+#if defined(teju16_u4_t)
+  #define teju_u4_t               teju16_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { 0x0001, 0xc350 }, // -5
+  { 0x0001, 0x9c40 }, // -4
+  { 0x0001, 0xfa00 }, // -3
+  { 0x0001, 0xc800 }, // -2
+  { 0x0001, 0xa000 }, // -1
+  { 0x0001, 0x8000 }, // 0
+  { 0xcccd, 0xcccc }, // 1
+  { 0x0a3e, 0xa3d7 }, // 2
+  { 0x6e98, 0x8312 }, // 3
+};
+
+#define teju_calculation_sorted 1u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { 0x0001, 0xffff }, // 0
+  { 0xcccd, 0x3333 }, // 1
+  { 0x5c29, 0x0a3d }, // 2
+  { 0x78d5, 0x020c }, // 3
+  { 0x7e91, 0x0068 }, // 4
+};
+
+#include "teju/src/teju.h"
+
+static teju_constexpr const teju_aligned teju16_fields_t decimals[] = {
+  { 0, 0 }, // 0x0000
+  { -5, 2 }, // 0x0001
+  { -5, 3 }, // 0x0002
+  { -5, 5 }, // 0x0003
+  { -5, 6 }, // 0x0004
+  { -5, 8 }, // 0x0005
+  { -5, 9 }, // 0x0006
+  { -4, 1 }, // 0x0007
+  { -5, 12 }, // 0x0008
+  { -5, 15 }, // 0x0009
+  { -5, 18 }, // 0x000a
+  { -4, 2 }, // 0x000b
+  { -5, 24 }, // 0x000c
+  { -4, 3 }, // 0x000d
+  { -5, 37 }, // 0x000e
+  { -4, 4 }, // 0x000f
+  { -4, 5 }, // 0x0010
+  { -4, 6 }, // 0x0011
+  { -4, 7 }, // 0x0012
+  { -4, 9 }, // 0x0013
+  { -3, 1 }, // 0x0014
+  { -4, 12 }, // 0x0015
+  { -4, 15 }, // 0x0016
+  { -4, 17 }, // 0x0017
+  { -3, 2 }, // 0x0018
+  { -4, 24 }, // 0x0019
+  { -3, 3 }, // 0x001a
+  { -4, 34 }, // 0x001b
+  { -3, 4 }, // 0x001c
+  { -3, 5 }, // 0x001d
+  { -3, 6 }, // 0x001e
+  { -3, 7 }, // 0x001f
+  { -3, 8 }, // 0x0020
+  { -2, 1 }, // 0x0021
+  { -3, 12 }, // 0x0022
+  { -3, 14 }, // 0x0023
+  { -3, 16 }, // 0x0024
+  { -2, 2 }, // 0x0025
+  { -3, 23 }, // 0x0026
+  { -3, 27 }, // 0x0027
+  { -2, 3 }, // 0x0028
+  { -2, 4 }, // 0x0029
+  { -2, 5 }, // 0x002a
+  { -3, 55 }, // 0x002b
+  { -2, 6 }, // 0x002c
+  { -2, 8 }, // 0x002d
+  { -1, 1 }, // 0x002e
+  { -2, 11 }, // 0x002f
+  { -2, 12 }, // 0x0030
+  { -2, 16 }, // 0x0031
+  { -1, 2 }, // 0x0032
+  { -2, 22 }, // 0x0033
+  { -2, 25 }, // 0x0034
+  { -1, 3 }, // 0x0035
+  { -1, 4 }, // 0x0036
+  { -2, 44 }, // 0x0037
+  { -1, 5 }, // 0x0038
+  { -1, 6 }, // 0x0039
+  { -1, 8 }, // 0x003a
+  { -1, 9 }, // 0x003b
+  { 0, 1 }, // 0x003c
+  { -1, 12 }, // 0x003d
+  { -1, 15 }, // 0x003e
+  { -1, 18 }, // 0x003f
+  { 0, 2 }, // 0x0040
+  { -1, 25 }, // 0x0041
+  { 0, 3 }, // 0x0042
+  { -1, 35 }, // 0x0043
+  { 0, 4 }, // 0x0044
+  { 0, 5 }, // 0x0045
+  { 0, 6 }, // 0x0046
+  { 0, 7 }, // 0x0047
+  { 0, 8 }, // 0x0048
+  { 1, 1 }, // 0x0049
+  { 0, 12 }, // 0x004a
+  { 0, 14 }, // 0x004b
+  { 0, 16 }, // 0x004c
+  { 1, 2 }, // 0x004d
+  { 0, 24 }, // 0x004e
+  { 0, 28 }, // 0x004f
+  { 1, 3 }, // 0x0050
+  { 1, 4 }, // 0x0051
+  { 1, 5 }, // 0x0052
+  { 0, 56 }, // 0x0053
+  { 1, 6 }, // 0x0054
+  { 1, 8 }, // 0x0055
+  { 2, 1 }, // 0x0056
+  { 1, 11 }, // 0x0057
+  { 1, 13 }, // 0x0058
+  { 1, 16 }, // 0x0059
+  { 2, 2 }, // 0x005a
+  { 1, 22 }, // 0x005b
+  { 1, 26 }, // 0x005c
+  { 2, 3 }, // 0x005d
+  { 2, 4 }, // 0x005e
+  { 1, 45 }, // 0x005f
+  { 2, 5 }, // 0x0060
+  { 2, 6 }, // 0x0061
+  { 2, 8 }, // 0x0062
+  { 2, 9 }, // 0x0063
+  { 3, 1 }, // 0x0064
+  { 2, 13 }, // 0x0065
+  { 2, 15 }, // 0x0066
+  { 2, 18 }, // 0x0067
+  { 3, 2 }, // 0x0068
+  { 2, 26 }, // 0x0069
+  { 3, 3 }, // 0x006a
+  { 2, 36 }, // 0x006b
+  { 3, 4 }, // 0x006c
+  { 3, 5 }, // 0x006d
+  { 3, 6 }, // 0x006e
+  { 3, 7 }, // 0x006f
+  { 3, 8 }, // 0x0070
+  { 4, 1 }, // 0x0071
+  { 3, 12 }, // 0x0072
+  { 3, 14 }, // 0x0073
+  { 3, 16 }, // 0x0074
+  { 4, 2 }, // 0x0075
+  { 3, 25 }, // 0x0076
+  { 4, 3 }, // 0x0077
+  { 3, 33 }, // 0x0078
+  { 4, 4 }, // 0x0079
+  { 4, 5 }, // 0x007a
+  { 4, 6 }, // 0x007b
+};
+
+teju_function_specifier
+teju16_fields_t
+teju_fp8_e5m2_lut(teju16_u1_t const bits) {
+  assert(bits < sizeof(decimals) / sizeof(decimals[0]));
+  return decimals[bits];
+}
+
+#ifdef __cplusplus
+}
+#endif
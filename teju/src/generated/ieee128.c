@@ -15,7 +15,14 @@ extern "C" {
 #define teju_exponent_min         -16494
 #define teju_mantissa_width       113u
 #define teju_storage_index_offset -4966
-#define teju_calculation_mshift   teju_built_in_1
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_synthetic_1
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_synthetic_1
+#endif
 
 #define teju_function             teju_ieee128
 #define teju_fields_t             teju128_fields_t
@@ -34,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { teju_literal2(0xd5ac45eddf014d24, 0xd2c5a14581f5713f), teju_literal2(0xcf34a273bb7ea9a3, 0xf4d36655a35ec0d4) }, // -4966
   { teju_literal2(0xde236b24b26770ea, 0x4237b4379b2ac0ff), teju_literal2(0xa5c3b52962cbbae9, 0x90a91eaae9189a43) }, // -4965
   { teju_literal2(0x181c55b6f51f8d88, 0x34f95cf948ef00cc), teju_literal2(0x849c90ede8a2fbee, 0x0d541888ba7a1503) }, // -4964
@@ -9904,7 +9911,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 0u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
@@ -12,6 +12,7 @@
 extern "C" {
 #endif
 
+teju_export
 teju128_fields_t
 teju_ieee128(teju128_fields_t binary);
 
@@ -0,0 +1,1080 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./ieee128_compressed.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                128u
+#define teju_exponent_min         -16494
+#define teju_mantissa_width       113u
+#define teju_storage_index_offset -4966
+#define teju_storage_compression  32u
+#define teju_storage_index_top    4898
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_synthetic_1
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_synthetic_1
+#endif
+
+#define teju_function             teju_ieee128_compressed
+#define teju_fields_t             teju128_fields_t
+#define teju_u1_t                 teju128_u1_t
+
+#if defined(teju128_u2_t)
+  #define teju_u2_t               teju128_u2_t
+#endif
+
+#if defined(teju128_u4_t)
+  #define teju_u4_t               teju128_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+#define teju_multiplier(upper, lower) { lower, upper }
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { teju_literal2(0x48641bc41c563bdd, 0x66e2ccb969eae47c), teju_literal2(0x92a54e7bc2105061, 0x62294ed525a1d3b0) }, // 4898
+  { teju_literal2(0x384baed863bf9cb9, 0x6c0347142e85ea5b), teju_literal2(0xb4c13ba2ad4f9f80, 0xdca806bb3fa32100) }, // 4866
+  { teju_literal2(0x98e0d16d2505bd74, 0xf3b4a51c82caad99), teju_literal2(0xdecc29c5f6829d85, 0xbc0e4a34b197f1a7) }, // 4834
+  { teju_literal2(0xc9e1410a3ee23234, 0xb072559959346ba9), teju_literal2(0x894f3fdce1896104, 0x9b26da563569416b) }, // 4802
+  { teju_literal2(0x65e9fb381be51fc1, 0x1a1301220977ec2f), teju_literal2(0xa93f4296b98380ca, 0x3af7178b603aae37) }, // 4770
+  { teju_literal2(0x38834b84bd856971, 0xf87528464676f149), teju_literal2(0xd09cf8a737fc34c8, 0xabb26c7dec5cd6e4) }, // 4738
+  { teju_literal2(0xf9669060e51d6ea1, 0x3637e83f07a17b5b), teju_literal2(0x80915acd04762676, 0x6c369da24447e65a) }, // 4706
+  { teju_literal2(0xf8f31a8637ceee38, 0x7ada3be0d9442b02), teju_literal2(0x9e78d7829624183e, 0x7ecfa1c2931fcd22) }, // 4674
+  { teju_literal2(0xfca7d1b4b3c2e565, 0x1c947ca2eb774ce5), teju_literal2(0xc354f55162ccd698, 0xaad2d1e2d110c341) }, // 4642
+  { teju_literal2(0xe3e4e1edba472340, 0x5d9f2f53dea21d13), teju_literal2(0xf0c3dea8d7cdd2bb, 0x3552dd3a332884eb) }, // 4610
+  { teju_literal2(0x9c62be2ce59bb8d0, 0x0bfe72fdc0504846), teju_literal2(0x9462099a6b246b2a, 0x7cbf4c218f8b82ad) }, // 4578
+  { teju_literal2(0xe3252326713fede0, 0x9228854905f4920d), teju_literal2(0xb6e567f9a3167886, 0xe457bf75827b5692) }, // 4546
+  { teju_literal2(0x947384a150e3ce82, 0x73ded8790f5bc9cd), teju_literal2(0xe16fd6bc91f08ba8, 0x48d036d1bfc4f9a5) }, // 4514
+  { teju_literal2(0xed2903f7e1df2b78, 0x3a276a6a355cab15), teju_literal2(0x8aefaaae9060380f, 0xc846664fe1364ee8) }, // 4482
+  { teju_literal2(0x4d59842689ab2f3a, 0x8da1969877e35f39), teju_literal2(0xab4088b544270747, 0x8134747aee95f34d) }, // 4450
+  { teju_literal2(0xd865267a51f1aca2, 0x5d5709704aa97450), teju_literal2(0xd315a156f429a866, 0x2ed3f3d7c15b15dc) }, // 4418
+  { teju_literal2(0x0d24b03f624af688, 0xe6719fcb9ccb652a), teju_literal2(0x821742c7c3b2a5b6, 0x59e07ec7a571aa4d) }, // 4386
+  { teju_literal2(0x69130cde6caa5df0, 0x3b8fb6cce2b4a228), teju_literal2(0xa0597034286c5243, 0xf6e16a978c45569e) }, // 4354
+  { teju_literal2(0x2d985140305761d8, 0x98aa89346a753cfe), teju_literal2(0xc5a556d23750142d, 0x752b34d80ba5a04b) }, // 4322
+  { teju_literal2(0xf563727fca946b4c, 0xcff46038398daa18), teju_literal2(0xf39e091a9acf00ef, 0xe6ebb85e5f1479ab) }, // 4290
+  { teju_literal2(0x24218f3b252ec11a, 0xb3fb42564745ea7b), teju_literal2(0x96240974279dd672, 0xd13880bbad08b8ce) }, // 4258
+  { teju_literal2(0x457bced15e292ccd, 0xa1703e3a1a6297ef), teju_literal2(0xb91012c0fc6447b1, 0xb68297b57224eb35) }, // 4226
+  { teju_literal2(0x6a04ee6fb0f7d208, 0xb1d454ece61f2df1), teju_literal2(0xe41b84d06fd73fa3, 0x6ef2319c70613c86) }, // 4194
+  { teju_literal2(0xe7899ec47accb0e6, 0xbab5e5d47130e841), teju_literal2(0x8c95045d7a822436, 0x5cca56bfadd0f715) }, // 4162
+  { teju_literal2(0xec75603692b4216b, 0x75f5344da85d3237), teju_literal2(0xad47e36d7b54184e, 0x80dcfff27ba9d7b0) }, // 4130
+  { teju_literal2(0x14b8c8f8aa153569, 0x6e4ea8fa5b1dfeef), teju_literal2(0xd595c8af225028ca, 0x782d721920faa3d2) }, // 4098
+  { teju_literal2(0xcf9ca4ddd7bb0634, 0x30424a68be4f8178), teju_literal2(0x83a1c9395df8cf96, 0x2327717ba351c491) }, // 4066
+  { teju_literal2(0x6167e0192b2d5c12, 0xf4f1623122362781), teju_literal2(0xa23fba65aa89b5c9, 0xcd01dce6cc32a5e3) }, // 4034
+  { teju_literal2(0x68261d5d99dd60a5, 0xa5e61e945f115c52), teju_literal2(0xc7fcbcd4e047b570, 0xd2d9129aa54572dd) }, // 4002
+  { teju_literal2(0xd7d835eea15ed4db, 0xb61b3274a3171323), teju_literal2(0xf680d9ea1187b1c7, 0xcf683d27f29900f9) }, // 3970
+  { teju_literal2(0x7c8469c50e72c0b1, 0xcca7fb64bf33c988), teju_literal2(0x97eb5e033f8610c2, 0x62cf7094d31e9b30) }, // 3938
+  { teju_literal2(0x79ea7866620ca8b3, 0x2291378c61bdf674), teju_literal2(0xbb414faa6274d418, 0x6bcb0de4ebc4348c) }, // 3906
+  { teju_literal2(0x06b6b2044c703330, 0x86cd75cf577d94d0), teju_literal2(0xe6cf4c47e3f08041, 0xdc01a8af3aca0925) }, // 3874
+  { teju_literal2(0xf6af49e7fa188752, 0xe2c9be6529bbb4db), teju_literal2(0x8e3f5bdf7fddfb32, 0x9c68eb0fb69afa1b) }, // 3842
+  { teju_literal2(0x3926eea08f26d141, 0x56dc38d69215009d), teju_literal2(0xaf5565300e6c440d, 0x1d990f49b380d93b) }, // 3810
+  { teju_literal2(0x32e294762f8be1d3, 0xca9a129689b0cef5), teju_literal2(0xd81d856a73ffd427, 0xdc35578bc8a7ebc3) }, // 3778
+  { teju_literal2(0xbad6cb4cf256199a, 0x145c68997e7328ae), teju_literal2(0x8530fc23df43c2e0, 0x2b2fd556aa2c3e32) }, // 3746
+  { teju_literal2(0x87bdaf8f647892ca, 0x22671e272114c4ce), teju_literal2(0xa42bc75b4155e2b3, 0xc92f255bc2280e02) }, // 3714
+  { teju_literal2(0x5a3afebde3e7a5e5, 0x6f3966d9c102a9bd), teju_literal2(0xca5b3ca19d34288a, 0xd3f8b6a11bde8906) }, // 3682
+  { teju_literal2(0x1585f5ebc4a3ee65, 0xe7dccdf403db7566), teju_literal2(0xf96c6b52b7ecc3e9, 0x8c65c7c5ec8f75be) }, // 3650
+  { teju_literal2(0x85ff7561f6a627fc, 0xce72837833aaaa3c), teju_literal2(0x99b817726f741856, 0x1402376a226ea133) }, // 3618
+  { teju_literal2(0x4f474827d8139042, 0x0a74fc0bf038b5f5), teju_literal2(0xbd7932a3384e926d, 0x2d307f1c3bd23ae9) }, // 3586
+  { teju_literal2(0x83eb20ff9c99bb49, 0xcf02231e3f9bb301), teju_literal2(0xe98b45b2e015a6c1, 0xadedf7ecc8cc22dd) }, // 3554
+  { teju_literal2(0xfbb6ba38891ade78, 0x983b9e09b2f297b1), teju_literal2(0x8feec057df348e12, 0xe242c12e96a3021a) }, // 3522
+  { teju_literal2(0xe471e3a91de077ea, 0xc3f74bf167acca4e), teju_literal2(0xb16920a5993025e6, 0xd64ce1bb3f8e0225) }, // 3490
+  { teju_literal2(0x6a06040079333413, 0xf5d03474485d66f6), teju_literal2(0xdaacee88891305a9, 0x5cd5bfe79d642b3b) }, // 3458
+  { teju_literal2(0x186fedc361a71d4f, 0xaad0d23d4edfb165), teju_literal2(0x86c4e9b3ceec4734, 0x8127243959a6b5e5) }, // 3426
+  { teju_literal2(0xe808ed69578871ab, 0xd170a6497aca8a47), teju_literal2(0xa61da88d6e96daae, 0x8d3d735fef520226) }, // 3394
+  { teju_literal2(0x405a21de646b55ec, 0xd51543db8d8e2e50), teju_literal2(0xccc0ebc1386dd9c5, 0x9ab300d9f0efca51) }, // 3362
+  { teju_literal2(0x2403dc06f6aeb665, 0x429dee654b024c44), teju_literal2(0xfc60d7df97ed4492, 0xb686235250b4b8b9) }, // 3330
+  { teju_literal2(0xf54084439a4e2f00, 0x52037fb8ab6dc8e0), teju_literal2(0x9b8a461d7b7f92b7, 0xf6fa01dd44f55881) }, // 3298
+  { teju_literal2(0xc39ad8e3898e35a3, 0x36b806c0541def70), teju_literal2(0xbfb7cfd54fe3d526, 0xaba0ba113098d509) }, // 3266
+  { teju_literal2(0x5e9073b111ab53cc, 0x2896151d441c4cdc), teju_literal2(0xec4f89ebd3820eb8, 0x43a2e38585f926a6) }, // 3234
+  { teju_literal2(0x44c4b7f717298b46, 0x5a55217ba434ef3c), teju_literal2(0x91a34117bfb0cd6b, 0x0139ef4cd27a10f5) }, // 3202
+  { teju_literal2(0xc76322cc36cb64b3, 0xcf82a398bfb25869), teju_literal2(0xb38328af4d587fad, 0x708e3d8c0e98cd64) }, // 3170
+  { teju_literal2(0x9f2cbd1b440fd7f2, 0x754441fb0181416a), teju_literal2(0xdd441b4ec0ba0c91, 0xd23faff758d95d34) }, // 3138
+  { teju_literal2(0xf9b0d2b29c0e0637, 0xcb22324723d9584e), teju_literal2(0x885da040b07e6829, 0x253125e3182a4f55) }, // 3106
+  { teju_literal2(0x340be89b1a6d75eb, 0x7b085f72769af64c), teju_literal2(0xa8156fa9afcbf8ff, 0xe0ca6ac7a4cbe0d8) }, // 3074
+  { teju_literal2(0x8ed7ba6578b8624a, 0xda20876e8c5885cb), teju_literal2(0xcf2ddffdcae1da69, 0xe8d45bbbcd2002e7) }, // 3042
+  { teju_literal2(0x63fbec1ca4d78185, 0x14d7ac2f19a9d7bd), teju_literal2(0xff5e3a6c3ab61e29, 0x5a1b71aae7f41c51) }, // 3010
+  { teju_literal2(0x87dc0c0175f92402, 0x7cb648fba9763f41), teju_literal2(0x9d61fa91c3f19b8d, 0x14d1cc09a4682255) }, // 2978
+  { teju_literal2(0xab2ef940c36b18fb, 0xca5e6a1e25367424), teju_literal2(0xc1fd3ba7a1594c01, 0x2121584e2c3493e7) }, // 2946
+  { teju_literal2(0x4eda5171ae2f021e, 0x1f59826cd6f93b01), teju_literal2(0xef1c32188cba999c, 0xc80fde7c9f34dc97) }, // 2914
+  { teju_literal2(0x1e038f45414607f0, 0x0bfdb841fac09c3e), teju_literal2(0x935ced9ebc213566, 0x4efac23ab58cef96) }, // 2882
+  { teju_literal2(0xf2e5483655233ee8, 0xd016fe79840bb746), teju_literal2(0xb5a390679e31ab71, 0xf4a041af5b655f77) }, // 2850
+  { teju_literal2(0x995ead7ef7adab9c, 0x1dbc100e581f60f8), teju_literal2(0xdfe323490d00dbe4, 0xf9b8f0e6ccde36a8) }, // 2818
+  { teju_literal2(0x4b6f5e4d7b576d01, 0xd40df863768e48ea), teju_literal2(0x89fb2e4d8615c761, 0x2ee9aedbeddb7e0d) }, // 2786
+  { teju_literal2(0x15ed5342ab9165fb, 0x0cef3e653f64b737), teju_literal2(0xaa132e931edc8229, 0x7a76616d9581ee98) }, // 2754
+  { teju_literal2(0x930b0e9241fd6747, 0x20da5909fad72062), teju_literal2(0xd1a22f6382202394, 0xe4ed4e8a13b1da0f) }, // 2722
+  { teju_literal2(0x3d40ef5efc9bb861, 0x71ed8f1e7530a14c), teju_literal2(0x81325712ce68ba6e, 0x421babf709089614) }, // 2690
+  { teju_literal2(0x4835b3f49884ce1f, 0x1750c200487f9643), teju_literal2(0x9f3f458edbb8821f, 0xbb3f44a24c81b62e) }, // 2658
+  { teju_literal2(0x9faa502e04b8deb9, 0x81e6e889f41489a6), teju_literal2(0xc4498abf047854b9, 0xc411799a261abdbc) }, // 2626
+  { teju_literal2(0x68d1d64cf6497e07, 0xc72b1c466d130e9d), teju_literal2(0xf1f157ab1e224b56, 0x841d0fc4353829e4) }, // 2594
+  { teju_literal2(0x25a4119ca8cfd612, 0xbe986e012d09a018), teju_literal2(0x951bd59b6fd77335, 0xfbe0975a67554f62) }, // 2562
+  { teju_literal2(0xd790a60f9113957b, 0x03ca4e679f8c0bc6), teju_literal2(0xb7ca6b22ee3f7bc1, 0xfc04d01598cfee9c) }, // 2530
+  { teju_literal2(0x209db58c8e3a0aef, 0x09b4c13aa2e3da66), teju_literal2(0xe28a1e4ac8d6353d, 0x656c7835c0f15be9) }, // 2498
+  { teju_literal2(0x271aba67a7a68496, 0x298fa7eed6aa0857), teju_literal2(0x8b9da28954454685, 0x69111a3574a74976) }, // 2466
+  { teju_literal2(0xe9036ab1dddc3954, 0xee16e0faa1bfe0d3), teju_literal2(0xac16f76314ad7fe3, 0xf00295a6e44928ea) }, // 2434
+  { teju_literal2(0x052ebde555bda809, 0xae21af2d7e2d23a4), teju_literal2(0xd41df04168c27d42, 0x9c3c7e3a55c99b0c) }, // 2402
+  { teju_literal2(0xf095d2653d2d5362, 0x2848eab84c87be2c), teju_literal2(0x82ba274592952e24, 0x8dc3378d6c1dc635) }, // 2370
+  { teju_literal2(0x7c174a8f92bfd0d2, 0x07aa95b437668b31), teju_literal2(0xa122380720a3cd30, 0x23863cfc89a53d45) }, // 2338
+  { teju_literal2(0xab9451af67551673, 0x139cfd6a6b809576), teju_literal2(0xc69cd1feec53b2a3, 0xb2a8875c6a3719dc) }, // 2306
+  { teju_literal2(0xdfed006098e94525, 0x21aff57d253124f1), teju_literal2(0xf4cf1462c5441d7f, 0x3ab608c7f4052b9a) }, // 2274
+  { teju_literal2(0x45a1534d9908a038, 0xe6e518187ac33086), teju_literal2(0x96e008ec05334455, 0x2aeef96f7d5aa9aa) }, // 2242
+  { teju_literal2(0x1b1069d3d5dfa7b9, 0x10c2285f54577965), teju_literal2(0xb9f7cc703eefb49f, 0xce183cf40755b868) }, // 2210
+  { teju_literal2(0x27748b45bdc7da1b, 0x975f5eb8a4990f2d), teju_literal2(0xe539246f909be839, 0x0abc2ab9d7536e0a) }, // 2178
+  { teju_literal2(0xa1667a330dcac4aa, 0xe134440a748a1189), teju_literal2(0x8d450bcfa78eb812, 0x71a381df4c80c86d) }, // 2146
+  { teju_literal2(0x4195941c55f26e5d, 0x0cfe8ce92c334151), teju_literal2(0xae20dc69cda4af44, 0xc6456e80cf61ab59) }, // 2114
+  { teju_literal2(0x7e57a47c7ccd5263, 0xb85c12e42f10dce5), teju_literal2(0xd6a1392a3133271c, 0x5261adad31bf563d) }, // 2082
+  { teju_literal2(0x203fddabfdbcfd57, 0xf6d3bbe174fa67dd), teju_literal2(0x84469bb7cf7ed5b0, 0xd2a7164ad8e834fd) }, // 2050
+  { teju_literal2(0xd38691147cd5f21f, 0xbbdd69356d00825f), teju_literal2(0xa30ae320556decc8, 0x974b268c3ce95a9a) }, // 2018
+  { teju_literal2(0xac26c9fc7b7fc797, 0x16b49b3c2195a743), teju_literal2(0xc8f7268a252556ad, 0x53fa1379af8b46cc) }, // 1986
+  { teju_literal2(0xdb2850eced681b9c, 0x516a2af60a11b995), teju_literal2(0xf7b5824cd4da3fa6, 0xcded519287913ab9) }, // 1954
+  { teju_literal2(0x006c11faf22fee56, 0xf55e34e5e6d543b6), teju_literal2(0x98a9979ec5dd9f47, 0x850ca5e92e5615ed) }, // 1922
+  { teju_literal2(0x1cf7fa7c26b5ff55, 0x5ccb32a4634711b6), teju_literal2(0xbc2bc819e2615a36, 0x49a039502995fec8) }, // 1890
+  { teju_literal2(0x2e0ade2cdfad2350, 0x71828e0055b0e205), teju_literal2(0xe7f04e1c1d47d6f2, 0x01eb9324c8485869) }, // 1858
+  { teju_literal2(0xe7b14ed140f8d98e, 0x9e44d20b972a3c2b), teju_literal2(0x8ef179291b6f5424, 0x7b2f7d61ce5d426c) }, // 1826
+  { teju_literal2(0xf686464e23d1b6fe, 0x59c9b220246ec3f7), teju_literal2(0xb030f02f101e5864, 0x61f039b11ffee280) }, // 1794
+  { teju_literal2(0x64397530ce4f267e, 0x852972f42909c713), teju_literal2(0xd92c20f502da762d, 0xe8b453f34e0eae57) }, // 1762
+  { teju_literal2(0x85921a8582e9eb86, 0x5ff7fb5a94ef49be), teju_literal2(0x85d7c27d1b606738, 0x5c0325c1d52ec86a) }, // 1730
+  { teju_literal2(0x15235ac704b314d5, 0x9c7466f89de88ef3), teju_literal2(0xa4f958343d991236, 0xab0cef493a007cad) }, // 1698
+  { teju_literal2(0x17a2718989aa7a3e, 0x30383cc4ef6c0484), teju_literal2(0xcb589dc3946bf5a1, 0xb1eb0f4c6396f73a) }, // 1666
+  { teju_literal2(0xc0f27a94888e7b24, 0x7d0da6fa6bc9edc4), teju_literal2(0xfaa4bbc5a19b13cd, 0x0d0445f0911bdeba) }, // 1634
+  { teju_literal2(0xb660568eb0ce54d7, 0x500563416d9d9075), teju_literal2(0x9a7891f2acb944d0, 0x4b6c9bce6565587f) }, // 1602
+  { teju_literal2(0x6c91d8c9c6161d0c, 0xc7b4513db3e219af), teju_literal2(0xbe6672262f472534, 0xd1ad5e8243d3cd52) }, // 1570
+  { teju_literal2(0x84ecfbd4ac65b537, 0x039e837f026634bb), teju_literal2(0xeaafb3ff221d874a, 0xc3b0898bc7af88bd) }, // 1538
+  { teju_literal2(0x9bfa6eb311575dcc, 0xcc763424997acb4c), teju_literal2(0x90a2f9cbe305bcc7, 0xecdae274870d16b0) }, // 1506
+  { teju_literal2(0xdf16701fa699a54b, 0xae41a54e5f2a24cd), teju_literal2(0xb2474572d4dbf88f, 0x7a0601d1d1792c97) }, // 1474
+  { teju_literal2(0x053f5a64b2c890df, 0x8f4576db062b1209), teju_literal2(0xdbbebebe49bab07b, 0x51333c90edd73323) }, // 1442
+  { teju_literal2(0xe0171daf49397e05, 0x269297c8d6bccfc1), teju_literal2(0x876da9d3bd03c8fb, 0xd4117c2fc6b67b37) }, // 1410
+  { teju_literal2(0x9919581308d0e85a, 0x0f768f4de557b407), teju_literal2(0xa6eda8d13b24b6e1, 0x4fc9d60ad1d5a0d5) }, // 1378
+  { teju_literal2(0x0a6a1909d657eea1, 0xc782897c2091861b), teju_literal2(0xcdc14d4efb4f3ee3, 0x1c514682e504b1a4) }, // 1346
+  { teju_literal2(0x6c3c0c16cf429011, 0xe05447433c5d2dc5), teju_literal2(0xfd9cdb7971d44f79, 0xb337abeb21a57794) }, // 1314
+  { teju_literal2(0xf46fadc4b24fb53f, 0xdf9029935791677d), teju_literal2(0x9c4d0857f98de827, 0xc21c22d026ede756) }, // 1282
+  { teju_literal2(0x2f68a6113f0a07c9, 0xccdfb4a2b4258ad1), teju_literal2(0xc0a7ded836eb7fe4, 0x0b9de063fa557a0c) }, // 1250
+  { teju_literal2(0xdb5d436ec40d0460, 0x64f558d8ca5a2fd6), teju_literal2(0xed776f122d08206d, 0xa33ec2e89b959725) }, // 1218
+  { teju_literal2(0x64eb3645e832beb8, 0xe73ea7a031d3c33e), teju_literal2(0x92599d1c53566be0, 0xd4c42c25131b2edf) }, // 1186
+  { teju_literal2(0xf1acb6041e8dc70d, 0x9e14e062deb6ee35), teju_literal2(0xb463ef2df171b9fc, 0x45a4de288bb9fccd) }, // 1154
+  { teju_literal2(0x859d0cc0259fd42d, 0x6db042863eb97f0e), teju_literal2(0xde5929e888818586, 0xe2d4c0ac45405458) }, // 1122
+  { teju_literal2(0x067f2f35c7554e5d, 0x348b5cf6e306c9bf), teju_literal2(0x890860252d38fe33, 0x32adc85727db52ff) }, // 1090
+  { teju_literal2(0x4e6da749de3a18fd, 0xf67dc0fadcd7ecd7), teju_literal2(0xa8e7e6baee216b7b, 0xf4592a100f282e4f) }, // 1058
+  { teju_literal2(0x06b6810c693a3892, 0xe27479e06d9d44dd), teju_literal2(0xd0314b11bb519a8c, 0x32c001b8dbf097ce) }, // 1026
+  { teju_literal2(0x8807af93308229c3, 0xd6abc195a2ef5e8d), teju_literal2(0x804efe32b7ee61ad, 0x19d071a08050226e) }, // 994
+  { teju_literal2(0x063e2d42fd862888, 0xb97aa525232890ed), teju_literal2(0x9e270b70c6732c6b, 0xba2e46544dc1f9c4) }, // 962
+  { teju_literal2(0xd1a29d5bc671ba73, 0xd58f2d89ea604ac5), teju_literal2(0xc2f022b07d5c8262, 0xe177ca5e3216ae3d) }, // 930
+  { teju_literal2(0x0b5a2de3a0f3ba2e, 0x46f383eac27b4e60), teju_literal2(0xf047989a899ccbbf, 0x443696aa4c6de677) }, // 898
+  { teju_literal2(0x83a423ad31577ae1, 0x6dc8cc35027ff4b1), teju_literal2(0x941572ad6f337371, 0xf0837bee833e91a6) }, // 866
+  { teju_literal2(0x3979f3e8ff10b618, 0x36db1db9eb33d455), teju_literal2(0xb6870092c4b8c61e, 0x934eaf24f8d95f3d) }, // 834
+  { teju_literal2(0x8eb806670f2e898c, 0x8fb761b1bc8028b4), teju_literal2(0xe0fb7a1d2d169934, 0x4759ca6820b2a962) }, // 802
+  { teju_literal2(0x6ebb9d3d1acd9120, 0xc8f0edcdd748d1d5), teju_literal2(0x8aa7f40699d5b41b, 0xbf48c4102cd7f80a) }, // 770
+  { teju_literal2(0xdbe39a5423c76a3f, 0x640cce4d47923f26), teju_literal2(0xaae823ead6289a12, 0x4be22a162dd43ba6) }, // 738
+  { teju_literal2(0x7444d0fda0b54f86, 0x62a91d6b66656782), teju_literal2(0xd2a8ad339d566ad2, 0xfc5449d1997ef5ab) }, // 706
+  { teju_literal2(0xb9e144d61553f018, 0x0c00f26d8d764b83), teju_literal2(0x81d41cec4fb2b28c, 0xeb851538b4ccfdaa) }, // 674
+  { teju_literal2(0xb913c34d897de8d8, 0xabbe20d426111990), teju_literal2(0xa006ac119f00c56e, 0x99cc184788fe3c57) }, // 642
+  { teju_literal2(0x24902ffb50b8c1e4, 0x377b1a708b45f7a4), teju_literal2(0xc53f526db3c67814, 0x9f4186ace5ec1e99) }, // 610
+  { teju_literal2(0x70e72028f1643759, 0xee67bb9fbca60417), teju_literal2(0xf3204a2a26cd88ac, 0x34813380616cce74) }, // 578
+  { teju_literal2(0xebb2be9f7ef255f8, 0x74ee14fb85e4719b), teju_literal2(0x95d68a4174cc87ef, 0x7f35273ac19f0a29) }, // 546
+  { teju_literal2(0x6f9b81c54875034c, 0x957c8877d790f343), teju_literal2(0xb8b08d0de54c920f, 0xed0ddb226b733962) }, // 514
+  { teju_literal2(0xdab84b25b22c639f, 0xca56fbbcd75723ad), teju_literal2(0xe3a5c74d67aead12, 0x68db4b5f56917b9d) }, // 482
+  { teju_literal2(0x4c41c5775f80662d, 0xabddaca7e9e410bb), teju_literal2(0x8c4c74396a4215ee, 0x6974bac1db5750f3) }, // 450
+  { teju_literal2(0x5be6ccb68ddfb072, 0x01f656018232a6bb), teju_literal2(0xacee7290f5bdf697, 0x2be9d71328b5cca2) }, // 418
+  { teju_literal2(0x7b4f9239d6ffb901, 0x0ecf15fa37846c38), teju_literal2(0xd5278a1f9b03e1b7, 0xb96b0a3d3ac0a531) }, // 386
+  { teju_literal2(0xd318b2d0326fe259, 0x88211f024eb988cf), teju_literal2(0x835dd7ba6ad928a1, 0xebe2da8cc415e5db) }, // 354
+  { teju_literal2(0xbfc259fa0a64cf87, 0x7c90c295457d6adf), teju_literal2(0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8) }, // 322
+  { teju_literal2(0xfeb13da03da3a72f, 0xa1be04416f774ca1), teju_literal2(0xc795830d75038c1d, 0xd59df5b9ef6a2417) }, // 290
+  { teju_literal2(0x7dc03beead508624, 0x9d74e5b7155df15b), teju_literal2(0xf6019da07f549b2b, 0x7e2a53a146606a48) }, // 258
+  { teju_literal2(0xbc2f26a194dd4e37, 0x6dfd6e29b1f45d3b), teju_literal2(0x979cf3ca6cec5b5a, 0xa705992ceecf9c42) }, // 226
+  { teju_literal2(0x1a0d1f728b9926e6, 0xa1c7a168cafa69f3), teju_literal2(0xbae0a846d2195712, 0x8974836059cca109) }, // 194
+  { teju_literal2(0xa3b561b1cb208396, 0xcdc9e1cd0bcf8d04), teju_literal2(0xe65829b3046b0afa, 0x0cb4a5a3112a5112) }, // 162
+  { teju_literal2(0xd897747ed9d851e7, 0xe089e51c58494368), teju_literal2(0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1) }, // 130
+  { teju_literal2(0x2a4cde54ca6fca27, 0x8a2749ca1633f72a), teju_literal2(0xaefae51477a06b03, 0xede622920b6b23f1) }, // 98
+  { teju_literal2(0x9214642a0b92c6a5, 0x30bb93aafa4e0e65), teju_literal2(0xd7adf884aa879177, 0x5b0ed81dcc6abb0f) }, // 66
+  { teju_literal2(0xbf967770bdf3be79, 0xd320c83fb2fe6f75), teju_literal2(0x84ec3c97da624ab4, 0xbd5af13bef0b113e) }, // 34
+  { teju_literal2(0xd70a3d70a3d70a3d, 0x70a3d70a3d70a3d7), teju_literal2(0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a3) }, // 2
+  { teju_literal2(0x0000000000000000, 0x0000000000000000), teju_literal2(0xc9f2c9cd04674ede, 0xa400000000000000) }, // -30
+  { teju_literal2(0x5329000000000000, 0x0000000000000000), teju_literal2(0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2) }, // -62
+  { teju_literal2(0xa9506688d28602dc, 0x0165d52000000000), teju_literal2(0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb) }, // -94
+  { teju_literal2(0x54bea8f289011b2a, 0x4c7fb4df0948eb64), teju_literal2(0xbd176620a501fbff, 0xb650e5a93bc3d898) }, // -126
+  { teju_literal2(0x9e16cc3016872fdb, 0xa1144f0f86b9de01), teju_literal2(0xe912b9d1478ceb17, 0x7a37cd5601aab85d) }, // -158
+  { teju_literal2(0xd671a0192ea53fcd, 0xf4f028faa0591cee), teju_literal2(0x8fa475791a569d10, 0xf96e017d694487bc) }, // -190
+  { teju_literal2(0x571fb578117cc863, 0xa34a9eb7b22a9c21), teju_literal2(0xb10d8e1456105dad, 0x7425a83e872c5f47) }, // -222
+  { teju_literal2(0x1b081050f30e0c36, 0xa1e157adf8f809a4), teju_literal2(0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e) }, // -254
+  { teju_literal2(0x5d86c07a6c671faf, 0xa79e946c200627af), teju_literal2(0x867f59a9d4bed6c0, 0x49ed8eabcccc485d) }, // -286
+  { teju_literal2(0x2b460cb3d15788dd, 0xd5d0381e91976da1), teju_literal2(0xa5c7ea73224deff3, 0x12b9b522906c0800) }, // -318
+  { teju_literal2(0x827fd7fca2916083, 0xc84685eb1511d86a), teju_literal2(0xcc573c2a0eccdaa6, 0xdfacec6f21e0bfff) }, // -350
+  { teju_literal2(0xc3f56f5509d143f7, 0xd22f1ac40290b2c8), teju_literal2(0xfbde93488e0b1727, 0xc2c28f4e98fc19f1) }, // -382
+  { teju_literal2(0x117b33ebe8a6b1e4, 0xbee425738d5cebee), teju_literal2(0x9b39fd75b4481224, 0x4b7409e1f758d93f) }, // -414
+  { teju_literal2(0x3868c2e52fd247b1, 0xeb127f6928c8eb0e), teju_literal2(0xbf54dabac7a3c775, 0x51d02485676ed232) }, // -446
+  { teju_literal2(0xed2cf66c53a41d57, 0x1c1132699144394d), teju_literal2(0xebd59075cc44a6e4, 0x78429cbdd4d2682d) }, // -478
+  { teju_literal2(0x8d0dc4dc3b9178c9, 0x201cf139bbda1d5e), teju_literal2(0x915814eaa7b76789, 0x7892ca73abb88adc) }, // -510
+  { teju_literal2(0x2603d5e386215644, 0x5ab43e95840950b0), teju_literal2(0xb326806804114241, 0x0010a31d283ab5ce) }, // -542
+  { teju_literal2(0x6123e34b7bc6c269, 0x54eba15e8ec148ed), teju_literal2(0xdcd1e5ce9df53add, 0x27943c27b5e59fb5) }, // -574
+  { teju_literal2(0x70e32ddc320e0a96, 0xd338b5cb7f2b6eed), teju_literal2(0x88173d407662dd3d, 0x316e2618615f700a) }, // -606
+  { teju_literal2(0xfe38e7e10baaa1d1, 0x5d34b530c9579d9b), teju_literal2(0xa7bead878be4a024, 0x982ef1559d5cfd95) }, // -638
+  { teju_literal2(0x1a90b0c92282261b, 0x31e5e151b8ddbdf9), teju_literal2(0xcec2efe36dee726b, 0xf30aa0ee74c776de) }, // -670
+  { teju_literal2(0x4c0b056c774f8866, 0xcdc2a3215fd76c25), teju_literal2(0xfeda6ac5471d72f0, 0x25fc7fee530bb131) }, // -702
+  { teju_literal2(0x512398cc76f96ef9, 0x71361a62469900ab), teju_literal2(0x9d10be702b290ff7, 0xcdd771e38595e5b7) }, // -734
+  { teju_literal2(0x2a09e42c098e576d, 0x6cb4dbfdf9df4963), teju_literal2(0xc1991a71aa3e45d2, 0x76775be3da9cb5a2) }, // -766
+  { teju_literal2(0x4a34a7a112ccfa6b, 0x289f2879177d9254), teju_literal2(0xeea0c6b96624a24d, 0xea5756b61c5d8ff4) }, // -798
+  { teju_literal2(0xc3ec2fd9302c9bda, 0x6da99a9f989dd7f8), teju_literal2(0x9310dd78089bd66f, 0x729a6a7e830e1cf2) }, // -830
+  { teju_literal2(0x950c7479d3dbff58, 0xd9815c420019ca48), teju_literal2(0xb545cf2018ac77de, 0x121f82b69e98e312) }, // -862
+  { teju_literal2(0xed0a2127e51b2598, 0x4341afa3079a2712), teju_literal2(0xdf6f936ca8bfd1ce, 0xc155300923590939) }, // -894
+  { teju_literal2(0x65d9311c59d394da, 0x34b211a0efd51486), teju_literal2(0x89b3f5d743dec9b8, 0x1b763e9df0c52c8f) }, // -926
+  { teju_literal2(0x56d11306acb9f21f, 0x26fe809cb78d5c61), teju_literal2(0xa9bb65548bc10a02, 0x47eee833ac2043e7) }, // -958
+  { teju_literal2(0x28851d02cf180c9a, 0xa0e62973b688fa5b), teju_literal2(0xd135faf9ee0d8a12, 0x051cbd27d450adff) }, // -990
+  { teju_literal2(0x493a9f0bd0176d7a, 0xc703045dbfe26a4f), teju_literal2(0x80efa76052da452d, 0xb150272471a0d78e) }, // -1022
+  { teju_literal2(0x16db72fbf4ad1044, 0x65b395024e767880), teju_literal2(0x9eed13110e65260f, 0x0e6aac449a164daf) }, // -1054
+  { teju_literal2(0xc0cd30cba1793aa7, 0x4a3150c391ee69df), teju_literal2(0xc3e439df7cc5e18a, 0x64b3a84e2a93009e) }, // -1086
+  { teju_literal2(0x330f6dffd8f3a13a, 0xcd268179387b0362), teju_literal2(0xf1747601053fec3e, 0x3bc9f9ba1a2f6763) }, // -1118
+  { teju_literal2(0x79b59e0ea55aa2e3, 0x64c81147f4a6fcc4), teju_literal2(0x94cedec7c0263d5c, 0xb5d274fef7216bed) }, // -1150
+  { teju_literal2(0xba4c453e56c10c1c, 0xb4e84d5a68cd4e82), teju_literal2(0xb76b8d86fc3b88fc, 0x3615970eb3f9655c) }, // -1182
+  { teju_literal2(0x276bf93f3820229d, 0xb9777b9d2f3045d4), teju_literal2(0xe2152ff7bbd30fa1, 0x4ac7153d5224f3e8) }, // -1214
+  { teju_literal2(0x52e8048ec3573502, 0x3b1af7172eb45c61), teju_literal2(0x8b559215ad82f739, 0xe4f436eb273c6143) }, // -1246
+  { teju_literal2(0xf1ea788a64b68c72, 0xd7e213619c000a8f), teju_literal2(0xabbe23ea233a276a, 0x4823958c7b5ac516) }, // -1278
+  { teju_literal2(0x0adcdf784af9d51a, 0x794437ef37727969), teju_literal2(0xd3b073b115f23ce2, 0xb88cff30df38e4bc) }, // -1310
+  { teju_literal2(0x2a6886bca09a2e46, 0xf113301d70d2c03c), teju_literal2(0x8276ad55efa1e19a, 0xb77ffd59abff116b) }, // -1342
+  { teju_literal2(0x197ec56007027341, 0xc9d4172b33cec974), teju_literal2(0xa0cf0c41fc7fc3b7, 0xa1b1f12e6ac5c7eb) }, // -1374
+  { teju_literal2(0x51c445103ae8b896, 0xe159de4c9c38c440), teju_literal2(0xc6364ddcea27c006, 0xa2b0cd84f451e05b) }, // -1406
+  { teju_literal2(0x24200645e6931736, 0x0a1516fe92a19719), teju_literal2(0xf450b7fe9cfcb00c, 0x6ffbc1b939259fd7) }, // -1438
+  { teju_literal2(0x14f5d47b9f75bc37, 0xad20d5a2a4102dad), teju_literal2(0x969228afc7fab524, 0xf390b53b0967e945) }, // -1470
+  { teju_literal2(0xe43272f436e1b60d, 0x0341b2de46b74a13), teju_literal2(0xb997cf2197bff43c, 0x8dc36a2313fdd3ce) }, // -1502
+  { teju_literal2(0x83dd1b04bf8c2931, 0xfa77f1f1c988622e), teju_literal2(0xe4c2d37f0204adf0, 0xf8c22422f0c98ed2) }, // -1534
+  { teju_literal2(0x64553af7f46e9e61, 0xccc7274ab6109206), teju_literal2(0x8cfc20cf94927d0a, 0xde1be7044f365cab) }, // -1566
+  { teju_literal2(0x65e51a304bfc9427, 0x0cea617b611a3e59), teju_literal2(0xadc6fb8f1ad2cdc1, 0xb219d831ebbbe48d) }, // -1598
+  { teju_literal2(0x18c30d9ce5b608d5, 0x5deb62d950b9e4f6), teju_literal2(0xd632708ff1494c14, 0x5b596457f6ff40ce) }, // -1630
+  { teju_literal2(0x59035fd1b10f99e2, 0x22abee271ffc2083), teju_literal2(0x84025525b1428c84, 0x24238af90ad5d155) }, // -1662
+  { teju_literal2(0xd08ed8b53d44e6f0, 0x47daa5cf61a60fc6), teju_literal2(0xa2b6bb1fde6029c6, 0x4a66cfffa6efcc6c) }, // -1694
+  { teju_literal2(0x0f64342f3fdca369, 0x21917538c1abc0ac), teju_literal2(0xc88f6b81d5c5893e, 0xf3b0366ebebac19a) }, // -1726
+  { teju_literal2(0xed813b5657358ff7, 0xd84b321cf2c44b8a), teju_literal2(0xf735a6b20da2a9df, 0xf62653deb3d35706) }, // -1758
+  { teju_literal2(0x67b1951b0552bdca, 0x13f8f56c68538d58), teju_literal2(0x985acb36202fd245, 0x3bae5cc4a0b96382) }, // -1790
+  { teju_literal2(0xfc00db20c64687c6, 0x01bcc334cf65ce2d), teju_literal2(0xbbcaa7b0064eb7ef, 0xc96b9dc6947e95ef) }, // -1822
+  { teju_literal2(0xaf98f71618ee17ed, 0xe7a6ef29198ced79), teju_literal2(0xe778965a9d01b26e, 0x0424faacba3788ba) }, // -1854
+  { teju_literal2(0x4197aae835b8fd70, 0x56e286eebd88696a), teju_literal2(0x8ea7b105d209ee87, 0x06498b8351560af5) }, // -1886
+  { teju_literal2(0x6eeb32a1725600b5, 0x7409f52dcd24ea64), teju_literal2(0xafd5fec1a85999fb, 0xd23802d659f82799) }, // -1918
+  { teju_literal2(0xd306cb477c037fcc, 0xb78509f8158ae240), teju_literal2(0xd8bc0861dd67d4cd, 0x75b99f36384816a6) }, // -1950
+  { teju_literal2(0xd00a9ad57f1836aa, 0x096ed3cc69417b6c), teju_literal2(0x8592acdbe9eeb2af, 0xfdcbf0f7123f1ea7) }, // -1982
+  { teju_literal2(0x74cc2ed7e3227cdf, 0xea6b1060f60cb94a), teju_literal2(0xa4a430fb82ddcf49, 0xe0e36da6264c5c8c) }, // -2014
+  { teju_literal2(0xbb20c238382cd109, 0x8e2fbe92dd172abe), teju_literal2(0xcaefa8261b2fd457, 0xe062c3974b039773) }, // -2046
+  { teju_literal2(0x0f0b588ad017f86d, 0x4722ce20f385bf62), teju_literal2(0xfa235c6a10ade8f4, 0x25260814608bc28f) }, // -2078
+  { teju_literal2(0xe50643fe182acb99, 0xb08ffee2d963088c), teju_literal2(0x9a28d69160f3e206, 0x09125ea8e59e549b) }, // -2110
+  { teju_literal2(0x4ad5ac17a6c7595f, 0x81208956404962b5), teju_literal2(0xbe042b2e4895ecfa, 0xb079efd364d78259) }, // -2142
+  { teju_literal2(0xcd597eadafdbbb49, 0x7e99cbcaba61d7dc), teju_literal2(0xea36912c82958e07, 0xcce0a3970285d16c) }, // -2174
+  { teju_literal2(0x72f9c14b5251992f, 0x150e3983532131d1), teju_literal2(0x905851e6befed710, 0xe8fb1798e7acee76) }, // -2206
+  { teju_literal2(0x68a161ee1624ef48, 0x2cd89d3436a0e1d2), teju_literal2(0xb1eb40381700aa9b, 0x07f0d874a281cb3c) }, // -2238
+  { teju_literal2(0xd42329f5fc382a6e, 0x1171a38d8510a922), teju_literal2(0xdb4d5237587c02db, 0x0bbd18d3e10862a7) }, // -2270
+  { teju_literal2(0x3fd39b7d27d02cff, 0xf00142643158542a), teju_literal2(0x8727c2af865f0a84, 0xa366e667b0ada1ca) }, // -2302
+  { teju_literal2(0x55c36d245ab2f426, 0x12e11731e198a881), teju_literal2(0xa6977f5a3c24811f, 0xffdb9ce214fb3d3b) }, // -2334
+  { teju_literal2(0xfed6e0dee68b7e85, 0x2e91ab500dcdf6ab), teju_literal2(0xcd571962502607ff, 0xc91845ef8a9cb003) }, // -2366
+  { teju_literal2(0xbe1a6973f3c37c0c, 0xc5089d617d0d4d97), teju_literal2(0xfd19f3c527ee43cc, 0x69f12fe7e340081f) }, // -2398
+  { teju_literal2(0xa4ce229ec62f8019, 0x03669aaa09050b62), teju_literal2(0x9bfc5b294debda29, 0x05176d45d7d49f2e) }, // -2430
+  { teju_literal2(0xc0d0b8cf8f00985a, 0xaa1d1314d62f6c5f), teju_literal2(0xc0446dd4fa82d0de, 0x132c25542e786898) }, // -2462
+  { teju_literal2(0x90ac017f76c86c6f, 0xd39b0c44e165942a), teju_literal2(0xecfcdce15c904d37, 0x19bd5641f077b5e7) }, // -2494
+  { teju_literal2(0x79c53beeb22532f5, 0xa779ab2eca9f475b), teju_literal2(0x920e12cebe9cc9b3, 0xf3bf0c98603adc32) }, // -2526
+  { teju_literal2(0xd5b89bb928e9c438, 0x69819007de30b4e1), teju_literal2(0xb406d2e171731f8d, 0x451d33f73647bae9) }, // -2558
+  { teju_literal2(0x078dab296c31580b, 0xa7d5d044675c35f2), teju_literal2(0xdde66566d3321b5c, 0x5f9bbae5d158d172) }, // -2590
+  { teju_literal2(0xa4bec49a999171b9, 0xf84f93c7cc7f5ad5), teju_literal2(0x88c1a5028f06adcb, 0x98aee5744222fac6) }, // -2622
+  { teju_literal2(0x4cc0b90e5e269656, 0x36d0420102748426), teju_literal2(0xa890b7f67ef5d307, 0xc3f9779de9ecaeaf) }, // -2654
+  { teju_literal2(0xf3f7ac50fd3cd8f2, 0x9fc2d4e7ff00cf3e), teju_literal2(0xcfc5d51088e291e7, 0x9a6470b2f14a8634) }, // -2686
+  { teju_literal2(0xe3c2ab96dfee1d8f, 0x324266f815e0240a), teju_literal2(0x800cc3d947bdfdee, 0x4f4869c3ac857052) }, // -2718
+  { teju_literal2(0x8faa9190f23ad517, 0xd4f0d2c19c9a84b5), teju_literal2(0x9dd569976b5136aa, 0x79a03b05fadaca0f) }, // -2750
+  { teju_literal2(0xbe973fc3fc9db97f, 0xcd9bf72fbf4a027c), teju_literal2(0xc28b841a0b0eb1fb, 0xa3be4d6040fb7561) }, // -2782
+  { teju_literal2(0xffb51ef1c00e550c, 0xe272902b3439966a), teju_literal2(0xefcb92b16b53cc8a, 0x9f5cd62dbc55c13d) }, // -2814
+  { teju_literal2(0x8f23026d052ad6c3, 0x6021235143c05714), teju_literal2(0x93c90348c9c4eab6, 0x54c3bd23b194ba4d) }, // -2846
+  { teju_literal2(0xbee2994c0b0f7ae8, 0xac5e02a279d2eee2), teju_literal2(0xb628c9e62dee69df, 0xc42e89468b3f85e6) }, // -2878
+  { teju_literal2(0x0118f2a5e5379500, 0x5a836a18b4773c24), teju_literal2(0xe087598d84d550f6, 0x5b1fd70f877dd3a0) }, // -2910
+  { teju_literal2(0x19bead4501874e9f, 0xa7eb8457fb0c61f8), teju_literal2(0x8a606262aacf08fd, 0xe25225274aa5b280) }, // -2942
+  { teju_literal2(0x8409a1d0dcb30202, 0x879f2576a6b08311), teju_literal2(0xaa8fecc083cd89c1, 0x84e08a6877d48cd5) }, // -2974
+  { teju_literal2(0x2e346e868555d4fa, 0xae6220e4ccc992af), teju_literal2(0xd23bf14d1eba6d97, 0xf8c9c5750baaa2d9) }, // -3006
+  { teju_literal2(0xef3f39413e858f6a, 0x751f1f4f0e4a2e81), teju_literal2(0x819119b9994513f4, 0x4b658eedf19e5177) }, // -3038
+  { teju_literal2(0xb86e71194ab0b9e7, 0xfdcef6f663045c86), teju_literal2(0x9fb412a794d410fc, 0xcb66c031aedb1845) }, // -3070
+  { teju_literal2(0x5e7b819692a5b364, 0x336e6e5ef65a9bac), teju_literal2(0xc4d982b1763944c0, 0x7b53ebd7aa2ae18a) }, // -3102
+  { teju_literal2(0xfb9fa9f7962df16b, 0xc2bc8786a2e8ad1e), teju_literal2(0xf2a2cc216b0ffcb4, 0xe97a1b3b04e5120e) }, // -3134
+  { teju_literal2(0xa3a83badc64e8970, 0xed0e947cba49f0c2), teju_literal2(0x9589330efc54e836, 0x3207f185a457ec52) }, // -3166
+  { teju_literal2(0x1b800d4095031cad, 0xb854ed9798ae4a4a), teju_literal2(0xb85138a8dc658796, 0x08f488bfdbb896a4) }, // -3198
+  { teju_literal2(0x1778f1942858c766, 0x7544486b5d053b1c), teju_literal2(0xe330469041f3e9b3, 0xc7b80ecfc49147d9) }, // -3230
+  { teju_literal2(0x5b52fe79b3730fd7, 0xbd7d00c3bab6a56a), teju_literal2(0x8c040989a3604469, 0x9b9e2decac1e211b) }, // -3262
+  { teju_literal2(0x7e75fe04148e6732, 0x895fad81dc35d5ea), teju_literal2(0xac952fdee9eeb6f0, 0x6ca63eab5349e800) }, // -3294
+  { teju_literal2(0x24ae3c52244e2a5e, 0xc84a8b30f292b8a6), teju_literal2(0xd4b9847779170806, 0xcdefdebb2571ff7c) }, // -3326
+  { teju_literal2(0x8128b429181a4bc5, 0x9325b7f87bb9096c), teju_literal2(0x831a094d518fcb35, 0xcea584812ebc3710) }, // -3358
+  { teju_literal2(0x43509d66c235813e, 0x4486d6d38b83c18f), teju_literal2(0xa19867589646cc32, 0xd7be8163def50e73) }, // -3390
+  { teju_literal2(0x9d47b4ae9065ea91, 0x0a6ee78c2fc0e98c), teju_literal2(0xc72e7e8e0136fc28, 0xa5ffe5ce688ff978) }, // -3422
+  { teju_literal2(0xdcab6088a77cac61, 0xc092ce259457e0ac), teju_literal2(0xf582a3037bb659bf, 0xcf73cb0e0783800e) }, // -3454
+  { teju_literal2(0xc90c4ec15c21a357, 0x65a4b25526194979), teju_literal2(0x974eb20b241a65f6, 0xd91c86512d147305) }, // -3486
+  { teju_literal2(0xb1b0ebaf7858afd2, 0x731c3acc00e919e8), teju_literal2(0xba8032c6d6b45a78, 0x46b091a6f52cabac) }, // -3518
+  { teju_literal2(0x41fe39abe0373b3c, 0x91b57191715808b7), teju_literal2(0xe5e1449c558e558e, 0xf3d592c1d6b30174) }, // -3550
+  { teju_literal2(0x4d76f8695cd8bac0, 0xb0310e62d1ab3632), teju_literal2(0x8daca95deafad994, 0x36d33e6fd8338719) }, // -3582
+  { teju_literal2(0xd3ebacf619ad12b7, 0xc5af0c990d38e6a6), teju_literal2(0xaea093af5c5f50cc, 0xd2d6f51e4a7d8bd2) }, // -3614
+  { teju_literal2(0xb6804aa6dff7af2d, 0x4d6f885c302f11f1), teju_literal2(0xd73ea532d8d1a2b4, 0x5203bc96f9aa8a4a) }, // -3646
+  { teju_literal2(0x86d665171c0d2162, 0x98cc0204293f01b5), teju_literal2(0x84a7a0880a5f79da, 0xa65e01860b15ec78) }, // -3678
+  { teju_literal2(0xbe56177662538e52, 0xc207cc3c64c54456), teju_literal2(0xa38278dcc618c1cd, 0x4490b14b2f6c8741) }, // -3710
+  { teju_literal2(0x27ab1718db124b2d, 0x1e18220e8a1df9f2), teju_literal2(0xc98a8ce1f8da1415, 0xadda65275318f02c) }, // -3742
+  { teju_literal2(0x069587b8888a4159, 0x473d966a40cb3473), teju_literal2(0xf86b31780bacd1b8, 0xa68c9f0aa8284894) }, // -3774
+  { teju_literal2(0x783f7dd114749592, 0x0e4a7b7952a863ee), teju_literal2(0x991990575177efb8, 0xef95b6f71810d097) }, // -3806
+  { teju_literal2(0x7eb695bf77ac53e9, 0x846d3681a2790449), teju_literal2(0xbcb5cc18f2e95b6d, 0x805b4230b0947e1e) }, // -3838
+  { teju_literal2(0xe535589b687d7971, 0x381291e316e7f738), teju_literal2(0xe89a6c285cd8ebbe, 0x20dc15f7eae6cf76) }, // -3870
+  { teju_literal2(0x6cbb545f1e85d02d, 0xce936b2b98b9f5df), teju_literal2(0x8f5a50f323e7157b, 0x51bc3969fc9e9639) }, // -3902
+  { teju_literal2(0x64abdd48579c7126, 0xc5a9f98a6fc1a880), teju_literal2(0xb0b22ac738d82144, 0xdf5cdd3530e5a7be) }, // -3934
+  { teju_literal2(0x6e57ab8c35ba8f75, 0x7d2df51cb313105e), teju_literal2(0xd9cb6a6725f76eba, 0xb885305032877568) }, // -3966
+  { teju_literal2(0xed036b9b8d033d19, 0x9f7b38dcabe0e535), teju_literal2(0x8639ed87ad038d0a, 0xe9d4ce7c7ef6991d) }, // -3998
+  { teju_literal2(0x3f211aada0433e6b, 0x459980be36aeb470), teju_literal2(0xa572589aa1a56b4f, 0x4a78b88f1bf1954a) }, // -4030
+  { teju_literal2(0x23ab5f418d113b1f, 0x521b38b6cd2f5f2b), teju_literal2(0xcbedc31ff23d1035, 0x750ccea549330347) }, // -4062
+  { teju_literal2(0xa09732cfb3973647, 0x81beadce6e02c570), teju_literal2(0xfb5c91eec5487022, 0x49572570005f17c5) }, // -4094
+  { teju_literal2(0xf20e9c44c871cceb, 0x6b7488183b6dc406), teju_literal2(0x9ae9de3e69c094dd, 0x3700a3e9a1bb2afb) }, // -4126
+  { teju_literal2(0xb22c28f6a5e137a9, 0x93b5eb60eb8c608f), teju_literal2(0xbef218b437abfeee, 0xcfc31e8114f8aa04) }, // -4158
+  { teju_literal2(0x57a37fd6755e11e0, 0xc5dfe39b329ecfd8), teju_literal2(0xeb5bd5f525981c3e, 0xe929c0b68d5be9b1) }, // -4190
+  { teju_literal2(0x7962bf13d6f22db5, 0xf7a99f0d95f58530), teju_literal2(0x910d0f8aa97f56bf, 0xb33e237394a31bf1) }, // -4222
+  { teju_literal2(0x6bcc13674d4592f1, 0x1c528235f687f341), teju_literal2(0xb2ca07f438aef9ec, 0xd7a603b5b6f3e543) }, // -4254
+  { teju_literal2(0x6cd8f68c0edbd063, 0x8ccffb0c8e097644), teju_literal2(0xdc5feb41bffdae21, 0x55a8a4911e075ea7) }, // -4286
+  { teju_literal2(0x5d2dcb4e7326d68a, 0x0c29995463b2ffa6), teju_literal2(0x87d0fe94f2aa46b8, 0x9d37fc4ebfd8ada2) }, // -4318
+  { teju_literal2(0x18fcadc23aef7288, 0x469b2b79db68e0f8), teju_literal2(0xa768182d6b5d9561, 0xd505369c2c72bac8) }, // -4350
+  { teju_literal2(0xfcb643a7da6a00b7, 0x85ab4ef744c2dfd2), teju_literal2(0xce5836fb8db586b7, 0x7a4ed4470b61e857) }, // -4382
+  { teju_literal2(0x93f66f3994860322, 0x7dced031827af450), teju_literal2(0xfe56df277f183cbf, 0xaf7ed7fc590c388f) }, // -4414
+  { teju_literal2(0xc3d1e1f93a764cec, 0x9555f40ac899305c), teju_literal2(0x9cbfac3cbb4f5fa4, 0xb057ef6aa23ec543) }, // -4446
+  { teju_literal2(0x2983c619180e67b1, 0xff50f5dc924660b7), teju_literal2(0xc1352cea92c63253, 0xe1fba74b8074bdb7) }, // -4478
+  { teju_literal2(0xab980105d039e8ec, 0xd796bb7a72a4c4f7), teju_literal2(0xee259b0e8f1efac6, 0x8e2fb5245f9771d5) }, // -4510
+  { teju_literal2(0x7f64eed5d172c4a0, 0xf3ecc54b9e1e5024), teju_literal2(0x92c4f4941ad9e55b, 0x6746a80e06633a65) }, // -4542
+  { teju_literal2(0xeed8e1211ea1c304, 0xc283a94a7d80fd13), teju_literal2(0xb4e83e3d1bc12c1a, 0x36b447962eed0255) }, // -4574
+  { teju_literal2(0x3619618ed4722736, 0x48c1bac219999165), teju_literal2(0xdefc3f36506d3fec, 0x27a13e6894009876) }, // -4606
+  { teju_literal2(0xe9dd51cee9931b6f, 0xb403b55eca21fbe9), teju_literal2(0x896ce223e6369f70, 0x52befb9d2797f410) }, // -4638
+  { teju_literal2(0xb247e87804640584, 0x4242c0d124f186da), teju_literal2(0xa963c965cad03a20, 0x9b6f1df97054e406) }, // -4670
+  { teju_literal2(0xccda6b36f5f95443, 0x4eed8b07b41fae04), teju_literal2(0xd0c9fe6a3c1622cd, 0x9cd9b498821b59ae) }, // -4702
+  { teju_literal2(0xf03a610d870a7ff0, 0x51c8ae3d44e5ac67), teju_literal2(0x80ad1a1997846aee, 0x0ca29e253828a506) }, // -4734
+  { teju_literal2(0x8b72c5ec92d6aad6, 0x0b161ed0add26b88), teju_literal2(0x9e9b0b00935fea23, 0x601afd6a8dffc696) }, // -4766
+  { teju_literal2(0xce47d362465aedf2, 0x3dc1aa97ef68a879), teju_literal2(0xc37f1d4b91d76d25, 0x91f1f9c45089f208) }, // -4798
+  { teju_literal2(0xdc9a1bacd00ece88, 0x2720e48b496faacf), teju_literal2(0xf0f7d4cc6df8202e, 0xa24d702072eaae4a) }, // -4830
+  { teju_literal2(0x93f287aadc2bbac1, 0x54dc8cbaf7279023), teju_literal2(0x94820fade7175045, 0x896251341146f4b0) }, // -4862
+  { teju_literal2(0x48d5dccf395b984f, 0x6bc69f69e982259c), teju_literal2(0xb70ce0e2556456b4, 0xf2b78b3a09fe163a) }, // -4894
+  { teju_literal2(0xc10c20f8de36ae48, 0x52c8c534bc57a0b1), teju_literal2(0xe1a07dffa00d11cb, 0xf70144f5fae5f431) }, // -4926
+  { teju_literal2(0xc9f78957c1debaf9, 0x9d3e2a35dfd9baf0), teju_literal2(0x8b0da6d4679fe855, 0x61e942ddb7eb3ee0) }, // -4958
+};
+
+static teju_constexpr const teju_u1_t pow5[] = {
+  teju_literal2(0x0000000000000000, 0x0000000000000001), // 0
+  teju_literal2(0x0000000000000000, 0x0000000000000005), // 1
+  teju_literal2(0x0000000000000000, 0x0000000000000019), // 2
+  teju_literal2(0x0000000000000000, 0x000000000000007d), // 3
+  teju_literal2(0x0000000000000000, 0x0000000000000271), // 4
+  teju_literal2(0x0000000000000000, 0x0000000000000c35), // 5
+  teju_literal2(0x0000000000000000, 0x0000000000003d09), // 6
+  teju_literal2(0x0000000000000000, 0x000000000001312d), // 7
+  teju_literal2(0x0000000000000000, 0x000000000005f5e1), // 8
+  teju_literal2(0x0000000000000000, 0x00000000001dcd65), // 9
+  teju_literal2(0x0000000000000000, 0x00000000009502f9), // 10
+  teju_literal2(0x0000000000000000, 0x0000000002e90edd), // 11
+  teju_literal2(0x0000000000000000, 0x000000000e8d4a51), // 12
+  teju_literal2(0x0000000000000000, 0x0000000048c27395), // 13
+  teju_literal2(0x0000000000000000, 0x000000016bcc41e9), // 14
+  teju_literal2(0x0000000000000000, 0x000000071afd498d), // 15
+  teju_literal2(0x0000000000000000, 0x0000002386f26fc1), // 16
+  teju_literal2(0x0000000000000000, 0x000000b1a2bc2ec5), // 17
+  teju_literal2(0x0000000000000000, 0x000003782dace9d9), // 18
+  teju_literal2(0x0000000000000000, 0x00001158e460913d), // 19
+  teju_literal2(0x0000000000000000, 0x000056bc75e2d631), // 20
+  teju_literal2(0x0000000000000000, 0x0001b1ae4d6e2ef5), // 21
+  teju_literal2(0x0000000000000000, 0x000878678326eac9), // 22
+  teju_literal2(0x0000000000000000, 0x002a5a058fc295ed), // 23
+  teju_literal2(0x0000000000000000, 0x00d3c21bcecceda1), // 24
+  teju_literal2(0x0000000000000000, 0x0422ca8b0a00a425), // 25
+  teju_literal2(0x0000000000000000, 0x14adf4b7320334b9), // 26
+  teju_literal2(0x0000000000000000, 0x6765c793fa10079d), // 27
+  teju_literal2(0x0000000000000002, 0x04fce5e3e2502611), // 28
+  teju_literal2(0x000000000000000a, 0x18f07d736b90be55), // 29
+  teju_literal2(0x0000000000000032, 0x7cb2734119d3b7a9), // 30
+  teju_literal2(0x00000000000000fc, 0x6f7c40458122964d), // 31
+};
+
+static teju_constexpr const uint32_t corrections[] = {
+  0xaaaa9a65,
+  0xa5aa9aaa,
+  0x9a95a599,
+  0x6aa5a6aa,
+  0xaa6aaaa9,
+  0xa69a66aa,
+  0xa5595a55,
+  0x669559a5,
+  0x65555595,
+  0x56555559,
+  0x55555555,
+  0x59556556,
+  0xeaaeaae9,
+  0xeaaaaaae,
+  0xaaaaaaa9,
+  0xaa6596aa,
+  0x666956a5,
+  0x5aa55595,
+  0xa6a65aa9,
+  0x966a5565,
+  0x69aa6a69,
+  0xa996aeaa,
+  0x9a956695,
+  0x6a556699,
+  0xa95aa595,
+  0x569aaaaa,
+  0x9a565965,
+  0xa9aaa966,
+  0x55555555,
+  0x55656555,
+  0x55565555,
+  0x55565555,
+  0xaa9aaaa9,
+  0xb9a66eaa,
+  0x69a66a65,
+  0xa969966a,
+  0x55555555,
+  0x55555555,
+  0x55556555,
+  0x55555659,
+  0xa9669969,
+  0xaa9a6a5a,
+  0x9aa5aaa9,
+  0xa96aaba6,
+  0x56a55955,
+  0x66aa6a56,
+  0x55555555,
+  0x55655555,
+  0xa99955a9,
+  0x6969a56a,
+  0x6a55a965,
+  0x59659956,
+  0xeaeaaa69,
+  0xbeaaeeba,
+  0x599996a5,
+  0xa5599699,
+  0x66969555,
+  0x9a5555a5,
+  0x56a65959,
+  0x96669a55,
+  0x659a6595,
+  0x69aa5669,
+  0x55555555,
+  0x65955555,
+  0x95955a55,
+  0x65956555,
+  0xe6aa9aa9,
+  0x69aaaaba,
+  0xaaaaaaa9,
+  0xa966a55a,
+  0x569a5555,
+  0x55555555,
+  0xaaafaab9,
+  0xa9abaabe,
+  0x69a65a69,
+  0x9966a6a9,
+  0x55555555,
+  0x55555695,
+  0x69a565a9,
+  0xa5655556,
+  0x6aaa9eb9,
+  0xaaeaaaaa,
+  0xa96a9659,
+  0x6aa665a5,
+  0xaa9669a9,
+  0xaa9969e6,
+  0x95999aa5,
+  0xa6a6a966,
+  0x59555565,
+  0x59a55555,
+  0x96666a59,
+  0x9559a5a6,
+  0xeaae9aa9,
+  0xa5a6aeba,
+  0xa9aa9aa9,
+  0xaaaaa6aa,
+  0x6969a665,
+  0x9a695696,
+  0x96555555,
+  0x96555655,
+  0xaaabaea9,
+  0xbaaaaaaa,
+  0x55555555,
+  0x69555695,
+  0x595555a5,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0x99a9a999,
+  0xaa6aa695,
+  0xa5a69665,
+  0x55565955,
+  0xa56a6565,
+  0x6996aa65,
+  0x59699a55,
+  0x59566a65,
+  0x6aaa9669,
+  0xaa9aa956,
+  0x69aa65a5,
+  0x96a5556a,
+  0xa966aa65,
+  0xaa95959a,
+  0x95aaaa55,
+  0x96a96566,
+  0x55555595,
+  0x56996555,
+  0xaae79ab9,
+  0xaaabaeba,
+  0x55555655,
+  0x55565555,
+  0xaa699565,
+  0x96aaa5aa,
+  0xaaa59aa9,
+  0x6aaaa9aa,
+  0x59665565,
+  0xa665a955,
+  0x55555555,
+  0x55555555,
+  0xaaebaaa5,
+  0xaaa79aaa,
+  0xaaa6aeb9,
+  0xaaaaaaaa,
+  0x9666a569,
+  0xa5a9695a,
+  0x65956565,
+  0x6a5a9965,
+  0x55955555,
+  0x55965569,
+  0xaaa9aaa9,
+  0x9aaaaa5a,
+  0x9aaa6aa9,
+  0x966aa996,
+  0xaa9a59a9,
+  0xaaaa9aa9,
+  0xa9a6aa69,
+  0xaa69a699,
+  0x55559655,
+  0x56695aa9,
+  0x969aaae5,
+  0x59aa6965,
+  0x7aabeeb9,
+  0xaebaaaae,
+  0x6aaaea99,
+  0x9aaaa9aa,
+  0x6a556599,
+  0x6a6a9a66,
+  0x65565595,
+  0x965699a5,
+  0x56a59aa5,
+  0x956a9656,
+  0xa5565595,
+  0xa996a9aa,
+  0x55555555,
+  0x55555565,
+  0x55559555,
+  0x65555959,
+  0x55695565,
+  0x55555595,
+  0x5aa96995,
+  0x9965a69a,
+  0x7aaaaba9,
+  0xaaa9aaa9,
+  0x5aa95559,
+  0x969a6aa6,
+  0x65555555,
+  0x55555555,
+  0xaaabaea9,
+  0xbeebe7ea,
+  0x5556a555,
+  0xa569a555,
+  0xa5aaa5a5,
+  0xa6965995,
+  0x55955595,
+  0x55555555,
+  0xaa69aaa9,
+  0xa9aaa6ae,
+  0xaa6a99a9,
+  0xaaaa6aaa,
+  0xaaaabaa9,
+  0xa69aaa69,
+  0xaaaaaaa9,
+  0x9aaaa69a,
+  0x9a665995,
+  0x65566555,
+  0x96959a95,
+  0xa656a956,
+  0xb9aaaab9,
+  0xb9aaaaaa,
+  0x9a655599,
+  0x5659aa66,
+  0x55555955,
+  0x59555595,
+  0x6a595965,
+  0x6aaa9555,
+  0x55559555,
+  0x9a95696a,
+  0x55555655,
+  0x55555555,
+  0x55555555,
+  0x55565555,
+  0xa5aaaa99,
+  0x96a9aa99,
+  0x55555655,
+  0xa5555565,
+  0x95995565,
+  0x65a95955,
+  0x55665555,
+  0x56a69555,
+  0x9a566555,
+  0x559a9a66,
+  0x65555995,
+  0x55595556,
+  0xa59669a9,
+  0xa9969a6a,
+  0x99699aa9,
+  0xaaaaaaaa,
+  0x959655a9,
+  0xa99559aa,
+  0xfbaeaaa9,
+  0xb9aaaaae,
+  0x5a5655a5,
+  0x55555656,
+  0xaaa9aaa5,
+  0xaa59aa96,
+  0x99555955,
+  0x99a56a55,
+  0xa9969aa9,
+  0xaaa5965a,
+  0x6e69aaa9,
+  0x997aa9aa,
+  0x55555555,
+  0x55555555,
+  0xaaaa99a9,
+  0xa9a66a6a,
+  0x5a596655,
+  0x55555565,
+  0x55659aa5,
+  0x565aa599,
+  0xaaa6aa69,
+  0xaaaa9eaa,
+  0x55565655,
+  0x55665559,
+  0x69595595,
+  0x595aa559,
+  0xa6aa69a9,
+  0x55a69969,
+  0xa9aaaaa9,
+  0xbaaaaaae,
+  0x55559555,
+  0x55956555,
+  0x59655565,
+  0x55556955,
+  0x59555555,
+  0x55655955,
+  0xa9aa9699,
+  0xa96aaaaa,
+  0xa66a6995,
+  0xaaaa6aa6,
+  0x55555555,
+  0x55555695,
+  0x99a56559,
+  0x6a955555,
+  0x55595555,
+  0x55555969,
+  0xebaaaea9,
+  0xaaaaeeaa,
+  0xaaaaaaa9,
+  0xaa69aaaa,
+  0x55665665,
+  0x559a959a,
+  0xa5956a99,
+  0x96559555,
+  0xbae6aaa9,
+  0xbaebaaaa,
+  0x996aa6a9,
+  0xaebaaaa6,
+  0x5655a595,
+  0x559a6565,
+  0x56569955,
+  0xa966a655,
+  0x65a55655,
+  0x95655555,
+  0x5aa555a5,
+  0xaa96a65a,
+  0xeafffeb9,
+  0xaaeaaaaf,
+  0xaaaaaaa5,
+  0xaaaaaaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55655555,
+  0x9565555a,
+  0x5a5955a5,
+  0x5999a669,
+  0x55555555,
+  0x55555569,
+  0x6aa9aa69,
+  0xaaa6a6a9,
+  0x65565955,
+  0x55595565,
+  0x56955595,
+  0x55955555,
+  0x69a66965,
+  0x99559666,
+  0x59aaa6a9,
+  0xa69aa695,
+  0x6656a555,
+  0x69699699,
+  0x6aaa59b9,
+  0xaaeaa69a,
+  0xaaa9a6a9,
+  0xaaa9aaa6,
+  0xaa666955,
+  0xa6aa66a9,
+  0x66aaaab9,
+  0x6aab9ab9,
+  0xaaa996a9,
+  0xaaaaaaaa,
+  0x6a665695,
+  0xaa9a66a6,
+  0x5a5a9965,
+  0x6a965a5a,
+  0xb9aaaa99,
+  0xa9a5a65e,
+  0x55555555,
+  0x65555556,
+  0x5a666a65,
+  0x65a559a5,
+  0x55555595,
+  0x55555555,
+  0xa5559555,
+  0x59655555,
+  0x95995555,
+  0x55659965,
+  0x6aaaae65,
+  0xbaeaaeaa,
+  0xaaa997a9,
+  0x9a6aa7aa,
+  0xaaa5aa95,
+  0x9a5a6aa6,
+  0x55555995,
+  0x55555555,
+  0x56599555,
+  0xa555565a,
+  0x55556595,
+  0x5555a566,
+  0xa959a9a9,
+  0xa995aaaa,
+  0x99596555,
+  0xa5599955,
+  0xaea9aa99,
+  0xaa7aaaab,
+  0x966aaaa5,
+  0x9a666569,
+  0xaaabaaa5,
+  0xbaaaaaaa,
+  0x55555555,
+  0x69595555,
+  0x55aaa665,
+  0xa65a6659,
+  0xaa9aaaa9,
+  0x6aaaa9aa,
+  0x55555555,
+  0x55555555,
+  0x9a655955,
+  0x56655565,
+  0xaaa569a5,
+  0x6aaa6959,
+  0x65566955,
+  0x55555a55,
+  0xaa66a595,
+  0xa69669a5,
+  0x69aa55a9,
+  0xaaaa5659,
+  0x55555555,
+  0x95555555,
+  0x99a5a9a9,
+  0x9aa99556,
+  0xa99569a9,
+  0x55566565,
+  0xa5969595,
+  0x6595a9a9,
+  0x65599595,
+  0x65959555,
+  0x59a66959,
+  0x55699555,
+  0xfaeebeb9,
+  0xbaeaaaaa,
+  0x55556555,
+  0x56a555aa,
+  0x95559695,
+  0x69566556,
+  0xa5695aa5,
+  0x9a965965,
+  0x55595695,
+  0x55555655,
+  0x6569aa95,
+  0x5655aa95,
+  0x565a6569,
+  0xa59569a9,
+  0x55555555,
+  0x55555555,
+  0xa9aa9595,
+  0x696a665a,
+  0x55555555,
+  0x555555a5,
+  0xfbefbeb9,
+  0x7aebaeba,
+  0xb9eaaaa9,
+  0xaaaaeaaa,
+  0x55659655,
+  0x55555555,
+  0xaaaa55a5,
+  0x6a969956,
+  0x55656aa5,
+  0x699566a5,
+  0x556a9655,
+  0x55695555,
+  0x6aa555a5,
+  0x669569a6,
+  0xa9a69a69,
+  0xa9aaaa6a,
+  0xa66aaa59,
+  0xa9aaaa6a,
+  0xaa6a9965,
+  0x6aaa6aaa,
+  0xffaaae79,
+  0xaaaaaeba,
+  0x56a569a5,
+  0x95a5a66a,
+  0x96666699,
+  0x596aa5a5,
+  0x569aa5a5,
+  0x5a695669,
+  0x695a9995,
+  0x55a5a966,
+  0x96a56699,
+  0x59a99966,
+  0xa95a6665,
+  0x66a6a95a,
+  0x6aa6a699,
+  0x69aa596a,
+  0x6666aaa5,
+  0xaaaa9a99,
+  0x66aa5655,
+  0x9699a6a5,
+  0x69555555,
+  0x55565555,
+  0x956a6555,
+  0xa9599a66,
+  0x55655955,
+  0x55965569,
+  0xfbefaef9,
+  0xfaeaaaba,
+  0x95999aa5,
+  0x669a95a9,
+  0x55595565,
+  0xa55a9595,
+  0x95659965,
+  0x5a955555,
+  0x55555a55,
+  0x55955555,
+  0x55996aa9,
+  0x5966aa69,
+  0xaa566655,
+  0x5a9a65aa,
+  0xeaea9a65,
+  0xa9aaaaba,
+  0x59566995,
+  0xa9699aa5,
+  0x9aaaa5a5,
+  0xa6aaaaaa,
+  0x6599a595,
+  0x56966555,
+  0xa5555955,
+  0x55555595,
+  0x9a7aaaa9,
+  0xaaaa69aa,
+  0x55555555,
+  0x55555555,
+  0xaaa9a6a9,
+  0xa6a6aa5a,
+  0x9aaaaaa9,
+  0xaa6ae69a,
+  0x65556565,
+  0x5555555a,
+  0x56565a65,
+  0x96a56955,
+  0xaaaa96a9,
+  0x5aa9abaa,
+  0x99a9a5a9,
+  0x96a9a9ab,
+  0xaaaaaaa5,
+  0x65aaaaaa,
+  0xaaaaaea9,
+  0xaaaaaa9e,
+  0x95699595,
+  0x555a9695,
+  0xaa9aa6a9,
+  0x9a6aaa95,
+  0x99565555,
+  0x59565956,
+  0x997aea99,
+  0xae6aaaa6,
+  0x6655a5a5,
+  0x56556aaa,
+  0x55555555,
+  0x555a5555,
+  0xaaaaaa69,
+  0x66aaaa5a,
+  0x555a5555,
+  0x55a669a6,
+  0x55569555,
+  0x65555555,
+  0x9a655a95,
+  0x9a556996,
+  0x9966a699,
+  0x6a56a9aa,
+  0x55656969,
+  0x995a5556,
+  0xa99669a9,
+  0xaaabaa6a,
+  0x5a699955,
+  0x9965a655,
+  0x95995aa5,
+  0x95955a56,
+  0xa9969aa9,
+  0x95a6a96a,
+  0xa95a6555,
+  0xa6aa96aa,
+  0x55955555,
+  0x55555555,
+  0x55555955,
+  0x59955555,
+  0xa69a5a55,
+  0x59669695,
+  0x55659699,
+  0x956a5955,
+  0xaa556555,
+  0x9955a695,
+  0x55555555,
+  0x55555555,
+  0x9aaaa6a9,
+  0xaaaaa9aa,
+  0x56aa5aa5,
+  0x59699aa6,
+  0x56aaa9a5,
+  0xaaa69ab9,
+  0x69665665,
+  0x555995a5,
+  0x55555555,
+  0x55596659,
+  0x55555555,
+  0x55555655,
+  0xaaaa5a65,
+  0x6a9aaa9a,
+  0x59555a55,
+  0x65555655,
+  0x95996655,
+  0x9965966a,
+  0xaaaa6aa5,
+  0xa9a6aa9a,
+  0x55555565,
+  0xa5555555,
+  0x55555565,
+  0x55555955,
+  0x55569a55,
+  0x95955969,
+  0x56655569,
+  0x595a9559,
+  0x6a9aa6a5,
+  0xaaaaaaa9,
+  0xaa5aaa95,
+  0x66aaa6aa,
+  0x55696595,
+  0x59596565,
+  0x55555695,
+  0x95999556,
+  0x96956a69,
+  0xa995a955,
+  0x5a96aaa5,
+  0x6a6966aa,
+  0x96959a55,
+  0x6a665565,
+  0x96559665,
+  0x69a99569,
+  0xa9aa6a69,
+  0x659a5a99,
+  0x6a556665,
+  0x6669a6a5,
+  0x55555555,
+  0xa6955555,
+  0x00029a55,
+};
+
+#define teju_calculation_sorted 0u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xffffffffffffffff, 0xffffffffffffffff) }, // 0
+  { teju_literal2(0xcccccccccccccccc, 0xcccccccccccccccd), teju_literal2(0x3333333333333333, 0x3333333333333333) }, // 1
+  { teju_literal2(0x28f5c28f5c28f5c2, 0x8f5c28f5c28f5c29), teju_literal2(0x0a3d70a3d70a3d70, 0xa3d70a3d70a3d70a) }, // 2
+  { teju_literal2(0x6e978d4fdf3b645a, 0x1cac083126e978d5), teju_literal2(0x020c49ba5e353f7c, 0xed916872b020c49b) }, // 3
+  { teju_literal2(0x495182a9930be0de, 0xd288ce703afb7e91), teju_literal2(0x0068db8bac710cb2, 0x95e9e1b089a02752) }, // 4
+  { teju_literal2(0xdb76b3bb83cf2cf9, 0x5d4e8fb00bcbe61d), teju_literal2(0x0014f8b588e368f0, 0x8461f9f01b866e43) }, // 5
+  { teju_literal2(0xc57e23f24d8fd5cb, 0x790fb65668c26139), teju_literal2(0x000431bde82d7b63, 0x4dad31fcd24e160d) }, // 6
+  { teju_literal2(0xc1193a63a91cc45b, 0xe5032477ae8d46a5), teju_literal2(0x0000d6bf94d5e57a, 0x42bc3d3290760469) }, // 7
+  { teju_literal2(0xf36b7213ee9f5a78, 0xc767074b22e90e21), teju_literal2(0x00002af31dc46118, 0x73bf3f70834acdae) }, // 8
+  { teju_literal2(0x97157d372fb9787e, 0x8e47ce423a2e9c6d), teju_literal2(0x0000089705f4136b, 0x4a59731680a88f89) }, // 9
+  { teju_literal2(0x516ab2a4a3251819, 0x4fa7f60d3ed61f49), teju_literal2(0x000001b7cdfd9d7b, 0xdbab7d6ae6881cb5) }, // 10
+  { teju_literal2(0x76aef08753d43805, 0x0fee64690c913975), teju_literal2(0x00000057f5ff85e5, 0x92557f7bc7b4d28a) }, // 11
+  { teju_literal2(0xb156301b10c40b34, 0x3662e0e1cf503eb1), teju_literal2(0x000000119799812d, 0xea11197f27f0f6e8) }, // 12
+  { teju_literal2(0x2377a3389cf4023d, 0xa47a2cf9f6433fbd), teju_literal2(0x0000000384b84d09, 0x2ed0384ca19697c8) }, // 13
+  { teju_literal2(0x0717ed71b8fd9a0c, 0x54186f653140a659), teju_literal2(0x00000000b424dc35, 0x095cd80f538484c1) }, // 14
+  { teju_literal2(0xce37fc49f1cc5202, 0x7738164770402145), teju_literal2(0x0000000024075f3d, 0xceac2b3643e74dc0) }, // 15
+  { teju_literal2(0xf60b3275305c1066, 0xe4a4d1417cd9a041), teju_literal2(0x000000000734aca5, 0xf6226f0ada6175f3) }, // 16
+  { teju_literal2(0x6468a3b109ac0347, 0xc75429d9e5c5200d), teju_literal2(0x000000000170ef54, 0x646d496892137dfd) }, // 17
+  { teju_literal2(0xe0e1ba569b88cd74, 0xc1773b91fac10669), teju_literal2(0x000000000049c977, 0x47490eae839d7f99) }, // 18
+  { teju_literal2(0x93605877b8b4f5e4, 0x26b172506559ce15), teju_literal2(0x00000000000ec1e4, 0xa7db69561a52b31e) }, // 19
+  { teju_literal2(0x83e011b18b576460, 0xd489e3a9addec2d1), teju_literal2(0x000000000002f394, 0x219248446baa23d2) }, // 20
+  { teju_literal2(0x4d9336bd1bde4746, 0x90e860bb892c8d5d), teju_literal2(0x000000000000971d, 0xa05074da7beed3f6) }, // 21
+  { teju_literal2(0xdc50a48c38c60e41, 0x502e79bf1b6f4f79), teju_literal2(0x0000000000001e39, 0x2010175ee5962a64) }, // 22
+  { teju_literal2(0x9276874f3e8e02d9, 0xdcd618596be30fe5), teju_literal2(0x000000000000060b, 0x6cd004ac94513bad) }, // 23
+  { teju_literal2(0xea17b4a972e933c5, 0x2c2ad1ab7bfa3661), teju_literal2(0x0000000000000135, 0x7c299a88ea76a589) }, // 24
+  { teju_literal2(0xfb9e575516fb70c1, 0x08d55d224bfed7ad), teju_literal2(0x000000000000003d, 0xe5a1ebb4fbb1544e) }, // 25
+  { teju_literal2(0x658611776aff168d, 0x01c445d3a8cc9189), teju_literal2(0x000000000000000c, 0x612062576589dda9) }, // 26
+  { teju_literal2(0xe11ad04b156637b5, 0xcd27412a54f5b6b5), teju_literal2(0x0000000000000002, 0x79d346de4781f921) }, // 27
+  { teju_literal2(0xf9d229a89de13e57, 0x8f6e403baa978af1), teju_literal2(0x0000000000000000, 0x7ec3daf941806506) }, // 28
+  { teju_literal2(0x31f6d521b92d0c77, 0xe97c733f221e4efd), teju_literal2(0x0000000000000000, 0x195a5efea6b34767) }, // 29
+  { teju_literal2(0xa397c439f1d5cf4b, 0x2eb27d7306d2dc99), teju_literal2(0x0000000000000000, 0x051212ffbaf0a7e1) }, // 30
+  { teju_literal2(0xed84c0d863912975, 0x6fbd4c4a34909285), teju_literal2(0x0000000000000000, 0x01039d66589687f9) }, // 31
+  { teju_literal2(0x62b42691ad836eb1, 0x16590f420a835081), teju_literal2(0x0000000000000000, 0x0033ec47ab514e65) }, // 32
+  { teju_literal2(0x46f0d483891a4956, 0x9e11cfda021a434d), teju_literal2(0x0000000000000000, 0x000a6274bbdd0fad) }, // 33
+  { teju_literal2(0xa7c9c41a4e9edb77, 0xb936c32b9a0540a9), teju_literal2(0x0000000000000000, 0x000213b0f25f6989) }, // 34
+  { teju_literal2(0x87f52738761fc57e, 0x583e2708b8677355), teju_literal2(0x0000000000000000, 0x00006a5696dfe1e8) }, // 35
+  { teju_literal2(0xe7fdd4a4e46cc119, 0x44d93b01be7b1711), teju_literal2(0x0000000000000000, 0x0000154484932d2e) }, // 36
+  { teju_literal2(0xc7ff90edc748f36b, 0x742b72338c7f049d), teju_literal2(0x0000000000000000, 0x00000440e750a2a2) }, // 37
+  { teju_literal2(0x8e66502f8e41ca48, 0xb0d57d3d827fcdb9), teju_literal2(0x0000000000000000, 0x000000d9c7dced53) }, // 38
+  { teju_literal2(0x4fae100982d9f541, 0xbcf77f72b3b32925), teju_literal2(0x0000000000000000, 0x0000002b8e5f62aa) }, // 39
+  { teju_literal2(0xa98936684d5ecaa6, 0xbf64b316f0bd6ea1), teju_literal2(0x0000000000000000, 0x00000008b61313bb) }, // 40
+  { teju_literal2(0x21e83e14dc462887, 0xbfe0f09e3025e2ed), teju_literal2(0x0000000000000000, 0x00000001be03d0bf) }, // 41
+  { teju_literal2(0x6d2e72d0f8dad4e7, 0xf32cfcec700793c9), teju_literal2(0x0000000000000000, 0x000000005933f68c) }, // 42
+  { teju_literal2(0x7c3c7d5cfe922a94, 0xca3c3295b00183f5), teju_literal2(0x0000000000000000, 0x0000000011d7314f) }, // 43
+  { teju_literal2(0x18d8e5df661d3bb7, 0x5ba5a3b78999e731), teju_literal2(0x0000000000000000, 0x0000000003917043) }, // 44
+  { teju_literal2(0x9e91c793146c3f24, 0xabeded8b1b852e3d), teju_literal2(0x0000000000000000, 0x0000000000b6b00d) }, // 45
+  { teju_literal2(0xb9505b1d6a7c0ca0, 0xef2f95e89f1aa2d9), teju_literal2(0x0000000000000000, 0x000000000024899c) }, // 46
+  { teju_literal2(0x8b76789f7bb268ec, 0xfca31dfb530553c5), teju_literal2(0x0000000000000000, 0x0000000000074eb8) }, // 47
+  { teju_literal2(0x1be47e864bf07b62, 0x98ed6c65770110c1), teju_literal2(0x0000000000000000, 0x0000000000017624) }, // 48
+  { teju_literal2(0x6bfa7fb475967f13, 0xb82f7c144b00368d), teju_literal2(0x0000000000000000, 0x0000000000004ad4) }, // 49
+  { teju_literal2(0xaf32198a7deae637, 0x24d64c040f000ae9), teju_literal2(0x0000000000000000, 0x0000000000000ef7) }, // 50
+  { teju_literal2(0x230a051bb2c89471, 0x6dc4759a69666895), teju_literal2(0x0000000000000000, 0x00000000000002fe) }, // 51
+  { teju_literal2(0xa09b9a9f23c1b749, 0xe2c0e45215147b51), teju_literal2(0x0000000000000000, 0x0000000000000099) }, // 52
+};
+
+#include "teju/src/teju.h"
+
+#ifdef __cplusplus
+}
+#endif
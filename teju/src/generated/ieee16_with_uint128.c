@@ -15,8 +15,14 @@ extern "C" {
 #define teju_exponent_min         -24
 #define teju_mantissa_width       11u
 #define teju_storage_index_offset -8
-#define teju_calculation_div10    teju_built_in_2
-#define teju_calculation_mshift   teju_built_in_4
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_4
+#endif
 
 #define teju_function             teju_ieee16_with_uint128
 #define teju_fields_t             teju32_fields_t
@@ -35,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { 0x00000001, 0xbebc2000 }, // -8
   { 0x00000001, 0x98968000 }, // -7
   { 0x00000001, 0xf4240000 }, // -6
@@ -50,7 +56,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 1u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
@@ -0,0 +1,12571 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./ieee256.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                256u
+#define teju_exponent_min         -262378
+#define teju_mantissa_width       237u
+#define teju_storage_index_offset -78984
+#define teju_storage_compression  64u
+#define teju_storage_index_top    78841
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_2
+#endif
+
+#define teju_function             teju_ieee256
+#define teju_fields_t             teju256_fields_t
+#define teju_u1_t                 teju256_u1_t
+
+#if defined(teju256_u2_t)
+  #define teju_u2_t               teju256_u2_t
+#endif
+
+#if defined(teju256_u4_t)
+  #define teju_u4_t               teju256_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+#define teju_multiplier(upper, lower) { lower, upper }
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { teju_literal4(0x4de5106d9f6d15b4, 0x39eb0a6904c1b0d9, 0x63070c38f68e79fa, 0x8188d71384dadcae), teju_literal4(0xe9776482c87200ba, 0xedbdd4e7d208f5dd, 0xf95ee7f9e52f4ac5, 0x65e6c91ae89a4848) }, // 78841
+  { teju_literal4(0xc7aaec24962bb2f3, 0x1e1ec16330087cbe, 0x792df2cfd7d3c36f, 0x9d29838abd7b73d4), teju_literal4(0xb15a06ab2ab7265d, 0x64b5c3be0e2affbb, 0x05bdb533400098e2, 0x9246723aa9d1a2d7) }, // 78777
+  { teju_literal4(0xab0cb415397a807a, 0x1be55db267a67818, 0x1c79331010511f20, 0x70047d9521d74c34), teju_literal4(0x86b970ee014df9ec, 0x1c3c6cf467da84fe, 0xf96e971ae416f08f, 0x8b1f24564ac6bf15) }, // 78713
+  { teju_literal4(0x054061f228ce3ae1, 0x9d0480a152f06f66, 0x4bb65ef49078d21d, 0x323e7f82da395506), teju_literal4(0xccaf7df165777269, 0x7fa035c2011c408c, 0x39b89aa7872ce1c0, 0x089d23d4cc5b6f28) }, // 78649
+  { teju_literal4(0x05b04daf785d328a, 0x1af4b1a3392f77d4, 0x78776454c11152f5, 0x09c3da537b96c3cc), teju_literal4(0x9b7d08b862e00f8f, 0x8e9928ed5a6a69c2, 0x716d0fffc238b141, 0x68baac2b179fb844) }, // 78585
+  { teju_literal4(0xb02bb4830e4e4928, 0x8a7206dd9bf75d00, 0xcd670850fa1bdfba, 0x56ae4c2bb43dea62), teju_literal4(0xec3b6c71cee340fb, 0x7098819cf97d9fa4, 0xa2345699a601bd82, 0x1f2289ce6266b2ba) }, // 78521
+  { teju_literal4(0x368e797ab061576d, 0x5097545b4b0b37f2, 0x3dde13baf050aab5, 0x08158c79e2e35312), teju_literal4(0xb373e0e88f43b54b, 0xdfc89346337f4e27, 0xb42188c4772c6105, 0x8cf8134e1d7b3d5c) }, // 78457
+  { teju_literal4(0xd484014953c90537, 0x028d29236b103022, 0x9d7b2ec5d982e068, 0x7c34f1e8467f526c), teju_literal4(0x885204b0912dbf77, 0xa90057941d2651b5, 0x607ee161b18c1b8e, 0x7e1b63494fb1fbff) }, // 78393
+  { teju_literal4(0x8f153a7dc78dabca, 0x3388ba464dbb354b, 0xc6f90abc6c037c94, 0x81613a0f1d307888), teju_literal4(0xcf1c3d52adeb6c99, 0x8ad026c37f4e742b, 0xc5a02154f6105ce9, 0x86fccbec7e378276) }, // 78329
+  { teju_literal4(0x797a0e6a5b980ad8, 0xb5bce82208eab201, 0x09d91fa27582127d, 0x7b158f5e5dba13dc), teju_literal4(0x9d549505affd8e2e, 0x21f39f0336c48f26, 0x76243f4a859734cc, 0x565e0a7ad51f9dea) }, // 78265
+  { teju_literal4(0x7332da2cbbe68851, 0x2b9c73caaac4bab0, 0x19d334db7f921642, 0xe2271377179b4c7e), teju_literal4(0xef07d79dc4d363cb, 0x1c3b5b0f6d605e1b, 0x36156eef9113edd9, 0xcb832f75dab5d17b) }, // 78201
+  { teju_literal4(0x91052847f0ee89c3, 0x842802c1a8115d07, 0x33dd4b19282bfa8b, 0x1d10a084d4669c4d), teju_literal4(0xb5941a49ac4fbe6d, 0x1ba7411ad2a4797e, 0x6a0bae6fa3e06a6e, 0xc42c7c75abd28077) }, // 78137
+  { teju_literal4(0x6ed2fa2a5ff9afb8, 0x432bcba535ea957e, 0xdf17d617c7dc8bb2, 0xac984fc8d5281913), teju_literal4(0x89ef6f8992f96dd5, 0xa9781d4334891e12, 0x82f95d1910b87061, 0x34ff67082289bc7d) }, // 78073
+  { teju_literal4(0x6d765bd281f42406, 0x769f600727320cc0, 0x951e7dad8dce1a8d, 0xdb3f49f8c650c22e), teju_literal4(0xd190573ccef7878f, 0xc9d870ee0c90ab87, 0xdf4f27c7a75e7fe5, 0x313556eef0c72db0) }, // 78009
+  { teju_literal4(0x9b28cefcf0cc754f, 0xa330a911da4e18f7, 0xd61c99e55ececa9c, 0x24317957bceb1a66), teju_literal4(0x9f31b762077a9957, 0xc415298e75faa843, 0x2d7a43e3489a8365, 0x3ca3e9a3c8f003d1) }, // 77945
+  { teju_literal4(0xab7ef870a262c143, 0x033c443eeba73c37, 0xb4574fbddde3a184, 0x67776bc2ba4995a2), teju_literal4(0xf1dcbf769228744a, 0x46109cb8c2effcb3, 0xfc35d419022bb128, 0xfc292d9ee773eed2) }, // 77881
+  { teju_literal4(0x063b2e93e9cfe091, 0x7fb4ffdaffa49e58, 0x14bc16bf6ec8c322, 0xa01027cc333591b9), teju_literal4(0xb7bac6213f28316d, 0xe634d746b98ddae8, 0x76a101d943942359, 0x9c0c322c452f14ed) }, // 77817
+  { teju_literal4(0xc85b301296009649, 0x5666302b6f56dcf1, 0x1f0197d055e9e26f, 0x66cc23df498b9134), teju_literal4(0x8b91c026cb4aa98a, 0xcdaf065ff08d93e2, 0x859d7c99a66ea677, 0x7ef70ece10eaa7e6) }, // 77753
+  { teju_literal4(0x2c1de29936ccccad, 0x3dcb7d3926982089, 0xef0dd522187696b0, 0x68fc30e747e54dbc), teju_literal4(0xd40be1fced1382bc, 0xe7370423b62a425f, 0x2ca17de823666eaa, 0xf628ac036614927d) }, // 77689
+  { teju_literal4(0x658a3517f2ff27bf, 0x790bef283a900f5d, 0xe94c78bc13e80b78, 0xa2b0e945f95ee29b), teju_literal4(0xa11480be55dcd1f4, 0x6791bccb7b31dc16, 0xd7155b9c42ca407c, 0x278aee37da5b3b36) }, // 77625
+  { teju_literal4(0xcc3cc00acd7fc8e5, 0x5b5634817d199ffa, 0xd2eab4f43d423d51, 0x764739701b36272d), teju_literal4(0xf4ba3db9435edc2a, 0x074742db1a954bd7, 0x4c99b3135f493bc9, 0x0dab6bf479cf220c) }, // 77561
+  { teju_literal4(0xdbc118f2e4903a39, 0x8b88a444362b0f51, 0x16f1434cc784790c, 0x3a8008528f0751b9), teju_literal4(0xb9e7f7fc9f0685db, 0xcfe460e79ed8e180, 0x6ab45f2ffc334ef7, 0x2e22eab245c0ff73) }, // 77497
+  { teju_literal4(0xf011d1bb7cfc7b95, 0x37f20d64a7d74db5, 0x2d81519201ba2643, 0xd97c87ae477314cf), teju_literal4(0x8d39056282dfa687, 0xe23ee87a6e76593f, 0x146a406e391e4095, 0x09f21715fcbe298e) }, // 77433
+  { teju_literal4(0x1875b4a1e58b0ae9, 0xf8a0661704456434, 0xb90680ed147eb361, 0xdf5396f34a984061), teju_literal4(0xd68ef423cec54af5, 0x0d1b2cdf0831cf4c, 0xf96987d40ed800e3, 0x269b84f3ee4c5875) }, // 77369
+  { teju_literal4(0x6ca01fd6ce733268, 0x5d7b66fbea4e0c87, 0x539a6d93f099e129, 0x90f8180603ab3298), teju_literal4(0xa2fd023ee834d223, 0x2f37ca33685b7e74, 0x1aef0fd8cfa0a7a0, 0x5ba41c1562b99721) }, // 77305
+  { teju_literal4(0x5c7a4da44bfbd9c3, 0x4e8e95d5754c0e73, 0x3f6abdb6ec8274f4, 0xef8654569acf0f51), teju_literal4(0xf7a06c70f37cb832, 0x272f998bf86ab32c, 0x90fc4f556dfde12b, 0xc04eca82ba33bc39) }, // 77241
+  { teju_literal4(0x1098c90c88eb4717, 0x914f912efe746eb7, 0xd14a2ab12a25e294, 0xace4496d9f073e4d), teju_literal4(0xbc1bc3a46ec8e7da, 0x5d7f60f1d5333c4d, 0xc4176740a070b1c1, 0xf731919754784705) }, // 77177
+  { teju_literal4(0x6ccb540e441edf1d, 0xbd951d7f0375484e, 0x2c3b77fa3e8fa1cc, 0x26597b956eab32dd), teju_literal4(0x8ee54e440d9c1e18, 0xc17d2e54f265d316, 0x2cfc62aa929b84fe, 0x5beb789502eed776) }, // 77113
+  { teju_literal4(0x5aaf2d8d17b1aed4, 0x13fb8d307ad86832, 0x042c9925356c0574, 0x466601c23acdb853), teju_literal4(0xd919a486a9bd2114, 0xe2dafcaf585ea3b1, 0xfe2caf8525d861e9, 0x729228d40e0ed070) }, // 77049
+  { teju_literal4(0x99188c02be8e3c3e, 0x87e4c859b2a0611a, 0x7e322fef6296cfa0, 0x405b595e92993a3f), teju_literal4(0xa4eb4d3c07edc0c7, 0x4624725d7954bd6e, 0xd699ea48ffd3ba72, 0xb31a61b046312566) }, // 76985
+  { teju_literal4(0xf7b20f4ce0c3f2ca, 0x8690b9cdd717322c, 0x0b6fe4de0935a9fd, 0x19d177933ed6b0e1), teju_literal4(0xfa8f65f7b8caac93, 0x4046fa9cae2cd510, 0xfd102162ddf33133, 0x56fde99ae8a6d2ca) }, // 76921
+  { teju_literal4(0x1efbfda218f735b6, 0x394f03090c096e5b, 0x717858fb93b58d68, 0x71e259f44bb1ce35), teju_literal4(0xbe563d1d50c55c9b, 0x9db0b2baf5e21117, 0x7f5cb8c35f57006a, 0x200bd76ebc7f4d2f) }, // 76857
+  { teju_literal4(0xddd0a9d440f0adc0, 0xa32dabb735e7164a, 0x67818b8efda997ce, 0x2bd0aea888d5ddbb), teju_literal4(0x9096aa005323b17b, 0x59a55de400d91b18, 0x3397503ab091a24a, 0x6b62dcc2215c6dc2) }, // 76793
+  { teju_literal4(0x654f9d823099fd92, 0xcebc0222fa61ecd1, 0x638d87145e08f2bb, 0xe2bd6dc4cbe5a3c5), teju_literal4(0xdbac0a3ff25fc98f, 0x3ccf7eee7590c03a, 0xca26b39412c93a63, 0x6b7376ba7ca72e99) }, // 76729
+  { teju_literal4(0x411fca5f3d97275a, 0xc08d433ad18a404a, 0x0660f1a690a01fc1, 0xaebc6301933348d3), teju_literal4(0xa6df734298756bb5, 0x42ff8937480f874a, 0x819a0003ebb89dab, 0x11f6be6c410bf89c) }, // 76665
+  { teju_literal4(0xb47513cc7f092de8, 0x67d99e69a23a6917, 0x2f82c1cf909698f7, 0x34e0f030e37f8072), teju_literal4(0xfd8744f7945aa0b5, 0xf0765fac20218328, 0x175c41af83e7e23c, 0x10d5d8402b67b93d) }, // 76601
+  { teju_literal4(0xc1b7139a295a0e11, 0xca817d08ffca7fdb, 0xb2dc37a3ab77bceb, 0x24706ab76f22245f), teju_literal4(0xc09778a89cbe4121, 0xc235b60a4524bcbb, 0x5b829923fcb69d7b, 0xf15351d815a92729) }, // 76537
+  { teju_literal4(0x6f2d225e7825c271, 0x2dbc868478326e04, 0xaa213ecc348a90e2, 0xbc8db32376f31801), teju_literal4(0x924d27fa591292c7, 0x0193e30a85b4a628, 0x22805a41e88c8df0, 0xdcb0156209c209aa) }, // 76473
+  { teju_literal4(0xe5bd8526853a3f3a, 0x39bcfd2ae175baa1, 0xe2313d7e57732446, 0x9f865d4accfc3dca), teju_literal4(0xde463cb02dc62353, 0xb314b9dd32db4a4b, 0xcd0c5a8c50a45ccf, 0xa3cb7ee48729868f) }, // 76409
+  { teju_literal4(0xa3b8956c28deab7f, 0xa5a8372b9451a580, 0x8e5d2b4937cfaed3, 0x5b985143ac58a2ef), teju_literal4(0xa8d98614b6c28187, 0x494fa2b48c289182, 0x0f88f29a72c58acb, 0x7120b5fb0aa0cfa9) }, // 76345
+  { teju_literal4(0xc4675a31142f73b7, 0xdf541af20d70a822, 0x08c17daa2b794202, 0xd7f507c0d47dfcc8), teju_literal4(0x80441235b23271da, 0xa6e9c8b62c605982, 0x593030610797b2aa, 0x1120c26e43a8adc5) }, // 76281
+  { teju_literal4(0x097ec0d889eb8698, 0x5b02c209a42a4724, 0x8ae23c6ea9394f3c, 0x25c86f65ef7a5c36), teju_literal4(0xc2df8ac517fe992c, 0x5be909210482a128, 0xa860e2081406cf3b, 0x732795e897fc04b6) }, // 76217
+  { teju_literal4(0x632dffb643568d5e, 0x5afa57d07b7c0740, 0x52090e18e0d525b1, 0xa212ab9ca042558b), teju_literal4(0x9408d7c3ced95c81, 0xe5151b04992de673, 0xd25d7d7272a305b0, 0x4d3c69a7165b23ef) }, // 76153
+  { teju_literal4(0xa372f87ff38b5ade, 0x66df16b00979c204, 0xf7ff42b89d67fcdf, 0x4566ad7d752ae35a), teju_literal4(0xe0e8537ec6399ad7, 0x4ee104cb431cfb7a, 0xbb376144961ddc3c, 0x66d61e8f2cf36ac6) }, // 76089
+  { teju_literal4(0x3d35702e8ff15d51, 0x330eba0c52456deb, 0x18686d986ae2beae, 0x394ec359e6b8d740), teju_literal4(0xaad997aa5abe9518, 0x06a6af310c93bdb8, 0xcd007b8081a228d1, 0x2a6e3236b8f210a1) }, // 76025
+  { teju_literal4(0x1f2fbaf5c83acc86, 0x41aa7e9a43be2bd6, 0x3f84139e700b91e0, 0x1a2ff2ff1db11e9a), teju_literal4(0x81c90fcfecc22a3e, 0xc7c57958e876f794, 0x2886a7c7d33cff6a, 0x05621761a7fb5e07) }, // 75961
+  { teju_literal4(0x7c27289ce6fd5c56, 0xbd1f77fcbb71d96c, 0xb0159bf9b0d19c01, 0xa586dcf6c3e65c4d), teju_literal4(0xc52e882fafa4b7cb, 0x9133e0d1f3407a99, 0x25e3d18f318ca6e8, 0x2315e23291d8e651) }, // 75897
+  { teju_literal4(0x6f654ac9bb3ea894, 0x66e7476bddd61c92, 0xd20b4d721f184aaa, 0x9e108b1a6318f254), teju_literal4(0x95c9c91d9b410f24, 0x7d041d8d620bd3e0, 0x935331221c9e24e6, 0x2facb6359f33d74d) }, // 75833
+  { teju_literal4(0x73c98bee4739e18a, 0x47be7cbc4fc24f12, 0xb3e7aab52f9226fc, 0x9b4226c7af381587), teju_literal4(0xe392669ae23504a5, 0x3f5340d5ff3164de, 0x54dea9760ee331cb, 0x7c406fc0cd89a0e8) }, // 75769
+  { teju_literal4(0x8af7f5fd484fe343, 0xc9d33a96179abae6, 0xaa2bfac45ec55b56, 0x17abacbedc88c214), teju_literal4(0xacdfba31fa99a5d2, 0x10091bc8d677e23e, 0xd5c75374f2a97c6d, 0xf15cda41a4585286) }, // 75705
+  { teju_literal4(0x6a4adfa4bf6842f2, 0xe2b335ca4c00067d, 0xf4acc760ab045650, 0x78e8f780650ee43b), teju_literal4(0x8352a91a376d2150, 0x6473d9c756172c4e, 0x9eea075abd07ee9f, 0x9dd80068615ed4ec) }, // 75641
+  { teju_literal4(0x24fb34c215a2f46a, 0x1ace1f3462ee36b5, 0x444e7d19c9000139, 0x67f8911b848b7251), teju_literal4(0xc78485e43521dee6, 0xc9ebce0fe122c193, 0x84f6695f81b46bca, 0x5805e885a3645c21) }, // 75577
+  { teju_literal4(0xbc36681ea7e4b468, 0x9f30e7ba4590b600, 0x8edda9114c3c2912, 0x5cd066eb9cd3b4e6), teju_literal4(0x97900bf86b9c3ada, 0x55bb2eb1804f692f, 0xabe1d275b8cb521b, 0xff9332a5b05344c7) }, // 75513
+  { teju_literal4(0xb1f367d1d1448364, 0x8568c630799a69e4, 0xcd31155a5d56aafe, 0x8406cbd862b6b905), teju_literal4(0xe6448e3c3df181be, 0xdb420c284b8dc263, 0x048a853f560dcb9e, 0x3b20783b37d76b88) }, // 75449
+  { teju_literal4(0x4cd4439a13fd9305, 0x9dd77df64957e7ac, 0x40766d1994c0a893, 0x200f0f49ee0a70a9), teju_literal4(0xaeec0011300cf962, 0xa2863e1627cc6e59, 0x270c7c5b030aff52, 0xa47860b1358901b8) }, // 75385
+  { teju_literal4(0xb2c761dbd62497cd, 0xfe217c90972939a5, 0x52e34f93f6ce35b0, 0xd4ce7ec920bea3dc), teju_literal4(0x84e0ec0e32916bad, 0xd3f80ea7400a52e0, 0xf874d711af4757cd, 0x4a082a7659fbe3cd) }, // 75321
+  { teju_literal4(0x98472fb0be339a60, 0x0ee996967537527e, 0xcc82d719e0a9505a, 0xbe763288f600ed85), teju_literal4(0xc9e1991e1cf58713, 0x8e6d0bf265b4ef68, 0xb03f89df183ec66a, 0xfe57fa7ecd58dcaf) }, // 75257
+  { teju_literal4(0xbedaa11b08b32b12, 0xaed9504b4e30d2ad, 0xf711f88aa313623c, 0x4cb44fcddc5f757c), teju_literal4(0x995bb07544aa6b0c, 0x609005d76ee497e3, 0xc316753af5b94fa6, 0x4bad55a223c79e97) }, // 75193
+  { teju_literal4(0xea81fe1a6b3dbac2, 0xcfeb0f523bdb3cf9, 0x7c5e0506d6b4f175, 0xbb984e6af80deb8e), teju_literal4(0xe8fee2e407872738, 0xedb773a23cf24680, 0x592dc1f5397b9bb1, 0x879145af9f1b488d) }, // 75129
+  { teju_literal4(0x09b38be4d2055979, 0x2e3aa9edb6320d33, 0x10ba153cf10dd3e9, 0xc5bc429779d36fe5), teju_literal4(0xb0fe7be55f9324f4, 0xfe7cd7bd49fdb1f8, 0xf5aca0ace0b39a29, 0xbcf0940ad960afde) }, // 75065
+  { teju_literal4(0xacd28f9998c3329b, 0xccb93ea9379b09df, 0x45f7834f60715bec, 0xd85928e709d174d9), teju_literal4(0x8673e6cfe061787e, 0x28e0c37e58096101, 0xe7b1773e9c231c07, 0xdafede15726e97f6) }, // 75001
+  { teju_literal4(0x4ac4db5d0f5766b0, 0x3aafad27cb5e2116, 0xf6f3359feb41f88d, 0xaedc40df48dd4c0e), teju_literal4(0xcc45d7593fab1565, 0x70325f72c16f9fb9, 0xcae5283d738bdced, 0x966f507f05ad39b4) }, // 74937
+  { teju_literal4(0x22b7789e70d6177f, 0x66fa97b220b42e8d, 0x5d0ec5873f4e79c5, 0x7c44938047b80fac), teju_literal4(0x9b2cc6e61532f8ac, 0x3dc234f69ec69a09, 0x35bcfa8ae8fbf695, 0x90445aff24535c73) }, // 74873
+  { teju_literal4(0xa0fd20ab2ea0576b, 0xca793302c36468f2, 0xa4a4b2c71ea168a7, 0x57881af81d906dab), teju_literal4(0xebc17d5dbda939f1, 0x38cc06085f26b537, 0x553e271a7d73b626, 0x188066fb27f98b68) }, // 74809
+  { teju_literal4(0x770f206c5f02f982, 0xb5390e23b8c9659c, 0xc98be222d6595b20, 0x1c6f65bac5f55d62), teju_literal4(0xb3174084619b35e7, 0x1f549e17e6c937b0, 0x5bf12345e5b42103, 0xa0a3575a3f37cc44) }, // 74745
+  { teju_literal4(0x1abd95892d006149, 0xb0eb9e8c41e4b56d, 0x08bb6dad7b42a36c, 0x820385f95f03884f), teju_literal4(0x880ba7ae256c3af3, 0x53d0946f89f005e7, 0xe5636028caa06084, 0x4d6e87e2387eb88f) }, // 74681
+  { teju_literal4(0x2700e898d0551ffb, 0x33db5d85f7def4e8, 0x515053460a00fa00, 0x13f33e3dfbd9894d), teju_literal4(0xceb156529d20d969, 0x78c12e91c361b094, 0xf67ffd2609f730b7, 0xe774fc77e0548c2c) }, // 74617
+  { teju_literal4(0xc247a34c53f88beb, 0xa389783d0e5e37dc, 0xe154349658545ba5, 0xc1220f4804007b67), teju_literal4(0x9d035fce4a5c77d1, 0xdf880c95c3d2d3fa, 0xa60a5fc3f5006009, 0x13cefa79978fc210) }, // 74553
+  { teju_literal4(0x47d2111fa8856381, 0x02d9d74bb77c717a, 0x1ca0858e424325fc, 0xc62591002972f385), teju_literal4(0xee8c76c01105e6eb, 0x136ebe26ce30acc6, 0xa8ad2b5538fd6b01, 0xa781a95a6de3ef1b) }, // 74489
+  { teju_literal4(0x340e6c89e69dbbe3, 0xafec293e11e69b62, 0xb36a5b19e1084e4c, 0x48ba1059507e501f), teju_literal4(0xb53660fd2dbcfbea, 0x134da0c7b4e1dbc2, 0x65dcc0febf3437dc, 0xc9d3e49811e24011) }, // 74425
+  { teju_literal4(0x06fdcb98cff44cc3, 0x9305aec74de183ce, 0xd0ff3d328bf0fd93, 0xee94975f80142f07), teju_literal4(0x89a83d234aab1fe6, 0x372965ba09b37660, 0xaebca7c87fb315de, 0x80ea2d5020d2b2e8) }, // 74361
+  { teju_literal4(0xca5fad8cac8986f5, 0x024ded2b9dc61e47, 0x780b9b41780262ff, 0x9c948e6cf6dbedda), teju_literal4(0xd1242c09221f4247, 0x8b284cbffd7162c2, 0x7cdb33d93ff38115, 0x78d8a941fbbf92f1) }, // 74297
+  { teju_literal4(0xb67d3b5fc1c30ffc, 0x5e7bd24641c9ceff, 0xcc04de4e2fcb4913, 0xbb5dc29c6b5d37d4), teju_literal4(0x9edf8be365c60506, 0x2a957b699d64c1c1, 0x49e2005f87cbe793, 0x8282a46c31ea3f4f) }, // 74233
+  { teju_literal4(0xff36b1e86e390952, 0xc6fc4c0595cd303d, 0xec9861b862d4b054, 0x8650b8496a5ff9b2), teju_literal4(0xf15fe86dc85178dd, 0xe1c7fc2842600eb8, 0x4284767aefa0a193, 0x66b05edf2a5fa59d) }, // 74169
+  { teju_literal4(0x249a0d074076f8a1, 0xd184be2024395034, 0x204008c5667f18ea, 0xbf4a5b935f305d17), teju_literal4(0xb75bf09887f488b8, 0x5412634a10928278, 0x960a65a62121b3c0, 0x46449484a1edae0f) }, // 74105
+  { teju_literal4(0xf162ecfc9bd1b2ee, 0x8ec2c99f61d1e7f4, 0x249e5f5fe4afc106, 0x7b6fd893dc0bff2d), teju_literal4(0x8b49b5d5811a6dae, 0xfb2de787e41791a0, 0xca8ba86bea2919cd, 0xc2524db3b5d905a1) }, // 74041
+  { teju_literal4(0x096fa76bfd299304, 0x0f76099cb0c5519c, 0x02ffb69ec3ec10eb, 0x3ae478068d9ac52b), teju_literal4(0xd39e6ebe70474f0b, 0x196dbeaf5022d8df, 0x2785945cefeb0b7a, 0xf65fd0ee3a6474a5) }, // 73977
+  { teju_literal4(0xad608096015d1418, 0xb23f77892e3b2a62, 0xd34d4f6d784cac72, 0xbfaa3ec49f075ca9), teju_literal4(0xa0c15c0d9567c68e, 0x5c0dc8d1f0a61c33, 0xe232b17e975ec02d, 0x91eb0b4e89468934) }, // 73913
+  { teju_literal4(0x0a1e5705c68aa6bd, 0xff7fc12175335d0c, 0x0fc9d4117a6c904c, 0x4a281d55a2394752), teju_literal4(0xf43bec16a70523c4, 0xbf4d1b2478417e63, 0xdd9d37fc761a39d2, 0x876e1785b162658a) }, // 73849
+  { teju_literal4(0xe4738c24db14857e, 0x5ff14e50b6ef508c, 0x9586c2c8ecb8e603, 0xcc8c23105e2c6db1), teju_literal4(0xb98802d9afeb0bfb, 0xde9416767f0a4966, 0xf9089a1183d74d32, 0x709f265a6ddf33e8) }, // 73785
+  { teju_literal4(0xcec913aac2d4072d, 0x76c8989d4efb93ca, 0xeac1d7ca5442c954, 0xb9bac69e0b6d9b78), teju_literal4(0x8cf0209766e0ba5c, 0xfd80fb6a8aded803, 0x65fa3e89cf1467aa, 0xf5596824a083d5b1) }, // 73721
+  { teju_literal4(0x066e84b907630621, 0x09a221796924ea54, 0x4835ad842d244287, 0xca46db1d66a29801), teju_literal4(0xd62034f7a85f535b, 0x493bf05be2d2413d, 0xe885331b02ba20bf, 0x7ecd5305812083c9) }, // 73657
+  { teju_literal4(0x269601f03987ff55, 0x09d478c2efd13f99, 0x5e4f9bb089fbf269, 0x3be2c90f723ff570), teju_literal4(0xa2a8e1684d400635, 0x917cfdcddead4ebf, 0x9596ceb3f53c1127, 0xa6564c4aacd77110) }, // 73593
+  { teju_literal4(0x9ecd2e2abc5098b0, 0x326cb6dfd6ca932b, 0x2719fef456876860, 0x9dc1321755fd3e0f), teju_literal4(0xf7209bb856d997cc, 0xe1dd997e8d184fba, 0xce47c959c7abbf27, 0xcef9719cc401fbd7) }, // 73529
+  { teju_literal4(0x61c1dcdddd07b440, 0xbb64a6875012cbef, 0x1092a0d32f9b207d, 0x9fdbb934077c3e11), teju_literal4(0xbbbaab7f125344a5, 0x0ef2655c21068aee, 0x2ac003b5ef3d6e03, 0x8805c6a1e30482d0) }, // 73465
+  { teju_literal4(0x5a60fd4c63018c72, 0x5661d38069e3a615, 0x909691585609c986, 0x9ae8487a2ec79c5a), teju_literal4(0x8e9b8c688e0a329d, 0x3ad33ae34c2bdbc2, 0xb02aad1128aca58f, 0x59096066438be71b) }, // 73401
+  { teju_literal4(0x49bd4be4346764f4, 0x1409e9a81042aa93, 0xa01aa8fe370f0272, 0xc9aace8b6d65f66b), teju_literal4(0xd8a9957e37053f71, 0xe34dae5866cde1bb, 0x128241e235ff592b, 0x1fdf484898fff63a) }, // 73337
+  { teju_literal4(0x6736838675fc285c, 0x6c9472e5e67cf74a, 0x5f92a4ed307f829d, 0x9e0153f3d3188373), teju_literal4(0xa4962d42e2d2586c, 0x6820fe2a28cbf894, 0xa95634312d68a28e, 0xd97c3cf3a5093caf) }, // 73273
+  { teju_literal4(0x840750a2df5be0cc, 0x65ee93589edd4ef8, 0xb6cae48cf1a70879, 0x2cd0ccec40d145f6), teju_literal4(0xfa0e119f5405a5d8, 0xe594c2717c2697c3, 0x54f2288cf2a5287d, 0x3245c5647e38a025) }, // 73209
+  { teju_literal4(0xe290924574f55bba, 0x49381a8f7d91d7df, 0x99c4679db2d9a621, 0x09d7ced61bbd6cc6), teju_literal4(0xbdf3fe82fc5fd3d3, 0x1d56b81fdb7b1001, 0xbd62f5619479fceb, 0x95485ed5f3aac337) }, // 73145
+  { teju_literal4(0xb3066e55b1408c53, 0xd9b9cdd877809031, 0x2bbe1b5b75aac8e2, 0x9082d6802024c17c), teju_literal4(0x904c087604dc79f4, 0x8e97e0780139c322, 0x7b8a23cf23ca923b, 0x69c969a7b2b923fb) }, // 73081
+  { teju_literal4(0x8e9c0e02f589a2a0, 0xcdd3d26a98e67470, 0x83e82877c94ac2b4, 0xbd71de8e58986b38), teju_literal4(0xdb3aa760a3cdafe8, 0xf3304f5aa558c543, 0x4781c81d0444b9b9, 0x448e3febbfbd8154) }, // 73017
+  { teju_literal4(0xae6386e4ff9acaa8, 0xc46952a7823a61ac, 0x634c876db2ecadd7, 0x68e4b56f1680acb8), teju_literal4(0xa68951212a7e5622, 0xda1ae8d283199b8e, 0x5e742277a9e4eabb, 0x155980768b9d76e2) }, // 72953
+  { teju_literal4(0x34be0861a4fa7850, 0xa90b6a6663ffd226, 0x0067f487f46480ea, 0x1b2434f717e437a8), teju_literal4(0xfd046867dc4958f3, 0x3332a9baf28135ce, 0x5cdf9d35e5b81d53, 0xcd8849160c41ba5b) }, // 72889
+  { teju_literal4(0xe0c3080e164dfd6c, 0x9950cc1c78d004d4, 0xbb4f09038246e930, 0x67088cf4e82f6fc2), teju_literal4(0xc034101c5159d088, 0x2e4cd40a858e91a0, 0xf87f88857e7af7a3, 0xf0fa006ef39a96d7) }, // 72825
+  { teju_literal4(0x20240395f7b24ac2, 0x00ee6e1df88a6de5, 0xbf82e88344de4ffc, 0xa976cf508bee4756), teju_literal4(0x9201a41adfc7fb75, 0x1d16cf14e88ac536, 0xc8851e0d31391db4, 0xb352d54094e1afb3) }, // 72761
+  { teju_literal4(0xb15ecef0c2ba76f9, 0xdfac723d1de9cfc7, 0x547205f530941df0, 0x7b61e6a1e2d7069b), teju_literal4(0xddd381f362d72001, 0x96f4f64e468c142f, 0xa24d330114850c6c, 0x385a91a954fb32cf) }, // 72697
+  { teju_literal4(0x7ec38dd0fe8a2dc1, 0x66195a7c798c9697, 0xed0261346de83a62, 0xa319af42f52244c7), teju_literal4(0xa8825ebc16b37f7e, 0xe0804e00ac752d87, 0xdb9659c3f65e8cad, 0x8f63fc46a58d1343) }, // 72633
+  { teju_literal4(0xfa2a3293694656cd, 0x8e9ea27241753cc7, 0xfa08cac7b8f87f90, 0xf40c9cb4514c4ffd), teju_literal4(0x8001dd7f706700bc, 0xf9d0ae2b8855f58a, 0x608dc82ad74b7c14, 0x9e3a82e3d6754720) }, // 72569
+  { teju_literal4(0xf481a7755df219f6, 0x4471209105d5cbfc, 0xc30aa7af554e97d8, 0x7b8b5655e6c45d65), teju_literal4(0xc27af4bf425e0eb5, 0xe9d7cfd62b6023e5, 0x6646ac69e7aac5c5, 0x2912f08125e6b09f) }, // 72505
+  { teju_literal4(0x11f9f110f6ade23c, 0x9b83bbcf0117d83d, 0x8e100e38b5a9ebf8, 0x58b812a58b971c4b), teju_literal4(0x93bc6ee0c4fb90c4, 0x33ffa1741b1c2765, 0x74ae0bb45fc8bdc4, 0x6b63499050625046) }, // 72441
+  { teju_literal4(0x7834cb2a896ccfb8, 0x59e3798a80fd7ed6, 0x242dc92c93646078, 0xf07fcb383853bcba), teju_literal4(0xe0743cd1a8d8af53, 0xf0ad42bb95053ff0, 0x497ed5e590f89f1e, 0xf961d3b4bd9579e1) }, // 72377
+  { teju_literal4(0xa14c384fcd15e8e1, 0x81528ee89a0f8411, 0xbefcfb9cc1468796, 0x57bd7a8a7b658530), teju_literal4(0xaa8168025907ee83, 0x88e245d546819df6, 0xbab62b9cdddc5bb1, 0x193ee7fc6c635e53) }, // 72313
+  { teju_literal4(0x0aebc39d4c96382e, 0x46ac15ab54de39df, 0x2ff2e1350598a61a, 0xe730ef8ccb12b008), teju_literal4(0x818612517d71e446, 0x34b05a3ce961f6d9, 0x20e8c447d357fe6d, 0x6a67cb65cb52aec7) }, // 72249
+  { teju_literal4(0xa4cee92e30a616bf, 0x01e51a0ffa6ba2a0, 0x6fda51e2c2427610, 0xe653b843479ad899), teju_literal4(0xc4c8c11e08479fbd, 0x27f05781e530aa19, 0x8d226eac028e5a41, 0x19ddd10206d2132d) }, // 72185
+  { teju_literal4(0x2d09bfce3942947d, 0xa67da4860e3dbdf1, 0x4805e66a49240029, 0xf8cba2a13dd5b112), teju_literal4(0x957c7880799f7420, 0x6a2fb2c55a946f1c, 0xef4a999bb8401eec, 0x22de5c372952f397) }, // 72121
+  { teju_literal4(0x9a78903666183176, 0x3674426a6274b9dc, 0x5ae04157b44673f1, 0xeb3d3e729150ce8f), teju_literal4(0xe31cefde41b40269, 0x40cd4e4d56f05231, 0x8e2249959cfe2241, 0xfb39c868e6311f59) }, // 72057
+  { teju_literal4(0xc16df7a4fc00dfcf, 0x90d14ec4f1c0e83a, 0xd25c52f14d2b0341, 0xaad2e298be87abf9), teju_literal4(0xac867f19053791e0, 0xb5bd200ced5342ce, 0x3f2d55c880ab0fa7, 0x4b0e08523c2c38e4) }, // 71993
+  { teju_literal4(0xe393a7ec4f7d7a8b, 0xeb51d556bf2d91a2, 0x556f0193d9eaf68e, 0x2e0e0d1f55dd5cf3), teju_literal4(0x830ee072b1d2be26, 0x7f4164034b0cb53a, 0x6c72e850b9da114a, 0x8cf534d665944496) }, // 71929
+  { teju_literal4(0x18b02724514e9782, 0x68025c00c987f2fc, 0xdd50973addf6ae76, 0x5ac414b1841754aa), teju_literal4(0xc71d8a299fce2644, 0x28facc2e32dadc81, 0xb10622085aece075, 0x84afe35c31c7285b) }, // 71865
+  { teju_literal4(0xb319c733d261a0bf, 0x986751eec232c231, 0x161b3594d420ef97, 0xa8d02d1344b310fc), teju_literal4(0x9741d0e270bc811f, 0x4fadbfbeee1bbbb7, 0x901d962288fc52a8, 0x532b71b8fc3b6214) }, // 71801
+  { teju_literal4(0x589fcccf16f8bbff, 0x5ec0a67aca422a44, 0xb14956e5df9e2587, 0x01f4f74fff69a5b8), teju_literal4(0xe5cdb3446991dc96, 0xb5e36cd93b068c16, 0x34d39413a43dd5bc, 0x49cce9d63d4159a5) }, // 71737
+  { teju_literal4(0xca1030a1dc481e9e, 0xa1c44666ddb7b9e3, 0x9702dc552c85aa9f, 0x2b710fc26d5da165), teju_literal4(0xae91b65c3611b97c, 0x472ff913da8d9b40, 0x3a1ddff59cbb274b, 0x12c2f33ddb214daa) }, // 71673
+  { teju_literal4(0xb822cce2c50988cf, 0x9ac874e5cc3336ff, 0xfeb8f4d4a523306b, 0x86ea931b45fc7df9), teju_literal4(0x849c55d57745aff2, 0xe40c3ee65330512c, 0x8f462aa92d91a2ac, 0x07eeaabb88157771) }, // 71609
+  { teju_literal4(0xf9ef9da014c7326e, 0x7b9cea7a14b4cb00, 0xfb8f05a489786c0d, 0x63cb7d064a3b78ab), teju_literal4(0xc979651287deab4b, 0xb8ee8285104cc6f9, 0xdb5f0e15d9dad8ba, 0x3c92ac2604a5080e) }, // 71545
+  { teju_literal4(0xed5c20eb37771ace, 0x4a5d15733518f23d, 0x1a39858a03c46e89, 0xdd671ce47bf42d01), teju_literal4(0x990c881f5bd4d70f, 0x1b8d52b70ac480ed, 0xbeb4546196950789, 0x4f22e55799d70161) }, // 71481
+  { teju_literal4(0x0393358567f2db5a, 0xfadaee99326c6e46, 0x882bc2adc7b20717, 0x5ea19c8e74c8f660), teju_literal4(0xe8869f78a891288a, 0x4312cc09fa17c534, 0x1ff9052b03554708, 0xd8edf16a82854682) }, // 71417
+  { teju_literal4(0x36bf5d603f22281f, 0xd50cbad39bd4f187, 0x2ff675e47cf5a9cb, 0x0b9de0f7c38d884c), teju_literal4(0xb0a3205fb45acfd2, 0x8a0239d85cae8fef, 0xf565f5c84744db3f, 0x9711e389f5c4c0ee) }, // 71353
+  { teju_literal4(0xed8aa075e1833d93, 0x0d4d09dfc083f677, 0x779de9b9d86fbd96, 0x5b1c8b1044af1d20), teju_literal4(0x862e8096837af273, 0xcf01bb13ae218b8d, 0x515888be9684ff40, 0x9cfb6141ca2cc4dd) }, // 71289
+  { teju_literal4(0x67852bd4d6dd91a3, 0x6cae66f529fac89b, 0x77bd15d6922d0728, 0x1a850083cfa7905c), teju_literal4(0xcbdc67498235b6ad, 0x3a5236754f2f3184, 0x3773dcaa265d0e8b, 0xc3be57ff5d62b6bc) }, // 71225
+  { teju_literal4(0xa3aee16b6fcfa793, 0x849ba36fc21d8bde, 0x13e2f523613135b0, 0x6c9b6bd3bace2412), teju_literal4(0x9adcae80bd32ff4c, 0x00b5317775f7b1c6, 0x8a529fd6092e131d, 0x876a198336742ee9) }, // 71161
+  { teju_literal4(0x5ee7ff941e7059e1, 0x1e1a08187b8547d9, 0xb4ca62eaab9f8c65, 0x8c075928ae335073), teju_literal4(0xeb47cd39b1103c5b, 0xa5633c1dd721489f, 0x190d9b3147aa1516, 0xfdeea56087da2ccf) }, // 71097
+  { teju_literal4(0xdfccce3b0d8568c4, 0x5c385ad4ee1bb013, 0xac9a83e922129e44, 0xe75bc74581812a83), teju_literal4(0xb2bacfef9fa82d0e, 0x25e64cb82260f2fe, 0xb493ae937d3984ae, 0x5e1bb2875d8cc7d5) }, // 71033
+  { teju_literal4(0x246dea83bfb88b3e, 0xd06e489e2ff1fdb4, 0x635a44b30447fbc0, 0xcb6265fcac16da1a), teju_literal4(0x87c56efd585ca74b, 0x913c489c6e75f705, 0x1f51ddb8dbce6138, 0xbfd73e2a818f4a55) }, // 70969
+  { teju_literal4(0x284cba1296b877aa, 0xd981b1104afa1870, 0xa6d5d47f2acf86df, 0xca85557ea220b6d4), teju_literal4(0xce46a680564181aa, 0xa2fb8ebcfcc8a746, 0xa7a8041f9b527e0a, 0x08212e56ea5aaa56) }, // 70905
+  { teju_literal4(0x0d9c3850a3b9b1da, 0x4589c69838552a2f, 0x836a9fcad7851ddf, 0x22e1e14194c96dfa), teju_literal4(0x9cb254817bf4c96a, 0xb84437a1a3812218, 0xfc01915579e56017, 0xbef05d7d2729f1ce) }, // 70841
+  { teju_literal4(0x15c763e710d025ef, 0xe4cfab37de5c5992, 0xca0b069d5ac9ddc2, 0x70174578b2253709), teju_literal4(0xee11559140983d9b, 0x7cc5745bf77a50cb, 0x3a5c628ec4a5376b, 0xd581fc588bac3444) }, // 70777
+  { teju_literal4(0xc7f23f647f73b58a, 0x7e3d2bdc0686e018, 0xbce6f833985280e2, 0x885bef7c926e5ae4), teju_literal4(0xb4d8d811193c02af, 0xfa80d94bd30d24d1, 0x408d4501f5fa4f39, 0x721abd670ece0efc) }, // 70713
+  { teju_literal4(0x287bc24a140215fc, 0xd7152cb677808b5d, 0x778e01db34212812, 0x88ca8802eb0ddac8), teju_literal4(0x89612f7cc5d9ad84, 0x122a3bb3f399f3a6, 0xc4473282c4b7f50a, 0xd309142580323037) }, // 70649
+  { teju_literal4(0x6554e067ee62dca0, 0xf1774376597a2a0b, 0x4ba70e9f4ca6d7bc, 0xa65053a78ce19053), teju_literal4(0xd0b838aa96532ef6, 0xa9f5705141f07556, 0x669112a02265f341, 0x5d5ee8ff6d47dfeb) }, // 70585
+  { teju_literal4(0xdc88a85557f79885, 0xa533191c5ffbcc31, 0x10fbab61a8a8a34c, 0xcb6e8994ed06a8e8), teju_literal4(0x9e8d8ace79d71eda, 0xee0d57dd202774c8, 0x82a1932ad1ddc0cf, 0x7fc681fe410054ac) }, // 70521
+  { teju_literal4(0x77ef03f53d163764, 0x2f903b75e8270662, 0x2b38b03841aa4716, 0x1f50a23c5e0e31dd), teju_literal4(0xf0e351d50372a1c9, 0xd7a3d483766f004e, 0xa489b2d1a8a08034, 0x709985f5528a2b29) }, // 70457
+  { teju_literal4(0x9742d6fc90b289ff, 0x3d49a559beaae225, 0x82945cb22fffb7cb, 0xe243e9f0ae8c1ac5), teju_literal4(0xb6fd4c02f0e770ce, 0x105864b5b30b534a, 0xf7978b41d7c3be0e, 0xd2eb95f9e9e7f23d) }, // 70393
+  { teju_literal4(0x5232b990b3bbf411, 0xa3462042f065e00b, 0xef135020a3d8decb, 0x58c18223ad81b180), teju_literal4(0x8b01d0b36d3a14c3, 0xd1707141daa638f9, 0x75ca3ba6cd54957d, 0x898c478a98c8b52e) }, // 70329
+  { teju_literal4(0xa17eaa205ebc7ea2, 0x2b6b9b1945089c42, 0xcc5b07ff84762fa4, 0xf52a48bc5d7c0e28), teju_literal4(0xd33133fe67260897, 0x80951a380bc04cf9, 0xc5b2edfb8eca6315, 0x7cef6554e771c103) }, // 70265
+  { teju_literal4(0x9f2af7b28383f169, 0x716abda4078d9da4, 0xc31f4bdd606dc115, 0x9eaf6cc357bc99e7), teju_literal4(0xa06e62472ac81f95, 0x209105efac9e2d1a, 0xf8c2163dea3c4a7a, 0x03cbee2dcf536922) }, // 70201
+  { teju_literal4(0x1ce8e913757c92da, 0xcc7bb0064fbad6ce, 0x7a7d252212c8c8ce, 0x8e177c36d5f42c2c), teju_literal4(0xf3bddba77af0dfd5, 0xa08bd3ce4c485695, 0x0d2bc557973318a0, 0xbd6d9e1e0c35b28b) }, // 70137
+  { teju_literal4(0x3e3673d899a56c59, 0x8378b3c7dba93f2a, 0xece6e1bfbe492e64, 0xae555690fa4626e4), teju_literal4(0xb9283f3e53f8e856, 0x9cb75ea46b7f8e3a, 0xcae42636832cbe83, 0xe5079a7456c3a43e) }, // 70073
+  { teju_literal4(0xe8364dc6d5b6da4b, 0xfdab58e5bb37af3d, 0x7dd927387aaae10f, 0x5e52d4a280700c91), teju_literal4(0x8ca7616c4601d8e4, 0x2df2e9eb2ccb89ef, 0x24b23fb72440b5f4, 0x239fdefc5c8b1d6f) }, // 70009
+  { teju_literal4(0x9b9018e1734ec7d3, 0x161b2430906fc5c1, 0x42f05990d3acc479, 0x0fe22c374595f2cd), teju_literal4(0xd5b1aef549c3d942, 0x2f566f10112dbca3, 0x2a1edd9711311ecf, 0x211758acec99476c) }, // 69945
+  { teju_literal4(0x0e59e3993e2e09c6, 0x4568a31b998fa19d, 0xd118dd8795ccfd1f, 0x24c8cdf5a5d7279c), teju_literal4(0xa254ebfe2e44e988, 0xc2dd713d7076a274, 0x0b01bb50575a7b03, 0xbdc23cf5ef7a1bb0) }, // 69881
+  { teju_literal4(0x7bdadeb371776245, 0x52781de8a0577669, 0xdff9f0271f0322ac, 0x4339dea9edc53008), teju_literal4(0xf6a10cf8e66e7fc7, 0xe10fa5b11ccf0b24, 0xc88cc9c1c85d650e, 0x17a531b5444e7705) }, // 69817
+  { teju_literal4(0x5aa0444b37c97543, 0x324866ec5a0de082, 0x1e55957a40b5fc41, 0x3c8a401e886efa5a), teju_literal4(0xbb59c5777e3d1061, 0xbcf4bd00b35197fd, 0x90fb47a99e2659aa, 0x90cc7bb285b1936b) }, // 69753
+  { teju_literal4(0x04380ebc3fcdb5d3, 0x69ce03f0a9062488, 0xa683b37d2ce89d1a, 0x80a0556073e8fe6b), teju_literal4(0x8e51f09f24669dc7, 0x19f75b91006a4012, 0x8cab84653982bc54, 0x159d427aa13f7277) }, // 69689
+  { teju_literal4(0x16477ac861a418b5, 0x541bc30833bddbfc, 0x987ab2d2ac851c15, 0x9a72751c6a2dacbc), teju_literal4(0xd839c04ce7cd8c48, 0xd294c95870a6b3c5, 0x7608da9ded543dcb, 0x2d5a27f9ea11bfa5) }, // 69625
+  { teju_literal4(0x3380d0893b682ead, 0x5abd57d5a5b98cb8, 0xd19812d929008160, 0x5a7de30fa3a869df), teju_literal4(0xa4413939ea887cd1, 0x96748bbd54463903, 0x8b9570f1357f5438, 0x9c4d9556dc52cc13) }, // 69561
+  { teju_literal4(0xab9a2e13cd2b4b8b, 0x916a6c401f3644de, 0xa3cae3d3f19d60e9, 0x8161d069ef605b29), teju_literal4(0xf98d00082f15ce89, 0xa23160f9bce3c6f9, 0x7175c6ba0b54d482, 0x734c40f18d8cd99e) }, // 69497
+  { teju_literal4(0x87841ef8191009a2, 0xd593d7cb0295be01, 0x999c0451e4bc9ac8, 0xbd02256c08fff6ed), teju_literal4(0xbd91f29e6d187772, 0xa7bac82c25bd34ce, 0xe1dd9955b81be9d7, 0xda8c42c1b7dc59fb) }, // 69433
+  { teju_literal4(0x8d755a68f9d9cae5, 0xd8944eff2e6326e4, 0xf835f36511b5637d, 0x26087f00ac708434), teju_literal4(0x90018d71415d3199, 0x7ace3fe490a924f3, 0xd6b5508265ff981d, 0x6e89902a615272e7) }, // 69369
+  { teju_literal4(0x947fabf4264885db, 0x99934bf0b73e3820, 0x8e33fb6372c6ce92, 0xdd315d5d78218139), teju_literal4(0xdac97f07e22f54f3, 0x3ee8e1b95c7e9053, 0x40f7887283002f57, 0x46c0bfcc0a057b12) }, // 69305
+  { teju_literal4(0x75909e22dc74e1aa, 0x79ee41ea05167e9e, 0xb469fcdaa2c63e88, 0xf913ce1d90e39a25), teju_literal4(0xa6335b7529913f3e, 0xda1850405ee6c0c1, 0x18d6c9a2e0a53289, 0x26a6a78e0c895f4f) }, // 69241
+  { teju_literal4(0xdcda950a4966eda4, 0x8c6036170b96146e, 0xe8334f4f67d01c2d, 0xd3c41f92734d92e1), teju_literal4(0xfc81cf63d66f94ca, 0x3adbf1de285fb7cb, 0x929cdabc2aba0b1d, 0x665b1759e0d7cf13) }, // 69177
+  { teju_literal4(0x9597904ff8c7fe2d, 0x42d2d5bb0568508b, 0x3fe4efbb2ced8d62, 0x6ee4e78dcf2998b9), teju_literal4(0xbfd0dadf94c06c98, 0x4cf73f2b48a2f356, 0x9f6bf3df590d7a12, 0xf9ea956766f9c6d2) }, // 69113
+  { teju_literal4(0x1254d36af4e52859, 0x9f82e9e6d24b6e4b, 0xd0006590d3f8b247, 0x654d86b521edab47), teju_literal4(0x91b64735c443aa29, 0xede945649a97322c, 0x4988d4a0b4540cec, 0x05e2dc5d8ee9325e) }, // 69049
+  { teju_literal4(0x97cc63d68a7e4995, 0x44191b3ea02975be, 0x3e7a9e5d64f49374, 0x3ddcc21c72f190d2), teju_literal4(0xdd61026ea247b418, 0xce7791822332c8fd, 0x4e872a893ce73c69, 0xdc4f30a2542f0a4f) }, // 68985
+  { teju_literal4(0x6312187440ab77f6, 0xa001533807f0de32, 0x692ed3d60f159195, 0xfe4440174699be08), teju_literal4(0xa82b645fb802b26c, 0xa6466ce7b76a7b49, 0x1de467d0ebe86a3e, 0x3c86f8065375f0da) }, // 68921
+  { teju_literal4(0x1fd491b716c11c10, 0x51742254f3963d5d, 0xff76e869c4b123ec, 0x16829a1452f05bbc), teju_literal4(0xff7f95eae7c6496e, 0xfc30a40447e748bf, 0xe12baa962991f9f1, 0x751d31baac6ae54e) }, // 68857
+  { teju_literal4(0x8ac93952313181bb, 0x2edc580ee12d990c, 0xaedddd935c9a7617, 0xb778e6d2f1754c66), teju_literal4(0xc21692a497996fa6, 0x64616210125c9289, 0xca4e1cba88419781, 0xb2bba6bdea8c65b0) }, // 68793
+  { teju_literal4(0x49917d9d649ab13d, 0x5be1046d1e9b58ff, 0x2038c6162aa80ba5, 0x3fc74c842619da0c), teju_literal4(0x93702d6e4e2d00a2, 0x115c69c3e5770116, 0xe85b6b48fc3f8be3, 0x767dc3fb46f4402a) }, // 68729
+  { teju_literal4(0xee46f46f184a0d36, 0x8de3801cdbc723f9, 0xd8a786f35e662f05, 0x667cfeee4c30eabb), teju_literal4(0xe00062102d88c914, 0x07c1c0ff04188d34, 0x6502235c6e6f252a, 0xbd085872068d874f) }, // 68665
+  { teju_literal4(0xa7028887825ce5ca, 0xb93dab8192629606, 0x1a8f2808f30e0884, 0xa4f2f279c8e83751), teju_literal4(0xaa2965df05e90098, 0x391ef6e531c62250, 0xb6959c20a4d66344, 0x644cbb8ee9c25928) }, // 68601
+  { teju_literal4(0x67b69a43e21aec3e, 0x5bcc3592a036722a, 0x7ca490e600f1a08e, 0xb9487274107895df), teju_literal4(0x81433766f632a8d2, 0xa4420782c74d798f, 0x129e7198f2342555, 0x95359f863a2921b5) }, // 68537
+  { teju_literal4(0xf93383d24b989f5b, 0xd767542e65bce8b8, 0x17b354249b0d0b4e, 0xa6c6c52491bc7c09), teju_literal4(0xc4632e94ffc1bb43, 0x6e3cf8d8fd5a511e, 0xd7b6f681acf2313c, 0x34635e9262abf510) }, // 68473
+  { teju_literal4(0x3e54d76da5061ec1, 0x8568c83c9e88ce82, 0x01e6cd6381c1e491, 0x12ef7ee12e9d5ca5), teju_literal4(0x952f4fcb86d31dc3, 0x3fa2b01353853408, 0x0187902c113d4904, 0x6a7f653015923ba9) }, // 68409
+  { teju_literal4(0xdb751a743eae410f, 0x0468e7614f78919d, 0xe294ae88489918eb, 0xd988a2945fe1be43), teju_literal4(0xe2a7b5c2fb9b71ae, 0x3ddb1f9df05c3386, 0x157e98a20decee49, 0x87f4111874e9b1a6) }, // 68345
+  { teju_literal4(0xf3ee12bb8a8a5506, 0x73570407dd8c4a0c, 0x80f72b6e5fc2af16, 0x962985b813c8a35c), teju_literal4(0xac2d720ec9641573, 0xa31d4d04730da708, 0xe1b8c4e2ae1bad66, 0x23622e42dccea30e) }, // 68281
+  { teju_literal4(0x217bb33b81a56532, 0x3db326e872c83253, 0x09157c340c1510aa, 0x7c558347c56c62a3), teju_literal4(0x82cb3ac7f15e7d57, 0x132433ea9c35522d, 0x82bd75b35e02e9c9, 0x59e5c27364ba3a60) }, // 68217
+  { teju_literal4(0xf045752da5cd246d, 0xf5526e5879de0a29, 0xd6244ca75298bda4, 0xb9e773132c74a6ef), teju_literal4(0xc6b6c396face7f46, 0xdb93f1c5e27933fb, 0x9f0c46283b363dd3, 0x5d03aa41b2251390) }, // 68153
+  { teju_literal4(0xbc5dcfc2e016871e, 0xfe16fe3254ff027f, 0x64ed63e620f6833a, 0x878f637546a9fc04), teju_literal4(0x96f3be2dab3457c7, 0x74dd76f7ead9e122, 0xbbdb5c39d627d17a, 0x87f7514a350df2ce) }, // 68089
+  { teju_literal4(0x94765493a5d8dde4, 0x536422614f45b684, 0x200a2ad9307c18f3, 0xefd23aaed0a9d650), teju_literal4(0xe55715a5cf0bd36b, 0x06086d1ac7889946, 0x9472a08ba3fe1f61, 0x17a1d4c1f11590c5) }, // 68025
+  { teju_literal4(0x1da12da2c31696b9, 0xfc5dc6e44af3ebf3, 0x2404374e77f47d7b, 0x406c128ab3789968), teju_literal4(0xae379b41a340098c, 0xd7f0148d033ac4c9, 0xfa681efdc47d2b5b, 0xd2bd4f08ef5b7b2c) }, // 67961
+  { teju_literal4(0xb341c198be8cf2a8, 0xdb786f6d40356830, 0x49ad404465578fda, 0x1b1267d177057692), teju_literal4(0x8457e3039c39f9e3, 0x9c0bc42e6754ed15, 0xb5b1e681726c6d7b, 0xd5f052100e3f0da9) }, // 67897
+  { teju_literal4(0xbb10ecbef1188f73, 0x3e94f2443f5dba89, 0x40c8a5fb0991f590, 0x044971f714147a47), teju_literal4(0xc91166d017c275dd, 0x260378d05c02aa87, 0xe4ecebf3499d058b, 0x4f0e258cf9723e78) }, // 67833
+  { teju_literal4(0x92fe767bd14e9ec0, 0xf56277e56dcce129, 0x2dec9d4883d16f11, 0x5ca6b98d8bbacdd3), teju_literal4(0x98bd88a51de17234, 0x56fba7815c07d75b, 0xc3eb796c6ca0713d, 0xd09a8e55e9affa70) }, // 67769
+  { teju_literal4(0x9a01e6547bb51ebe, 0xd292bfd744645a74, 0x818ecf978bc73847, 0x9616b102855eb1a7), teju_literal4(0xe80e9a209086ffaa, 0x36c9016c37f26748, 0x77c67c75789b0213, 0x1fd8f72f8660c3cd) }, // 67705
+  { teju_literal4(0xd0cea52afc5c6f2a, 0xb43b3b4a1a36d078, 0x669ee883ad00f4fc, 0x04e418eca4354137), teju_literal4(0xb047f401c580b860, 0x3836268592baa365, 0x06ff639bf0714119, 0x43d7b9aaea51551b) }, // 67641
+  { teju_literal4(0xa041dc40a7fd2c32, 0xd464eabd67c693ba, 0xe6af37596654a7c6, 0xaff036d992a6898d), teju_literal4(0x85e93e2f63b79498, 0xced15ff57b0a4051, 0x968b7b136df942b0, 0x2de46d2d6fed60e6) }, // 67577
+  { teju_literal4(0xd0cfc40a70fb1d09, 0x749edd0caeeeefa2, 0xae3b79d79ca4dbc5, 0x40dc50b5fe99c171), teju_literal4(0xcb732da60744921e, 0xc9067fa870962b55, 0x62ffc3a3ffdb23ae, 0x03ce67e358971983) }, // 67513
+  { teju_literal4(0x753c92e15be8f472, 0x79b58661247e834b, 0x00cfdcffb04fec71, 0x717304c64a960b59), teju_literal4(0x9a8cbf72f9013f49, 0xa4377dc77580a8d1, 0x67fe0ee44065478b, 0x50a765bf5197d417) }, // 67449
+  { teju_literal4(0xefb079732d0273fd, 0x21389edac948021e, 0xee00565668ff4ce2, 0x7a052a8a00a57dc2), teju_literal4(0xeace5be52cb17b6b, 0xe9cff244f4f198dc, 0x8f8288f97bbd37c8, 0x2f36ed29278428da) }, // 67385
+  { teju_literal4(0x8ed21ffd584b4a79, 0x738966792a937476, 0xfa5c613c93062ab8, 0x319a4f8330b836a1), teju_literal4(0xb25e8f119be66ae7, 0xd92860511f4e2dfd, 0x0b0d1c9ed56cf94b, 0x34100dc45ec3f3d8) }, // 67321
+  { teju_literal4(0x3c8844065ec96fae, 0x25321483bbe4b93e, 0xbc115bddc8c304a8, 0x44c6872061f01fde), teju_literal4(0x877f5a8b6aec7e22, 0x483284d09de74cd4, 0xbe4cd70c3b2686e7, 0x5b2153fb8e6875b3) }, // 67257
+  { teju_literal4(0xf66ee8270c38ea9e, 0x551153b7191d40fd, 0x8ef6660d21da49e1, 0x13886d328e73ab41), teju_literal4(0xcddc2dbf5e1d9b3b, 0x871e5a5061a4ed64, 0x40426897535f8d3b, 0xe5e0a1f4b6039468) }, // 67193
+  { teju_literal4(0xa3b7fb4ad0b0aabc, 0x5f44282654932631, 0x77e05b5f75655fc7, 0x9c39bb2885ee99d4), teju_literal4(0x9c617309a20f123e, 0x27bc173847ca2503, 0xbf523ba5558e85ed, 0x6e0ce046375a3782) }, // 67129
+  { teju_literal4(0x3622456ba0a1f267, 0x259db82811d6e07b, 0x4af0cbf4e7be6a19, 0x4ed3ede7070b3f76), teju_literal4(0xed9673f0749e8b1d, 0x81815a1e790b6438, 0x60132c2ed666c5e5, 0x4064e46565bfadee) }, // 67065
+  { teju_literal4(0xd6330ebc59a8c3df, 0x017978c09959f3c9, 0x6a089a75e5f01cfa, 0x669131fa62b83248), teju_literal4(0xb47b7f6c76719267, 0xbf5c7e9efb78728e, 0x42f53c46526e40ae, 0xf925b10627999c7a) }, // 67001
+  { teju_literal4(0x39d0ada66e10bf3f, 0x2f7ad127c62733fb, 0x4651f5c99ae1ea7e, 0x675f4a60ed5f9882), teju_literal4(0x891a46830c9877dc, 0x43a74189d7c79342, 0xa4522d7371e41cca, 0xbee00f121a5b88db) }, // 66937
+  { teju_literal4(0x8902276ddcc345a4, 0x6f2103f7bafc2b57, 0x8013b68ec779f92a, 0x4f2ce8ac0fe8ad39), teju_literal4(0xd04c7d045a039c0d, 0xe647613f44def0ac, 0xb012345787551d8d, 0xcfa1dca552be65fa) }, // 66873
+  { teju_literal4(0xfb2e23f2454f9d56, 0xc8676081b9b0f388, 0x71eb33260e3dab4e, 0x637a7457cc4ad3e1), teju_literal4(0x9e3bb40d5f594137, 0x50441e25f2696d9b, 0xf73326444c596a39, 0x35c58e2a26c05302) }, // 66809
+  { teju_literal4(0x30c1404f3e52aacc, 0xc44fd16b9b3167ea, 0x6fb9b8eb2ee8ed16, 0x1252931641879731), teju_literal4(0xf066fb8b00f03ab9, 0xd1bcab05a1fab9ba, 0x7467d8bda5b7814f, 0xb8c04aaade6b6dfc) }, // 66745
+  { teju_literal4(0x471b2b6a89fc120c, 0xf647340516a2b766, 0xa30554202a1627c0, 0x7a392aa2cc663f46), teju_literal4(0xb69ed84735eba15c, 0x94d4e81f5dd21101, 0xebf2b78caa920ed4, 0xa8c8185f32d25411) }, // 66681
+  { teju_literal4(0x8bf075935b041974, 0x42e2cfb55f134741, 0xe963774cd5f06bbb, 0x194add423befdd40), teju_literal4(0x8aba10ad5e367d74, 0xa2f28c73c2f477c5, 0xcffeafc18bc02a05, 0xbccb8c3729bec8c0) }, // 66617
+  { teju_literal4(0x86d4f247b318532a, 0x94b2bd0e5a664f1b, 0x0c4a052b79514e54, 0x04ddba365e998596), teju_literal4(0xd2c4319fa8ba23dc, 0x14ec5ae27e2959fa, 0x30b7de191ae9b1e8, 0xded084e2f26b0098) }, // 66553
+  { teju_literal4(0x43944a8bc53859b2, 0xc3eb8d1336ddc394, 0x58ba3fbacda54015, 0xff1f1ffc8d8afad1), teju_literal4(0xa01b9354ef4505d0, 0x2f0a09e8414b96e3, 0x41a01a5a75d36223, 0xfeb877f0ba63443d) }, // 66489
+  { teju_literal4(0x97067dca2130c9c0, 0x31077051d879fca7, 0xaf0305abad4142e1, 0x70178128573d7a5f), teju_literal4(0xf3400c4a17a832b2, 0x1c352dff6772c390, 0x2cd3783ef29ef8d3, 0x55d1250baff8b674) }, // 66425
+  { teju_literal4(0x4f447ef3ee22551a, 0x96e60cea6ea613ab, 0x41dbc937d925046e, 0xc14fd8d67611bd5d), teju_literal4(0xb8c8ad10fa7b22ce, 0xbd6c623d2a810608, 0xfa64c219c16cb5db, 0x0a6c3a532f742855) }, // 66361
+  { teju_literal4(0xc26e1fe25fc554e7, 0x9c5cddc02bccd7a7, 0x33aa6d12aaa3f7e4, 0xca0998c97d089e99), teju_literal4(0x8c5ec7cdb49ae959, 0x380e49c4facad505, 0x05b99ff360e12b5e, 0x4c4713311a47633c) }, // 66297
+  { teju_literal4(0x8bbd8f3054f680d8, 0xec67860a1cd15c5b, 0x6f14ee205ce757b4, 0x06fd23e3e8dcef88), teju_literal4(0xd54361ff318e6a3c, 0x316330804226c1f3, 0xcaa886cc158f72d5, 0xd78d5d1e92056207) }, // 66233
+  { teju_literal4(0x51bc917ee9f73e64, 0x9931b79946bd6202, 0x429ccdfefea74401, 0x55a02dca33943971), teju_literal4(0xa20121ea215d1b1d, 0x8f0b1995567fcfd8, 0xce975dfa89f2b587, 0xbb716bcab7f6eac5) }, // 66169
+  { teju_literal4(0x5de22a0de16beedd, 0xeff149254ba823b4, 0x068a1fa85288b748, 0xaf9c1232a9c34a72), teju_literal4(0xf621c01094b1828a, 0x6e07ddb8e740ec8b, 0x6931a5f6dc2691c3, 0x9f422ec086bb8ecd) }, // 66105
+  { teju_literal4(0xecfa1d0dffb223b3, 0x1b29dda19ca80369, 0xd23a980c5b446a5c, 0xaf1487ede9ef0f98), teju_literal4(0xbaf91173d44942df, 0xb63f14c95503e796, 0xc99a96340dd96a16, 0xe56e129231933915) }, // 66041
+  { teju_literal4(0x9940d2bff35ede54, 0xdfce7128b71672dc, 0xf62eefe3cba28773, 0x5c17b490c1b0c9d0), teju_literal4(0x8e087ad42a23c962, 0x04fed474571b8fa8, 0xf844b979c3c2cbef, 0xe878acc128dd964a) }, // 65977
+  { teju_literal4(0x9f112f0e79831de4, 0x6804764ecd345c61, 0xeb809f448ef5959b, 0x2be235f96910293f), teju_literal4(0xd7ca24d4e1367d82, 0xfa84de3da0da487c, 0xafda29381f2b3529, 0x87e6309ef487768d) }, // 65913
+  { teju_literal4(0x09c076b6044a1bbd, 0x0458fc5c0511a059, 0xeff5d3e290a3ae6b, 0xc0e15af46bf1efd7), teju_literal4(0xa3ec710a71308866, 0x8fb991a4d9166bd7, 0xea36b41276c36fcd, 0xea0fbb1015a4e90c) }, // 65849
+  { teju_literal4(0xa84adce35c7335c6, 0x17156bebd08f3857, 0xee64332ecdfb3556, 0x848f5a8ca2cc9f35), teju_literal4(0xf90c310fd52ba2d2, 0xf4edfbce6fc5949a, 0x630df1b6e232d1cc, 0x19a12e53d5a6a558) }, // 65785
+  { teju_literal4(0xc2d59745d6d8c1af, 0xf48f35bb43ec7787, 0x9b2a017b2df8593d, 0x5d02cab9072e0d52), teju_literal4(0xbd301955763f0e34, 0x0dda222fafed8e38, 0x1f92b4e2f087a06d, 0x01247d0715d28436) }, // 65721
+  { teju_literal4(0xf743905a080f866d, 0x1ccd730001d5e8bf, 0x7de9a6af7e32cbd2, 0x6f3d6c70e3dc004e), teju_literal4(0x8fb738de2680276d, 0xd8d3cdd2413f8b25, 0x4acf0569076baa1f, 0x34ca5f9c3a52981a) }, // 65657
+  { teju_literal4(0x24b52fd02cfe20da, 0x74b264298a42c669, 0x3c1be5b03fe7ba51, 0x255c6ed2a0d0143f), teju_literal4(0xda589117781ab8d6, 0x030e7dc5595f0af6, 0x47832f9645a4c5ca, 0x47fc3cb73da7bd09) }, // 65593
+  { teju_literal4(0x6d90049a39969272, 0xefe62b84df85055c, 0x68a8b2074f293c7b, 0x87a9e2dcbb0dcc71), teju_literal4(0xa5dd9227a3071844, 0x4ed5bb5ad7431c04, 0x44c0ff9506a4af9d, 0x76a364d01516c2ab) }, // 65529
+  { teju_literal4(0x3f0ed49a4c7fd0a3, 0xaeecb6c4b4bbca22, 0x8456860f0ac39777, 0x35dd7382015806fd), teju_literal4(0xfbff79c8a57f0931, 0xf74c87f3313eb303, 0xad54fa88e9cdd1e8, 0x3304727b6b5dae39) }, // 65465
+  { teju_literal4(0x02b75dda6cba4ad4, 0x913904cb1f286bdd, 0x889f549a9b0e0a22, 0x24bbe1678e737bad), teju_literal4(0xbf6dd8d7eae0c0e1, 0xa696b025c174ff1a, 0xcb9eedb7804c32cd, 0x7cd32abb734ec11c) }, // 65401
+  { teju_literal4(0x8b79a00419bf66f5, 0x191841958e3f4261, 0x361dc6002a2ef77b, 0x418ec1f685e05d5d), teju_literal4(0x916b1136e813181a, 0xb371b794367524ae, 0x4497712327a6c7e3, 0x3562cacf0990694d) }, // 65337
+  { teju_literal4(0x1724577d8905567a, 0xd2b743174a4e19fc, 0xccb62aa93c811558, 0xb7b712446aac27b1), teju_literal4(0xdceebe035b10d4ee, 0x605da6abeeaf3395, 0xb718c805b08d95d5, 0xf24f562a9739c496) }, // 65273
+  { teju_literal4(0x915c490d1b09ab76, 0x4a8bc084f0b44f8b, 0x4671518cf535ddf3, 0x48e2227426fe6b88), teju_literal4(0xa7d496e862710c88, 0x490d8dc913ed29ff, 0x3e6330f14219faff, 0x76bc4bfe7e9baf16) }, // 65209
+  { teju_literal4(0x0535a1c5241f8adb, 0x698b718a388651b7, 0x90188702f89edfa8, 0xb7de7a0ad776cdd2), teju_literal4(0xfefbb50c3243c288, 0x1f0aba03d54acd8a, 0x726f9466eadb46d5, 0xb728cae3b8a15959) }, // 65145
+  { teju_literal4(0x988faee41fabb43d, 0xca43c4ebc8d25563, 0xcfa7ff30324daf68, 0x72b59b8017797c86), teju_literal4(0xc1b2645a4b4d90c9, 0x0778f91e5dcedd68, 0x8ec4e7a0e88dda8d, 0xccce6adecaa6ddbc) }, // 65081
+  { teju_literal4(0xa4a7ca1e469acfac, 0xb07a12a2e5c649e7, 0x2b4ca389e07703bb, 0xd58c0de87a23f242), teju_literal4(0x932413580ef77062, 0x2e07a68784fdf54a, 0x08a24cf51e69f3a8, 0x0d886843ea878fc8) }, // 65017
+  { teju_literal4(0x40409ccf4be8006c, 0x63aacdf85409a40b, 0xcdad3fa168914e09, 0x046728a8c4da2454), teju_literal4(0xdf8cc31b668ffccf, 0x3f511d1bdaf5aa99, 0x804b96d5fdc3e86b, 0x2156858f7d26fad7) }, // 64953
+  { teju_literal4(0x4e7844b172558c49, 0x29c785532127c6a1, 0x421bb058b5078a68, 0xdfe1a811840cb414), teju_literal4(0xa9d19128e2b7b028, 0xc7ccf0f95f540948, 0x57aacac724b1d6a7, 0x7c6126e951c48462) }, // 64889
+  { teju_literal4(0x61692cb7dea1ec92, 0x3febaefc31bc8281, 0x7258cce53abad799, 0xa348c4b33be8a68f), teju_literal4(0x81007efe7e01506d, 0xd0ebd02f7cea5816, 0x3542a19e39aab719, 0xdeaf352f15925155) }, // 64825
+  { teju_literal4(0xf059eac14971c5d4, 0x1054c78fccf40a0e, 0x331f4075d1f76ee5, 0xd0bda09bb5840f27), teju_literal4(0xc3fdd079786a72b9, 0xf128a5a58370ac1e, 0x10b0c3875cecde0d, 0x003149ee5728deed) }, // 64761
+  { teju_literal4(0x2e072b7b71cecc9c, 0x81b7c006cafff08d, 0x8713f686c433023d, 0x7cb9df9f36720075), teju_literal4(0x94e24eea29a911ad, 0x5132bccc2b10b4ca, 0xe03f37798daab7be, 0xeecb4a417e8e2339) }, // 64697
+  { teju_literal4(0xcd2026b6e6100882, 0xfd9916e38b785ee5, 0x804cde2cf0dcac43, 0x8fcc6565c82ea151), teju_literal4(0xe232b829c465662d, 0x99870034884eb098, 0x0ca1a65f052327bf, 0xedccb21bed846124) }, // 64633
+  { teju_literal4(0x6942e3dc9a987181, 0x8fe500f4d16ed143, 0x5ac008f2cc325e9a, 0xba268600d60d21a6), teju_literal4(0xabd492fb81347985, 0x8db412d8289f4a18, 0xffdce455ee2f147e, 0x1ef177df09a41852) }, // 64569
+  { teju_literal4(0x268f1f7f7a13fb49, 0xa2cfa929f3832e3b, 0x2d8651d89866bdf0, 0xd27295a10c5b69d5), teju_literal4(0x8287b807e6ecd253, 0xb5af239e8162d303, 0x0daf6755cdd60380, 0xc4a0de36a148b03c) }, // 64505
+  { teju_literal4(0x6fe683eb8da7654a, 0x0c70e6e4bebf596e, 0x1e1154ea4457dbe2, 0x18de36ab15d569f7), teju_literal4(0xc6503210d63e6d77, 0xed208ce5c26fff97, 0x9349b5057c1bc6ba, 0xd53d739e106c3310) }, // 64441
+  { teju_literal4(0x4b8ef34e26272e5d, 0x7d45bf226b2e710a, 0xb9f16abaf1b32758, 0xd84807a43e4da20d), teju_literal4(0x96a5d3c54358caeb, 0x4a3da2326411fb89, 0x9bfdecbd91522d44, 0xb2f5abb4413c2586) }, // 64377
+  { teju_literal4(0xce25a21180c32885, 0x006ec87f4438a027, 0x677f2d9c57578b53, 0x4731cf73e10dade7), teju_literal4(0xe4e0b540c3f10404, 0x3e26c664d2b7524e, 0x29927bc652121103, 0x0c1f4917898675de) }, // 64313
+  { teju_literal4(0x6a67f9b3ed9b6285, 0xdb76fcf383bef6b2, 0x0f94644f5736c7c9, 0xb44afa3c0f68eb99), teju_literal4(0xadddaea96994809d, 0x95a74c47a9fbad65, 0x4acc2af692afe2a7, 0x06bf06c3b58ff382) }, // 64249
+  { teju_literal4(0x8fb2856e27705847, 0x48a998e11cdbda81, 0x92fa6cab4867c158, 0x9f3021e359cb978a), teju_literal4(0x841393865b8631b5, 0x59501f330e3c42e2, 0x09471b43c768dac0, 0x3c7dc6253f5d5104) }, // 64185
+  { teju_literal4(0xc83359fc2c5fe704, 0x66ffe4ab0bc75e23, 0x35b92f131ec7ba20, 0x45169f4e590a739b), teju_literal4(0xc8a99e3b098721a3, 0xd0253701db6dd156, 0x0aee4bf834595c38, 0xd338725dd5113e15) }, // 64121
+  { teju_literal4(0x49da49e9a8bd630d, 0x48038232b100d228, 0x1edcfce99de7783e, 0x402c605805b52867), teju_literal4(0x986eb1f173efdc5b, 0xdeb43cf9f310b6c7, 0x8e6c112ba5b68c30, 0x5307808a29c23a7a) }, // 64057
+  { teju_literal4(0x66c4bd89782057fc, 0x60be8f4e40c66bfd, 0x0e7081f8385108ca, 0xd49bdc42eb6f92b2), teju_literal4(0xe796d2bbb4f200d2, 0x52964f4ec609a275, 0x88a5220eaca6f28b, 0xd2f5eddcd7c8226d) }, // 63993
+  { teju_literal4(0xbd6aeaf6a0eb9e62, 0x84d9cc6ce0443c43, 0x2ed224f4764d7e9f, 0xa80d0f66d3de1afc), teju_literal4(0xafecf6b33c0e1e49, 0xbf6442a97432389a, 0xb4a6ac1f299896c9, 0x64df8d0941d796bf) }, // 63929
+  { teju_literal4(0xf7b3ef06ecdce448, 0xa0d552592736ac79, 0x72631b913abcdba7, 0xb12ee1cd24c7de3e), teju_literal4(0x85a41f8803c4a3f2, 0x20ed73d4c15d7687, 0xa00109de43bdb09c, 0x926a1f26f1b226af) }, // 63865
+  { teju_literal4(0x9c65071152ed5aa7, 0x593a165de752b75b, 0x45fdf779f630a74a, 0xb59bf012506573ca), teju_literal4(0xcb0a2a52b78c41bb, 0xe3a663eeeb300330, 0xfebab922b05dbe49, 0x27150b75190aceda) }, // 63801
+  { teju_literal4(0x48f03cc2117e1989, 0xc0b058f17b06490f, 0xb3203419caac96b0, 0x4524b6199aaadf71), teju_literal4(0x9a3cf9a771c83b11, 0xda577a5263da5b1e, 0x1b424d5b09dd1e8f, 0xd11425d56dd69c1f) }, // 63737
+  { teju_literal4(0x36e2d04a042501f3, 0x383d977bb94529b0, 0x327a14d5ebf232d3, 0x992fd4117fbc386d), teju_literal4(0xea55293fc4eac54b, 0x2a1007a275c30449, 0x6fcf6cd61bd32cda, 0x4724e069a1543a51) }, // 63673
+  { teju_literal4(0xc3fc4362cd40b7a7, 0xff6cd24cc0cb51dd, 0x2fc549e8266db487, 0x8e178378be30d181), teju_literal4(0xb2027dd1b58e9b40, 0x4ede277c91efcae9, 0x4691a560cf108e3a, 0xa524449f65ca080b) }, // 63609
+  { teju_literal4(0x1f4b7cc3e3cda7dd, 0xd2475a54a8010f47, 0x98240f79f6f346ad, 0x6ff6c71862f6fbf4), teju_literal4(0x87396a45a7b651a2, 0x10b1972c9b5dea78, 0x995406be51d7785c, 0xe89aa8b1ffe81fb9) }, // 63545
+  { teju_literal4(0x1490ccb7dd5b047c, 0xae978a5d1945d5eb, 0x492aeb5520d49b87, 0x36fc13166de74fc2), teju_literal4(0xcd71ebf34838c9ce, 0x53495df7b28c0d88, 0xdbb19502d45fffcd, 0x6821f3497a5e3bc3) }, // 63481
+  { teju_literal4(0x63f9d4c9a03b2e2b, 0xef62eba0ec3f2217, 0x1791830047fc6bdd, 0xcde89f5197604a60), teju_literal4(0x9c10bb51251ec0b3, 0x8aa7863afcff5082, 0xefcdcd214a838eba, 0x5ce2b86009606485) }, // 63417
+  { teju_literal4(0x067d5aa77ad8879d, 0x79bcc7f91397d6ff, 0x719b0b373d335aa8, 0xa543dafb83ea5d5a), teju_literal4(0xed1bd1bcdf2467cd, 0xaab0bf0c1f721f9c, 0xcff01fd784733c8c, 0xa4de71be9d6bbd06) }, // 63353
+  { teju_literal4(0xc0d4db6845904138, 0xa6ee54cdaa3cc4fb, 0x9462209e787628d1, 0xb614dbb06a9b0697), teju_literal4(0xb41e56f659e5e78a, 0xd21cf20ca4d561b5, 0x4269d9d886fc3104, 0xe44222f1f1451e41) }, // 63289
+  { teju_literal4(0xb308180a6dac905a, 0xdba6c54db633946b, 0x4e044fd569edce6d, 0x55cc3a9450cebf62), teju_literal4(0x88d3822330c550e7, 0x9f03d971324b3302, 0x06a281efa9addb1c, 0xd4facb5c8d496ad8) }, // 63225
+  { teju_literal4(0x79985e5468038e9a, 0x01251516c5ac234d, 0xb247bfba5b06459e, 0x99f35e986dd1db94), teju_literal4(0xcfe0f8f9aa80db21, 0x4e05115379e35389, 0x1f003d74d1621df0, 0x3a2d5a9b1b6040b1) }, // 63161
+  { teju_literal4(0xbc535b3af4a12e3d, 0x52168a9673cd6676, 0xaf2dc63b0f9d95cc, 0x30afa93f4217a694), teju_literal4(0x9dea078a3d4483b0, 0x39b05da8b8870f76, 0xdce01014b9d71d14, 0x07ce79d6577f0e72) }, // 63097
+  { teju_literal4(0xd4d5d4a8b9f866a0, 0x7d490efeabf8bd18, 0xcf3f4ce74e6d66c3, 0xc8834c9b386af085), teju_literal4(0xefeae56e8f5978d0, 0x41646db809c21646, 0x4cc17cb1981a0b5a, 0x0169b94b3fe022e9) }, // 63033
+  { teju_literal4(0x07552f22688ca2ab, 0xe052b35b7b849976, 0xa37e7c691e315ccc, 0xf5ba208eba94636c), teju_literal4(0xb640954c1ff66533, 0xf6a67ee106751e9a, 0x8116443135ef5ef3, 0x1939f42e497c34be) }, // 62969
+  { teju_literal4(0xa567b6fdd98d8ed1, 0xe411d4bcf7263b27, 0x6eeb636b48ade733, 0xae0c092f6a16dc66), teju_literal4(0x8a7275b02c84a87a, 0x00f936a7aeb831d3, 0xfc62a938ad5736a0, 0xc656d4570dc010cb) }, // 62905
+  { teju_literal4(0x97a02c261c379261, 0xa1476b6016b520ca, 0x3ee55a5455adb8ea, 0xa52b5a81284c143d), teju_literal4(0xd25767851b1b34fa, 0xc0b58b88debd01bd, 0x7e31c8e7ae8505d4, 0x9da230710f931886) }, // 62841
+  { teju_literal4(0x7a571662173164cd, 0xa24f6070645d4699, 0x2aa0fb29674ded04, 0xbc3a568843650f21), teju_literal4(0x9fc8ef20c794a402, 0x0e249b8852af404e, 0x89ee63bc1e0ff797, 0xb30de09cff71929e) }, // 62777
+  { teju_literal4(0x1b7f8c283af08461, 0x809e6ed6ed68f258, 0x2421c43cdf0cb1c4, 0xbf82095a303d4b8f), teju_literal4(0xf2c27ddce710388d, 0x7cc93b2fc1e65ff3, 0xd7ef119467270930, 0xab75923ee4d850df) }, // 62713
+  { teju_literal4(0xacc823fec8711fdf, 0x5ed4d9a32e4e18c1, 0x8085fbaceb65f38d, 0x999cf7949b102d3e), teju_literal4(0xb8694c381feee345, 0xb82f4f352f4727b2, 0x93099e118430a6c6, 0x79c1cb1a24b81cbe) }, // 62649
+  { teju_literal4(0x544a6ab5810a19ec, 0x81a21b7435c8abe7, 0xdc252f4ad85901aa, 0x2e01798f65faeda0), teju_literal4(0x8c1653a8510a0052, 0xd2e298295e296d29, 0x928b15603df07abd, 0x626bae4520e74080) }, // 62585
+  { teju_literal4(0x7a5c13957825fe70, 0xf8b880674ac65e5f, 0x6e473c3d8b56a394, 0x5d2ba059bfa28051), teju_literal4(0xd4d54df7ed9558d7, 0x68d3d17cc3be6b48, 0xaed7fce87e2d7251, 0xe5eecd93112b34ed) }, // 62521
+  { teju_literal4(0xa29b4f156d9bfd43, 0xb96adb771e18aeb7, 0xe9b3a4be178c6132, 0x767b46951077b18f), teju_literal4(0xa1ad8315c833e8a4, 0x516cb8813d407350, 0xa12cd4f75d6c59a0, 0xce664aeebc4c8a10) }, // 62457
+  { teju_literal4(0x1cae62ece74fbc04, 0x05977f85f6849323, 0xb7a89e4a11804038, 0x0d7f7ce25fb279dc), teju_literal4(0xf5a2b4dd65ac5aa5, 0xa4f0445e3db63c12, 0x8950c60099369a95, 0x94c5fdb6e3e43cf3) }, // 62393
+  { teju_literal4(0xfb636f3e5c9dbc87, 0x0cc73cb252704893, 0x75bda3766ced42d8, 0x19ef77a720ed74f8), teju_literal4(0xba988f5a4394f8ba, 0xc5010b5140ec608c, 0xc90ba0dfd0975932, 0x42112d6f98c19ae0) }, // 62329
+  { teju_literal4(0xb3b98a8165666268, 0x693b52149b30ce78, 0xbdc007c49db99c52, 0x11b3e9dda375237a), teju_literal4(0x8dbf2af402d8b2ff, 0x9de9cd0efb3e0ead, 0x85d6e1620672e0bf, 0x3589d4aec1212b3f) }, // 62265
+  { teju_literal4(0x0f023eccc6d073c9, 0xa80d368db9b84a44, 0x50318a7a765ad865, 0xdcdb6ece77127127), teju_literal4(0xd75ac2f857c97dc6, 0xf94a372a63804649, 0xeff5444905668e68, 0x24527da83c81de18) }, // 62201
+  { teju_literal4(0x59e0a14c32768a14, 0x994073cc7f1bca1e, 0x44e6ca8170025204, 0xf63d8a04537b35f1), teju_literal4(0xa397d49dd49f9a27, 0x6f2b4d14f8b32842, 0xc5366b75d4326eaa, 0x0f665112124e9f0b) }, // 62137
+  { teju_literal4(0xf4a4665001da9ee7, 0xb477895b117fca77, 0xd2fbdc249be1b08b, 0x17e394cf50d39efb), teju_literal4(0xf88ba493e340951b, 0xe8ad6ffa2e88280f, 0x96b4a0e7d22e4d89, 0x8a54c8927f3cde49) }, // 62073
+  { teju_literal4(0x8d19d36989bccd29, 0x941109cf660576ac, 0x9d97b64ebd61e626, 0x27a569747589171e), teju_literal4(0xbcce728df8a601c8, 0xa1b5e3850af3019b, 0x2db796126eadabb1, 0x5181d241feedac0f) }, // 62009
+  { teju_literal4(0xd164fc64f52215ae, 0xf30778ac9bd8fa00, 0xef89b0722c382513, 0xea48caab1332f714), teju_literal4(0x8f6d0aa8dc6300d8, 0x1079caf55ff3a01a, 0xcf27773dc1e563f8, 0x2d219321b7c35ce5) }, // 61945
+  { teju_literal4(0x37f1d6940700c5e2, 0xe4ca9e7e1a1c546f, 0x3265c0322d2f40bf, 0x9ffd0f68dcfe5cb8), teju_literal4(0xd9e7dd713fbd8c49, 0xebacd1b3b410b027, 0x4c554613acbd90b9, 0x1f5a303c2fa60547) }, // 61881
+  { teju_literal4(0xb48166d2fe4fa748, 0xdcef794b2d358839, 0x95fdec802cb5b7a5, 0x67e04b080e71b5a9), teju_literal4(0xa587f521b011173e, 0xa091b37524a67b9e, 0xcfa1d5250ed43b91, 0xd229d9f938f526d7) }, // 61817
+  { teju_literal4(0xd94e44157edf0adc, 0x66951df4c5a7d94d, 0x7d1fdabe2cff50f1, 0x61185916d7c70fdf), teju_literal4(0xfb7d67737e285112, 0xe1657242854e79e8, 0xe9690efe866f60f3, 0x6c262bc715b1bdb2) }, // 61753
+  { teju_literal4(0x60feb00881987aca, 0xb7936a6fe9d6ba6b, 0x1860085a52add8bc, 0xa9ba203132262684), teju_literal4(0xbf0b09eae55514e3, 0xa81f826f7119d9ec, 0x9da7d1fe9d6f2969, 0xbb27d980461d00ea) }, // 61689
+  { teju_literal4(0xc69fc3b395b46a9c, 0x77211df2f57a1b3a, 0x4b5045109996c334, 0x78f4f847787df570), teju_literal4(0x9120020a372634c5, 0x4c3b6662f773c528, 0x406345427504fc26, 0xa990a283219c6a3c) }, // 61625
+  { teju_literal4(0xf67dc367959ac862, 0xa013b8aadfdc50aa, 0x8de5113639e4fba5, 0x2131f75f23d91a00), teju_literal4(0xdc7cb4930bf271f6, 0x223f59d3269ae6cb, 0x43295507dc759daf, 0x90bfa6732f7925cc) }, // 61561
+  { teju_literal4(0xf821ff933b6e165a, 0xc14929cb0d535e64, 0xef764ebf65fdd8ef, 0x835bea7ea61abe1c), teju_literal4(0xa77df63ee9bbb0c7, 0xb63c35a755b702cb, 0x189b53ff393acacb, 0x4367010fc52b98d1) }, // 61497
+  { teju_literal4(0xe4751463e1eada46, 0xa34006dd2270f975, 0x46349a1df7d6af59, 0xec11e09be9f384ec), teju_literal4(0xfe78183f8b71ecf5, 0x1f1e134da729769e, 0xace776972f3b1cde, 0x989f5b44924e3d04) }, // 61433
+  { teju_literal4(0x0e860d97b4bc9d3f, 0x24f50701815b6565, 0xef70beb1c4776fb7, 0xfaa01d65f68e2a3c), teju_literal4(0xc14e69c59eec5813, 0x20f9aaec5a18c60e, 0x00a2918d36ea3ee8, 0x1730a78ff6a0166d) }, // 61369
+  { teju_literal4(0xd31424636e5ec2ef, 0x9f2579fc6e77bde4, 0x4bfff6bbcd5a88a0, 0x6c9fb319be5546fa), teju_literal4(0x92d82089b66698dd, 0xf4d015bf8b1f85c0, 0x2b18dd8f646367f7, 0x2287442e878c96c3) }, // 61305
+  { teju_literal4(0x16fba4e22a8190c4, 0x53471b0a9c9eb1e1, 0x829d4399b27c9cd0, 0x8aa68a1fdbe77096), teju_literal4(0xdf195fd4762b3252, 0x7a48d91afdc6b982, 0xa85bdb7e4a40c8bf, 0x9e6bd0f15726b9bf) }, // 61241
+  { teju_literal4(0x0b8cdf904f9d1725, 0x9abfa86fd9660378, 0x6cb2ff6c10c5081b, 0x17e88278273c5bd6), teju_literal4(0xa979e9c87cea6ba4, 0x6c6fb57b255b04a2, 0xce364157e3a5220b, 0x62bc41f1cb545eca) }, // 61177
+  { teju_literal4(0x94d671530b244c26, 0xe0284eb57d220ecd, 0xab4a870b218ffd87, 0xedf1ca3a354e1961), teju_literal4(0x80bde90645110ca6, 0x06ea6a604b141db3, 0xd0e3c8c38ba81d37, 0xd06bcf8d9035722d) }, // 61113
+  { teju_literal4(0xb52a00a2eebc2cf1, 0x2038737540515bd2, 0x1ca4ad56b23637f6, 0xaf77266d8193262e), teju_literal4(0xc398a6b06298329b, 0x1bfa4cce7d52711d, 0x959a441a6fb78f90, 0x984b308967929f83) }, // 61049
+  { teju_literal4(0xe2ff8f588a318b21, 0x9b684afe7790d13d, 0xfcabdbeaa551d96a, 0xc2bee776c5d0c00b), teju_literal4(0x949575c7d39027de, 0x32c86e5e5c4cd165, 0xa3e97d036433f16f, 0x71b7a786d98f20ae) }, // 60985
+  { teju_literal4(0x884459db7884aa8a, 0x7750503305854bba, 0x4c17c51aa63eedf2, 0xf404aa3f319e2cdd), teju_literal4(0xe1bdf6f360b330c7, 0xa3c0aa9a90b9b65f, 0x7e699d89bfb84964, 0xe21d4b7cf6d2fc22) }, // 60921
+  { teju_literal4(0x714dac305a5a4646, 0xa115e1ed266d738f, 0x0a33a6fa0c53bdfa, 0x0a5227df7f5fc8a5), teju_literal4(0xab7be1c7730357c6, 0xc08d22651a2754b3, 0xf0b971ac54bccbad, 0x274d5ac684efb47e) }, // 60857
+  { teju_literal4(0x09b64fa6cf86092c, 0xa89dcb4a7b5e137b, 0x3b6ca4d271389ac2, 0x90698ad31c7361f8), teju_literal4(0x824458208cac79b5, 0x5dac1531be39ff22, 0x6d751916abbc71ae, 0x960958c78f4bc0ef) }, // 60793
+  { teju_literal4(0xf1c0cbfa2e334abb, 0x2215ab9ff5d32262, 0x07f41d5dc34f0a50, 0x454743f8e0814bbc), teju_literal4(0xc5e9d57bd062eaab, 0xfe92c633f4737cd7, 0x1ca57c25e1ae8fb4, 0x31ddf9756b0e62d8) }, // 60729
+  { teju_literal4(0x3ef2dc31434d9011, 0xe3086b31f3785e2c, 0xac2745e0678476ea, 0x79463bae5ec0dbb2), teju_literal4(0x965811946c40f773, 0x2cce09513e69fe0c, 0x84ef9dec959f2cef, 0x9f386ed294efd58e) }, // 60665
+  { teju_literal4(0xab903ed192c28ad3, 0xf051441a1612d75b, 0x271c8265ecddee16, 0x86beafbffb61de44), teju_literal4(0xe46a91f5ae2b4636, 0xcf41a51467f48f68, 0x4a30164ea7c119cf, 0x85121343c42d8b52) }, // 60601
+  { teju_literal4(0xe5bfb400254b9951, 0x942016bb84f69c28, 0x194319eb1834c87d, 0xa842ba4c95aac8ca), teju_literal4(0xad83f07b87763d0f, 0x76420477c874301c, 0x27be915a4e424f18, 0x792ffff77167cb1d) }, // 60537
+  { teju_literal4(0xafe595decd9dfcf5, 0x10a8259d29753526, 0xd3d9d36d7e878b32, 0x5b23fd1bc83f48a4), teju_literal4(0x83cf674b78b0cda1, 0xdeaee9bc6085c03b, 0x9786045c63d2471e, 0xc766512045855105) }, // 60473
+  { teju_literal4(0x2ae205e331793b11, 0xeaec0e627c8ea97a, 0x2a6db6ce67bd28a1, 0x2ac867955df7df35), teju_literal4(0xc8420b37a86752ad, 0xba07dab9338adb08, 0x260d577a236a0d92, 0x27a031d3088c10d4) }, // 60409
+  { teju_literal4(0x916dbdb927d2d54c, 0xf8bae5722f0cb2a7, 0x9f084c0af28de759, 0xd8e9b6d08fece76d), teju_literal4(0x982003ef5202666f, 0x15617fdce9ca1afa, 0x967f9d1e250e7170, 0x69ed343f87d2d8be) }, // 60345
+  { teju_literal4(0xfe541652d90944f4, 0xfff0c32bcb28ed6d, 0x9bebbbab189a8da6, 0xe7d98cfffea43f48), teju_literal4(0xe71f492a1be54bbd, 0xd3b3f79713336566, 0xe5216e257b6bf3f8, 0xfd0f35d3f35f1aa1) }, // 60281
+  { teju_literal4(0xdcd592e1814f3e7d, 0xd35e7324f5f11a9a, 0xf08f42936912e9b4, 0x0172887e54d03f46), teju_literal4(0xaf92285bcd9c700f, 0xfc1f7d392f50e804, 0x9d2021f2bc8826f4, 0x2090879339017d60) }, // 60217
+  { teju_literal4(0x6bc080649a7cc263, 0xf98ad1b462f19069, 0x69b37122a184d241, 0x82b1eb3fd6e12fe5), teju_literal4(0x855f248defda8e21, 0x5036a9c48a8750b9, 0x2af2a41db2a02548, 0x31dc92648be912d1) }, // 60153
+  { teju_literal4(0xb56d04054bc418bd, 0x49c10a446fd3ae1a, 0x0f81d8f42e95f75b, 0x8d5c85bd08b01105), teju_literal4(0xcaa15d338a413dde, 0xea456be1fac28d69, 0x4c796f09215d267e, 0xd4f8bfb36629822a) }, // 60089
+  { teju_literal4(0xde23cbe8aa94ea7c, 0x50554b9c0972b0d5, 0x4c89f14eef981487, 0x521694478319670d), teju_literal4(0x99ed5d08dbb62946, 0x5f4a236d8fb514d0, 0x61cd6b33f2df307c, 0x8351c82205c38db3) }, // 60025
+  { teju_literal4(0x3f32464e9f1a9124, 0x51b62ca71dea6e38, 0x370549cc0861fe02, 0xefa39c26d07518cd), teju_literal4(0xe9dc35291ed5db6d, 0x230241ea97045124, 0xa0644095e466706b, 0x4caafe1d98fb5821) }, // 59961
+  { teju_literal4(0x4c613fdcd0bd9670, 0x5c0f4759a37bb3ee, 0x5b0b961e3dcce435, 0x111387371f1b8201), teju_literal4(0xb1a69c17588fb267, 0xc8643bfaacdeffc5, 0xd2f6d025c4ab325a, 0x09ab8df8b0ab08cf) }, // 59897
+  { teju_literal4(0x981d80d649ba5721, 0x2d133b2aca976845, 0xf52a2da34391853a, 0x1e037134717affb4), teju_literal4(0x86f39e1962fccde9, 0x692cf98062786089, 0x7b71a1b7f2ace37b, 0x806e31b6ff55eba7) }, // 59833
+  { teju_literal4(0x9faa8b8ba2cb860d, 0xbacbaba659806515, 0xa9a3dfda3646397f, 0x6cd4f683d3d560a3), teju_literal4(0xcd07e0ffb6c2885f, 0x7f02777b5c29e93b, 0x3106df6cd8d2b02b, 0x976d884e2828d883) }, // 59769
+  { teju_literal4(0xf3f3559a5c66d945, 0xc1e640f588088c98, 0x3c5873f9123b2048, 0x17840d38f56361bf), teju_literal4(0x9bc02d4278bc5eb0, 0x80eb9562d3b69a87, 0xa71944d940c6594b, 0x1f2ceb4e7891125d) }, // 59705
+  { teju_literal4(0xd7279c2f6f2365e8, 0xd3eef7a145249591, 0xbe3cda2062c930c7, 0x50f3873d1e09c139), teju_literal4(0xeca16ed5c3241f37, 0x13a9b6562a85cad6, 0x9256757c80d76abc, 0x3aa6147e6dd5c07f) }, // 59641
+  { teju_literal4(0x921a747e556a1f0b, 0x241ec4da8cc083a4, 0x4407bd2cc92546e7, 0x2ae926194c43f5df), teju_literal4(0xb3c15e95e4fe1451, 0xb85cc53f40a43e80, 0x3e88576bfb21dfdb, 0x3bae4af1fa27cfa4) }, // 59577
+  { teju_literal4(0x2b477fe19ccdfac6, 0x1121ceb87b1c8b4c, 0x23b4665fbd8ff5cd, 0xb2b497aa07a0a4c0), teju_literal4(0x888ce24a4e036db0, 0x6d1c495dbab16778, 0xe9219e0aa28bfaf2, 0x48e12d1ebae646c1) }, // 59513
+  { teju_literal4(0x271b23d3a76604b5, 0x206a56c357706456, 0x5bce422822857afe, 0x748e45335cf10009), teju_literal4(0xcf75ac6dd3f3935b, 0xb9969c90b117d23e, 0xf33b97bb593e4f13, 0xc518ea6692d9b1c6) }, // 59449
+  { teju_literal4(0xe52a9444c2c486f8, 0xa9c781fb1d6204ea, 0xe2e35b82f92c6b4d, 0x61920230fa48f643), teju_literal4(0x9d98852f45d7e5ef, 0x73d0a6b5ca6af2ee, 0x5cef8e63b84559c5, 0xc99767abfd3e17be) }, // 59385
+  { teju_literal4(0x5e40ea4bd2de2f76, 0xd1ac69da9b8f02ee, 0xc28b25de0d511614, 0x3f2fb8bc04d761d1), teju_literal4(0xef6f0f5e8e5f9e2a, 0x81bf1ba9facea8bf, 0x44956bec86d9f8fe, 0x775b62b3f65628d0) }, // 59321
+  { teju_literal4(0xe870b9ced8d5e8bb, 0xc7cc4cad3ea075b5, 0xcdb38c0b4d1dad6d, 0x8626b1aa25469c17), teju_literal4(0xb5e282f88500df08, 0x99216c31143191b8, 0xf5affd103c6a1e7e, 0x1080e054a8d5641c) }, // 59257
+  { teju_literal4(0x64e3b774c72bd4f3, 0xb8dba8909ec5a69f, 0xa01222965be98ce5, 0x0f9a9503cb3512e1), teju_literal4(0x8a2affa8ba7c9b8b, 0xed515f923bc66908, 0x6625c3b126b1c0f4, 0x1085632d63e707cb) }, // 59193
+  { teju_literal4(0x3ff45e02ed09bc2d, 0xfdbff7343c99203f, 0x7925024cf4e97ce7, 0xda44253b030f7d5b), teju_literal4(0xd1ead591b3662ae7, 0xf6ab4669dd84d1cb, 0xe6e071222dc13520, 0x4d0e47b08d06c960) }, // 59129
+  { teju_literal4(0x80a64d7ecc53d256, 0xbdf462b114193531, 0x68aaf6aa341cc749, 0xcdb16dc0a5f39635), teju_literal4(0x9f767594a3d64019, 0x6030bfef8527eebb, 0x9c032d8e9eb020a1, 0x2ba05755f343f103) }, // 59065
+  { teju_literal4(0xfa0f55e0d64f08cb, 0x7f97ca30512a4214, 0x5e0580e68a443f9a, 0x858b94aed38e684e), teju_literal4(0xf245303e6464101d, 0x6d5afa1c3adfb15e, 0x9d64625483ca6125, 0xa6392367ece76505) }, // 59001
+  { teju_literal4(0x08ce1f01c526a8ed, 0x800530463dd7edd4, 0xca9179de8b347f4a, 0x863a434eaadcdaf6), teju_literal4(0xb80a1c9a4dfca1f3, 0x6bf02d65cd034cd6, 0x9d4773ba4b0f1c30, 0xad70216de8fd5af5) }, // 58937
+  { teju_literal4(0x2f97298d32204456, 0x9308c181a2ff8968, 0xa70fddad328857f9, 0x4787593d5d7e3c15), teju_literal4(0x8bce04e8c3ae3332, 0xe5a2ce82f1cf6380, 0x1c53763671dc1015, 0xadfe746f8cfaf341) }, // 58873
+  { teju_literal4(0xad17bb28ab43aad1, 0x25dfd73f947753fc, 0x4994829ef8026b78, 0x898b526c4d3f29b5), teju_literal4(0xd46772c21ae1e038, 0xa94ebc291f074e04, 0x56763443683d3aa2, 0x02e49c0871bdf021) }, // 58809
+  { teju_literal4(0x531c75cd67bce9a4, 0x7f88dfe5c37698c3, 0xcb2f04f3fd53ad4b, 0x40e274ac5e911599), teju_literal4(0xa15a0f6ad00055c8, 0x340af94d820670ff, 0xc95c66ea00778212, 0x551c56e7aeb3cd18) }, // 58745
+  { teju_literal4(0x66d3aa194d9d99b1, 0x0b101ad5330cb737, 0xcb5095582c00a01b, 0x306814d8c95abe66), teju_literal4(0xf523eb3d6ef35847, 0xe11590e772478a0f, 0x46ea094e0c1adf56, 0x9ef278f80823c43a) }, // 58681
+  { teju_literal4(0x6c513125b6e800dc, 0x225dcead2f665e44, 0xe86fb99ea688540d, 0x29b68c4c80af2c4b), teju_literal4(0xba383f1108908f0a, 0xd9221e4113ce8683, 0xd645eb2c0e1b58e2, 0xde615c4f6c17fc15) }, // 58617
+  { teju_literal4(0xe2a8d23d67f598ed, 0xadff4460e1cc064b, 0xc190d3c02d1da76d, 0xa9e5c853405e86bd), teju_literal4(0x8d7600eb1c3bafb6, 0xc45c9a4f32f5cce3, 0xb33bc62a4ba2e14c, 0x71feb28d438b6a37) }, // 58553
+  { teju_literal4(0x80a2300b87d29480, 0x32be852a9ea06a0b, 0xb279d7bf9b3e66e7, 0x1060625f138273a2), teju_literal4(0xd6eb9a998f70f83c, 0xdcb4c82bbd064b14, 0xccaa8d8b025a1e71, 0x72f1fc6e2d69a654) }, // 58489
+  { teju_literal4(0x22dbc0fab623653a, 0x3783d80f3f35da4a, 0x61d6f4ea4c9c0209, 0x7d5e52d77e192495), teju_literal4(0xa34363dd7e598acb, 0xd462412115c75145, 0xf05e966b38c917fd, 0xcdd6734dc0cd33ff) }, // 58425
+  { teju_literal4(0xde5cc7dd4c4bb593, 0xa1d6b9c8cc97a9f2, 0x595c85c66c455043, 0x9fedf2e1fdec3e5c), teju_literal4(0xf80b5a72080ddff4, 0xeeb670ad54a57151, 0xe2c0a39c0967f412, 0x55b1304af7bf5d5a) }, // 58361
+  { teju_literal4(0xbd8fe553880511dc, 0xef5a6c39be32f2aa, 0x5aeaf5f816a8f592, 0x74c0ac54a0c9747b), teju_literal4(0xbc6cfe2de29b65a2, 0x42f855d54aa992d6, 0x78732a23a8bbbf48, 0x4f8ebb2e623526ae) }, // 58297
+  { teju_literal4(0x8e5b0c5963b46706, 0xf1105ea86c18a1b2, 0x8378505baaa9443a, 0xa234753bd073fc9f), teju_literal4(0x8f2302bd95616d7f, 0xe678e9d0da5a8f2f, 0x456c6989227f332b, 0xb4c844ad297e1236) }, // 58233
+  { teju_literal4(0xb28de9a5bccb0098, 0xdfc6b883893b5d0e, 0x97f1053417ef2bd1, 0x284db93d6d1185c8), teju_literal4(0xd97763f722d5243d, 0x453b5114bd8f4bed, 0xba31e87ff45c2158, 0x33d811ecf3d2e239) }, // 58169
+  { teju_literal4(0x412506cf84e34864, 0xb7178691ee59d0d7, 0x9249a74c51c401cb, 0x0fc56d5763b38e7c), teju_literal4(0xa532844c75b299e5, 0xb8a4a5893be23836, 0xeef09b2229bcbae6, 0x5b1d2305473f7f2e) }, // 58105
+  { teju_literal4(0xaa2c174f027adac2, 0x192a42c23a4ae044, 0x565408573019c5d9, 0xe4205ee813bf5ae7), teju_literal4(0xfafb9841a711a35f, 0xd2823c56b35e2749, 0xba86db949aa1a8c8, 0x5e3bd144ce11997d) }, // 58041
+  { teju_literal4(0x7088d82f53257c82, 0x65f7778bb5023ba1, 0x702b51e67e334b47, 0x0f60b77a7e7e34cc), teju_literal4(0xbea86dfe235c3db0, 0xaf611c4879233300, 0x7c0edc9342b5af9e, 0x91276bf013cc3c92) }, // 57977
+  { teju_literal4(0x2ec03a7c756978ec, 0x79d731592a042512, 0x38c0322696b3d380, 0x93aceff0015d039b), teju_literal4(0x90d5199ba7ca09be, 0x2ceb9b73d2ef3d55, 0xab55a90ff638caa2, 0xc344d9dda76dd972) }, // 57913
+  { teju_literal4(0xdc28273a621d1706, 0xf3643299b8e59d44, 0xdf13c6af6adf9482, 0x6c0ff6025db2bd23), teju_literal4(0xdc0ae5ff436b4fff, 0x2481a027de464478, 0x17b343dc98fc1012, 0xb39e1819bc1c21a0) }, // 57849
+  { teju_literal4(0x194c9280ca2e39b5, 0x8fe1d137a2070366, 0x6698438999a3881f, 0x09274444c4e9d23d), teju_literal4(0xa727824c2d95c330, 0xa9886f41aeebd111, 0xe24605645e972ec1, 0x2e2e6a2af73b5a12) }, // 57785
+  { teju_literal4(0x45566467e879dd4b, 0xbdb84c06cd829178, 0x4698a9a1002d6016, 0x5fb35771d71f7a19), teju_literal4(0xfdf4bf61d0a85c0f, 0x3151029e037eec6c, 0x47bdcce45ffbbc7c, 0x0f9d27106f5c6789) }, // 57721
+  { teju_literal4(0x6baccc372480e160, 0x223f608f6fb18701, 0x1014a113ada2ddf9, 0x63895b48486c1f44), teju_literal4(0xc0eaa2cbe1b598e0, 0xf995efd4140dc431, 0xc0040de139383d61, 0xafa9d49aed5f4448) }, // 57657
+  { teju_literal4(0xda5344fb00d0771e, 0x8a063604675869bc, 0x2b61936dd9cd05e8, 0x5b3b9a64d86fdc73), teju_literal4(0x928c54eefe02bb0e, 0x1024bfb3c9105316, 0x43eabc0bcc9e38ca, 0x17af698df366ec92) }, // 57593
+  { teju_literal4(0x5d0d4db60d3396e4, 0xe0b12650f960efc0, 0x3f8baea3ed8c2a94, 0x0e2b57651ee2ebc3), teju_literal4(0xdea6381c8e85e709, 0xce435b576798dc0e, 0x10c429fb5b6fd53a, 0x96dd89c9b0b08e19) }, // 57529
+  { teju_literal4(0x178e2ba749ac2b57, 0xd8c281c2dc8264f0, 0x410d870c9868aa4a, 0x86ce3a279b75c2b9), teju_literal4(0xa9226fa66e11e8a5, 0xa4a410c402545197, 0xe13be5628c8f7a39, 0xb19ebcc3c1db90d2) }, // 57465
+  { teju_literal4(0x25d6d9e80c8d3bca, 0x2d670da898749413, 0xb346b580fc83d715, 0xb42431820df7e69a), teju_literal4(0x807b756c84c6a6c4, 0x681719b264bdc31b, 0xead4d8c40386c42b, 0x4f458875f0f3f689) }, // 57401
+  { teju_literal4(0x4f60dd4adf177877, 0x7e56a41c69eb602e, 0x024f16f4a74a21ee, 0x9d4f0e054c675690), teju_literal4(0xc333b11ebc993216, 0x1849e53478a79b67, 0xc59f02016c695595, 0xbf4a83cd1b7dd5ab) }, // 57337
+  { teju_literal4(0x25efd1a1c21f64a6, 0xffe1715426a57389, 0x1ba6938e00191d9b, 0x674f77b158a6b223), teju_literal4(0x9448c45000938dce, 0x8068d0368ee60fc8, 0xc3f156709c0b0012, 0xb7d5dfce11ef6784) }, // 57273
+  { teju_literal4(0xe3669a034f47dc2b, 0xde2e0b2044b2aceb, 0xf715d5833154d65f, 0xed64db33624fdfea), teju_literal4(0xe1497200a5450910, 0x3d4b4ec89e285596, 0x3bb916471230b95f, 0x6992e4a8b82379cc) }, // 57209
+  { teju_literal4(0x41e6a8e60069497b, 0xb6a57fbe81a4c68e, 0x668f47115af15f32, 0x63692a39f8cb63d7), teju_literal4(0xab235e5af16a4530, 0x257bb1ae5f30927c, 0xa0468fbb0ac8dd8c, 0x68f3b6216aedb5df) }, // 57145
+  { teju_literal4(0xbc57c209e738e0c6, 0xb836c4c24fe90e37, 0xfa1741fd2164ddc5, 0x3195bc1578e86b82), teju_literal4(0x82011affe619a986, 0xfee2a94955025378, 0x07106025aa6abd6b, 0xf2eb087b9e1b5155) }, // 57081
+  { teju_literal4(0x5628a3fe0831e8a6, 0xfc53f5eca1f0bdda, 0x77759e3aed444a35, 0x4cf4d325b3fa3908), teju_literal4(0xc583adbc95a317b0, 0x735ad6b21c4e2197, 0xfc95e3d9cf278e58, 0xd90b3b9cf61fdbad) }, // 57017
+  { teju_literal4(0x239bfa3b3b683ca4, 0x66ec85cae64b5b9c, 0x5d59433456d0c1be, 0xc15ed0343ef24059), teju_literal4(0x960a778663c07d8c, 0x7a21dfd653da8fa2, 0xbf6bd06054b07f3d, 0xe8f5b878a8a71810) }, // 56953
+  { teju_literal4(0x0d0377562312516f, 0x4c9b7ca3f2dc1baf, 0x86a1ae63a325a62f, 0x6a249647e0871176), teju_literal4(0xe3f4aba503f43c26, 0xacaebab489625734, 0xd79d337b908961d3, 0x755b04acc8b478ae) }, // 56889
+  { teju_literal4(0xa296d95360837244, 0x96e733798112c478, 0x9291f7a6af97197d, 0x638674ab9fe74329), teju_literal4(0xad2a60a007b07bf8, 0xe641480bdf065c09, 0xb82964ec42758eee, 0x1ed2925921957fce) }, // 56825
+  { teju_literal4(0x30be806d538c8dae, 0x9c3fdcb2c8a30300, 0x77c9436689e1506a, 0x763975edb61b139c), teju_literal4(0x838b5e40c0a9f39a, 0x8c907c539cf1282a, 0xc36590c767e46aac, 0xa0512b2c243e34a2) }, // 56761
+  { teju_literal4(0xa313568c8945666e, 0xc7cb9f276c20a54f, 0x114911a499f9253b, 0x6249d963b97f8fa2), teju_literal4(0xc7daadaa4deab0bc, 0xf6fa2465b92a098d, 0x6ca27d7c463204f9, 0x1eb1539498e2eab2) }, // 56697
+  { teju_literal4(0x630ea3d916ab31dc, 0x68d9f798ad6d7009, 0xcbe287018aaeddc8, 0x4441edf96eecc780), teju_literal4(0x97d17e89b6f873ff, 0x045e0167b98a6a94, 0x67fc7fd58102fe61, 0xf8222eeb0e1939ed) }, // 56633
+  { teju_literal4(0x2329c188fa5c053f, 0x1d7fd3c5e566fe7a, 0xfd13347d67dd5a0f, 0xb9dba57821a3fc71), teju_literal4(0xe6a7fd4bdbf54257, 0x5f79c1738be6d8c8, 0xa50002d7b4122cc5, 0xc6f54fb3f40bf9cf) }, // 56569
+  { teju_literal4(0xd2fe8c308abc897b, 0x38cfb33c3e2141a3, 0xd6e03aec8532db1e, 0x5c865a69b2218705), teju_literal4(0xaf3788e33c4ecef7, 0x2a7875cd6d023d6c, 0x8e36dcd0a1b082fd, 0xfe890c83eefb8b2c) }, // 56505
+  { teju_literal4(0xbf4e727795231904, 0x74409c8c6f8ff4a2, 0xbd51609c02e375fd, 0x083f7b1bca2de9f7), teju_literal4(0x851a4d2ebdb7fc54, 0x0df0ae78e65870be, 0x8933b88e67d3d48b, 0x21a24f59a1149c03) }, // 56441
+  { teju_literal4(0xfb196eef9f0a4f63, 0xba4189c1e1cdad6a, 0x6b1d5826cbeca58d, 0xe7969de7c3636fdc), teju_literal4(0xca38c62c8510614e, 0x7e8be49640de8f70, 0xf0edc889483c76d6, 0xaa1dc13dfee9a983) }, // 56377
+  { teju_literal4(0xc5a61e4a5adc1cf0, 0xef08f2cd25f42ed3, 0x996cd8d064863dae, 0xc36c68b41726e546), teju_literal4(0x999de981f5f74551, 0xde6ac3af243af2fb, 0x858531d6967cce77, 0xeffd689fb80eff0a) }, // 56313
+  { teju_literal4(0x2d7695559ce1b1f9, 0xf0f11c7f795f2ef8, 0xc6ff032727c4717b, 0x21bacfc213ff41c2), teju_literal4(0xe9637f80f03fcf5a, 0x785af080b3690dce, 0x0f84c52d5eb00803, 0xf62697dd33f3fe92) }, // 56249
+  { teju_literal4(0xd96b764414a9e984, 0x9c1d2e9a6b5dc75b, 0x11a12658c7eb226d, 0x7c911a464a425e09), teju_literal4(0xb14ae9c9fd885d76, 0x7255c48951745f68, 0xee5c63658eceecdd, 0x435298123704a199) }, // 56185
+  { teju_literal4(0xc75cdca68bb418ed, 0x0963c1709f8b45aa, 0x0661bdd3a02cc87f, 0xa28209be30bdb688), teju_literal4(0x86adf5f3faa5bd09, 0xe03d0baefc18accf, 0x03c7bf421f8887b0, 0xd41f6a071e28393b) }, // 56121
+  { teju_literal4(0x7b2814888eb99a07, 0x164a667c763a81ae, 0x06710561662b44f8, 0x3c836149988a9e98), teju_literal4(0xcc9e0cc85a8e9697, 0x0db11e7cc3fc63bd, 0x7ce847a891b45dca, 0xaf7e66ee51f48e31) }, // 56057
+  { teju_literal4(0xab709b631ae5009b, 0x5c74d2539bdb878c, 0x6393c60e682b7324, 0x70aab5abec635c8f), teju_literal4(0x9b6fc8c81b9fd0ee, 0xfaa1b95fb9798bab, 0x1a39430bf4bd79b1, 0x7995f977fe8ce1bb) }, // 55993
+  { teju_literal4(0xa6a98e44a57e0689, 0x9877602f055d4e3f, 0x0889b710604c7dfc, 0x175d0f866e8d1369), teju_literal4(0xec274b1a747df2ab, 0xce78a67732e6ae94, 0xfcbf5f2a5f9f99e0, 0xced11e4a21405d53) }, // 55929
+  { teju_literal4(0xeb079a16ee50f497, 0x3ace02450f9865ed, 0x4d16d641125eff34, 0xd73aa1ba95c20328), teju_literal4(0xb364963245f55d11, 0xaf294cd86a7b0cd8, 0x66fd72a9d3bd2100, 0x842d5ceae19e037b) }, // 55865
+  { teju_literal4(0x37d7a196dda3ab79, 0xd35e0bba3ba04527, 0x6a7385b9d9a7d591, 0x7886bd7cd67dd0ae), teju_literal4(0x884666e589b65b33, 0xdd4156afc5523efa, 0x074bbb69871b6330, 0x34ae3943a193805c) }, // 55801
+  { teju_literal4(0x0d559e577d4bc687, 0x4b1a0bd3509515a3, 0x8aa64314b325d768, 0xd560e59bcd2541ba), teju_literal4(0xcf0a9744315517e8, 0xd2e0baa34609e012, 0xec6eb885a7244c9c, 0x88b0d3c00c18567c) }, // 55737
+  { teju_literal4(0xc78ac59915f7993b, 0x096a296bdf9a2cde, 0x4b268569aa2e4e04, 0x0d0c81dc19f617a8), teju_literal4(0x9d472ce6b6937d97, 0x94692f4e52887319, 0x0a0d43acac527740, 0xd8aae0f59c688b11) }, // 55673
+  { teju_literal4(0x43ec33e5e8db27a6, 0x662a0b061ff8b2ab, 0x71c7c3e801d6a250, 0xfe4218e8e354d228), teju_literal4(0xeef37939eecd21f7, 0xe1b87965cc51a54e, 0x699117979ab60438, 0x243c6579580e255c) }, // 55609
+  { teju_literal4(0x8b0fd7a8a2075898, 0xdf41b562d5ba4c5b, 0xc471936c227e6a9e, 0x1ccf043ab585f3ea), teju_literal4(0xb584a133480151ae, 0x5974e598d44e1adb, 0x1b58f86c53dda6ed, 0x56ce45a0fc1ad1f6) }, // 55545
+  { teju_literal4(0x805f85ebfe311df9, 0xb36841c3222dbbfe, 0xfd01088d034d7fd1, 0x812ca3d109f62b1b), teju_literal4(0x89e3ae83f45446f7, 0xbaeda60afc442b14, 0x7d130020a0aba3e6, 0xdb66de4015423129) }, // 55481
+  { teju_literal4(0xf75004ccc40c6b48, 0x82d4df8ac1284830, 0xe1e115aa777ee6a1, 0x12e5c54dc12bdccd), teju_literal4(0xd17e7ba875b58e97, 0xd799646bced424a7, 0x3c8517e18c941627, 0x0933ce39eb508d52) }, // 55417
+  { teju_literal4(0x93eb005d5884369d, 0x97d0e12bc682af11, 0x0b477bbd4ac8dd72, 0x8e263b2f1cc2f015), teju_literal4(0x9f24269a7f8c576d, 0xc432cb04c23701b7, 0x6abd951d82013f93, 0xb96848eccdf040f5) }, // 55353
+  { teju_literal4(0x2beef989a2df64eb, 0x2140b4b62d7dd7fd, 0x81763186e01a2831, 0xdf88bdfe2773ba2b), teju_literal4(0xf1c8234d1c2be7df, 0x472ec2b3c2b3767d, 0x0cd8216ae1626d28, 0xa1e01f7337f951d4) }, // 55289
+  { teju_literal4(0x74577dfa0867254b, 0x67ae5e52819c5ee4, 0xb7f71f5dace733f1, 0x078b8ec7d16af0fa), teju_literal4(0xb7ab1e1e1b715b41, 0xc4668ab8c7a04a50, 0xb1d2b260973b986b, 0x91bd49004142fefb) }, // 55225
+  { teju_literal4(0x56d7c40e73bca670, 0x0b639d5c80154c67, 0x396441cf7bc5b880, 0x97bd51f8dd870594), teju_literal4(0x8b85db7bbee26e42, 0x7534e1f2cb535064, 0x7a3b892b6291228e, 0x4eaba6610f9cf7b4) }, // 55161
+  { teju_literal4(0xcfeb453f9174e99b, 0xb80bdba781004433, 0x682b0e4bd29298c3, 0xafc56987e50d5d2c), teju_literal4(0xd3f9d04065a84bc5, 0x4bc9e95ee69232ce, 0x79bf0679e9bf11df, 0x4e3f7368e27544d3) }, // 55097
+  { teju_literal4(0x11efbf72741652e5, 0xb56f8d5f4ca0d166, 0xa3d0b34fc6e5a8ce, 0x2b1b928517a0deba), teju_literal4(0xa106c6d2f17f268f, 0x7d9af426f88b5606, 0x3f8e1f4193dc592a, 0x884d3b98cf97d225) }, // 55033
+  { teju_literal4(0xeff72bc97546b56d, 0x1c7e91f2eab2554a, 0x614cb4d7311aa95c, 0x8e94d232ba52bf1b), teju_literal4(0xf4a5630ed79c535e, 0xf8899cb477a41a8c, 0x9f06a3f357ab509c, 0x51bf5d6151ff88ce) }, // 54969
+  { teju_literal4(0x44588625c6dc4808, 0x1a49ceea1bf06ce8, 0xf9d53ed91a33eff7, 0x5ca73003ea5f9849), teju_literal4(0xb9d8207e6cf8c2a2, 0x5e32da55c58d5cce, 0x7b439577c71c731f, 0x6cc4bb82301318d1) }, // 54905
+  { teju_literal4(0xb28a42737cec9e3c, 0x4e49b303fa962d11, 0xaff4dddac55e2aa1, 0xb50a64f6e99e58bb), teju_literal4(0x8d2cfca5ee1d3296, 0xa0c463bd41c6017c, 0xa513eb6fdb9c52c2, 0x2e534b537875b55a) }, // 54841
+  { teju_literal4(0x4f697c0bfd01367d, 0x3f6856d3ca354aac, 0xaddd0247c5102539, 0x6a29338fd410cebb), teju_literal4(0xd67cab9adb70686d, 0x4400c51b776a1c4c, 0x653a464fafc89614, 0xf7a33fcfc22c29da) }, // 54777
+  { teju_literal4(0x2583e3a23228486d, 0xce8b9c4e54795251, 0x2cfd470896dcf9f1, 0x43e4b2f5c08bf733), teju_literal4(0xa2ef1eb2e38ae514, 0x7326ab6e3497a32f, 0xedb92e26c2ef48da, 0x51c700d0aa3ec328) }, // 54713
+  { teju_literal4(0x9632878162e566c9, 0xbbaf90957f555c80, 0x1f9b789046f4e489, 0x09efdbee8b9faf4b), teju_literal4(0xf78b528804035cc4, 0xbc0bad5d257e013e, 0x1ba60e3d4f9d924a, 0x002da98e588b045e) }, // 54649
+  { teju_literal4(0x38bf6311c2693920, 0xe692e3db357ace17, 0x599c1703b934de54, 0xed48b3ce49ecdd32), teju_literal4(0xbc0bbc1b2fe20155, 0xe1127bce17fc30f1, 0x78d99b5be6298014, 0xc88961bb248d7479) }, // 54585
+  { teju_literal4(0xd36561d86a411936, 0x3eb1dc3a2f68cffb, 0xe38ceeb36cf96d6e, 0xe78b5c34f8ea4c79), teju_literal4(0x8ed921088e0fdde9, 0x2777a0bdd861bc9e, 0xbdb4a8d2a2ab5cc0, 0xdd0ee2ffed4c612b) }, // 54521
+  { teju_literal4(0xba8c1ad974ac1bca, 0x1cd22287d85e6a64, 0x06789f404a205f1b, 0xc491aab9293d1f99), teju_literal4(0xd907248b1aa671a0, 0x4dfe27ea082b504a, 0xb900f71f517a7afc, 0xe87fa8d344e0ddba) }, // 54457
+  { teju_literal4(0x5673edd736bdb9d0, 0x78f1e49496cd0f69, 0x6947d9de38b746fb, 0x002079e9e757974b), teju_literal4(0xa4dd3f9124bb0ba2, 0x03a1e04f0c31a50a, 0x19a5fd0c5a4baf9f, 0x413a30b804a2ee7f) }, // 54393
+  { teju_literal4(0xf9093259d5cbfba2, 0xddaecd2199af5f8c, 0xbe18cb92369bd0fd, 0x6a71496285b106b6), teju_literal4(0xfa7a0c1078cd8dfa, 0x3da2ec2907ed7dc5, 0xbe4972ae2beb9eda, 0xb332a04664b96a2f) }, // 54329
+  { teju_literal4(0x294c9fad2b04088d, 0x289dbfec52fef2e2, 0x37a805f455d66d63, 0xded13bfd800b8627), teju_literal4(0xbe4604f751d29335, 0x774630d729c2bf66, 0xc8417b34f3185ca8, 0x1ea1eadd7a5c6084) }, // 54265
+  { teju_literal4(0x96989462196f35d2, 0xd26b712fd63cdc20, 0x3cf5e5c4f8c4100c, 0x5b139b4f4bab23e7), teju_literal4(0x908a57d73aa36142, 0x9d6fa79ae009af50, 0x6724ee34fa329352, 0xef0bb32e8d18128b) }, // 54201
+  { teju_literal4(0x88e5373cffafa953, 0xd09dd3bf453cc263, 0x3024bbd9eb6e26dc, 0xb4daf341945a20a0), teju_literal4(0xdb9952299fb0e8a4, 0x316909f03dccb661, 0x3b905607e77ee708, 0x65365da980fceac5) }, // 54137
+  { teju_literal4(0x95ad4c2e91b1b7b8, 0x8ab04361b355696c, 0x3a48c975f8452e88, 0x46de7489131c0b22), teju_literal4(0xa6d13af919a23c5b, 0xabb4d059833202d0, 0x126e54851b6834f6, 0x1267806e833f13c1) }, // 54073
+  { teju_literal4(0xb1a75173e906e698, 0xc71c9c6cab86e865, 0x89ffac870a7cc2e4, 0x0352cf407b503b01), teju_literal4(0xfd71aa4ff1615520, 0x4f0f0969f4880a7c, 0x49514c2f34284e39, 0x1fd207cf94cd230c) }, // 54009
+  { teju_literal4(0x1d67b2a738b2db1d, 0x66ca9a274498f8be, 0x8626c3b2c539b271, 0xb873835b9ac308d2), teju_literal4(0xc0870f5270aff3e2, 0x29597697fe76d878, 0xdd328b702d686699, 0x6481c05a856a271c) }, // 53945
+  { teju_literal4(0x09150030a6641116, 0x3ae0c418521f9fc5, 0x59fdd8560e064b10, 0xa4802ad05b1f333e), teju_literal4(0x9240b073a9cb3663, 0x99f550568178ca37, 0xfdb5475804b36247, 0xb174c1dcbe0ac7d7) }, // 53881
+  { teju_literal4(0x568cd1443e4bd35b, 0x9b45444bf785f23c, 0xd431d3dd460b5348, 0xa34cbf1d5f10df7a), teju_literal4(0xde334bd4f1b1f4cb, 0x50fd5f7fb5d2ab2a, 0xebce86ef2f1ca3b2, 0xfcc9dc9b3144aed9) }, // 53817
+  { teju_literal4(0x42da05f3aa845e90, 0x153ac7b05d97af0d, 0xfa9da6b4188d2ffc, 0xd7f3b9261781f2d7), teju_literal4(0xa8cb22ab5bd2e4bc, 0x11956fdbf54a5919, 0x5db1d39a4e8f0cb5, 0x49cf7be113fb135d) }, // 53753
+  { teju_literal4(0x2253a94813a73203, 0x4a299ed29a3565fb, 0x407171b0b574c1f4, 0x5f02fd149c24f9e1), teju_literal4(0x8039241f7fb3c0f7, 0x80e496969f899bce, 0x30a4106f02e0a698, 0x6d8272c67c1ae33f) }, // 53689
+  { teju_literal4(0x4f7b3dd2c5bb17be, 0x557303d3e5811d28, 0xdc41838ffdaaae1e, 0x00d55ce11ff6c668), teju_literal4(0xc2ceefa992ac3d5f, 0x46c567e381879f97, 0xd28a30bfb741d8bc, 0x65016a5df450caef) }, // 53625
+  { teju_literal4(0xd95f3b0eabdd42e4, 0x1fab24f6ed793744, 0xaea9d1d3311e940e, 0x8ec94c7449d9924a), teju_literal4(0x93fc3a6e37554c5e, 0xcddd80ee12793c15, 0xb9b42d4d86b29bcc, 0x14e496af5862a7c4) }, // 53561
+  { teju_literal4(0xb920dcbc7a67f5e7, 0x5263b4f673a8a4c4, 0xb24a78af24f91a69, 0x3ee42c34866ee943), teju_literal4(0xe0d5293276f1bb29, 0x343e5a3b11a2c503, 0xfd80cc3112f94731, 0x8415771cd0bb5040) }, // 53497
+  { teju_literal4(0xd810362b8371050c, 0x20080873a2bd821f, 0xbdd309a01f56d9e8, 0x4218c8587838aabf), teju_literal4(0xaacb089e5b3b7fdb, 0x393523bf2f95c5b8, 0x9f800dadbb6fb0ed, 0x4669159aea039d23) }, // 53433
+  { teju_literal4(0x1ae862b50b6d57b8, 0x4f6329676700c2b9, 0x5816ffc4e4e17099, 0x6fb1c3400aad24ae), teju_literal4(0x81be0093fff9440b, 0xe8884701f19e30af, 0x528fc57691eeabe5, 0x86bf006d75c15447) }, // 53369
+  { teju_literal4(0x898081011ef20e8f, 0x15b9f019d32f8376, 0x91462f3a95a725f4, 0x3dd67adafce35561), teju_literal4(0xc51dbab7e080f0be, 0x8606c41a85ac7da7, 0x911091f2ed1152e2, 0x6f4d91a86d932e9a) }, // 53305
+  { teju_literal4(0x38a59d21706a726e, 0x2c02246d3aa14ce0, 0x69d9b149dc11ba50, 0xa9531abdf931ae78), teju_literal4(0x95bd05867261f5fc, 0x77b096a558e11381, 0xd338694ebc237d7f, 0x7616807e20abf0d7) }, // 53241
+  { teju_literal4(0xb916c6e8f32057b9, 0x5cbbb69c746bad7c, 0x06af8e1d6dcb5a83, 0xf1fa3d4f378af2a5), teju_literal4(0xe37f022f4bcce6e5, 0x959b81b964af9c42, 0x02c0d2130a169c62, 0x5cfc6673d1a66897) }, // 53177
+  { teju_literal4(0x7adb056bf27542d7, 0x9e1ec290fcb6beed, 0x947d7164e8503142, 0xcb515fb0758969d4), teju_literal4(0xacd0feff016c33d2, 0x5f345eb8075ed4de, 0xac877182d46e22c7, 0xd62145238e05a136) }, // 53113
+  { teju_literal4(0x533b9fdad7286707, 0x2fbfa19785f2cc40, 0x16cc894acd349e50, 0x205a4ff5b9498f48), teju_literal4(0x8347785409c69d7e, 0xe3c0384753dda5d8, 0xace42cbab138814d, 0xea81642ecf5293a0) }, // 53049
+  { teju_literal4(0x519d4976fc1d597a, 0x507a39431d508d6b, 0x8043172ffde2a558, 0x39b3b14b19ad5938), teju_literal4(0xc773857761de859b, 0x0c39efc2071cfff7, 0x958ba3746b6f137d, 0x489bc82dc02c4c0d) }, // 52985
+  { teju_literal4(0x63b8b8678e69afe1, 0x8b9f8336f4074597, 0x63c7c6193bcf5c7a, 0xcb9cfc428b9df16b), teju_literal4(0x978321abac88dfc8, 0xdb95f8879c60bcec, 0x5685a66161476fbd, 0xc4f30512f9426e39) }, // 52921
+  { teju_literal4(0x5454856ddeec1e74, 0x49f8b1c4c18106c2, 0x6d077f1e19f1800a, 0x9440d25d5abadb21), teju_literal4(0xe630ef011c2f03ce, 0xb281da3fc3241cc1, 0x275b5d14ec8ea0cd, 0x5902f383a0d24b3d) }, // 52857
+  { teju_literal4(0x80ef987d333c8a71, 0x77023ab5de28f8a2, 0x9df1b6b7985dcac0, 0xebd38015b1c6f6f5), teju_literal4(0xaedd183156cb964d, 0xfc51fbf67f001249, 0xc5bdcd95287a488c, 0x186b0cfe8d4ca504) }, // 52793
+  { teju_literal4(0x08ba3f637c5c1497, 0xa7f937c624f79881, 0xc30be18ece5c0019, 0x026e0024ff2c5e0c), teju_literal4(0x84d599580c9ce8be, 0xaf835fd9f8ff6dab, 0xfac339a1e5126dc8, 0x76b1c0c342fbeb61) }, // 52729
+  { teju_literal4(0x1c6de5bff958c599, 0x942ba5c7945c8cd7, 0xfa4c0f809ac63013, 0xc11f8d05536192ab), teju_literal4(0xc9d06521bc17712e, 0x1981b41b9ddace87, 0xa550c9b7d69b5c4a, 0xbc65757d29f2d865) }, // 52665
+  { teju_literal4(0xf79a0e872479788c, 0x57d10d978a406dbf, 0x100c40f22bb53081, 0xefb9b986c846bcd3), teju_literal4(0x994e9efd8ab022eb, 0x12d24f22a0a96d6d, 0x63a6923e6cc9de5f, 0x5e315b89f48c924c) }, // 52601
+  { teju_literal4(0x1803cdfe6db4cd07, 0x4f2d2b33187be3bc, 0x1c580c3d35c5a46a, 0xfc9f363c6370c2f6), teju_literal4(0xe8eb0826ffa063f0, 0x59e9ec706b9db00c, 0xda53c48e8b012633, 0xf611c3d5649e5e98) }, // 52537
+  { teju_literal4(0xc6eaaf9aa23e727b, 0xf2a992b7609110b6, 0x0c4c923f62adb5ce, 0x091f63d542a119bc), teju_literal4(0xb0ef66d129c075f3, 0x27e9ccb8e25918a4, 0xd3120a8c9238dc16, 0xd8d67568b109361c) }, // 52473
+  { teju_literal4(0xbdf7e30cdcfd8b38, 0x6b9b344432b243ce, 0x7c781de722d9d295, 0x18847a7e13a87a3d), teju_literal4(0x866871c2d6350d99, 0xddf4051850f592fd, 0x084b3374fbcf6d71, 0x92e69a4396bcf8b3) }, // 52409
+  { teju_literal4(0x5f0335a6907fdc47, 0x08a35544464c1de2, 0x8d1171d9dd1567a9, 0xef1d0cef8b6297b2), teju_literal4(0xcc346f30f30d6a12, 0x7526fee8f6acd7cf, 0x692de97517bb46f0, 0x8da082721a9fbdac) }, // 52345
+  { teju_literal4(0x39e948337e4fbe33, 0xa9d810f3cf4aad98, 0x5ad1b95ec0c956f2, 0x607731fb591a5798), teju_literal4(0x9b1f8dcc979a994b, 0x66f813a058dc8f58, 0x791ef5e484f632f1, 0x84e1ca65123f07dc) }, // 52281
+  { teju_literal4(0xf251521565f38a77, 0x2e6b91a71d94bb04, 0x5b1cee20e1f46301, 0xa1c87e0860c02fd0), teju_literal4(0xebad666a57ef6060, 0x24f5707ee2cd0b0e, 0x4ac041e01532db45, 0x311e6a37751b40f1) }, // 52217
+  { teju_literal4(0x044bffc55247a024, 0xc1199386f864ad9d, 0xb6cb1b9e5ada89ae, 0x28432be569ab8bef), teju_literal4(0xb307fdb2b7d69807, 0x9632068aca10d68c, 0xfa541949661eb7b0, 0x6bf3e826673ab278) }, // 52153
+  { teju_literal4(0x0f27b640020c9c16, 0xae67dd1471af21f4, 0xfa04c00514dcb8f3, 0x6ff3eb06998fc7e0), teju_literal4(0x88000fe212fcf5dd, 0xe33fb42ece921fc6, 0xedcb2b332fd9858e, 0xd4067c9131f88467) }, // 52089
+  { teju_literal4(0x0660e89259ead90e, 0xc6f894e8014f95c2, 0xfbacf39dfc42952e, 0xd523b692501b1e6e), teju_literal4(0xce9fb9602c67c253, 0x9aef3dd0d1c06512, 0xce8d94d172f4f942, 0x245377df4b543bf3) }, // 52025
+  { teju_literal4(0x0e213931c722fb7a, 0x4d9ffeb071984b36, 0x5c471a5d39b6e048, 0x6e1e60068baeb712), teju_literal4(0x9cf5fe9ad832a729, 0x0bd9423573eaa243, 0x7d8baa6d15b29ccb, 0x20aa3984378aa190) }, // 51961
+  { teju_literal4(0x1394df54bc04e0e9, 0xc1f0d0c5ef78c006, 0x7cfdb26651e594c4, 0x3a04393627261607), teju_literal4(0xee7822dfb27cdd21, 0x38f6bd75adbcc4c9, 0x1d83756618e31dec, 0xe0a1f80222bf6602) }, // 51897
+  { teju_literal4(0x94e25cf11626ea72, 0x9c134dfdf4d2d9e9, 0x55eda09479a41d58, 0x667527972556382d), teju_literal4(0xb526efe358e46bcb, 0x67f40097211ba80d, 0x89d5fba518d96559, 0xc97bb23c660f95fa) }, // 51833
+  { teju_literal4(0x4c5b53b7ce56508a, 0xd640d617a24be1c7, 0x9470f335aa9c6e4a, 0x12a955924444e2d2), teju_literal4(0x899c822ed01a6dd8, 0x40a00197e5937ec6, 0xd1e3f150de49c558, 0x1a7ced7528062943) }, // 51769
+  { teju_literal4(0x379682f0afb8b8e3, 0xe7fce551e3d58872, 0xdcae76dbfd560cd6, 0x8ddc0fd2a390b44c), teju_literal4(0xd11259ac7519c62b, 0xd539ced5b3ae7a87, 0x310cf7b587452fff, 0xdc1c18dd894a544a) }, // 51705
+  { teju_literal4(0x7474b1156b969bec, 0x5e895ca1da629561, 0x3896f08cd6a87571, 0x69d391969a99e730), teju_literal4(0x9ed2021c6196be06, 0xf6990146aa3573fb, 0x49336ffb140fcc16, 0x7da9e203e0304ab2) }, // 51641
+  { teju_literal4(0x2f550b15c456166a, 0xc86aef6dc8a3b808, 0x918e1e5cced27af3, 0xcd0662aef5080f8b), teju_literal4(0xf14b56e7ac340ffb, 0xc2298ae23e4c9966, 0xa2f9a974a9082016, 0xf7d0f4bcc16291c0) }, // 51577
+  { teju_literal4(0x6f53c32bbe4ef9ad, 0x1362d67ac8556c3d, 0xd562b618c4fa03a3, 0x91543db187349c77), teju_literal4(0xb74c50aa2c37c72a, 0x911641508e559c30, 0xc2180b8eba49a1a7, 0x72a3f9641fc47986) }, // 51513
+  { teju_literal4(0x6e38d8b2c7617149, 0x131f7fbfc9d438b2, 0x9791594e0c9a61ed, 0xc38ee6f96644bbe5), teju_literal4(0x8b3dd74dfef84d77, 0xe0de8b2990e39cf0, 0xb2a3ba250d6de19f, 0x40b8d825a0904c06) }, // 51449
+  { teju_literal4(0x1288d178fcec4b45, 0xe9c8c34dddf02802, 0x729b1edc8cd09e8c, 0x17c6ad2492c8d609), teju_literal4(0xd38c6655894022d9, 0x99def8cd501a74db, 0x505382d426c1bc19, 0x928bbae4dc7c2306) }, // 51385
+  { teju_literal4(0xf5063c325bd0d0e6, 0xf6ae946421111a6a, 0x5e20bc9844a09f7f, 0xccbe6046c985ff89), teju_literal4(0xa0b3a937f0ececcf, 0x575df302e95c0fe9, 0xf21e3d5a8a6917b0, 0x9c240285ba35fd82) }, // 51321
+  { teju_literal4(0xfd8c6524acd82ab2, 0xfa9dfd29560c313a, 0x39b94197b59b3531, 0x857a6048f6b23847), teju_literal4(0xf4271c2fd835a266, 0xdc65de90c86b9346, 0x1567b91a9ad5bcc7, 0xb9f18e7a5ac6adb6) }, // 51257
+  { teju_literal4(0xc64bd1bb5c7b9236, 0xe4bceeea6b26b340, 0xdca75534a82742dc, 0x5bedcdd4de66b25b), teju_literal4(0xb9783388c7cfd2d9, 0x6700bad5c7fee333, 0x6107c669e7f3c73e, 0x64b646391111f25f) }, // 51193
+  { teju_literal4(0x0a147214a3d6428a, 0x1800ff44faf48d52, 0x5729d3f36016d4ae, 0x373097f897883435), teju_literal4(0x8ce41e10fa6295cc, 0x13d44a7047964263, 0x2b4ea5d336c7c390, 0x797d7242decaad50) }, // 51129
+  { teju_literal4(0x5466f307aeb7e255, 0xcf39e5ceb4776bfe, 0x7e8c70d8c08385fe, 0xbb079915fc3e2007), teju_literal4(0xd60df5de9e5c6e39, 0x699c329cc17094a4, 0xdf0c3dfe06e3a1d2, 0x460bb1600731e0e4) }, // 51065
+  { teju_literal4(0x8efb68411b8a1ac6, 0x6d3b0850ee87269c, 0x0076ddd57a26cd6b, 0x14edf44ef9034d0b), teju_literal4(0xa29b05078502e135, 0x6f3da10f259f2979, 0xd6299619f0b70f10, 0x235448c56ce97918) }, // 51001
+  { teju_literal4(0x4f49b340aa3e397c, 0xec835a932e0d74bd, 0x1ef5089b50baa101, 0xbfb33fa8460fee05), teju_literal4(0xf70b8cb3a93e5f2f, 0xb7addfcb34386ee2, 0x1e8e96dd5734a992, 0x3f26c497b20b0f46) }, // 50937
+  { teju_literal4(0x1fcd817e03ec1e54, 0x2129c15939605a3f, 0xa005545da2d22fd9, 0xed46d55d7f6168a9), teju_literal4(0xbbaaac3be9aa5e95, 0x9732c2b3cbbafdcf, 0xa332a5ed5c015a6f, 0x1056fdb60a2ff782) }, // 50873
+  { teju_literal4(0x4e85f6f00babbfcf, 0xd6fb798172f53636, 0x1a021f98e6fdd107, 0x298d17b43f698b1f), teju_literal4(0x8e8f65760d363cc8, 0xe5278d1e725990e1, 0xbfe9c02ef407d951, 0xb96d637c8c63ead7) }, // 50809
+  { teju_literal4(0xb94ab37a4417dce8, 0x83c5797efee6eeed, 0xb03192264e9cc3ef, 0xd7f869ac78426ca3), teju_literal4(0xd8971f0f2ff5fd56, 0xdc65dc9ee2ef89cb, 0xf45b91782371629e, 0x27e685bb87d2bacd) }, // 50745
+  { teju_literal4(0xba72564a9c4721a9, 0xd0b7a451992fc1fe, 0xe9e2def662d9c542, 0xbcfb9ca54ce121c5), teju_literal4(0xa48826d8f9bfceb6, 0xafe32251f2e975e7, 0x92d50bd1f7e29295, 0x97e47117088bb3bc) }, // 50681
+  { teju_literal4(0xbaae231eca0de716, 0xe8248bb2c7e21fb7, 0xe79754a28bc66966, 0x8eeb0774d2c0ccef), teju_literal4(0xf9f8c2bd5dd1b55f, 0x50c5322e07c87d65, 0xb7671e2bd1a223ff, 0xdbbc7b7e61d252d5) }, // 50617
+  { teju_literal4(0x01b5df6058ce46d5, 0xb74614a117281966, 0xb5a202d975803a7e, 0x66d1550d848720ef), teju_literal4(0xbde3cebc2b2ae923, 0x02cb5934b5992b67, 0x8836a1066f028805, 0xcf924a31c1692dd9) }, // 50553
+  { teju_literal4(0xcc4532a6a9b46ecb, 0xd3f110fffe8dd2bf, 0x5e7951d8cdd96980, 0xdc680bce5a892be7), teju_literal4(0x903fbca8faa96f8d, 0xcece2ed6447a3dca, 0x1ce5b8b7f8f23e0a, 0xd853583dd4cd971c) }, // 50489
+  { teju_literal4(0x89044c154812c34d, 0xe699fe2b57aa7e23, 0x1aa19f5f397a7cff, 0x60099dd8fc8475cc), teju_literal4(0xdb27f8f3cea74dee, 0x33dbf06287e5eb2e, 0xf7d4e8b9c8eafc1e, 0xd39e14a4d036d473) }, // 50425
+  { teju_literal4(0xfa26f34505bf16f2, 0x9f155e5a327e23d9, 0x5a6e75947d30d7d1, 0xbaa5677d659eae58), teju_literal4(0xa67b202ea56dc026, 0xdac844627ac0b77c, 0x551bdae3da85def3, 0x374a5ed98e6cbccd) }, // 50361
+  { teju_literal4(0xf15d84f4ec19a449, 0x312fe122d3f26709, 0xacdf7377607da1d7, 0xcd87c181316c0917), teju_literal4(0xfceed8e6ef307301, 0xf3c8898d35c96cd2, 0x51f03a959297fc0a, 0x82d0b1420b964828) }, // 50297
+  { teju_literal4(0xa26192cc371e056c, 0x416f2f04be79cc77, 0x508563b84e1ce285, 0x4bc5b629f86cb5ab), teju_literal4(0xc023af3eb6a1bab3, 0x70c8437ddb909e82, 0xf822f1dd214c2636, 0xd844e060519bf3d4) }, // 50233
+  { teju_literal4(0xc9cab63eab39748a, 0x94f9245c85f49237, 0xda10e70496320582, 0xc3838d975ef1de6a), teju_literal4(0x91f53303883121ec, 0x83dae088b6fe4411, 0xa7bbf583cfd1a84c, 0x08158c116affd9f9) }, // 50169
+  { teju_literal4(0x40b2b697292f8c52, 0xc0c55dfa7a01cfa8, 0x0d3e5db365b7912a, 0x1e66c5ed8c98fb70), teju_literal4(0xddc09adef19f5ce0, 0x864cca2ecd442f75, 0xa46305b2da055cf7, 0x783a465f17492f58) }, // 50105
+  { teju_literal4(0xa0345160bd3cef05, 0xfd3d49b22705c3b3, 0x85410b4c89c47506, 0xda3c2c4d92cad6c3), teju_literal4(0xa87402bff7dfe96f, 0xc8f54f1dd178dd5e, 0x92bd5bc9d606fcce, 0x8c053b7659111248) }, // 50041
+  { teju_literal4(0x4727e41bba2423f5, 0xf64813d6010608fd, 0x3ec5972e5f7e8e12, 0x139d85c2abb7a89a), teju_literal4(0xffedea1b032433e1, 0xd46f2a2d42c420fb, 0x427318e00429ab8c, 0x54ec965c39038183) }, // 49977
+  { teju_literal4(0x721130b704d76aba, 0x353dc3250d18843f, 0xc805e0cac3f54d69, 0x09e6a82a1693ebcd), teju_literal4(0xc26a6235fef983b9, 0x63e7fd7247b60e44, 0x50ba09398105b99b, 0x3d0dd2571a29409b) }, // 49913
+  { teju_literal4(0xcd6e4a3e1c062c8d, 0xc292348059c2e01a, 0xedec9d3dcc2313b6, 0xe6381a8496353e4b), teju_literal4(0x93afd80e0908d09a, 0x47af63fce8b21297, 0x19bc3fd64290aeca, 0xa9ad1313648c2479) }, // 49849
+  { teju_literal4(0xd8b56f633f4d6ecd, 0x6f843e7e1cce295f, 0x065b0c8ca9da7288, 0x824fc912345c14ad), teju_literal4(0xe0611c69ca9e59e8, 0x206e8ddcd4a5f5d6, 0xbb4774c69dde0edd, 0x1e3832658a2a016a) }, // 49785
+  { teju_literal4(0x9acfb81597078c14, 0xc2c80a9222d7bfd2, 0xe03bda7a9be51d68, 0x3286f61de69bc798), teju_literal4(0xaa72e07a1b7ba01d, 0x3a4412bcf95dc240, 0x934d0466d7cbc4b3, 0x28206b22dda779f7) }, // 49721
+  { teju_literal4(0xdd1b57b4eb7ee756, 0xebdc311d3557beb6, 0x2c77488eb86b098a, 0x8c6847b6f69784a4), teju_literal4(0x817b08caf0540d00, 0x9e31c93a547180ff, 0x407b77f41c386fd0, 0xcf72163a90addafe) }, // 49657
+  { teju_literal4(0x499c147ad9ff84b0, 0xb4153c3db1768162, 0xb1b5f1c575bfe211, 0xe604b0d8ef5a64cb), teju_literal4(0xc4b7fc52799205b2, 0x51fc8deeb5d89fbb, 0xa682d121cc4940c6, 0xb15182dc9520f10b) }, // 49593
+  { teju_literal4(0xabad8d028252e714, 0x9cb16f86d751077f, 0x7557784f78c4e211, 0x6b7209afda568d56), teju_literal4(0x956fbb7feb616a4f, 0x7e356ce45fe42487, 0xb6bb4b14a93e530b, 0xbdbd4d830dd99083) }, // 49529
+  { teju_literal4(0x737d3689a8e56bcd, 0x0077f8221ccec50b, 0xca146d8d6a5c2346, 0x71de340a1c04ba9a), teju_literal4(0xe30995751c753f69, 0xe4eba8896da5c824, 0xb0f9c6322c6c61e3, 0x11bc0971abf0d3fd) }, // 49465
+  { teju_literal4(0x56e71bd6517d57ca, 0x8090407f50127224, 0x80979e5525e58479, 0xd838c94e6cd376ff), teju_literal4(0xac77cb809829b270, 0x1e08e66f4b0c1b9f, 0xe252a3189a1f7b24, 0xc9ac5371573fe0c3) }, // 49401
+  { teju_literal4(0xd823bc1a6dc0b77c, 0x448190bdc7f4f7ce, 0xa662e1354c82920f, 0x0668a5e86d417372), teju_literal4(0x8303b57333bbbfd5, 0x06eb98fc4c590b11, 0x92f35ed68a95b6d8, 0xac93c19297617f1f) }, // 49337
+  { teju_literal4(0x80a81d38ea49e584, 0x235480811b01071f, 0xe72d5f860eba3311, 0x731b9822ab3586d8), teju_literal4(0xc70c92835a4e5f3b, 0xb2c5450f54620cfb, 0x05c8765aec1ccbc2, 0xfd37e35416c7adb0) }, // 49273
+  { teju_literal4(0x35176903bfb09b9f, 0x4a46cbdee222452f, 0x1c3ac6d7e54cb77f, 0x76776d2efe1e991b), teju_literal4(0x9734ed40473c631f, 0x62339fd11a0fcf7a, 0x4057b5df91812a44, 0xd7d8dbd5a50fac83) }, // 49209
+  { teju_literal4(0x5f79e70a16133550, 0x07111e0dc84980e8, 0x2080c627d7dd13a4, 0x34e8e30eebaa4cd3), teju_literal4(0xe5ba1e2a140fec14, 0x041709e3bd0a2120, 0x4e2bc31688bc6521, 0x4dee3517b65f3902) }, // 49145
+  { teju_literal4(0xcc179fb0dcac16c7, 0xb8e09962a2921636, 0x3eb8dec15281dd8c, 0x13789911107fb383), teju_literal4(0xae82d62df835e60b, 0xd28bfae5482cc6f6, 0x6897319183f5346d, 0xfaea0fc0ac44a5c5) }, // 49081
+  { teju_literal4(0x3ece59d0cbd6c883, 0x0460ea7c5512cdbd, 0xbe6f7a51ee91261f, 0x7aedb5fd391a25c6), teju_literal4(0x849108f78545b6a0, 0x45e35b996d742596, 0x2fc63238dd27a973, 0x1a2e47a47ecf34a2) }, // 49017
+  { teju_literal4(0x693334014f8c66c8, 0xfaac6aba69396878, 0x5ab75b1ab7f0125f, 0xa7dfadc93cde8fd6), teju_literal4(0xc96839f751dda8c9, 0x8fd9a580a2bc9770, 0x72f14c3a16dbc4d0, 0x858bab118d8550bd) }, // 48953
+  { teju_literal4(0x5cfb3731dd1f8e3e, 0x0bbefc00b6be7eaf, 0xf304fdc10f01e9d5, 0xd9b047ab6894d5b7), teju_literal4(0x98ff7d666ef80485, 0x9fc48570d4b58735, 0x7138fe933b42ebb5, 0x1ad69b77cafbca9f) }, // 48889
+  { teju_literal4(0x141bd04adf4429f7, 0xea20463e190f8da1, 0x70dfbb13256450e2, 0xa6b04fccd31bbfa5), teju_literal4(0xe872cefb24117313, 0x3314364d5b222183, 0x577ad347cbee6351, 0xfaf52f4f7fa1b9eb) }, // 48825
+  { teju_literal4(0xb2ff50c7d0381dac, 0x541d8ecc40a3f745, 0x38e51e349ba705e2, 0xfdfd2ea435459375), teju_literal4(0xb09413146f2278db, 0x7a83ba182c4aef4f, 0x061c35294778855e, 0x9f9094641ddafe97) }, // 48761
+  { teju_literal4(0x68463a412cd94532, 0x7511c32135dee430, 0xfeaf841c302d0e86, 0x741fe7ba2232b51f), teju_literal4(0x8623117366c7dbd7, 0xb8e35b93ffbaaa1b, 0x5adfa4f23c3422e5, 0x180ff280a218a92d) }, // 48697
+  { teju_literal4(0xdcb5689fcc12474e, 0x2e647b69a6485bd3, 0x16451feda4c9d4c7, 0x023fba92156e68e9), teju_literal4(0xcbcb081d4e44a395, 0x23b7a75cddf7ff59, 0xeca27b3ce479a4cc, 0x1e719511ab319112) }, // 48633
+  { teju_literal4(0x48fec635a06aac4b, 0x9a01d9320a270581, 0xc287e08e2402fba5, 0x4a187525b2403e08), teju_literal4(0x9acf7c3a81921c09, 0x7c91014411b4052e, 0xa0bd216e19c2004a, 0x846fa5c1d64383a9) }, // 48569
+  { teju_literal4(0xa55675893e0081a1, 0x3fd35746cb170132, 0xf822b20a35f6ad22, 0x323b5e73f097a20c), teju_literal4(0xeb33c0a4e30a6f06, 0x6266d4c3b4e481bb, 0xc39169e19761dc4d, 0x340b9b7c43866f45) }, // 48505
+  { teju_literal4(0xddf43b6aa68ad007, 0x4e766e7cc9720ae7, 0x62374b4cd8dc6401, 0x230fbbc9a9ebf19e), teju_literal4(0xb2ab94fe8275908e, 0x5f40aa17e6934e19, 0xdf43611eda80be34, 0x8f782783c666b4b3) }, // 48441
+  { teju_literal4(0x92bedb2f70fbcace, 0xd81fc5d4736c815a, 0x02e0b9216856eeb0, 0x9a879a09e55f0d8f), teju_literal4(0x87b9dd2d22ac639e, 0x2a7785ad422f546b, 0x97ce5cefd3bde925, 0xe674562212343626) }, // 48377
+  { teju_literal4(0xc9139b7bb4237540, 0x1f68566ee3e4067f, 0xd37332856621b3ca, 0x97b9ba34b9239aee), teju_literal4(0xce3512a53daf50d7, 0x63b24569c1c1c54d, 0x37f63bccff77f955, 0x0f36ad2cdf17ac62) }, // 48313
+  { teju_literal4(0xfc9809873b2f6d2e, 0x43daf51c2309b5cb, 0x3ab49aeb840fe212, 0x02b7ba8d922d515f), teju_literal4(0x9ca4fa35fea639e6, 0xc988c2f116ff5adb, 0x62cfef21f68b775a, 0x26648751720b78bb) }, // 48249
+  { teju_literal4(0x8d03a180731e301c, 0xf96333be16bba1ba, 0x362e258c7ff032f4, 0x089fc17b53275426), teju_literal4(0xedfd0c2eec513b7e, 0xaca21552c74bb837, 0x9f20c75762fc82ac, 0xe2fddbccf5d8873d) }, // 48185
+  { teju_literal4(0x3140ccb2a6963cf1, 0x834d71868b675627, 0x685f739e3996b5dd, 0x51ccc3eaf8a64686), teju_literal4(0xb4c96eefb4869701, 0x04d2e0eccac23f0e, 0x0dd7fd21b365de7a, 0xc3efe9b81d4095c2) }, // 48121
+  { teju_literal4(0x5c5cc184ce43dec5, 0x9351654f4cdb9aa1, 0x1066e1834f0a4580, 0xe2c0b3a43047cf46), teju_literal4(0x89557a964db190ef, 0x01e06a15dfcff4c5, 0x2d7eadd98dfe1b02, 0xc2b5b88749f653da) }, // 48057
+  { teju_literal4(0x40abcf7d0e240c59, 0x735c05e9606f5850, 0xfc51e6fa00351d8c, 0x774d167c99b5e2df), teju_literal4(0xd0a66f80d3915c1e, 0xc1882eff09b2f25d, 0x73c1413f25191a9e, 0x32271780f4d96026) }, // 47993
+  { teju_literal4(0xe8e945441e1076bc, 0x105fecb310502602, 0x349bec28d373f2a6, 0xf08d1e3351f54b6a), teju_literal4(0x9e8008045c2cc0ec, 0x9fe31c36130ddbfe, 0xf424123d887a763f, 0xca67ea272c7bd3f0) }, // 47929
+  { teju_literal4(0x38543009388565cb, 0x7b53ae5b363f7cc1, 0x6431ccce79adba4e, 0x0b13aca9e1c5a42e), teju_literal4(0xf0cecaecc38410c6, 0xa5c3b4b5562bf31c, 0x198e2f8f3ebd982d, 0xa9ee770fc66f12bf) }, // 47865
+  { teju_literal4(0x6b3706f60782559a, 0x36d93d978aebf463, 0x47203a963bfde693, 0x2fcbe00098a5e470), teju_literal4(0xb6edb42531519415, 0xbe68629631a5d497, 0x728a537ea863960d, 0x86a64c84af1bd6dc) }, // 47801
+  { teju_literal4(0x253a271aa111829a, 0x47555e6d13fd7460, 0x2a85377f4580f154, 0x080ea9f39c11f2c1), teju_literal4(0x8af5f84c4a32f7e6, 0x0de0daa413e6cff9, 0xb017c0711273bbc0, 0x3561530cb9795253) }, // 47737
+  { teju_literal4(0x9e6d3399e1c99096, 0x249487849c584d46, 0x0bdfeaaf88167fed, 0x2e001f04574e679b), teju_literal4(0xd31f34e4501c5889, 0xc247aa4636fe7e87, 0xc8d747a0d12a1467, 0x6e28212dfa59848c) }, // 47673
+  { teju_literal4(0x8c9661902f96e710, 0x91ed25457ae0367d, 0x6d057577b078b522, 0x41d0b099b5dd235c), teju_literal4(0xa060b6839e0018b1, 0x74608cbfcd02faa9, 0x5be310fba2bb699c, 0xaae30a168c850907) }, // 47609
+  { teju_literal4(0x97e09a68616fcf60, 0x2a06e2e49835f452, 0xc02c6e29eb726c6d, 0xe18acbbcf3a8934d), teju_literal4(0xf3a9167ebabd15e2, 0x3425c8fe5af6c8ad, 0x8bd724622c185e02, 0x6e7a651d625d905a) }, // 47545
+  { teju_literal4(0x733970834d29ef99, 0x686222e2b8583239, 0xe6f83e57d5b1cd36, 0x38e87c7d62e67f11), teju_literal4(0xb91878167d56a7e3, 0xd9b1c4c2ddce6c97, 0x89e0a893b18449ef, 0x51657482bcc8df11) }, // 47481
+  { teju_literal4(0xb9150e72a07820b8, 0xadfc86d52b3a5de4, 0xb387b26bc36207cc, 0xc93fb57eceafe730), teju_literal4(0x8c9b6518cd00e678, 0x260087260f555e4f, 0xb8b3623b52bf6459, 0x9b830e848a410c0a) }, // 47417
+  { teju_literal4(0x78e88bd5384e33f3, 0x0e5cb2ed9e6f39bc, 0x10f9fa1f9156f29d, 0xb51e22e80375741c), teju_literal4(0xd59f79474a12e5e9, 0xf781cc13ee357f24, 0xfb55de64a6330523, 0xf8497c84396c91d5) }, // 47353
+  { teju_literal4(0xa8f23904b898446b, 0x2e17c692ef2e24f3, 0xa70529b3090d3992, 0x6725019d46ca8f58), teju_literal4(0xa24716c4ef2d635b, 0xe8ea3ce4b328a463, 0xd6034766a1fedbf1, 0xd07965ff216760f5) }, // 47289
+  { teju_literal4(0xcbd36ee0a0ba99cc, 0x618900b5ac951999, 0xa7346bde1823f4ac, 0xcc3dfdacab0ebb73), teju_literal4(0xf68c08d2db809537, 0x88eeceebe3e6c945, 0xb50905f2239b0fab, 0x0d2269a7b56a9b3b) }, // 47225
+  { teju_literal4(0x3fd2b61af16fd5fc, 0xd3db6305484b187b, 0x963d78bc485b2959, 0xb0fdbeebc45366a3), teju_literal4(0xbb49ce76268bdac0, 0x876b3e91d0cd087a, 0x06a37e6b88beec39, 0x7f5c6e19602d38ee) }, // 47161
+  { teju_literal4(0x8b93f14b6b03876d, 0x89ce8dc766bc4e3c, 0x08ab0d97ea7906fd, 0x515cddc323b41bc7), teju_literal4(0x8e45cff263caab13, 0xdce6a754ab78be72, 0x56c0f00a51fdac24, 0x4e728ac34a05f17f) }, // 47097
+  { teju_literal4(0xd51eeb1f2018089e, 0x8cb269a10d607e52, 0x8594b3ce4457dbca, 0xef1de6e8a3d9ac6b), teju_literal4(0xd82753657affe84d, 0x369c1116ea3c9f71, 0x2ce93354b3e33295, 0xee098ddb3b59310a) }, // 47033
+  { teju_literal4(0x4150c42aa5e48ec8, 0xc9e91fa46afdd4f1, 0x379304d939d09630, 0xe93058b1e500e426), teju_literal4(0xa4333a0d3d162890, 0x8858dbdb63585dee, 0x36ee6ecc0b677fd5, 0x0a35d45cfd328b72) }, // 46969
+  { teju_literal4(0x1b056c754e939ef8, 0x29344249fe3bf50b, 0xeba905d14f31d9bd, 0x7052c8d46048f112), teju_literal4(0xf977bc25d26d991b, 0x862ce95b70f9000c, 0xf19e52cae686df82, 0x3b82c989e2bb5db0) }, // 46905
+  { teju_literal4(0xbdf5ac23c39437cf, 0x156f1de485237c36, 0xbaf9737de4cfdab7, 0x5cacd204c683b7c6), teju_literal4(0xbd81cb3277678b79, 0x2662e92be946c4cb, 0x5c9093f8f20f33d2, 0x4e2c325384584be3) }, // 46841
+  { teju_literal4(0xc0e12605ba4a5dda, 0xb067eadcd9c4ebb4, 0x0e1cd441ab16b25e, 0xb9a8f68e848d4aa2), teju_literal4(0x8ff547fcfd207eef, 0x5cc2fe545a134e74, 0x33b667b752ab8095, 0xb115f7822ff38e64) }, // 46777
+  { teju_literal4(0x64dbe65b62c5fae7, 0x7f6ead9ce0c23975, 0x20c68fac59030378, 0x9b773bc9d139f1f9), teju_literal4(0xdab6da3f8dd91226, 0x5b851a88ea252229, 0x96d335baeb8d1a56, 0x6f42a27ec3f1b11d) }, // 46713
+  { teju_literal4(0x287f33f5626f660d, 0xa4442a49cc0a7c55, 0xdcbae76b1a687ace, 0x66a97f3eea7d4345), teju_literal4(0xa62531d5d4687796, 0xd6acb45a6f4fe416, 0xb9b57a2f23fcaa22, 0x238e09eadabf1730) }, // 46649
+  { teju_literal4(0x11b64f993d91d079, 0xafb87cba219f2aa1, 0x8aeeb03f1e96085b, 0x6e7160a4fe8ba759), teju_literal4(0xfc6c4b03ddb94e90, 0xc5a782149e2f9f47, 0x342ef81df3134bed, 0xa912cff6d22ef645) }, // 46585
+  { teju_literal4(0xfb4ceb281e658ab2, 0x2668877986719113, 0x45b5b765c24f577b, 0x340d7ccca1353721), teju_literal4(0xbfc082762c09d724, 0x30a170b8f2c42ac6, 0xf98d3223bd7c717c, 0x799395c44da980ee) }, // 46521
+  { teju_literal4(0xc7221ae6a8345e81, 0xd85e47d53844b1e4, 0xfd663afedb236656, 0x8223361e5d1e76f3), teju_literal4(0x91a9dc8a7211e841, 0xc65df4212a1ca4a2, 0x57d3e3ad335b6133, 0x98549034888e6c05) }, // 46457
+  { teju_literal4(0xad563348f7090403, 0xcb2368b061c6d365, 0x39bf4d52ac46151c, 0x7c8f60f1d06e926d), teju_literal4(0xdd4e251bf014174c, 0x3db8e6bc297ef7bf, 0xef2548c37413ce47, 0xd37022282e25bd53) }, // 46393
+  { teju_literal4(0x95b002b310c2f707, 0x7e517c704c62899c, 0x1491f23dcd65823d, 0x4814a39b9b3ebf15), teju_literal4(0xa81d0fccfff3137c, 0x6f63d9ff8ec66b37, 0x70940484800e458c, 0x7ca8a4c23aa01c4c) }, // 46329
+  { teju_literal4(0x10ba0439fbca4960, 0x3c9896d02911329d, 0x7e2d549bb6433b12, 0xbe265906697cc4a5), teju_literal4(0xff69d049be7da5e9, 0x68e45ed56148c1ab, 0x7e4919b53740e906, 0x9fd295fe2e25c2ab) }, // 46265
+  { teju_literal4(0x075b4bc7df3b642c, 0x134b9ce84bb0f0b5, 0xdd671394b405c52c, 0xafdcd512a6059dbc), teju_literal4(0xc20608a9298b6935, 0x6ce7e4e0c615ccac, 0x634e43b1268b31e6, 0xa11fd140e2696e3b) }, // 46201
+  { teju_literal4(0x3de5ea07fe6a2bc1, 0x36b127765b4cb65c, 0x6a791c03eeb00a0f, 0x96a75b845f1a99a0), teju_literal4(0x93639d1b116d774b, 0x8fe919bee0952eb6, 0xbce9166c34174538, 0xe51ae9122a9b923c) }, // 46137
+  { teju_literal4(0xdc77f4e38cd1a92f, 0x98dbe89c0ae0c1af, 0xdcb48beecc52d3b6, 0xfc70a9af680a4618), teju_literal4(0xdfed4b87a535f545, 0x883a73d5c9ba1186, 0x8faf0e14560d5ce6, 0x555cc86395040cf7) }, // 46073
+  { teju_literal4(0xe387b50d922b1b3c, 0xb83470b5435f0295, 0xbda500d29ff2304b, 0xe61562234eda5600), teju_literal4(0xaa1ae5d6a95b4ce3, 0xe3b6b42b1e4f2684, 0x045b330d4d2efd9f, 0x06008c081b204853) }, // 46009
+  { teju_literal4(0x2627c521d29fa5d7, 0xa7082f8c796fe2ed, 0xaabde4a5c656fa8b, 0xb990336c21303f26), teju_literal4(0x81383392d671e154, 0xe3c886e71c4faf8b, 0x66ea97e4000284f1, 0x9377d26293ce52d6) }, // 45945
+  { teju_literal4(0xeb511794fc4fe10c, 0xf8032e0966ab9f23, 0x810bfb645ca3864c, 0x2405149fb2f20ca7), teju_literal4(0xc452727137783603, 0xe0c00c10e9165516, 0xe0c3d8e8dc4aa8bd, 0x19698f5c2a851bbc) }, // 45881
+  { teju_literal4(0x0564e04666be64b5, 0xcb43a4c71104072c, 0x73e194434409ae42, 0x1ae7f0d66601fc34), teju_literal4(0x9522995e2ca6cfe2, 0xef261b651777d052, 0xf34eddbc92ff77a5, 0x461786c02530b6d3) }, // 45817
+  { teju_literal4(0xd28a9851bd1129cd, 0x5f031620b81fd4c4, 0xfb1fe7c2b70c6c01, 0xcf5c2e6cb414ce58), teju_literal4(0xe29465571ce3d3db, 0xa93299d3ede02dd3, 0x60ed0e11ebb8e6a3, 0x7bfd4ca6480b63e0) }, // 45753
+  { teju_literal4(0x6caedbfbebe715f2, 0x64da87cf08e2be34, 0xe48d5be492cb9df2, 0xad0031a6994677b7), teju_literal4(0xac1ec60cfbba3e47, 0x44f8f972b7e12040, 0x338140c847766bdd, 0xe00fee4fd2da2a68) }, // 45689
+  { teju_literal4(0x5413fad699ac59cd, 0x687e2250cbb5fa52, 0xeeda2dc9c91e9d3b, 0xab433248c99c447f), teju_literal4(0x82c0158c27997302, 0xef7092b2691fe59c, 0xaff9730707780875, 0xceb9e4a606a1cd74) }, // 45625
+  { teju_literal4(0x57a3fa7968d59dc2, 0x0004ab4508af29af, 0x6c8a535c909fde91, 0x9683a0f636fcc38e), teju_literal4(0xc6a5d4b2bb7cb5ad, 0x023453e12391bb69, 0xe57ce1111ede761a, 0x0b7100a3de8da287) }, // 45561
+  { teju_literal4(0x5e809336fd377ff1, 0x904379fd7286508f, 0x0ea9cda536ff5b1d, 0x33c55354c05bbb15), teju_literal4(0x96e6e132a6680037, 0xd9a489bc2d5c4c17, 0x89648efdb4b098d8, 0xcfa80c1611916774) }, // 45497
+  { teju_literal4(0xcc9820db9e81e11a, 0x66fef8da8e9749dd, 0x565137120ce3d0d6, 0x997ec3276c9a6912), teju_literal4(0xe5438aa70b7d17b6, 0xd8e1b108a05e90d6, 0xc82d4c0b9f747417, 0x13e8f52af3e27786) }, // 45433
+  { teju_literal4(0xe6ecc385c7348541, 0x1a1af3eca065685d, 0xb5f1c463d11e1094, 0x0ddb0a84dbfc5efd), teju_literal4(0xae28c2c1082730c4, 0x5fa16eac67643605, 0xeb153294068e9fee, 0x2ca1e46ece978d86) }, // 45369
+  { teju_literal4(0xc2b3d0133f17021f, 0x50f16ae759283a33, 0xff1191dade3ef258, 0x1898eeb13761711b), teju_literal4(0x844c9bfad9e64cce, 0xff55776e91dd6051, 0x9956aa4db0c8dd01, 0xb4d6f0b91c470a95) }, // 45305
+  { teju_literal4(0xe26f3c52d91525fe, 0xf7c5772109215ec6, 0x7ab0dd58e7016c02, 0x1496b53f2e2f8828), teju_literal4(0xc9004491774c4939, 0x8752acfdb544f6b4, 0xbc8b94cc909ab42c, 0x8505f82484417110) }, // 45241
+  { teju_literal4(0x3bf9da6f37ace535, 0x0cbbd410d662d2a5, 0x3caf2fea6a03de9f, 0xda44c0e721553747), teju_literal4(0x98b084a782d334af, 0x1df91e48e3ed93bf, 0x35030f868621e127, 0x589855b698adc982) }, // 45177
+  { teju_literal4(0x8db1e89c706d8ed5, 0x9879c1ae763fedfb, 0xfa8eede227c72b41, 0x77291d00aed87cd5), teju_literal4(0xe7fad3dd454657d2, 0x18938741b7c7d31b, 0xdd0098835c879160, 0xc448754ff46cffc5) }, // 45113
+  { teju_literal4(0x0b6e8a627db4cebb, 0x513786eaf4cff81f, 0x9d70343818f32032, 0xdd57e0e3ce34926e), teju_literal4(0xb038ee7b6c35010b, 0x3ed8e4147ca97b0a, 0xe74365213d1e11c2, 0x5ca69e63af4d52ca) }, // 45049
+  { teju_literal4(0x9d33f727a9767726, 0x1ba6f186daad551e, 0x852b3a2d9f05070b, 0xb6fc7a32a7def57d), teju_literal4(0x85ddd4f3270f7d5c, 0xc38c576a0b8a6f1e, 0xf35e102359699b3e, 0x4fae0576f29a832b) }, // 44985
+  { teju_literal4(0x2b67aa34a32d4e72, 0x61494110873af043, 0x6b9a5b571ed14ffa, 0x47710844ce00eed3), teju_literal4(0xcb61d77148c7881d, 0xa26be598fb9aa5f6, 0x34e578defd3071e0, 0x11f64c52217efd0b) }, // 44921
+  { teju_literal4(0x1b3faa9896c0078d, 0xf0edfce3e74650b7, 0x6d8ee3632bda50f9, 0x1a8116736b532704), teju_literal4(0x9a7f93fc7979e80e, 0x13d29fea09391a02, 0xec21401dd1661988, 0x38ffd25a69bf0090) }, // 44857
+  { teju_literal4(0xfb660e2c77f627cf, 0x0055a6c6ef24c251, 0x59e5668c630e718b, 0xf2c3bf5d676ff6ae), teju_literal4(0xeaba59a99c2cfde8, 0xd2cf6933a904ecad, 0x5cb7e73d03efd74b, 0x10f81bfc4a966f16) }, // 44793
+  { teju_literal4(0x4bf63b5c9b1abe9b, 0x8c3ec4c6b4de6114, 0x7ece5e9f677f3e4c, 0x8d3545b40a888041), teju_literal4(0xb24f5bfcfa686dbf, 0x3e11771ee53d2569, 0xf7d187a2fdb94e79, 0xefcd1dde1ead989f) }, // 44729
+  { teju_literal4(0x75dab84399fdb97c, 0xf058b2a1dbcb7ce1, 0x35078b0517c1a685, 0x279ef8a9ef08b25e), teju_literal4(0x8773ceb3fb4b1094, 0xc6b9c9bbb4ef5fd3, 0x2da0cbfcee6e756f, 0x185b415c4cd6431b) }, // 44665
+  { teju_literal4(0x26b668e8a8f55e2d, 0x0dcc8abc75342b8e, 0xc7f82474ab59218e, 0xa776b4e91c873389), teju_literal4(0xcdcaa2f6ec6948a1, 0x343f8a20b0598141, 0xfe9a7fd05a30b93e, 0xe8ee6aa042c12663) }, // 44601
+  { teju_literal4(0xed47104359191b51, 0xf317dc6db5236dab, 0x915bf2072b9100e0, 0x866160fb0accdc13), teju_literal4(0x9c541fa2890ebeb8, 0xea3afbbb016630d8, 0x5a3a4bc685338ca0, 0xc649f80424650f44) }, // 44537
+  { teju_literal4(0x25512bc68baf0cd0, 0x0b060528925e357d, 0x2aae31c69ebaee39, 0xa1b18df994ba619b), teju_literal4(0xed823506c02b7199, 0x4a10369bfca3688a, 0x25a29715d028a22e, 0x4018b73c4c88b467) }, // 44473
+  { teju_literal4(0x741e8c34d26da15c, 0xf2b58e2e74b8a48d, 0x197146f5f9a3aa39, 0x4bba00dc97135d91), teju_literal4(0xb46c1e3f64ad4a88, 0x57153a6ea011152f, 0x40402a07ba0d2d5f, 0x86fea67492c94deb) }, // 44409
+  { teju_literal4(0xe28a1179fb9f15cc, 0x96f7b6ca8b1d8e01, 0xc7d6e27d385d66b5, 0x4f81b23fec88229b), teju_literal4(0x890e97a776cadc1c, 0xf2453686a397278f, 0x36b254f3522e0e55, 0xd2cc1a3511875212) }, // 44345
+  { teju_literal4(0x4b8b9b7b4bb1bfd2, 0xd66031a31fd57871, 0x22be67d5a22fae92, 0x7427397abc138464), teju_literal4(0xd03abd08c2014a6d, 0x3ad029eb54174ea8, 0x48257d5e8d14b1a0, 0x1d4d6825cc3264ca) }, // 44281
+  { teju_literal4(0xdc58c1c262ed5fd3, 0x1d93ff299e9b482d, 0x3c4b91db1cd17f0f, 0x893b0fc79b9356a7), teju_literal4(0x9e2e383c8cd74b7d, 0x40575a6763dc27aa, 0x735ab3435a8b19f3, 0xb12c3c637bf5672a) }, // 44217
+  { teju_literal4(0x2798b0cbb9f9c88b, 0x5878ffdcd16ca4c0, 0xa66925bd23670cfa, 0x87838c50ee144364), teju_literal4(0xf0527f3b2255c5d8, 0x196d1a020783a1bd, 0x114c0cee6c220de1, 0xadf64e673d6f74e3) }, // 44153
+  { teju_literal4(0x6c9e328e3a102dbd, 0x1983252b76cf3840, 0xa4ed9e8396e5fd2f, 0x7269418131bf4ea5), teju_literal4(0xb68f4875e8d0a536, 0x222a9eadaf973907, 0x630e09d85a8a4ffb, 0x7ae21609a604c4a5) }, // 44089
+  { teju_literal4(0xd9666f635373b83e, 0xca0359a376041be7, 0x2d8fa300aafb3f73, 0x7253535ac4ad360b), teju_literal4(0x8aae3e6370c1fdd3, 0x2289e5a724a97da7, 0xe2c2c2ce366b5018, 0x18bad918d1cde5f6) }, // 44025
+  { teju_literal4(0x2fedc6e9d3e03aaf, 0xdaf0c65cdf75205e, 0xe11620f2883bd6bb, 0x179575134a365dd1), teju_literal4(0xd2b23bcf93c37f6b, 0x4085f0e0ae0bda7f, 0xbb5d48ee7ba0d12b, 0xf2d152bd13bfe63b) }, // 43961
+  { teju_literal4(0xcf0e467bbe443281, 0x043aaa60210360cb, 0x36db1445466c497c, 0xbedfe8248270ec72), teju_literal4(0xa00dee9fd3e30c4a, 0x0474f7acc92893f5, 0x7ebbc16a06cfa73a, 0xbdd8b46b70873493) }, // 43897
+  { teju_literal4(0x9feab94cd50edf6c, 0x1083f1c773d97bf3, 0x8270d307818ff00a, 0x138f24afbb5e3880), teju_literal4(0xf32b51d9da96f87a, 0x8bcf9fbe3ad85dfb, 0x550ae40f578e72c6, 0x3a604470b19841b3) }, // 43833
+  { teju_literal4(0x6acb0836b24e4550, 0xe4bbd39216902550, 0x32649a758787dfec, 0xf61e21fb47f1b01a), teju_literal4(0xb8b8ee0dff05fcb0, 0xc83f0c671cee50d9, 0x58fd305df30d3708, 0xa38f08a1692bc282) }, // 43769
+  { teju_literal4(0x90eb17c7b6fb2228, 0xb1ea5f88ecc67ece, 0x817831b443530385, 0xe38f6b889c0d2a7f), teju_literal4(0x8c52d1a9fbf7b336, 0x1354e4777638745e, 0x6f16f66141bddcee, 0xd0748c7433800e6a) }, // 43705
+  { teju_literal4(0x1a7a4272cfe0d822, 0xee0d34a52576383a, 0xd46a6dd3341790b1, 0x34c12d95fe40a63c), teju_literal4(0xd53135b75fb30452, 0x89d90c43683ddcb2, 0x4d62acb9b8ca37f4, 0x83edd21cf1390766) }, // 43641
+  { teju_literal4(0x89ae0c87618aa5d9, 0x6f6db63923e2ebf6, 0x53f57ca85888c142, 0x74c478be5c9c6618), teju_literal4(0xa1f353d4ba0cfd4d, 0x1fb091bb37426157, 0x51a9c8afb1aa75f8, 0xaf0dcc220b682642) }, // 43577
+  { teju_literal4(0xf9c3eef8e13c2113, 0xedb7b7b5cec21bc7, 0x165acfe043958656, 0xc8083545903485a2), teju_literal4(0xf60cc6c39026ec10, 0x563ed94d1b12d075, 0xe6c9194d2718113f, 0x118179ddfbce4496) }, // 43513
+  { teju_literal4(0xc28b4c566ca81ae2, 0x944dee5ce2b8d4b6, 0x7214048911f73fc8, 0xbf453cb32127863f), teju_literal4(0xbae922b00a7dbc06, 0x9b52d76ca78ca924, 0x6e66df2f258c568a, 0x10c800b66a774da7) }, // 43449
+  { teju_literal4(0x1c0ffaf37fbdf5b9, 0x98161bf67091c987, 0xecf788c95538d597, 0x978fb84a48807a2a), teju_literal4(0x8dfc6069ecec3ec4, 0xa00b24872d043446, 0x9f9238e06bdb753b, 0x477178ae78f7efe2) }, // 43385
+  { teju_literal4(0x1e7652e1e9c5d2e7, 0xcac472f97f68c4bb, 0x3260437e51e441ec, 0xcc2e4a9067ca21e5), teju_literal4(0xd7b7c170236fefad, 0xf886964da739c537, 0x5c3d1af9c5093138, 0x08318a0faf2363a6) }, // 43321
+  { teju_literal4(0x8d557c47862ce9f7, 0x33f10c8f47ddf6ff, 0x02ea8a9d766656f2, 0xe560b08d44e72b86), teju_literal4(0xa3de791742cd3137, 0xcc501533ea74bc8c, 0x646a40eda516435e, 0x3f4a10a238e5cd3c) }, // 43257
+  { teju_literal4(0x818571ba1555ec36, 0x58ad495a755d9477, 0x65131476166613c5, 0x598bb28c60abd68b), teju_literal4(0xf8f6f82764c15d02, 0x2ea25407bc52dfa8, 0xa16328b0be40becb, 0xe2b151d572e94dfc) }, // 43193
+  { teju_literal4(0x685e7b1208314b78, 0x3424b0c00155a642, 0xf42c5e1dd444e9c7, 0x5939a1a3a8a71e7e), teju_literal4(0xbd1ffa400c133eaf, 0xd074cc100ee4dbfe, 0xb9c85f70f699a900, 0xdf76ff3b6c967721) }, // 43129
+  { teju_literal4(0x1228ab08238cb75c, 0xda93954355ccedd7, 0x77f04e4dadd97c3c, 0x2bea1ae04032c593), teju_literal4(0x8faaf9bf61949ea1, 0xcf08fac6e4f25fdc, 0x50a2a1b3c60901dc, 0x63e6f3f194cb06a4) }, // 43065
+  { teju_literal4(0x46c9f84ad813503a, 0xb8cfb6d1c2777050, 0x00ad1d17d4000be7, 0xe42a97acc4fd6f3e), teju_literal4(0xda45f5eeaa6f33d5, 0xd526091bd35783c1, 0xc277db1b10aa6163, 0xe0fa39ae281b950f) }, // 43001
+  { teju_literal4(0xf64bb44e44e37aa3, 0x63d0a0933e30d9f9, 0x1448d8aa9ffbe987, 0x84fb658d6f598bfa), teju_literal4(0xa5cf6fd7b5dfede4, 0x2df9fb9c3f38a6da, 0xc2568c12b24a215e, 0x63b7b09911033017) }, // 42937
+  { teju_literal4(0xc7070a4b713eb3ad, 0xbab08ba222cff885, 0x04bd27ce042ef070, 0x001e897aa73d1d1d), teju_literal4(0xfbea0083e2a62bf2, 0xab0637009ba355e2, 0xb2ed44e57b20f351, 0x41a2ead22202e3a1) }, // 42873
+  { teju_literal4(0x8c5806e0b7b79574, 0xe66d6d3837963e90, 0xddb0e328b25c6e6c, 0x9c6d57ca13787239), teju_literal4(0xbf5d88de5718b625, 0x9b46bdc86a41a118, 0xa589e05328eda16a, 0x943cf8ec9662fadd) }, // 42809
+  { teju_literal4(0x6c7e46db86a2a8c6, 0x932b4a074e097c2a, 0x1d1bc999468e5f75, 0x9b72d9b0871aa173), teju_literal4(0x915eacf44ab1e63d, 0xe6ecfe934a3bcfa2, 0x812e4983da35abc1, 0x1a1566f1dbc6bd83) }, // 42745
+  { teju_literal4(0xd85ad3223461949c, 0x5fb7073b82712125, 0x9f983dd6b63ef759, 0xc5efdbf8286c61c4), teju_literal4(0xdcdbea6d5ea3e64a, 0xaff59764a060bc52, 0xed3937197515e3e2, 0x440096afba4bfc42) }, // 42681
+  { teju_literal4(0x0419e5da835f577f, 0xfbb67cdbaf881512, 0x8efffd4b19793f97, 0xd3fbca05c19e2e3e), teju_literal4(0xa7c649bb3dc7dd42, 0x7314bf75625065cf, 0x13dc97578ac91dd1, 0xf4cd79c569d28137) }, // 42617
+  { teju_literal4(0x7ed4c5c86bb2b30d, 0x2c877b3b3e43a3e3, 0x930d16e55702bb9b, 0x688ee8f8f91d576b), teju_literal4(0xfee5faa7ed6b70b2, 0xb1611062f1f1a84b, 0x1c9b992d7b196354, 0x3715eb327f8fef92) }, // 42553
+  { teju_literal4(0x6a4f9de33c3874fb, 0xf1863b0dcd5f272d, 0x9f841407694b51bc, 0xfa2096ca3d2c66d5), teju_literal4(0xc1a1e2e848475c27, 0x5a1d6a791cd08e8c, 0xd812b0fc431475e6, 0x77744eef46ecdd8d) }, // 42489
+  { teju_literal4(0x4b78d6cb1f98a654, 0x6b315878f9e39ea7, 0xa010150298479f6f, 0x67d39a03f5a2b1d5), teju_literal4(0x93178980f6c91b62, 0x61d73e7887fab930, 0x692d7eac6d016212, 0x1e8e4847302f741e) }, // 42425
+  { teju_literal4(0x22b34a48e0d49324, 0x70395efa417ff019, 0x4f68fccffe833c42, 0x227cd55f633cc8ef), teju_literal4(0xdf79b66d1ba15513, 0x175a35c2fe2beeb8, 0x5f2d79ccdfdcc503, 0xc14b55db2a1de050) }, // 42361
+  { teju_literal4(0x2d9df62a9adafbca, 0x09771275bbef2e26, 0xe0951a27a80cedd8, 0x2ba00423c49c87c9), teju_literal4(0xa9c3189c8830f352, 0x054a158cd648fc41, 0xa9b52c9ce69f06e5, 0x494d3ca56f7b25b2) }, // 42297
+  { teju_literal4(0xcff7216d2cc991b3, 0x86d9e6b8b5e12e7c, 0xa4303046b91e8e94, 0x15205caab736af4f), teju_literal4(0x80f580d9dad4f15d, 0xb5ad762adb96bef5, 0x42421fec735a32f8, 0xffcadcd60bca8597) }, // 42233
+  { teju_literal4(0x711ca82b099d0a15, 0x042d0c801236607d, 0xbeb8be7b708ac58a, 0xe9bfc981a7951b00), teju_literal4(0xc3ed1cf8feda7080, 0x4a3691aef06883d0, 0x1a8f136582ea2724, 0x9dfe6c91cca57929) }, // 42169
+  { teju_literal4(0x3731f199410f5994, 0xa2a1d9bc0c702332, 0x474969d339b40aa9, 0x1561fe8019711a79), teju_literal4(0x94d59f0c9ec085c8, 0x7b0c0d993ca54d72, 0xf69ae4ae5572be79, 0xcec5d62a194ca3a3) }, // 42105
+  { teju_literal4(0x1ac88f47e41f23a1, 0x498e6d00fc19aec9, 0x14b29b0fe5a9c35c, 0xd7131db365cdf975), teju_literal4(0xe21f71b6043d6935, 0xc7b27f0bcfa0ae0e, 0x5de722bb092caefa, 0x2b1969ab512b057c) }, // 42041
+  { teju_literal4(0xd2b3d6eb1007a2b2, 0xe402efcd30d50c49, 0x8a3c550ed30c36f6, 0xb3bd0a5af19421fe), teju_literal4(0xabc5ee8c6839bafc, 0xb5c01321323b5886, 0xb838d0a3ec26bb74, 0x95f7b2a0dff1b172) }, // 41977
+  { teju_literal4(0x30593e3f968758e2, 0x261fd8c1ead90aae, 0x2cf8d56cd64c380a, 0x89e4e3524847844b), teju_literal4(0x827c988cd7c61f07, 0x0ac6cfa03e71c205, 0x5dd9d30055613259, 0xa3bad15a51b1aa7d) }, // 41913
+  { teju_literal4(0x7b2f9fde7014d89c, 0x1dd076314976ce8d, 0xf0193f863c1181cb, 0xb318eee84ebd10d7), teju_literal4(0xc63f4bea17db94d3, 0x0e2c8511d170a0fe, 0x5f588675ca76bc92, 0x4c6857c69526dc9a) }, // 41849
+  { teju_literal4(0xb8d22b355ecdc364, 0x93a9cb5a1d615fbc, 0x58a2c5eb4924e7e1, 0x7cf0f54cfc12177f), teju_literal4(0x9698fd6df4276f58, 0xd54b6bdf3033ea79, 0xe28100b4713981d3, 0x35c042593f96523a) }, // 41785
+  { teju_literal4(0xafdd910f2f0177d2, 0x2ffe2cb6633c7083, 0xf37fb2389cab26d6, 0xb26d455586cd42d5), teju_literal4(0xe4cd34585abaec26, 0x00f3f1393e19811b, 0x72c737afb4952c2d, 0x11882d32122ee04d) }, // 41721
+  { teju_literal4(0x67273f7a110bbed0, 0xd996e6cd6834a43e, 0xe02740f001d03a08, 0x35a33f060095ffe3), teju_literal4(0xadceddd27aa8ccee, 0xfb39d437fcdedb8b, 0x44a87be1c6992749, 0xf9730a98f09bd12a) }, // 41657
+  { teju_literal4(0x2a7da2a0945ba739, 0x00e3d0b8abdec6ab, 0x93e1139c1b335791, 0xbe54155ba2fd8390), teju_literal4(0x8408524fc62532cb, 0x84edc7105c157325, 0xe6db70cf08e4b151, 0xafefba370f29e3e9) }, // 41593
+  { teju_literal4(0xb0f6864cfd432b30, 0xc4f3c63c823e53ff, 0xa3f9d99637f6916a, 0xfc63cfe312986748), teju_literal4(0xc89884d46ba72cde, 0xe0cb95c8ea3761e8, 0xe0f5c175fc22f0d2, 0x1fc85b26a64d3844) }, // 41529
+  { teju_literal4(0x9b5682340835316c, 0x029d7414683813ca, 0x5318b4dff46df945, 0x9ca4ff70a507d586), teju_literal4(0x9861b4abb12d6256, 0xdb8f01404701a69a, 0xe1bc8f41a2f8b2d5, 0xdae4313aabbc41ba) }, // 41465
+  { teju_literal4(0x31fe1c4f34eeaa84, 0x4b510305cdeeedec, 0x5485c5593668ffc3, 0x76dffce2ba514106), teju_literal4(0xe78316ad5b835cf8, 0xa9bda1db6899bc39, 0xeb9c812f1a4fe053, 0x59fe4f0ee8693032) }, // 41401
+  { teju_literal4(0x96d719e00599ed39, 0x18a2bbf6f45ede51, 0xdb2f40a8d1b973de, 0xbcaaeeb17caff536), teju_literal4(0xafddf8edcc144501, 0xe1f3dab3eefe54cb, 0x98725f4d79b6c73a, 0xbea3b191842521f8) }, // 41337
+  { teju_literal4(0x160feabd06bd2bb1, 0x3259d4d36c385532, 0x49f26f78b0b3ff41, 0x1084e46eb8044c51), teju_literal4(0x8598bc2f9b4c8f5e, 0xffa5aa05d9f399c5, 0x49706db39249f31a, 0xe6b59bd5f5e45067) }, // 41273
+  { teju_literal4(0x083696fd12007f3f, 0x39b05fb4f8396c2b, 0xe69edfc17da11650, 0x50891b5c514c7eb4), teju_literal4(0xcaf8dd10cdaf7ddd, 0x50e7796a91dc00fe, 0xb0f216272babbf1d, 0x8615cb3d32ef230d) }, // 41209
+  { teju_literal4(0xf7fdfaf44992528a, 0xab0a2f495d7d5a4c, 0xe9b6796999258f4d, 0x8f2a2d4faad7e272), teju_literal4(0x9a2fd4fd2a4e020c, 0x8c6113ba08797171, 0x0e5666063fcb2c3a, 0x0f985e3d876a0c05) }, // 41145
+  { teju_literal4(0x4496ca8f4ed29c90, 0x2e35c623c7fa8999, 0xbc9aa1a123ae2b26, 0x664fd0312aab1ee8), teju_literal4(0xea4131581a78197f, 0xa63285156de73241, 0xa6b79f8ed57319ff, 0x6852fb3d2a8b18ad) }, // 41081
+  { teju_literal4(0x445052bd4a5bbf3d, 0x63086365fab85103, 0x789b2d68af51795e, 0xb082839bce5a795a), teju_literal4(0xb1f3529581011c79, 0xd58c938fa0e53029, 0xf7a9afd08f502bed, 0x86c4d058daa49798) }, // 41017
+  { teju_literal4(0x90649f9c413af2a8, 0xf9282191bc7f86ef, 0x59b1a719ce09f799, 0xe17e9bbb03fd2314), teju_literal4(0x872de463e90bae55, 0x4c52ab35d1260b95, 0x097e6148390cdf43, 0x77ccae5dc3882840) }, // 40953
+  { teju_literal4(0x47efef207e5cb8c9, 0x2f137111419d4ae2, 0x886d1caba86098df, 0x6258db4aa58e3054), teju_literal4(0xcd606a38ce855bff, 0x8f165fd097f021fa, 0x185e0d856b499d45, 0xdee004dca65858b8) }, // 40889
+  { teju_literal4(0x0e5f9fec3d27fcd1, 0x2e30791fdb93ea03, 0x2efd3a16f5faadbe, 0x2ceab9f876a5ef1f), teju_literal4(0x9c036ecae1b6aa0b, 0xe4e06afae669e6ef, 0x37b19544edc6e450, 0x8c33ffa25bec176a) }, // 40825
+  { teju_literal4(0x91055385a894304c, 0x2bfd8d8c185fccba, 0x4099d7bbddd03a41, 0x024dd115c8c8a500), teju_literal4(0xed079d4662e2b6f6, 0x1e99e3429b47ae55, 0x7e5dd2f09a1b7a57, 0xc444b87bc36433f4) }, // 40761
+  { teju_literal4(0xb641005982979f11, 0xddfa20f35a87cf86, 0x927c9c56cbf5f2c8, 0x61f70324c355a389), teju_literal4(0xb40efdb980006141, 0x95573e851e7db6f9, 0xaa1f23f682f27f2c, 0x32518d496c7d03c1) }, // 40697
+  { teju_literal4(0x522f5c5ddff80b66, 0x1ec5323aa7482e0b, 0x3b96d727fb2daad2, 0x6944e0e88800e043), teju_literal4(0x88c7d94f5ee11679, 0x790536cf1f73c023, 0xa333b1c721456822, 0x94aa8b2a5f366324) }, // 40633
+  { teju_literal4(0x6fbc467875186b33, 0x11558eda12f9f142, 0x3e0d6f8bdd8ef895, 0xa854f1ba460854c9), teju_literal4(0xcfcf4227802d49b8, 0x65ca3b57d76fdb77, 0x4d4188cc34ab8202, 0xc46bdfc07d0b50d5) }, // 40569
+  { teju_literal4(0xcdd2b76e788b9cd9, 0x1381308860f36227, 0xa8ba7cf943f134d9, 0xd0afe84c2b0e8a88), teju_literal4(0x9ddc92af1c6b0fca, 0xa8afb110cdcc03e8, 0x9e3146c5846f34ee, 0xbfa0131b4921d67e) }, // 40505
+  { teju_literal4(0x1574d13c177cf91a, 0x9e764c7d6eb2fc24, 0x063d24cf932addaa, 0xbb93e64dcf083b0f), teju_literal4(0xefd673b19a0c7dbd, 0x348a6ac34d14a445, 0x18d6e0a4e612c8a5, 0xc8f18e4c2f343c58) }, // 40441
+  { teju_literal4(0x6c52140325622a24, 0x26dbc0ab295969bc, 0x7a422c318e21e509, 0x88c4fddc14cd06a9), teju_literal4(0xb6310d831dd05463, 0x0db650e46011c8ac, 0x6a74dd00c615b156, 0x2a15a402b807e276) }, // 40377
+  { teju_literal4(0xca600830f824ae40, 0x0fb1d3d90aa2bca8, 0x1613b9a5203bdddd, 0x444981a2f2fcbae3), teju_literal4(0x8a66a9804cbc3975, 0x71f942d60e7b970d, 0xb95d6a4e80674173, 0xad316683a967de1e) }, // 40313
+  { teju_literal4(0xf4e51d19ac268757, 0x13834d4b5edaa30e, 0x44cd2e87accee9dc, 0x1ceadec2ac94e2e3), teju_literal4(0xd2457afa3cc80164, 0xa2ce78430f0ec182, 0x80a5b35e8e98c92d, 0x786f005c064c8b62) }, // 40249
+  { teju_literal4(0x5a0f862e08ed3a33, 0x423516f5c98652c1, 0xe3f92cffa89e2ffb, 0x9a66b51ef5c5e4ba), teju_literal4(0x9fbb5176792e323c, 0x5e15d4f925f47ecb, 0x81a5df7677eb654a, 0x5210072c89676282) }, // 40185
+  { teju_literal4(0xe9af53ae9e18b0ab, 0x862df352c248a429, 0x6736f3d61f0e558a, 0x15e32060d176d956), teju_literal4(0xf2adce1fa48513c5, 0xade07356f41fd7bc, 0xb8cba9b62f4f825f, 0xdffbd5eae76332b8) }, // 40121
+  { teju_literal4(0x84f01af7dc22765e, 0x22e277054ed59766, 0x76757c0f9f76a073, 0x59e12b9f94d6cf61), teju_literal4(0xb8599555cb878c51, 0x2216f93080659ce8, 0x230bce26a2f0f8ba, 0x79ba56c54369336c) }, // 40057
+  { teju_literal4(0xfab2bb29add86f81, 0xf248a59f1871306d, 0x50de152139aed282, 0x196b793c441506a2), teju_literal4(0x8c0a63b1274bdd4f, 0x90bb8ad07b5e1f27, 0xaef593593c5f1fec, 0x48a3106948dfec76) }, // 39993
+  { teju_literal4(0xaca3f576cdf079d6, 0x52c54cfef87e43c3, 0x586fda9e83e3d759, 0x19b71ecdf09197d8), teju_literal4(0xd4c32b116f957707, 0xc4a209c33cb8c996, 0xc0231b530f791723, 0x54b021e154894842) }, // 39929
+  { teju_literal4(0x40bae93dcbd95662, 0x70355c2d4f00c0ee, 0x93ba113ed1d64fa3, 0xd2d0f4dfeaa3448f), teju_literal4(0xa19fbc208934f31d, 0x91bbedab52a8be7e, 0x756277a6ef2f86fb, 0x65af866cf84e1a60) }, // 39865
+  { teju_literal4(0x798b6a5a53f3f680, 0x03008f57fdbe82c1, 0xcc66816ce73760ec, 0x3ba9478ac4e73f23), teju_literal4(0xf58dc663ce2079a9, 0x462078cf5521ba99, 0x884b53837147a5ce, 0x1b8a33a93738fe45) }, // 39801
+  { teju_literal4(0xb5463e8ef40ae202, 0x1c2803d3066390ae, 0xbe74be552dc89256, 0x213ea87455f2fe24), teju_literal4(0xba88a8cfc6d04a1e, 0x5161500407c8bb6a, 0xd97a1b1d8e7ad728, 0x5c260899683719dd) }, // 39737
+  { teju_literal4(0x4127cb7e11516a6c, 0xabce5980dacadeeb, 0x65f8809508a41345, 0x6ecf275128fe9ae8), teju_literal4(0x8db316c90dddc458, 0x16baa09cd5f8f334, 0x0b1530d71548a537, 0xdd4b56a4970c0cb4) }, // 39673
+  { teju_literal4(0xbd5cf0001f9f37f6, 0xcfd2bd2baebea9ff, 0x1e1734a87c2d8fb9, 0x653fa7de35cfd1b3), teju_literal4(0xd748691160597536, 0xe6a437560a7ee452, 0xc044835bc34ee1f4, 0xef49d04514d95788) }, // 39609
+  { teju_literal4(0xee135a8df8d97c2d, 0xe983229420225a58, 0xe9146267433fe8a5, 0x4cde7c6aebb7f429), teju_literal4(0xa389e3e06aa7c5e3, 0x65b54786d8825c7d, 0x66cbb145bce7f377, 0x993a8de1853691c2) }, // 39545
+  { teju_literal4(0xbdc53417698a7618, 0xd2b8a343b9b654de, 0x97c2bce81b776f9f, 0x16235101424f9595), teju_literal4(0xf876769fb4b49726, 0x7ef231d74f55ac27, 0x199646b6d7e76be8, 0x774a0e2c7e2ad92b) }, // 39481
+  { teju_literal4(0x5a02fbc6faf211af, 0xb60072d446d97cc8, 0x596a71385c00e3fe, 0x02f84bd44c7ad599), teju_literal4(0xbcbe5bcacc3a437d, 0x32a09dc1f3eb5c3a, 0x926a9b54bb4cb0f8, 0x962db4f33a920e62) }, // 39417
+  { teju_literal4(0xa2efcb1880b4bb3e, 0xb174f5f7ee3f4045, 0x08428febc12f58a9, 0x2c73b90ede337003), teju_literal4(0x8f60d1dc51d4545f, 0xaef1a5ed4428b628, 0xb6bf5d3b3e204a08, 0x72c2ced36e0a27f4) }, // 39353
+  { teju_literal4(0xa6e60fe07e82448a, 0xbab9f2427f49d0a7, 0xe4b63c731f456025, 0x3c9ce22a3ca85fd9), teju_literal4(0xd9d54be301290df0, 0xef05a260df262290, 0xaca51d486b31113e, 0xabe15090d9ecccf5) }, // 39289
+  { teju_literal4(0x87b12a00afb042e5, 0x754a2c8c377b633d, 0x09b0d22a254b77b5, 0x697e3ef9d2a10213), teju_literal4(0xa579da1d64f8f0b3, 0xa78b816702151783, 0xcdcd99b74e409acd, 0x2a92e4c135ee9ec4) }, // 39225
+  { teju_literal4(0x71f3ff823a8d7eca, 0x1793bb9e6bbde2e8, 0x7a79ffa070ac483f, 0x889d837ff914e89a), teju_literal4(0xfb67f944359eacac, 0xcf7e2ee302418505, 0x15b8b72f7dc71866, 0xf698cccba4662c2f) }, // 39161
+  { teju_literal4(0xab3527502c7a5714, 0xec30b8a67500f0b7, 0xf83a6425fccff082, 0xac4440d9b663607a), teju_literal4(0xbefac25ccba93661, 0xbbc4716be0908b7c, 0xa548ed18f9d2b9e8, 0x8435e18c525a021c) }, // 39097
+  { teju_literal4(0x730920b34258a195, 0x1daca13167df021b, 0xb6c4a74398091e59, 0xeb87d96b1630d153), teju_literal4(0x9113a42cffb70c7a, 0x64d4eab43345619e, 0x5c81846d6919e298, 0x99cbca9ce79ca9f6) }, // 39033
+  { teju_literal4(0x86e1b8a5e770d476, 0x738f358e85260d76, 0xa1ed8e9e94e65545, 0xb14e60d864d7117c), teju_literal4(0xdc69eab4bea82e09, 0xada3eafe9a215bb6, 0x86f8ba42f43bea04, 0xda8d7c01a56f0003) }, // 38969
+  { teju_literal4(0x7d5efae1943ab472, 0x5cb6b9a881b9c9eb, 0x437086f8986c1610, 0x41555a4d2e94fcf5), teju_literal4(0xa76fb0738714ec6c, 0xbe56b81bb80107d4, 0x0c412428d473105d, 0x4c539bc8a5e2f56c) }, // 38905
+  { teju_literal4(0x68960525089ad4a8, 0xa2b71720628c14ca, 0x11e1998af9f22498, 0x14054c58125b8197), teju_literal4(0xfe6269125e1918ed, 0xdbb762a4b810545a, 0xb86f60661cef72c5, 0x7fd9597c2ba13893) }, // 38841
+  { teju_literal4(0x7f5ae36048f53b15, 0x81f487676ced315d, 0xc7da05f8dab2f82b, 0x0ee2d37120b0b1f8), teju_literal4(0xc13df0d89ee6ae4d, 0xc522926378722750, 0xd6a8f1769ab349ee, 0xca7137d4e2dd9afd) }, // 38777
+  { teju_literal4(0x9b765ae3c4576eaf, 0x7e20cdf94cf062be, 0x31026ac3f6f0409f, 0xc48d1655ffee3594), teju_literal4(0x92cb9d2b69e2a728, 0x88bcdc60d7188d56, 0x4b9971f4adf199bb, 0x4ba84540b5b024f6) }, // 38713
+  { teju_literal4(0x037add40a4a8c755, 0xbc41dc26c099e6e0, 0xdbbc16c67ba441e1, 0x0adfb4bad493989a), teju_literal4(0xdf065cfb52beb7f6, 0xb2772b23e408d551, 0x07cb63ab52157be8, 0xe281d3dfadacb5ca) }, // 38649
+  { teju_literal4(0xdfd06d4be2dfd98b, 0x4086e7a7d4f559e4, 0xb65507ec60300841, 0x31950cf23dce9623), teju_literal4(0xa96b78b44772819a, 0x4bb1c2e0cd5d16ea, 0x4b139310690bf791, 0x1547e61e3b96449b) }, // 38585
+  { teju_literal4(0x0ec6d236f81f7a10, 0xf4648b5be3b7adc4, 0x50992d220a7fc375, 0xc1364fb2a7e24b06), teju_literal4(0x80b2f08e2f34fd7d, 0xe6dddcc387e0fc6b, 0x928278b16d15451d, 0xd761983d6894ea11) }, // 38521
+  { teju_literal4(0xd1f306b36d5263a8, 0x6e0fd308fdb1b2ba, 0xde49c8af2c232f36, 0xd678f33b033853d2), teju_literal4(0xc387fbcec25d76c0, 0xf85ab4a257928611, 0xeb9b6b01a024235a, 0xada16065ce58feef) }, // 38457
+  { teju_literal4(0x42ac76803baff730, 0x52be47297ac2bedb, 0x26f38be7b1db5d4e, 0xa36ef25cc0f1821f), teju_literal4(0x9488cc76b4ddd581, 0x404e4df922ca64b5, 0xa1352d2f670684af, 0xfcbc3d00b7153bb7) }, // 38393
+  { teju_literal4(0x338443cfde00f74f, 0x567bab9cc11718ea, 0x4e1ee1c788c464e3, 0xc59eb84e339290fd), teju_literal4(0xe1aaba7299cca138, 0xee72e7b6e603b2bc, 0x791f506891136609, 0x10bd485674d2be57) }, // 38329
+  { teju_literal4(0x26733585ab959a2e, 0x9617b0f0e6513f47, 0x719df11b8170e9f5, 0x1170a8bebf8f0ec0), teju_literal4(0xab6d44e72608513b, 0xf1a01a7e7ad93e00, 0x5ff0df5e1c945df3, 0x128684d07c3d8d08) }, // 38265
+  { teju_literal4(0xeeb586f21b42296e, 0x3caff0f96969617a, 0x89c09c9c65d16012, 0x402d16c8f389f221), teju_literal4(0x82393e633ff9a9ae, 0xf67a0eba6eef7100, 0x6fd64bd48ff9d175, 0x3b56a2abe1b9d2f5) }, // 38201
+  { teju_literal4(0x92113b7272939b9e, 0xb01e212352bce683, 0x2e988868c4343040, 0xc78645aeb0c422bb), teju_literal4(0xc5d8f80e100549ed, 0x0100281eef3e0722, 0x9c80bad0a316a7c6, 0x2d0d267eec5bfb83) }, // 38137
+  { teju_literal4(0xc56adb3f7850f711, 0xc902b05bc71f5d8e, 0xb757877ec8d137fa, 0xd15f0cf94f96ad00), teju_literal4(0x964b41dd65578ee9, 0x89f6e33d277e863f, 0xada0d51730e9de8f, 0x452715b53e87b878) }, // 38073
+  { teju_literal4(0x5cc9de67fd080e31, 0xa4f6d8a80c1add37, 0x733b3723230ec106, 0x92b2ce61a539abfc), teju_literal4(0xe4571b1e6a64a44e, 0x7e80adf3541d23c2, 0x1adf26c3dd8c6eec, 0xb7a6cfa9ba9ad6db) }, // 38009
+  { teju_literal4(0xdbec33e3fe5aff7d, 0x74e88dfa3fce4706, 0x14365ac12970c87f, 0xd6f5a37600de898b), teju_literal4(0xad75274a502d897f, 0xef11e35cac9a95d8, 0xd7a9fa0aea138ea5, 0xe182172477c438a3) }, // 37945
+  { teju_literal4(0x3ca4e994e62550f8, 0xb321304a8d9ba705, 0x7058ec70bb442483, 0xa6992146957a9e64), teju_literal4(0x83c42be40f16b05a, 0x05d78c22c9ff2a82, 0x935445fcfcd39ccb, 0x7c7f42ee75262323) }, // 37881
+  { teju_literal4(0x5a705edfe9639cc0, 0x58761cf58c4ed232, 0xa0614c89d2ea94c8, 0xfbd083a5c07ff147), teju_literal4(0xc830faa47c855eb3, 0x1babf43837db5956, 0x3ff78a9187aa7b41, 0x1c0766f8c0a94204) }, // 37817
+  { teju_literal4(0x1815aadd2753ae3e, 0xd071520583d1941e, 0x8fbac3bd4fa58ab8, 0xbca5e727ff4c46ef), teju_literal4(0x98130d5defd3fffe, 0xcd3ee12edd48dbf3, 0x4c7aeb8cb4374770, 0x095bc0332f60abb5) }, // 37753
+  { teju_literal4(0x960bb0960a8b54ab, 0x1412531082bb819e, 0xbfdffd8a2c1e3654, 0x46bb61205e4c8111), teju_literal4(0xe70b974b6f95300d, 0x1bc409cb22f3c60d, 0x1881a1e7d475959f, 0x9d4747b9f4e54ed9) }, // 37689
+  { teju_literal4(0xf33ba49633dd4a4f, 0x2fec8f88975b609f, 0x30eeaacd3a368715, 0xd13f228404984199), teju_literal4(0xaf833253466b9803, 0xc943f81bc51af4ee, 0xa1896ab574d4ac3c, 0x390ee3b1b42d9e48) }, // 37625
+  { teju_literal4(0x4d30242e1ba26da3, 0xb1208948b3b856e2, 0x249c758326ea3069, 0x775ee3e70b528bf1), teju_literal4(0x8553c716514a0780, 0x254ea10becbf89e2, 0x52d68a81482edafa, 0x2e69ba4ee73cf843) }, // 37561
+  { teju_literal4(0xf4392594eb4d33f7, 0xe1c8dfebf38c59cd, 0xbc5152b495346e11, 0x1dd081b7148dda76), teju_literal4(0xca9018dfd6948d10, 0xb9a14b6427d4e70d, 0xf8870e8900d8dc35, 0xdde6ebeaa15edca0) }, // 37497
+  { teju_literal4(0x4baf619735b08bac, 0xba2963023a2373b3, 0xd62dc3035a8c9ec4, 0xa78636c91ae93ef7), teju_literal4(0x99e03f274a0d32a6, 0x37c80d5b91d8dd15, 0xda261fc53fba01f7, 0x910b29e1699c9fd6) }, // 37433
+  { teju_literal4(0xbf22a5de98865c98, 0xf4afb636799e84a6, 0x5640f2672127954b, 0x2a5178320eca378c), teju_literal4(0xe9c8479005c75480, 0x6751f725d9a28855, 0x18ab2bcd71cb596d, 0x03b8577563b48d4d) }, // 37369
+  { teju_literal4(0xe67241b364967c3b, 0xb3083f754db29f02, 0x3fa1bfe83a465cef, 0x347f02c43a78a662), teju_literal4(0xb19778af8446bcd2, 0xa04a1815f9975a7a, 0x1df33732c997f412, 0xee6d75a4dccc59ed) }, // 37305
+  { teju_literal4(0x7ddfcd79e6c880d2, 0xc82bfaacdee70ab4, 0xb08eadec4119707d, 0x8f51aed7c74fd7af), teju_literal4(0x86e81e2a41c835be, 0xf9589261745b4c5b, 0x8ae0845edee0e5f2, 0x0597f10b9df76050) }, // 37241
+  { teju_literal4(0x2d610c2c99d94d0a, 0x401029cecdb36280, 0x73e88cf8f5d7f589, 0xd206e1d57c1a2f46), teju_literal4(0xccf6684e889dd47e, 0x92f1b26bda551a4d, 0x81d90369af5501c9, 0xa1be4c4d2f75a927) }, // 37177
+  { teju_literal4(0x721e42b786993ddb, 0xe9cbc23bc40fc7e5, 0x29271831e7e3f6b4, 0x621ce350edc0162b), teju_literal4(0x9bb2e7997e0c98aa, 0xab4d5cebc4005695, 0x448be27fd91a6b48, 0x35fb4a41c4b5efff) }, // 37113
+  { teju_literal4(0xf0bbab9192d7f69c, 0xe6007d7e9e9bf8dc, 0xcc1e02a60f619163, 0x5d80b72de2dac770), teju_literal4(0xec8d44cd1a3b84e8, 0x751659cd5b2e20e9, 0xe23a26fdc07683b0, 0xed894daa4c061c9e) }, // 37049
+  { teju_literal4(0xc5d3ad082fb93f29, 0x1e340203d8e33a57, 0xd836beff05b8adaf, 0x44ff950ae419f81a), teju_literal4(0xb3b20d452a037333, 0xb90598fad575deb4, 0x45007710600dba0e, 0x9f6d1b73c0e6d021) }, // 36985
+  { teju_literal4(0x5d87ad54d0e2532e, 0x54a0d5b85b43f6df, 0x7ca76b22c015b7a3, 0xb514df79d0cf79ee), teju_literal4(0x88813f7b23339506, 0x5a8e7a697eb97e5f, 0xc932cbcaa69b1de2, 0x8f4e339bb77f6a8b) }, // 36921
+  { teju_literal4(0xacaab42b1a6cfb01, 0xe23efd93e7fbd031, 0x4cd8b1efa089de86, 0xa27fffef5497f1c8), teju_literal4(0xcf63fec05cb02460, 0xe82b1cb9c3bcb6c9, 0xdfe5a5d976eb6587, 0x64989a75020abb8c) }, // 36857
+  { teju_literal4(0xfffb78a069faf562, 0x4d9ab529ef986a6f, 0xbf63ace857326d17, 0x6ac2c1dca1fbc33e), teju_literal4(0x9d8b17463f02b1fa, 0x707836e6115c0c7e, 0x2c8177bcae263401, 0xcd9ca72f0bb0cf45) }, // 36793
+  { teju_literal4(0x5fcba5fb54964354, 0xe1daefa83fe2b90b, 0xde3987267bb85718, 0x2c152cd6735aab61), teju_literal4(0xef5aa82f0d2c1e3d, 0x6f6db2367c45d25e, 0x5c8c79b87f17c6b0, 0x00e60afdd5975b0e) }, // 36729
+  { teju_literal4(0xc9431eaa283a3885, 0xa1cd76aa66a8bb12, 0x7a2d1a1163aa14e5, 0xdc4290c2317f69f1), teju_literal4(0xb5d30333a86eb76c, 0xd8eeaf7be184abbd, 0x644b8045f62589c8, 0xda6b52b8b25bee89) }, // 36665
+  { teju_literal4(0x93afcb5f3ade48d4, 0x3382368ba4ac532e, 0xa85e009e4dc4cb54, 0xc6f5a7937c8c1c9d), teju_literal4(0x8a1f398fc21ab255, 0x3a891a1b13936775, 0x6f936848d123a478, 0xdf67d4e809bc1ad0) }, // 36601
+  { teju_literal4(0xb7ae1ad3e9e59bf8, 0x8845c9d210895611, 0xd14c48c87814529f, 0xf89e8f54302600ce), teju_literal4(0xd1d8f24742c05b81, 0x9a5f85cc121599d2, 0xc78efadba641ea68, 0x917f26fc77232960) }, // 36537
+  { teju_literal4(0x3f7f9bfee7560622, 0xae473e35d0e62400, 0xb4143a3ccbf688c1, 0x2efc7df91c066666), teju_literal4(0x9f68def17fe2176c, 0xcb2faacdb80ef2fc, 0xfce195725f139ab7, 0xf52a2f551de6d6a6) }, // 36473
+  { teju_literal4(0x0cf9cd0bf44c21c4, 0xbb5e1ed9dbf868f7, 0xc7c78c44990d0ff4, 0x088f26ba01fc203e), teju_literal4(0xf2308b2e969db9ad, 0xc32d67a339520e20, 0xc8684653bfec8270, 0x38d53f36599b30c6) }, // 36409
+  { teju_literal4(0xdad6e57cd0d960c0, 0x8aa6ff3fb731211c, 0x6efcea308867205c, 0x71a31ef8f8604f22), teju_literal4(0xb7fa6dd46eaf42e3, 0xeca14468ef51eedd, 0xcce38a6df477fa9d, 0x42202aa291b53cf2) }, // 36345
+  { teju_literal4(0xaabc45a2ad35301a, 0x454ee3bec0f3e53d, 0x4a6528ceea16821e, 0x6977fc21d2b09ad8), teju_literal4(0x8bc21b1af9026c9d, 0xe88045c0a03782c2, 0xcb90125e9ba26f42, 0x6f23980cde5c909a) }, // 36281
+  { teju_literal4(0x051ff7b7cdc9492a, 0x162aa191dcb006bb, 0x5134f551d3a604f9, 0xd9677109e7c47ccc), teju_literal4(0xd4555938194488a5, 0xe24a2c2055a3c9f3, 0x7f2e7b4762fdb113, 0x35310059cdfc3d90) }, // 36217
+  { teju_literal4(0xae7b6ed50c461bb5, 0x53db791624265c1b, 0x625e6580447dc7f4, 0xf2e3991387456707), teju_literal4(0xa14c4f920bc342fe, 0x7f1d6a35a5dcd81b, 0x0572ad49d80fa109, 0xca18d3b547038163) }, // 36153
+  { teju_literal4(0x535d5761e9366dfd, 0xaedd0b2859ed1508, 0x8f7d33cb81ca065b, 0x33e8880e3d4191a6), teju_literal4(0xf50f0791ade56ae5, 0xd52e6a91036a8dbf, 0x2486785ed0d96529, 0x271d95a8feb51809) }, // 36089
+  { teju_literal4(0xc97699361d51a59b, 0x690ff2764783a8e5, 0xabb42e2fe29300ed, 0x2d76f5f6b7dcadc2), teju_literal4(0xba2860bb9a25ea8a, 0xbf3a12aa113be101, 0xaefffe193e09e6e2, 0xfd0cc61f6bfdcbe0) }, // 36025
+  { teju_literal4(0x898e96ca4c67cb3c, 0x9c637a44620f1bf1, 0xafe59aaf364dc636, 0xe9831f5fdfcfe642), teju_literal4(0x8d69f2fc360082fe, 0xf6e68858a4444457, 0x6b9f6cde7d063d47, 0xe3476364e905eb07) }, // 35961
+  { teju_literal4(0xbade44e3597fe319, 0x0c6702cc239f1f19, 0x2a3bc7d11ee0c05e, 0xcfac23f69b7ed2a6), teju_literal4(0xd6d94a2b782f8baa, 0x8d40403432212518, 0x4bfcff1c7b970f63, 0x2d5d842762c2b0dc) }, // 35897
+  { teju_literal4(0x35d23fee7fb1d6e1, 0x56cc2970cb4ac0e3, 0x5236bb9944a0ba71, 0xe1ed69ba272439da), teju_literal4(0xa3357a5220167eab, 0xe03165da3128cffc, 0x6b2d51dd19c73802, 0x75baa3f037dc3856) }, // 35833
+  { teju_literal4(0x0e9da6fe06ac701d, 0x5565f704838398c9, 0x5a5de94430d706d1, 0xd0e2341d34c02b4f), teju_literal4(0xf7f6376c73ed2293, 0xac40d224a3865cf6, 0x8f207495928bdbc3, 0xe36271d270c09f17) }, // 35769
+  { teju_literal4(0x8ce3ae51d84285d4, 0x3623666289b58914, 0x50612404e82637ba, 0x6aba51f37f835965), teju_literal4(0xbc5cefb8a8635e36, 0xee5f1bf566d4411e, 0x4448676fa5cd51a9, 0xb023ba4a225a08ff) }, // 35705
+  { teju_literal4(0x15d68fa5f4298464, 0xec8e61b38214b33e, 0x9b6e0775f1962e07, 0x6d23ccf7284713b3), teju_literal4(0x8f16d04001eb50b5, 0xc6a549e7b2473b8b, 0xa7faa6f50da1acc4, 0xdc250ab2ef513a7b) }, // 35641
+  { teju_literal4(0x73d64d2960bbefa5, 0x72b20d9f091cfa73, 0x67be3c488e3858a7, 0xd9c1fb31ea0d1e9e), teju_literal4(0xd964dbfe7e544c2b, 0x8284ecdbcf19b55b, 0x9cd3c85132d28fe5, 0x4cdb2c7aecdb8af2) }, // 35577
+  { teju_literal4(0x5b0ab4a8078c3679, 0x9fbafd3eee44e800, 0x4c9309325883f8c7, 0x1bce62b82af5d148), teju_literal4(0xa524709008a97377, 0xc65746c42d9621cc, 0xaa68c8ba97e9e7a4, 0xe393f33b5bd93cc6) }, // 35513
+  { teju_literal4(0x80d73e7d8127d345, 0x6e6c6da7543c5565, 0x17f705663aa4a406, 0x2398ec1e05488038), teju_literal4(0xfae63522203e8687, 0x1caed22a2f034765, 0x492f2a7d35a5b1dd, 0xc5def0fe4af745aa) }, // 35449
+  { teju_literal4(0xbf8738b5104382a1, 0x6acc8766c50188c9, 0xa8bacd5ef241a5d3, 0xc515d711b3957619), teju_literal4(0xbe982ed72b399a78, 0x6f6ee696f010d38c, 0xed9f8901e793a0fa, 0x0131bed959d6a207) }, // 35385
+  { teju_literal4(0x6aa846786a315e4e, 0x7652a29f4fd5b94d, 0x3516097199e00fbe, 0x2cfb7cdc42595476), teju_literal4(0x90c8c22089238392, 0x9e4aea948e95efa9, 0x754806100daf58e7, 0x9b3f9fa82b56617d) }, // 35321
+  { teju_literal4(0x891bf2cd4fca1b09, 0xdaaca8003df9e5f9, 0x8f83f874a8e22819, 0xbb200de21e9b3513), teju_literal4(0xdbf825d3a137d096, 0xb1dae15e13042f6e, 0x01772259664d1add, 0x29410c88f3210ed1) }, // 35257
+  { teju_literal4(0x589e819eaff1965d, 0xcd7ccdfbff97ecfa, 0x701e05b8aae7ae22, 0x29829ac6c5144b7d), teju_literal4(0xa71943debd85e2c9, 0x3a7f43c08f4c544d, 0xf0ee0afe565ba28a, 0x8e363f9c9ad24f25) }, // 35193
+  { teju_literal4(0xe8c6ef173521d94f, 0x4f8bb5bc42c5c5a1, 0x5aba1c32cdfc4ccc, 0xf615f23a5437c5ee), teju_literal4(0xfddf1b65f0dcaa08, 0xbfbc8f778a26a0bd, 0x53e0e460591fc2a7, 0x9b65410042772b20) }, // 35129
+  { teju_literal4(0x9e65bb24d3807adf, 0xadde15c94379f05b, 0x39b4e49e3ad1fbb9, 0x71133532f1d01553), teju_literal4(0xc0da325f7eef71aa, 0x91e7e50d75fd3d17, 0x66c3062090c591f8, 0xaeaa9991f497add9) }, // 35065
+  { teju_literal4(0xef2b419c8b1c05c2, 0xaa555341a0cdb779, 0xbf48005b04ad00c6, 0x0b78486d4ed62032), teju_literal4(0x927fd80625fca844, 0xb63284bad35e9cca, 0x1bcb440a8f61df38, 0x1ac9ef21cdd943d9) }, // 35001
+  { teju_literal4(0xce175e636506ffd4, 0x6605d70deeeadde0, 0x9903e5ab2686fddc, 0xb13b3a7a88700b0f), teju_literal4(0xde933f137f5996a8, 0x33733827f1e14415, 0x169b3c5599f6b2cf, 0x253ae61d05e4db26) }, // 34937
+  { teju_literal4(0xa6a352ee49d04c9b, 0xc4fce29b199c0795, 0x22832e77323f5be1, 0x6ec34098b43593bc), teju_literal4(0xa914060682af2516, 0x8c790920bb4d5add, 0xa71b2f8d3be8bcca, 0xafa25ae996582e91) }, // 34873
+  { teju_literal4(0x93f3c08c9c815f1f, 0x0beae9a0aa607d73, 0xf3d1c2eb90c9f4a9, 0x7d3291894a2a22f4), teju_literal4(0x8070829e0e7a9544, 0x1f955c211662e0f1, 0xfe1aaaf292ad3101, 0xd77fab6758f8c611) }, // 34809
+  { teju_literal4(0x1b91a4863d4dde99, 0x5135b9fdabae163d, 0x83d921d13be0f11c, 0xc89ba137176b6a25), teju_literal4(0xc3230ed7829ca45f, 0x1fd2627c1859b515, 0x12b682afc5ecc1d7, 0xfc2138f36d63f02a) }, // 34745
+  { teju_literal4(0xff6bf979749608f5, 0x651504f5a3efc9fb, 0x509a87f146d5d9d8, 0x441ca712a3818ae3), teju_literal4(0x943c2187ecc9768f, 0x4abc9a28a128f5dd, 0x38312a4674348143, 0xb41aceec15f3212c) }, // 34681
+  { teju_literal4(0xb1a2c69521b4854f, 0xd3d03161ba56b028, 0x75b7686bf788668c, 0x0ed59a5817e478b8), teju_literal4(0xe1363f6db4f9a4ae, 0x1aa8756caebf353e, 0x20f1d5b6d373104c, 0xd490c9fa6667ee3b) }, // 34617
+  { teju_literal4(0x72ac9634189e8efc, 0x1b51eaaba1d13aa4, 0x31524ebec7144196, 0xaab4fba30f80ca7d), teju_literal4(0xab14c90589c419d4, 0x4da03a373f9d8bc5, 0x449a151819ce70dd, 0x5e686ca5423d050c) }, // 34553
+  { teju_literal4(0xa070d7e9eed90d99, 0xe363c2de8d41160d, 0x3589b9f7611e3261, 0xc0bc35e737830df3), teju_literal4(0x81f606fd6538a74b, 0x115641d2d7a19579, 0xe74f12a2f5dfbbbe, 0x8fed87547a1cb2f4) }, // 34489
+  { teju_literal4(0xa82b86890dc8fcef, 0x015b3f7aad0c19b4, 0xd93d384d2aa24fb9, 0x4c8111b4fa92e849), teju_literal4(0xc572d90352b514e1, 0xbf1110f671dc26e5, 0xd2890c9daa67b37f, 0x734d9f824bfc2b96) }, // 34425
+  { teju_literal4(0xa46dffd006aa0cd1, 0x5b26d7176a52d76a, 0xafabad636ddd6750, 0xdc4f3ea2a6839a86), teju_literal4(0x95fdae6c3990d660, 0x18fa4f66b1dc622e, 0x2a9ea6101d0f60e6, 0x38dd31b1d5141f26) }, // 34361
+  { teju_literal4(0x77cfa308449a1422, 0x493d259752d1d6e1, 0x7266dc1e1b4fd5ac, 0x3293872e4ff1c924), teju_literal4(0xe3e13ed9b363e197, 0x13b3ca1f19f3885c, 0xb825923013270dc4, 0x9e6d36f35bbba8ab) }, // 34297
+  { teju_literal4(0xa228ba21a34c53df, 0x3f3fb607ccf7779b, 0xf34287945fc62c71, 0x69bfb1fd86338eb6), teju_literal4(0xad1b9f10958b45d2, 0x06824b44f7d641f7, 0xe0c7407915f574a6, 0xdd15e9f90095be75) }, // 34233
+  { teju_literal4(0xd9dffb4a59178d1a, 0x45a1ad195307e113, 0x3691140b80526803, 0x8473f824db2e83ab), teju_literal4(0x838028a58337ef9f, 0xa31fcb449fd1f860, 0xb25ad3b9972d1a92, 0x42cebef2c8b40184) }, // 34169
+  { teju_literal4(0x495a94e0d5c9a70f, 0xe70b46ac4a927473, 0x6260e88d92698c27, 0xa3d04758ebe62ef4), teju_literal4(0xc7c9a5e605c9b56b, 0xb84b188a01611fa5, 0x0dbc5df64ff2f6f6, 0x399d181aa345c130) }, // 34105
+  { teju_literal4(0x7e3ddd48c6633beb, 0x4980c5878c520c69, 0xcb634d3942af9d3d, 0xd213000cc2dedc99), teju_literal4(0x97c48ea93f70a5d4, 0x302982f71a37e92c, 0x4c9bde7f3b674c78, 0xc5bba75ec0fec5a1) }, // 34041
+  { teju_literal4(0x33ec6fe39ab7cf3c, 0x5e2e2ad544a36401, 0xca60cece7b88d4b7, 0x021346a1cf83d0c2), teju_literal4(0xe69455979ac858b8, 0x268b081acbe91818, 0x8cd2d1e6c27e8f10, 0x2cd39f398b00685d) }, // 33977
+  { teju_literal4(0x0e8f01906ebc36e8, 0xa0de80ea9771a7ad, 0xdcf2306014522b65, 0xf0d3309ca245a172), teju_literal4(0xaf289a939f6eee96, 0x01cd71e0ab7d1030, 0x93b14b56056c552e, 0x957fe75da4f7684a) }, // 33913
+  { teju_literal4(0x663d5327a5bbc753, 0xca8e1985983f943b, 0x28a5c46d244439a8, 0x24725e9738999a51), teju_literal4(0x850ef594e0584728, 0xacf6f931b4397adc, 0x20cc6cfb752bc0ca, 0xf4ed8ae8ee6bd282) }, // 33849
+  { teju_literal4(0xe5a62a3576d66fbb, 0x2c77a6f416f81675, 0x1553419279f8b293, 0xe4420a4cc2ae80db), teju_literal4(0xca278ac26b85e4b6, 0x7e1750a6599b2bc7, 0x111c524d6e35d89f, 0x49752b18eb4fb174) }, // 33785
+  { teju_literal4(0x51a4ea81b58b445f, 0xe834e9036e94fdd7, 0x314ad8aa9334dc21, 0x35d9c6dc8a26ff65), teju_literal4(0x9990d26599b3577a, 0x442159cb1d5902a1, 0xcc4d3986a261be7a, 0x009afc36c50487ba) }, // 33721
+  { teju_literal4(0xb22eb94578756909, 0x13261c4545a28f1c, 0xcd66beaf1f71cb32, 0x75ecd74cbc0d31ea), teju_literal4(0xe94f9c3116a82564, 0xb6972deb7fa35d8b, 0x2148f299ef00bcb4, 0x6932218b4c8f03ce) }, // 33657
+  { teju_literal4(0xcdcb8ca76247c63a, 0xfe1cd4606f75d319, 0x578b78954199b3a6, 0xcbed47cd05660287), teju_literal4(0xb13bce327eef12e5, 0xd332b929cf5a33e9, 0xe5d0db07de0c5695, 0x0403aa300df51b95) }, // 33593
+  { teju_literal4(0x62afc7a56ab5521f, 0x1aab1165205ee86e, 0x84bfda2a34b3ad3b, 0x07e83c3079320d74), teju_literal4(0x86a27bf464fceb68, 0x9b0848002310ff00, 0x9c1872a5c4c55546, 0x9683ab7fdbbf363c) }, // 33529
+  { teju_literal4(0x86105e005d8806f9, 0x975bc1370a8d1f14, 0xbec3cda57050bdbf, 0xfdd18634a3c3e2ba), teju_literal4(0xcc8c9d1bcdf000ee, 0x6fbf63524e76a15d, 0x4f97cca2934aac6e, 0x1b28912b1872f39c) }, // 33465
+  { teju_literal4(0xab0bc6c45677e91f, 0xd171a5e884d49487, 0x9c397f192a70fad7, 0xea21f4fc61ae43f4), teju_literal4(0x9b6289f8de9d8f92, 0x3506cbc09f222447, 0xac2b674b2beed183, 0x7cf4224bc61eb722) }, // 33401
+  { teju_literal4(0xe92d38d2ba271526, 0xd55432e99fcb0687, 0x71117584fe415fa3, 0x28739df91ca8fb7c), teju_literal4(0xec132b7a3cded9e8, 0xe2ae1d381d94c18c, 0xca26f96b4302dfe6, 0x150756a5e3644b28) }, // 33337
+  { teju_literal4(0x25c080d8d8026fff, 0x09ff8cf23b7ff319, 0xa83fe86da04270e6, 0xdc81c1d43437c8ca), teju_literal4(0xb3554cc9930f327a, 0xf584319f4bbb6835, 0xcb2f78df15106fdc, 0x7cfb884aefbf970c) }, // 33273
+  { teju_literal4(0x73983bfac4c70416, 0x6c60474f10868f8c, 0x3451fad04e90c53b, 0x88e2abd6a0cab840), teju_literal4(0x883aca17eac12fff, 0x2eef47ea656dafcd, 0x9cc4e2a6dfdc0c1c, 0x9f3aa34fb9a80377) }, // 33209
+  { teju_literal4(0x163563dd1a608ab2, 0xe14c6ab023b408a6, 0x6068e6b3c48410ab, 0x3bd97262e70d3e2f), teju_literal4(0xcef8f2b6b4f40d98, 0x1718f15196113727, 0x1a5c09694f9a67ff, 0x2079cb6cdf448e2f) }, // 33145
+  { teju_literal4(0x6c435f0ad837711e, 0x989980530f6a85c8, 0xf2bc168c5945dfb3, 0xa5d7d564925e17f4), teju_literal4(0x9d39c5ec33f8f6a8, 0xdba5f775cd73645a, 0x758771f8d7db3e96, 0x3705b5d06116b047) }, // 33081
+  { teju_literal4(0x1754c8ff99a2dc6d, 0x89932ec0fc022c24, 0x9ee1e15b0d31b5f0, 0x0196e96e87dde4a1), teju_literal4(0xeedf1c926f504d32, 0x97e4f394c3785233, 0x351370604bfeec75, 0x849feba4f16daf16) }, // 33017
+  { teju_literal4(0xf3bd53495f43ae60, 0x39058e005813f163, 0x4df97c949b69806f, 0xc4568046d778d72e), teju_literal4(0xb575296e6dc5e8ea, 0x9a3377fd83924c34, 0x4d27c87e5de4186c, 0x775702c3368223c7) }, // 32953
+  { teju_literal4(0x97f17bc148e3fcdf, 0x33004a14d92c06b0, 0x8a8f316ab10216bd, 0x7045cc69d30de5a8), teju_literal4(0x89d7ee7ebeb38351, 0xd9823b01aa3f14d8, 0xfa3c6cda645a6d33, 0x58680c323a8dcc9d) }, // 32889
+  { teju_literal4(0x171928ae469cc7f1, 0xd0b0dc216dc1d94f, 0x5611e19b38515a92, 0x04047faf654f6146), teju_literal4(0xd16ca199ac3f5dc9, 0x4380a2bd54217048, 0x9122cb14dbe166c3, 0xf2641c68e61a62cc) }, // 32825
+  { teju_literal4(0xa01f5708e80d73a7, 0xa25e3d171bf27ca6, 0xfea8b3f00ec2d7e9, 0xcb6d721a4684f750), teju_literal4(0x9f1696fae56187bd, 0xe59fcb385f106377, 0x5ff680d85f991a74, 0x8ecda01ef2e3557b) }, // 32761
+  { teju_literal4(0x5e71725840d8fa1a, 0xc40e6194008bbd3f, 0xe0ae40aa5dba8020, 0x242ea731cac07c45), teju_literal4(0xf1b388e54042d279, 0xd4293ce0d414a993, 0x684b59aeaec8bd55, 0xa0c032023378d7b2) }, // 32697
+  { teju_literal4(0x62de2ee66f71733a, 0x362f5e6112aa6be5, 0x05c3400f87572798, 0x09d1769a822826e8), teju_literal4(0xb79b777081747206, 0x314f5b791401fb76, 0x2683ed804b3cc452, 0x82b495817f866f6b) }, // 32633
+  { teju_literal4(0xd13c312227e42a78, 0x7d4d68d36616555b, 0x996cd50ad6fba335, 0x7b5b06715209b36a), teju_literal4(0x8b79f7d4251b6616, 0x8c933d96f46cc149, 0xd76a97f5f92ca6a9, 0xf69924c77b9647e4) }, // 32569
+  { teju_literal4(0xb5cb564469707e24, 0x17d559d961a62e33, 0x6cb0ea1987fa1ded, 0x84f67a8aa150acf8), teju_literal4(0xd3e7c00e0b744925, 0xa21c825ed9782c86, 0xbba4ffeeb7b551d2, 0xf8f6acdc8cfa3a88) }, // 32505
+  { teju_literal4(0xd54738abade3618a, 0x04ac92e7f3df5c73, 0x33a216e17cbe7c4b, 0xc6edabd19fba836b), teju_literal4(0xa0f90e12fc5ab020, 0x38eac561dd12b349, 0x92576e1ff53476c2, 0xfc7b067b3851ef1c) }, // 32441
+  { teju_literal4(0xecd6e6ecb5e23f57, 0x39c0046fa235a5d5, 0x0d17d9ff1c584872, 0xe2c46702de43f68b), teju_literal4(0xf4908a2b596df685, 0x9561b92c705fd061, 0x62b9ef52f3c14f40, 0x91573f7639c01104) }, // 32377
+  { teju_literal4(0x26ed3c11f4856c6b, 0x2080be74260866ba, 0xa953c1381f5d57d8, 0xeb91a260d8dcabd9), teju_literal4(0xb9c84a59d06c406f, 0xf20d36b75fcda805, 0xe1334eb49137fc3f, 0x536202725b8b219e) }, // 32313
+  { teju_literal4(0x6f756b62805174f5, 0x03b93ea6e1fcba4f, 0x3f1ce533eec6bb4c, 0xe1d7f1a778a4e986), teju_literal4(0x8d20f4efdecf0382, 0xc9c0b952437e569c, 0x15fe79da6ad27166, 0xfd059001b2a9f8cb) }, // 32249
+  { teju_literal4(0x40dd571ec26223cc, 0x000a351633be30fb, 0x0c5580903d663e1e, 0x7952f0eb40399ee4), teju_literal4(0xd66a64a0c0bd075c, 0x8c92d35a8ec7adea, 0xb2450c7c80cfe988, 0x5519ddad476a3b18) }, // 32185
+  { teju_literal4(0x84b638472a685565, 0xd45120c376ce3a32, 0x16467315d3b97056, 0x9cc23e6540811d4c), teju_literal4(0xa2e13c55da31a75c, 0x8453d445292db2b1, 0xb3f87012c614283b, 0xe55f3174ea4f0553) }, // 32121
+  { teju_literal4(0xf3afcaafe5139848, 0xdb2adb74d035f614, 0xf3c625537a313c22, 0x8f34abf7c428c021), teju_literal4(0xf7763a6b65c5f6c1, 0xa405a5c562cd9241, 0x7053b861c5979c57, 0x0a01ac418505f17b) }, // 32057
+  { teju_literal4(0x3b183abfc6a40883, 0xee2dd6cb8d3c8526, 0xba99d42ea4f02506, 0x51021ebe96fc16a6), teju_literal4(0xbbfbb5ef9e88e1cc, 0x689674545b1ce1a1, 0x1568caa0418686ed, 0x4505e37c5ea36894) }, // 31993
+  { teju_literal4(0xda7cf7f58be2492c, 0x1375a45a1cbcb753, 0x08028cfb165333c9, 0x1d41c813649b7c49), teju_literal4(0x8eccf4d6b01d2611, 0x202207be02de01a3, 0xc8a01930c25f8622, 0x08167a9d3fde9919) }, // 31929
+  { teju_literal4(0xbf677e9b3f26d919, 0x4a059cc2184d91d2, 0xdb67705c76adfa8f, 0xcc5396b9a6c0365c), teju_literal4(0xd8f4a6231dc4e374, 0x7cffea489a572abe, 0x92bee55b5afbf25f, 0x03ff368a761fa410) }, // 31865
+  { teju_literal4(0x8d8061a651ccd281, 0x508838a97ac43b0b, 0x2f5ff2bc17b1d478, 0x7fa096eb4c4576bd), teju_literal4(0xa4cf3318d3b275f9, 0xe5d540acbaf620a9, 0x405dcc00d101d318, 0x54da6c85e943f32f) }, // 31801
+  { teju_literal4(0x510bbda8388d5735, 0x79803520809013ab, 0xe0c5781a32ab479e, 0x52b00bfa55d11ef0), teju_literal4(0xfa64b3fafe0c3f3a, 0xac232f19173b75b1, 0x250d0dac2de66554, 0x705f47a4d4da2b42) }, // 31737
+  { teju_literal4(0xffa97254c8932fc7, 0x582cc8dc8d999885, 0x6c29bff4b2c2d93c, 0xae5cba19e423f9d7), teju_literal4(0xbe35ce3324e47ee0, 0x7004709ecfbc27e8, 0x3bda5d9213d3b60c, 0xc91fa5fee7e9136a) }, // 31673
+  { teju_literal4(0x9f0b34c96cb2e2bd, 0x990086060b7c45e1, 0xe62ce19c8e920e37, 0xae61edfd27887520), teju_literal4(0x907e06bae950532a, 0xbf543ae97e20513c, 0x8e21402e2ce8d587, 0x9af71c53917daeb7) }, // 31609
+  { teju_literal4(0xa490fda471224131, 0x4b44e34422db719a, 0xd891f1b89f7a69cd, 0x2ca6850cdc2df7a6), teju_literal4(0xdb869baba71f0e00, 0xac1ae8aa28734b8d, 0x5915de6c32576509, 0xc1b44e0e575740b7) }, // 31545
+  { teju_literal4(0x6c4d310cbbadc4f6, 0xebd1a38cef8e524e, 0x732bd530ab92f554, 0x0ff45395918a55df), teju_literal4(0xa6c303e5ceb53252, 0x7c96bb42bae2484e, 0x1ce5d441ab765b29, 0x0ed4d4b6750865a1) }, // 31481
+  { teju_literal4(0x2975eb24652ed744, 0x74164a6ee952099f, 0x1d23be74ae534d6e, 0xc65e9ffe9b4e00a7), teju_literal4(0xfd5c117f982d55c2, 0xcfd882ebb88b50e8, 0x2d824c91c01c751d, 0x913b1c74d7ca0166) }, // 31417
+  { teju_literal4(0xad7f9733f62ad3f7, 0x9150b01acea030e3, 0x047f2c8709bcbfd4, 0x340cfc42050b3acb), teju_literal4(0xc076a76247ad590a, 0xb2f71379f201320c, 0xa6c8d23a94bd351b, 0xdd3bf6885ee704a4) }, // 31353
+  { teju_literal4(0x795973d49fe9487b, 0xabe6ba9244d216c0, 0xa66ede1d2d110a77, 0x8e5ee9afd4382db8), teju_literal4(0x923439fcf0cfe689, 0xc5a628f23ea45e82, 0x05731c8cd5dfb07b, 0x6e3de8216f5a2fc0) }, // 31289
+  { teju_literal4(0x01a2f47bc92104ce, 0x44d8348b43fd5f71, 0xd063bb462942e8d6, 0xfed3421634bd0b7a), teju_literal4(0xde205c96e6226b6f, 0x9b6b3ed0dae5d69f, 0x3ee8d37970b0e35c, 0xaaa339d9bbbb861e) }, // 31225
+  { teju_literal4(0x5679e1b9b03803a8, 0x598c75d012d86c30, 0xfbf3cb006806e94d, 0x39069390dcd7a5e3), teju_literal4(0xa8bcc07be1890b99, 0xe9d835388fdf147c, 0x3edc1212019beacf, 0x4b750c9d4917922e) }, // 31161
+  { teju_literal4(0x2c5a06854fb7d485, 0x64de75104edc0386, 0xd509c4f3cd4297fa, 0x9df5b5fcdfbaca14), teju_literal4(0x802e36f7bcba58fc, 0xf7912c556b11e7a5, 0x2dc01e216fd543a9, 0x8e64b7047530a611) }, // 31097
+  { teju_literal4(0xc9dba7cd9e1961a4, 0xb728a9e40d78c149, 0x0089ef1a4e64614a, 0xd553be66941c6ac9), teju_literal4(0xc2be55f84e22b9e1, 0x7fd8b17db044f200, 0xe78b308e91ee5a20, 0x7f9116395fa4c035) }, // 31033
+  { teju_literal4(0x759169456daf2731, 0x92d8007faac5bd25, 0x54c6344ea5b90e54, 0x981085633f670971), teju_literal4(0x93ef9e2bcee414db, 0xfcedfd410a1c7172, 0x84d7fc5cf5c488c3, 0x1c224cc1ba2f151f) }, // 30969
+  { teju_literal4(0xccea4c03b6a2c0a5, 0x41fcf8ae063c2d21, 0xd4e8d6923e0e97e5, 0x521e3b818e6f32d8), teju_literal4(0xe0c200883d41d1f6, 0x79cd892a5030317e, 0xd94134736451917f, 0x981916d4c07c3caa) }, // 30905
+  { teju_literal4(0xfe4718cfbae58fd3, 0x26285584ef3bb351, 0xcb3c91209875c776, 0x16118c2853f2413f), teju_literal4(0xaabc7acff442cc1a, 0xca4efaf73a4d46a9, 0x7e123fc13b5e83c6, 0xcebad5072d5b3048) }, // 30841
+  { teju_literal4(0x0abb3af3f583a4d9, 0x7e2efb15c05a99f0, 0x11e7e03ac330dec9, 0x3be71a301f93e8cf), teju_literal4(0x81b2f24955cf8ddd, 0x99100b248c04d7ca, 0x6a8d640db13183ef, 0x133cbf13bdbf2a79) }, // 30777
+  { teju_literal4(0x5102dc451e79cc53, 0x610cd56c8af8deb8, 0x72c0ce95cd5cc60d, 0x479a4e951433fb9e), teju_literal4(0xc50ceeae9cbfdd52, 0x1f8ec670a9381330, 0x3568973b2f846d7a, 0xa31d1bfdeb2ba4e7) }, // 30713
+  { teju_literal4(0xf2306a8973b4a15d, 0xa70b87b5a04b1197, 0x178568f2e7cfa26f, 0x9cc266e8907abfc4), teju_literal4(0x95b04305bb21cc0d, 0x5b8a185c43c2f623, 0xa7b45a9b5968e65c, 0x3e48076f160ee7d9) }, // 30649
+  { teju_literal4(0x7926b49520bd2285, 0x58e802ff20572cd3, 0x2babc0138168797e, 0x3efef593101f5e30), teju_literal4(0xe36b9f6abee84136, 0x374c1fa541cda731, 0x44acabc8c60ed7cc, 0xfb4fab702e527ddd) }, // 30585
+  { teju_literal4(0xc9b2bdf22a8a801c, 0x07c971a7e294404d, 0xcd4645539d81371a, 0x91479e13d29fc3ad), teju_literal4(0xacc2450d63f48cde, 0xaacd9d4b3fff615c, 0x12bfd0f1686638f7, 0x575f04f3952ee1df) }, // 30521
+  { teju_literal4(0x13abb883eb8c7784, 0xa2d1330557f51da2, 0x2922c17e2b1c4724, 0x5f4ad0a32def4d15), teju_literal4(0x833c4881fa6a21c2, 0xef684769720f4d53, 0xbe0757c98900d627, 0x03013b0e14dd4a1a) }, // 30457
+  { teju_literal4(0xb5db5e24b2a8ea5d, 0x21ca544dda71b179, 0x9da7853c47b3ae6d, 0xc765dbde05ee31c0), teju_literal4(0xc762867d719b726e, 0xa003193204b3f168, 0xad0b21fe7240cd96, 0xae9b11f0e4b05c40) }, // 30393
+  { teju_literal4(0xd5be4ff60612a440, 0x5d5f630dfce692ab, 0x942d098c9662f9b7, 0x25ee1d14dc77c5f3), teju_literal4(0x97763878ab8376ae, 0x5c6480e64d8f417d, 0x151ea5633487a7fb, 0x1627aea500a57d0b) }, // 30329
+  { teju_literal4(0xffbde3e15e16f87c, 0xcd2a4c04fda07dc8, 0x7968519c1b32dc12, 0x13eda858a88d7322), teju_literal4(0xe61d517206e0b494, 0x8be483b068b73e3f, 0xc07025c988556ce6, 0x93c677b17e5403b3) }, // 30265
+  { teju_literal4(0x0a0c640359b5b209, 0xf56e947aa6b2311e, 0x143145fdfe175ba8, 0x25af6725991b3eb8), teju_literal4(0xaece3196a7d46652, 0x837341a86898af32, 0xa3908c1227e147b6, 0x133d7b1829998b7c) }, // 30201
+  { teju_literal4(0x7e5a09e00ccd2427, 0x426203b4b3e42e8c, 0x84a35ac1b55d92e4, 0x0ffcbc42fa37394c), teju_literal4(0x84ca4798e948316d, 0x8b7063e75166e447, 0x8c38fccf13900cad, 0x6c7e8ad2fa1482fd) }, // 30137
+  { teju_literal4(0x1adbfaccebb03d91, 0x44c5df1835159b6d, 0x0e9ef21b983d0285, 0x891d04c798232682), teju_literal4(0xc9bf329ca3026322, 0xdbafb81aa08996b2, 0x2623c044aaa5c257, 0x3e9de9441e06fbd4) }, // 30073
+  { teju_literal4(0x76778ef85dcc163f, 0x8d71b11f1709a2f5, 0xad7e994f936d24f9, 0x4978ecd228e2fbff), teju_literal4(0x99418ea2e533b724, 0xa24f2952839a0e21, 0xe3acb57f227fba4c, 0xbafba48db2b0a63e) }, // 30009
+  { teju_literal4(0x40ef86239bb12beb, 0x34bb122ba9d15226, 0xe1e19bc88fbdf601, 0x47ace195eefae5b0), teju_literal4(0xe8d72f1b16514865, 0xfb0baf2d66856f07, 0x4fcb51a22f530f06, 0x1620cf57470743f6) }, // 29945
+  { teju_literal4(0xf3e4327d9adb0ee1, 0xc3df307767bae0a0, 0xd47408113141d4f0, 0xf7a5a96d5ae7ea51), teju_literal4(0xb0e05305f857fb0c, 0xf9f6d4ded71c2aa0, 0x78b41ade740ee0b3, 0x75ec8766546ddd08) }, // 29881
+  { teju_literal4(0xafbf7e569ed0248a, 0xf44729b5943e51ed, 0x58dabb1728a462ff, 0x79d8d2db08e9a11b), teju_literal4(0x865cfdafbbc3669e, 0xdaa69c4324449b10, 0x9d35c6020ac4a223, 0xd99f2b06cbc7a10e) }, // 29817
+  { teju_literal4(0xc08555ce1e9f09fb, 0xa2da4d13abd23979, 0xf9e8560e87ee0aef, 0x1c4f27ddca04284a), teju_literal4(0xcc2308846054a752, 0x2a60016baf3f56d8, 0xe69304762454b2da, 0x87ccc7cd8eb11ca1) }, // 29753
+  { teju_literal4(0x3d4b89a06b2cd368, 0x3bd8c114ae338963, 0x28436b04bcd542f9, 0xbf5621a94033064e), teju_literal4(0x9b1255d38f0f3ebc, 0xeb22452ce9cb74f0, 0x924fed1baae8ff3f, 0x1fdbe92d8e97aa6e) }, // 29689
+  { teju_literal4(0xf946f3eb912387c3, 0x447a214621c55042, 0x874bdcf89a5e4f41, 0x1187358c99e3cea2), teju_literal4(0xeb99512d3251816e, 0xcdeb52a361b35c0b, 0x8eecf71d8f9bf7f7, 0x85f4593e39fcdd89) }, // 29625
+  { teju_literal4(0x3d1ab08e2cda9efa, 0x47c8afcad0a451b8, 0xd4fd93ec973a3b20, 0xb060cc71ee942d04), teju_literal4(0xb2f8bc2df84acba4, 0x2dae00d376d5acd4, 0x4c6a806553127c37, 0xf9cceb6a87d11db8) }, // 29561
+  { teju_literal4(0x2db6ec25c3ad3d05, 0xd75dc97ec28ee415, 0x3993ddf58c5550d1, 0x3a18fc29111c199b), teju_literal4(0x87f47912e6433ac3, 0x0c80fee9b3c8f1f7, 0x1c2fd467cdadbfb1, 0x036e99243431a0b5) }, // 29497
+  { teju_literal4(0xa82963906914a3cc, 0x3c9774957b849597, 0xa9e1808e2a73c7de, 0x6cd0f018381424c5), teju_literal4(0xce8e1dedf52afc65, 0x4e083116424ab525, 0x46814737471b3c2e, 0x61dbb100fe99b1c1) }, // 29433
+  { teju_literal4(0xd77c3bcdaea47c27, 0xdb8dad6e3a3947a2, 0x7626229fb2216a24, 0xf7f01b80581635f1), teju_literal4(0x9ce89e8b45e2f44c, 0xa1bb0b3f4829eb1f, 0x4031886d93400d0a, 0x779ebe7c6984b697) }, // 29369
+  { teju_literal4(0xab0ee80d7ac71539, 0x107af6a7c3476cd8, 0x70589d147476ca8f, 0x53c4865694216697), teju_literal4(0xee63d0bac5239df0, 0xed324a8627a5116d, 0x506e8153dfab0fb6, 0x36ef2984a8c453f6) }, // 29305
+  { teju_literal4(0xa12244e75bd9452b, 0xc9d73bd3752c2967, 0xe30312e22cf87070, 0x8543459d1dcdb508), teju_literal4(0xb517801a5fe5547f, 0x4052d14651fab293, 0x40553200b0c318e1, 0x6e2070d35cf75dd4) }, // 29241
+  { teju_literal4(0xa6a5b1837e68ad50, 0x9bb083d89e40dada, 0x4aa15c7f396f0d0b, 0x9bfcd09f093c7827), teju_literal4(0x8990c83a3a34c349, 0x1775fec765bfdaba, 0xc8faa57892a291f6, 0x1787ea4220c67423) }, // 29177
+  { teju_literal4(0x0891f2b95996ee5f, 0x0053be5a6e01a36f, 0x73c44adb87517722, 0xd106a9ba5360729d), teju_literal4(0xd10088d48ecc6f14, 0x937972431dd5cda6, 0xfbe8a15dcf41e508, 0xb4c499a990bbf833) }, // 29113
+  { teju_literal4(0x1be3e75daeec2fd3, 0x26d91d1d93987e2f, 0x3e6990f71c9430a2, 0x655fef6c5e8a92c2), teju_literal4(0x9ec4797cb26badd7, 0xf10782d4e47d4a3f, 0xe5013021a115ea87, 0x035e4d891ada1292) }, // 29049
+  { teju_literal4(0xbd9ca440e2b9b84c, 0xc793d97ab65f820f, 0xfcd57bd6daf1c63c, 0x45006bc011bf38b1), teju_literal4(0xf136c7224218ef74, 0x4839419d95f4ed15, 0xba1daca6c6775d41, 0xffacb685687eb306) }, // 28985
+  { teju_literal4(0x9927e20db0fd3f46, 0x1055a6e4fc63572b, 0x0122d819a4587145, 0x22e6dc40b2c2bedb), teju_literal4(0xb73cb210a9eb08c4, 0xd0d3fe4b0620adc3, 0x5a039a2fd4b59aed, 0x3f00b4fc9fd98443) }, // 28921
+  { teju_literal4(0xcde38cc2ec5e8c46, 0x66eb34dda6b69c84, 0x54d740b5c26063cc, 0x2df11553a020aa04), teju_literal4(0x8b31f9c9698ca501, 0xbdc4953dc2aa79c7, 0xb5a3b516ef2f3e4a, 0xbcdb5bdfc7b83191) }, // 28857
+  { teju_literal4(0xb40a781e3d95d113, 0x005709262f682ada, 0xe4dba1683d0c08c0, 0x013cb46e788d84a9), teju_literal4(0xd37a5f7603faba3d, 0x7e95b82a5be8d5ab, 0xbff96e0a572f4aad, 0xa1d44ea88e148dd7) }, // 28793
+  { teju_literal4(0xae39e9396b16c1d4, 0xf8a08e1288695542, 0xb5f28f6fd42b8c47, 0xf84a9926b7c5b9a4), teju_literal4(0xa0a5f78d211cd0a7, 0xa51814106a54553b, 0x15337a3e6b5bfd66, 0x9b6129b76e0dacbf) }, // 28729
+  { teju_literal4(0xea78ea47541cafd1, 0x8c61c50c47ab26b3, 0x932bdda855c5e7a4, 0xd07e36555e21b0ba), teju_literal4(0xf4124e0f0c2954b7, 0xec04d530a58c71b0, 0x9e372a37a673dfc1, 0xbf6d6e977870d5ac) }, // 28665
+  { teju_literal4(0xb906c1ca1c96a770, 0x54dc1d4f9510e6a0, 0xdb1a00ed44fbd517, 0x3943c02dc0c0c92d), teju_literal4(0xb9686590c2d54ff3, 0xd729397434800334, 0x3b5d10ce4250b349, 0x0c9d74dec1b57945) }, // 28601
+  { teju_literal4(0x34e5e75bc57e6d94, 0xb2d43c8ce6c0413d, 0x25d69604c248e1d9, 0xafafcd257abe5959), teju_literal4(0x8cd81c908bd7d9dd, 0x1ab3ebde0c6a3435, 0x8fbe20bab5d9e3c4, 0xc17acf8fa78f9109) }, // 28537
+  { teju_literal4(0xdc7f18762472cf80, 0xd3dd43b6220e9334, 0xb3bc5f785074427a, 0xbf2f519fd127846f), teju_literal4(0xd5fbb8539f1c92d6, 0x737c9dd0268d9756, 0xbce76784eb706518, 0x2f80869713edf9af) }, // 28473
+  { teju_literal4(0x611a1507eebefb72, 0x25159fd8dbe321ac, 0x543595e74d6992ff, 0xb1ea8e25e381b14a), teju_literal4(0xa28d29d51bb33b60, 0xfad11e146f6247c0, 0x230e640f2aedf4f4, 0x666ad2038dfeb201) }, // 28409
+  { teju_literal4(0x945656ed58c35b99, 0xea23daaf5c1e40a8, 0x1af1d863b0a8a4e9, 0x1e1d1d088e891a0e), teju_literal4(0xf6f67f7a5f4603c3, 0xedc88b15701c3e20, 0x51b708d22fcdbefa, 0xe268fd48a805d387) }, // 28345
+  { teju_literal4(0x5a5f38ed42e2de02, 0x351dcefa35bc512a, 0xaad240b2cfcbc44b, 0xa02f27100d486260), teju_literal4(0xbb9aae55ba11be58, 0x68aadd77fe1c4fa2, 0x3a853d3b537a3ce6, 0x9152fb21cac33100) }, // 28281
+  { teju_literal4(0xa007d40b5f395ebd, 0xe5a35f15d74fbf5f, 0x67bb791113415203, 0x6142e5db06e76a7c), teju_literal4(0x8e833f8ca4e00287, 0x5acad4bec6255043, 0xf59299b506137cf6, 0xc02f127e925417c0) }, // 28217
+  { teju_literal4(0xea29653195df0488, 0x555a60872f20dfa0, 0x7dafc34eccf0370a, 0x323a0bfbd8acab75), teju_literal4(0xd884aa32eacd0e96, 0x633c7435425a8c7e, 0x178256a5c357a479, 0xa49bae12fac6fa6e) }, // 28153
+  { teju_literal4(0xfe29f997d200f5da, 0x44671d7e7ed9ee89, 0xcbeb9eb7a12aa992, 0x2a836e65a82a4a6c), teju_literal4(0xa47a21a10499ee09, 0x4e1d6f00f976d326, 0x0298b5a3e3ee302b, 0xe741e3aea38a595d) }, // 28089
+  { teju_literal4(0x5b458739a1cc372a, 0x3bec628d78d25b6f, 0xf9f6f44a64fe72f4, 0xee856fee82d4061c), teju_literal4(0xf9e375ac3c6fece8, 0xb905f32ff2cd845f, 0x345a9df19e638569, 0x117fe308017ee7ce) }, // 28025
+  { teju_literal4(0x376f754cee0c1a0e, 0x76d064391f517ea7, 0x184de90fa3b6100a, 0xae4edbfdcb3173b9), teju_literal4(0xbdd3a0567559d36a, 0x8d3b15fe58c1ed51, 0x8ba7f80150a9eb65, 0x25c8ae27200142ec) }, // 27961
+  { teju_literal4(0x4e2b6eb7adad1c7c, 0x8e9ecfe3bc9334c8, 0xa9a2b2245e89b72d, 0xb4e1e4d23142d32c), teju_literal4(0x903371e82ce80bb9, 0x4d158a3f2af929fa, 0x02452b306230d28b, 0xc5bb06d035f138e9) }, // 27897
+  { teju_literal4(0xa8ce93ef94b1c6ba, 0xeef1ac2506c55e9e, 0x08561003d446bcdf, 0xbb276b324592a849), teju_literal4(0xdb154c1e80d768ab, 0x566dca7c497c935a, 0xe534062a7526be99, 0x01745661600b6727) }, // 27833
+  { teju_literal4(0x82bbc38dbe918bad, 0x89f30058eebd84fb, 0xad92ab6fd6b944be, 0x3b59e7417f8c3e35), teju_literal4(0xa66cf071b425f468, 0xf5fafa4770574b9d, 0x7703c19fe9a32a98, 0x629f60e31b07c15f) }, // 27769
+  { teju_literal4(0x3aa400f8b6f008b2, 0xbfcad89bbdec9bd9, 0x98c42542e8cb7e92, 0x4853fb8455835e9a), teju_literal4(0xfcd94b3c589a1898, 0x0aea46266d76e4fb, 0x54edfc9a2d57ff91, 0xc56680e9a1306558) }, // 27705
+  { teju_literal4(0xac9d80b665119897, 0xd7509fea47770f8b, 0xd16c7799af97cfb2, 0x0a1c570c1fccdbf8), teju_literal4(0xc0134fc6662a9c3b, 0x2217ef4af05ab395, 0xe39cc36f2f8b108a, 0x54ad843a41974b73) }, // 27641
+  { teju_literal4(0x6d8a1f93199f561e, 0xe725904df51a0794, 0x19f6fafee8be1e43, 0x53c6f182459dc79d), teju_literal4(0x91e8c2fb9a85fd90, 0xfb310eaae711355e, 0x9039cfccb360476f, 0x3a6693515fc4ff0d) }, // 27577
+  { teju_literal4(0xfd09caaa30a1a842, 0x2c5ff00a3c5a4c29, 0x2f35aed69e4a48d3, 0x640e28538cf7a3b9), teju_literal4(0xddadb566dba67de1, 0x88a277dce0543f1f, 0xc957d27e4a14f3c7, 0x51e20135bfe0ea82) }, // 27513
+  { teju_literal4(0x5dbd2ad0a247fcb7, 0x74c15893319d9b14, 0x3780b839beb61779, 0xf4d38a649e438386), teju_literal4(0xa865a7fd17af27fc, 0x23b4ec07f065ffed, 0xa4e1e9447a352197, 0x1a5cefeb901cfd05) }, // 27449
+  { teju_literal4(0x54ba16732a1854fc, 0xdd29d636659453f0, 0x961e4dc9a0e8afe4, 0xed75eb59b6c9b6d1), teju_literal4(0xffd81b130e607b6f, 0xcf800e6101a68868, 0x999e37d80dbaa1a0, 0xd54eff2b90809f38) }, // 27385
+  { teju_literal4(0xb1a008ff517cd8ed, 0xba65bbb7f8a3e40a, 0x4c36f7420ffd6eff, 0xf5887e8b81fbcff2), teju_literal4(0xc259d1164162ab62, 0x7ceb9d0a56fcb169, 0x487f5312c8bc60fa, 0x771b6633daa0da98) }, // 27321
+  { teju_literal4(0x08b19f76d3641b72, 0xd73ca58f6dc7b91a, 0x49172755092e8005, 0x1dbf94e8d32822c7), teju_literal4(0x93a3424dee1ed9f1, 0xed46d4a9cda1221c, 0xdf8913eee8fa6b2a, 0x3cc30f8fb0d0f0d4) }, // 27257
+  { teju_literal4(0x13475190ec002927, 0x260efb84d8b7dd42, 0x5bb2d10ab97cd5af, 0x89638483e4b302aa), teju_literal4(0xe04dfda32a2f6fe6, 0x6cf1f35b10258555, 0x35a301aa75235321, 0x88344acba0715df3) }, // 27193
+  { teju_literal4(0xefda136e8a3125ca, 0xe873f35ac1aeb5c9, 0xbe401924e6bdf1c5, 0x486a0980ab1b45e9), teju_literal4(0xaa645a2ed28b6f8e, 0xdf306e71150b4c46, 0x807c215dd07477e3, 0xf781c83a859a481e) }, // 27129
+  { teju_literal4(0xf470f13eac5cf790, 0xc8eb8d2dece0df36, 0xa3f28d7d5c64a8b3, 0x800e89e87a156d58), teju_literal4(0x81700035294deac4, 0x0c5de50a055641d6, 0x66d1ed693617e4fe, 0xbcdc6ff6c11017e1) }, // 27065
+  { teju_literal4(0xca3dafd7ddfaabd1, 0xb1a6ddf8c59835f2, 0x022156518fd83c5a, 0x76fc1b964b083972), teju_literal4(0xc4a738f4b90ceb6e, 0xc82aa7939fb40432, 0x77b08078ecba46e6, 0x8bd6b6b65c2ebd93) }, // 27001
+  { teju_literal4(0x147a0dcbd4f4f4a7, 0xb4d084a04881b92a, 0xa9448bab35517117, 0x8e9310cce2254ecc), teju_literal4(0x9562ff953f097dc4, 0xb3c08408e0d1d2e9, 0x44feb9cf2537da34, 0x63864f84a311ffe2) }, // 26937
+  { teju_literal4(0x1640524d59c14271, 0x8bf4a860a6c2201c, 0xa36767fd43ce5cd9, 0x2bc95b0bbbb5484e), teju_literal4(0xe2f63cb2265ef5e0, 0x30c12f3fb9fab4b3, 0x6065644ffa9c768a, 0x7e8d5bac8fac1ae6) }, // 26873
+  { teju_literal4(0xe20b3444114c5188, 0x5470e61ac380fb92, 0xe3d992511ae78ab9, 0x30b19015913f0c5b), teju_literal4(0xac691928e0f233c2, 0xd740913332acb37e, 0x6a4fdce2802b629c, 0xa0ab04df82857174) }, // 26809
+  { teju_literal4(0x3cc7da36c736aa49, 0x66cf170d5b5efbce, 0xb969c8ac1e5c6e4a, 0x3b03530996abed07), teju_literal4(0x82f88b6755eda60e, 0x369451e01ddea836, 0x3813a1f1cbaeee6e, 0xc030985386180a1e) }, // 26745
+  { teju_literal4(0x93102707ea2e5530, 0x1094f0c068fadb7c, 0xa6207d7f9b5d61fa, 0x2e63518c2e8d40b3), teju_literal4(0xc6fb9c4f385ee495, 0x9aa2df282cce0f04, 0x0c634643410f065d, 0x72d2183589304135) }, // 26681
+  { teju_literal4(0xd705857644589373, 0x7926afe7d9b78cae, 0x55257cf5d6a58d19, 0x23ef71c63df9d3c7), teju_literal4(0x97280ab74a5d87f2, 0x492e7e9af22567ad, 0x58a370f6a223d300, 0x87558687507f2a47) }, // 26617
+  { teju_literal4(0x255bd78692dce646, 0x8b0b275d1c7efc54, 0xd7b925c03f7ea72b, 0xf79ada08ba9aa675), teju_literal4(0xe5a68abaee10f763, 0xf3283c91d92b1ef7, 0x1ff4b5a65408f87e, 0x96cf4e2b902d3481) }, // 26553
+  { teju_literal4(0xf91bb62f745a85a7, 0xe4f5f1172eec020d, 0x4d80977bdd523150, 0x4ae43a153950fc2f), teju_literal4(0xae73f7443ccdd113, 0x4e38e8e8ccf64b72, 0x96b9cd814ad53f13, 0x883c0602231a4294) }, // 26489
+  { teju_literal4(0xfc3d5238742632bf, 0x32fd6449451f9fb5, 0x71bd644b6e526da2, 0x5e472c5468e79b61), teju_literal4(0x8485bd101666437f, 0x504c88bb9cd22c4a, 0x7975ad3c12becb45, 0x2e9ef150b27cc017) }, // 26425
+  { teju_literal4(0xda9869fe741f7ebe, 0xd6f780ea3f50fbc5, 0x10617512990baf9d, 0x1f3c83bdb6a0a596), teju_literal4(0xc9571052a1f1226d, 0xcb00e822cefb4f86, 0x1053de4c2702e4dc, 0x507d35e51857eef0) }, // 26361
+  { teju_literal4(0xe6552d02d1127eb8, 0x543c756a23040c73, 0xcb7ff4549fe03c48, 0x34b24104e09fb3a1), teju_literal4(0x98f273ca0373582a, 0x6429368dea2ecd18, 0x2e41a5aecd9845db, 0xe3f32b694c5e7b26) }, // 26297
+  { teju_literal4(0xf969040f2c1e2166, 0x06478ef44d7c4270, 0xadd81d5cb08e00b0, 0x96b777107f7f3d30), teju_literal4(0xe85f002dde9a25eb, 0xbc755303cd3f02e3, 0x0622144f0d4f1dbf, 0x81d9a91f76f5d9f0) }, // 26233
+  { teju_literal4(0x59822d6ff87ef5bc, 0x9dce907e1a3ab1a9, 0x773b7b102f72abda, 0xfdacddf9ffd228e5), teju_literal4(0xb08507118480e175, 0x8dfd0f52416d5312, 0x282b2624905faeaa, 0xb77d3ff4a0a8aa1a) }, // 26169
+  { teju_literal4(0xd01422497c7ca2d5, 0x77592c9ed40a922e, 0x2e24c65940180158, 0xadcfdeacd655dd48), teju_literal4(0x8617a349b8cd9af3, 0x9e0fc83a4d6057bd, 0x5c11d3dda4dbb6c3, 0xc953c9285649ec32) }, // 26105
+  { teju_literal4(0x5ec5749aaa355cdd, 0xe9505c2af3ce13eb, 0x40730f4a17d0dc15, 0x9fa8b0583e9a180a), teju_literal4(0xcbb9aa6c10387ab4, 0xaadce1654c4aa27f, 0xd1990dad135e486c, 0x38027b2e9fda85e6) }, // 26041
+  { teju_literal4(0x93cc09cdf6e4466c, 0xa6e5b3975224b371, 0x5380312a54f2f658, 0x0be80886cb59a245), teju_literal4(0x9ac24b14261a46e4, 0x6d006fd9d0ba9c2b, 0x197d07779265edb8, 0x8eac3620fd4d321e) }, // 25977
+  { teju_literal4(0x9ea41c1600ee5215, 0x2e8792aeb0768622, 0x4926f559d4570360, 0x7c01f5e05e405909), teju_literal4(0xeb1fb5c572eb604a, 0x1c22264be9705291, 0x4c3a46f14f5d2114, 0xe02f85c99e9fe2a7) }, // 25913
+  { teju_literal4(0x0c508f54052680c9, 0xbaefd08e19ce9f71, 0x0ca06d36e0e7beff, 0x3a1f536d495743c7), teju_literal4(0xb29c5b59a3a54973, 0xa302648d3577529b, 0x4bacb591dcb86ef6, 0x2811da971a58b4a8) }, // 25849
+  { teju_literal4(0x2ded02e75aba39f1, 0x31f408a23060c209, 0xfb6cf41e54ff91eb, 0x7057ec05f5d71219), teju_literal4(0x87ae4c5950287e57, 0x0ef67793bb2978a5, 0x459d48c6e0314b02, 0xd18949e67cb62996) }, // 25785
+  { teju_literal4(0x4604306d5384ea0f, 0xce9394feebf8b946, 0x890bc4d17be6fa55, 0x3cb9f04102024615), teju_literal4(0xce23804998470a9d, 0x63908117fd71da8e, 0x018ddc84729826fb, 0x71d8a00c4164cf1f) }, // 25721
+  { teju_literal4(0x76a30fe70e36be9d, 0xf25b63ef1c2c61e8, 0x7ef29fa768b0685b, 0xbdbed7fd73d48047), teju_literal4(0x9c97a10dca8a479a, 0x099a1391200ba93d, 0xfcb4c98c42345613, 0x0bbae89d4dc3edf1) }, // 25657
+  { teju_literal4(0x9933b541027e4c3b, 0x084a2f2337a0b620, 0x034de1e0156b78ba, 0x5e348759564a7ff1), teju_literal4(0xede8c4872456c33d, 0x0878d55cdc68fde5, 0x12b51a6a2f333d54, 0xf5d76b22a47aee7f) }, // 25593
+  { teju_literal4(0x7fcfaf601730f9c3, 0x11f04ae0806edce9, 0x7d1c4887c5f89678, 0x54339af6f5aff9ef), teju_literal4(0xb4ba071e7dcb0694, 0x447201f9ebfd65fd, 0x43cb1f405d7df58c, 0x45f1c008e2f6a1d6) }, // 25529
+  { teju_literal4(0xdd83036c775057c7, 0x9b691382464f0876, 0x1249025509ccaebc, 0xc024804d74eec2f1), teju_literal4(0x8949c6af361f705f, 0x314cb07a801892f8, 0x2923127e993260e4, 0x1661197a04cb2b25) }, // 25465
+  { teju_literal4(0x8f2ea54e326cad77, 0x0c43d44ff37fab4c, 0xd4016f164d64e8ad, 0x45a318401efd6c95), teju_literal4(0xd094a7db0edbd4e2, 0xdbdf7e865199976d, 0x92cb1938de429df5, 0x6994e3b343c99574) }, // 25401
+  { teju_literal4(0x4a133355eb5a26d9, 0x5cb56d1261829db0, 0x6f22684d289071fc, 0x0bba53f2b729ca39), teju_literal4(0x9e728660fb1635f8, 0xa0621b764b6dbf61, 0xfc869ac12ce1bf2b, 0x6340ae3d0e908b77) }, // 25337
+  { teju_literal4(0xf19e6253f1b99ad3, 0x814bc729d4d6a4d3, 0x2614ffb9d06147a4, 0xf46d791f95f99164), teju_literal4(0xf0ba45c44dfe622d, 0x01005f920b11e566, 0x57f6bb0ba2bf34fa, 0x0fe912675c75a39d) }, // 25273
+  { teju_literal4(0xfffdfd984b506c19, 0xf5e9245391fb8af3, 0x6ce465847e1733b0, 0x73549d84699ccceb), teju_literal4(0xb6de1d9b9b3ccf0e, 0x6c0ca64ec4dff2aa, 0xc9948e05d864654a, 0x0ade08bd61645328) }, // 25209
+  { teju_literal4(0x92be55d6561d4d55, 0x9838e7c90eb4873a, 0x47963771cfe922ea, 0x1272bacd88271051), teju_literal4(0x8aea20e78e3cb6d9, 0xe7e8731d0c5bef93, 0x3c4cecd55b9d64e5, 0x405cbeac819ff86b) }, // 25145
+  { teju_literal4(0x950cd248fbdda98f, 0xc43d7a9718cf6c78, 0x0aef5c505af302c4, 0x513719f9ded21f26), teju_literal4(0xd30d3752cfc7ffcd, 0x14b84c7895cc352f, 0xb516a2189ccfcda8, 0x71eeb8847bc00d72) }, // 25081
+  { teju_literal4(0xf30dc9565686947b, 0x9f176e5f84ec89a6, 0x4399ad936c47fa8e, 0x3d23abf0d5a88fe8), teju_literal4(0xa0530bea4ba41eb5, 0x60b904e42672113b, 0x0bcfc181eff7de88, 0xffa4a1e3e9bc0605) }, // 25017
+  { teju_literal4(0x01c6308801bb0e14, 0x92459227f16b70f6, 0xb7b0d4a708eb71a9, 0x22f63107aa660f7c), teju_literal4(0xf394531b12f4bb59, 0x6500306399edcd94, 0x57f95add3c9b8293, 0xc746a64e693c7da4) }, // 24953
+  { teju_literal4(0xb68afb4c519f4d93, 0x8cff0390fa661fca, 0x139256240f14003e, 0x7030e43f52fcbd0d), teju_literal4(0xb908b246d7d0a529, 0xd7ca702d96d7ada3, 0xb38a581543d6f1f4, 0x50c49ac20c8476af) }, // 24889
+  { teju_literal4(0x917c14fd8420198e, 0x2ed87d63e7065451, 0x4d73c9a6d5d8f272, 0xb7bf3884b06fa668), teju_literal4(0x8c8f69cacab8717f, 0x6ba3ba02c165c6a5, 0x80ba4c47daacace9, 0xd672cf142dfdf724) }, // 24825
+  { teju_literal4(0x26b71490441eeb3b, 0x90856d088fc35590, 0xbe15a0610375217b, 0x52030549f47f0340), teju_literal4(0xd58d452687b0c793, 0x0ba4667b48672cdb, 0x278b6732f7f79692, 0x6da37c8f647f4d37) }, // 24761
+  { teju_literal4(0x48936da4e7e3fe41, 0xf3c54e31a9ede525, 0x88bf4b5baedc705a, 0x59f1d1c84a917f42), teju_literal4(0xa23942b972f0e4cd, 0xdcb2e015a61a5910, 0x441c5b77d5812d7e, 0x51e194e23260dde7) }, // 24697
+  { teju_literal4(0x6f314c7c43b792fd, 0xa4ca4e1388e41d1a, 0x4b33326115cb5699, 0xab8dc1db7a04473b), teju_literal4(0xf677067747171330, 0x45fd2020742edcfd, 0xedbe1368180ad0eb, 0x990a58b4378b2915) }, // 24633
+  { teju_literal4(0x3372759de2b82c31, 0x302ce26ea2228d7b, 0x671615107f6e7dfb, 0xc41ad305255fb8b4), teju_literal4(0xbb39d8d113ca9348, 0x288a531d0b9ae667, 0xbc0f0f1f958bbbe2, 0x99d0be148d918573) }, // 24569
+  { teju_literal4(0xf466be31630e1e79, 0xd1b063ba806af093, 0xfe23cd97718d6693, 0xe968f743fb29841e), teju_literal4(0x8e39b04e32d76c57, 0xef11e02a3b549b94, 0xc1995975410444a7, 0xfb5614f119a8dbd9) }, // 24505
+  { teju_literal4(0xedf7667070a7af6b, 0x6a0ecce2971fd07c, 0xc9ffc6e1ef434c29, 0x8dfb66b11142bc75), teju_literal4(0xd814e81000354efa, 0xabc438f397df17bc, 0x0842a3b525a42cd2, 0xb73fc26628552dde) }, // 24441
+  { teju_literal4(0xc660d2ecf457d573, 0x2383a68de1cc5713, 0x62da3a79db197b10, 0xcee7662104ee916f), teju_literal4(0xa4253c11e5a4b44e, 0x9fba4a51ff030e60, 0x6b624f369c18501f, 0xb58c80492ff791ae) }, // 24377
+  { teju_literal4(0x56c63e1abc6a3ff8, 0xea963ca27c65d2b7, 0x66eb494e25953a78, 0x813c96966cc552e4), teju_literal4(0xf9627a135aa9fb57, 0x99998f7b300e8dc4, 0x21e8a32498329e52, 0xf3ebd3f35218ba13) }, // 24313
+  { teju_literal4(0x657826bf890afa33, 0x995eead059aff209, 0x3d1de5a9b8d55c77, 0xf3151fff6f6fc914), teju_literal4(0xbd71a526e6d7d865, 0x3599f3bec503dcff, 0xe5510b445dd03dc3, 0xc5b2fc17b0cad1b9) }, // 24249
+  { teju_literal4(0xc4ddfd9a434e92da, 0xfe3a3ff37cdd5c2d, 0x20e4810d2075a9a4, 0xb633b94bb2e45953), teju_literal4(0x8fe903946ae17311, 0xe0d0575f9b2bdd30, 0xa8f459a23eaba19c, 0x434651254d99b1f3) }, // 24185
+  { teju_literal4(0x79fa471f172c3086, 0x5167576720478536, 0x65dedddb11dd7745, 0x463cc9008769f2e6), teju_literal4(0xdaa4370dee7f8dd1, 0xed9357fd0c715a8a, 0xd8884d100a0b9211, 0x5a4ee120555d28cc) }, // 24121
+  { teju_literal4(0xe023b1fc73f5e7d3, 0x315efab76f29ea61, 0x0ca8b21debfc943b, 0x4974e4defde282c7), teju_literal4(0xa617096b733dc43a, 0x04089a36ae4e9608, 0x2c57cde2dd91a3fd, 0x5fcb710babfbb61c) }, // 24057
+  { teju_literal4(0x88770fd12eebfee9, 0x2d196ff18c73ee3d, 0x2f7c1c90ad723ab0, 0x0c31ee3a17196ac2), teju_literal4(0xfc56c87948c06300, 0x6ffa6721f0270be6, 0xbcfc161fb68f685d, 0xe207d88762686b53) }, // 23993
+  { teju_literal4(0x49335b07b89145a9, 0x3504b0bc6e61c852, 0x06a6e2553886c8fb, 0x96b8e33ecbb57da6), teju_literal4(0xbfb02b715528dfe9, 0x2787761f8228ef7e, 0x35d09e6614b3d82b, 0x7bdbbc8ecc04686d) }, // 23929
+  { teju_literal4(0xb55b5e707f52047a, 0xaa0c1a6ce5199f3e, 0xa6947945e8d303fb, 0x23c5a4e1a605448d), teju_literal4(0x919d72edfdb3f91d, 0xccb818f66232c0ae, 0xe21a46983fc7d513, 0xdb8f5ebbc9e8e397) }, // 23865
+  { teju_literal4(0x8e0a1b7d60089edc, 0x3c58b464f466d744, 0xd02b7546f3ee0532, 0xde5004d8cae33861), teju_literal4(0xdd3b4964c447b2d7, 0xbfa68670176ded76, 0x3a103f04331eec28, 0x26705c8323b0da58) }, // 23801
+  { teju_literal4(0xb9091c53d32c6239, 0xcd0047faeb848e47, 0xe3dc46c11ab7c755, 0xb6464f920869c421), teju_literal4(0xa80ebc72e4d6f9dc, 0x6be1023094682f36, 0x0fe9d98548377788, 0xcfe7b940bfc3dc93) }, // 23737
+  { teju_literal4(0xc9ec32cf2006444b, 0x954dfd8cd8931ae7, 0x2951fb706d74278a, 0xcb17fa1f60a41ce9), teju_literal4(0xff540c838875a77b, 0x9fa338e3418ea79d, 0xfcc3fb716bdfcf3a, 0x3b798e5461082222) }, // 23673
+  { teju_literal4(0x81eb00ac66472b10, 0x818b1a33cde2a4a4, 0x73c10910fc8c3725, 0x43be806f869a9f85), teju_literal4(0xc1f5801686b072ec, 0xaaac1ae55773d885, 0xeaf21bbfb9af5060, 0x90c807fe73717fb5) }, // 23609
+  { teju_literal4(0x37776e18b66a13db, 0xf8af7b40e3b2e004, 0x3ea8d074fdf45391, 0x3f9fb308941fe61d), teju_literal4(0x93570dd9e7f5f908, 0xc13b4608ba2e90b1, 0x197106196c059d00, 0x6a6978ca2ae92dfa) }, // 23545
+  { teju_literal4(0xe2b7774b186979bc, 0x23919aa0532a7c0f, 0xdf4c2cc0b9c2b4fd, 0x924aa82080b3885c), teju_literal4(0xdfda369f835164e9, 0x76ed14eb2a6401a3, 0x8055f41c18f84553, 0xedf8d6d54b6c3d7a) }, // 23481
+  { teju_literal4(0x34e241ef9c30aafc, 0x78f2f6c905cab7bf, 0xf222ba325fb780ff, 0xd62a13833920cc69), teju_literal4(0xaa0c670a9dd010c0, 0x8ae01fb9aa35ebc5, 0xd4609cf119f28b51, 0xe75e616d016f8a35) }, // 23417
+  { teju_literal4(0x2d31cf49d8f64b62, 0x8a4fa7f5805cdf6d, 0x2900edb6a6833455, 0x1f3ff2811fe368a2), teju_literal4(0x812d30af00819ad9, 0x8a1f91afffafc0e7, 0x4651fe12fcc6516f, 0x8b20908d45b4baf8) }, // 23353
+  { teju_literal4(0x6e806b74f8f84912, 0x17b93b1d52f64ffe, 0xa669275847418cdb, 0x7015d6dbfeeb8c76), teju_literal4(0xc441b7ba808ea48f, 0xba5dae8fc07d068c, 0x0e84833be600b552, 0x071c02667f69e791) }, // 23289
+  { teju_literal4(0x2ce9ca5eae7dfb25, 0x0333e6a3b937405c, 0x14eaf48fbee18b18, 0xa4320b574df95c89), teju_literal4(0x9515e40624f1fc5e, 0x6973ac026c4fea63, 0x25d0cca3f7e3dc8b, 0x4f1f1c1e7a9d4948) }, // 23225
+  { teju_literal4(0x9ce7981acde9ffa3, 0xf5b4a26aaf19a6ab, 0x1c1dc9c46dbd8769, 0xbd9ce648a3a5227b), teju_literal4(0xe2811690936a65cb, 0x1de76d768f7c8e1e, 0x927d38a3b0943b3b, 0x4b7840b3269d3fdf) }, // 23161
+  { teju_literal4(0xbe38d8aa0e22714d, 0x9b9796585c34e466, 0x3e55cf64b52c41ef, 0xdd97684ee913a47f), teju_literal4(0xac101b4b3e5cfb8f, 0x311157f35563c999, 0x44f35a5cdd8895da, 0x9f3b5347f81dd070) }, // 23097
+  { teju_literal4(0x74d04525f41269af, 0xf893bc2ec5a3e63f, 0x8009b6457eb57163, 0x7ac16e1c9c041aab), teju_literal4(0x82b4f143805d3392, 0x422c31fd25d1a7f4, 0x6ed879e959d76b73, 0xfb9b018caa27f6ba) }, // 23033
+  { teju_literal4(0x17a89d90f50bfc8a, 0xdf6ad2c48592f3ff, 0x750f570220c5cfcb, 0x0eec4c3612b72f4a), teju_literal4(0xc694e73fe0ae0ebe, 0xd9f66bb5543cf62d, 0x2a63c0d3b9e8d536, 0x0d4f575a84150a3b) }, // 22969
+  { teju_literal4(0xe3ff50261e97cb0b, 0x7379be1228a7c64e, 0x785d131d1b77f8d3, 0x79e7e71e96c17424), teju_literal4(0x96da05503d1b4c59, 0x44797ddbbb5a2598, 0x50f0ee6157282e6d, 0x7665c40adb5e55a7) }, // 22905
+  { teju_literal4(0x2511eb9ba36aefbe, 0x3e8154f93327507c, 0x727d9805cda37378, 0x09ad1927288f46de), teju_literal4(0xe53001529af22fa6, 0xd44f639bc73fd474, 0x7fc134f5a5a9d4db, 0x55afa2ad5bb640e0) }, // 22841
+  { teju_literal4(0xb5c141cd1fa0343e, 0xe73ed017d1561127, 0x76ac69d546ad8250, 0x68ce199978d1efb5), teju_literal4(0xae19eb8448024372, 0xa83e49cbd7b8558b, 0x3b32a921a7b89e73, 0x8f35d71ab7ae1195) }, // 22777
+  { teju_literal4(0x9fa38c902a05f51e, 0xf086ad84cda08d38, 0x2d6634a9103b41f2, 0xbde70b7fda480e9a), teju_literal4(0x844155e81b75afa1, 0x5757a791a5b69c93, 0x646182dd5bdc9590, 0xa3e3784b9489fc31) }, // 22713
+  { teju_literal4(0x8a55cc5950dea567, 0x9817c56c12a5fe22, 0x58bf979ad4f5653a, 0xf0b75ad6e4422f2b), teju_literal4(0xc8ef23c89b9a08b9, 0xbc413627d190a242, 0xa0f85480483f21bc, 0xa5f1ba6af5fe77ec) }, // 22649
+  { teju_literal4(0x79530b836e18b442, 0x29e64e0323aae092, 0x2e8be51c24f42181, 0x5ecca1b6c42150f7), teju_literal4(0x98a381c5d6435ad2, 0x0fc40a8f8654cfe9, 0x05c2de044a48c9dc, 0x9ed26e5f29debc70) }, // 22585
+  { teju_literal4(0xeeb87b9d878f3b4d, 0x2daaa118cc96bf99, 0xa9931008d77ed8d8, 0x15c76e233065dba2), teju_literal4(0xe7e70f4959f23d6a, 0x5adab14be5c613a9, 0x2ef650cd5d6733bb, 0x7afb5d62ef388c92) }, // 22521
+  { teju_literal4(0xbf99fc45af1984df, 0xba176abb0d033ae1, 0x3396da83f6daec46, 0xcdac00f13232f7ce), teju_literal4(0xb029ea3cc4043d16, 0xc95091e8c53de405, 0x75d993ecd66dd190, 0xc6cff72f85e81bad) }, // 22457
+  { teju_literal4(0xb79e13855145ae45, 0xf1cda9e4f9fdef70, 0x9eaf7db475d00a9a, 0x49c3f0a9e37e6f15), teju_literal4(0x85d26cafd860e45d, 0x28cc2a43b53b2406, 0xb37e4da70c8451b1, 0xc82e88455f678235) }, // 22393
+  { teju_literal4(0xb27f57b9a94f4327, 0xfdf44c3c553ba93b, 0xbf1af51475ca8862, 0x3408d363f58ac4ed), teju_literal4(0xcb5082b6bc9494e2, 0x11cd1c9d0b15fd2f, 0xc68b46b5ff92a84a, 0xc2f25cf33f4dfeac) }, // 22329
+  { teju_literal4(0x794541090230fdab, 0xbca5543d82307c6b, 0x73ead3f2ed02b1b8, 0x6c9caed829633d55), teju_literal4(0x9a7269a545848238, 0x26743e4186c07cf3, 0x69c8b3caabf81bed, 0xfce010af9dd28b44) }, // 22265
+  { teju_literal4(0x1e9b10397a2e2b33, 0x2d63f53ee6893938, 0x7c1bcdbf6b45aed7, 0x3d1d2be545a2808a), teju_literal4(0xeaa6592287cec57a, 0xb27f3d73c8f927a9, 0xd7a328382b78b91a, 0xe681f3b5907fef0f) }, // 22201
+  { teju_literal4(0x0293c8b3a03e5a29, 0x4c12e7a0ceeab581, 0x2b98d79ef394f1c0, 0x1b357f8951e8b59d), teju_literal4(0xb2402a33ebcefc15, 0x1abe09ff3e779852, 0xc9cb27fcf32623e4, 0x4e91a9f31f76fab4) }, // 22137
+  { teju_literal4(0x0443215c0d3895fe, 0x43307b03e5a16655, 0x67fa808455331919, 0xec48ebe4b9747c54), teju_literal4(0x876843d86c903680, 0x63a0f10fb896476d, 0x21a026e24043749c, 0xe0b0b8fb78be84c4) }, // 22073
+  { teju_literal4(0xe9ee3554554ba5c4, 0x0c43a3fec845e845, 0x343e4f54a6d8fa5d, 0x40019ca696520a44), teju_literal4(0xcdb919ad27f2d7ca, 0x32d7515f6cfee78c, 0xca74800cd832984a, 0x5bfbca646481816c) }, // 22009
+  { teju_literal4(0xc10901ef05b6ffe9, 0x1fde27f3aee686a3, 0x588310ebf3531ce6, 0xf747b16a0b922eb9), teju_literal4(0x9c46cd5e22e74ae3, 0xcdf812282bf1af77, 0x85a4e1ecf779bf0e, 0x3aebfd627cfe1302) }, // 21945
+  { teju_literal4(0xabd40b3615e5f4d8, 0xca68bb0cb6a1da26, 0x89bf0b10b4b8a6f7, 0x3fc59b6c41cd0452), teju_literal4(0xed6df7d6b397c5cd, 0x37e0e8231b5c52fb, 0x1f150181e6dd75c8, 0xd360eac6f149b607) }, // 21881
+  { teju_literal4(0xe077b6c552d50e31, 0x4b0c5d57667a7211, 0x88a4eafb8f303f67, 0x72553662448ab483), teju_literal4(0xb45cbe61d35cff88, 0x2ad1054181efa7d5, 0x09e585d55d083c1b, 0xaeba9ae3cf213962) }, // 21817
+  { teju_literal4(0xa00ff6f31ca9356e, 0xb68a9e07115b47ec, 0x40c984953962172c, 0xc37bcda3bea2c62a), teju_literal4(0x8902e9cabdc25de6, 0x42cacdabf1c6af8f, 0xaae8acce3c638d27, 0x7a85862da16b74db) }, // 21753
+  { teju_literal4(0xf685f691d41b2651, 0xf5e4dfc3512da66e, 0x54eee987e957fe65, 0x00a9077854b10cd0), teju_literal4(0xd028fe905fc6ff2a, 0x53aba3272ab502b0, 0x30ef23752a0d3ab2, 0xdff20e13e1e98024) }, // 21689
+  { teju_literal4(0xd182a65dc489d65b, 0x1e0df4555a9ff2bf, 0x0a05530465c91655, 0xd62536ecc7df9843), teju_literal4(0x9e20bd91dec773c9, 0xb69b85376ed5a1ef, 0x61b9e419b67d24af, 0xbf880c53499afe2a) }, // 21625
+  { teju_literal4(0x492d488cd8c51405, 0xc6286bf7ec9d89ca, 0x79e7a24ee1e2ac32, 0xa86210258335c1cf), teju_literal4(0xf03e04aa27025854, 0xb0c1de4c60cafd76, 0xec6168773968085c, 0xaee2442a9349dc2f) }, // 21561
+  { teju_literal4(0xc38ebbe6a5985a9b, 0xf7c75cbba3a16bdf, 0xc2a1b67369dd2c52, 0x4d4da278ce053145), teju_literal4(0xb67fb9f815a2a4a3, 0x94167ad5c7b0e10e, 0xb38e6372dde13fa2, 0x761cd033a1d76c97) }, // 21497
+  { teju_literal4(0x28a00bd387e7f073, 0xeee66f54cb601226, 0x268459d2ec07fa09, 0xaefb9b57a3ed221e), teju_literal4(0x8aa26d1b64fdb9d2, 0x5388b4a1751e76c5, 0xf57ab52574b2c530, 0x24e8be19171b6790) }, // 21433
+  { teju_literal4(0x95ca2da119125560, 0xd19dcc8ea423fb69, 0x9abfc9979b137950, 0x727cb361aa994a29), teju_literal4(0xd2a047874ade9450, 0xa691c3121524ef23, 0xafef5e04c735887a, 0x704515de98c6ef5f) }, // 21369
+  { teju_literal4(0xd35bf7a9cbed1f61, 0xd2c8ea4d513531b0, 0xbeee2c98b247f6eb, 0x9d8d02821d97dc46), teju_literal4(0xa0004b1458fe0c7c, 0xeb2825e5db643138, 0x234d11735f9f8d6d, 0xcbb92640033999f7) }, // 21305
+  { teju_literal4(0xb8110db41f2e15fb, 0x3712dd757f22d4b5, 0xb79b1c36c545ad48, 0x045ddbc3d42ba168), teju_literal4(0xf316992dcc125ed8, 0x336b743465e56fc3, 0xf424fbccb96eb362, 0x0b83a4224d0b25c8) }, // 21241
+  { teju_literal4(0xaf715235f5e76036, 0x36e320a94bf5b745, 0xb631ac48ffbd64e5, 0x09a7d403a74782bd), teju_literal4(0xb8a9306283047e87, 0x542746db1cac766c, 0x1084689ad57dd54b, 0xc46a4d426ada8a70) }, // 21177
+  { teju_literal4(0x39f6b274bcbc2d71, 0x50fcf844b73c51a0, 0xbe6321065cfb2e02, 0x20640a7ace1ae5bb), teju_literal4(0x8c46dc8b3317dc4a, 0x8aeff68d06363704, 0xddea11d61d9e42f9, 0x7c050a167213d2f9) }, // 21113
+  { teju_literal4(0x4bcc21203be982e9, 0x96f55b2d40907896, 0xc0534f110041a9d1, 0xf287779fa4547b12), teju_literal4(0xd51f0afbfe1c4acd, 0xfad451053a0cd3d1, 0x1573cca8ec7648d9, 0x9dc81cc016c25740) }, // 21049
+  { teju_literal4(0x011b72a8d18a8176, 0xbe1f52759ea895c4, 0x0d81b96e188137e4, 0xb234504a7297d5e0), teju_literal4(0xa1e586ec79d5fe82, 0x9629930b901f81ad, 0x3252a50a5b37f344, 0xc9fcd0d521b86a52) }, // 20985
+  { teju_literal4(0xd04efdc7276ad899, 0x80a770d365a6b562, 0x54ecdaf49984ce51, 0xf310dede8365b2df), teju_literal4(0xf5f7cf40157cadba, 0x829ad0f10eb956b4, 0x9d3bea74d70441b2, 0x16445018cb016cea) }, // 20921
+  { teju_literal4(0xa968f9cc6f7c494b, 0x8a26d9b1ef181d5c, 0x3ffa17c92e804c5a, 0x806abb9f88bfb3d8), teju_literal4(0xbad93547d1dec515, 0xfc2739b9225b8877, 0xedaadda7f55b8321, 0xd4d43883549824b8) }, // 20857
+  { teju_literal4(0xb0fc276bc1a3cf1c, 0x385b8f9008d911c9, 0x5b0863c37733b7ca, 0x363c7e706e52e68b), teju_literal4(0x8df04707b6cf0124, 0xf883e830c18eee08, 0xec12492cd424024d, 0x45fdc7a2ddac03a2) }, // 20793
+  { teju_literal4(0xc7c95587cd120499, 0xde913b2c39bcc10d, 0x2b4285fb749b2bea, 0xa861a257cbc85793), teju_literal4(0xd7a55f9c8834718d, 0xcda1a2ca0d32319b, 0xe5e84576fa2b490a, 0x85af182ef834a920) }, // 20729
+  { teju_literal4(0xb70e4337a65c3be8, 0x77c0a6dd4d0f408d, 0x9fe313f2a6bc70dc, 0x51e8e5e0a84642f9), teju_literal4(0xa3d08254ccd07441, 0xf803dcd805ed2bb7, 0x464450f3005d7cd7, 0xc51c537b4c2fba9b) }, // 20665
+  { teju_literal4(0x4e7b642c7b79a0c1, 0xc3689a6f040f5f98, 0xa2acbda2f9c848c3, 0x5b551b1a33da32e2), teju_literal4(0xf8e1c10de9c9f5f3, 0x49b0b9359267a806, 0xf78b4319395f9069, 0x8496c998a57fd5de) }, // 20601
+  { teju_literal4(0xf8946ef45f6966cb, 0x7950487c89efa966, 0xf19d928ddbd39e49, 0xa0f9a7c31b52ccab), teju_literal4(0xbd0fdc8a51241f5e, 0x6f75ee18c9e9f20d, 0xf74c2312bd5ae386, 0xa270e016216724cd) }, // 20537
+  { teju_literal4(0xb00b09bbad3fbae1, 0xed520e5ab387fc1f, 0xbf16111fa779da3a, 0x028f29758ac2c204), teju_literal4(0x8f9ebbabc47a33af, 0xa690dc2a718b635f, 0x6c67471b522afacb, 0xc201f068cf741117) }, // 20473
+  { teju_literal4(0xbc3b7a9341495646, 0x64830fb36ee76747, 0x8607f660f0c7eaef, 0x85dab156fa69d224), teju_literal4(0xda335c5bbfd34237, 0x223928a0ab440bb6, 0xcf6cfa25c58c7e38, 0xd2f6fc96cc03da96) }, // 20409
+  { teju_literal4(0x868f9b8aaf6e44c4, 0x1a72caa63282ed79, 0x79e52f2624f44ecf, 0xde25981f942e7a74), teju_literal4(0xa5c14ebc1d3e9c53, 0x3ab3fd7f645c5787, 0x63626b0546b6b1ef, 0x025e641794c65a59) }, // 20345
+  { teju_literal4(0x263da1a4d1c559c6, 0x2bf49e71df6f07ea, 0xf656eb25ccaba268, 0x583be2bf8c9ce490), teju_literal4(0xfbd489139142c781, 0x757ea4c4e12c1551, 0xbeb2785edcb3e868, 0x04af960ba481ddc6) }, // 20281
+  { teju_literal4(0x37b73d122ebddfb8, 0x7192000b5b4989c5, 0x14b87629543bd609, 0xbb84e611dddfee2f), teju_literal4(0xbf4d3a489d1a212c, 0x0aeb71f6538f3558, 0x609e221d6b8fbe84, 0xd092f8d51812104c) }, // 20217
+  { teju_literal4(0x13695e9fb51f86b8, 0xc96e1ce0d85a3038, 0x76152c11e0f8b674, 0x2608f1dac2ea8f56), teju_literal4(0x915249bfff54f449, 0xc5091da2deef0c7d, 0x871646f101783e8d, 0xab6fed26e626800a) }, // 20153
+  { teju_literal4(0xd39db87c14730587, 0x195cedc0e445ecc1, 0x3daaff4c9ede482c, 0x4a827433622ef7f6), teju_literal4(0xdcc91872143460a3, 0x981d81484fd8a6c5, 0xe29d815fcbe8f005, 0xb2c41e844bc5575d) }, // 20089
+  { teju_literal4(0x5f4f9c0f4041557a, 0xbd93b34a1a3469d7, 0x94672369484a2b1b, 0x4358a73df93d0f03), teju_literal4(0xa7b7fdc614b6589a, 0x148712ef6056a8f4, 0x5cfdbe3a4169dcb7, 0x8a2e39f77a7a8d7a) }, // 20025
+  { teju_literal4(0xb35b438b1552ddc2, 0xca188bf3658d1740, 0xf36b3d29bd2c6dd2, 0x83f9ef699d998b74), teju_literal4(0xfed0421da6ad1eef, 0x997ed258959c6e45, 0x415a57df4a356e26, 0x57e342775ff83ff6) }, // 19961
+  { teju_literal4(0x8d7c1b75f146893e, 0xdcc3bfe20dba6cdf, 0x340d4362d96b5377, 0x7dfe77441f6735e5), teju_literal4(0xc19162de5639e68b, 0xda5cb1220c83faa4, 0x26e7896df3ab3828, 0x89032526fec3bbb6) }, // 19897
+  { teju_literal4(0xe0029dfc291486c2, 0x5a1dbda02984717a, 0x8dbe335c59f3b8cb, 0x86f2ccc84e8e989f), teju_literal4(0x930b00bb646b3de1, 0x9223eb4202f76d21, 0x9cda0c5b19ae6404, 0x6dd0957e1090b11f) }, // 19833
+  { teju_literal4(0x418314d11458310c, 0x2b35069a80695598, 0x07303dff2510cd02, 0x70b8d0edec62d9dd), teju_literal4(0xdf66ab5e6032f26c, 0xdf42b53d1e96f3c2, 0xcf62e607c7dde00c, 0x7f72cfefda3d6673) }, // 19769
+  { teju_literal4(0x300912912763981c, 0x8a264f044d32fa4a, 0x270c4c11b88142c9, 0x414c8b7280e0a58a), teju_literal4(0xa9b4a14bdb677975, 0xf9ccf0ccbdbd3568, 0xa0a482b1a7c81d4c, 0x2ddf5495796e72c3) }, // 19705
+  { teju_literal4(0xc00867dc44302d36, 0x0ccd351e53b015d8, 0x7c725dde9b1c42d2, 0xf564eeb384a32f43), teju_literal4(0x80ea83a505720510, 0xe6da6c467fcbc327, 0x2ec5534b4ec30271, 0xd3fec7b97deb09d2) }, // 19641
+  { teju_literal4(0x6e0fcbb292ec22ab, 0xf0caff2bd4cc352f, 0xb000dd4d7fa79149, 0xe2e6eac7c72afef0), teju_literal4(0xc3dc6ae4da3b4b8b, 0xa1dc347022d6881e, 0xa7cb6be94545af45, 0x98e47cea8e4fdfcb) }, // 19577
+  { teju_literal4(0x9fb9798e34ef0b6c, 0x7d5df96af50d986b, 0x2dda1ebe7c113d07, 0xecbf74a7147490f1), teju_literal4(0x94c8f043d72ada13, 0x19c82b3424ffeeca, 0x6c72757f0b0732ac, 0x4bdd640653df0b0b) }, // 19513
+  { teju_literal4(0x52562f49c02ed64e, 0x6204fefcd3629335, 0xe5eef7829336930e, 0x93c94105bb9bd21e), teju_literal4(0xe20c2ce6bfd9cd06, 0xa52e5f4f9c16e722, 0xa8a17faef88f084f, 0x3c781de51692cc18) }, // 19449
+  { teju_literal4(0xaaf67899f42266cb, 0x389f00221c587b8a, 0xbbdd77b81ac39b77, 0x82e40d3c65e1f6e6), teju_literal4(0xabb74b5cba573661, 0x8fcbc8131ecb85b1, 0xd1cd8f26b95ce0da, 0x9f68617e60d3e6c4) }, // 19385
+  { teju_literal4(0xf3c9aa81e8e737af, 0xe7501be5ef0f793c, 0x9233198f895929c6, 0x48749fe08eb29353), teju_literal4(0x82717a046da90548, 0x4fdee388979ca5af, 0x3f3cb8b8fac54f29, 0x44281eaae46a8715) }, // 19321
+  { teju_literal4(0x27c33af90ec6b788, 0x06a3d6317f470be6, 0xf27f1d882f8c6c37, 0x906b091b4e9998b6), teju_literal4(0xc62e6733ff515228, 0xa52055dd1ba611c7, 0x11fcbb7e33fc2856, 0x900bd9fc6153454b) }, // 19257
+  { teju_literal4(0x7150c93e1661ec03, 0x2afa8593791226cb, 0xd120eb50c388c17f, 0xb65091ae57d037bd), teju_literal4(0x968c282eaf9f0199, 0x603f5b368e215ee6, 0x8bebe6ba99dc3219, 0xbd415ee42aa495ed) }, // 19193
+  { teju_literal4(0xa63d6ac0caa103d4, 0x3f8489d954d3e9cb, 0xb5b9e50208caf654, 0x3cc1735a1e076fda), teju_literal4(0xe4b9b519687b4f95, 0x2ee5588bdb178338, 0x90c21b5025cac0f6, 0xc3bf9b83d1e86db8) }, // 19129
+  { teju_literal4(0xff73ef87d037567a, 0xd51a44ce825b6393, 0x82bff1ea82197ed9, 0x95e07eb5d90b4dd7), teju_literal4(0xadc00e3ebf87a69e, 0xc41b8fb1d38986ed, 0x2acbc7e06386a5ba, 0x214ec9b76e54013d) }, // 19065
+  { teju_literal4(0xcee49da65afd566a, 0x84c9d03e160dd23e, 0xd7a76d677a85c066, 0x83495018ec4dd890), teju_literal4(0x83fd120eb5ab7aa7, 0xbead03726654b7db, 0x23222a2df9afe988, 0x3a9e5c94957f424d) }, // 19001
+  { teju_literal4(0x9bf63cf1566884de, 0x53ab35794c9c4871, 0xa87b22cdbd1bdb54, 0x759a4ff3e405965a), teju_literal4(0xc8876ce2d19e5c50, 0xf4a61be736a85434, 0x2c15305270df747d, 0x118c46250f42d0b8) }, // 18937
+  { teju_literal4(0x8512a988efb7fbbc, 0x587482c037dbacff, 0x2e5867f63589ecb5, 0xed09e17dd2a8ed73), teju_literal4(0x9854b8814a5b55e6, 0x65c14817af2d4de3, 0xf1adf927e5641359, 0xb959257b5f3c5c43) }, // 18873
+  { teju_literal4(0x05f5c8563fce7185, 0x65bedd4840937ec1, 0xb81f3030dfe3a3e8, 0xe958b3455b824fd1), teju_literal4(0xe76f5c4d835894af, 0xd8e38db2923b0dbc, 0x208c70dc38b90d87, 0x9ed14250e856c4ca) }, // 18809
+  { teju_literal4(0xec7f1abfa740a642, 0x923ed135f9cb1eeb, 0xdb0a1613b4764425, 0x0d5d25e7224817ca), teju_literal4(0xafcefc6f64110e04, 0xf7fd74b3b28c6f7e, 0x981ee894802382e5, 0x6068945434ff1ce7) }, // 18745
+  { teju_literal4(0x33a13a8da74e7588, 0x443809ccfa4798b8, 0xc1aa48ce582b6a19, 0x55b6459ce45f1a50), teju_literal4(0x858d59cfa05115e3, 0xab310d65fda72824, 0xb179221143f79097, 0xe484fe675b85c92a) }, // 18681
+  { teju_literal4(0xa4c0f16c7be4a420, 0x17970a79e59112b5, 0xbba5ca29c2f5371c, 0x83c3e0a6d245c09a), teju_literal4(0xcae7914852e6f403, 0x52abf4dfc2b96005, 0x5ffaf54a2921916c, 0x923f34923d7113fa) }, // 18617
+  { teju_literal4(0x89b1f3b3758cbdc2, 0xcdf728079db5359c, 0x145b53c80793beba, 0x36d64d6c0c20c31c), teju_literal4(0x9a22b1719a1b5007, 0x30b2e6da6af34448, 0xcd2d418b7a5ca603, 0x36b9d912be394f5d) }, // 18553
+  { teju_literal4(0xc76f9b1d83b36607, 0x040c91bed6899171, 0xb5baa79264a97f52, 0x266273c71db81c93), teju_literal4(0xea2d3b240adfbf83, 0x793d30543788845b, 0x0dd2272046a4eb15, 0x85116a64356ee813) }, // 18489
+  { teju_literal4(0x27ef9958b7c84ac3, 0x3f77c9330f0fe6d1, 0x7224e157219b3f9a, 0xc611a820ac9cbff5), teju_literal4(0xb1e428a43432e3b3, 0xb606ae18f6d3f18e, 0x1d922fb5bd9b639c, 0xd373b5dd20e757f1) }, // 18425
+  { teju_literal4(0xc0899417ed4bf459, 0x4b640c6520c60cc2, 0x2ca9fc85dff6c975, 0xfec277aeba6815cf), teju_literal4(0x87225f7d89451174, 0x846fc233086010c4, 0xf5a414e501f31fe9, 0x711a74d47f499783) }, // 18361
+  { teju_literal4(0x27dfda6c76f7454a, 0x3f891ed4eac27955, 0xe7a7ed221277d8ff, 0xee29a6a1a76bd74c), teju_literal4(0xcd4ee9fc3c89f000, 0x313b36828b848bfb, 0x293054ad13a02158, 0xfb7cafabd34ae4e1) }, // 18297
+  { teju_literal4(0x659f3b8d5aebd6a0, 0x698a57e3d6094db2, 0xb60ba76f4a838711, 0xe59b755cdc143d07), teju_literal4(0x9bf62366bb1b5078, 0x3f2803b0aef047ba, 0x9154b7015016cbc0, 0xc7b0671f673693ae) }, // 18233
+  { teju_literal4(0x813c8c0618cd33e5, 0xf7c139d65fd50dbf, 0x58b1d719eb670de6, 0x8cb561a9032a2bb0), teju_literal4(0xecf36a88aa893f53, 0xf3ec9fdccb7521d4, 0x0bee33601523a160, 0x68ff7a62ae2e1e84) }, // 18169
+  { teju_literal4(0x7499f73002bf34e4, 0xe67e11342e474698, 0xca72c00e4bdc152b, 0x5dbbe99bdda86618), teju_literal4(0xb3ffa5cb79628a4f, 0x0a38f8ebc11d7749, 0x76381b4fd5105789, 0x11a50d36901f23f1) }, // 18105
+  { teju_literal4(0xad56f4f1cf5864fc, 0x05b2f851adf7f8c5, 0xd2eb4acfa21f7bb7, 0xde8937e0146d7f28), teju_literal4(0x88bc3179e63524e3, 0xb802adb6daa0ae27, 0x624bfb223660d065, 0x17049a18a127649b) }, // 18041
+  { teju_literal4(0x768a8b467c7f526e, 0x3eab40789700f554, 0x6695c02496885400, 0x7d78832eae616465), teju_literal4(0xcfbd8cd7c3c4d822, 0x979809dabbd68542, 0xa228b4771ec73587, 0x52246c688c7c5e39) }, // 17977
+  { teju_literal4(0x9f55a263f7519a37, 0xe9b3984816fba684, 0x75f4ad44637d79d7, 0x7e06a342effd0e5b), teju_literal4(0x9dcf1ef988308b3c, 0xf2345380f98e0a9d, 0x0c20c11c0b8397a3, 0x2683a90d36914ed5) }, // 17913
+  { teju_literal4(0x547c408af03e64b8, 0xf231348172406331, 0x32cc3186bd98701b, 0xa34aa66e28fca40a), teju_literal4(0xefc203b2a15bfc2f, 0x0c37bcd5586ecbb6, 0x49471cc1b05a22cc, 0x7d567fb2f1bbe7ef) }, // 17849
+  { teju_literal4(0x89304aa355854b46, 0x8eacb7b52cce640d, 0xb6425c77ce58e36f, 0x4bcd08bf0eba983b), teju_literal4(0xb621870ce65dc383, 0x73f7543462193ca7, 0x7051339902ae0405, 0x7c3521c283a62676) }, // 17785
+  { teju_literal4(0xcf1618f00d2122ff, 0xa60767ddeaf70bce, 0x16a48d54cad7b2c8, 0xdab38d50e55af41d), teju_literal4(0x8a5ade51c9883e03, 0xce7ee70f6ef4a7d2, 0x276d5dc7b62e938d, 0x3d790728c0c4de7c) }, // 17721
+  { teju_literal4(0x21be74e36c6a81ec, 0xcbb5890bcb8371ba, 0x77dd80ba5c3d2d05, 0xe526e570df0edd73), teju_literal4(0xd2338ff6604b815a, 0xa43512a175c58ac2, 0x0808fddfd7732bc1, 0xbf1a2038c2256045) }, // 17657
+  { teju_literal4(0xc1094d62deffad60, 0x6789cfd5f5ba4752, 0x6ee206e5f795547e, 0x4d772ef02fe97284), teju_literal4(0x9fadb4f531a51b6a, 0x4563ed7f6ef1f0b7, 0xd6774044e58ac41e, 0x0041f50e47c4a578) }, // 17593
+  { teju_literal4(0x0b1f7118efaca3c4, 0x71ee905825bc33f4, 0xeb33571262c44814, 0x0e3c19cc6c9c3a88), teju_literal4(0xf2992025a72077bd, 0x788c6b247511a9e1, 0xf2f2d0729e1fef9b, 0x99ea5e5827057fbb) }, // 17529
+  { teju_literal4(0x2e05863d9016e433, 0xf5c8fa15aebbce32, 0x29737ef83cb2398c, 0x94ee28d9beb141fd), teju_literal4(0xb849dfca4546fadf, 0x2aa9ef778607dc6a, 0xc43095f781be622b, 0x18c48370fa852ab1) }, // 17465
+  { teju_literal4(0x7bf9b83d30489f5d, 0x888583db87b15a07, 0x4130a36345eb24af, 0x60becf458d197278), teju_literal4(0x8bfe74be66a1a433, 0xe86e88598b95f67e, 0xdea09d6b4026c26b, 0x9328d94eeb645235) }, // 17401
+  { teju_literal4(0x53fc924e1d158ba6, 0xc8dafb444c43c5e5, 0x0b61d97d5c443d41, 0xf6d20b549754fa44), teju_literal4(0xd4b109b69539ee65, 0x9e8b7892d90c2d0f, 0x6d9b5430338c1587, 0xc7ffb84e4ab25042) }, // 17337
+  { teju_literal4(0xa29761c6e2095a32, 0x0fe23e7cc73722e0, 0x820bb7cbf52ccdd7, 0x064bacfdfe06bb39), teju_literal4(0xa191f657d5dd9963, 0x0284ab8b2ea7a969, 0x72265fad5153e25f, 0x7408232df7d1cd2c) }, // 17273
+  { teju_literal4(0xb165077a6c6f70aa, 0x53d3a84d8946824a, 0xe52a200c6057fbff, 0x58c258b4d772ea3f), teju_literal4(0xf578d9b2d44b0583, 0x53521bd04f097ec8, 0x0a1cf00d2053c0fa, 0xe05c3eff2e0d86f7) }, // 17209
+  { teju_literal4(0xac88d0b97adb11e9, 0x1ba54c13f359148d, 0xa68a52a98819b304, 0x1139a577b82d3d61), teju_literal4(0xba78c3a027d19695, 0xb7ca1aec193bccfb, 0xab4d4d4a281d223a, 0x76af76ebe68f6d20) }, // 17145
+  { teju_literal4(0xfd2cf0da49e86124, 0x59f8dbb4614e2555, 0x4bca5cce6483b3cd, 0x6a86c37ce4cb1b59), teju_literal4(0x8da703a597b537e2, 0x1f33b2d831ffc1f2, 0x8d19bc0cda4ed916, 0xcbab52ab9fe0ccfe) }, // 17081
+  { teju_literal4(0xe6c5c57f9cdad6bd, 0xa7c909aa0a433944, 0x1008583d2f70f78f, 0xc51d950081551257), teju_literal4(0xd73610babc6797c1, 0xe2118c929085c2b4, 0x7c78989455b9566d, 0x469fc0fc0ebee748) }, // 17017
+  { teju_literal4(0x9ad4ba2e935b8f12, 0x37e4244d6ee4d29b, 0x6a46bb78aeedea17, 0x796d54be458287f8), teju_literal4(0xa37bf4531bcd9f42, 0x2fae2677d0c9983a, 0xf3ab167bad211202, 0x1743911364000749) }, // 16953
+  { teju_literal4(0x15729eb35255e84f, 0xe156fcf65bd5a007, 0x6fca1c74e73fe9a1, 0x7cdfb0ce0f89f176), teju_literal4(0xf8614a798ca5568f, 0x10a90bbdd78dbced, 0x6d62844db9f3a771, 0x95fd823ddb8674c6) }, // 16889
+  { teju_literal4(0x29ef12b60a207c12, 0x9e1f206f607636fa, 0x63884ec704395717, 0x8288edf72594402e), teju_literal4(0xbcae466699848f82, 0x63e0a57c6e24628f, 0xff9de9162eece2b5, 0x5ca975845f81d2ff) }, // 16825
+  { teju_literal4(0x3265bfa324bcd1af, 0x2c502f14567a9251, 0x6e572c7af6182e27, 0x50d57e47fbe877bb), teju_literal4(0x8f549a1a65318ebe, 0x344afac06f05f3dc, 0x10320e62cada105b, 0xbbdcb1bb7fa55538) }, // 16761
+  { teju_literal4(0xb465128431322b3c, 0xd0e65a75c1ff0dc1, 0xe4d4b5d99e3dabfe, 0x88738fca49fa0c7c), teju_literal4(0xd9c2bbe9d4235300, 0x1b592ff19928b688, 0xb18fea6730287590, 0x631306db12c4e66c) }, // 16697
+  { teju_literal4(0xbcee4a07d69db897, 0x0b45356b25bb1a97, 0xbc2c52170b86e5f6, 0x19be3867a2aed4a8), teju_literal4(0xa56bc04ccf40b760, 0x46d43f8ef8666802, 0x58eed6498a19fa3f, 0x7a33ec36e92577fc) }, // 16633
+  { teju_literal4(0xc0f596649e904dd9, 0x9ea82f075f2fed21, 0xdbd86bf134079130, 0xdf73a0ce75e44cca), teju_literal4(0xfb528ce86cbfad8f, 0x073b95bb4e9fe8fc, 0x3180be292dca4f4b, 0x009f909d0d5099ea) }, // 16569
+  { teju_literal4(0x9ecf2c62826ebe64, 0xecefcf4bc080e663, 0x5636f78f02bd7b81, 0xbc915bc335927853), teju_literal4(0xbeea7c31d419a4b6, 0x4a2770edcc648887, 0xc503e4c43d21db04, 0x33b1dfb4ac8d01c5) }, // 16505
+  { teju_literal4(0x53f3adfe3b553fb0, 0x72534b878ba92588, 0xb708c60d10c81b9d, 0xe6ff0bfcaf74b6e5), teju_literal4(0x9107475d8ec4bb77, 0x1166180220b4938a, 0xb68d83fe1d7bf700, 0xfe912e46e76299ca) }, // 16441
+  { teju_literal4(0x7e5b9a597e966c8f, 0x3ba1e32a7030e797, 0x31817ccf664723c7, 0x705daaafea34f927), teju_literal4(0xdc5722704f5f2778, 0x1ecffebacfdfa31f, 0x5e17539e33a60a4e, 0xdbff541389669aed) }, // 16377
+  { teju_literal4(0xfed5ef318b5224c6, 0xc3eacd6837b682b7, 0xa1636d13be08d235, 0xf897360b024f7a47), teju_literal4(0xa7616bdf7efd4181, 0x708f7c3f9ebb9f9b, 0x29f73e11db3a34e0, 0x074647e47d62f31f) }, // 16313
+  { teju_literal4(0x0faf5462044be691, 0x512584aad8ca7a8c, 0xa5f7b2ae0075282d, 0xe82f87550c21174b), teju_literal4(0xfe4cbbbe3a32298a, 0x3c1eef035e140a5a, 0x8258ed7f4c8bb8c7, 0x2756164550c4607a) }, // 16249
+  { teju_literal4(0xae06fcebccd2688b, 0x596f8e1628b4b43a, 0x4b7efac5b1f1617f, 0x8e83da14c2505d3b), teju_literal4(0xc12d7952f5ff9210, 0xc467ec4276f91de1, 0x859bf4f4f65bdced, 0x063828acce191a67) }, // 16185
+  { teju_literal4(0x718411fb4f6efe0b, 0x2e5ca759ccba46ba, 0x49a3137997de0d45, 0xa319ff2c981ebe78), teju_literal4(0x92bf1ade16009e72, 0x67bad472bded92c8, 0xc70fd888d93f9751, 0x725a1eea8f09a303) }, // 16121
+  { teju_literal4(0xbec5df2f6a0cbcf7, 0x414cf039637b74f9, 0xb43c909dbf6585b4, 0xc826979a9a755a88), teju_literal4(0xdef35bc0e853748e, 0xd4af0f35711d819f, 0xeed9a8a64a6ae6a8, 0x8c964dffb01b20f8) }, // 16057
+  { teju_literal4(0xa7c2640473a5b0f2, 0xd31e693c0c13fa48, 0x63cf502e143ccba2, 0x0c2ca9db6af35868), teju_literal4(0xa95d08db1cc6ec0f, 0x16530d73e3b7a769, 0x041023de33bc0ed7, 0x3e1822a4094e25ec) }, // 15993
+  { teju_literal4(0xaf14d4bc595a707c, 0x59f5a4431b51117c, 0x891fee6574e20e81, 0x822a9867b5f8efd2), teju_literal4(0x80a7f9056b5b5785, 0x3279d9a782238c8b, 0x3748cc74ed195ff8, 0xc967500735330daa) }, // 15929
+  { teju_literal4(0x28b272acaece2528, 0x6284cfa9b533005e, 0xed1194f569379ca5, 0x4294f9d1924d612b), teju_literal4(0xc3775258bb05c4cc, 0xf4d44fff214190c1, 0x3835b4c09892bbc3, 0x13c0de4516e48217) }, // 15865
+  { teju_literal4(0x0e74978f8eae7586, 0x886f4aa5e1fc4f19, 0xc72cb992ab5a5021, 0x575ae397cef40989), teju_literal4(0x947c2439caa3abae, 0xc12ebd64fb6bf781, 0x419fc3e9361a16b5, 0x74cbad25aa51bc3a) }, // 15801
+  { teju_literal4(0xb9aad96b105352ef, 0x127897fc8e549074, 0x0414ff9024221222, 0x3a00d497fb045493), teju_literal4(0xe1977f9575a0e425, 0x18bb6ddc432a5a54, 0x6240aa76eb9d9d69, 0x29f968c3a4aae939) }, // 15737
+  { teju_literal4(0x813efb570c21aa04, 0x84b5604bead8b54b, 0x94b67d827ae9e999, 0x493b6875ad729c10), teju_literal4(0xab5ea9459f466fc6, 0x43f8d047985798c0, 0xde4e329cfa023635, 0x5c749a1eb620c59e) }, // 15673
+  { teju_literal4(0x10dccec793273a73, 0xb4a215dd5692e0e4, 0xdbf282c4094064e6, 0x8a60ab99ab2a1a45), teju_literal4(0x822e25981b1208b1, 0xf0348ef5ce96b100, 0xd41ebe36c93ab91e, 0x26d63b7284ce06d7) }, // 15609
+  { teju_literal4(0xc0a4b592c9415845, 0x7c73ea80c9a7bdc8, 0x797c9e69354fb4cc, 0xf264869c3d8f56c7), teju_literal4(0xc5c81c1037381c96, 0x2e82be10f85f6eba, 0x7944854a69c21ee1, 0xc2eb979a14ceed43) }, // 15545
+  { teju_literal4(0x379ae0717623e3a4, 0xde6b31e5bb6e4a4a, 0xc6e4f1538b165dc3, 0x91774977e604180b), teju_literal4(0x963e733dd88b20ee, 0x18d969cf5ea0db51, 0x704369cef96d1038, 0xce48d7e1c7d1988b) }, // 15481
+  { teju_literal4(0x54343488083f8291, 0x0be8c91a781fd68c, 0xd7d35c23ffad08a7, 0x9070427b1e482b9b), teju_literal4(0xe443a5efc1f8ba75, 0xca4a8dab638e9bd3, 0x40b128d36427f334, 0xd2d446b65a650601) }, // 15417
+  { teju_literal4(0x4e9752250f4d4898, 0x07f82061f84af5bc, 0x093b859d66456aca, 0x0e3d8c58c7969f80), teju_literal4(0xad665f5ba5dc4d7f, 0x18266cac802cd7c0, 0x9ec029a6b51a398e, 0xce8c3816fab19aca) }, // 15353
+  { teju_literal4(0x398a4674a3fd2ef8, 0xe5b8212af5e1b76b, 0x8103fbf2e0fe6710, 0xcec02ef2baccc488), teju_literal4(0x83b8f171aba99bfa, 0xd38ee72bccda91e7, 0xd07522798a22eea7, 0x4e199d350c90112c) }, // 15289
+  { teju_literal4(0x9d78f04139ca4948, 0xf6024851ca9d869a, 0x34c3b95aec23c0ab, 0xa29eaf7c5ecef2d3), teju_literal4(0xc81feb8593f15b97, 0x918101272f0f0f24, 0xab0ce79a013b5e96, 0x3ef51b06c3925745) }, // 15225
+  { teju_literal4(0xe57f69f61e402c70, 0x5e15e8a18b4b0f55, 0xa11ee61f8794b180, 0x9c6e3aa5755470b5), teju_literal4(0x980617e75753b662, 0x195f2da94c6a80c8, 0x340e438d6e410d64, 0xf163f2c16c1be723) }, // 15161
+  { teju_literal4(0x9ab633205d13f2cf, 0x0f3ca618574cadc4, 0x36271e207415eae1, 0x57e2737377ce32cf), teju_literal4(0xe6f7e71a66532b9c, 0x6fb7cf5f853e3c21, 0x68f46c105f2a3779, 0x5cd9b8eff383cbd1) }, // 15097
+  { teju_literal4(0x03ad475eeb0eb601, 0x3771cc2a02429883, 0x9bc12c27d3f39f8c, 0x8ce1cebbdc7f2db7), teju_literal4(0xaf743d911e645f20, 0x8b2fd584bf25bb21, 0xd384f8370310c67d, 0x031f6a1cd8b4396f) }, // 15033
+  { teju_literal4(0x140250576ba6ad8d, 0xd457a985c784fbc3, 0xff088b0034007dad, 0xe48d607e4109ab87), teju_literal4(0x85486a969ffb8adb, 0xedc2e08662d76c9b, 0xaf2b482ccf0792cf, 0x5d6aab5af937f67a) }, // 14969
+  { teju_literal4(0x7d51e360ae85d262, 0xd64b55713cafb10c, 0xeeafc6d9f0024917, 0x6db3560b7212bb81), teju_literal4(0xca7ed604cf2afc1a, 0x11ec8974c5bd96dd, 0x39d7d5b60bfcef11, 0x3839e07422baeadc) }, // 14905
+  { teju_literal4(0x91e0e9541dc61c5b, 0xd8f31437a96b54fb, 0xabe037e3ceed37f6, 0x2541434f5991804c), teju_literal4(0x99d32263dbade35b, 0xf8325ba38e2cf03a, 0x6493aa8a0bbe0dd6, 0x04738b08eb6723c9) }, // 14841
+  { teju_literal4(0x31d84eb32d40e1b6, 0xaf9e2c3a83bcb0f3, 0x7ee00fe3c3b6b485, 0xeff63eeb547cecd5), teju_literal4(0xe9b45ba9a6bb7636, 0x90b45e2cdfe8c04e, 0xc0cb2b78dbffa52b, 0xa7f36d2cdc865ccc) }, // 14777
+  { teju_literal4(0x10b08e58d2fa565b, 0x723508e02e685c61, 0x269931b963077ae7, 0x8957d41a6a237073), teju_literal4(0xb1885691ecf01e77, 0xbb39acbbe211c215, 0xaf6ee0d49a140c1d, 0x90d68302d7f007b9) }, // 14713
+  { teju_literal4(0xdc42409accc0bcde, 0x912ffb0003b3b5be, 0x8e40d0073e0052f5, 0x031ee91f24a8b5c0), teju_literal4(0x86dc9f35fdb8321e, 0x4bdfc6d524aacf6e, 0x5f3a3c0c4f851ecd, 0x90b68715b152fd7c) }, // 14649
+  { teju_literal4(0x9485ce97be11d7cd, 0x84d16a787c33b3b8, 0xb97539cd9a989b7b, 0xb15b2d3329d2006f), teju_literal4(0xcce4f11a7d1136a0, 0x08f78874984bfdd9, 0x36429d1daa60cd40, 0xacc89ce764e41ca7) }, // 14585
+  { teju_literal4(0xb75368426c657c92, 0x449cdd9446886f09, 0x5f7a1936a33db87b, 0x5a2ecd15910ffcbe), teju_literal4(0x9ba5a3120a6adff9, 0x17c7a9f180c49cd8, 0xf01c3b292f7386fe, 0x7538e069f8476853) }, // 14521
+  { teju_literal4(0xde55c44d0417d8c1, 0x4b56380e271c8474, 0xd415cbf105b8ec4b, 0xf4fa737c01942e9d), teju_literal4(0xec791c7c51b99a11, 0x17abe56441f49508, 0xb53dd130d4f201b1, 0x1acb9a6f37661f3b) }, // 14457
+  { teju_literal4(0xd693709f92ad66d0, 0xe82624c47e148abe, 0x806d7d1d87dda492, 0x35ea237922c35c27), teju_literal4(0xb3a2bd42957d9683, 0x52d0d76921fb95b1, 0x31859373b19a58a3, 0x8b1528e83710946d) }, // 14393
+  { teju_literal4(0x64d7902dbaa0ccef, 0x0a5ef5141889a225, 0x85c5072ccb25f84b, 0xe83e07773a4b9fc0), teju_literal4(0x88759da9ce531732, 0x6bdafc978d072582, 0x1e42519a32acd1ae, 0x648085c6abd75c64) }, // 14329
+  { teju_literal4(0xb702676820633b83, 0x12c4f9bf97142bb8, 0xe7d0693d5f6ec496, 0x816facd0d99fa7e2), teju_literal4(0xcf5252948be21807, 0x14576fb294f9866f, 0xfcd305b0ec31fbbb, 0xd09a131232fde2b5) }, // 14265
+  { teju_literal4(0x970e83979ef9c4ee, 0x0909ba6e762c36ab, 0x74d0cc8d010018eb, 0x0f460d752d3109e7), teju_literal4(0x9d7daa822d479c6b, 0xb4ce2bf488b73090, 0xa66e8dc27b852e9a, 0x00e15992113e4ec2) }, // 14201
+  { teju_literal4(0x7c2616b4dc27ccf7, 0x5a473258e2c381a3, 0x3f9338f7fa8b56b4, 0x5fdff8aee1c3d4b7), teju_literal4(0xef4642bca2619999, 0x797227891f66e66f, 0xca00164c97e8a9d6, 0xd8f545405143df78) }, // 14137
+  { teju_literal4(0xc0c4a2922f6b4a52, 0xe49e844ee148961c, 0xa095ee77bae79f21, 0xece19d12d2b4b0c8), teju_literal4(0xb5c384c0e7b105d3, 0x273190971561e598, 0x64083b6c35fc16d0, 0xde17cf72c08b9ca3) }, // 14073
+  { teju_literal4(0x1924f5bcd44c1b5b, 0x1509650300b309be, 0x98bc19140ef86c0a, 0xfe94e2409bbedbee), teju_literal4(0x8a137477a176293d, 0xed861db8d01e3511, 0x72d3820eb8fa2131, 0x4e149c9cf6500564) }, // 14009
+  { teju_literal4(0xd0b41350ed4029ba, 0xa459b0c2937304a1, 0xd6c230d32b5a5779, 0x328bac1fa801c580), teju_literal4(0xd1c710830a1e9c11, 0x27818adec5add249, 0x98676bbcfb91b166, 0x01bebc4d4c86048b) }, // 13945
+  { teju_literal4(0x2ef93e4821da75fa, 0x60b69ca3faf3eded, 0xc65c5aa072a93257, 0x1e53bb21c406396e), teju_literal4(0x9f5b4976c97af654, 0x71c229dee3323eea, 0x053e2d03b6e6af60, 0x4b6bf11db081b6a9) }, // 13881
+  { teju_literal4(0x684d86a0d91af335, 0x750a570660683755, 0x6d1ffa3b6e6ed34e, 0xa4fd5e70b508de63), teju_literal4(0xf21be7e125104cd8, 0xebaa102b9168f81d, 0x6f169c0ee1191cc2, 0xb1f27887b959fef2) }, // 13817
+  { teju_literal4(0xa9748a8b2da8d17d, 0x2aae8aa4588273fe, 0xfe1a0add6f652b60, 0xc7bc6e584189a663), teju_literal4(0xb7eac064ac974ae2, 0x79393a3c0d1b1b0e, 0x9bc4fbe884e09728, 0x6f8f35df8bb2f89b) }, // 13753
+  { teju_literal4(0x8fd98e631b352810, 0xa1190bc522ae7f36, 0xa8747bd8a914e7d8, 0x5d3a5853a6fa1672), teju_literal4(0x8bb6325111009f97, 0x8746204025a17035, 0x2bbbd1f608707e41, 0x249280ea715975ad) }, // 13689
+  { teju_literal4(0x4a893a0658ffe180, 0xdc69bb9777c9c13a, 0xa4ed6631ff9e3334, 0xcf6fbd2d2311e9ee), teju_literal4(0xd4434138ef14d5cd, 0x07cec26e3b087fdc, 0x1c7a07b1d2157cfd, 0xe7fec146892bdddd) }, // 13625
+  { teju_literal4(0x479b9b4e6fe27378, 0x3e2a35b7e7af6247, 0x5c301752d1b1b9c3, 0x0c4c716227df578d), teju_literal4(0xa13e90e5380c84a7, 0x28a8e06fef40f9fc, 0x9c36b785883941b3, 0x9c47e433aca2e933) }, // 13561
+  { teju_literal4(0x583ff0edf08be57d, 0x9b4ef645ef8c1c22, 0x4c8d9fa8344b5cfe, 0x15c1a9f9fdb3c72d), teju_literal4(0xf4fa25ad9edde517, 0x7080a2ee7a4ce230, 0x70af11ff5745a0b6, 0x85d83ccee79f6e8b) }, // 13497
+  { teju_literal4(0x61e4622f26b070ac, 0xa8e9f81303d0a1ad, 0x08c3cf2b6fe047be, 0x9bc83c4268f6a6c5), teju_literal4(0xba1883c0567745d0, 0xfd969b73a5d6907f, 0xe08dfcab4a64639a, 0xf18137f2f69a7f5c) }, // 13433
+  { teju_literal4(0x3fbb94f941abc07f, 0xd3428a54302afd65, 0x2ae072e269c3c7fe, 0xc56bb977a59293d4), teju_literal4(0x8d5de61446962578, 0x3a3e2d104d5f4dc0, 0x5d572adbefa2a39e, 0xec5549c5b5d9418d) }, // 13369
+  { teju_literal4(0xe651c8826680766f, 0xe184deebb0bd0a74, 0xdd372c3d212ec050, 0x41cb09949831e15c), teju_literal4(0xd6c6fb4ce5ca44ad, 0xb8d52ea280a50dcf, 0x36bb64b3d5315088, 0xa3c1748c3179d151) }, // 13305
+  { teju_literal4(0x5e652cbbf9cfef1e, 0x5ce8dbda562ee392, 0x170ffb040ca9bfa2, 0x38fa7dcf707f4ddb), teju_literal4(0xa32791f63ff962cb, 0x960b48a398e9715a, 0x1e89262cf78460d8, 0x4ce2a107cd59fd28) }, // 13241
+  { teju_literal4(0x30ffcd06337fa98b, 0x734b733fdba752f7, 0x1d5bdfe467a0d61c, 0x4c84cd78e16ad4f9), teju_literal4(0xf7e11633f7ce58e5, 0xceae7c66ed00ef0a, 0xbcb46caf688ab180, 0x297541fe262e48f8) }, // 13177
+  { teju_literal4(0x3e2ca4d9f95bfe7f, 0xc86c825097e0cd82, 0x332737642aac5a56, 0xabda75b9de17a2a0), teju_literal4(0xbc4ce2a1b2b86d94, 0x9e4f7a2026472349, 0x7a2f9e0dc8330b1c, 0xa8f6edac76a8a111) }, // 13113
+  { teju_literal4(0x088c2c7f1e1aec40, 0x9f658783218bd923, 0x1905ca1fd93bd5a9, 0x2098c9623e54a7bc), teju_literal4(0x8f0a9ecc82c310df, 0x4ee022921fc60eb6, 0xbb70ec9a4996c49a, 0x8c4b4583e5dbf686) }, // 13049
+  { teju_literal4(0xa58d364d67ab0120, 0xca40269469f8d41c, 0x3c68955429652fe8, 0x58939bed73c313c0), teju_literal4(0xd952559a1a4d8ab8, 0x62f7cc4eb988c948, 0xbf4dbcacc7c25cbc, 0x9bbe1618a735a09a) }, // 12985
+  { teju_literal4(0xb2f914f735b18ced, 0xb0355d3a8cd9e5c3, 0x063d85520224a653, 0xa56d44b924ebd59a), teju_literal4(0xa5165e06b22c7411, 0xc5ba8366a499369e, 0x253d1433bc592b83, 0x4eec563d647e549a) }, // 12921
+  { teju_literal4(0xd43bec8e6d818832, 0xe115f97305652c0a, 0xc686f5d62db6b3bf, 0x55d65f79e4e1b512), teju_literal4(0xfad0d3d527c80939, 0x8f19c564d61a21af, 0x5d8a2b7ead6e4f98, 0x97e448927a82d012) }, // 12857
+  { teju_literal4(0xf7ba729034c2a0f5, 0xab657c824ccda1a1, 0x4d93d70aa80c7ffa, 0xb668ccd0a331e997), teju_literal4(0xbe87f1129de4e9ac, 0x733196373cb982e2, 0xea35000b80a1b365, 0x4a988d13fc0e5fd9) }, // 12793
+  { teju_literal4(0x668940e4ff2a5333, 0x94ff09182d4718db, 0x3b8402c3fef921c0, 0x665f86b16a427c01), teju_literal4(0x90bc6bb2a5ba7108, 0x4aacc2d4627e6c68, 0xa2b34e826fda6ff6, 0x452aae29e51259b0) }, // 12729
+  { teju_literal4(0x94bbb597229c9b65, 0x02b9d0402c42d16d, 0x5504f83178dffbae, 0x9a26727278da048e), teju_literal4(0xdbe567410976ce09, 0xbfa16e1a793d7b4e, 0xa280d3d61b9c5825, 0xb99064ab799efc1c) }, // 12665
+  { teju_literal4(0x0460cd60f3939cdb, 0x3fdcdf52980fbc5c, 0xa032ee76695029e6, 0x9b163c71cd9a24c1), teju_literal4(0xa70b06a8074fa92b, 0x3ea35c49fc528e6f, 0x83090d2d582bedae, 0xd671a1adf361b34a) }, // 12601
+  { teju_literal4(0x0a628f262bd3bc28, 0x5d98d4ade4220e1d, 0xe6b54b51254f784e, 0xa8b6bb29026f62f7), teju_literal4(0xfdc979422659097d, 0xb06fc1958bae1f90, 0xe13e8c224f34deb2, 0xbf1a87d1ee07f66e) }, // 12537
+  { teju_literal4(0x6a58565cbfd69149, 0xb4ab3fb3635aacd7, 0x993def9a8abc1798, 0x6a9087cff815a7a5), teju_literal4(0xc0c9c359b9cd9485, 0x6454c9e668869c48, 0x4fd60c501a890fbb, 0xc9f883f79eeea708) }, // 12473
+  { teju_literal4(0x07db2fd1c56444ff, 0xec7e452f6877365e, 0x7125f5bb0836d505, 0xef8343b571952c4f), teju_literal4(0x92735c2db9b2cf5f, 0x5516f779c86034da, 0x386ccc166c9af400, 0xe0d7c8dd4f467d4c) }, // 12409
+  { teju_literal4(0xfde978eb6f6210e9, 0xc287ec9bb705e60a, 0xbeadbbc8f1f7c95d, 0x266523d11772c876), teju_literal4(0xde8047a8531e260f, 0xdb723f147568d440, 0xa4d5d3e2b8d3417f, 0xfb593e2d46bc982e) }, // 12345
+  { teju_literal4(0x7ecb8b4870bb20a7, 0xd563605f9ca44a51, 0x1e2b956069af62d3, 0x82af2ef9f44196f2), teju_literal4(0xa9059da0ff7be225, 0x55d5a9942eec0b86, 0xe13720234d6a4e22, 0xce4dc624cf6a4fe7) }, // 12281
+  { teju_literal4(0x481741859b1b2b35, 0x4421e48a22f89260, 0x07b90700607f8102, 0x8f12b6ae8b42c168), teju_literal4(0x806590be6ea9c6ff, 0x68eb63d4e4e967f6, 0x12b62cd7110ccff8, 0x8ab08b8ff8acdd1d) }, // 12217
+  { teju_literal4(0x3a5a5878698d5d8a, 0xcf8eb47ae23709de, 0x354ce27009949179, 0xa09aef3b0d11c219), teju_literal4(0xc3126dfb25d65e22, 0xf7931da65c58eb27, 0xbad5a48c3d279964, 0x8e09b88ae72d5eaf) }, // 12153
+  { teju_literal4(0x10a3b5840aa77ae7, 0xa09c3410d39e6d29, 0x834d8f9f95188dd8, 0xc8cec44cb67ed259), teju_literal4(0x942f7fd37ee68c99, 0xe83d48622318f670, 0x9a4ed6a8dd21ec6c, 0x4a6836f67a9fa0b5) }, // 12089
+  { teju_literal4(0x762e65f9445c51c8, 0xefb641b2a975cc30, 0xbe2b8afb91589b80, 0x8a3dd5d7b32458cd), teju_literal4(0xe1230e7d8ecf8b33, 0xcfcb73d359f5fb1d, 0x4f5760494c179490, 0x4455682aef956138) }, // 12025
+  { teju_literal4(0xdaee3ef0e2291349, 0x67956761b7fdb130, 0x4b0ae40e172eb1b3, 0x54a7cdce26f49137), teju_literal4(0xab0634ee43cd185f, 0x6a8fcaabdf2ad866, 0xe3a005ff0a525759, 0x2e496fa54b897bd6) }, // 11961
+  { teju_literal4(0x5b69f9bc01909225, 0x62a48a641cae5871, 0x7ac664c2f71de0ab, 0x66833d3d30aae449), teju_literal4(0x81eaf3ec8f250ef5, 0x842e6a3e24b93e1a, 0x8b7aedca57571f30, 0xe409eec2b6344e9b) }, // 11897
+  { teju_literal4(0x6726c77b18f16ac3, 0x0612bef522b124c3, 0xb81b554428c4f33d, 0xa4cf1ca31f2a8b43), teju_literal4(0xc56205b939719a3b, 0x9ff8b194bd6271cf, 0x76e6be7b7dde65e4, 0x9b4f9ab379618344) }, // 11833
+  { teju_literal4(0x5026c3a9e542c9dd, 0x6dddc39c2bacba01, 0x5cd4c088c8991a27, 0x8e76d0bc6b868d63), teju_literal4(0x95f0e668f93cd27f, 0xb858b0b0a1d35470, 0xce37c825c3e8e680, 0xec7c528c8540c756) }, // 11769
+  { teju_literal4(0x73e7c38f559cab94, 0xe34c0d9b4d3b6222, 0x983d105b86beb0b6, 0xe2e600079b5893fd), teju_literal4(0xe3cdd3b62303d651, 0xbdf12b642295e799, 0xb3c695d5e782b479, 0x59e64f20b392d3a3) }, // 11705
+  { teju_literal4(0x9dfb401d762985b2, 0xe07ef6345e5a2b33, 0xbc60a8109958214a, 0xbdeb9110d6e55022), teju_literal4(0xad0cdec309e08d29, 0xb00cc6deda876573, 0xe1df4af9efb44e0b, 0x1195aa3995dd1a6b) }, // 11641
+  { teju_literal4(0x3454e1b251478088, 0x7cacdefdab45b5b6, 0xdf12cac54d539e88, 0xf937989d09de6820), teju_literal4(0x8374f3fecd7a201e, 0xa8d865358ca794af, 0x6812a4676fc6bec8, 0xfb50d4a79e539153) }, // 11577
+  { teju_literal4(0x5a1cd1c521606dd4, 0x23a76d09105b0c9a, 0xdc62f2fe754f5703, 0x86a3ac645db750a4), teju_literal4(0xc7b89f9540d0d8d0, 0x36ed7bda38b008bd, 0xcef539922d3f8163, 0x87ca4edc9930f3a9) }, // 11513
+  { teju_literal4(0x8c9db4f7f72ad2c0, 0xe6c37d35c978ed98, 0x0291cfc80a525f18, 0x737fae051d08d5d7), teju_literal4(0x97b79fe2ffa02202, 0xf9c45d39e4b855f1, 0x90ef1ab731d2cdde, 0xda1df55cd53ea57e) }, // 11449
+  { teju_literal4(0xa2bbdc1f5a938566, 0x7cc3d106b3cc0123, 0x2b7c82cfb40e72e1, 0x966dc73b9062d7d3), teju_literal4(0xe680af901ee67444, 0xa42db5da792675b3, 0x5fc6eadfccc8684d, 0x649a29cb681865b6) }, // 11385
+  { teju_literal4(0xfc330c6d9586c69e, 0x28e9923032d418d0, 0x47cad391efa09129, 0x47a9058d4e3c0a8f), teju_literal4(0xaf19ad89b942cb1f, 0x324fa5b3aff6170c, 0x4ee3f281d56f4926, 0xd585bf52cfb2e0a4) }, // 11321
+  { teju_literal4(0xa4986b88cd47cee3, 0x48400c269b7bf5e4, 0xc0e6ab36210dc2a1, 0xb2e186c0d86da6f5), teju_literal4(0x85039ef270423aad, 0xc7bc9d45ea6b85ae, 0x5677907faea7b889, 0xeb3fe31904d49564) }, // 11257
+  { teju_literal4(0xc539ebf9592fddc7, 0xb5f1bedded2f0bd9, 0x51a15b89d3779445, 0x6145d2908e4a4a93), teju_literal4(0xca1650d03bd1fc5a, 0xc69faf42e16fa86d, 0x60ee8ab1f4bae302, 0x17c0f0b35087f6f8) }, // 11193
+  { teju_literal4(0x7c2325432177832c, 0xe4cb15c18900e448, 0x3474333e7b2978ae, 0x38fa94330bb5e725), teju_literal4(0x9983bc66cd079488, 0x2265353876fa583a, 0xc69076f876ecf249, 0x17d624033f4b05c9) }, // 11129
+  { teju_literal4(0x35563aa15de0f630, 0x95d632eac1eadbdb, 0xcea0c2dddc07488b, 0x183a7d05772d7a30), teju_literal4(0xe93bba9316af88f8, 0x692a2663ec4107f0, 0xecac6dd7300eca9c, 0x1ffe24a05ad9dac8) }, // 11065
+  { teju_literal4(0xa54817ac35dcb3cd, 0x9237032033cca684, 0x7ee6173b0b8fe8e5, 0x6be9378bbe0ee8d7), teju_literal4(0xb12cb3e492d359e8, 0x8f559411011e15e1, 0xaa02fc18b60aa46e, 0x42122e82cdf7019b) }, // 11001
+  { teju_literal4(0xb1da8663f3b1f12c, 0x8a98dd1839d06d9c, 0x72e18d042ec56045, 0xcc6d0664dac6ff4e), teju_literal4(0x869702ef2afc34f6, 0x8cbfefb64f0248a0, 0xa470351b1b573acb, 0x59c77042ba090f63) }, // 10937
+  { teju_literal4(0x22b1ab246607faa0, 0xc014e20b235ac0b9, 0x04dace8437333171, 0x70081c844722407e), teju_literal4(0xcc7b2eeb9f2f5502, 0x3283d8c19828970e, 0xbae328d8fb3560f6, 0x2ffb8ada0c464817) }, // 10873
+  { teju_literal4(0x18c5f622bf6a363e, 0x8bd876aa293617ca, 0xacfe8508ac76cf34, 0x252d2ec491fa30d1), teju_literal4(0x9b554c4a9337f6ac, 0x7aa08ebf58e0104f, 0x351cfbd4b4d704ca, 0x8b1aed39bc3d68a7) }, // 10809
+  { teju_literal4(0xfaf047d734a40541, 0xb5109a026250bb6f, 0x11f17779ffb02318, 0x4512cecb3f5076bf), teju_literal4(0xebff0d91029a54e7, 0x85b44750ebdb3f8d, 0xa88dbc6894544005, 0xce94c6e56b475ea0) }, // 10745
+  { teju_literal4(0x945c4db6de643c41, 0xaf6f0ed4f15ae26c, 0x9123ebc56f27a4f5, 0xa353460b39541d03), teju_literal4(0xb34604ae5a2415e5, 0x0dfeedfcd2740d04, 0x8ff388eefcc6a53e, 0x39f2f0b1f63e5f62) }, // 10681
+  { teju_literal4(0x4fe339547d0b2b5e, 0x804131fa37a584b7, 0x554531ebc6eeda08, 0x0d1798abb42974da), teju_literal4(0x882f2e479eb63540, 0x1a84f8f1929b2ee2, 0x569db331d1055c85, 0xe291a7b07dcbfe4b) }, // 10617
+  { teju_literal4(0xe8cba6796342579d, 0x208bcfbf3a4ff114, 0x409fc55bef0fcfca, 0x5e7225085722cdff), teju_literal4(0xcee74faa17f99ccf, 0x4e459f1e3356fa6b, 0x9c4cd81fc181106b, 0xcb5fee0466e2fe86) }, // 10553
+  { teju_literal4(0xd284935b44833931, 0x5cd3c463e530e8c9, 0x0cfdcc7f47b005f1, 0xca45eb82e81b8826), teju_literal4(0x9d2c60160f41f278, 0xd849cb00433d99cb, 0xaee523f85184b007, 0xcfe7d9cca5818399) }, // 10489
+  { teju_literal4(0x80f4805c47e3694b, 0xb0158eb5a09d87c9, 0x4db53ebbd275b15b, 0xfe3a595bb718885f), teju_literal4(0xeecac1a7207fc7a3, 0xde8e918a3e5abe09, 0xafd8afe1893e5209, 0x6423f1300b574620) }, // 10425
+  { teju_literal4(0x5f291805d199939f, 0x9daaf420c6cd3d25, 0xefc71386c0002542, 0xb3ab799977a9d02f), teju_literal4(0xb565b2fb00da2f3d, 0xf18743fecc0ea89e, 0xe446476de9cc2ce1, 0x29f0d09acbb1d244) }, // 10361
+  { teju_literal4(0x702dd6660c71c8d5, 0x5fdb4fbf2d0450bf, 0xb9b0fa5e345a5d6f, 0xefc92c3d9fd1c25a), teju_literal4(0x89cc2f79dc3d9d7b, 0x8988ddadcc322dd6, 0xe765e292274053fa, 0xd711562dccafea98) }, // 10297
+  { teju_literal4(0xb4fb4ec96d8b7cc7, 0x3d8bd8558e2260f2, 0x76b71610d33d2278, 0x9f994c3930a55dd1), teju_literal4(0xd15ac9105162c5ad, 0x501fda73266974d3, 0xf36a8d0c16516769, 0xf2354a376914c5c4) }, // 10233
+  { teju_literal4(0x84705718e36aac4e, 0x527b1c3912c68cf8, 0x59c8add75fa8dad8, 0x8df32aa9e7d9478e), teju_literal4(0x9f0908831fc28ebb, 0x40eaf0726f612b82, 0x723dcc184f54b319, 0x4b8926f2f3361908) }, // 10169
+  { teju_literal4(0xe01f5dfb5b540f6f, 0xb681d34c582d9380, 0x43df6b3f31e5fbcb, 0x20108910718fdf7e), teju_literal4(0xf19ef03ed81d420c, 0x7e56ee88e6bccf88, 0x5bd05e7e00690388, 0x386f1afb1d6623e2) }, // 10105
+  { teju_literal4(0x39d6f385a64c30a3, 0x0f01f1c4050935df, 0xe507d4ca7275f68e, 0xfe37adc19cac159e), teju_literal4(0xb78bd2185416e624, 0xc762e68c8b26bc61, 0x46b3024f2e7f31de, 0x10352c6ff6347f57) }, // 10041
+  { teju_literal4(0x86b5b1c97bc67ab6, 0x7d69afd901b3b78f, 0x6f564c357659edf1, 0xd58e50ccde00325f), teju_literal4(0x8b6e152fe7d9c835, 0x2b4ae3d46b73f03f, 0xf8953bcf611eb0dc, 0x7ac6eba678175b4e) }, // 9977
+  { teju_literal4(0x2463739c35d4bde6, 0x09b3feae808eae7e, 0x41e76008b0038697, 0xc40e3fc88a27249a), teju_literal4(0xd3d5b165bce09f0b, 0xfe5975005873d0dc, 0x82a8c16148064012, 0x18f63b5e209a9714) }, // 9913
+  { teju_literal4(0x8e46bb944104bb4a, 0xb573bf85d8ee2f7b, 0x8425919dd261105b, 0x2daf6ef05a00807b), teju_literal4(0xa0eb567e5ceb593f, 0x802f57ea7d9baf86, 0xa61303191a6cbbc5, 0xbd4f18599e5cd11f) }, // 9849
+  { teju_literal4(0x09126961e20877dc, 0x6e54cded7cd9e8ca, 0xd7627c2a7bb85f72, 0x3d4f27ec253c9662), teju_literal4(0xf47bb30ea20fa31c, 0xcd461add22d2acf4, 0x7312dd61fa89c39d, 0xa7e6c7027cbe4ee2) }, // 9785
+  { teju_literal4(0x76e65605b282af06, 0x82e9d89bd0460d96, 0xc872412d32d73812, 0x7f7cb81d4624f49f), teju_literal4(0xb9b8758eabee2c71, 0x9b933c8a249ed5de, 0xa150a11873f37409, 0xaa0b158a089b67cb) }, // 9721
+  { teju_literal4(0x5a390de53027e06a, 0xc5b593809a504aaa, 0x30fa78b8ca997ebd, 0xa056630b14b62b9b), teju_literal4(0x8d14ee403e96441c, 0x45d8a04da39c5f1b, 0x5c899753d74bbbf3, 0x2f799a3ce2974f18) }, // 9657
+  { teju_literal4(0x69884ef518fd3117, 0x338383d975a311e6, 0xa82c537e8e30023c, 0xa3a190eaa7ef627f), teju_literal4(0xd6581f355cae6e46, 0x3fe8a5324905a2e8, 0xbcad67aee106b221, 0x4d330fbcda6755ed) }, // 9593
+  { teju_literal4(0x0ef6a665e9775b16, 0x8a239ecd4bb4e0d9, 0x1f69b2d140e9148d, 0x7cc9fa74d3a9bc6c), teju_literal4(0xa2d35b27b257a1cc, 0x8c57656b30ccbd02, 0x2d074d43d2f794ef, 0x82548c1702358bc4) }, // 9529
+  { teju_literal4(0xd7ea6304b02e79fe, 0x4c3b4e32f200e33b, 0xf297b44ef638bf55, 0x0a5053bed4986cd0), teju_literal4(0xf761241af18ad2d6, 0x7e52947a5e313093, 0x103b8c16e1de895b, 0x5d11c6c350c593ef) }, // 9465
+  { teju_literal4(0x50d19c5d2125e337, 0x3f910a3d4579f3bf, 0xc797c05ad8eedb84, 0x5d1485f4a6a488ad), teju_literal4(0xbbebb1219cf16782, 0x24b6bbc348247f6d, 0xc7abf647cb5fdfbe, 0x9982c2c2db82e2c2) }, // 9401
+  { teju_literal4(0xcd76c7327322bfab, 0xb4051ad2398c67cb, 0x21b6f1c70435bfac, 0xb22db1d7955df0e8), teju_literal4(0x8ec0c9ae5d2149ac, 0x334341c61d26a8dc, 0xe9dde51dcbc2f594, 0x4b6156d18c689b1c) }, // 9337
+  { teju_literal4(0x169b96228bc67119, 0xf183fbb933b36f60, 0xcfbaab3ddc799790, 0x8d03b8c752f4af9f), teju_literal4(0xd8e2294e90b4aa7c, 0x97963af086c5d21d, 0x13558414b9cb40f6, 0x371b8f7241265701) }, // 9273
+  { teju_literal4(0xef9f6cf92eb3ce7e, 0x08c2b44fbecb20e9, 0xc8c0b6d51adc006d, 0xaed5ae766bbc3779), teju_literal4(0xa4c127d2fab43c2b, 0x70881085fc09d5bc, 0x6c358e988acca630, 0x0c7fcbf8d4cff00a) }, // 9209
+  { teju_literal4(0x18769af5aca1ec07, 0x93375a79fd2a5ae8, 0xdcab4103567c9dc2, 0xa4e5c22ff0b3bd7b), teju_literal4(0xfa4f5db720d617a6, 0x8e8bdd60b46ce50c, 0x30448e8bf0574c60, 0x7522c5e8d0e986fc) }, // 9145
+  { teju_literal4(0xf952fb794179d662, 0x8acd3163ab107d3c, 0xebeee2943ff6e638, 0xac55c03089b629ff), teju_literal4(0xbe2598d0abd4a01f, 0xbeff04a614663da8, 0x4093a3a336a77af8, 0x81ccbb9d3e36cd43) }, // 9081
+  { teju_literal4(0xbcc5785b1a539b83, 0xf0ac0ba5b7faedf1, 0xe5dc676e16b549ce, 0x5c9628bd5278ce04), teju_literal4(0x9071b6ab484334dc, 0x0c06796277cd4563, 0xe1584b99ed705ffd, 0x36dbc18f38827ccc) }, // 9017
+  { teju_literal4(0xdc1b7363a5aae383, 0x5f22b1570b8104bc, 0x70e3369b50a3de58, 0x6b708a0df6b7fe6c), teju_literal4(0xdb73e6c5e5de2261, 0x4b48b1bd0cc3a96e, 0xcf5861d5a74b32c0, 0xae331e35f6300050) }, // 8953
+  { teju_literal4(0xedfae1fb174e5c9e, 0x0a8b72310144fe95, 0x4eee7be019d660cd, 0xc4f255643069e89d), teju_literal4(0xa6b4ce089d3f500c, 0xf84db0de6668e7c6, 0xc7281a3783e794e0, 0x63818bf4a7eab85e) }, // 8889
+  { teju_literal4(0x3d9c2802920eb4dc, 0xd72ae0a5dec2e271, 0x2181b44a7b58d5e1, 0x1bff9b7d4f7b99ac), teju_literal4(0xfd467a8660959bd0, 0x465fd6df31ce26d9, 0xe44a0a4d3ce06348, 0xa8da349eb5a5973a) }, // 8825
+  { teju_literal4(0x4e1e764fb502bbed, 0x39a53f58a7d04a35, 0x96f517782355ac85, 0xa8a4d1cc20bf4140), teju_literal4(0xc06640d803348150, 0x1f8b5ee24b401a4e, 0xfdff24bdfb76bea1, 0x6c5d8b3df751827d) }, // 8761
+  { teju_literal4(0x788ed5f0f0438797, 0x8cbfa321853a5131, 0x7e6fc48fb2203fcd, 0xe8f4c67df7072680), teju_literal4(0x9227c49616f3db3f, 0xc5bbb9362e1bcfd0, 0x760df2ac3d36c4ea, 0x3da98933c05bc6e6) }, // 8697
+  { teju_literal4(0x74f7b01f81c05d59, 0xcf02a810198f3f90, 0xc54f4b33b5cb7105, 0x08bf112268bdef3e), teju_literal4(0xde0d6ef5e7e1e884, 0x54964bcee7a52ccf, 0x0f6c6e89c7cdca28, 0xa68c914cb8cc9e9d) }, // 8633
+  { teju_literal4(0xb8fe386f3f213088, 0x22ef952c7f313858, 0x406e513dc446d510, 0x4d7b2983936249d5), teju_literal4(0xa8ae5f862d25ce66, 0x17575c579fa8e5bf, 0xf074cf241a968793, 0x5241c386c59c6e94) }, // 8569
+  { teju_literal4(0xb603ade894c7f2b9, 0xd782425e61f012af, 0x6ad0d7904d016706, 0xfcc00fd07497e996), teju_literal4(0x80234abe54f4d0f0, 0x08d6023a283c8a23, 0xd286e073056f00ca, 0xfe70d755077dbdaa) }, // 8505
+  { teju_literal4(0xa76ed400e71b7b04, 0x9c171ba60e0c93d5, 0x11b2ae70a1dddf66, 0xc25334039b5c70c0), teju_literal4(0xc2adbdb12b839a4c, 0xb62c6d5c3557327b, 0x3c063c282c6865fc, 0x69fbd8cceb3aa3ee) }, // 8441
+  { teju_literal4(0x8a2b108a9124b035, 0xa219e4f6f8867948, 0xfcbd92cb386ce0bb, 0xa25e156c99f5460d), teju_literal4(0x93e302fc7e12a5b7, 0x7c95a02a619bbf65, 0x0787726c900d858d, 0x8fb49b5483b26bd8) }, // 8377
+  { teju_literal4(0xb74b5a8274322f85, 0xe25cfb9de8f46907, 0x3725a6f29b8bcdb7, 0x3ced4a0cf8248e1c), teju_literal4(0xe0aed97ff5897900, 0x7ceb8c1539d5bff3, 0xf4d2fa56398a9164, 0x454a93c7cf268634) }, // 8313
+  { teju_literal4(0x7c43bd1a193b446e, 0xc9b8bbd69d1b94e3, 0xbe27544641ea5287, 0x4e2b3e2e53868d3b), teju_literal4(0xaaadee3f0ac434d0, 0x9ca004efddb519a5, 0xc4da81dcc9ee9fec, 0xa5d38a8a0ca92a7a) }, // 8249
+  { teju_literal4(0xf6d12865e0e056b8, 0x092f704dda6c7bae, 0x68126c30c58c9967, 0x29ce9dc6e4834735), teju_literal4(0x81a7e4efd9b60076, 0x113aa523e6bd0c54, 0x2278df128d72b68e, 0x6f0f63d3f959f7e1) }, // 8185
+  { teju_literal4(0x729e227b83b053d7, 0x58cb96ed274f7950, 0x1c5049341206c65d, 0x9ce182c0ec690ed8), teju_literal4(0xc4fc2413c5256b6f, 0x6a232c2d2f14a533, 0x811fbd2bc9323ee5, 0x87a6539a604d20b5) }, // 8121
+  { teju_literal4(0x554caf380d48603f, 0x1bdcb2b7b9b72b5e, 0xe188964a2a9d72be, 0x5d5523b622c184a3), teju_literal4(0x95a3819b5dc663a7, 0xfba071661ba0c54e, 0x70e666ca496e4c18, 0x02e2f97161fce08d) }, // 8057
+  { teju_literal4(0xe1f75c1a9a785db8, 0x05284370dbc8ddc0, 0x0b29472d7f528341, 0xf0408d1d5ef9f1e7), teju_literal4(0xe3583e4d177aa202, 0x01650ee4807fe6cf, 0x2fd1c796715c78ec, 0x01db417c02a7211d) }, // 7993
+  { teju_literal4(0x7dffcd2ba9ed564f, 0x30f224551880258b, 0x7e771465f39b377f, 0xffcfbce149732ba2), teju_literal4(0xacb38c5d06d058a6, 0xc31351284e50b20e, 0x8ada72d134a30aad, 0x485d8da5d9f94342) }, // 7929
+  { teju_literal4(0xb7a5ed3d256bec78, 0x1ed764a31c43b914, 0xc9a3852fe5fe5da4, 0xf131cfcecffa62a3), teju_literal4(0x833119a3f48a4dbd, 0x8a8aebaa72065e5a, 0xfc33be43abc2f4c3, 0xd9c38e89174bf8fb) }, // 7865
+  { teju_literal4(0xb54108b885576799, 0xbea6109ff47af438, 0x41827462caff76ee, 0xe302ffe6d9ef27d5), teju_literal4(0xc75188f644bdd9b1, 0x70ea2cfc50dbcad8, 0xc467f28f88f086bb, 0xc00dc1ecbaa6e6b9) }, // 7801
+  { teju_literal4(0xd22d52109e50bd67, 0x679c6ca7283d0ad7, 0x794b7f9e568fbcf1, 0x45ea5f0ea9d95a6d), teju_literal4(0x9769505f5089dcc3, 0x0ccb708d7f3292ba, 0x5e0d750b2ca4cbad, 0x02a8305d6e14659d) }, // 7737
+  { teju_literal4(0xb8e8005d427d7e52, 0xe19b6db2ff5e7c7d, 0x4d8f5be9d16dd512, 0x0a41f9c8dd1228be), teju_literal4(0xe609b58ed98ccf7a, 0x964585602d629048, 0x2217113274f16e3f, 0x216be515171f8ed4) }, // 7673
+  { teju_literal4(0xba41db3450e000f0, 0x0e3859b683dfdb76, 0xd98239cc9e8bada9, 0x9a9fb4cd0442c2bb), teju_literal4(0xaebf4c41077204ed, 0x3f38469c19e383f5, 0x816bbd6defc066a3, 0xf87ba756beb5273e) }, // 7609
+  { teju_literal4(0xe99873cedc0309bf, 0x048a19579f825572, 0x5cd72f7ea4eec719, 0xc9fb6245650086d8), teju_literal4(0x84bef6d0b386cf25, 0x104e1f2c6cf5a9b9, 0x5baae46d8094b123, 0x3a391aa309460433) }, // 7545
+  { teju_literal4(0xb82cfc35a783297c, 0xed26050c1c117d2c, 0x875374c2f83244cb, 0xdf545305202b2218), teju_literal4(0xc9ae018eb1bbb863, 0x20891a72ef953bdb, 0x53bb18f0d88dbdb4, 0xd6d45e784be6c2aa) }, // 7481
+  { teju_literal4(0x9a7e38054fb40d1c, 0xcf15284d9e5ad54a, 0xff7921a4c3ce993d, 0x54cb2b2ac59ab3f7), teju_literal4(0x99347f653bea359f, 0x2f0bd7c8c9bb0849, 0xeecef1271cd6530b, 0xb7e569ae104bec4e) }, // 7417
+  { teju_literal4(0x0d845ba7bc20ea67, 0xc9260110e506bf65, 0xf917541cd1631d81, 0x911fddd874c7d38e), teju_literal4(0xe8c357c026b17177, 0x6f75acbb381bc7b1, 0xf5b59acd09a3beef, 0x5a697fc2bcf4f588) }, // 7353
+  { teju_literal4(0x16cf1280bc078df5, 0xd9239f9d03cfeb5b, 0xefeafbfd06dcf80b, 0x460bd8cf2d5e133b), teju_literal4(0xb0d14083af5047b1, 0x1f5eb71574373fc1, 0xb51dac599517155f, 0xf4c7c5ea49905a68) }, // 7289
+  { teju_literal4(0xc921d3f4738d076c, 0x9d07dbe688a06334, 0xe60ba251c24308c0, 0x73c7440cb13c1025), teju_literal4(0x86518a967bc0376e, 0xd9606b78dc762a04, 0x88cc3915551823dd, 0xe44fb9f84edb91c7) }, // 7225
+  { teju_literal4(0xfe9abdbf70b5699e, 0x3df6b1565a1f1bf4, 0xace6e15ca7ef9fd3, 0x39c7e25e814bf577), teju_literal4(0xcc11a35367252d0a, 0x877e50b7d83013c5, 0xac144c128207e668, 0x68c0370c43e90bf0) }, // 7161
+  { teju_literal4(0xacd585cc6c59bce2, 0xb84271d8ce3ec9dc, 0xa9cc3371f78458f3, 0x1005c5870f38d625), teju_literal4(0x9b051efae2fc4ac5, 0x90db7c1465d57b1c, 0xb1ef18436a6d8c58, 0xe2d66ad3d5093c49) }, // 7097
+  { teju_literal4(0xc864cd0c769c86c8, 0x69e8dc86ff952037, 0xddad53fec9080b27, 0xdd771d396cc3ea89), teju_literal4(0xeb853da627774bf4, 0xe4f5cab25646a8fa, 0xf1c64dc7cac9f1f1, 0xcd360ae4472ee00f) }, // 7033
+  { teju_literal4(0xe7cc019d50475ea2, 0x4d8b11626efe7536, 0x7da9851aaf801384, 0x42c772eed183817f), teju_literal4(0xb2e97bf606995d45, 0xd1e8040c1178908e, 0xb47e746cb6661713, 0x4c7ced3c10be5be5) }, // 6969
+  { teju_literal4(0x2c18ad2875a8d466, 0xeb1e23c42b2f6a36, 0xf36ccbf79f53d987, 0xba5cae3f6e2b4f21), teju_literal4(0x87e8e34089b22664, 0xcf6f8b652785af98, 0x49bf12cf213fb5ba, 0x347882243890f2af) }, // 6905
+  { teju_literal4(0x00c3a4e16d0a5519, 0xbffc5da2c38d0da4, 0x24bb9cc7c9c91125, 0x3692c67ef40229f5), teju_literal4(0xce7c83fbd6acc5da, 0xfb3fb44140c95bd0, 0xa36c66d9b676e85f, 0xef0280bec29f452b) }, // 6841
+  { teju_literal4(0x0f73ae5428048e5b, 0xe2d8a6c6fb0292bc, 0x6cc7050e4c6a0833, 0x3a2b04db1804006d), teju_literal4(0x9cdb3f9f7a8e3573, 0x23ed5d5a603ee40a, 0xa9328059989781fc, 0xa00687442389eae0) }, // 6777
+  { teju_literal4(0xd99a3dbecbc6ee76, 0x0ad46cb8ca3091de, 0x29e7112b19bcc59b, 0x27284b846f4f5533), teju_literal4(0xee4f8051233096b9, 0x344d59d10edb1ab3, 0xf9c0fa462967a0f0, 0x68828fee3da84853) }, // 6713
+  { teju_literal4(0x98f7bfc6be1914d1, 0x9cbf8981352c932a, 0xfa5a6954d63b394e, 0xe29ae75193d0cffb), teju_literal4(0xb50811a2260b39cc, 0x8d1e98a0d95982cf, 0x0fcd1e126fc3b460, 0x55aa62600000a3f9) }, // 6649
+  { teju_literal4(0x9287c73d20a15ab3, 0x3d4a0b9f561c56af, 0xfb7662495d2a8f51, 0x38aee5e407744f54), teju_literal4(0x89850f45732be1f9, 0x1c2399c9cbf2a514, 0xca41294d1142e05b, 0x50cecc0ad897b856) }, // 6585
+  { teju_literal4(0x0ee6dd945d6508eb, 0x94c2f739b61174f0, 0x2bbda9ea1aabcbd0, 0x66954257793837f8), teju_literal4(0xd0eeb9814e162ffa, 0x6e30ba91c8f103e8, 0x99b6f62bcd8dc271, 0x26007f899341ef53) }, // 6521
+  { teju_literal4(0xe2c510678d02adc0, 0xf2df18e1f9fed146, 0x8bf6ed2f7c253582, 0xae7e509925d701ce), teju_literal4(0x9eb6f2043f1a3d0e, 0xd9dc3236355e0b64, 0xd57f45b557616366, 0x92d5a09f2ffd693c) }, // 6457
+  { teju_literal4(0x8942058648824c1e, 0x26c2ab67db3e0395, 0xe5e474b8b396a30a, 0xb14801d38e73f1cf), teju_literal4(0xf122391d63c3ebb5, 0x9a1210674f552337, 0x254558ca0adc8138, 0xba49aa2513b543fd) }, // 6393
+  { teju_literal4(0x413a45168b3ad761, 0xdecd955d981972b9, 0xbaa3c215ffec7901, 0x01d423a2e7d954ba), teju_literal4(0xb72d14cbe402c3a1, 0xc929d7d19cf9b82e, 0x0a60081dc99e6584, 0x3d4cc2fe5b980370) }, // 6329
+  { teju_literal4(0x2b83ef44b726c226, 0x36bf75233fe00a2c, 0x4afb52cd1631d1b9, 0xbfefdbf9c8a279c9), teju_literal4(0x8b261d47aac714d7, 0x61348ca4d879a4ac, 0x3e04a2687b250d5e, 0x12892ad49ea43e6b) }, // 6265
+  { teju_literal4(0xf772856525854e85, 0x37ae903fba93b15e, 0x9e2caa86278949a5, 0x8fb865036ce99621), teju_literal4(0xd3685a1fbef18fca, 0xf3633c69d8d8fb3d, 0x792f04e205105624, 0xa9d2a2080bec66e9) }, // 6201
+  { teju_literal4(0x23a04ed386bd2165, 0x65e08d2ee87917a7, 0x6847ae3dbab644f5, 0x15c22860dfd020b8), teju_literal4(0xa098470d0c80884c, 0x282afd23252dbe6f, 0xab5f052b99636f43, 0x081c37a4328153de) }, // 6137
+  { teju_literal4(0xd650642845ca6877, 0x32750f33c1dd4789, 0x1ad26a4b1876956b, 0xbbcb85b9aee83aaf), teju_literal4(0xf3fd81b41c301aab, 0x625bf7c7b84ef444, 0x9e5037d03e6702f7, 0xce1146f3113649f9) }, // 6073
+  { teju_literal4(0x17c49b74324960b5, 0xf7a0c2a3e0f245f1, 0xe1078156dc51253b, 0xd8c4c57dc3430129), teju_literal4(0xb95898f18397e3b8, 0x24766e33fd8d8d59, 0x6277a52c979f7326, 0xe01c18ca00c7a58f) }, // 6009
+  { teju_literal4(0xcf22ef9145260f28, 0xe022c72f562a5806, 0x7fbe37c13e0e87db, 0xb4f3d0e81c8be29f), teju_literal4(0x8ccc1c1604ed3d58, 0x4812fd9d7455da1c, 0x8597060992482da4, 0x334f95cae11e9c54) }, // 5945
+  { teju_literal4(0xcaafc8c82845d9c2, 0xd2460645923c7b99, 0x1e25e525fc5ae56e, 0x807a2ce38b310c4d), teju_literal4(0xd5e97c5688b492b0, 0x207ad6d11111ddc1, 0xf9a2071cdccf47b7, 0x563a7518ade930b3) }, // 5881
+  { teju_literal4(0xfdf1a059d304b0a5, 0x14d83d80020bcee5, 0x20f120f766399428, 0xfa4b71df3b069fe1), teju_literal4(0xa27f4fd0f78cf116, 0x65391d6bdc5f6470, 0x1fa0f4636da1ae51, 0x7e166c0f0c5e0dd2) }, // 5817
+  { teju_literal4(0x845e82f740a0a798, 0xcc90ea167043dfac, 0x13ddbc332765e822, 0x4adf0ac336924afc), teju_literal4(0xf6e1740c51cb115a, 0x78c60235c4065987, 0xe852189e59b0be8b, 0x353802d18b975ea2) }, // 5753
+  { teju_literal4(0xf209334901ccdee1, 0x611fa9ad77a0fd18, 0x6556fced7797a4b0, 0xe15bb67d5bb37c08), teju_literal4(0xbb8ab1cc65cca38a, 0x8ccaf7b681d96a10, 0x03a9e0817b0b2f9d, 0xf905bbdab32d4134) }, // 5689
+  { teju_literal4(0xa2bfc8aa56d370d4, 0x8ca9636bc6b317d2, 0x8e669c8eb22397b2, 0x71eb373e706a7615), teju_literal4(0x8e771aac3e7085f0, 0xfaaa95baac656e47, 0x5f28e5542c9311dc, 0x2b5be9ab51136d05) }, // 5625
+  { teju_literal4(0xfa698ddbeeba7c27, 0xdd0186c1b97ca24b, 0xe71319380c5f2b95, 0xe2138feb0283d75e), teju_literal4(0xd87236e945386749, 0xbdca1538d39072f1, 0x0fe6e910de3172e5, 0xcf5838a5ec4e0b59) }, // 5561
+  { teju_literal4(0x2a1b8b84dcf203de, 0x7e942e8703e05d7e, 0x44f5d94af9fb8c13, 0x2a371b1eb772a498), teju_literal4(0xa46c1d9ae94e6eb7, 0xfa8d343651fa0f53, 0xd7fffa0fd9cd14b6, 0xcbdaf0c69a0f267a) }, // 5497
+  { teju_literal4(0x3a2dc95c1cf417d1, 0x321a3b24eb465857, 0x9b0a106a29e6f4bb, 0x6bd42b70d097f51c), teju_literal4(0xf9ce2a6bc8442051, 0x4f6ae41b38005fde, 0x1eb528f27622042d, 0xf2dafc4773eaa7fa) }, // 5433
+  { teju_literal4(0x7d1cc0f4029d9dee, 0x9e4cd981ab36dbea, 0xfd0f1deb062c95e8, 0x50fb8177cadfa486), teju_literal4(0xbdc37351bcd5a32a, 0x8c9861312d79280e, 0xd09bdb10abed9745, 0x5a38edc2d700075f) }, // 5369
+  { teju_literal4(0x8f97908c867d8792, 0x785a07c9f199583e, 0x233930e0a1332a56, 0x4eb5cce6218109dc), teju_literal4(0x9027283384bcce8a, 0xe9c9347790470067, 0xa3c48cb6adc85d09, 0x7830830672eb869f) }, // 5305
+  { teju_literal4(0x0b757a06d76949c9, 0x6536c87f715674f0, 0x5c429dd7d477ee60, 0xfdad7bcd5606cb9e), teju_literal4(0xdb02a0e097a3dee0, 0x2dba00f3f8833192, 0x54d78d3c07b53b65, 0x2b9c28559b57e312) }, // 5241
+  { teju_literal4(0x8bec929ee999d64a, 0x13daa4314a44be95, 0xcb84650b22727836, 0x67cc37e7ec93da0e), teju_literal4(0xa65ec1ea3c459a38, 0x5f94cdaaf2a3ebea, 0xcace5b4364923fd9, 0xad4480eee987eb38) }, // 5177
+  { teju_literal4(0xcd07deed10d645db, 0xf65da00b02c36aaa, 0x4d7e3e068bf86bf5, 0x3bd50ad1c8f5ba84), teju_literal4(0xfcc3bf67f071fd93, 0x89c28e34fad38502, 0x8e350305aa62b62f, 0x59f6ab87aeb12eae) }, // 5113
+  { teju_literal4(0xc91c47c8e5ce8e9f, 0xa3f3fbb6bbf38b03, 0x4124bb3323e7c372, 0x7f2f7e582295ea7e), teju_literal4(0xc002f1b341824503, 0xd047afdcf39cac71, 0xbdb7194b31d3889e, 0xb27a968bfe765f44) }, // 5049
+  { teju_literal4(0x6021eadd75d5c5a9, 0x36422d0bcce02552, 0x6adcefbc8ae66b06, 0x0799183fbabc1751), teju_literal4(0x91dc5402ffa5bcae, 0x89116e52719a3779, 0x940d03cf2660390d, 0x589bebbffabc388b) }, // 4985
+  { teju_literal4(0x55adb484d4488fc1, 0x600d180f30d07daf, 0xde23eefbd82cb59a, 0x561e2ef1960cb9e7), teju_literal4(0xdd9ad18afdc910c3, 0xec8d8152923c518a, 0x52c58e29a21ad3eb, 0x321dc98f3fe3e928) }, // 4921
+  { teju_literal4(0xf4b9eb120c2d09cd, 0xff356e4de306bea5, 0x5fd464576a2fd6ac, 0xf278c838d4965ce0), teju_literal4(0xa8574e735b6fe1a5, 0xe8ec92f7267a83ce, 0x7c95ecfb147fa460, 0xd4682a53fbcb191e) }, // 4857
+  { teju_literal4(0x3816e386a03fb921, 0x55aa4e20256537c4, 0x82830e53b88cbaa0, 0xaa5afb220674d9fa), teju_literal4(0xffc24de6d9f4ffb6, 0x98a760eef39b4c51, 0xffeb4651cfd05a16, 0x9fd08de06acdf5e1) }, // 4793
+  { teju_literal4(0x734a0b7f539e3f14, 0xf18a9016a368dd9c, 0x403f2924786cb4f7, 0xeecfbc80f49e813c), teju_literal4(0xc249415feacb003c, 0x07beff444b53c784, 0x7f8157ea7c79fc67, 0xe019933b792d030b) }, // 4729
+  { teju_literal4(0x139457176730a089, 0xbf988c4b2ba7c313, 0xf19d5ad6c5d71643, 0x6c3db5bfc624d848), teju_literal4(0x9396ada05cd6b715, 0xdfcdccfbf26175fe, 0x391d872ada20adae, 0x690b10142a53516d) }, // 4665
+  { teju_literal4(0xd67006ed2402e955, 0x825832bde14fb2ed, 0x6957fee8a5563286, 0x39b2a9dfc834fbed), teju_literal4(0xe03ae07da3fdeea9, 0x48bf93a385742581, 0x313be65134d8239c, 0xb0732e29a06ddf93) }, // 4601
+  { teju_literal4(0xcabc9995c5a8fdd6, 0x6487acbb52e360f7, 0xa317274299004332, 0xaa9edb475265d69f), teju_literal4(0xaa55d52063350fed, 0x4b801859fb56906d, 0x04186ab13bd8c691, 0x31e9d9afede245ef) }, // 4537
+  { teju_literal4(0xf60a03eeff82d66f, 0x964d0f519ecb7646, 0x1896d5c9fc575ed1, 0x87e03714d79f8b62), teju_literal4(0x8164f89013db12e5, 0x238c9fd606c01a40, 0x042ba6e385379dfb, 0xd01bbc7e60a10d1f) }, // 4473
+  { teju_literal4(0x8345774dc60f97f8, 0x13031d6080f3bba7, 0x4c27509d957bda1f, 0xe79353900d589b4f), teju_literal4(0xc4967704a78c5e1e, 0xe48e969a9f0a359b, 0xafe6fddc9b520b4f, 0xdd9d4cbcf0d24aa0) }, // 4409
+  { teju_literal4(0xc211fb09d08af45c, 0xbde24aa69637bd29, 0x5018063a7c4a6348, 0xaf0ecdaf084d857b), teju_literal4(0x955644c05ce9c012, 0x7ec85fe3aa67c56d, 0x4f6e615824008f85, 0x39760a5256f6b3ad) }, // 4345
+  { teju_literal4(0xd3ae03487e9c201b, 0x67b6f78950b7c058, 0x8d87dea7eeee34fd, 0x427663ffa0113d1c), teju_literal4(0xe2e2e5953b774f94, 0xc51a2602a0a58587, 0xec04e35b33a39f71, 0x73341d16ac0a8b56) }, // 4281
+  { teju_literal4(0xf9f21d7eb691a6aa, 0x9b2f39c21ac54877, 0xcc26345b4ff74141, 0x7ea742dc5bd82ebf), teju_literal4(0xac5a6811c43ce000, 0xda28762480a961ef, 0x9a9d77e16f5d5993, 0x5508f4fd9089c495) }, // 4217
+  { teju_literal4(0x37a099160834c6dd, 0x4042f4f7a6fc46f6, 0x5df0de9c9aa2c471, 0xa37b5d72605657ea), teju_literal4(0x82ed624f03a5cd34, 0x02a563b81343df36, 0x4a05244d87185334, 0x6da932defceff90d) }, // 4153
+  { teju_literal4(0xcb66593f8c73ddff, 0xe821e2d91232ac80, 0xe614f572e0cca026, 0x6d43492abceb214e), teju_literal4(0xc6eaa78d1a753ac9, 0xceba1dd926fdba36, 0xf1ab47500d75a918, 0xa7f6b535abc116c8) }, // 4089
+  { teju_literal4(0x357086cc7735d4d9, 0xb707da4f86f94097, 0x721d141894aaf6c5, 0xd3cdaf71fae6d443), teju_literal4(0x971b2947622a3136, 0x1c57f32e30d27f4c, 0xa483cffa4bad264e, 0x3207c0736faf52b5) }, // 4025
+  { teju_literal4(0x9a53949793084932, 0xd97974a1e792a9ed, 0xec147f0f26b2a536, 0x7bfb616809b3cbeb), teju_literal4(0xe592f8f6d32e0dbc, 0x451dd1d4fccae2c3, 0x973f433c2d30e5be, 0x0c64babac641d7eb) }, // 3961
+  { teju_literal4(0xb7dfc58049636113, 0x4923235fc7b88d59, 0x1b8b97ce26490dd8, 0x756c4631ea9f9bb2), teju_literal4(0xae65199ee8326365, 0x9b8fa5a15c0ab8b3, 0x3844e3fc24c2bf73, 0x075e71bd6b3964cb) }, // 3897
+  { teju_literal4(0x49ad185499731d44, 0x14799edbd75a3842, 0x9b7ee7a924dd3063, 0xa844c3d894832ace), teju_literal4(0x847a721f15a5bd4b, 0xbad0d2d3400fdbd4, 0xc01b7084f2049523, 0x73a14cc426d4c21e) }, // 3833
+  { teju_literal4(0x0082da4db0e29c78, 0xdea3b014f8569405, 0x0408552728f0a168, 0xfb64f9718a6de2dd), teju_literal4(0xc945e824582ef54a, 0xb488dc17e1a6d2b9, 0x40bb6aad54cc62d8, 0x252a0355cbd572d2) }, // 3769
+  { teju_literal4(0xa572feb12af5fbe8, 0x5d799cb011ed08db, 0x9483892c919b62dc, 0x598dea8e0e5178e0), teju_literal4(0x98e56b4a010869de, 0x519b02df49b1ba1a, 0x77717ab553c57e90, 0x1d67d48217d23fd1) }, // 3705
+  { teju_literal4(0xb13d2602e3bd5e51, 0x323f5bfce5ecec54, 0x5e2ebf3ecbda891d, 0xa0edd377a3a8bd93), teju_literal4(0xe84b3310b355ead6, 0x01c0cc3468de2c63, 0x58db3cfbe8c86ee0, 0xff671cfd70c1c479) }, // 3641
+  { teju_literal4(0x4932889e778179fd, 0xa75f368fce82dfa3, 0x6574385739421a4b, 0xec0a8b51dc5ff7d8), teju_literal4(0xb075fc56d87b15c4, 0xfa860880f446dcfc, 0x606cdc4356cfba0d, 0xbfdd72dab9b3fe67) }, // 3577
+  { teju_literal4(0x45fe319e8f1e2b5e, 0x8cd452bc41cb60af, 0xcc629e7960afc0ca, 0x5cf10073cf82c3a4), teju_literal4(0x860c3619644ae1ed, 0x267194da7cb3c9a0, 0x6f9f4dd4f2311e7b, 0x4cb1e5a1631cd862) }, // 3513
+  { teju_literal4(0xe4c3edb13a141e29, 0x936e1d964fe2d988, 0x33a37c26100cd922, 0x6863d01a7c07af29), teju_literal4(0xcba84e35a7c64fa1, 0xcafafc41f01e19a6, 0xf52830cd0d8055c1, 0x53026d3290134011) }, // 3449
+  { teju_literal4(0x2337c83b2aca4c2e, 0x955802e677487b72, 0x6f7dbe18a533bad5, 0x14b832d5aa01a04b), teju_literal4(0x9ab51b0d924391a3, 0x406f7004039e42ab, 0xe2515cb48f80e562, 0x914a1d676ada1a66) }, // 3385
+  { teju_literal4(0xb93e91039836ab6f, 0xc1539951fb735a68, 0xcca609a264cb0cd6, 0x18bf32f26dca210e), teju_literal4(0xeb0bac9b3b6e05a9, 0x21b9eb6c3ff49be1, 0x91ba91cc0aa09f23, 0xacc17e0d7d525095) }, // 3321
+  { teju_literal4(0xf841f9d019868dd7, 0x6780c91f74a9c98a, 0xced7e62faa3ed8a4, 0x756c4fd12e820325), teju_literal4(0xb28d2300e6e788df, 0xa40733fadd701588, 0x00383dec62e041cc, 0x607875be61a50a41) }, // 3257
+  { teju_literal4(0x0ff94b4998807b89, 0xefdd716ac3b1c4da, 0xbaeb8ba9ca0b75ad, 0xf11923fa23286ece), teju_literal4(0x87a2bc81cb4f33d2, 0xf6f617e17e2d75ac, 0x2f18f3ff588de977, 0x1c25e4d33e922a32) }, // 3193
+  { teju_literal4(0x5f2c17892afb77fa, 0x95247388afe8a9c3, 0x1f536a6fb89e56bc, 0xfe9a810650177532), teju_literal4(0xce11ef6d455bd38f, 0xe460df10747add62, 0xd78a586161387005, 0x251a5b31999f0413) }, // 3129
+  { teju_literal4(0x34380076b5772ac5, 0xe34bd6664e2b2097, 0x862b208d37cc8a44, 0xebd696280c3ddf6e), teju_literal4(0x9c8a4908c6ce9f36, 0xd4d71effdd569dff, 0xd5e29b5c47be0b82, 0x503b00759e058648) }, // 3065
+  { teju_literal4(0x04f1027979908d54, 0xba23114148105607, 0xee54fcbe5190d8d5, 0x3fe74f62e1b497e1), teju_literal4(0xedd47e99c2f2c355, 0x81c4a339afd69999, 0xa565b76dae1dba3e, 0x883d037a7472fc92) }, // 3001
+  { teju_literal4(0x17e958db7c12cb9f, 0x13fa5b6e14ec1fd5, 0xe0e19034de595150, 0x8379f58d2ac5156c), teju_literal4(0xb4aaa09d5863a631, 0xc5260635cb919263, 0x6a166b1bbab15d86, 0x4348b3bd21c6e38d) }, // 2937
+  { teju_literal4(0xf3ad14dc72c8017f, 0xf1ea0bc0c9f1db47, 0x9b29a8a8f9ecfa8d, 0xe9968521bbf4b566), teju_literal4(0x893e13c769604eeb, 0x9f881fb8f1ac1503, 0xb9154f5fd30435d9, 0x6db86638ff7d2ef1) }, // 2873
+  { teju_literal4(0xa334a063520aee40, 0xc37f0789a0648211, 0xc872e84efa33b39f, 0xb52d8daddcff9a91), teju_literal4(0xd082e1b92722a5d2, 0xeb3a1748289247b4, 0x4f9877d55970d1d5, 0x00b5a92d6e6e3f09) }, // 2809
+  { teju_literal4(0xa1bd699637b31560, 0x7945202e42634303, 0xae33b8a79a170dd7, 0x37153573f8e245c4), teju_literal4(0x9e6505e43d75e3ff, 0x6b86b9311905687c, 0x6b3b9106dd614d63, 0xbde40e069700f355) }, // 2745
+  { teju_literal4(0xc5c1a23eb2ded58c, 0x29b7b579738bc5be, 0xb53ce7379d08e6c6, 0xeae477dd34783c8b), teju_literal4(0xf0a5c25b7cb926b1, 0x95592b89bb0ab70d, 0xc5b6448101e663f1, 0xfae9664c8215e730) }, // 2681
+  { teju_literal4(0x9d9bc84956f1cc90, 0x299d92fc61927cb5, 0x3b28bfe4e36503b9, 0x6e428bba8675b0b8), teju_literal4(0xb6ce886611ac95c2, 0xeb2a38fddddadf86, 0xd7ec8bace8270912, 0x711af3ff86e9aab1) }, // 2617
+  { teju_literal4(0xdedeb54e3b6f030c, 0xbe0983cf1441d26d, 0x32769a515c92264b, 0xf0a5fe4cc1ae3004), teju_literal4(0x8ade4a85235255a3, 0x01bb82f06680a09a, 0xc16b99d4a42c4244, 0x607a4dc2e38cf4e5) }, // 2553
+  { teju_literal4(0x70cc9107f002c88c, 0x0938f980995c84b7, 0xe6ea770ef6f2f65f, 0x0da91368e91c439c), teju_literal4(0xd2fb3b49c4b4c668, 0xcd45d3f12aa06e79, 0xdd1fadcc32575ea5, 0xdea473b5852313bb) }, // 2489
+  { teju_literal4(0xde5159dca7b57c6e, 0x7303523af72addcf, 0x43265b306f2635f3, 0xd7baca3dfba1fe96), teju_literal4(0xa045627b1a4a6ca5, 0x796355b61c5f8249, 0xed3546077d464303, 0x54ce0dec9e49277d) }, // 2425
+  { teju_literal4(0x434e818db864d136, 0x839a0caa5599393c, 0x2d1d5babce3cf2c0, 0xc7c83ad494d38b54), teju_literal4(0xf37f917c5cfba84f, 0x2890e8c8669bef39, 0x4a5e8ba0f0210e0c, 0x6103edf9adb5f6fe) }, // 2361
+  { teju_literal4(0x30f42aaf18fabf71, 0x5b61e2290cf16853, 0x2a33e2f9aa110f14, 0x65de506641549e4a), teju_literal4(0xb8f8edcf46126bfc, 0xee6dee32d3860fab, 0x92ca15be6324b394, 0xa9d7214763051a7f) }, // 2297
+  { teju_literal4(0x9ecb211f7f6043df, 0x2051aaebb61a7681, 0x29d1dd669613c37e, 0xe96a19d735a09cbf), teju_literal4(0x8c836f8228e0b6c4, 0xc0306c7d3f1d1a37, 0x6169b0c12ab91b79, 0x377a623ba02099e0) }, // 2233
+  { teju_literal4(0xbceb8555f0918ea6, 0xd09e4c8976e6ff7e, 0xebf1462028c8c26f, 0xbbd30c869492c7b6), teju_literal4(0xd57b1292e0c3d1a7, 0x741b560c088999d1, 0x781e6d5b425904f5, 0x0a573e9326fff1cd) }, // 2169
+  { teju_literal4(0xef1b654cf8cb0783, 0x1a9a8052c5e11629, 0xc3480f1fa2e8ae2d, 0xcd81783debe1a33d), teju_literal4(0xa22b6fdb9fd896e8, 0xed762abbc9e79b86, 0xdc0d6b769ee3bc5c, 0x84379f6d72918f0d) }, // 2105
+  { teju_literal4(0xa85132c5752ee2cf, 0xfd4efaa0f9743bbc, 0xa3987a60db5a24d5, 0x559f60c78146366b), teju_literal4(0xf66205e60220ba33, 0x0c4606f404d8786b, 0x841ecfa30ed74256, 0x65a583786eafd700) }, // 2041
+  { teju_literal4(0x1ec7a3c5dd3cb9c9, 0x86c7227a9fc2b954, 0xe5394294212245f4, 0x25093c6504cc91d6), teju_literal4(0xbb29e488284bd2fe, 0x340facc0581ade76, 0xa2a7fee536e7dd42, 0xda72015b019c904d) }, // 1977
+  { teju_literal4(0xba2cebc30b6d12ef, 0x2a774a846efe07c2, 0x99233f344aac44bf, 0x3ca6bf9bc7ad3361), teju_literal4(0x8e2d91b27b018ca0, 0xb1798b521b76d59a, 0xf3e0adf3b3daff74, 0xf3b3b9e490f5ac28) }, // 1913
+  { teju_literal4(0x58907609bc30b0fc, 0xb460ccd9231a868b, 0x1fb4f37c5281e00d, 0x96cc8478bad57525), teju_literal4(0xd8027e4c552d6b6f, 0x0e85a08f8190b7ba, 0x0a94c84a476b7725, 0x99ab63520ffe5073) }, // 1849
+  { teju_literal4(0xa6b430ebe558ac4b, 0x37860c2a7a2f0be7, 0xbd497430c1f1bb03, 0xc96882554fca12ce), teju_literal4(0xa4173f47ca2f4d61, 0x02d1f45851cb031c, 0x647c060102f22660, 0xb860c8eed9233a2d) }, // 1785
+  { teju_literal4(0xc91946c9dc95852a, 0x14ca6e32a166c5c9, 0x06e52d6ec6c69ff9, 0x4b292cba8affb10a), teju_literal4(0xf94d39d0a0433b11, 0x34746196f437c460, 0x38089b3013501a61, 0xd65f4ea60931bbb0) }, // 1721
+  { teju_literal4(0xd457aa5d993a7d46, 0x3082236721efc829, 0xa70f9dbda3e79206, 0xd4a110853d6d1655), teju_literal4(0xbd61807b9d61f6ac, 0xdc5f294523e7e980, 0xede1fa24b4368569, 0x8bec2789466543c1) }, // 1657
+  { teju_literal4(0x942693006e0d1de2, 0x112278f29d74a197, 0x6a24723e4690c1bb, 0xbdf0b8cf3b4552fc), teju_literal4(0x8fdcc03773d05a66, 0x5bef0b07f9e0d97a, 0x8ec2bf3be38a04bd, 0xdfa5190827c38649) }, // 1593
+  { teju_literal4(0xfe60e80fc692e3f1, 0x85139f5db4ce14f5, 0x75ca13d2c5e7d5c2, 0xa7f20fd35d060ac9), teju_literal4(0xda919572e17a9373, 0xab51993d068f7eb1, 0xc6287df20183d7eb, 0xc7ac7a11cedcde1d) }, // 1529
+  { teju_literal4(0xcf510c7d450fedfc, 0x0d17e2bb216e7bd7, 0xd8a7fa0c1c2c83f2, 0x00330fca1554f320), teju_literal4(0xa608e235ebbd6a48, 0xa6400144c3b9fdd5, 0xc3d8d579cba26bec, 0x7476b059360f33b2) }, // 1465
+  { teju_literal4(0x9dfe1a254f8e969f, 0x74bd65e69af78958, 0xe1defe442cd1e9e0, 0xb6edbd3e7b9ef4aa), teju_literal4(0xfc4147c3ef8535ef, 0x6fa27bcc1c3a57bf, 0xebe1c48bf5f4e342, 0xe3686cd22099573b) }, // 1401
+  { teju_literal4(0xf8ea303205666dac, 0x0fcd968b7fd0aab6, 0xe7f90da385891037, 0x372f2adfdf464881), teju_literal4(0xbf9fd5d0f1bb0dda, 0xcf13e1f2dca489e5, 0x7d009f40304be018, 0xe263068d42a44c96) }, // 1337
+  { teju_literal4(0x673d5882216ab3d1, 0x2e4d33b7250bc808, 0x46bdebdfc0a21836, 0x3163623b27b60a70), teju_literal4(0x91910a605014fb23, 0x2b5a807476a1f897, 0xb4bd946bf2235dae, 0x97dc72d6e27dcdab) }, // 1273
+  { teju_literal4(0x4e3ba5042baa89fb, 0x09ff18bba8add542, 0xbe1a2ccc7b264532, 0xfb23c3558f5a4096), teju_literal4(0xdd286f48fbd13794, 0xc0a8b5f18652725a, 0xbe614ef2bc195a24, 0x7ad55aec049e4bc9) }, // 1209
+  { teju_literal4(0x4839246a60f46dc2, 0x8f45eb0fb7864306, 0x8039a99e197c7c54, 0x12708b85aa9a3643), teju_literal4(0xa8006a514c0ad32b, 0x0a3fcd544f8fa599, 0x3042c22ae4913917, 0x02c29c08f7709ab8) }, // 1145
+  { teju_literal4(0x92aeb9b68a85fec5, 0x5166641baf8febe5, 0x4493b257443871df, 0x077db0a6a0c87843), teju_literal4(0xff3e4a981d35646d, 0x80777d9dd5925c1e, 0x1b339c2134580d4f, 0x781a2dc6518f8dbf) }, // 1081
+  { teju_literal4(0x9b45dea3f93a4a55, 0xfe0ded685970e458, 0x32538a320e70dd0e, 0xa7dcc32020c598a3), teju_literal4(0xc1e4f8ec9049ee0e, 0xafed9fc895027d0e, 0x9512ab4dfe2e0c5f, 0x4cc3e35fc9c117e2) }, // 1017
+  { teju_literal4(0xe02534485ab2d0ef, 0xf7f8a7bfe27f4ec2, 0x349308eaa59d8ebf, 0x0502438df847a317), teju_literal4(0x934a7faaba6ba471, 0xb70eabd10084026d, 0xf1c30b0ae9c5285f, 0x03eae8c6b703362f) }, // 953
+  { teju_literal4(0x4c356820d4c66861, 0x23125bbed7a6d546, 0x40ed68ab0357f21f, 0x97026ecb0c96a67f), teju_literal4(0xdfc72357a45f6f75, 0x7a32258bd3c6ba23, 0x2c522f20e4f26e1b, 0xec654782708a9aca) }, // 889
+  { teju_literal4(0x0f2e2f126bdf320f, 0x5c74056e93c2fddc, 0xc07c4bde88117b44, 0xe70e7a4dad4175dc), teju_literal4(0xa9fde97ac852f028, 0x1aaf7fbbdf2be047, 0xb0e7f7b69da08d21, 0x3b926bca82048ad1) }, // 825
+  { teju_literal4(0xcb09aee5cd60774b, 0xe7e631596831728c, 0x16293c69a524f308, 0x7558a56993b921e3), teju_literal4(0x81222ebb5fe801cd, 0x7792ef945b160de0, 0x1e1055e6d806dd08, 0x4231192e6856d827) }, // 761
+  { teju_literal4(0x57f07d073da3453b, 0x63ec2a93f348a8da, 0x836149e75be846f6, 0x5d345f2fd4a241d7), teju_literal4(0xc430fe70bbe92b04, 0x4d76cb48e2d7f071, 0xeb245d39e6125cd3, 0x8151757391aeda9d) }, // 697
+  { teju_literal4(0x0cc55f0a378cef75, 0xb01530f70314f332, 0x4c813ca63c817707, 0x7f7e1628011eea7f), teju_literal4(0x95092fc35812edb7, 0x770f4ee88b0dcbc4, 0x80286fbfcdbfa395, 0x6e9c65d2a930f4dd) }, // 633
+  { teju_literal4(0x3bfa24fefb4bbef2, 0x4a584deca109063f, 0x3e0c442b39cd1d98, 0x60be69b4d58baf83), teju_literal4(0xe26dc96f3b47e308, 0x5624f8161147efa3, 0x8be442249e8e7610, 0x66e1230a227726ab) }, // 569
+  { teju_literal4(0x641554c290813dd0, 0xd65fb81681af8612, 0xdb89ae1fecc86637, 0xfdeacf6ab63ca1b7), teju_literal4(0xac0171c97606329f, 0xd1dd738ec185694c, 0x80de9a14f318e54b, 0xdc803947e9d2956d) }, // 505
+  { teju_literal4(0x8a2f66013a0b8c59, 0x138597ee326bb442, 0x5a8f4d185fe8a266, 0x5f462ee4be60fdd2), teju_literal4(0x82a9cdede6f1d29d, 0x241dd9e486202506, 0xab3c08fcca88f095, 0x3ad60f05e89b066c) }, // 441
+  { teju_literal4(0x1ad6e22d9a966243, 0xa90728b89039d708, 0x45e3eacc7666061d, 0x657dba397fd42a68), teju_literal4(0xc683fb3e4ae856b0, 0xc170b83aedd03947, 0x26223f7852e7a479, 0x441de14d2aa169a2) }, // 377
+  { teju_literal4(0x55843d1df2b37bd6, 0x6cb0a7a0b49bb98b, 0xe6841e05716b236a, 0x383b563a90b289ea), teju_literal4(0x96cd2a865764dbca, 0x380406926a5e5728, 0x2d1db3d86f3b22b2, 0x73dcd0deb965f7a3) }, // 313
+  { teju_literal4(0x9e1b9a4a49ac1dec, 0x9e56a9b08213bfb1, 0x54f041a44ceac298, 0x8e87bdb5f105a56b), teju_literal4(0xe51c79a85916f484, 0x82b7e12780e7401a, 0xe1d09ab6fb409872, 0xb0a636067d47dffd) }, // 249
+  { teju_literal4(0x3c2dce0b0b3462e0, 0xafa5bf432579b0cc, 0xabae62f973b8f94c, 0xdb0ab8de6db64747), teju_literal4(0xae0b158b4738705e, 0x9624ab50b148d445, 0xbe2f82caaf92a0fd, 0x9ae13fc714ba04e2) }, // 185
+  { teju_literal4(0x93847dd4dfb41699, 0xb7b27479eb9b6d1c, 0x67192d81b3776a28, 0x29c023d418ec9681), teju_literal4(0x843610cb4bf160cb, 0xcedf722a585139ba, 0x18f89f7349bffb99, 0x9b7747b8a8b97115) }, // 121
+  { teju_literal4(0xbd8be35e434c4bce, 0xedafa30174fed871, 0x6adbf764d59c1a19, 0xbff1af90b06be5d1), teju_literal4(0xc8de047564d20a8b, 0xf245825a5a445275, 0x568b727823fbdcd5, 0x8963914cfc3de71e) }, // 57
+  { teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000), teju_literal4(0x9896800000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000) }, // -7
+  { teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000), teju_literal4(0xe7d34c64a9c85d44, 0x60dbbca87196b616, 0x18a4bd2168000000, 0x0000000000000000) }, // -71
+  { teju_literal4(0xe875c73fc6c5cb40, 0x0000000000000000, 0x0000000000000000, 0x0000000000000000), teju_literal4(0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f, 0xc04c79ffe324301f, 0xda0b4f7be81d85c4) }, // -135
+  { teju_literal4(0x57dc04f6854ee8d0, 0x3f698c3714e42b1e, 0xe60907cdd02ee517, 0x145a000000000000), teju_literal4(0x85c7056562757456, 0xf6872d5667844e49, 0x0080c5d714e80fac, 0xf6c4d4bfa83b0732) }, // -199
+  { teju_literal4(0x86b1b06fac4786ef, 0x7d86fd622cd05f9e, 0x62383a17e3b52b48, 0xda8a05cb8d6b4687), teju_literal4(0xcb3f2f7642717713, 0x241c70a936219a73, 0xe7db7fc356594c34, 0x173db1fe98e0d789) }, // -263
+  { teju_literal4(0xa43db7d1a02c87d5, 0x1f5d8ef2897e63bb, 0x5bc260dbb731610a, 0x42ae1507cf0a50ed), teju_literal4(0x9a65406d44a5c903, 0x737f74f1dc043328, 0x618d3cd96dc3f98a, 0x1ee29b9c68e668f6) }, // -327
+  { teju_literal4(0xd75a0b6d30e321d7, 0x8cb0fd0abf310cd2, 0xf93e8e923b1bde24, 0x0b880da235f7e6f8), teju_literal4(0xea925a4fca65045b, 0x604d7efb5e789965, 0x0048dbb4f110f130, 0x809b5d69c67e3917) }, // -391
+  { teju_literal4(0x64ebb06f8062ed0f, 0xf0bb77cacea31908, 0x49be5f438d9b4fc2, 0x59fcb68b98582c8b), teju_literal4(0xb230f9b653d8e415, 0x074308bbcfa01ae5, 0xdc46d1cae6b44b04, 0x3b1c3fe9e8c744e1) }, // -455
+  { teju_literal4(0x7174539cc92d2983, 0xc980ee607ab931e0, 0xdfe1adfd6c27c676, 0x8c9a99eca0536fd6), teju_literal4(0x875cb9f8a945461e, 0xbcbb586917a06a0f, 0xeb0437d02e308d67, 0x32cac161057750d2) }, // -519
+  { teju_literal4(0xd04e844acf34e415, 0x90d3af2a753a4025, 0x0f8751db9835cd82, 0xce374ff5ad5b16cd), teju_literal4(0xcda791e1f01e4ae7, 0x866de911391ab5e0, 0x42134e7dc9235028, 0x3d5a03c72c7422e4) }, // -583
+  { teju_literal4(0x686881f44a7b2f87, 0x3136cb8c5cae862c, 0x1855c6e89fdb69cf, 0xc47e9586aad59ab8), teju_literal4(0x9c397c3c56d3334c, 0xadccf7c3ccca9a35, 0xf7a999150823ac94, 0xf071ac0b52e33b9b) }, // -647
+  { teju_literal4(0xe8724da55139b6a6, 0x44dab2d1edcb5b6c, 0xb8e8f99071e732b2, 0xd58772e811bbae54), teju_literal4(0xed59bc602940ed46, 0xe7a625687dced198, 0xb7fcbb87d41ac1b2, 0x039304299f8a8c8e) }, // -711
+  { teju_literal4(0xc13a65f274c6a307, 0x6584a23051496afa, 0x3eb12a87c4dcf13a, 0xc43a4ba8d2f50c16), teju_literal4(0xb44d5fd3a5e9cf8a, 0x94035dd3e3d5aa85, 0x2a3e1ad4daf13544, 0x8375ad1a53d4b598) }, // -775
+  { teju_literal4(0x3cc142ba67efc019, 0x6d94d8cc936a4bea, 0xd18ae68d31109706, 0xb6b2efdd437c8491), teju_literal4(0x88f73ceccbc73bd6, 0x96a1df74415baa4a, 0x002366d0d20a8b11, 0x2e99a4c680c0789b) }, // -839
+  { teju_literal4(0xf2df3119055b20d7, 0x40d0c6846345defc, 0x7b9c0f70aee5676b, 0x53e02edb61b194f0), teju_literal4(0xd017419b1255d798, 0xe1f04f78e22ffa50, 0x9f068b1887da3b18, 0x830af8403da6f6f1) }, // -903
+  { teju_literal4(0x0c76b638522792ca, 0xf3653c816e20e3c8, 0x249c6e6d53ce120a, 0x5716a233e9f77a7d), teju_literal4(0x9e13440d3c1916d3, 0x776487f86be70382, 0x7f03cea3d3581bce, 0x371ac609383ea0a6) }, // -967
+  { teju_literal4(0x5b4137610fa850da, 0xbbb5191c7a777f73, 0x0d145e6be4ddf56e, 0xf80d7cc4f8c5bccf), teju_literal4(0xf0298bd7e8e134fa, 0xff81893187f970c3, 0x0476ad9d3c7f342d, 0x20e256d4e884b0e7) }, // -1031
+  { teju_literal4(0xb5a13ededba2ee75, 0xdd287f3b811b170c, 0xc5779626bd7845a6, 0x0ab18f0d6b8660dd), teju_literal4(0xb6702ccd9f7409e2, 0xd9b4bd4c168cacab, 0xd1b22740c4db036d, 0xfc0fff4a480833e1) }, // -1095
+  { teju_literal4(0xa6ca4ea5f617f6c7, 0x3a6a07a60031e793, 0x8a84da3b1221d480, 0x790e6abb8d6d23fd), teju_literal4(0x8a969cd524f0130d, 0xd0602424d29a33ec, 0x1c45d2df0e8baa27, 0xa630a76f6139bf04) }, // -1159
+  { teju_literal4(0x72330006cc54ea92, 0xc738f9cf2abf0637, 0x8a1917de7b28f47e, 0x4a497f8023230157), teju_literal4(0xd28e54c6aca86f18, 0x76608aa3fe514509, 0x8ccb2202d28c3662, 0x1fc23ed777e22978) }, // -1223
+  { teju_literal4(0x7021f86d4a479ab1, 0xef22789490638230, 0xff79e9492d10579b, 0x9fff87b8b057693b), teju_literal4(0x9ff2a8b265395f74, 0x5ea5d72dabc3e571, 0xe44aaeddae4f6e9b, 0xfea65b3e2bdb7e35) }, // -1287
+  { teju_literal4(0xe6968007dd3238af, 0x419ce63d71ef1d24, 0xf9f9bf9fdf808341, 0xe50085c595bb2b02), teju_literal4(0xf301e245c5922bb0, 0xdb07b96883f0115b, 0x87e14b280667e11e, 0xc6035ed6f56d60de) }, // -1351
+  { teju_literal4(0xf43002a50ecda29d, 0x3a794a659f95acf2, 0x35cf7b08b8f32a2a, 0xc93e891a609c9076), teju_literal4(0xb899740e693157b9, 0xa407686321d302fa, 0x773dea049f578415, 0xc96950712dfe0a96) }, // -1415
+  { teju_literal4(0x794380f6439db522, 0xeabf9cf4b00d904a, 0xbbce577a973259f3, 0xb53f36e9170ce66b), teju_literal4(0x8c3ae87143bf2171, 0x3d301c073ebcc2c4, 0xf5cf1991271e6c1b, 0xd3a29663a0e306dc) }, // -1479
+  { teju_literal4(0x8de009bc51b3ae48, 0xbf83416a9a8a5162, 0x17095871e0e20489, 0x0127c85a9039dac5), teju_literal4(0xd50ce1cceb0209fb, 0x762a1d9bec1b7ca5, 0xe6e5912341491bcf, 0x952f0233a739cec5) }, // -1543
+  { teju_literal4(0x0691c6be106a4d68, 0x701c5c208cef1a0f, 0xe14974f12f3cc404, 0x7f90c1acd0f03f0c), teju_literal4(0xa1d7bb31470e8d97, 0x03afbb9fcfce02d9, 0x578aad06a4ec202d, 0xb17a669c1213431b) }, // -1607
+  { teju_literal4(0x265188bbc89d2e46, 0x57d1a0bb5e55ff7c, 0x88686c663622f476, 0x2db6a95b165b979b), teju_literal4(0xf5e2d985fdb5b24b, 0xf591976857c2735a, 0x80455acd0c748c7f, 0xfb97555f8e99c337) }, // -1671
+  { teju_literal4(0x89747ae0365b445e, 0xa637a2fae793281b, 0xf0bf38bd0a981f38, 0xd56dbd5aada01bcf), teju_literal4(0xbac9493b0cce488f, 0xc14f83553e1ca5d9, 0x53f3a9cd6546331e, 0x83aeb0057d177e2c) }, // -1735
+  { teju_literal4(0x05807b5a1709849f, 0xf9c6b7ee5283be77, 0x624b01186e34a5a2, 0xaa984e5b9bbdd446), teju_literal4(0x8de42ead714c5e80, 0xb946dd72d21a411c, 0xcb74d00c308a5edc, 0x1faf605843a638a1) }, // -1799
+  { teju_literal4(0x6ebff4a15fb1e228, 0x3d514019cf13175f, 0x17ec1891ed4c8e9e, 0xe6ee8557152ce243), teju_literal4(0xd792ff59ed555c20, 0x1fb74d27227c736c, 0x62a4c615b80539a8, 0x618a3150414d1eac) }, // -1863
+  { teju_literal4(0x44fe763c1b82cc1b, 0x1a62c97b81ee9aa3, 0x68bb62df76324915, 0x7af9624ededaeb6e), teju_literal4(0xa3c28cc2f542ece9, 0x79c048e537adcd97, 0xf86ffeb501aff878, 0x6dd51c3b9d2c3865) }, // -1927
+  { teju_literal4(0x21230904ae1b78af, 0xd79a1e439d1a8d27, 0xc9aa05993f00d337, 0xd999f54151f706e5), teju_literal4(0xf8cc8bc33cd21ae3, 0x32dc5bd68fc3d377, 0x60b011c5b72bfb99, 0x6cc31767c2c59f20) }, // -1991
+  { teju_literal4(0x406fac048d452c13, 0x33ddf2d24b04936b, 0x65db6590ab0d1863, 0x4baffa0ec5c0a957), teju_literal4(0xbcffc0342779c8a6, 0xec84562dd6895506, 0x7501c07e9011edd9, 0x41d84f58a6b4e4f7) }, // -2055
+  { teju_literal4(0x9bf7736c1767aaa2, 0x440558c05d7bb1fc, 0x76e70a97f268b7c1, 0x391973284991ce39), teju_literal4(0x8f927ea3386cf937, 0x3045d01974db8fb7, 0x094ce89da04b96f2, 0xab32aebceebe604e) }, // -2119
+  { teju_literal4(0x85d2766de711e018, 0x4925ebf29b0926ed, 0x2f316b15510d2e58, 0x9d10497f0e3f052a), teju_literal4(0xda20c45e95b092f4, 0xfbecb1fdde060f06, 0x981c084367e1ec6f, 0xf0ae6186aeda8ab3) }, // -2183
+  { teju_literal4(0x808ddce65c001d23, 0x5f0ff3afdc608eed, 0x69538702d3212fd1, 0x4161663d25c1fb7d), teju_literal4(0xa5b32ed4bedcff7b, 0x8ad6742489a6d096, 0x634734d87e66cb5a, 0xe23f67b2182c8fb9) }, // -2247
+  { teju_literal4(0xd26693c1e005401e, 0x443e138a98d298f0, 0xa8137a9125ecf9ce, 0x86831913431a8410), teju_literal4(0xfbbf13778969e4ff, 0x1dfd5f7d8f30f12f, 0x904e03f2d13d7822, 0x8e44f3803040cbc1) }, // -2311
+  { teju_literal4(0xa6d0dc0d2db1b64f, 0x7c7f3c9cfed8ab06, 0x9c0bbd6f9fee2b40, 0xcb49bf71c3e912b2), teju_literal4(0xbf3ced169e9237db, 0x161d9595b8ea08c9, 0xc417e8b0caa2dff3, 0x7ebab36dca0fc291) }, // -2375
+  { teju_literal4(0x05d9d6e9d71cd621, 0x537a63353da4f8cf, 0x20dc765d2aa322d4, 0xac3742a5b8119219), teju_literal4(0x9145e799eef34a93, 0x2bf7512d43ebcb95, 0x1e95d0184a05cde9, 0x37a1b834c19f071a) }, // -2439
+  { teju_literal4(0x7e22a2b8ec0972f6, 0x28e206a494463799, 0x32991bfdf856b351, 0x6717bf6f17c608fe), teju_literal4(0xdcb6481158c30e90, 0x0c066459f0991ab9, 0x04b58fe400f0e524, 0x9a6910466441686c) }, // -2503
+  { teju_literal4(0xec7bbba2e8238b0a, 0x0b93b77f372eeb9c, 0xfa8c060ec1ab2660, 0x49d67335a42aea97), teju_literal4(0xa7a9b308cca6ac2d, 0x833b1c511ce9003b, 0xb9a27e5412c25c85, 0xfc535d8ac25c613c) }, // -2567
+  { teju_literal4(0xf8e787eea8ad65ec, 0xfa6cd63c085bea25, 0x5c11e260db8d8193, 0x17ee9dc4b97aa514), teju_literal4(0xfeba8b6d35a4c76d, 0xee66748ea1dca831, 0xeabe80836c371f08, 0x4eb3a6e5e7702f41) }, // -2631
+  { teju_literal4(0x91b6ff0f139a30b9, 0x152272da0fa2e17f, 0xce877cfbbb78ae96, 0xecfbfcc7484d5b79), teju_literal4(0xc180e43c56766fbb, 0xb42318e128ba189e, 0xf7ea80d7043511b1, 0xbfd5d1551d4e95da) }, // -2695
+  { teju_literal4(0x436bb172cc512dfd, 0x5380f43fac1ace91, 0x24754e32b5ed5e3f, 0x09f63a63582a1914), teju_literal4(0x92fe7907408f0489, 0x06de6fd943f0307f, 0x1ba40e123f86968c, 0x6a399dddb7725c6e) }, // -2759
+  { teju_literal4(0xce23a0e1960e8ae3, 0x68e3e04e528aec6f, 0x38ba13ca41f386c8, 0xbd9ebbd68cb343a3), teju_literal4(0xdf53a1ef10db7cf4, 0x760e93d28bac96ec, 0xced5f36cfc6e5f11, 0xc4332b4c53231e11) }, // -2823
+  { teju_literal4(0x729534c433a19023, 0xac02f6e44a1cb673, 0xca6acf4ac2148881, 0x6109e428d2d5b985), teju_literal4(0xa9a62b36c174d041, 0x897539ba3b6447cb, 0x69d4810e2d04e577, 0x1ab3ccacd7946849) }, // -2887
+  { teju_literal4(0x2f838e67d6650919, 0x06603420a6f2b1e6, 0x46b29b618b0b646e, 0x29d2ef91aa951aed), teju_literal4(0x80df875fe9694995, 0x23eda23ce4a062de, 0x975e0bce5e5636e3, 0x6f2116b6e8d9307c) }, // -2951
+  { teju_literal4(0x50c37dc74f3aa3a2, 0x6f55c7f21fc8e1c0, 0x5957f19a64a5e09b, 0xf448d3cd4f009410), teju_literal4(0xc3cbba3ceb81369c, 0x38f050c7df9ecd8a, 0xa32cfde373748bb6, 0x7c2d48d7cb28be9f) }, // -3015
+  { teju_literal4(0xfdca609e61e4d50a, 0x75cc0b3a553706f2, 0x64cbc83c34ea90ec, 0xbb4fe8445e5eef72), teju_literal4(0x94bc428fbb528baf, 0x416a0a68935b8976, 0x3265a8200aae785e, 0xfef9bec29f9ff04f) }, // -3079
+  { teju_literal4(0x9f2298b6f99e3749, 0xd0c123fb8c8c792e, 0x1a3412c30f857c90, 0x4b6b9fe8c363964a), teju_literal4(0xe1f8e9bbd365d559, 0x50295fd554793b4c, 0x4503f3112aa92b1d, 0x44ce813945e771a6) }, // -3143
+  { teju_literal4(0x0150ba4273733f4a, 0x41ebedd4012811c6, 0xc6c875d74e583c32, 0x143f8091f47bbcf0), teju_literal4(0xaba8a96c5c54e4ed, 0x053886bdbbd46c88, 0x5fb22f239699443e, 0xfa76252f836e89c6) }, // -3207
+  { teju_literal4(0x73804a70f20ccbbc, 0x2e0920fa366d038e, 0x7bcaa4074604e098, 0x7d5654b919d95ec4), teju_literal4(0x82665c6e93e84a5d, 0xd1819a1ff11cee43, 0xfa829a8a7975fddc, 0x2bd01f90d1836d4c) }, // -3271
+  { teju_literal4(0x4afef140a1560d41, 0x8730e1d953943bbe, 0xbc34050ad96c2367, 0x3e734ba6a11093e0), teju_literal4(0xc61d83ee6d35b102, 0x478e24818fd5e005, 0x02e8b6a2cd82adbc, 0x0a71d3db54b970e5) }, // -3335
+  { teju_literal4(0x3fdc8f2ca6f6e7b4, 0x3b23dcf87e96091f, 0x4f161a47091bce8d, 0x3913ffa8f5a6353b), teju_literal4(0x967f54075de278e9, 0xadbb3aa0b23d9eb2, 0x7d04178beb18f8dd, 0x44edbac987b0dbd2) }, // -3399
+  { teju_literal4(0x71cf423d9ce02101, 0xc78f063fe10f6bf6, 0x556a1af14522db9d, 0xbde8e0e422611f94), teju_literal4(0xe4a63783c8f0c7fc, 0x540f549701939630, 0xe35fe1db2be9438a, 0x68d33f1a09d492c9) }, // -3463
+  { teju_literal4(0xd41fafd4487263e0, 0x885313bcc89f312d, 0xad2ab6aa626f2c8e, 0x9cbd6a452d8efb20), teju_literal4(0xadb13fee1ca67b09, 0xd0207e41af7a1795, 0x4933bbd3490d2b54, 0xff733d72a54cf7a8) }, // -3527
+  { teju_literal4(0xf352c51b6fa92156, 0x807072dcd617560a, 0x8a36ca58178353db, 0x586d13d3f0271823), teju_literal4(0x83f1d2c3152d19d7, 0xedea76e81580beeb, 0x0ab3efc65f2bc2b7, 0x0f855b688c7a3fb4) }, // -3591
+  { teju_literal4(0x3cc3bca007635a77, 0x19fd1abb68cbbb16, 0x9029cf3cb102148e, 0xd5e954b03505efeb), teju_literal4(0xc87656661ba376c3, 0x6709edb4c4ae7ddb, 0xe881398a63a1f461, 0x094c227d20a24de2) }, // -3655
+  { teju_literal4(0xa758f8702032982a, 0x82d08b829b3d4353, 0xe970b25658424d02, 0xda9810714377d79e), teju_literal4(0x9847bd7227544f79, 0xb4d240049c377784, 0x9c90dd89518f469a, 0x7b374773bad6f3ba) }, // -3719
+  { teju_literal4(0xde01c3a80596d044, 0x1304f917df997159, 0x84507fd39196b4ff, 0x09291c1c5bb04001), teju_literal4(0xe75ba39c07c24e08, 0x53c932a85aa36696, 0x3f54e5b4a6466fdf, 0xeac1fbb6462699d1) }, // -3783
+  { teju_literal4(0x0dd039a7459bc43e, 0x3653f9b648b3e8ff, 0x84572c5759a66b11, 0x6e50e20dcfd260c0), teju_literal4(0xafc00137e826607d, 0x7a6299bc30db76e8, 0x444179551faf25bd, 0x18d45f035dbfabf4) }, // -3847
+  { teju_literal4(0x9cbe510b1b355eb9, 0x13e7a4dbb52d06ee, 0xf0bf3df53bb84c20, 0x855e7dbd5252e8dc), teju_literal4(0x8581f867fda6d52a, 0xbbe36bd1f120956a, 0xf48f93b9f751063d, 0x81b98d875bf4882c) }, // -3911
+  { teju_literal4(0x4330a93e76d8b3f2, 0xa84ba4c798bd61d7, 0xd8af3ca440cd37cc, 0x95704e8ea266854a), teju_literal4(0xcad646f92709054b, 0x88e41f6a900b95aa, 0x5393f15ec05bcebe, 0x56e667a54fc70e2a) }, // -3975
+  { teju_literal4(0x49700845c3206791, 0xbf0e5d4133c59b90, 0x93f5f01c38722a5d, 0x25a77ca1d3d47282), teju_literal4(0x9a158f04a8c18329, 0x6a24bfad0ca1a322, 0x2c0cc380bdbba12d, 0x534b8fb9a274ff51) }, // -4039
+  { teju_literal4(0xad2de75120c06633, 0x8c53af6e31d9253a, 0x62ecb18e09c1f9e7, 0x20797a1fbb50ca1b), teju_literal4(0xea1946a371031c5a, 0x100907b064020fe7, 0x869d9186f5b718b9, 0xcafdac8e5ab6cfe7) }, // -4103
+  { teju_literal4(0x0ab53680b4e3b4a5, 0x640edccf0ae3f8d6, 0xbfc18b127eca52b2, 0x6c84db2a05471c1c), teju_literal4(0xb1d4fffdb2f15498, 0x72cd8d603e371d46, 0x482c426153b540cd, 0x1be65cf1e9461a40) }, // -4167
+  { teju_literal4(0x4a2a5a9030314f25, 0xcdebec6e723e20bf, 0x79f5099eff8a28b4, 0xec7873b62ab48b87), teju_literal4(0x8716db9272f6e55b, 0x6051a3effb08d360, 0xa92544e1bcfb174e, 0x1e72a4769cf20ee0) }, // -4231
+  { teju_literal4(0x4092d6aca7a796df, 0x9cddc4b57f5abedb, 0x644bb3537fa6118b, 0x6e083c97932391be), teju_literal4(0xcd3d6b3d71bb5cea, 0x68c6cbde0c4913c5, 0x5df65ce728e073ee, 0xff14c45419862019) }, // -4295
+  { teju_literal4(0xaa195f3923927fb2, 0x86ecb98d531d9f2a, 0xdf4a3031fffedadc, 0x804354ff63b5f7ee), teju_literal4(0x9be8d9249893f9c5, 0x03462b3bd521a48c, 0x060c9f0eae1f97c4, 0xfa7f104eb4b54045) }, // -4359
+  { teju_literal4(0x3f1b27c9ee9ac7aa, 0x870e9c698c626696, 0xbc1f325222bff670, 0x27865c5a526a044d), teju_literal4(0xecdf39839088d377, 0x62c43a3cb302029b, 0x086862868686aa22, 0x50de3ea75c8794ea) }, // -4423
+  { teju_literal4(0xa6bff1090fc92c1c, 0xff43c2cb99431206, 0xc5ad397ef2455a0c, 0x64681b7167a590f1), teju_literal4(0xb3f04f2c2984428f, 0xfd048506701f053d, 0xd1cb7abbb7ce5e2f, 0x12f6cb4e7999082f) }, // -4487
+  { teju_literal4(0xe84d3c0da7d9e209, 0x328d066c8343463e, 0x6f954654bee610de, 0x628d206d43e8a21e), teju_literal4(0x88b08aa2b114f07f, 0xe30e22e8520f1cc3, 0x45fbf1226168a67f, 0xc0c5397fc26f15e1) }, // -4551
+  { teju_literal4(0x5f9d32d377814fc5, 0x2454173f58335d80, 0xf32dc313e2916d36, 0xc66b611a697c2222), teju_literal4(0xcfabd90a5459aba8, 0x56895e9b810ec11d, 0xb786adc287733d5c, 0xb174fff7c81bcc5c) }, // -4615
+  { teju_literal4(0x11a3ae21ee664c89, 0x55449e437cf35e87, 0xe458c6493311b417, 0x83b320b3a395bdce), teju_literal4(0x9dc1ac69679142c3, 0x25375d98ca5fd906, 0xcc2c6a08fa91939e, 0xe4be6b8375e3aa18) }, // -4679
+  { teju_literal4(0xdd7adc65b0c81197, 0x37eebda1c24313f1, 0xaa7496eb80cb8e50, 0xc72eda923309326a), teju_literal4(0xefad95717f46dedd, 0x63e751f038f4265f, 0x8e0b885486baa2dd, 0x12f09b4a49c5ca15) }, // -4743
+  { teju_literal4(0xb877881f43fd7e72, 0xc0d26c0ef0e7d496, 0xe572434c0e5970ec, 0x8b7fe5594056dc48), teju_literal4(0xb61201e95cc00b4d, 0x3570d525b6f49541, 0xe7465ec5f0834c36, 0xded7b631d0bc1ac7) }, // -4807
+  { teju_literal4(0x704288071f1a5801, 0xb1cb0f4a4eb159db, 0xaef60fa055adc84e, 0x06a3304822f72687), teju_literal4(0x8a4f14248cfa6f7a, 0xd754b10db58352d7, 0x8594e79d724d604d, 0xa0e1b84719e94c28) }, // -4871
+  { teju_literal4(0x8d5183bb09d6268e, 0x332b112a8e4d8f10, 0x26c4c496463fc297, 0x97033d7ad6f452aa), teju_literal4(0xd221a6796453fd04, 0x1aab4a3cb4d81657, 0x406cbce30bc2999a, 0xa06c8e30d2f46d72) }, // -4935
+  { teju_literal4(0xb33ffef262237587, 0x30c6890ae40a82d5, 0x3d94af8e99fd95d9, 0x3926936a1b84fbcc), teju_literal4(0x9fa0199cd7a9cfd8, 0xde9ff943e05f46b8, 0x4e4eae33640dd2d2, 0x81293833b6a7bc81) }, // -4999
+  { teju_literal4(0x86483c67a8a128d1, 0x1b3870bd07270024, 0x28926aae894d2624, 0x7bb4a3a875f437f5), teju_literal4(0xf28473eec86e0de3, 0x1a9715a3023adb08, 0x05844d09fa01c0a2, 0xbdebdb38eba9a109) }, // -5063
+  { teju_literal4(0x562e64ba4729f5ab, 0xde4f55a3701cefae, 0x63a546a65ef14c67, 0xb4ac726872bc8247), teju_literal4(0xb83a2b956ff6fa19, 0x9452c970bb77253e, 0xd400925973208ab8, 0x25d98d6248248db0) }, // -5127
+  { teju_literal4(0xfd0c344a214d7f5e, 0xb8be5a324b9e73d2, 0x93d9683a088c1475, 0x31b3be1cdb56cb7d), teju_literal4(0x8bf286cff8da8bfa, 0xb8d7c66aed23c726, 0x1c7af1e54383512b, 0xd241e003be046554) }, // -5191
+  { teju_literal4(0x426e4e106bf48d2d, 0xa615d1166ea0837a, 0xa8687ac10465c190, 0x35ff42f7a84e4ad0), teju_literal4(0xd49ee9e73ccbfb1c, 0x16abba70ef81542b, 0x61cca26756177a18, 0x62bad200f0ff1d85) }, // -5255
+  { teju_literal4(0xe7bb97d143dc1ec7, 0xa7c9ac0c37a70b1e, 0xe4cedd5dae57777f, 0x3f4374cb38f71090), teju_literal4(0xa18431bb94918942, 0xa5cde70cbf233c91, 0xff3a273d9279a6d8, 0x57033bf59539f035) }, // -5319
+  { teju_literal4(0x3dc66d3cdd23d1e2, 0x3b15840621a5c23d, 0xd026800989a91a45, 0x4dd1585db2abc0d5), teju_literal4(0xf563eeca514308d0, 0x4e7bab294ac5faa9, 0x00163ff12da1c2ae, 0xe07572e399845869) }, // -5383
+  { teju_literal4(0xd888206481ddb138, 0x3f1ae5ddbd4280fb, 0x9f5c67f20406b7c6, 0x6c16a67fd6b57120), teju_literal4(0xba68dfcb490a1237, 0x170e811bfd2da36e, 0x97c49de96f1b7781, 0x6475360040308c02) }, // -5447
+  { teju_literal4(0x7a44d105b4250078, 0x54c9423c1bf6c909, 0xee23b54010d9a519, 0x0a92cf982ee593fc), teju_literal4(0x8d9af18989eaf88a, 0x0f1cbddd44489680, 0xacb41888cd26b932, 0x5890d0ac3297218b) }, // -5511
+  { teju_literal4(0xe5197b2b7f62b599, 0x707e957154b77614, 0x22b59a6b556056ef, 0xb351eff8c0ca8a55), teju_literal4(0xd723b9f449d6e325, 0x4600c1426d33cdd7, 0x3b11e004bf834db6, 0x7f801d420aaade4b) }, // -5575
+  { teju_literal4(0x5410fd356c5a6408, 0x05e68d58ef42bac8, 0x55fa445145b71e06, 0xd4364c3ef02a6458), teju_literal4(0xa36e05f5ce2728c8, 0xdcbdca991a1c939d, 0xc73f2843d75a137e, 0x4a7e85d77136a15a) }, // -5639
+  { teju_literal4(0xde09c0de1b5fa77d, 0xffd0dc7a1249b653, 0x26457b6f0152d41b, 0x602b48b1c492659e), teju_literal4(0xf84c202143b3dd73, 0xffaa942125366dd7, 0x00d36e46a9983287, 0x55e5c87a3f87dd2b) }, // -5703
+  { teju_literal4(0x68a79044042d7422, 0x04fbacf6f0ef40e2, 0xeb4864b410ae20d2, 0xedd0caddc63415bd), teju_literal4(0xbc9e3261429c7630, 0x18a80464a12aea33, 0x43d8c388c219dcc8, 0x4db6852b8da4d459) }, // -5767
+  { teju_literal4(0x01d4e4ffec3f7061, 0x3a5c521ef045f793, 0x7ee763e3d71e0fac, 0x950c96330eca546b), teju_literal4(0x8f486362ffc282ba, 0x1934382562028185, 0xfb322ee913834b44, 0xdda6bbe267ffb60b) }, // -5831
+  { teju_literal4(0xa2c5e5dfa0dd211d, 0x7cdc72bcb607879f, 0xc8709d1d8e4cb41c, 0x729d2baf8d6b6d85), teju_literal4(0xd9b02d859627e4b4, 0x1c3b7e96e92e3aa5, 0xdcbeef9de5e7e93f, 0x2aa8178b9a0ba75d) }, // -5895
+  { teju_literal4(0x9750053b44522bc6, 0x028395831b375809, 0xfc62e5cd4ab13840, 0x67040f707ffdc84b), teju_literal4(0xa55da7afd4afd6f4, 0xc83d0fa8c1384029, 0xdd1eacdfc1c42d9b, 0xd30ec1dff8987bd3) }, // -5959
+  { teju_literal4(0x90991e8653813009, 0x6cf5a1f251fcb6b5, 0x981c7c00eb8f5ae0, 0x8b5d4bc3109347a9), teju_literal4(0xfb3d225ffbb4f77c, 0xd12cad429a61aa34, 0xe02d9061742eae21, 0x3401e02d66d0f4e4) }, // -6023
+  { teju_literal4(0x0c8b1abf3f13f239, 0xfaa4ef4461a0731b, 0xae1a9f1205b83e0c, 0x1c3c041cfb6bfd00), teju_literal4(0xbeda3769e0633ca1, 0x9ab4693452ef85cb, 0x41e8efd28d96ffe2, 0xf462dab9b2953076) }, // -6087
+  { teju_literal4(0xf86240cd51e505b1, 0xdc050b049936d067, 0x849700da30beaac9, 0x92e9bfd26849d5f4), teju_literal4(0x90faeb9bcd522dd9, 0xa188fe3d29f4a873, 0x4af4f9ea4be1d9e3, 0x0e35898b1a29ad21) }, // -6151
+  { teju_literal4(0x7abfb6b390cf4360, 0x9fb0bd44d8f9a668, 0x50cc76cc1eab2db2, 0x7ae738c816b9c1b7), teju_literal4(0xdc445bc59b2a393e, 0x2dbc3d5789ad3dc4, 0x10d911dc750c6a22, 0xa9c1bb3ada27466b) }, // -6215
+  { teju_literal4(0xb7c801fe25b148d6, 0x29da16a98750c4c7, 0xc1e3bf440fcc5429, 0xc01c78f8fea85b23), teju_literal4(0xa7532882b6ec968b, 0x26c5ae23e27870f0, 0x2fb5ed7018ecaa26, 0xde336a0e17ddc120) }, // -6279
+  { teju_literal4(0x4f4aef368988f171, 0xe9d1e68836d061e4, 0xdba27f910da1d779, 0x8082367bea62ec62), teju_literal4(0xfe371042f76df218, 0x2cbececd7fc499e7, 0x025373ecc4736424, 0x47cfb48aec2f0e7f) }, // -6343
+  { teju_literal4(0x8daf859ababb1c74, 0x07f4a92716c6b177, 0xf6562854f91a89bf, 0xe42099e093abc093), teju_literal4(0xc11d033485981972, 0xfb3410455c44d463, 0x2759be5cb47bba63, 0xbe59fda9ecd2fe5a) }, // -6407
+  { teju_literal4(0xed88d3d77534221c, 0x1b2c0bfbfc68e3f0, 0x63b371ae61b311e0, 0xdc06648644f07989), teju_literal4(0x92b299a1a37db33d, 0x274cd60dac933bc3, 0xc6bb98d3ed40ddf9, 0xaedb2f2547f66753) }, // -6471
+  { teju_literal4(0xfe746114ca96ebf5, 0x69c1a295d65ec12d, 0xaf4e0c5e57f636f8, 0x8c781642df33dcab), teju_literal4(0xdee05c2513925760, 0xe12985dfe754a042, 0x31c4740878d9830e, 0x175b037bdb8cc660) }, // -6535
+  { teju_literal4(0xfa9e7fd6b9369edf, 0x7575f77526a29cc2, 0x0d05333c4e1bc5f2, 0xa135df5a6edf9f03), teju_literal4(0xa94e9a3ce20f1b34, 0x3f24333f44c39031, 0x4ec851e3cc26cdf5, 0xcced37c7da27f71a) }, // -6599
+  { teju_literal4(0x2402d7ea2ec61bb5, 0xe89b3bba887a094d, 0xc98c8a086e0abcd4, 0x9c9bc23682aedc3d), teju_literal4(0x809d026be51f64f5, 0xfdefc7c1ba1a07ea, 0xb7f22e7c3ee9cd7f, 0x6bae2604fb64060d) }, // -6663
+  { teju_literal4(0x626c10f7fd2f0f97, 0xd1c6fe981446b650, 0x50ec2c3a10a7c8af, 0xd5abd7c2aa0b39ce), teju_literal4(0xc366aa4e2d9555d8, 0x803d9b50df18d87c, 0x46470b25f3621651, 0xcc3b26aa63936e61) }, // -6727
+  { teju_literal4(0xf9da2999ff41392e, 0x5dfc53603c79bd87, 0x312f6ed0cd6c0658, 0xe7ddeacfa0b90f58), teju_literal4(0x946f7d10fd5853dd, 0x4d7cab3c17cacffb, 0x04f8b115776b5823, 0x8074954d490d532e) }, // -6791
+  { teju_literal4(0x5329ce5eb176665e, 0x048cb68aaa525f56, 0x3b24b90d6e3184ac, 0x4baf44ac4632b2fd), teju_literal4(0xe184465bd06dbbe1, 0xe1f315b65b4dc676, 0x60620dbd58ea11bf, 0xe8172596e50dd78b) }, // -6855
+  { teju_literal4(0x03e16afa9416efa6, 0x6c8055d9743c938d, 0xcaccd2e6a7d13f08, 0x4b49837c42680ed2), teju_literal4(0xab500ee2c393b93e, 0xef33996d4348838a, 0x49826d24accae33b, 0x18100b54ba6dd757) }, // -6919
+  { teju_literal4(0xbfa55d9c2400f920, 0xaabcac07e4ea09f9, 0x7ece6aa86964526f, 0x8beb8b76ff67adc6), teju_literal4(0x82230dbf0953082d, 0xb56a3ff406b80dec, 0x143745814b86e617, 0x02019a4e8e9e3d81) }, // -6983
+  { teju_literal4(0xc2c871cc949208fc, 0x91038c3a74df25cd, 0xe09655df3caad325, 0x9a6557e85c7e6b85), teju_literal4(0xc5b7418226a1a523, 0x7095031787c4de7b, 0xecad5977f13b173f, 0xc28b82204e1ec6ff) }, // -7047
+  { teju_literal4(0x733ddcec92d43ac9, 0xf756ae0b207d6bdc, 0x62f2ea7b5e5f2e1d, 0xdc749ec24a3f107d), teju_literal4(0x9631a5b5ae0af5fc, 0xfc9c0488119aa2d9, 0x4216c460bea6fadf, 0x2aeb9098dfade208) }, // -7111
+  { teju_literal4(0x46362521dec26391, 0xc74956e27aba1c13, 0x88737b6a2e72e7c4, 0x113505704e0649a3), teju_literal4(0xe430326990b8d90a, 0x7b33643f68fb18d1, 0x380945670a7d5bc1, 0x40b0620f58e55a80) }, // -7175
+  { teju_literal4(0xf6568839066bfab6, 0x3765ea9f980b9e68, 0x2f77d54060741776, 0x4a977ac7b104ea1e), teju_literal4(0xad5798af6d062da5, 0x92b951d987959961, 0x381764e7ae9ffeec, 0x96d01bbb69d23683) }, // -7239
+  { teju_literal4(0x9cce4db3872f0bd4, 0xd3158fddfdbf4045, 0x7b01575e08c59b9a, 0xe6a2729b5c6bcee6), teju_literal4(0x83adb7f439886d99, 0x188f86e3bc31566b, 0x0b1a5746b2059d9e, 0xdd340c617cb963c1) }, // -7303
+  { teju_literal4(0x05cdbed4b23c9f98, 0x6343ea6fbe1f08f9, 0xddbc31c5bed314db, 0x59185e127ffefb05), teju_literal4(0xc80edddacef27843, 0x52d02a3a889c8711, 0xbbf7e487532b9a81, 0x968489d4d55f108c) }, // -7367
+  { teju_literal4(0x8ea759405fc5b7b8, 0x4686cf413815bf3f, 0x1e84698869842546, 0xfc549ef684ebe9d2), teju_literal4(0x97f9238b706898a2, 0x63c96bf5a0f9b896, 0x8fe980646fa54209, 0x8e36b758abc27fae) }, // -7431
+  { teju_literal4(0x57d93010bf526aa5, 0xa8ca08c66eed33a3, 0x4aa2c69d268245d1, 0xb38744b1c7b0d50e), teju_literal4(0xe6e43896db82d3f0, 0x34576845fddef2b6, 0x2ecd2c546b8f9d0e, 0xc5dbcf86fc0c9e90) }, // -7495
+  { teju_literal4(0x664e154b39f2374d, 0xe40214ecd2c7a695, 0x89b271bc219dac6e, 0x5b4bc37dbb3810a5), teju_literal4(0xaf654a1539b70ee9, 0x263d260620a52abc, 0x0e1e6fe4d727f127, 0x3c7e218c085757ae) }, // -7559
+  { teju_literal4(0xf5c113d3f675fb82, 0xbbaa437ba879ef69, 0x0aaa733cf035f86b, 0xc7843466bc1f9925), teju_literal4(0x853d0f0ec6cea326, 0x1edc0d1954e9281f, 0x374ec73a0aa3001b, 0x491c7aa004f7435e) }, // -7623
+  { teju_literal4(0xe9941aa5d99cca73, 0x34d31bd51bf50b45, 0xcc91e1b7341b7d1c, 0x49119f62f96cbce0), teju_literal4(0xca6d94a253eb85f9, 0x1831fcfd08fd6ddc, 0x9306d5142d3f2d6c, 0xad9840b5d02d8b45) }, // -7687
+  { teju_literal4(0xa37454c9c46d06c6, 0x20413ddca131e1c2, 0xc2a03bf42bc72468, 0x398dcb1dc629b827), teju_literal4(0x99c606be783635f5, 0x90ec060900a092e1, 0xc116278d0170411d, 0x4971f5b0a678153b) }, // -7751
+  { teju_literal4(0x9ac18fad7afb1dce, 0x72a7ab82503083da, 0xddcc18d6e23fa6e1, 0x21b97eabdf1d2abf), teju_literal4(0xe9a07175dca6ce73, 0xce9d43518214f738, 0x0ad0423a143e6ab4, 0xfe579650bf7beebc) }, // -7815
+  { teju_literal4(0x164781f7e7f0eac7, 0x4fb2cd2bc17e34e9, 0x95d53e57b5ca64a0, 0x4a08b89282ae2e70), teju_literal4(0xb17935be7667c8f9, 0x70059dcb7fc615ba, 0x5e7e4fe6b1be028b, 0xece60c3e947a9fa3) }, // -7879
+  { teju_literal4(0xcd11a993ebb09c28, 0xe0878d797c9ce120, 0x9ff845bbad74de1a, 0x18324b633d895e1e), teju_literal4(0x86d1213c816c3bcd, 0x2a82bbc7ddf24796, 0x4c76bba711cb064a, 0x9c6f48bbca6ef3fa) }, // -7943
+  { teju_literal4(0xfbcdf1ef4c6c025a, 0xe72d2e11302fabf5, 0x0c911dc2149fe347, 0xf7dcad0a5bc76b0d), teju_literal4(0xccd37b6373a25217, 0x23c221faa9575311, 0x71263a78422342a5, 0x475cd7eb759621f1) }, // -8007
+  { teju_literal4(0x23de694072bd4327, 0x954e4a66d743b093, 0xc251263c6cef9aa2, 0x0ddcf71b76d90d37), teju_literal4(0x9b985fac052b3d0d, 0x3958261946b1aa66, 0xe4d5044ce1391256, 0xee21a117a2999cce) }, // -8071
+  { teju_literal4(0x7db05094d6634e27, 0x0b95ac403b3e54d9, 0x290a3d77cb97f761, 0x1735b93cbb5c95d2), teju_literal4(0xec64f5e34422943c, 0xeeb84924e91bdecb, 0xb837627ae487fed0, 0x22be9f687f6f0b0a) }, // -8135
+  { teju_literal4(0xb4f7bfe528d17d43, 0xadc1c443af5a0f1c, 0xdfa17f4210b6f290, 0x257b8cd3f92784ba), teju_literal4(0xb3936e8e0af31838, 0xda741e294d540cc4, 0x33b5a505c1fc0137, 0x3d394dd28e20c833) }, // -8199
+  { teju_literal4(0xce051d90e8ebd102, 0x6a92c58b1040c390, 0xd17fdb8fd1b3a11b, 0x80393cbc3d6e7f23), teju_literal4(0x8869fcd639c09880, 0x0f2e1b34f5faf2a2, 0x8a8499f97c8dc52b, 0x86f1c1720bc5c4a5) }, // -8263
+  { teju_literal4(0x64bd2b70148123e1, 0xfdb4a70e54dc03bc, 0x37e174745c467659, 0xfb2cd3ef64418772), teju_literal4(0xcf40a7ea40ac92c1, 0x02576d00c52340c3, 0xe5b03653cfcbaa7f, 0x95d322ab5e4763b3) }, // -8327
+  { teju_literal4(0x0eb82505545186af, 0x384cb6cf2345c9b1, 0xd982f261ba2a829a, 0xd4cf01787e94ef6f), teju_literal4(0x9d703ee2f7afdb57, 0x10ec7f0ce32144f5, 0x54a878b3e653f466, 0x429e4897d46d9254) }, // -8391
+  { teju_literal4(0xb9d37bee21141702, 0x24b7e002464f0e37, 0x0bfef874fe1b65f0, 0xd0a60fadf5c9b92d), teju_literal4(0xef31df07281298bd, 0x263c6f6bf94eef6c, 0xd8c24f3e7dc393cd, 0x26b4278aafae40ae) }, // -8455
+  { teju_literal4(0x69aaf3493d46f642, 0xbe5e59f30395bd21, 0x39d57f73eefad13e, 0xf3601e027ed249a1), teju_literal4(0xb5b407a025f809b8, 0xa903db52d21af4ba, 0x9305a9b5c235aaa0, 0x88324f449246ac05) }, // -8519
+  { teju_literal4(0xda0f48986a0e9355, 0x9f50ab57f21219a6, 0xeb3aec53a49ab19c, 0xe61344bb776126ff), teju_literal4(0x8a07b06042ac0b7b, 0x22b74d9eb0a19502, 0x4a589a9feec9e5f1, 0x4fe222e07c130255) }, // -8583
+  { teju_literal4(0xd7b7d572f4d67d4b, 0xea0b866bd6be4a9e, 0x54f5ed176063a077, 0x3fc7779668429150), teju_literal4(0xd1b53044e8406774, 0x007da9e2d9751c04, 0x0c44012032ddc72c, 0xbc12b5eaabadb750) }, // -8647
+  { teju_literal4(0x4e75dfc0fa374432, 0x5e2a61cce48d1641, 0x7c37deab8ce32c78, 0x5ae5c372f9d0035a), teju_literal4(0x9f4db524675e5d9d, 0x4385125b33d88ff8, 0x395be45644c39400, 0x2b8c34fd5c36203a) }, // -8711
+  { teju_literal4(0xc9c43c645decb1db, 0x5b92e082da285dac, 0x5cce7d84de0e2a0e, 0x6090d15a56975f14), teju_literal4(0xf2074655e95b4c51, 0x8ce4ecf12eae67ec, 0x5292b79689cc8870, 0xe5bfebb63eacac49) }, // -8775
+  { teju_literal4(0xa9b6b52ebc187510, 0xb088eba9faba4852, 0x3ed4d3564253c8eb, 0xde9a1762d7859fd5), teju_literal4(0xb7db144aea8d990e, 0xf047b4514312925b, 0xc98559067e5ea0ca, 0x4147b6f09eb6c523) }, // -8839
+  { teju_literal4(0x1c78905b7bfc161e, 0x8ded51c810223508, 0x05580258714c2026, 0xbd33737f1fc1e7c8), teju_literal4(0x8baa4a8af583774e, 0x5548695ee6f53afb, 0xfd5321136fc659d0, 0xa96e3e2d4c75cd95) }, // -8903
+  { teju_literal4(0xa5645b4a22fbc820, 0x3a0bc413bc03f85c, 0x18b560c37159d1b8, 0xac21643fa38c06c7), teju_literal4(0xd4312ac47aad6ab7, 0x54ba9b1fb4952f06, 0xcd67a8a73f622814, 0xf4914f70e579c0de) }, // -8967
+  { teju_literal4(0xc186916994709066, 0x825a1336a15f3459, 0xa7e0e839a14da585, 0xcc91467bf250eae5), teju_literal4(0xa130d3643b4d00ae, 0xdb94dee0be0c0a09, 0x84395c841a4684f9, 0x1420eb2c658d4f73) }, // -9031
+  { teju_literal4(0x12464d7160bc266b, 0x9f6d9685553c3ea5, 0x8f663c2b06c0a411, 0xdff438a6ff1fa65e), teju_literal4(0xf4e545911b07e6ef, 0x84f13b1b5f2b5fc8, 0x9aa675d1c20b7451, 0x7acf31bd3b90fb6f) }, // -9095
+  { teju_literal4(0xf65932a57d0a918b, 0x8c3bdb767a212266, 0x4a2ff520c559c4d7, 0x9cde7a819e947694), teju_literal4(0xba08a81f200516a3, 0xdf7a891915f5fe48, 0x8001a4d54e3e4a24, 0x6fc78ee3bb5ae0ce) }, // -9159
+  { teju_literal4(0xfec24ad319cd79bd, 0xc7a7c5bf91f7d4d9, 0xe379c558efa3031d, 0xca711e3ef525dcfd), teju_literal4(0x8d51da33379418ff, 0x0fca126459b498db, 0x55d13b13188a9aad, 0xb2f6be55b4f2e3a5) }, // -9223
+  { teju_literal4(0x824c4e6ed8f23705, 0x8811dd33b403f73d, 0xf2622098e07aac0d, 0x4212d64de0c45a83), teju_literal4(0xd6b4adfdb635bca8, 0x0f5f3e4207d87041, 0x82a76af20bba0088, 0x7e6900b292ed8a33) }, // -9287
+  { teju_literal4(0xa066d0b5bcdfca64, 0x6ec13b0f43635db1, 0x4b32effbcf1bed48, 0xd7d8fd17f71f5ba4), teju_literal4(0xa319aac9c42599e5, 0xaa588fecc2916436, 0x3e4e9974e6802b4a, 0x9476de351525c3ca) }, // -9351
+  { teju_literal4(0x7110b1e354c947a9, 0x5bba921ac3358138, 0x61bcde96f18b60cd, 0x2e765c92eee92ac6), teju_literal4(0xf7cbf6c86c66df68, 0x7cdf3e31cfb23b17, 0x13e1f7da0ae87e6f, 0x2995e4eb20fca5ae) }, // -9415
+  { teju_literal4(0x9c422026b1d6aa7b, 0xb48352fbbe878801, 0x809ea1c4b215f237, 0x5088b3768f9e5642), teju_literal4(0xbc3cd6e8e3c19408, 0x1f90937aa66a1fcb, 0x442b8893ef04fa9e, 0xd1bfabf85f7bbfd7) }, // -9479
+  { teju_literal4(0x6fcd440beefb92df, 0x3649befd7386443d, 0xa0eb5362409b1cde, 0xf2766df94aae9799), teju_literal4(0x8efe6e63013c3ad8, 0xeead5fdf6a33e287, 0xeb53bdfec8341dc9, 0x547881d02cfd6552) }, // -9543
+  { teju_literal4(0x49d5be25abc1c7b2, 0x1a281f2d0fa8ee6a, 0x4c39dc200138e993, 0x232172c1ee79653a), teju_literal4(0xd93fd0c9d44e3a2b, 0x2eb3cfcb07592da5, 0x182e9d974430f4a2, 0xc35a26136b767b83) }, // -9607
+  { teju_literal4(0x3c64defa7991b7fe, 0x2a86f500160d8754, 0x13b5c2c587e39123, 0x07464e4f53d79560), teju_literal4(0xa5084cb05810902a, 0x35b18e3e146deccb, 0xb25d8d54679c4bba, 0xd990d7afab03a3fa) }, // -9671
+  { teju_literal4(0xea69b12c74b81880, 0x6e831d20f530156a, 0xe0af0f72285cf1c8, 0xb420f329501e6c8e), teju_literal4(0xfabb745a95ec5f3a, 0x63864da10d987369, 0x82d23bea36cb6821, 0x801f551d83654393) }, // -9735
+  { teju_literal4(0xb05a78fcea4093f4, 0x48ef53dddaccf10b, 0x8bf63d22f9d248b3, 0xeefac44c8b23314f), teju_literal4(0xbe77b4b05d2aa6d2, 0xfa394b6b15ad06da, 0x7a3d74cbe36e1c14, 0x727be7ca36319982) }, // -9799
+  { teju_literal4(0x6b288440259cb4a6, 0x52abdb9cd4c24eb4, 0xeb29739cd9e68f6f, 0x9f251642347476ff), teju_literal4(0x90b01651e69d9be3, 0xdd40d2e2d8bf842a, 0xac70fab7db7186a3, 0x65c8d7f815dd07b6) }, // -9863
+  { teju_literal4(0x1e4ed93cce459ff4, 0x6c37d2c867a7f507, 0x0d23b9d7619b1a51, 0xbdd8b67de3f6a673), teju_literal4(0xdbd2aa47594d2a67, 0xdb1cf96b1ec798f9, 0x88121ad98b2b448e, 0x42b8fc096f543fe2) }, // -9927
+  { teju_literal4(0xaee50544c70530af, 0x18b2c12a3b0c3435, 0x888d2e481f6acb27, 0xcc3e0b980c5e40de), teju_literal4(0xa6fccaa7f078aead, 0xda5f17fead7fe77c, 0xc331d110c0785490, 0x5790785e4c35d5c4) }, // -9991
+  { teju_literal4(0x65ab4e7464ee8ed3, 0x18c189128dff7075, 0xde0dad95648d01f0, 0x0ea7bfb8e073b7d6), teju_literal4(0xfdb3d8f648e31c17, 0xf479226a715e1949, 0xad307625e1d1f70e, 0x301210db660ea9d9) }, // -10055
+  { teju_literal4(0x50c4e079a640655f, 0x29415731273b6618, 0xd1ba6ead13b520bb, 0x161d8252e8ec0548), teju_literal4(0xc0b955ba73c0e5ad, 0x4eee899d311db5b6, 0x1477a2831b90520a, 0xcee0a029b68caf84) }, // -10119
+  { teju_literal4(0xc4f0cee4500a0217, 0xc45c5d35509fe69d, 0x4085c1a63bd5bc09, 0x970d8601fe1bcae2), teju_literal4(0x9266e165a1ee6682, 0x1d76c3488ac8ccde, 0x6afd72118a806edd, 0x33697de558c5ef79) }, // -10183
+  { teju_literal4(0x6ce33e4af6a24965, 0xf16334f301355864, 0x2f0fe0ca3937ac78, 0xa4d5ecf8f2b041a4), teju_literal4(0xde6d51dae68ec245, 0xb160739a550ac850, 0x21d4e92f787e5852, 0xba9815dc9cc9e1eb) }, // -10247
+  { teju_literal4(0xc8a39a42147d151c, 0xe0ea68187422223c, 0x341388925d9d03a0, 0x4fe4d2748e703be9), teju_literal4(0xa8f73675c9ad6b5d, 0x4dcbb0da3d2c32a9, 0xc21c854976918358, 0xa8c5c9c346836c01) }, // -10311
+  { teju_literal4(0x099a0368f2a93611, 0x16f52802af8d9564, 0xeee5eaedda168a10, 0x9a1a5b64dba7b45a), teju_literal4(0x805a9fcd90fa0cea, 0xf35f8799cda7ef42, 0xcaf0693aa5a77cef, 0x11742b1cd24f98b6) }, // -10375
+  { teju_literal4(0x433bd7ef224dbef8, 0x4590ab012ba30585, 0xfca07b319adbbefd, 0x02999039f595f32f), teju_literal4(0xc301ce89875a968e, 0xc316c4195320ccf3, 0xe1b957931004607e, 0x17c22c2080c5825e) }, // -10439
+  { teju_literal4(0x2b6010eed690b584, 0x3e86c0e67587c3fa, 0x61a63f9241b94006, 0xbfc32758242575f3), teju_literal4(0x9422df329f6d9f70, 0xed8edca08f3af765, 0xc51499f717097c06, 0x2ac098cd631484b7) }, // -10503
+  { teju_literal4(0xd3e133231e661c69, 0xcb74f60e5ce3f40d, 0x6fcdb60853910028, 0x6bc44ccb4f77ad34), teju_literal4(0xe10fdf300f16f407, 0xea52ad2e2a05c774, 0xd737a7a8ed7ff655, 0x1a9f4cb184bd19b8) }, // -10567
+  { teju_literal4(0x9327e274d1cae41a, 0xb76f8f6ef3e618e9, 0xb4b968601fc1f665, 0xae695a2a98312d53), teju_literal4(0xaaf7a21504694c0a, 0x919af8a5152dd45b, 0x5fb603fc18fc1922, 0xe5ae645bd848a8a3) }, // -10631
+  { teju_literal4(0x1ec18b76686b1cdf, 0x35ef4e1ed7b90f74, 0xc6e9a32bb4d42513, 0xdf67125e018c4f0c), teju_literal4(0x81dfe1cd4f46f89c, 0xa3a078733f2e209b, 0x62aebd556ca4976b, 0xe7284000775feae7) }, // -10695
+  { teju_literal4(0x6b27d44983bf01a3, 0x26452f7798f9aac9, 0x235278ffbadb50d5, 0x9d4ca5ff1c586e44), teju_literal4(0xc55133de2a8f18cd, 0xc4851b699e9036b9, 0x6f29adea4aefdf89, 0x7a66a23b9d851b39) }, // -10759
+  { teju_literal4(0xe7e9e8988f5e4085, 0xe78ee9ccbd503b1b, 0x2be095f19be1aa17, 0x5c3e8f74b40c4caa), teju_literal4(0x95e41f7c8b00054b, 0x463db80eac2f87ed, 0x335c394cbfadf426, 0xbe8bfe595940a5cb) }, // -10823
+  { teju_literal4(0x495535c4cc2ebe66, 0xf8a4c669a5a7b155, 0xc188a70ad3ad03b9, 0x5de7147a3888b876), teju_literal4(0xe3ba6a3a2eb817be, 0xea3a79d6f34c6e44, 0x8f8fb1a077071929, 0x0117606a5eb5e321) }, // -10887
+  { teju_literal4(0xbc3efa2513531bc3, 0xe062928f33de1174, 0xb236918ede6ed117, 0x6381aba877c57537), teju_literal4(0xacfe1fb74942267d, 0xd6f83b5183415eec, 0xdf34609b6ca792ac, 0xf9986c1257ed43ee) }, // -10951
+  { teju_literal4(0x578457888663d072, 0xde58b51c1310ec70, 0xd35d62244c03c9e7, 0xdf1095fdd50ac9ce), teju_literal4(0x8369c04c8a9a2920, 0x66a65fb2faa1470d, 0xd08b558c9a262228, 0xced24d92b7e44c40) }, // -11015
+  { teju_literal4(0x948f452d1198399d, 0xa47e1cc5a927a7cb, 0xfaea88e142ce2b32, 0x1d519363de8527bb), teju_literal4(0xc7a79ab7df57a979, 0x957850f77c827b85, 0x926a91b3292ffbd8, 0xfdd94583454e31df) }, // -11079
+  { teju_literal4(0xb50c2775e97476d0, 0xd22e30611954cd39, 0x544d97f0b3d02669, 0x69c9c7cab1f81990), teju_literal4(0x97aab236df7a67c0, 0x2015bc23d4370905, 0xca10362b1db9be4a, 0x4930a120badc264b) }, // -11143
+  { teju_literal4(0x394210579aa8c44c, 0x7e4334b8dab11662, 0x59ed6c829006894a, 0x26cb433a0533166c), teju_literal4(0xe66d0b3543c6102f, 0x1cc8883490a5b9ae, 0xb42235d140115630, 0x23e8ec9c19a778dd) }, // -11207
+  { teju_literal4(0x1a6a467217ce68c6, 0x041d79d9b521b315, 0x7d0872de59b1df58, 0xdd092c7f5b913c90), teju_literal4(0xaf0ac1c56e090901, 0x5c96965ed7ed0a78, 0x195889081f310639, 0x71b72267ae2d1de9) }, // -11271
+  { teju_literal4(0xf1627b1f1fc0df72, 0x98b8982448e47b11, 0xde4e4cfefa13e741, 0x0055fe412603fd50), teju_literal4(0x84f8494758604977, 0xd7d9dff12f1b580a, 0x2e603c47c9c02636, 0x91f314d95921e59b) }, // -11335
+  { teju_literal4(0x390692ad0bfbd033, 0x32296c8a2eb78a13, 0x33442cfee74837d1, 0x1e0492024ed96b16), teju_literal4(0xca051855d5ec3488, 0x62f3f22964d32fc7, 0x2d4018507078b8b8, 0xe0b9e56d704ddd32) }, // -11399
+  { teju_literal4(0xf2a38be9d23e01f4, 0x91b1c3358d0e93d7, 0xcbd2c755f3857b57, 0xd9bc61520805e621), teju_literal4(0x9976a785779e8ced, 0x5716297c511b9f30, 0x7c4e8dbd51441392, 0x0bdf0f6a8a28ad62) }, // -11463
+  { teju_literal4(0x6d8f87c9eaa798e4, 0x3013c1fe207e0a91, 0xdf3616682d9c5606, 0xa1e18d92c3d2523a), teju_literal4(0xe927daa6cb5da6f6, 0xccbb5ee3e3302db8, 0xe9f0d50cbd47482d, 0x05b2fca56f4445f3) }, // -11527
+  { teju_literal4(0x9907cf7eb8ce4adf, 0xb8266602e981af59, 0xdda1f3a1bfeb9458, 0x58ee2a2da9c575f0), teju_literal4(0xb11d9ae01d1faa95, 0x9e77f16e884d45b3, 0xc4b32b7578070e47, 0x9e975c4a6fa0377c) }, // -11591
+  { teju_literal4(0x40c6e86df237161a, 0xcaa9ca1e7a327483, 0x494d273977352066, 0x57e71f07f19a745f), teju_literal4(0x868b8ae4374e1b2e, 0xae3996a38d239288, 0x9b166c02f7e6587f, 0x2e34419713f45786) }, // -11655
+  { teju_literal4(0xe149abaed6cba7d3, 0xa4f39bfc3f1e3499, 0x126db33457e1eced, 0x97fabb1a70eabf48), teju_literal4(0xcc69c237ade2f9b3, 0x10622d572bc01b41, 0x8a67d4dfeddb81d8, 0xde33156108030733) }, // -11719
+  { teju_literal4(0x5f4a6409a01a43d8, 0x85f613dcac32fe59, 0x26f6108467b021ff, 0xf28e2eaa09b0db0d), teju_literal4(0x9b480fbd20cfcabe, 0x29fafdfb02c42fa6, 0x46b13cd10d1d4846, 0x80f54d7b63ac7b3c) }, // -11783
+  { teju_literal4(0xa78d36b3fd962486, 0x20c4db2d7d20b2d4, 0x3040128c0351fe45, 0xeab76e6c4b0e72d0), teju_literal4(0xebeaf15ea047f22d, 0xb2c1ef547a55dd03, 0x2c8004bcb3a3939d, 0x111e7ab02f836cf8) }, // -11847
+  { teju_literal4(0xe09c7d06b87c7550, 0xdcb3f630249757c0, 0xefffce8b09940ef2, 0xccc2ddd0ac266015), teju_literal4(0xb336bde07ec953c9, 0xd9df45e65507a7cf, 0xa925b46e1b8c663e, 0xc024c3fe5dfda3a3) }, // -11911
+  { teju_literal4(0xce78fc622601c991, 0x7f608fc3bc355db0, 0x5fa79624ca86a711, 0x5cfecad820225050), teju_literal4(0x882393748fff396d, 0xb34b1c6324f4a51f, 0xddcdd70ad77dc431, 0x6402b244938659fd) }, // -11975
+  { teju_literal4(0x05f5664201eb4a60, 0xf3aecf0b40fc3759, 0xdeb7d6f40852e504, 0xadbca4b4a4dcc058), teju_literal4(0xced5ae1e3999e065, 0xa67761c6c6a672a0, 0x4431f6d50cc94fba, 0xf6eb43266400666e) }, // -12039
+  { teju_literal4(0xc6e65748397dcf52, 0x6063ad1cedae00c0, 0x3e9242decadeecc5, 0x5bd57b0a7157477b), teju_literal4(0x9d1efb642f8489c9, 0x0470dbb007698c3c, 0x278d426b6e5f525d, 0x2d94b93250f5d5f3) }, // -12103
+  { teju_literal4(0xc3618506904a11b2, 0xe7403e6cef36cc13, 0x0a4aa0b843fcf5d9, 0xa3b1687958a74b18), teju_literal4(0xeeb66877dc81ad71, 0x1af91d9e830f3e00, 0x114e924f1bd6da6a, 0xac9eea5afd7467f8) }, // -12167
+  { teju_literal4(0x0328092559ac2039, 0xd5e1414a8461f568, 0x3c2b6e222352da66, 0x05ba37fe302cf821), teju_literal4(0xb5563dd8e47d4339, 0x9428f0d6b32c0f13, 0x259847021b8bf304, 0x984eea1b7d39350c) }, // -12231
+  { teju_literal4(0x6049677164e80c97, 0x4dbfc92956ffb115, 0x77e256ee96088be3, 0x2079ebf067b2d49a), teju_literal4(0x89c07175371aecb1, 0x7dfe0ce177c2a075, 0x395b62d4d861d19f, 0xbfc9ff82ee1f5677) }, // -12295
+  { teju_literal4(0xc141952d4c27b8d6, 0x9b18c0ddeef212a1, 0x88b83624e7194ea0, 0x9595a47d25a65e5f), teju_literal4(0xd148f20c43f06af6, 0xea20eb01bcc8a151, 0x61db56ec1315528b, 0x5e48adf9f9d0fb63) }, // -12359
+  { teju_literal4(0x4813e9f0285f6a4d, 0x96ccfd6e7b3707c7, 0xe4df6e035032866d, 0xcfc74582ebd70969), teju_literal4(0x9efb7b331579f6f4, 0x4d93707b0f744590, 0x2cd6db553c5dc047, 0x38acbf10040b4773) }, // -12423
+  { teju_literal4(0xfe22188f717885cc, 0x2b5e5d452a44c348, 0x341b51f14b58fb9a, 0xa7da9c43b8567a15), teju_literal4(0xf18a5959bd6e884f, 0x9314cd5b37f45dc3, 0x3fbbf015dfc76a4c, 0x3386e0c9215caab9) }, // -12487
+  { teju_literal4(0xee2767b7210c4ea6, 0x74048e8b4b07efe3, 0xa34d237663eff5aa, 0x31ea2122f3966c64), teju_literal4(0xb77c2e157640a2eb, 0x24680e117e1682aa, 0xa02550df09c2ee68, 0x3ad25ec158ac4e7b) }, // -12551
+  { teju_literal4(0xb419b13205638198, 0x43a8a4608e6b1d38, 0x46d6d40d09acfeb4, 0xcfb1fbdfc00cf9a6), teju_literal4(0x8b62338ef103ae17, 0x1bdc6a70f5ae6c7d, 0xb1f5f9aaca6d82ab, 0x377a7400ad75f8cb) }, // -12615
+  { teju_literal4(0x0347f1714e2293e2, 0x649803ace38788db, 0x3da7569e1494b400, 0x4d68a9818ea7aa6e), teju_literal4(0xd3c3a44758594e64, 0x47e3d0cb99bc4d55, 0xcc695bfa02afdc99, 0x8960e3f8985fcf87) }, // -12679
+  { teju_literal4(0x0ca1a208813a3237, 0x046209be102fe46f, 0x376889a9a4e22054, 0xfbdba51140c52bb8), teju_literal4(0xa0dda014f9af3925, 0xe6b1609d1ff0281a, 0xb0c85060e3888fba, 0x03a6419f3511dcc1) }, // -12743
+  { teju_literal4(0x9633d392c429ef22, 0x686a902bbda765ab, 0x7b4ef65daccaf23f, 0x7c3fcfaf70d040ff), teju_literal4(0xf466ddb88ac0844f, 0xef09caeadd469037, 0xe55229380054fcd9, 0xd65664a053812df3) }, // -12807
+  { teju_literal4(0x3ed0467f8944df46, 0x43cf8d740c1089f2, 0xa17b2f5b8b98d474, 0x52209f91bfd31986), teju_literal4(0xb9a8a21ce20e363d, 0xdb51d65fa2865c64, 0xf3c11703492b1db3, 0x6357b0edac96dcba) }, // -12871
+  { teju_literal4(0x43c274a7a58583e7, 0x4832a349db39b972, 0x6c3151e4167d4923, 0x043d86e158fd5610), teju_literal4(0x8d08e896f7160734, 0x54d4aee1e81d39f0, 0x1ca5a115f2f1caa5, 0x78720e41c11efa8f) }, // -12935
+  { teju_literal4(0x9b1687d03c570a34, 0x63f3a643d53b26a4, 0x727add9ff0466909, 0xc655eb044a29f905), teju_literal4(0xd645db588d4ac919, 0xb7b80b2c83f990ad, 0xfd446fe649a18e54, 0x36cd0c3f9e12dd17) }, // -12999
+  { teju_literal4(0xfea63a9e6758aef8, 0x73c9733710755387, 0xdf459a4c6b11e704, 0xc26646ded2b06d88), teju_literal4(0xa2c57b28522d906d, 0x72804ddcc3bf3457, 0xc21f9480ee0926f8, 0x8d092ec5efece97b) }, // -13063
+  { teju_literal4(0xa4dc54d51624a3ac, 0x8eeca51082de7c44, 0x44f43bce1e76ba78, 0xbd83bf4f1bd2e1b5), teju_literal4(0xf74c0f96801b9561, 0xf39f9291db79ebf6, 0x70e7d3f78ba5f79d, 0x1b6860b0a29e7b20) }, // -13127
+  { teju_literal4(0xd9700a7bd20678b9, 0x809e43421fb73301, 0x31c459d5576a2e82, 0xa659884b64053531), teju_literal4(0xbbdbadb10d51fac0, 0xf2ddf1e478acf0cd, 0x731d9d079f0ee777, 0xb100aa6a9eb915ad) }, // -13191
+  { teju_literal4(0x103e6f7bf696d7f2, 0x6a63401d79082664, 0x0554bc67d51d2b7e, 0xfe029fe647258496), teju_literal4(0x8eb49f8f7e7b899f, 0x37a69d3e3ffdb11b, 0xef9d9815da6161ce, 0xf55abeed18aad5c1) }, // -13255
+  { teju_literal4(0xad4af1b63fb8ea7a, 0xd45d5f94fb46bc5b, 0xb364a3f12f79da94, 0x0db32f8db32a3cba), teju_literal4(0xd8cfae0d5114e8d8, 0x46a817ad7d6e65c1, 0x1937db12beacb54f, 0x6c9353c926403e79) }, // -13319
+  { teju_literal4(0xb53bc7bf8825bb96, 0x2e5632286e3fd9f1, 0x127cec0eb043c326, 0x9168f0ecc6bea046), teju_literal4(0xa4b31dbf7fa2d476, 0xf5b8b933f311bbff, 0xd0491b746bea93e4, 0x4cb14d8d2a3c1c1f) }, // -13383
+  { teju_literal4(0x16d6fd969a8da36a, 0x2996abd405f26028, 0x1ddf741cbd6c11df, 0x48b480160a4d3073), teju_literal4(0xfa3a0944b97dd063, 0xfd093b7dace1a38b, 0xad901d064d3439df, 0x9efd945d211ebd59) }, // -13447
+  { teju_literal4(0x8c667bee6cd4892b, 0xe3e5ffcf25ecd69e, 0xf20459371d3a81a0, 0x1fbca1f47cc011e9), teju_literal4(0xbe1564cfc87f092f, 0x98bf6dd3e8a0c7a2, 0xa7134fdb64b4df9b, 0xf4cc171d088a05f5) }, // -13511
+  { teju_literal4(0xdcde6406bd9ed2f8, 0x83a1876769979de9, 0x6bd8260de64c4ae2, 0xbcc28ba530dc2857), teju_literal4(0x906567a84096a7a1, 0x9f6778292d77760b, 0xb607acbb0223c5ac, 0x05da74343578e88b) }, // -13575
+  { teju_literal4(0xf10ee057335c8202, 0xb40746120743ac10, 0xc318dc497639808a, 0x78c6e96316606209), teju_literal4(0xdb6133783925059a, 0x521bc259a1225678, 0xfd0211b19e6d055a, 0x7cd1c3ccc08e10b1) }, // -13639
+  { teju_literal4(0x1d8e745c15335779, 0x6b580b758cd6ce05, 0xfd23dfce8d502773, 0xf47d9efd3639fbf7), teju_literal4(0xa6a699616ad3d8a2, 0x7c3c7e804efb4272, 0x80abf73e12086012, 0x2097216694ba9c2c) }, // -13703
+  { teju_literal4(0xe274822dd64d9178, 0x1b8ef29ba1ce6962, 0x8e4d6980c11e77b8, 0xea7ade29d1e6aae4), teju_literal4(0xfd30e56422748c91, 0x6582be670d3eca0e, 0xf81788c9cd0518f5, 0xed52071bd5beb417) }, // -13767
+  { teju_literal4(0xa5f7a3c8e3f6d4b5, 0xf59264c9586b5a27, 0x8a5db5f3cdc0327b, 0x8874ec1d569b1160), teju_literal4(0xc055dbb384c616ea, 0xd822e0c170f63a8a, 0x81723a42c838d34f, 0x2acd8d0da9ecc51c) }, // -13831
+  { teju_literal4(0x85512367ac14bf3d, 0xecdcd8e86bd3c84f, 0x528e87d101e5b39f, 0xbbec656e9184f4dd), teju_literal4(0x921b503f050c4619, 0xe816898c8ae9a95b, 0x71eb78d42f88a3a9, 0x63899a247b768927) }, // -13895
+  { teju_literal4(0xad8887fe0816f4b2, 0x7ad4a96b8cd3984a, 0x53e4121c2232b8d5, 0x4551389446babafc), teju_literal4(0xddfa82f1d3bdcd62, 0xfadb2c851148ea14, 0x552b3664de9cd2d4, 0xda58ff90ed321a21) }, // -13959
+  { teju_literal4(0x285bf52717107584, 0x132f156d2da4eb29, 0xde40214e478eabe4, 0x482f6b91a82842c2), teju_literal4(0xa89fffca23ec4cde, 0xbff6f66770a7609d, 0x58f21c5e76fcedae, 0xf84173a8a4c79075) }, // -14023
+  { teju_literal4(0x3947c3071912ceb0, 0xa4bf22f75c9555f6, 0xb746147fee0d7988, 0x132485026ff81357), teju_literal4(0x80185f7334137b11, 0x14cff079ba07960b, 0xf2e8e6fe59687de2, 0x040b4e3c111c9bd5) }, // -14087
+  { teju_literal4(0x6e59c21f261e2ff1, 0x724c11ee880d0218, 0x0bce6e5102431a15, 0xb78d318ec2ea9ec8), teju_literal4(0xc29d26d40bf30ba0, 0x8da93ebfcf31e889, 0xc2605e0a96c1f0f0, 0xfe89f4029986c6ac) }, // -14151
+  { teju_literal4(0xcfe8ee88759539af, 0x0574a7cb7bd308de, 0xfb3ccb3f54aafed0, 0x88b15528e3aba5f2), teju_literal4(0x93d668e02d6fee3a, 0x94cd552360ae3d97, 0xed8cdff58c9263e6, 0xaa338f2017483620) }, // -14215
+  { teju_literal4(0x160e44b4fb505eaa, 0x57c342f1c400f840, 0x3cfc8462f9304f23, 0x6bf42bd1f0fea5bf), teju_literal4(0xe09bb4197c2b5337, 0xb40011c2fce74b28, 0x7a1dabb5dd1d9308, 0xddcdb5ad88ac18fb) }, // -14279
+  { teju_literal4(0x15917fe69e511516, 0x34f6d7523cf1ac15, 0xdace60e3fd246741, 0xcc502b82df576ee7), teju_literal4(0xaa9f62eb83b1c358, 0xf0df4677dba877cb, 0x94499b620aa6eb18, 0xdaaf4cec27f96009) }, // -14343
+  { teju_literal4(0x5fc6dceb4feb7792, 0xf8fa3a30c3844fed, 0x4dbeb51bec0dadea, 0x09678843f9343406), teju_literal4(0x819cd887771f5513, 0x1a6f18fa6e75f3b2, 0x02cdb2c24e434274, 0xd0e3137c6d705029) }, // -14407
+  { teju_literal4(0x75f9b9b6b9019d1d, 0x447b4b5a73dd516a, 0xef00a08704ed3b95, 0xe177d63ae52e8cb1), teju_literal4(0xc4eb5ae73a78325f, 0x9c28b9b66302d303, 0xe200467f57248df7, 0xfc9daed9e845bf8d) }, // -14471
+  { teju_literal4(0x220ba0a98e92339f, 0xe8814b80972e6cf6, 0xcb3f905c1a0fbd84, 0xd4835ad14be5d6b5), teju_literal4(0x9596c147429794b7, 0xc33cfc3831a84732, 0xb82c74f5bd427bf7, 0xe047fdc570f1cb44) }, // -14535
+  { teju_literal4(0xef9f7ad789a37b7a, 0xe07be4d249ef2282, 0x26f101a9c2142a6d, 0x413862aecbed61d0), teju_literal4(0xe344ded6317aaa17, 0xdf12df00884e4b33, 0xb35ce82bd726aca2, 0x747ab2756d4547d8) }, // -14599
+  { teju_literal4(0x3dc6103c7344e7d3, 0x84ee972b3a3d5a1d, 0xe89490bfc5262da8, 0xa9e2d80ab16a3e15), teju_literal4(0xaca4d4edce9f943b, 0x4a05d4921bc54495, 0xc908633aa59e22e1, 0x33a1474515e3876f) }, // -14663
+  { teju_literal4(0x5cb363fd3f6ba39a, 0xc1da82649557068d, 0xd12d6350cfd2e105, 0x028548acfeebaab4), teju_literal4(0x8325ebb9e35b86db, 0x65a1af91b799986a, 0xd097fb6f5e1faa2d, 0xb0a15ef58320511f) }, // -14727
+  { teju_literal4(0xf41a1d1e8c805bc2, 0x291ebc9c72e5943a, 0xec6e1a6ff3ba4fe8, 0xa5f4aa890bc98c2a), teju_literal4(0xc7408ce1bbada125, 0xfb2fa371eee423c1, 0x87d6cd3cd60d292e, 0x4aad1e80b4a4b250) }, // -14791
+  { teju_literal4(0xc1841f7e400e3fbc, 0x29d276cb419c8f04, 0x0a9ece548cc26252, 0xb04135273471e6f1), teju_literal4(0x975c695f839bfafb, 0x74fecfacc8b05eb6, 0x8add5752e65d5a8b, 0x2b18a29d4560be5b) }, // -14855
+  { teju_literal4(0x041bc61767b1fa96, 0x3ae001fd66b011e1, 0x5dae498ec5480400, 0xd2c040895f6e732f), teju_literal4(0xe5f61b576fbcab9f, 0xefba639af04114bd, 0x472710f48b485d8c, 0x4c08663000b0e0d1) }, // -14919
+  { teju_literal4(0xd08667bd31140338, 0xd20ee124799e2701, 0x08171539880d4e1f, 0x627eaee013c29eea), teju_literal4(0xaeb0683059f16a0f, 0xb24a49bf64e8df79, 0x2de5e63c6e2ca86e, 0xc37e1b9f62ca4526) }, // -14983
+  { teju_literal4(0x04441a13b9d54061, 0x569ae07f88cec9f8, 0x322d1d77c55d6888, 0x2c1847942e321194), teju_literal4(0x84b3a6ff564e167b, 0xcca13888a8dfb30e, 0xe3bebec2cf131d1b, 0xb1eaf9f1f75f00a7) }, // -15047
+  { teju_literal4(0x5cf0272408aa5eae, 0x4b2ce6c446261d23, 0xd7f3eb049d47697a, 0xa129c8a3d6e0b630), teju_literal4(0xc99cd1f7c84b85fd, 0xa58dd4a2c5156c7c, 0x4b9ee689d2bb36ca, 0x988555db31825ae8) }, // -15111
+  { teju_literal4(0x911a55bbd5b8baf1, 0x1c3e862587f72b79, 0xb0c3ec901d11c3fd, 0x1e16fe072842a74f), teju_literal4(0x99277144768abe31, 0x80751267e96abcee, 0xfb2762aa14f52fcb, 0x4c8cec8583c6c0f7) }, // -15175
+  { teju_literal4(0xffc1b10551b84a87, 0x6024fc3a6eb5fa8e, 0x55908109bc8342b1, 0x1be981319aa44f22), teju_literal4(0xe8af82160bdba124, 0x66613a6ff7c09967, 0x891e41983232727d, 0xb18d19829b336a7c) }, // -15239
+  { teju_literal4(0xb758701c9841a3d5, 0x270a576f659023de, 0x3144aa3161c1360e, 0x02408f9365090f26), teju_literal4(0xb0c22f4a32a252eb, 0xde060ade0c016648, 0x72691bce217ab26b, 0x8276f5c7ad8b6ce9) }, // -15303
+  { teju_literal4(0x3b07c983b62bdbfa, 0xf88cf262cabaf4da, 0xd4712e3101a1525a, 0xbfbecf42b41859cb), teju_literal4(0x8646187700e10488, 0x00c0a1c82f52cc79, 0x6edafa29388cbad3, 0xaab4e9168cb1e10e) }, // -15367
+  { teju_literal4(0x1e8f1ebc7c9d9179, 0x24c41bc23f405297, 0xf893e56a58dca80a, 0xbbccd28794cb9c92), teju_literal4(0xcc003f9de7261d02, 0x9c5e9667f3b6be6f, 0x0b0432831243e6a1, 0xebad6e42e03089e1) }, // -15431
+  { teju_literal4(0x202f661a7eb68099, 0xaed7964d9acaf08e, 0xa3e96028eedb42c3, 0xde8a78d8b16c2316), teju_literal4(0x9af7e9427acf3761, 0xeae55ab1a997bd5e, 0x7fcda2c2f094cffc, 0x5e94e8c5060e53eb) }, // -15495
+  { teju_literal4(0x7a4b8e0134bbba85, 0x0e17b32e192dcc67, 0x8220a99c64411e09, 0x75f6f770e35b3383), teju_literal4(0xeb712bd5120b9d75, 0xe42ae1e5c15eb135, 0x9cb1b1162e075e31, 0x7c4e026f0039fa81) }, // -15559
+  { teju_literal4(0x67afb851305511b3, 0xc850044b00ca2a73, 0x082e0b63426bad50, 0x39fe896ea6e3056d), teju_literal4(0xb2da3d0ac6664451, 0xe143fe48241169cf, 0xd71ca23270d05a8d, 0xef6bf2b5704d93de) }, // -15623
+  { teju_literal4(0x38a0085bb770d50b, 0x9d797dce6632eb2b, 0x20a53c7005dcd06d, 0x4a6fef34a4b69118), teju_literal4(0x87dd4e6ae7beaba2, 0x9d7777c14d051bf2, 0xfa9d6e5742c41cb8, 0x3a5ca1aa9cb8623a) }, // -15687
+  { teju_literal4(0x393020b904beb2fc, 0x4a97c3136318cd91, 0x69e4194077d64a7a, 0x5d568ec14420060e), teju_literal4(0xce6aeb89b032272e, 0xda6ea4235065caf0, 0x27f7e4516bb6dc77, 0x1d840f1118f53e4e) }, // -15751
+  { teju_literal4(0xa5c32a49666d84f7, 0x8c34985362a14b78, 0xcdc30b9cb85cc4ba, 0xd77de41cc2168a93), teju_literal4(0x9ccde1d75d575f65, 0x100e2c114bf7f653, 0x47ef11081a131009, 0x4c1c7fefc51eeb0c) }, // -15815
+  { teju_literal4(0xa7f89043f2075710, 0x264e2170b0ab7a3b, 0xbd0f6b69ad5d5229, 0x04a5e38941034567), teju_literal4(0xee3b31a2a6dd6d2b, 0x80288b13cc995ac3, 0x82c5d4d3827d1db1, 0xbf7e1eebe4351b52) }, // -15879
+  { teju_literal4(0xbd5680db822f1448, 0x6798cad3622f3bcd, 0xddf02407bb1944f7, 0xa6cc28358582f5bb), teju_literal4(0xb4f8a47a8ea411ab, 0x8192756d73803db4, 0x2e4f5f12d7b7f8b5, 0x193d8b968a077f97) }, // -15943
+  { teju_literal4(0x44670a5bd38a97e3, 0xc7166098e2bd01b9, 0xbadddb04a70c4a58, 0x123cdb6eab7deed4), teju_literal4(0x8979575065336757, 0xd72b36fba9df5d15, 0x372fbd08a4b6d310, 0x515e97f892af624b) }, // -16007
+  { teju_literal4(0x4a13618bc8b0441b, 0xfe3de238a9e99bb1, 0x1ef67e760dce52f1, 0xfb26c2b92c35b508), teju_literal4(0xd0dcebb291d8ce89, 0xeed5857af3532a7b, 0x707912f1dbc79872, 0xff7c32714e79b113) }, // -16071
+  { teju_literal4(0xa717a201c3356518, 0xa185b5d43d24a407, 0xd7d9540000f044ab, 0xff5d3fd1eae7fc03), teju_literal4(0x9ea96bb2ee79f940, 0xde5c1a69e8f89570, 0x349cc36794cc1cf3, 0xec376ef649d93264) }, // -16135
+  { teju_literal4(0x2dc7734364278fe9, 0xe7e86d6bb69b15c6, 0x9d519f0352b069ad, 0xacfae203bff23042), teju_literal4(0xf10dacd8eafc1b44, 0x351c888afcfdc28d, 0xf0ef15acf75707df, 0xe4039a235853a6ef) }, // -16199
+  { teju_literal4(0xac8ff0e2a5145814, 0xab8df279c51a17dc, 0x4c742f6dfc838790, 0x3485e196fadc5670), teju_literal4(0xb71d78dbbd75e778, 0x7e899a7b9002d538, 0x16ae8c6d5decac02, 0xd16a506413ff11e3) }, // -16263
+  { teju_literal4(0x1a9ced32f3cff985, 0x15fa626cfb9e8468, 0xe0213d32f6a8fdda, 0x1bb342cf19a9d897), teju_literal4(0x8b1a41c8ac991ed5, 0x5cc4b402742f81de, 0x90e157e0b7ac1091, 0xe17d0855e400b6f3) }, // -16327
+  { teju_literal4(0xfeaad9a4eda17dd1, 0xa14310ab0e4ef3c7, 0xdc66c99170345dc8, 0xebe8052aadc73f04), teju_literal4(0xd356565298a1f959, 0xc0d292fd900e80dc, 0x64641a9b59b04018, 0x4f325f8c90ca7660) }, // -16391
+  { teju_literal4(0x591d8cfe32ea242f, 0x05ceaedb8dea3c55, 0x2bdc5599a1b77453, 0xac8a36d687f4d4fd), teju_literal4(0xa08a97b799a35572, 0x215c556e5e2f81af, 0x0b2ed11f59618f2c, 0x3ad17e1918c8c23d) }, // -16455
+  { teju_literal4(0xcd431cfbf5684077, 0xbcd0682d06161c31, 0x7be640bf28837ac3, 0x92e83c04b2c2c1d8), teju_literal4(0xf3e8b71ee19d202c, 0x91f91108ce7cf134, 0x19329a08a20e62da, 0x75598330710d9d9a) }, // -16519
+  { teju_literal4(0x8ce8d2bac29bba7e, 0xb44c305598301a54, 0xeae1bdd7427f795f, 0xdd4ec9f1b3f87152), teju_literal4(0xb948cdaaecb66fb1, 0x1e29fe0cfee91379, 0x65c5273b737fde2e, 0x66308dff4adaab28) }, // -16583
+  { teju_literal4(0x73d50bfb2106b082, 0xd06ce5a47d241a01, 0xe275d6ed36d27024, 0x283d68ea5a8b3543), teju_literal4(0x8cc01ca14f515e0b, 0x4554f321e5ebdeff, 0x9088822e72176f93, 0x4a93ab9b126e131d) }, // -16647
+  { teju_literal4(0x140141f11acea110, 0xb2e537efd57f6351, 0x6bbeb3b7806e4d6e, 0x61070af246353925), teju_literal4(0xd5d741e7393c2331, 0x7953ddd385ff7f9f, 0x2cabd958973b1f2c, 0xaf56dadc67953764) }, // -16711
+  { teju_literal4(0x091c4a77bd741f13, 0xec25d834a61cb59f, 0xd3f94855337f365e, 0x0c7faf0e65236c3f), teju_literal4(0xa27176fafece10c8, 0xe719c031c241aba9, 0x91dbf60df7f04e42, 0x77cd36607c71400b) }, // -16775
+  { teju_literal4(0x3324c7c82511cdb1, 0x7c1dfb570413669f, 0x528a7ece4fce2d7d, 0x87f8cf4dd84c968a), teju_literal4(0xf6cc6a6959ab69bb, 0xa9ee1e3ab4f2ddb0, 0x604d05b1e47c4eaf, 0x10d18a30ea7b4130) }, // -16839
+  { teju_literal4(0x6ff833ea2671f2dc, 0x483215ac551afeae, 0x72ffa97b127f542f, 0x850b878d6d3e9b2c), teju_literal4(0xbb7ab69fcf20d67f, 0x3593876058f920e7, 0x977c847241ca54a0, 0x7a42e4dabaa06d0e) }, // -16903
+  { teju_literal4(0xd34dc0d656947c17, 0xb68e4b2df9f64267, 0xd060a19af785b83a, 0xba9ab59c23ea3d1a), teju_literal4(0x8e6af6d4c352b5e8, 0x931e3209b9017fa3, 0x7cdfa76fc4715209, 0x5d909b649b7163c2) }, // -16967
+  { teju_literal4(0xa94efbae06dcce58, 0x997ef7abedf98961, 0x87d25c47bbf83e03, 0xa9f792831bb4c560), teju_literal4(0xd85fc5321ce8e83b, 0x792232cabb4a82c1, 0x478762987b2ac43a, 0xae5fd6ac2b07c383) }, // -17031
+  { teju_literal4(0x2d9e797f4a585d17, 0x9f34bccff925e782, 0xabfd3e9632f86dcc, 0x3178496c6f57c36f), teju_literal4(0xa45e1ac68dcd41d4, 0x136d4cba4b663f9b, 0x1ca73e391fd6c1bb, 0xb49952fa250f66fc) }, // -17095
+  { teju_literal4(0x2649ecfd7a57815a, 0xad0504d9627f982d, 0xab4910d2d0918100, 0x529678f8839aaa13), teju_literal4(0xf9b8e0fbd9b5838a, 0x7230fabebebb9883, 0x2de9947c08cb14a9, 0x52d711ea2bf757de) }, // -17159
+  { teju_literal4(0xdf665512311aa4cb, 0x41f1bf9bf45e2c1d, 0x14d3dfb0dcbb3306, 0x1aea921756543a97), teju_literal4(0xbdb347ade389f949, 0x50985246d6654b3d, 0xc43db8d9b04616fc, 0xfe97f27d86ddde6b) }, // -17223
+  { teju_literal4(0x854c9c27a1ee7b7f, 0x2d2c3a8d0d0f0284, 0xbfedf961561d09a5, 0xc824c633e2b9ba49), teju_literal4(0x901adf8aeb4e2ab7, 0x6fe3dab28b045511, 0xf2f772045039574a, 0xa7dd1fadc51ce2e0) }, // -17287
+  { teju_literal4(0x38d46684751c1d5c, 0x5875c5cdac51b3ae, 0x75a307ec05663682, 0xfdad714d3fb27e65), teju_literal4(0xdaeff739f05584dc, 0x60ed887b54b85bc8, 0xb1ee30b403a2b3c6, 0x7db4635a0b52a990) }, // -17351
+  { teju_literal4(0x6d6d2f97a7fd9e4e, 0x5cfc3b31e9824d37, 0x63bd463c9fb2fe98, 0x7b4b5dc8ab01474b), teju_literal4(0xa6509498236d985e, 0xc265bfc2d8af9290, 0x11909d83bc9d2bfe, 0x1d8c88e1fe02721e) }, // -17415
+  { teju_literal4(0xf09aac67cce458bc, 0x4181067291f01e7f, 0x538e91529c225c9c, 0x251b4dc361ee3919), teju_literal4(0xfcae35698ea74024, 0x2d39008d1e246b50, 0xd72d9e3cb33f55d7, 0x6516dcebd837c29b) }, // -17479
+  { teju_literal4(0xacb28047bf329cd0, 0xa6e186dbd2a0c06b, 0x32f79b2b8baa0e1b, 0x1e33fcdcdd910a44), teju_literal4(0xbff295052a391d1e, 0x2eadaaeebf9aa735, 0xfeef7d7877d4f90c, 0xfe764f294fe3dca3) }, // -17543
+  { teju_literal4(0x8d20b1d1b1f56b31, 0x29f2de339b34eceb, 0x09ebf5aff564cda7, 0x6679fb088fbdfc72), teju_literal4(0x91cfe619a071861a, 0x4d95328a4345eea3, 0x4001e6d2059189e3, 0x5cd9a02e9c10e1cf) }, // -17607
+  { teju_literal4(0x3563f16a46fb678e, 0x5598336df9670ede, 0xfd22b78b813ccef8, 0x6b7d54a19de615d7), teju_literal4(0xdd87ef4b34e6a1d0, 0x481cfc359155ca89, 0xc665d83227cc95bd, 0x3d86c9ee7aa0ba0d) }, // -17671
+  { teju_literal4(0xc3633ba781144722, 0xc7ce046818f6ef91, 0x532ae4283aa7de2a, 0x128514cb8ccfface), teju_literal4(0xa848f622a873033a, 0xc6fc02de3437644c, 0x29e23e95cc5d7fcc, 0x0658bd1c6baef481) }, // -17735
+  { teju_literal4(0xcfaea9fb64ef2af4, 0x41ec2c61ba638f7e, 0x4e098f8862365b35, 0x1021d33acb842e75), teju_literal4(0xffac82963d575cf6, 0x192e8463dff1a494, 0x47f6949092eb72a9, 0xd29d04907d47888a) }, // -17799
+  { teju_literal4(0xddae6e038c011f6f, 0x6d68e7ee68c234cd, 0x7349058d660a5c3a, 0xd880e0c18a750ded), teju_literal4(0xc238b312dc669cdb, 0x3713aaffee3a5aa3, 0x368baf8fe4f5c71e, 0x39ae11ea8517e55f) }, // -17863
+  { teju_literal4(0xf16725a479ec3e51, 0x243be14f024b25f5, 0xf535ba5a4b747e7a, 0xc1c8e315e3b89e13), teju_literal4(0x938a1a053dcb70d4, 0x0dec299958eb35b1, 0xe760ab36dc146186, 0xe56351abd1d13a7b) }, // -17927
+  { teju_literal4(0xfeabafbfeb15781a, 0x22e0ecadc5f696c7, 0xf60ad190262bf9ed, 0x633b9e18c2c2f65b), teju_literal4(0xe027c4f9147edb29, 0x1869638403239b05, 0xbdaaa6e13fe76162, 0x240edf42450052fb) }, // -17991
+  { teju_literal4(0xe529e5deadbe9087, 0x619bc76f7cc33f2a, 0xa46af650143f453f, 0xbcb3f22a4aa86978), teju_literal4(0xaa47514eb278817e, 0xf54d0ad174b45713, 0xcdd0461654013bef, 0xcef4b9ef71cead75) }, // -18055
+  { teju_literal4(0x1e3e54e432fb4e75, 0x52f09c9f143e90b3, 0xd95bb6df30ce8961, 0x9a300933592a06dd), teju_literal4(0x8159f1db9b78da4c, 0x9c52bb967ac9de04, 0x87a449354edc9437, 0x8365276056b1d368) }, // -18119
+  { teju_literal4(0x4cefdc387dda10ed, 0x11b12ea025756475, 0x35e4e0234175751b, 0x7a449fc006f728e7), teju_literal4(0xc485b68225e712ef, 0x78240efe3b00971b, 0xffd1300341362137, 0x0598cb9db1367046) }, // -18183
+  { teju_literal4(0x609724b6457c9b72, 0x4f9c34c4ec381ad8, 0x0756943e14cdd1d4, 0x76d03130c20abe1c), teju_literal4(0x95498b012d56475a, 0xc0b463b06f33dab7, 0xebc07d9df4713c17, 0xdd4c409ff65e707d) }, // -18247
+  { teju_literal4(0xf9fd9b92911b60b0, 0x39e28e5eac36ebb0, 0x031f7188313b5c17, 0x0bc4da0a4e5ad3d6), teju_literal4(0xe2cf901e37c7871e, 0x695c81482276f7ee, 0xaa790c84425d2a85, 0x39c68e41164c7ebc) }, // -18311
+  { teju_literal4(0x44e742d8dab429d3, 0x99798c8f8ac9f58e, 0xfde239bba5fe102a, 0x91871531ef940ded), teju_literal4(0xac4bb83b26b7d57e, 0x99534cd6054a4c37, 0xb2764c8e1d9cbab1, 0x90ed31f13bf40a17) }, // -18375
+  { teju_literal4(0xabb189feb7ec802d, 0xf4b1983cd939008e, 0x74a231f1bc0149be, 0x83faca8f84a4a0ee), teju_literal4(0x82e23a2a28235689, 0xd18dd98eb5b947d0, 0x4c2cb547f8445bdb, 0x7272e325030acd76) }, // -18439
+  { teju_literal4(0x3b323405087f9392, 0xf28616722ae9c852, 0x3745bb948be424ec, 0x1a3b2dab9bc8893f), teju_literal4(0xc6d9b43ce109965e, 0xf010ba8742285c4d, 0x97153772e8262c11, 0xed4ce42fdeb2e054) }, // -18503
+  { teju_literal4(0xc6d23871dc5b399f, 0x51c91409e50092e8, 0x288f28d7b1824e00, 0x24f401dbe4b74c7e), teju_literal4(0x970e48f076aeab36, 0xf1f33f9424c43a5d, 0x14a40665cc58f943, 0x7becb5bc8ef8832d) }, // -18567
+  { teju_literal4(0x35fbf28e2a4a4969, 0x3262e099539eed93, 0xec141ba9ba9cd1e9, 0x47874b2e101b0c3d), teju_literal4(0xe57f68dd9f03586c, 0xf4aa2e452bad179d, 0xdf8d29a4c907b8d0, 0xb28265f90b326aa6) }, // -18631
+  { teju_literal4(0x54913880d5d38eac, 0x562b55d979189c75, 0x23e0ee316ebadc02, 0x9c13bf38d7f2cecc), teju_literal4(0xae563d3ddebee112, 0x183464c86c0c3a60, 0x46a3c820e74dcf8b, 0x0d444656605ac7f9) }, // -18695
+  { teju_literal4(0x9c7a2b7b2b6d4cd8, 0x174467839efc2fdf, 0x40e159fb058f4dd1, 0x25a05878c7447285), teju_literal4(0x846f28246e045500, 0x213f4f57364f81cd, 0x6de778d5e182f0f5, 0x6b9c4c5238d1b5f4) }, // -18759
+  { teju_literal4(0x761b3521bea12e3d, 0x3538118d7f4e2186, 0x3a83627bdfcf8914, 0x37dfc44258bce51e), teju_literal4(0xc934c16c54afb6a7, 0xf38a6138e33b0f00, 0xbeed79f61fea3667, 0x9cc540f9b69893fd) }, // -18823
+  { teju_literal4(0xe6f7c1760232d9db, 0x81010be311513fbb, 0xd72f8c3d30b6acb3, 0x533835d3c4f7df31), teju_literal4(0x98d863e64f7ae261, 0x6f85f22374abc691, 0xdbefda2189c30ee5, 0x078719319680adf0) }, // -18887
+  { teju_literal4(0x6eefb99c8b16428f, 0x2d3a6dbbd815b6e5, 0x5fb25a6d51417d93, 0x372d4a5e7013b689), teju_literal4(0xe83767a37d728f16, 0xa2428b366683f70b, 0x7633f8bef4e72cd2, 0xea5f05071a9726cc) }, // -18951
+  { teju_literal4(0x332d12c684b27422, 0x4eb1cda4cde2a54b, 0xf4b0e4068fe5cfb6, 0x13352b675b14790e), teju_literal4(0xb066f2e44f18844f, 0xe020716ab918594d, 0x4f1f61e994a284ed, 0xef5ff711053af817) }, // -19015
+  { teju_literal4(0x26f6935741d5e97d, 0x62824cf377be9e76, 0x8be8f2417d601998, 0xdfdb1b4f49a359df), teju_literal4(0x8600c9e254003296, 0x95b697b74c912a15, 0x5b28253fc168c5a1, 0x0a717104a1bbf967) }, // -19079
+  { teju_literal4(0xb3c280b894189b3e, 0x7d041041d30384c7, 0x23b15134cb3833d0, 0x84dca7683c0bfbfd), teju_literal4(0xcb96f379f4a5f667, 0x3e88e4389bd0518d, 0x748831ec7bce2854, 0x16893cce76ac7127) }, // -19143
+  { teju_literal4(0x622fdc549ea0c044, 0xc7bb438aafeb8da2, 0x4c3c5dc06ae10506, 0x275b5f652bef22da), teju_literal4(0x9aa7ec26ad88252f, 0x6b0a39035b3d2628, 0x726d00cb1017d1b3, 0x96882add162e03c5) }, // -19207
+  { teju_literal4(0xd6cced06d40ba16e, 0x91ddd862dcb70c44, 0x1a1fa22ad6619e98, 0xa3a54c7648c61833), teju_literal4(0xeaf7a526175081ad, 0x0aaf85b6596e7c34, 0xa34f3c8bee1ea4c4, 0xcfe6ec79be038f4f) }, // -19271
+  { teju_literal4(0x59a82e5e082b584e, 0x2b84e0d67cb25314, 0x7031e1e9be0640ef, 0xbc8ad6e446f51214), teju_literal4(0xb27debf42feee991, 0x18c9d76912625e86, 0xcca2b9bfebb35b33, 0xf36f04e2489cf0a6) }, // -19335
+  { teju_literal4(0x7113cc12758a746d, 0x0fa91fbacba91156, 0x0b033425426ace54, 0x839c7b6d1d1d1a1e), teju_literal4(0x87972da67ea09599, 0x6488207c89be64da, 0x1d23f2dac51bf61c, 0xd022d34ccde4e0f1) }, // -19399
+  { teju_literal4(0x553775b398de05ba, 0x6d190439e1c4c9bc, 0xbc834b2fb1a41fbc, 0x8e61501417ab17b7), teju_literal4(0xce0060102443990f, 0x4ca1407d11444664, 0x5a6c458df0892397, 0xc6bd8da3db2f2394) }, // -19463
+  { teju_literal4(0x55a8a3e16b164db5, 0x28ca0ef1697c4e7b, 0xc6e5eff21c099f63, 0x5451819a041bd2f9), teju_literal4(0x9c7cf226daa30ae9, 0x74b6ca6b9006c921, 0x4f663cef8a9a58bb, 0xf304e6425e0b5326) }, // -19527
+  { teju_literal4(0x332d3dad4a8a4c64, 0x708a3eb54cd3c150, 0x75a7f967a34a5e79, 0x632dd090298b2b85), teju_literal4(0xedc03a66a27260ef, 0xfc038c7cbaeaccf6, 0xf63b3707d305e3ac, 0xe47cd228e6bb7967) }, // -19591
+  { teju_literal4(0x779331cf238ce692, 0xc5c39519d338497b, 0xe12d492928ec3628, 0x3e7b8ea7beb1de02), teju_literal4(0xb49b3b6c27ad3b8f, 0x9ddac7bf115aebc3, 0x3ea2b7b6eae58ee9, 0x66af5ca1d98812c8) }, // -19655
+  { teju_literal4(0x9daddaabe1f57ac7, 0x0dad9213909e450e, 0x7ba942fdd754ffbc, 0xda8b424448429aa5), teju_literal4(0x893261ded1b30a64, 0xec13cda8537347fe, 0x23453bd66f178ad7, 0xbf75d11b0d08e7a6) }, // -19719
+  { teju_literal4(0xe7cfc7a7f8c52d7d, 0x6ad69dc189ebdcd6, 0xc1bf2483ec901b87, 0xab6b32a3a42551a0), teju_literal4(0xd0711d1afb58acbd, 0xbb062234ed251a42, 0x692e286467e6e091, 0xec93cfb878ff99da) }, // -19783
+  { teju_literal4(0x0f1d117beccea6a0, 0xcaa8104aaa460fa9, 0xe45f0195e897547b, 0xd8a4579c6e92c5c8), teju_literal4(0x9e57868e0a3054e5, 0x8b803272786b23b5, 0x31538db6817be6e6, 0xff9d22ff5b7e961d) }, // -19847
+  { teju_literal4(0xfe85153b9dd6825f, 0xa4b7c30e4b55bd56, 0x97805a7b2986f698, 0x7ab0b68301726e1e), teju_literal4(0xf09140b2298f2f70, 0xe00dcacce5f9bae3, 0xeaf6e517ddde8a33, 0x7085ed49c89d975a) }, // -19911
+  { teju_literal4(0x960657357d8f9d47, 0xfe9cea86f82ffa65, 0x687a481b78af051f, 0xb16ab03454ac164f), teju_literal4(0xb6bef48477a6d493, 0x50a02f30c66173fb, 0x52dc49a3b2991d89, 0xc1698e778e02213c) }, // -19975
+  { teju_literal4(0x1bf71bf593fba72f, 0x9b4cb445fcdfc9cc, 0x639e462edcc80578, 0xb90dfd85e21e2077), teju_literal4(0x8ad27524f370b89e, 0x4f904f8b5863f2a9, 0xbc6612de7613a7a0, 0xdb218e66a819db65) }, // -20039
+  { teju_literal4(0x4ba0f8f339c74c11, 0x10dd634c028ff11e, 0x5e562d375962b6bf, 0x34ecd6a1711220a3), teju_literal4(0xd2e940c90d714e2e, 0x6ac24e2cc6f1f4f0, 0xc44756ecd1e79dee, 0x6e99bb8af9bd31a3) }, // -20103
+  { teju_literal4(0x5e6f0879fd91f213, 0x85c2e4d6cad718b4, 0xeac87b9ac3020697, 0xc044bcb644933663), teju_literal4(0xa037ba35f08b67e7, 0xf58795b658f52818, 0x9196a4077a8a2c75, 0x84cf716b9992c175) }, // -20167
+  { teju_literal4(0x73644f607b704fb5, 0x0986ef5cea6684f6, 0x10953538a9f50eab, 0x8b7516871528cf00), teju_literal4(0xf36ad1a27238ff1b, 0xb2f762dcf411ef21, 0x99c4e684ce4172e8, 0x10c15c30c5ccdd73) }, // -20231
+  { teju_literal4(0x0132f2bf5d133ab7, 0x9e868b6a1fcadc0b, 0xba769caf4273eb6c, 0xa59b533938eebd42), teju_literal4(0xb8e92aafaaca0804, 0x637466def3ea3946, 0x0b2c4746709462da, 0x29d2facd4b2e7cd2) }, // -20295
+  { teju_literal4(0xcef8e00a2fa46a14, 0xed8ed4aae89e0f20, 0xf764adc55da8c7ea, 0x408c26bd51157ab8), teju_literal4(0x8c77763ed133d91c, 0xf6bb53a540cebba6, 0xcc62db42c08962e7, 0x58f925e939f408bc) }, // -20359
+  { teju_literal4(0xa445a4ac06f2eee2, 0x39509565e5b032b0, 0xc076637276a35304, 0x37d73c92a01887e5), teju_literal4(0xd568e18c33753a00, 0x9c6bf87bc1698cc6, 0x2b3d400f3484db31, 0x5cccaee5212e0caf) }, // -20423
+  { teju_literal4(0xf0bd81d89eee1f4c, 0x62cb2c9b696138ff, 0xefc2822a6620ac8f, 0x86d9987a3e4706d0), teju_literal4(0xa21d9e2b5c2fd3aa, 0x520edd4c1a620de6, 0x801fcc2429dc9755, 0xe58d567fb4f3e5e8) }, // -20487
+  { teju_literal4(0x51a9f4524845dd6d, 0xc0f2826f268470a8, 0xf3edd3a250c81743, 0x9e653fa8102ec042), teju_literal4(0xf64d071ee58f9eff, 0x63b58b7f7543063a, 0x08a06eca349ae5be, 0x16e4b549f7597da0) }, // -20551
+  { teju_literal4(0xb0395af46e487cd8, 0x2ca385c9b05d1372, 0x2ed36bef5066491d, 0x8ac3fa55c545f56e), teju_literal4(0xbb19f19b4664ba4f, 0x8f48714bb36348db, 0xa78f556d8b189890, 0x714d5d408305763b) }, // -20615
+  { teju_literal4(0x531406db2c5dd73f, 0xd20e731004d4d4dd, 0xb54280cdb7aaf057, 0x913a2879123b05f3), teju_literal4(0x8e21741f25bfa2c7, 0x987bc53b8b0293ca, 0xee24a673057d6f3d, 0x576e8155971b1591) }, // -20679
+  { teju_literal4(0x040e42f2899a4be1, 0x1da058f85b096ef6, 0x5f0fd07f884cc3fb, 0xe6b55c4e83e4da22), teju_literal4(0xd7f0161a57aad3f7, 0x103c665e7da1b900, 0x11c83c59a807775f, 0xc85cc32c21e8ad01) }, // -20743
+  { teju_literal4(0xbc3447da24c80f4a, 0x8370403c31ab4bbc, 0x1da2ef46198deedd, 0xb3c6c397704d0ad5), teju_literal4(0xa40943aed0b358b4, 0xee73ff46ba452908, 0x4d6436b3fb110399, 0xf80ff8adfa26f7e6) }, // -20807
+  { teju_literal4(0x2cccd01ab2906155, 0xa2618faa0ddf6f0d, 0xcee606fa4f3c4ff4, 0x87a8414428cc845c), teju_literal4(0xf937fb5d7bb4fc72, 0xda519026e2bc3a95, 0x7459547816e1f233, 0xd2f428192e5773d3) }, // -20871
+  { teju_literal4(0xd964f2625f2cfc05, 0x22753d886a897cd0, 0x817dc3d8d30a97c6, 0xae683a4e51b20cfa), teju_literal4(0xbd515d307d010dd8, 0xd2fc94be9b089ac8, 0x002ac71b61cf8d22, 0x43f1a7e90023afd6) }, // -20935
+  { teju_literal4(0x835723d7036db55a, 0x37687fcb60a8e095, 0x09d5a665a059b053, 0xedf0c93b45a32426), teju_literal4(0x8fd07de6011f72f1, 0xae463f8bd3066749, 0xdb43c91ea180d67e, 0x9896aa0905e446e2) }, // -20999
+  { teju_literal4(0x58274a8af2d783ee, 0xd2c68836768b98bb, 0xcf2881b1334baa96, 0xa7044d1645c2f92d), teju_literal4(0xda7ef56e4424e292, 0x1926ff19b6e67d46, 0xa674dbb0d87f547b, 0xfcb693f3f0f76782) }, // -21063
+  { teju_literal4(0x2745d3031ca2afd6, 0x6d2832b7064460aa, 0xd20372c1186fd6a3, 0x5e563e9cfc7a8a85), teju_literal4(0xa5fabc352395ed34, 0x6e2a52b27087be01, 0x5afe589f4707fcab, 0x16d44162e1c9cba3) }, // -21127
+  { teju_literal4(0x90331af516660b14, 0xc45b68f1322f90e1, 0xcc2666f6b572948a, 0x8cd1e11b3a5f5a90), teju_literal4(0xfc2bc8e3aa0b93c2, 0x5bff7ce1a69f8296, 0x4061fb3163657d66, 0x09a15adab1747b37) }, // -21191
+  { teju_literal4(0x65daa780428d2857, 0xf7189edaf7c129cc, 0x7390906a3f305fe3, 0x8d927892f7e926a1), teju_literal4(0xbf8f8194e3607ec2, 0x180506c765b3c34f, 0x6201a1798aa77935, 0xfcd29162c9ee76c6) }, // -21255
+  { teju_literal4(0x8f562ed1042d90da, 0xb2ca3107fcc171b4, 0x794783f4cab7295f, 0x636686438c0ed8d0), teju_literal4(0x9184a2e15222043b, 0xbacfec32063f26ec, 0x4785f3a7e7d13a54, 0xb6c4cb0b54cebadf) }, // -21319
+  { teju_literal4(0xc86907f32de4e174, 0x14f86ad00925691b, 0x4cff18910eb4906a, 0xb535b701e33093b6), teju_literal4(0xdd1596c873a2535a, 0x4c94c98babafe64d, 0x608c2a4eb5448021, 0xaecc5f3f4c06be37) }, // -21383
+  { teju_literal4(0xaa4296aeaf4a7b66, 0x10cc0e536bbc4b48, 0x81a9c621668cc920, 0x9a6a4ff57d9a667f), teju_literal4(0xa7f219681aed5225, 0xe0355ac8c03f2bf2, 0x6249a1a38aa71212, 0x1baf269d86afc2bd) }, // -21447
+  { teju_literal4(0x65a60a27d898080d, 0xf37058178b68e1eb, 0xf19d5dbd5fc516fd, 0x68fd6cebfa6fb60b), teju_literal4(0xff288a87544765eb, 0x7e1759436df2ec95, 0xda0b8fa58ea5f538, 0xa3ebec2d8ae21718) }, // -21511
+  { teju_literal4(0x5ea6ff48a98cba14, 0xcbbb7b9a6a0702f0, 0x9bcf28edca54e4bc, 0xaee57e6aa4a920cb), teju_literal4(0xc1d4732b279bda8d, 0x8d1ff3518d2f99cc, 0x59ab695d20ee09f0, 0x9cb440bf26b6d05b) }, // -21575
+  { teju_literal4(0x6916213437c8beb4, 0x3083ed27ea73c4fe, 0x3d6441572a152366, 0x223deceec035dab4), teju_literal4(0x933df28d7175959a, 0x34fea1fbb09a4ee4, 0xa0c8e7ad46ebd726, 0xb2d4add77bf9e418) }, // -21639
+  { teju_literal4(0xa4cba8dc82effc84, 0x05ef0b350bcf3bba, 0xeeb4bbb30931c2a5, 0xb42621f6dbdc3139), teju_literal4(0xdfb411afe4e7726c, 0xd27a4d708fcd0a3d, 0xfcf62f920d8d9879, 0x7f43175c291b0cc2) }, // -21703
+  { teju_literal4(0xaec7574a72fe3a45, 0xc00e7cfd40c872ee, 0x728666b3bd305fce, 0x3fcf63dff7437686), teju_literal4(0xa9ef6d270df1db16, 0x02fb07d1fe6d3f75, 0x31858f3fc51d80fd, 0xf48b0be000294fca) }, // -21767
+  { teju_literal4(0x51d43010cbb77bcb, 0xbe07bc7a1419a649, 0x24b4fc2b2d4360e1, 0x3ecaae91945203d9), teju_literal4(0x81172db7e02d014a, 0x9adb481abfec9101, 0x5d5addfa60228892, 0x06036674b5e3da7e) }, // -21831
+  { teju_literal4(0x87781b1d6ab711c6, 0x3492764d77f591d6, 0xc0b956fc4b4bba4e, 0x72a1c62107ee8ba3), teju_literal4(0xc4204693ca6e9420, 0x65b6fb5a397608c7, 0x661ac6befca07b74, 0x91248c0ee360066c) }, // -21895
+  { teju_literal4(0x4c67935568eef4fa, 0x6daf3a63a6b2a843, 0x7224ce92e6b125fc, 0x977cb797aec18080), teju_literal4(0x94fc7c95ae69f1f4, 0xad0a1bef7d41cd6c, 0x90bb69207f31d09b, 0x5df40ab5ba991a38) }, // -21959
+  { teju_literal4(0x008bc06f6de4e7b7, 0xb6930a7b77469db9, 0xa0f9856f523dc418, 0x177ab9d1ed3a2ed0), teju_literal4(0xe25a7df2f0981658, 0x1ca0821c39a94bee, 0x79f5927d2bce48c7, 0x8ef463636c7c4e2a) }, // -22023
+  { teju_literal4(0xdef36fa1592380f0, 0x3192ac888f132891, 0x85e87bd36795cd7c, 0xa11b4bc87b4b2b34), teju_literal4(0xabf2c98787721bc6, 0x52d6ead7f2ccf802, 0x58dc41679dbf5517, 0xf072d0923c47db5b) }, // -22087
+  { teju_literal4(0x1981f8fa6b216630, 0x71f90f47272c457f, 0x4e613d44087bca73, 0x009410800ed8a881), teju_literal4(0x829eab8b46a127b3, 0x5da2da5d18fc212a, 0x8956c8fb74c20fc2, 0x3923e51743959969) }, // -22151
+  { teju_literal4(0x282e07524cd9f7fd, 0xfec1cce4f8ee480f, 0x481b6b8be05d59ea, 0x4510b41ff7b416d6), teju_literal4(0xc67310addab40862, 0xa409c27ebb160141, 0x22f5dd628c7df3dd, 0x1b50d2986ec8199c) }, // -22215
+  { teju_literal4(0x0ea2f0c367493a17, 0xb543cdba0469696b, 0x1cbb81d899afd8b1, 0xb2a89ac890f7524e), teju_literal4(0x96c050d4dd5d57c9, 0x6bf8c36665396211, 0x0133d3500af4928c, 0x7abb60345ddba792) }, // -22279
+  { teju_literal4(0x9f4176b38e79b0a0, 0x05b8380623790876, 0xcc0d641886a6601c, 0xe322adaa51102f8b), teju_literal4(0xe508f3a8219a5819, 0xc49d34f0063c28ae, 0x8fc1ce04189f3c6d, 0xcd4dc7ee0e07e7e9) }, // -22343
+  { teju_literal4(0x16e48700dbeb3a87, 0x7a02e2dac3c64816, 0x25823e03e4f4ce71, 0x0e5c0d3a0d18bf7d), teju_literal4(0xadfc40d5ea334054, 0x2bf88f1d7d3a2632, 0xa05ac3fe534ac094, 0x5f0f4378e4c0e7e5) }, // -22407
+  { teju_literal4(0xef12165fbfcea3b3, 0xb574efa86358ce32, 0xcaab1ddb7b814c25, 0xa2e113cc90ac87cb), teju_literal4(0x842acca456646811, 0xeda5ce154b9d1423, 0x0b749a566a010819, 0x8bc8c3eb2b0d093d) }, // -22471
+  { teju_literal4(0x5444b6367ccae1d0, 0x79fcf6b5616230ec, 0xb3a7dcc1b5eafe02, 0x7bf8c5236f8300fd), teju_literal4(0xc8cce697b31d5bac, 0x58ace782d1ffe805, 0xad165e2d6f09f714, 0x047a38a4849d10e3) }, // -22535
+  { teju_literal4(0x0e23ba867d987da3, 0xe02ee5056415a8fb, 0x41c831ebd5f4f805, 0x985d9d659df7b668), teju_literal4(0x98897f55e7d94f69, 0xe53213fd3bc437bb, 0x81dc90e1b7a625b5, 0xdabe389c60977721) }, // -22599
+  { teju_literal4(0xbd918d40f5ffabb0, 0xc8cd7429b4423e23, 0x30f253efef9cffb2, 0xc55799dc03b01c23), teju_literal4(0xe7bf8b2f10098615, 0x4cf7715138318ee4, 0xeaba474d379f4a55, 0xde2d3fea6bf14dcf) }, // -22663
+  { teju_literal4(0x69fe4ed244569d79, 0xfae3728e041655a8, 0x3e8bb652ad3c3fa8, 0x5eeb79321b5d9451), teju_literal4(0xb00be5961743e5fc, 0x61e85cdeaad153b6, 0x8b28af3017a8b306, 0x1503051e3ca67870) }, // -22727
+  { teju_literal4(0x5b2a0190ab5a930f, 0x57f091ae2f9f4261, 0x5ed32a9c57d2b785, 0x8a0f451572f6a60e), teju_literal4(0x85bb9f13b018a6c4, 0x6bcb57a6c3560eb5, 0x3a4b6c51fec2509c, 0xd6095a92685252ff) }, // -22791
+  { teju_literal4(0x23d63c538947e30e, 0x43ce570e0d22a736, 0xc5cf6c6811768d12, 0x34b8a9ab80992a9b), teju_literal4(0xcb2dddafba26ac61, 0x089c01a1f82c74e1, 0x254bdc5e63657b26, 0x5d70b0d133454ac5) }, // -22855
+  { teju_literal4(0xc72e1f983aed715b, 0x4a99c6b85688770f, 0x485e5a8a02967422, 0xd14a4d62503f3176), teju_literal4(0x9a5818545e648dba, 0x608d476ce994c002, 0x929f58f69cd68b00, 0x1012b30668402e0b) }, // -22919
+  { teju_literal4(0xd20a28a808436c2e, 0x97a016a35f84bccb, 0x62fba22b995947cf, 0xf97af6de543b1316), teju_literal4(0xea7e5d313ec11828, 0x549f9891fb98d869, 0xc479f8a5609b9d00, 0x78d3d51d34c07c90) }, // -22983
+  { teju_literal4(0xf4fbf26f7e62b89d, 0xb9203a3d9410f50e, 0x5dc7d81b1113517e, 0xca5860b1dd102236), teju_literal4(0xb221ca8416475c48, 0xd58fe494d726c4f0, 0x1bc9e8071323ab7d, 0x371deba5ad9470d9) }, // -23047
+  { teju_literal4(0xf6eafc3c3f35f9bd, 0x51cad11ee6f227d0, 0xd61e5e7e016d8bcb, 0x0e54379ad53b27d9), teju_literal4(0x875131149bf569e2, 0x0f34a5b697743c7f, 0x10da6066c4d204ab, 0xf6796363302aef26) }, // -23111
+  { teju_literal4(0x5a5e573a2902c2ee, 0xa603026f6a38b04c, 0x712e5cd7cd1251d8, 0xbdbe3f1adff14cdf), teju_literal4(0xcd960b9524526b87, 0x6b97213df3d78b60, 0x2b71fc5c74e03f19, 0xec706e4c238fc0d6) }, // -23175
+  { teju_literal4(0xbd4d02175b427a89, 0x92c6c89195fd1389, 0x92f7a54677fd8123, 0xf0f0343e934e7a36), teju_literal4(0x9c2c2c3d0c0f10e3, 0xd472ba05b2ecfd88, 0xaf96d558ed7bf1d8, 0x9e8084943de66553) }, // -23239
+  { teju_literal4(0xd6bddd39f9019134, 0xfd9fa1bed7204e3c, 0x270ce3143d06d1e7, 0x36b2dd1834f43073), teju_literal4(0xed4582a2fb878294, 0x48026bdd27b2a635, 0x519ba14587ede9f7, 0x2189e7172d72b9ce) }, // -23303
+  { teju_literal4(0x1c87193c029f8453, 0xb12ed7ee4903df4b, 0xff5968e149a360be, 0x5c52814da21ed7ea), teju_literal4(0xb43e0294bfbf485e, 0x66b63b4a9837849f, 0x60dbdf86980d60ec, 0xb7d76205e646b957) }, // -23367
+  { teju_literal4(0x343ea38897db39c8, 0x29e58027a440122c, 0x26b00d1c343afc9e, 0x9a1373219d5da289), teju_literal4(0x88eb910d8b238e50, 0xe6b5cd159df635ef, 0x4499d9211695c5fe, 0xde1c46ef48cda6b4) }, // -23431
+  { teju_literal4(0xda0c0de9cbfe0ada, 0xb4600ecfeed0fbe0, 0x2d261632ec8da1dd, 0xc19ec86356932a08), teju_literal4(0xd0058628b8b1c0d7, 0x28728fb9072cfca5, 0x693eb1ea0a845bd0, 0x39f3e2a75869e0f7) }, // -23495
+  { teju_literal4(0x4c12c911518b3057, 0x634d0a2d4e2e91f7, 0x3074a30c67c75285, 0x0e5ddec7a7d93bc9), teju_literal4(0x9e05cbae8bbdb41a, 0x8866173393acb0aa, 0x99403d656230df82, 0x0747b9c9f3dd23f8) }, // -23559
+  { teju_literal4(0x57886eee635b918e, 0x7835db69debdd3e6, 0xf8d2bbcf0035d44f, 0x510ea5516ebfaa55), teju_literal4(0xf01514c441e0dd50, 0x96ddff142d707000, 0x93fb7492bf4d7234, 0x4f15bc212a674382) }, // -23623
+  { teju_literal4(0xc667a266b9ee2c3a, 0x5ca332052a623dab, 0x6051ac02c1ed35b9, 0xdf6c74b4aa5def94), teju_literal4(0xb660a0f66959b640, 0xc25112419f0020af, 0x64d135751fb7d6ba, 0x625ce5b58bb0023a) }, // -23687
+  { teju_literal4(0x127548d7363766fd, 0x6a5dc588e5aea45a, 0xd0da1da57d5bbe69, 0xcf4509abc5e8629f), teju_literal4(0x8a8acd909aa14a82, 0x957f9b9d81dc686f, 0xf38d6355cd56add8, 0xd8e108835b0385f4) }, // -23751
+  { teju_literal4(0x3c2a654d3b704d8f, 0x5c8bbed102818312, 0x514df8828c4b8fe2, 0x3df07ddac51d3263), teju_literal4(0xd27c638d97c0f4a0, 0x5842ec619d767d03, 0x42cd958f5884a02e, 0x3c72567bcac31d7e) }, // -23815
+  { teju_literal4(0x704300121545f623, 0x84c07f24655cc3b4, 0x13db2ed9eb180470, 0x2c161bd4371fc8b1), teju_literal4(0x9fe50779df3a877f, 0x57575b4cf538bb3a, 0x8a9f4f242cc8fecd, 0x1bff1e8725380881) }, // -23879
+  { teju_literal4(0x14de04f28852cc1b, 0x4652d5d46a1c2cdd, 0x1b0c3cb842b4ea03, 0x05ed5a8c4c88b982), teju_literal4(0xf2ed2d21a0916d7b, 0xca74f86b40d76a23, 0x2ead812b056107e4, 0x4a7f5c96ea0da49a) }, // -23943
+  { teju_literal4(0x38e2c6cbbbbbd6f9, 0x92de1f4003d5063d, 0x9aff117c03c50f4b, 0x277ca130a3162b1a), teju_literal4(0xb889b9119449b637, 0xa88f0923021df387, 0x1d666b5fc9bbf7aa, 0x9f6cebb26eb03280) }, // -24007
+  { teju_literal4(0xc333a4b8ff6335f0, 0xde6c842f99b1920a, 0x899fa80f6411d089, 0xf425391c4feb8b83), teju_literal4(0x8c2ef55c17b32493, 0xfa3814b9f0114171, 0x607e22c927fb195b, 0xcc762f7b22780b68) }, // -24071
+  { teju_literal4(0x1acf67a29dde65db, 0x64a9cd28fd0b716a, 0xe4e7d36eecf53176, 0xc1cbdc4b2d5997a0), teju_literal4(0xd4faba2a049eef1a, 0x2a02de4c65fe8029, 0x0bb9606344ae6ba0, 0xa79dd083d99222b4) }, // -24135
+  { teju_literal4(0x1296575bd9d110f1, 0x778a4a92ffd7f79b, 0xce1081bc7c35a178, 0xde2889266bfc7bb1), teju_literal4(0xa1c9f0a3080f4934, 0xd6d26c13ecf28685, 0x88d53e7232de856e, 0xfee6f2984724166d) }, // -24199
+  { teju_literal4(0x09dc7d0033e6a71e, 0x6482b0d9cdeb16cf, 0x58ada777f899b116, 0xff6aaab97e47d9fa), teju_literal4(0xf5cde59521d8370e, 0x602ed37c02526ed9, 0xc4ffc7c42da19559, 0x6d8bf0c540adf16a) }, // -24263
+  { teju_literal4(0x47c17fbd441984c9, 0x0e2abbfc8fee748d, 0xd7c3451937a3707a, 0x46fd8746cd268856), teju_literal4(0xbab95e899db0b70e, 0xfac28640f465f553, 0x4323ef365686fc01, 0xbcb78d2ee52f34f8) }, // -24327
+  { teju_literal4(0x1ca3cdffdaea0368, 0xa0bbb2ce9f5bfc6b, 0x41117d60561dafce, 0xcfaa190a48f0c822), teju_literal4(0x8dd8175b05e68fa3, 0xc7cd7660346f17fb, 0x4f98302ea48c71ae, 0x593a881eb4c81692) }, // -24391
+  { teju_literal4(0x3c0a44eb6584da1e, 0xb017394420967e4a, 0x1ae7f1ed6d82c1f3, 0x7d9075e14475e95f), teju_literal4(0xd780a0a830a6f20f, 0xbecd7e6e243c7d85, 0x460343e753b18f48, 0xdff7996d9c84bdcd) }, // -24455
+  { teju_literal4(0xf2604877357185f0, 0x7a6db9289310dc4e, 0x2d29768f419c973e, 0x3b39ba5a1770364f), teju_literal4(0xa3b49861a22f6d05, 0xd6afbf64ff56a0ae, 0x060944a0d42f98de, 0x7e710c57db6c7d35) }, // -24519
+  { teju_literal4(0x7fde813348e985a9, 0x29af25fbdb42a0fc, 0x0ec22efa2afc8c41, 0x5e1aed445a07de4c), teju_literal4(0xf8b758473669d5a8, 0xe723a7307948c7eb, 0xef26c44073079be2, 0x569528d5ecf70e0f) }, // -24583
+  { teju_literal4(0xe3deb2049f6ea1eb, 0xeb1608d0544f26bf, 0xa686ea2aec9e7e74, 0xcb4e782e53872568), teju_literal4(0xbcefa53d711ee0b0, 0xdafabc5ef7ea0346, 0xfb55020846439d56, 0x24ec0f72120b0911) }, // -24647
+  { teju_literal4(0xb59b6f6e0a52c4d0, 0x86df88838fc2b29a, 0x992b613070c7613e, 0x11896de26de008be), teju_literal4(0x8f8642a5a6aaf276, 0xed98234ee297d58b, 0xed66fffe587c856f, 0x1a343c6d7f5f4a7b) }, // -24711
+  { teju_literal4(0x1243138e5fa6b75f, 0xec03db4d77c1fd60, 0xb06b43bf845e467d, 0xe2d5cfae61c168fd), teju_literal4(0xda0e2df70973c78d, 0x05b3cedc006dd904, 0xa69b58bf5f48b799, 0x77ac25f076630b05) }, // -24775
+  { teju_literal4(0x58ebf5dd1e81de2e, 0x9573bd950e918f15, 0x0ce4e07bffab85ba, 0xd09820e02c1acabd), teju_literal4(0xa5a5102180773070, 0x301eafe1e312495e, 0x4847a62a6a4ede38, 0x3ee0a92ca8fec359) }, // -24839
+  { teju_literal4(0x6fc4f0411adc136f, 0x1cd3ab5f74dab55a, 0xf05f25bdcb17fbb2, 0x917dc00b3707bd58), teju_literal4(0xfba99fafa333f458, 0x6c20ff7d4df3c102, 0x597f2feaf230915a, 0x014f3fd10adc0672) }, // -24903
+  { teju_literal4(0xa80cb1d8e873e6a5, 0x305c64e4da2babf8, 0xf7c123472b2fa352, 0x1d80648dce61f2a0), teju_literal4(0xbf2ca1483d30c598, 0x0fc67a5bbbfb41b1, 0x6588eddc8844144c, 0xc813b3b5d1af871a) }, // -24967
+  { teju_literal4(0x1c269213c32804e3, 0xc2ed9303fed6dab5, 0x919c1a993927b372, 0x65169f02198ed5da), teju_literal4(0x913986820285e7ef, 0xc283106911842a26, 0x8c2a6fe211500b0b, 0xba63de847862dddc) }, // -25031
+  { teju_literal4(0xf31b132391cdb41e, 0x77b20351b364593c, 0x60eca73c4b661d71, 0x3b7dcda1c1a8ab84), teju_literal4(0xdca3794b0953b619, 0xc27cc49cb94b0f8c, 0x6b8c26e004650cbb, 0xdc2afb3b38c8d363) }, // -25095
+  { teju_literal4(0x9ef5fac545013902, 0x3579f901120dfdf0, 0x0dfb63c406f13ea1, 0x23913ebe406bc200), teju_literal4(0xa79b69834b05498e, 0x485e8eeeea7471e0, 0xb447f568c5919ef7, 0x3cea094c504deaa6) }, // -25159
+  { teju_literal4(0x182a8b15b53facaf, 0xec0873b443781884, 0x664989f51b459a99, 0x690f447c4568b07d), teju_literal4(0xfea4d69671f1d579, 0xa2aec6de45f13fc4, 0xd81c29afd4732630, 0x20f5e937c6033069) }, // -25223
+  { teju_literal4(0xc56fb2f945d43529, 0x3ff6eab704fc7f1d, 0xf954a0eb30d0cadb, 0x1c7e25495a37556f), teju_literal4(0xc17067022a50d4d1, 0x62fb786b0beb5f5a, 0xb8cf835fead3563d, 0x48a2dcea2e22c022) }, // -25287
+  { teju_literal4(0x26f0a3f7937cf1dc, 0x53d864bc4cff1552, 0xf4e29aa82b6217ad, 0x745907e9780e665c), teju_literal4(0x92f1f26473e79876, 0xc019d59ad58bdad3, 0xf81d6065b51da8d2, 0xa0f0684f82072f2c) }, // -25351
+  { teju_literal4(0xfb705517d53f391c, 0xae175201cd0a6e9d, 0xc5214a1c1c1f67f0, 0x0f3cbc65900e5007), teju_literal4(0xdf409a1f0a34a13f, 0xcb8c93f4c083f62d, 0x7c235e00606d0564, 0x54e28c97cbf36857) }, // -25415
+  { teju_literal4(0x8870ec4e40bcae9d, 0x8297dc5a531a000b, 0x253301063935e97b, 0x5eb1bfbcdebca3e3), teju_literal4(0xa997b65d1f74d033, 0x9a9ec37fefb3d597, 0x80798afc2012bea2, 0x1b9f5c78e35e3b27) }, // -25479
+  { teju_literal4(0x2647f3a958707db4, 0x18ffc18014b6429b, 0x85f6d2b6e1acb406, 0x9ad5c7ff16fd780a), teju_literal4(0x80d48c0a724d3abe, 0xac3dafd840a7ec83, 0x580c22900f22967c, 0xdfc18cce471ec187) }, // -25543
+  { teju_literal4(0x80ae3c564fde52bc, 0x7218922dd8796b57, 0xc527e6c360ac3bd3, 0x58e35b307533ec6c), teju_literal4(0xc3bb0b0113a309b5, 0x81223b4b0f45aacc, 0x589ab607f1bd7817, 0x0991363b3c7b0e99) }, // -25607
+  { teju_literal4(0x2def7252bc621f74, 0xa2cf34d5f813840a, 0xb03f24a32be408d5, 0xda81764b9e90c763), teju_literal4(0x94af95f033a41a39, 0xbb3e8bc8fb13ba35, 0x46a07826d4c8be63, 0xddd586d25cd31f7e) }, // -25671
+  { teju_literal4(0x944a4ebe3e760b65, 0x09e71cec8154d2f0, 0x0ee04ecc12778a49, 0x77c54014427e0c5f), teju_literal4(0xe1e5a8351b0fd38b, 0xb263642f0c963110, 0xdd6adc67aa235819, 0xd19a78799a6ddef5) }, // -25735
+  { teju_literal4(0x74b5e6078a90c726, 0xfc8321c2bd6e2123, 0x35bc9b62ece7f620, 0x96dd78e53c409875), teju_literal4(0xab9a08bb32fd119d, 0xa673f3c6d6ab3dfd, 0xfb50735de6c3e818, 0x592a2bc53388b8ca) }, // -25799
+  { teju_literal4(0x4a37e8dd74b9d7e5, 0x67833cfe821eadff, 0xa90bb89f2b6a603c, 0x3089395e6dd3a93c), teju_literal4(0x825b3fcb35d8769c, 0x420962304ca9fa24, 0x9b253359156e9f52, 0xa09362b594652575) }, // -25863
+  { teju_literal4(0x28443550af4712f7, 0x6cce29228a66ed59, 0x50ba130ed31321b3, 0x02c2595b16c3eeb1), teju_literal4(0xc60ca21942216a32, 0xa919588d3a55b030, 0x3e8f458df6f65843, 0x1a0f9d3f5920522a) }, // -25927
+  { teju_literal4(0x4fd4b2b6a32a1638, 0x2c5ba7f7ed03f50b, 0x1714c713dde04aa1, 0x8689be4337638052), teju_literal4(0x967280f7e716d519, 0x7731f226025fd0cd, 0x7896f1f328047db2, 0x6a9f13f7905854d1) }, // -25991
+  { teju_literal4(0x4fd9be17a91fbfe6, 0xad49460d7cc86cf1, 0xa6a145a13785772c, 0x09e71c1b2602402f), teju_literal4(0xe492bb9757dd05ed, 0x43a31e804ee33988, 0xe59ca72f7e2ae260, 0x4498e5866eb44bdb) }, // -26055
+  { teju_literal4(0x223c9338fa180cf7, 0x7a7f30af269441c2, 0x3e883a6d447946ed, 0x58352f1e48414381), teju_literal4(0xada272e0767d105b, 0x6014775179d682b0, 0x168128c224c6b419, 0x555779e359b001be) }, // -26119
+  { teju_literal4(0x274feeaa3b93cba2, 0x04958c15f36f2446, 0x155afcded1a82d8c, 0xfdf09ee25b8a60ed), teju_literal4(0x83e6946ccfbfe950, 0x49aab2b7dd47b102, 0xe6b0056889d7d0e4, 0xe09f4c49256546a1) }, // -26183
+  { teju_literal4(0x6b95acefea94037a, 0x4ceac09b72a5e926, 0x07b9654658def6b0, 0x5875ac08999e07cc), teju_literal4(0xc865415e29eff866, 0xf382048be7caf947, 0xa9587d8a3f46fe86, 0xd04bed0cf54b4f4a) }, // -26247
+  { teju_literal4(0xda53066c7e4d7268, 0x2324de7efbe82612, 0xadf5f2081dc2b75b, 0xef121758213214ca), teju_literal4(0x983ac37e2ff4f63d, 0xb466f038779ae173, 0xefd3b58c9f37c934, 0x0e493905cc2c33b8) }, // -26311
+  { teju_literal4(0xf4feec9407d21622, 0x1f77b3f0272c86c9, 0x6d530c797056385f, 0xfb05f314bcdbc638), teju_literal4(0xe747ec98c4144f58, 0x65c83f768a7f646a, 0x6c5a307b018456d0, 0x2219c1bd33d27ce8) }, // -26375
+  { teju_literal4(0xc0c664cc15cd041f, 0xee6489ad77bcb070, 0x10d14110e1044c36, 0xe39782b3208c1edf), teju_literal4(0xafb107473c788382, 0x51f347628f41117f, 0x9c2168ebd06a52e9, 0x03bd9ba5d6dc422a) }, // -26439
+  { teju_literal4(0x4e858ad95bf2adfa, 0xcbf12ef056e98ba6, 0xf4e2a18f8019b020, 0xc5f0a4c434d248a2), teju_literal4(0x857697f89e2438ad, 0x38051aaacab1c3c6, 0xac7982de22b504a6, 0x4cbb7f6c84bd6180) }, // -26503
+  { teju_literal4(0x14a4bbb4cb82a955, 0x22bdc7b830c4967d, 0xaea842c6d65c6076, 0xc5974772127b233d), teju_literal4(0xcac4fe2329eed071, 0xd490ee14fefac974, 0x103b6083767469ab, 0x188ae7c1ccd63e02) }, // -26567
+  { teju_literal4(0x1ac58a5e308eb49c, 0x7332ff1401406c88, 0x9f667283ca59c202, 0x53dff5e0ce06043a), teju_literal4(0x9a086db63dd40e96, 0x00cc8561aa0fa006, 0x5721624b7e6de5aa, 0x191320516fe87bf1) }, // -26631
+  { teju_literal4(0xba759c506f4a73e6, 0x6b49fe9855b82801, 0x64d5eb3c76f6bda6, 0xf7b8bdabf300ad98), teju_literal4(0xea0553d627c6bec7, 0xa99d08607a454859, 0x13781aa271622767, 0xb84ec35c9b82a379) }, // -26695
+  { teju_literal4(0x67108834af83d5da, 0xbe90492c59e0ca61, 0x4a58a36fd59404ca, 0x97eecfba7dcd9ff1), teju_literal4(0xb1c5d8a1e10c39f2, 0xa30412fd83ef8651, 0x47e4a7cce939d277, 0x6a5268f94ca7059e) }, // -26759
+  { teju_literal4(0xf587a23841cafd62, 0xe999a3b56145de70, 0xcb1285db4ca1deeb, 0x5134f75666cdcb59), teju_literal4(0x870b58a290b767ac, 0x791c1173fd7b26d1, 0x633c9639ec4229b2, 0xec034d37ad5a540c) }, // -26823
+  { teju_literal4(0x7c28d6ba81e1ca04, 0xb41a632603a23678, 0x866ffef04493e117, 0xb1c8a6ea68e1c83e), teju_literal4(0xcd2bedfc4d913fc6, 0x7013fba1f1eb0c2d, 0x3f21b4abc5365920, 0x86de3bb149c05be5) }, // -26887
+  { teju_literal4(0x77636847594150ad, 0x74f76f523a83201e, 0x31a1e19ed8e1e06d, 0xcb3646d05338c64e), teju_literal4(0x9bdb9004616a070a, 0x1dec9f1340d1985f, 0xd6783f97ccb36448, 0xb4a08d56ef91dbbd) }, // -26951
+  { teju_literal4(0xc73d1f0fc059b1e0, 0x9e848108d67691fb, 0xaf708affea90fd8a, 0xff46057decbc550f), teju_literal4(0xeccb0a36ef557949, 0x30453f06de8c1fd4, 0xaa26e9678b7777f9, 0xcbeda76378878c5a) }, // -27015
+  { teju_literal4(0x4dc3ce665eea1373, 0xf9ba51873aa1a471, 0x5be5c477f29984a6, 0xb4ed0aaa12007997), teju_literal4(0xb3e0f9db73dfd84a, 0xca83fb0708b3b319, 0x2bf32c0f993b167a, 0xe5f2b118554daf89) }, // -27079
+  { teju_literal4(0xde508641e7a74b1f, 0xb8c34a1f58306b53, 0xb51d6a6f5dda97aa, 0x270f942bf2d85354), teju_literal4(0x88a4e4c9a9d5c677, 0x8e4ec408835f7847, 0x12d6ef4ac463b072, 0x55ba1fb7d14ef63d) }, // -27143
+  { teju_literal4(0x027ca517f425c36c, 0xe8fdbbb4de21c974, 0x7aa800699a079a71, 0x11c2edfd2e94622c), teju_literal4(0xcf9a26bf1100b7e9, 0x202d5c8923b303ff, 0x05d2a6913238274f, 0x000a23403ebc68e5) }, // -27207
+  { teju_literal4(0xcee4cfc4c567f3ac, 0xa840a1e57a16f200, 0x7dea6c4b0450ade1, 0xe990e8dfd1f6cb06), teju_literal4(0x9db43afea18ba4c8, 0x573716c1e561507e, 0x10d2533f96a58c92, 0xec6d168dbec3b12c) }, // -27271
+  { teju_literal4(0x0986123cd4d59a05, 0x344befe23cd27124, 0x42260c43e44e8b43, 0x16c437670b1ad971), teju_literal4(0xef9928ee0dcf4d8d, 0x366febd20bfaf4e6, 0xa37db4af24cc8398, 0x38e8f21b46f280fb) }, // -27335
+  { teju_literal4(0x83bbc35b685682df, 0xf2fba5c66db5e14d, 0x600b3456ff33edcb, 0x97c81a33c7f8bfd4), teju_literal4(0xb6027e18641afa41, 0x8406ad59e963ddd6, 0x5e2c4ba8392a23ca, 0x7c744408ad6710c2) }, // -27399
+  { teju_literal4(0xeef7ee63a12b9d09, 0xa64a2a26d4086422, 0x327f3b0393fa50c3, 0x4372d97c4763345c), teju_literal4(0x8a434af88126659a, 0x3f397844fb5c7e79, 0x3ae9aae9ecb88a71, 0x796cbd3b6126fde5) }, // -27463
+  { teju_literal4(0x01178af1aa99bf91, 0x42b72c39caf00045, 0x30b267e89c6d88e6, 0x106ac507578ae607), teju_literal4(0xd20fbe8327929361, 0xe6ee60951971f9ed, 0xb07da18cc4e84425, 0xc61984c7c71de454) }, // -27527
+  { teju_literal4(0x9fdc573aadd67915, 0x9c66856cbc748089, 0x6d5be914f9269ade, 0xb25b1515ddae41ca), teju_literal4(0x9f927f6d51eee7fb, 0x2e7d187c76e621c1, 0x6042f1da2c19b7a5, 0x256e033b952f168f) }, // -27591
+  { teju_literal4(0x335564563f6ff5be, 0x50ded5b5dfa0824f, 0x6565e7ba42090524, 0x756d3665ad75ab8e), teju_literal4(0xf26fc97ae1fcc684, 0x7329e3dbd5620233, 0x7feda445ac7bca5f, 0xa4fc1b4bbceb557c) }, // -27655
+  { teju_literal4(0xfd98ee2b96a7cf61, 0x1eb34a79a41b16f8, 0x971b3f9a63b9401a, 0x2d90e137e55fcc50), teju_literal4(0xb82a78b72e63d269, 0x3921b1514d334ffc, 0x6e0205fa383332b5, 0xd8e94d0e38e1201d) }, // -27719
+  { teju_literal4(0x496770c5d778fb95, 0xa8ee6c5c589d0993, 0x3e3e58d955926b2b, 0xb80b048a9ebc094a), teju_literal4(0x8be699e5c7c7afb3, 0xb434e129fa627d9d, 0x64872ae37a91a9f9, 0x1e71e9109cc8d432) }, // -27783
+  { teju_literal4(0x97d2cdf06959086d, 0x98af6e7485207dd3, 0xf76bcdafbf85d98d, 0xc6ed736ed946ef0a), teju_literal4(0xd48ccba34497b8cc, 0x27591d10560413dc, 0x1cdb05cf0773780f, 0x2d669ab3fe3ce48d) }, // -27847
+  { teju_literal4(0x23d4ed3015444d30, 0xcbd9dc6956ee98e1, 0x37bb89af75a5cf76, 0x490ce3624800c23b), teju_literal4(0xa1766e4babb69f3a, 0xe62137d6c3d5ab58, 0xe382275ed406a435, 0xc8022f6d12ad4faa) }, // -27911
+  { teju_literal4(0xca7612c76aa0e780, 0x5c5c52c971accd54, 0x6232e159516a85be, 0x24b6fd166c4941bd), teju_literal4(0xf54f05aa1e22defc, 0x65ed54372470bb39, 0x8936e6929307ef8e, 0xfad3f7690ff69a14) }, // -27975
+  { teju_literal4(0x5d1271c76f30e70c, 0x1d7580858b12eea7, 0xe0deda6b13625f49, 0xa8ddf3bd2c68bc80), teju_literal4(0xba58fd510ced75e4, 0x37b4da059fe2948a, 0x60f0aa841a499799, 0x6636a47b85506333) }, // -28039
+  { teju_literal4(0x1fd6f2f54ca96284, 0xa50b0dd6fbb25f04, 0x99617bd853bf09cd, 0x0af69540b18141b3), teju_literal4(0x8d8ee074ce0cdb0d, 0x231dec0da4a2ede3, 0x1fbac43b1210d404, 0xa23a81d7ca1467a3) }, // -28103
+  { teju_literal4(0xf973b237a0794867, 0xd694926a3ec97003, 0xf48b5f11c2f2f091, 0x24582b5e1064fcea), teju_literal4(0xd71164bde68d3d4a, 0xb356dfd42c6b14a0, 0xe8a35b7609721226, 0xa7cec6afc21a91bd) }, // -28167
+  { teju_literal4(0x080d80748d200a19, 0x8664a95b8c473b5f, 0x337bf5a7764a71aa, 0x9d19c65e065c4813), teju_literal4(0xa36018c867cc9a4b, 0x39a761f94654f6c5, 0x87f03adc9f33188c, 0xce9e7a04adb1335a) }, // -28231
+  { teju_literal4(0x8f5fb182aa3e7a1e, 0x8bf9e334cb027773, 0x2bdf624817665f06, 0x9f20737a7eed8b84), teju_literal4(0xf836f796b28490d1, 0x886deecb02585358, 0x7b010d20d8b2d151, 0xa1bfd4051e586a25) }, // -28295
+  { teju_literal4(0xb4e07a00c13a2fb9, 0xab98fdc472ba5a3e, 0x4bb509fbb983306e, 0x2eae42c8c60f6cae), teju_literal4(0xbc8e1fbaa99c144d, 0x54cc8690a31b0b89, 0x320f0dda2c80925e, 0xd7c34b318cc25487) }, // -28359
+  { teju_literal4(0xcd93a9d4f1d685bc, 0x14840f2089259984, 0x1eddc567eab0cdec, 0xd9e2f5154e3e1ad8), teju_literal4(0x8f3c2db60ad0f2b8, 0x30ed3f7f08f0b7b2, 0x9a973ef456700248, 0xd4ba3d4c4d905ace) }, // -28423
+  { teju_literal4(0xdbd9b197f6a12f02, 0x2a1619024a2eb1a3, 0xc56841b879141e31, 0x261e479357d80bf1), teju_literal4(0xd99da0b624b53d46, 0xbc20cd6b0a5ad005, 0xc3de6244ddb8ccf7, 0x6b21c9f666cd7acb) }, // -28487
+  { teju_literal4(0x02f7227533fa3a7d, 0xc3d548712ad84bc9, 0x4f2ee5b2129a0c86, 0x3b6219808e023652), teju_literal4(0xa54f90465b0ff722, 0x99abc88a4b236764, 0xc75465f6e6c3cbd6, 0xe115026694a4c581) }, // -28551
+  { teju_literal4(0x952c0f17998397ac, 0xe78e7b0558acaabf, 0x3875f3319dba5b59, 0xb99ceb5363b35583), teju_literal4(0xfb27b9aabaab9343, 0xfd74a863674c72eb, 0xb41e721238d499f4, 0x42972399a553a15d) }, // -28615
+  { teju_literal4(0x5970ea6245c6cf23, 0x0f5155a595e3f4bc, 0xe7f47520c5b6b447, 0xb0b781dc40d539b0), teju_literal4(0xbec9f404d2456f0d, 0xb6bc9474ce22f8dc, 0x7153c815cef66699, 0x09f4a0d2613e76a2) }, // -28679
+  { teju_literal4(0x11d24da427eb3461, 0x1127e66827956469, 0x8a49d7fdd15f8a50, 0xa28900cd7e0f6eee), teju_literal4(0x90ee90e7a464453d, 0xce0a3b00e13f39c4, 0x927c1bc0e273423c, 0x4ef7966bd6d5cde9) }, // -28743
+  { teju_literal4(0x7b9ff94d0ba57608, 0xdff693b710d3a36a, 0x9a9178ba7489c62e, 0xf6254e3aa15ec616), teju_literal4(0xdc3196b47f1f3841, 0x45fad87e65a9e7bd, 0x2fdaefb477e2bdb9, 0x328fe7e14c87e6e3) }, // -28807
+  { teju_literal4(0xcf569b524352156d, 0xad9d33c2007ae12a, 0xb6d0d8ed544e9666, 0x0a77ea6b365558f4), teju_literal4(0xa744e65d145d14d7, 0x15266e5b73d7de9b, 0x76b9136c1c3cf0af, 0xe6e03efded6c8b3e) }, // -28871
+  { teju_literal4(0x3d16d9e86a3614c1, 0xa14762eccf48becd, 0x70b55b4a155f73d0, 0x920764675c7a2c7c), teju_literal4(0xfe2166a06d80b53b, 0xa9b6e99fe245948d, 0xade36088d3e4af56, 0xe179e6617bdf02e4) }, // -28935
+  { teju_literal4(0x672bd00909f638e5, 0x1c2ac64ce4dc9fd4, 0xc9c3c52d83edc011, 0x9389613a4c927fec), teju_literal4(0xc10c8e7d2f13f687, 0x19aa1610d6ba3b04, 0x2c5a60d886081e1a, 0x9f1bd8a2da7b85c4) }, // -28999
+  { teju_literal4(0x84fd9d739ce6b497, 0x398b2f9611ac6d2d, 0x02777bb314b1cb8d, 0x9378a7aed6f24a17), teju_literal4(0x92a61975fb191578, 0xa3178e42bef997a4, 0xc9b2479dd9961598, 0x567cd2ef04265ea0) }, // -29063
+  { teju_literal4(0xa6abd00293d8b14f, 0x3d77ced281aca907, 0xd8a7a22316d342fe, 0xe0b06bf0c76d53ee), teju_literal4(0xdecd5e27b12752a2, 0x2dd6a6312da40568, 0x24be2cd76cd6c54d, 0x5796980d0e036de2) }, // -29127
+  { teju_literal4(0xebdeb762727cde0a, 0x7f39933ef364cf85, 0x16a4499e8a90cf90, 0xfcfa7258281d5c31), teju_literal4(0xa9402cd97c74c8de, 0x56549329e7c443a7, 0xf00c6c2bb52cd923, 0xa22dd4182d392c82) }, // -29191
+  { teju_literal4(0xb4f3ac9af60a3965, 0x8a541d44bb475cb6, 0xffaae97ebb597d42, 0x74b339ca960d4b11), teju_literal4(0x80920cc1881e2cea, 0xc5bca99f3fc26a42, 0x348a28780f7bdfd3, 0x83f55b524438f48d) }, // -29255
+  { teju_literal4(0x513b6706b49f8f16, 0x304c34e4fa70ed01, 0x5276c45af981fa33, 0x2a2ae0472b1eb850), teju_literal4(0xc35603aefb1306e2, 0xa6a0fc6ef72b9281, 0x5acdf9985035adbe, 0x2eeb8af23a1bba81) }, // -29319
+  { teju_literal4(0x08fff9b5f76fdf0e, 0x57e1ed431bf6d4b1, 0x7a460440b59ad911, 0xd990a03e6f65f46a), teju_literal4(0x9462d6fc357478f4, 0xa4aa3b3a8768420d, 0xed90f00c95baa20a, 0x084a1eb8d744d847) }, // -29383
+  { teju_literal4(0x94690a7a32d4033a, 0x956f70e9e509e3c7, 0x4b68af74b860502f, 0xb98602f4677d50c4), teju_literal4(0xe1710ec58673f6d6, 0x60b629ebe76fc0b2, 0x2102ec5b96749399, 0x350a221c5a8e2937) }, // -29447
+  { teju_literal4(0xc6c7536559effc29, 0x4e20c2c1dff95e73, 0x2e7145e324e06ac5, 0x55ebd9cf5925c216), teju_literal4(0xab4175be77c88412, 0x5686659b05c98cc8, 0xea150c5a9b6b7539, 0x3209f29a43bae7ed) }, // -29511
+  { teju_literal4(0xc4649f475e5e3c34, 0xa21525d2b5598787, 0x771221d3fef29cda, 0xd596d34d8d1965d1), teju_literal4(0x8217f6d7f61bdbb7, 0x451dbedac2dd524f, 0x64abf6403f691344, 0x606c4cfd53e86a8c) }, // -29575
+  { teju_literal4(0xdf8cf83a153a4c70, 0x7be574165cde2a31, 0x678886982bd131c6, 0xd5d39c5e4d7b23ae), teju_literal4(0xc5a66863beead1f8, 0x16f5b26472cb3079, 0x0e175a8112157d88, 0xe9c359d16714fce3) }, // -29639
+  { teju_literal4(0xbfae51336fc8ffbe, 0x5903058ab31931f3, 0x0fe228e0387e9fe1, 0x65aca8f771fd699e), teju_literal4(0x9624d944ce085e18, 0x9bf37945b7f60673, 0xffa74157d4c6715d, 0x0cb220a6e4e75d00) }, // -29703
+  { teju_literal4(0x0d2451f784f80fe9, 0x79948b47f66d501d, 0x8fdd7c997a880465, 0x47524aa3f8e1af44), teju_literal4(0xe41cc08bb27965b9, 0x65114b68e428cbfd, 0x81806bcddd97017d, 0xef6bc8a999591c88) }, // -29767
+  { teju_literal4(0x91da22f2afcffdad, 0x51afa2693880bd1f, 0xf5396a777ee52429, 0x4baa772b16058239), teju_literal4(0xad48d3458a312624, 0x44124520b09ab159, 0x87148fa6b5160daf, 0x28d45d14a9520909) }, // -29831
+  { teju_literal4(0x4d7a3898cd6f033b, 0xc2cd9cc634126b1e, 0x15b1561b9a1fdb6e, 0x7760b6298dbb4c86), teju_literal4(0x83a27f6ba3d3c9c4, 0x61cf3c50ff334201, 0x832cca77d5f3f5d0, 0xd0bcdb139d092ca4) }, // -29895
+  { teju_literal4(0x8ef2f6b1970fb354, 0x860847d2e5acfe36, 0x45286f799f0fb54b, 0x9203f50107623668), teju_literal4(0xc7fdd1a40dd297a0, 0x0e93f0218685729c, 0xa3de5020507ca92e, 0xde9f51fc9859b90b) }, // -29959
+  { teju_literal4(0xa682768d754c91c7, 0xd3f904921df82940, 0xba45bff9acc3efac, 0xd41696139ea3b49b), teju_literal4(0x97ec304a22fbc376, 0xe87d57f2f77d9945, 0x7f565e6a371bb494, 0x50b5e9cf192ac4f1) }, // -30023
+  { teju_literal4(0x477d5ec8f59b50c4, 0x7b8d5b2c67112d6d, 0x6f1ffc746fd4d497, 0x78d8aab5f8ee0689), teju_literal4(0xe6d08bc0aa8add35, 0x941cc0d0a629bd71, 0x3926d8fd875ff8d1, 0x56066e5d78b19cc2) }, // -30087
+  { teju_literal4(0xee6a55600a64f8ed, 0xb7f093d3798ef638, 0xea0f98a11c3fdb08, 0x53103a01ba821bfa), teju_literal4(0xaf5657df7c964f93, 0x2550ae8d9217b080, 0x7e9ecc51c7b14df7, 0x70b36fad457da9d5) }, // -30151
+  { teju_literal4(0x26790834df4e5266, 0x4a6d0941bde4b5e2, 0xc0b39ea6292903a2, 0xdcf49c9abee521e4), teju_literal4(0x8531b47eb0a4a830, 0x3dfcfab884656695, 0xe6d5f4c980e0e5ae, 0xae96766a366e1300) }, // -30215
+  { teju_literal4(0x11424c1eb8aa716c, 0xe3a9fbc36e851dd1, 0xdd595c1ee2572aa1, 0x445d3da669a20fa0), teju_literal4(0xca5c54b844bfe1e0, 0x0c9bf9859464f0d6, 0x9ec7639119455f7f, 0x60e34a8a922dbfe8) }, // -30279
+  { teju_literal4(0x09c3ab6a29e3d2bb, 0xe8a42df3730b61d3, 0x805345c84cb9e10f, 0xae6fb66240267312), teju_literal4(0x99b8ec37074638e8, 0xfce74d570b004fca, 0xc2bcc6e1fb62f645, 0xe33864e8db03b97c) }, // -30343
+  { teju_literal4(0x48b5a822d57f3bf0, 0xc880ce3f8f567b85, 0x2484a93e69850051, 0xaf4266b03957527d), teju_literal4(0xe98c88f48281133b, 0x2c1137d58bed1aeb, 0x4dd9e9003a778acf, 0xf5f43899a6d5767a) }, // -30407
+  { teju_literal4(0xf08c3ed98a5ec93a, 0x749261fa2e8f1f38, 0xb474cbbb7355d7cb, 0x8e569d0cae020fdf), teju_literal4(0xb16a1635048c13dc, 0xa920852773a278dc, 0xe855e164c79fefff, 0xcdf935378e987122) }, // -30471
+  { teju_literal4(0xe9290e7c0132636e, 0x3f1c4a05af4217a3, 0xdc6fe464f753bc4b, 0x09404d8ab9a47a1d), teju_literal4(0x86c5a43db7859de7, 0x201de47b23c5bd97, 0x9180fc34c8d74267, 0x99dc5de34ca1f8c5) }, // -30535
+  { teju_literal4(0x6b2ebb3da280cbe0, 0x12dee951016676b0, 0x3b2fcb0208a67a1b, 0x6b6d9dec41c85f39), teju_literal4(0xccc207294bd98eb6, 0xc111f64de4ca833f, 0x70deb38029aee974, 0x02c0f2ab1a585651) }, // -30599
+  { teju_literal4(0x1c99ebab9f324c78, 0x847a78467129b658, 0x9d677b347f7bca32, 0x1df1ab5b4bd452b3), teju_literal4(0x9b8b1d6755a3d28d, 0xa8e94b8f75372a2a, 0x45fe693f992f6dff, 0x84f1895022307f8a) }, // -30663
+  { teju_literal4(0x516cbd9a6fb84565, 0x00decd984aec2c8a, 0x115a142b0f133366, 0x70e089b8ed3a58d7), teju_literal4(0xec50d101cbfddaa9, 0x9067f447a6d2c28d, 0x69849a25837fd6f2, 0x791cbe429556430c) }, // -30727
+  { teju_literal4(0x81e0a2b8ee616d87, 0xb5f79060baee9afd, 0xbcde95a4968d6b15, 0xb068b18e6127e63f), teju_literal4(0xb38421276decff74, 0xf146defec973e1fa, 0x5d3994682cdeb292, 0x75315940a6e732f7) }, // -30791
+  { teju_literal4(0x13bda79b15811660, 0x208d09ea0c359bfe, 0x27e60fa5b9077a88, 0xc1339c8b82d0568d), teju_literal4(0x885e5d004fdc9516, 0xb3961ea62b3d477a, 0x5ce607506d964f71, 0x4262da91ccbcb699) }, // -30855
+  { teju_literal4(0xe685830e7058e207, 0xf91c9575d38628ae, 0x1c987c6b0b87d48d, 0x7272dc08f0701d77), teju_literal4(0xcf2efec15a3585e5, 0xb9565653aca7f389, 0x5c38f500769a954d, 0xc34e86351de03ef8) }, // -30919
+  { teju_literal4(0xc293f24bc12a207b, 0xc0c3fcb7f5e0e997, 0xf58530d0b94b318e, 0xbcdc9095cd3a2c4f), teju_literal4(0x9d62d4688546c565, 0xb244d59726e08cf3, 0x0fe68cdd05102580, 0x7d604e5a7c684eb1) }, // -30983
+  { teju_literal4(0x4d6196e02876a2ca, 0x6a5adfb36d964461, 0x14bb14b5a032159c, 0x6fef42c066a9c9ee), teju_literal4(0xef1d7d0e7854df88, 0x6edbe30d856f5460, 0x39bdb93c79dd8e46, 0x0323ba456f4cb69c) }, // -31047
+  { teju_literal4(0x58592d036a024026, 0x524b2f275edb1044, 0xde8d6c71dfb5dc14, 0xa6cc05dc3f3a9701), teju_literal4(0xb5a48bd14676771e, 0x9729d77d038357ea, 0xbfb9d4581f78a7b5, 0x122e6e21332b59fd) }, // -31111
+  { teju_literal4(0xfacc39721093216f, 0x2a612efd5e28826a, 0x38218dd0ed5d93f1, 0x63199841c93b6ae8), teju_literal4(0x89fbed498fdb41b4, 0xf82da2f906a014c2, 0x912074ea8e5c6d48, 0x23d4d17c260e8ead) }, // -31175
+  { teju_literal4(0x6db1b4e9a25cf6d9, 0xfb65e0b25e495ee1, 0xf7db38ee2e7a6a6e, 0x4a180c36c896fbb0), teju_literal4(0xd1a3518cbbe80de9, 0xe6c148892315fa42, 0x5bcd86fdee1e28e6, 0x85a27166c3ded514) }, // -31239
+  { teju_literal4(0x6db618c70083a432, 0xb681610a4c3adabb, 0x1a84e61b50999bfd, 0x303b59358b16159d), teju_literal4(0x9f4021fa404bf51d, 0x1ad92899735fdae6, 0xdee376b0138caee6, 0x08fbafd3c417862d) }, // -31303
+  { teju_literal4(0x9cd8caa0d6f1ab06, 0x83a296c6580a0766, 0x4ade7423e9ea2cb5, 0x3a0da5d01a0f07fb), teju_literal4(0xf1f2a68cbd217ff8, 0xefd1be7d97ed2f04, 0x25689f68c3b72f17, 0x104b89ce89546caf) }, // -31367
+  { teju_literal4(0xb9b5c7d4112ac7b7, 0x8acd336d728d5f34, 0x671fbd9e2b767bda, 0x284b36b8600ae531), teju_literal4(0xb7cb69870b6d887f, 0x5bf8ea9efb6e69f0, 0xd11b5cec12fb4ff8, 0x8541c15fc40b34a6) }, // -31431
+  { teju_literal4(0x8be9db4096e9ffcf, 0xfb9c9939515a4dee, 0xf15b8b8fea981fe8, 0xd66fc349740a7d9c), teju_literal4(0x8b9e63c89067820b, 0xdc06e8dfaf316cd2, 0xa808b4718eb33ed9, 0x8c96e8e83f74357d) }, // -31495
+  { teju_literal4(0x557213dafd0f995a, 0xfde8c62ccb10ede0, 0x5194502a6a1456d9, 0xebbbbefaf44cd93e), teju_literal4(0xd41f15da9a6bc868, 0x4064b74a63b6619b, 0x43d04c37ae8282db, 0x3975682de01330e2) }, // -31559
+  { teju_literal4(0xa0ee29b20749781f, 0x74c411840c2504cc, 0xf51cdb82d38d55d6, 0x2d90eda1c05f45b9), teju_literal4(0xa123170efbf7ca92, 0x4b9e55c5eccd6621, 0x1778933a3e076749, 0x4c35d147b0144dd3) }, // -31623
+  { teju_literal4(0x3faf1c7e98584178, 0x8a484df6ab696f95, 0x384b9803f3aca806, 0x5ea1a59f2154e03a), teju_literal4(0xf4d0673bfb91df9a, 0x711c2e9b8d952996, 0x6886586d05a62b78, 0x2c23eeee10e11bf8) }, // -31687
+  { teju_literal4(0xc600566332f86ab1, 0xafd5e4da9e6dd832, 0xba2d187861032929, 0xdde8f66b4a95e7d4), teju_literal4(0xb9f8cdd7d9525648, 0x884e406aef5c3e8a, 0x33a994f592248df3, 0x49a96fa5c8d81158) }, // -31751
+  { teju_literal4(0x1a2133cdb175cddc, 0x8daa2187a8637107, 0x5aa9c18ceecb2a61, 0x821bcf67454ec244), teju_literal4(0x8d45cf58f293c844, 0x0ad8eca69e372ba5, 0x4cb7e5457309fc43, 0x1abb6b3523b3c07a) }, // -31815
+  { teju_literal4(0x84431c583f952ec5, 0x7c16aec14cf7eba6, 0x324976fd69b24a85, 0x90d964079ab90773), teju_literal4(0xd6a2623dc76973a7, 0x6a3cb9fce1cde51a, 0xa5fafe3aa2e2be7a, 0x89093fa5b4a2f75e) }, // -31879
+  { teju_literal4(0x6de47aec9d2d44e9, 0xbcfd8a1b3957a4e8, 0xe00fba5ffc6448a2, 0x4b1a4f1b9a56d3eb), teju_literal4(0xa30bc4cc92c0badf, 0xc463b374152f749d, 0xd914c1d19c11b05e, 0xb16ce7938e23b334) }, // -31943
+  { teju_literal4(0x65b6a2aafaa07ab2, 0x84bf1493b2932197, 0xb93e1867c25a0f15, 0x64b9abec3619b985), teju_literal4(0xf7b6d929aa6f6bbb, 0x67fd6a04cc6a7d02, 0x3576255677a8ce12, 0x18493633e894dc7b) }, // -32007
+  { teju_literal4(0x38c1eb73e80af329, 0xdcab7e02823d4b58, 0x7da97456d2e6c9d7, 0xe193af2f0d75b2e3), teju_literal4(0xbc2ccc8e1da85cfc, 0x9ca9c809d36a5ca3, 0xad76fd98112d2902, 0xd9232ed137095128) }, // -32071
+  { teju_literal4(0x7ef5c3518a4e7edc, 0x6307a86a6a7c238f, 0x0a1bf7623157f6ce, 0x1ae241aeda19fcbe), teju_literal4(0x8ef23f0366ac4a1d, 0x9e6d71c364fcc3f5, 0xd4116c341649ffd0, 0xb117e39d2b00df10) }, // -32135
+  { teju_literal4(0x41806319385c03fd, 0xeb1e839248ddf9f4, 0xedaafe924a873196, 0xf0e574443424c63c), teju_literal4(0xd92d4d8d89e6a443, 0xa2cfb66200fcadc9, 0xb4fa9fa73d3230c3, 0x263b028904c66396) }, // -32199
+  { teju_literal4(0x55c0b68d3ca61c4b, 0x6dea0e084e246db0, 0x3596e8e8cfb758c8, 0x04f05264e89f45dd), teju_literal4(0xa4fa3c8ce02cf711, 0x7a12510252cb59d1, 0x50de74d5eb79bbe1, 0x9243482c05837cb1) }, // -32263
+  { teju_literal4(0x2370a6d5c68192ac, 0x7f0d90af33c5b193, 0xa2ea71056c566732, 0x7e874b513bfb0ecd), teju_literal4(0xfaa616b242ed1f96, 0xca88edd378463d7e, 0xaf240623d81434c7, 0xa149340430422c7c) }, // -32327
+  { teju_literal4(0x4ca7f6ff83bafc23, 0x4013805355b0a8f8, 0x5fceb6914f3ace48, 0x2c3c658f6456cae8), teju_literal4(0xbe6779b04ad9e047, 0x45cd1b4acb4d4f08, 0x924dbbebb56c6f68, 0x264508a930675469) }, // -32391
+  { teju_literal4(0xdcbb305e1ae47241, 0xc0b52dc0efcd986f, 0xde76d8b6fc43787c, 0x576c6f7c1cdbd502), teju_literal4(0x90a3c1fe34ddc264, 0x90e2790819b7bafd, 0x716cdba83c966c13, 0xe51ff7839421e160) }, // -32455
+  { teju_literal4(0xfefca5a432049fc9, 0x40ff946e90bbb490, 0x0dab2e54404a69e1, 0xa1c181590f3e8894), teju_literal4(0xdbbfeee66de2c020, 0x0093225f999f3729, 0x396060f58e35736b, 0x93eba61d8e2fc052) }, // -32519
+  { teju_literal4(0x5766d45e2eba8fc3, 0xf89a74d6170da8a8, 0x4c3781e19a677bc7, 0x060e8a1a80152ef2), teju_literal4(0xa6ee8fde5e88cd45, 0x4de4a3565e78bde3, 0xa844c4ca3a69c2b8, 0xc656fe1d74c57a9d) }, // -32583
+  { teju_literal4(0xfd6f1470b26ec3dc, 0x0c976f3d59e5ada0, 0x020368b9290f82f2, 0xc76e5b71492e5533), teju_literal4(0xfd9e3a823043f111, 0xab7e14a54e4b44f1, 0xd39fc69508aa4535, 0x78b3da9c78bdb725) }, // -32647
+  { teju_literal4(0x088a96abe32f320c, 0x197165e68d28b5fb, 0x7e9cf6077d0ffbeb, 0x0eaff798aea94ad1), teju_literal4(0xc0a8e9818e3ce401, 0x39ed5771e18942a4, 0x055a821ac9da21c4, 0x922ddd6b6af7b751) }, // -32711
+  { teju_literal4(0x6a0f1445572760e9, 0x9f5fbf50ce7f10b2, 0xa6aea8af367e076b, 0x43b92e3b7bda9ac2), teju_literal4(0x925a67adc77a9e39, 0x9b8ec8dfc5ffc66e, 0x33c08f07e30d7fa4, 0x385a7e63835662db) }, // -32775
+  { teju_literal4(0x4b9b3125aeac0159, 0x7c6827f225d8029d, 0xd9b00df8899b51d8, 0x08fe14324c43af60), teju_literal4(0xde5a5dab166999b0, 0x08d072943793104a, 0xa2be5ceebafde6b4, 0xe709a497718816f6) }, // -32839
+  { teju_literal4(0x1322a23387933fcd, 0x267d37f742e35056, 0x2e145a89ae5b466c, 0xd139980096778093), teju_literal4(0xa8e8d084c67b54be, 0x9645dcdc1ab18968, 0x14cfa343a2e3fff9, 0xcee573150690500b) }, // -32903
+  { teju_literal4(0x54ced5a92b52c548, 0xe2cdbb399312641f, 0x8a2f1183efae79a6, 0xc2be3761ff1010bb), teju_literal4(0x804fafcb6112f3f6, 0x35b76c71318214c1, 0x729e3c37a6441616, 0xf334dc2f939301d3) }, // -32967
+  { teju_literal4(0xeca948364f4414e2, 0xa8fd64df2447514c, 0x32c1dc4e3cd6f202, 0x7fc0fb7b00e4c010), teju_literal4(0xc2f1308288402758, 0x63e765c1bf529f51, 0xa040510f64f86065, 0xd1fd8258f657d3b9) }, // -33031
+  { teju_literal4(0x00e2fde8bdb9b388, 0xb096fdf915fcbfb9, 0x9816374255791434, 0x2e568c10aac8a36d), teju_literal4(0x94163fa536e37eff, 0x11db7b0b17e7d7c3, 0x8c0d0c45865fc5c4, 0x6558bd4a28ed7a52) }, // -33095
+  { teju_literal4(0xc263a47c4979573e, 0x3bcd6be9e619b18a, 0xa43585be61f90411, 0xa73e5c3267d8b807), teju_literal4(0xe0fcb1851223210f, 0xab11a2660cc24c62, 0xd18f0364f8ae1cda, 0x042c3992d033f1e0) }, // -33159
+  { teju_literal4(0x786159d8af817621, 0xcd7baf37e8ca043d, 0x9486165759ebd302, 0xc31e26c421cf27af), teju_literal4(0xaae91079b07f0f70, 0x266afae6d577c9dd, 0xa76389f5437b3c62, 0xa695de32ab083532) }, // -33223
+  { teju_literal4(0xbae7e3e37b73757c, 0x5c7f830500a54c91, 0x55a8fd6e2d23a8b8, 0xae7a7d841b834b1e), teju_literal4(0x81d4d09f91083d93, 0xf72560361298d5ed, 0xe291cc7be82ce000, 0x2b4fca5f155c76a8) }, // -33287
+  { teju_literal4(0x555594b6aa78d724, 0xaf961f1722007b37, 0x8b46925079a66b42, 0xbeeb8521da0a172a), teju_literal4(0xc540637206c6ac2e, 0x4034470df358edc0, 0xd8dc00f8ee1f8cdc, 0x538436cbf62f6ec1) }, // -33351
+  { teju_literal4(0xcbb06b5127def630, 0xc580c23305dc3208, 0x79c0ce7d2275dfd9, 0x76f753937d2c2041), teju_literal4(0x95d759a6d718089c, 0xcba70cdec7116fb1, 0xe72b036fc9ec196d, 0x3be2cc9d54021b3f) }, // -33415
+  { teju_literal4(0xa2802572381379b7, 0xd93fdc97bd301aec, 0xabe05f0c1d0a2742, 0xfce9756add6713b1), teju_literal4(0xe3a70265b267b6fe, 0x79814e9ce7af3c93, 0x5e60b60006df759d, 0xc446cd0dd348efe8) }, // -33479
+  { teju_literal4(0x9ab11cd66899c420, 0xb344d315e6c123bb, 0xe712ed3953edc6b0, 0xa2e0c919d1de71bc), teju_literal4(0xacef61ed38443caf, 0x3691d09ecf033866, 0x1d02c848c4b03383, 0x11c830417aaa20b2) }, // -33543
+  { teju_literal4(0x7e67e14dbc31b454, 0xebca0797ccddf2ff, 0xd9b0d3804b08b040, 0x72820ff819e7f9ad), teju_literal4(0x835e8d8ea5c3753d, 0x47dcc8a297cd7cad, 0x794270054344e996, 0xe76d49fecb3578d1) }, // -33607
+  { teju_literal4(0xa78918f039d4935c, 0x96fabe1a2a7f446d, 0x499a241e70b4f280, 0x9eef36921736b719), teju_literal4(0xc796974dc1b86893, 0x3e6c7f25e59c563d, 0x34d575585302a1bc, 0x659eb1a70c71d2d5) }, // -33671
+  { teju_literal4(0x0d2380af39523bb6, 0xfb7d7945fb45a870, 0x3f29e4d6a4ed0576, 0xee96f85fad67f469), teju_literal4(0x979dc5a4c6f502de, 0xde2e4def0130a02c, 0x92285469f535bc37, 0xc40e31f7d1961b68) }, // -33735
+  { teju_literal4(0xa1535057bbb390d7, 0xae140c53c9c82476, 0xb8b05196d069ad16, 0xc8e0691bb154f771), teju_literal4(0xe6596886e4e0c4b6, 0x5dc339f3837caafa, 0x03b9a44288820642, 0x83c328ca20810bd7) }, // -33799
+  { teju_literal4(0xbb1ceb6b896f2cae, 0x5a7da60c50566070, 0x829647df0d59bc31, 0xc3c86573c85db4fa), teju_literal4(0xaefbd746a202aa24, 0xa057ab0253c8344b, 0x508e54d4de36c343, 0x2167e26c2d9ea26a) }, // -33863
+  { teju_literal4(0x8ee415475b728da1, 0x9e359720dcfd7b85, 0xbf59ca6de4b99def, 0xfcb9df6270ce0718), teju_literal4(0x84ecf493839eb20d, 0x842ffccc0d496148, 0xcafa81e6fb250be3, 0x32ec958b38f91028) }, // -33927
+  { teju_literal4(0xd0a922d6c281701c, 0x716adfee4812348b, 0x3f6ef5177513df26, 0x1873288cb1a244cd), teju_literal4(0xc9f3e15319ced457, 0x0dfea32f50c42342, 0x8fe6f1444b1ac6c1, 0xeb97ac7427f9331d) }, // -33991
+  { teju_literal4(0x38b0eb36d45bb3eb, 0xd1f35a438e191f74, 0x6cccfc8d559113db, 0xceefbb13325f0b35), teju_literal4(0x996993c18124e3f1, 0x3df409b3750fde7c, 0x8b795428fc684bed, 0xcc9fbfb60b1bbfd5) }, // -34055
+  { teju_literal4(0xc4b2984065c83614, 0xf96d474a3cf489c4, 0x9772b96eaa9effd6, 0xc82c60932487f8d2), teju_literal4(0xe913fc6c0fbd52be, 0xdaa274e74cc214b8, 0xe0a37965dc0d9dae, 0xd80e99ae261156f3) }, // -34119
+  { teju_literal4(0x92becb4bf6783d9e, 0xaaf94f87befb97c1, 0xbacd6f049264509a, 0x35564e9061b9279b), teju_literal4(0xb10e832501c0e1a9, 0xaed3ac29938e6862, 0x233289c814ed3943, 0x5c31e69c31c87d1f) }, // -34183
+  { teju_literal4(0x3f7905c8c20a2e47, 0xb5084fab69523ffd, 0x58ed4807f9e10bec, 0x0c81aafaa6ae40eb), teju_literal4(0x868013d3749ef0f1, 0x0526b4cafdd777ea, 0xfc5313255b5fbfdf, 0xd4914f8758d97374) }, // -34247
+  { teju_literal4(0xb0c2901f7a9d8727, 0x6e28c1899082a56d, 0x210206a3c81ddae1, 0x9d9d2d3bb107d684), teju_literal4(0xcc5856ffd9a418f3, 0xabbaea78c9464597, 0xd154eab7aa1ccf44, 0x23bd5b44085f8487) }, // -34311
+  { teju_literal4(0x2e55bf758c24d767, 0x1fd8e8b4c60438ce, 0xd532546e44b2905b, 0xd68e05fb0d269ed4), teju_literal4(0x9b3ad4506ec7e966, 0xfa3fff310d144756, 0x92d50da9d5bc6ff0, 0x372ffd218a362aed) }, // -34375
+  { teju_literal4(0x53cc8491da54fc06, 0x5ad6c2d2b57e8982, 0xf8fa902a02adab56, 0x190c76411b687b77), teju_literal4(0xebd6d6e2f082704c, 0xf80c6781b1c1a4b6, 0x1454243532e1d9c5, 0x0acb32ff6c121424) }, // -34439
+  { teju_literal4(0xfe1bb7d11b4822ba, 0x89afd2eb2956d90d, 0x673ece5317a60028, 0xd0e7bfd06b501ffc), teju_literal4(0xb327785fe496a48a, 0xe8fa10fc5548ff47, 0xf278e8fad3456f90, 0xf6881142c3d68565) }, // -34503
+  { teju_literal4(0x961ec0578724aca3, 0x102c61becb6b117f, 0xb97e98de05f17078, 0x44f6742e5cd8ef82), teju_literal4(0x8817f99ea907e1e7, 0x7f30e37c991ce234, 0x0b4fc84c15cf688b, 0x005e3a75fa8e0073) }, // -34567
+  { teju_literal4(0xa587a9589ab32939, 0x740044b4e2533f8c, 0xb32a75e7c39f5498, 0x9a91523ae71ba387), teju_literal4(0xcec40e12f90bbea4, 0x888b347e5f8a9405, 0x51a1b11468342c4c, 0xad02d47d6a8f60a2) }, // -34631
+  { teju_literal4(0x54368ee639e264f8, 0x97a37970e22a571c, 0x551822c56117beef, 0xda97035e6eb599de), teju_literal4(0x9d1197d67bd8f4d7, 0x1fc36d82d4261a7f, 0x3ad158550eac4888, 0x9a44a0dcf872dca5) }, // -34695
+  { teju_literal4(0x6c77a552e1493567, 0x0be4d95884f3de95, 0x51340d0b5d4fc065, 0x1a92fdb0de040b05), teju_literal4(0xeea211047d7f5476, 0x152c2cffcf2a9204, 0xabb228cee81539eb, 0x3aa3425d585c7607) }, // -34759
+  { teju_literal4(0x87bbd4a0fab43344, 0x6a50cd4821550ee6, 0xe56db77f260eeb76, 0x8bf0cdfc06cd3f14), teju_literal4(0xb546ca07fbf0b6ae, 0x6013954ec888dec4, 0x46195646fd32484f, 0x6aea2c6262d32ea1) }, // -34823
+  { teju_literal4(0x1c994ecf28a5d8d0, 0xe1e150715b6adcc8, 0x365f7a4865faf89d, 0xe54071e7e2451b77), teju_literal4(0x89b4b470b975a4ac, 0xfaa3fc8d56e7e76f, 0x960b5bd621474ba3, 0x319fb0398dba07a6) }, // -34887
+  { teju_literal4(0x4da8fa6c36b0704a, 0xecf1a0b1ee97b77b, 0x066c3af5704abce9, 0x7f15a8bd603197db), teju_literal4(0xd1371c8d62bbc644, 0xf2dab6194d593acb, 0x25bff9a3fb016308, 0x84ba98785c15a0ee) }, // -34951
+  { teju_literal4(0x913e83f6160e59a6, 0x7e0e4d8c832f2b17, 0x45d057f08b33685a, 0x229a78de4bd827f3), teju_literal4(0x9eedef0aad5470e4, 0x01992231a3368c8e, 0x0b4042bdca055ab9, 0x9de7f4066535ac2d) }, // -35015
+  { teju_literal4(0x5e3680dc66ae14dc, 0x1d935b43cae17b66, 0x0f9dede634591395, 0xc68e5093d3f42d5f), teju_literal4(0xf175c435c9ed3a79, 0xe39e8e51e5038c30, 0xf87580405db69cce, 0xa55a496784ab0c4d) }, // -35079
+  { teju_literal4(0x1a896dd47018df5f, 0x49e5bbc765ec9993, 0xf11a0f49b2c35129, 0xd327a3dcf7c35083), teju_literal4(0xb76c8b67cadc0e54, 0xcf802572f3842c61, 0xc7dd188c1bb08ad4, 0xb4cdc54ea644db14) }, // -35143
+  { teju_literal4(0xa411e329cec304d0, 0xf0469447280368c2, 0x2eb55ca42f47b317, 0xdf41436cabdd1ca2), teju_literal4(0x8b5652f12a811356, 0xc2b6d88320333ffc, 0xab78c828958253cd, 0x9e29847aa02ecb71) }, // -35207
+  { teju_literal4(0x4356e607abbe9895, 0x25e7a0e4a678164d, 0xaddc3c494fb5ce3e, 0x0324d41b059ceb51), teju_literal4(0xd3b198b2bc4d3499, 0xc8c736901ef28c17, 0xfaac6332ea9cb750, 0x091c236475c40256) }, // -35271
+  { teju_literal4(0x68244fa9e90098a4, 0xde30954ed55f20a8, 0x3ac6739fa15d4330, 0x2ebf1638cc4f9353), teju_literal4(0xa0cfead6b926937c, 0x3dbabaacc1b7f125, 0xdeeb530aa67fabf2, 0xd50e9457dc28891b) }, // -35335
+  { teju_literal4(0x78d792a962d97f82, 0xe906a3ae73d46317, 0x9790a108a0e9876e, 0x390ac91173bf48ec), teju_literal4(0xf4520a28ecc312ae, 0x98b890bf403a1db3, 0x6f2357db70d7090e, 0x9c6fc8df0015fe29) }, // -35399
+  { teju_literal4(0x5c44bb1163b3080a, 0xa0be5f0309c98612, 0x393f18f1477f9d16, 0xebf0e2e17e3c89aa), teju_literal4(0xb998d004555e8f9d, 0xe437958a3d01aa2a, 0x36d99956c0d17012, 0xbd3632fa554044d2) }, // -35463
+  { teju_literal4(0x6c4e08fb5c9827f8, 0x3894e4a46ebc81bb, 0xbdca81a00ee877d3, 0xa5fe079b713a11e0), teju_literal4(0x8cfce3f3f1f34773, 0xf7ecdf2dfd00f9b5, 0xdc05527fcf9eb1a2, 0xe071d260575abf72) }, // -35527
+  { teju_literal4(0x81d500fbd0019324, 0xe45af15cea102b93, 0xd919a840e1dcbf28, 0xa5ae0ee8f376caea), teju_literal4(0xd633990a309b28f3, 0x20694a8f9f8ea4d4, 0x3bd32c6e6c81a5e6, 0x298f80a168a147c9) }, // -35591
+  { teju_literal4(0xfd85657129740ce9, 0x007acc6aa9e708fe, 0x8d5d32681bb3a143, 0x01abdeb1ee0f7c34), teju_literal4(0xa2b79c579fe6624f, 0xdd6228a076698f3f, 0xee92b602ed40a24f, 0x868fc953a238813c) }, // -35655
+  { teju_literal4(0x61c12e9ebba1a8e9, 0x35f607a838d28ea6, 0xc90d9e63d4c2e71d, 0xf8304ce2b3e6b208), teju_literal4(0xf736fcddea453a2a, 0xcb627e3ac4c94daa, 0xb8606a829e5d444e, 0x521c1dabd335df20) }, // -35719
+  { teju_literal4(0x6d0c21ff5a235379, 0x4e9bb41d927f4f50, 0xd1fd59b8fbbd77b0, 0x8d62bdbeb3bfcf4e), teju_literal4(0xbbcbab9dd1e38da0, 0xf926292ca192370d, 0x92dfe9217cbf235a, 0xeb89f6e02084f49d) }, // -35783
+  { teju_literal4(0x459d183feffbb4d6, 0xbba7c6a1fd7cc85a, 0x0b5a8d63c0fdbcc3, 0x2838013a2d4b7ec9), teju_literal4(0x8ea87679fd8d146e, 0x3f4a3fa57798f2ab, 0x06a746a5fb8a3521, 0x75a75d72abb58e74) }, // -35847
+  { teju_literal4(0xc439088a44a960bf, 0x629f7b9691260e3f, 0x4621369c8ecf6963, 0xec11601ebfdf0bb6), teju_literal4(0xd8bd345f3c87ae9b, 0xc6c6fb9db2afec03, 0x912c3cb5e37b63a7, 0x6bc92aeb383c8891) }, // -35911
+  { teju_literal4(0x4cbdb668d422b30f, 0xcaa7fa9d2d001c02, 0x94c55a0c3767815b, 0xa92b663ad671ee0b), teju_literal4(0xa4a514de4862eed0, 0x059b74f9bc19d366, 0xccd2c4083ac3a01a, 0xf1ffdd06e2cb6d11) }, // -35975
+  { teju_literal4(0x671e9759dfc9fcff, 0x217e217e46369b77, 0xdc7915030d6e2eeb, 0xeebe811aa4b7469b), teju_literal4(0xfa24b6a3a0598423, 0x5d5e34de156fba15, 0xa1fcc47910993337, 0x93f91f6e671dcaac) }, // -36039
+  { teju_literal4(0x69f15d44bf36b6e0, 0x27d546f84257a445, 0x6b7082720ecf8ff8, 0x346a9e0f7c6b6de3), teju_literal4(0xbe0532305cc25dcd, 0x2339a6ebc86fc18d, 0x7970ca0c1c9fdee9, 0x5e7980891e8eb433) }, // -36103
+  { teju_literal4(0x3dcd32af73b1f522, 0x4c32db69b1eddd71, 0xc85a772b28bca33a, 0x9134510d1675d2bd), teju_literal4(0x905919b1bb67403e, 0xd118d2a8c0b07879, 0x443d9d62e39e35e0, 0x33a7167011572146) }, // -36167
+  { teju_literal4(0xb1a75d1388d876e9, 0x07418055de6bc1ef, 0x837b167ea29f9489, 0x30778c60f5176914), teju_literal4(0xdb4e81c27e2d8e56, 0xf91d26f1c2c9bf78, 0x68353ab91cc548a1, 0x85d46e08c5cccb16) }, // -36231
+  { teju_literal4(0x566635ae9a89e388, 0x1a988cb926cacbc0, 0x9c922b667f474929, 0xa056f9eb2a9a0976), teju_literal4(0xa69865f01d084f9d, 0x5d3ada6ff70b139d, 0xd67e602fd15b22e6, 0x2e753f810010b33a) }, // -36295
+  { teju_literal4(0xcbd5ae0f21f78260, 0xb91c985be2c38a55, 0xc7d243e582479352, 0x60dc8ab2501d5bcb), teju_literal4(0xfd1b5218b5a7f91a, 0x17dd3add645cfc31, 0xc4896a58c8e89236, 0xeeaf5e18c44093b9) }, // -36359
+  { teju_literal4(0x8ae5e750e1a0eb02, 0x742dcf21d1f3fcbf, 0x4de79b7e9eda0337, 0x8eea7c2a4ba777ca), teju_literal4(0xc04577f4ade55d5e, 0x385538cc64c09705, 0x8d1d5c61d038ca05, 0x76ff456d7e87ce56) }, // -36423
+  { teju_literal4(0x8813046d4503c711, 0xd58376878b6228b0, 0x51d98247fc321d85, 0x1699aef1e3dca9cb), teju_literal4(0x920edcf7a3f0520f, 0x72d69e20ffe8891f, 0x3496c84c1a90fb39, 0xdae411b542e6969b) }, // -36487
+  { teju_literal4(0x824233820ebe8441, 0x121836a09df02158, 0xfa003ed0514b6b57, 0xc9221e8eeaa91248), teju_literal4(0xdde7988a86867b39, 0x55299eabbf591f65, 0x1b1dd0fe917bc9bb, 0xfe28eb2ec82f2fd7) }, // -36551
+  { teju_literal4(0xc4e12ceb0801e73c, 0x3227c8e16763dd17, 0x3bc014565013f117, 0xc5b5a6d993396d69), teju_literal4(0xa891a147ab21ee09, 0x31f539106f4e533b, 0xa286c125a62beffe, 0xa110a06fbcb30c71) }, // -36615
+  { teju_literal4(0x59cf66ee9bdb984e, 0x88e96f62f0690901, 0x850a42a3f916fe72, 0xb913a5104511934a), teju_literal4(0x800d751645c864b6, 0x18d54135154101a4, 0xa6294c8d5461b319, 0xfa502ccdefe00185) }, // -36679
+  { teju_literal4(0x0f29e207d1fbf728, 0xeb9539a842b6573d, 0xb45dc959dc048504, 0x284245b453655d99), teju_literal4(0xc28c9160d097dc09, 0x3d15a35946a1685e, 0x9e1906ad2102b8ba, 0x0ee79a4f2bc08e69) }, // -36743
+  { teju_literal4(0x3cd3365b5bbbdc54, 0x9101188f8ce71580, 0x09b00019f7381fc7, 0xbf5830e8eabed200), teju_literal4(0x93c9cfd6c58cdd0e, 0x3405fb58ca2762af, 0x627bccc86a9f49e0, 0x1f27a45aee86e281) }, // -36807
+  { teju_literal4(0xa8b090cc7bcfc3e7, 0xf635dc8f90064587, 0x3fe023efede7d398, 0xe69b98205c62f2d1), teju_literal4(0xe0889054ad8d0c79, 0x746d73a768d7add5, 0xaafb4120772317a7, 0xee0f0ce4ffa5b184) }, // -36871
+  { teju_literal4(0xa8b8c4f1356b928f, 0xce7a546ac715b8a2, 0x0e49940692d0e51e, 0x0311b6f48e7dd892), teju_literal4(0xaa90d8d543ffcf40, 0x16bb821add21ec2f, 0x2e9854ce2e8fd4a4, 0xd97af4a0c10496cb) }, // -36935
+  { teju_literal4(0x370977c15ac67a6e, 0x38fcc6109f247b97, 0xe8a3cdc5fcb3fa56, 0x876e3b2f5e4d5b2f), teju_literal4(0x8191cd1019800547, 0xd81597d1849364fe, 0x780e00bfc8734a67, 0x4cef3323c9c154b4) }, // -36999
+  { teju_literal4(0xa382c6abd040b227, 0x51a427935dba9de4, 0x62b792f17a4a1c43, 0xa9066bf690ea7c2a), teju_literal4(0xc4da9328dd817292, 0x060a398310f7202e, 0x3efbfcfa71fd7f7d, 0xc39468f4f7d0aa9f) }, // -37063
+  { teju_literal4(0x8aa1d43003dc5797, 0xb5d15546920d15ad, 0x302ae73eee63ebb6, 0x5ba5b011f0eaa152), teju_literal4(0x958a020951df3c96, 0x9a7e585ccbff85a2, 0x4ef1eacb4fd0aabe, 0xb6ae034879997e9a) }, // -37127
+  { teju_literal4(0x4c19b414c239be65, 0x0194f6159c010947, 0x5a3ee90d8825b0e0, 0x66d72c80544dab6f), teju_literal4(0xe3318105e8e20c67, 0xc6c6497fa7d336d5, 0xccf9e195cce12001, 0x498a2cdd5cdb941b) }, // -37191
+  { teju_literal4(0xcedf155511940715, 0x73668aa53e2151a6, 0xa52bcac52473f8f6, 0xa53ed6a5309edf87), teju_literal4(0xac961ebfa00491da, 0xcbc1aee6f23eba45, 0x46f9a0537e12576d, 0x4264e264e8d10df8) }, // -37255
+  { teju_literal4(0xd49903c8d9d736f0, 0x51ab6b4464fa84ab, 0x67e4c1079e7b3438, 0x1794de584f35f3e6), teju_literal4(0x831abec3b213f82e, 0x33126338d787e610, 0xa8fc3c5437a5b9ad, 0x3f2abf5ddad5fa02) }, // -37319
+  { teju_literal4(0x8b66c907cccbe7e1, 0x83cbade7650637c1, 0x4bce5ce6fd591e7b, 0xc238fefd25ba4706), teju_literal4(0xc72f923fb6d55fc6, 0x8b941507a8d6ecd4, 0x0c79f0f8d22fd82a, 0xeb50d2f39284228e) }, // -37383
+  { teju_literal4(0xea64dc39b528f570, 0xf71611502dda5e71, 0x46a37add16645ebf, 0xff645498fa83daed), teju_literal4(0x974f83792cbbc5db, 0xcf9a76bd8d33b18b, 0x9ea26239f08e660a, 0xfb27f750347427a2) }, // -37447
+  { teju_literal4(0x2266a4484e0edf68, 0x629961ba1e76b4dc, 0x9e866dbefbb2d015, 0x61e4031b6488c81f), teju_literal4(0xe5e282cba4fcbb94, 0xd770b732344e884b, 0xa3a2518dfaecfa97, 0x3f5d05c9386db155) }, // -37511
+  { teju_literal4(0xded60f91abf3aa7b, 0xc75fad163b39c11d, 0x041adf924c801dfe, 0xcd32a81f36769e5b), teju_literal4(0xaea1856483a1e9ec, 0x58a6edf641b2e4bd, 0xcd3402759d4da724, 0xaef41c988a16145f) }, // -37575
+  { teju_literal4(0x088dcc384542d5d1, 0x2a881a49d9322bbe, 0xed193eebcbc37055, 0x60738d0d55e1e5f9), teju_literal4(0x84a85824bc95270d, 0x142fb2b1f26196a5, 0x8983fa9c94b826bd, 0x6521692f359485dd) }, // -37639
+  { teju_literal4(0xcad1458a38222be0, 0xb25d294453c71e00, 0x2fd0dd5f3be74b5e, 0x35c286e5f7d1ee88), teju_literal4(0xc98ba3d7c6bc9a63, 0x27e2627a23105f24, 0x6a36a283dcda4578, 0x82173d527c50741c) }, // -37703
+  { teju_literal4(0xcfe573450ee8e871, 0xaad418bd0911652d, 0x841f264eaf5199f1, 0x06894b1dbbbc5555), teju_literal4(0x991a64407cce8275, 0xdcde84b684ee1c32, 0xadc558b4915d65f0, 0x10150d5e00bc1854) }, // -37767
+  { teju_literal4(0x312bbaf1aee9a64e, 0xe21b1759657447ac, 0xc5b20fe012979648, 0x0435cdd75c8a760b), teju_literal4(0xe89bae1ca0edbe4a, 0x04244c642b7278fc, 0x1a309e15ce681154, 0xe9c9f113c0eccfd9) }, // -37831
+  { teju_literal4(0x84dab1fad38bf31b, 0x4c3f924cc2888926, 0xc24db1cca45acc86, 0xef7c84b76a69961e), teju_literal4(0xb0b31f5966497732, 0xf8bf760e036bd6af, 0x256e48bd7a5f3751, 0x2d7afa5ff83cc704) }, // -37895
+  { teju_literal4(0x0330493e1dd502a7, 0x17c63b2898e1706b, 0x15b938029e58fb6d, 0x2c36bd1d787e6c93), teju_literal4(0x863aa75135dd22dd, 0x4c3fe6ddb7f3b32e, 0x9e4e1ed8fc3d31c2, 0x635178c0f20decd5) }, // -37959
+  { teju_literal4(0xc499aa1d5762ea99, 0xfbbc572aac9d7716, 0x3a565a49726a4cfd, 0xecb89e500a46e173), teju_literal4(0xcbeedd63c0015aa6, 0x6a87712f3133fb7a, 0x2d07a6aa499c9561, 0x8dcd903af08e5867) }, // -38023
+  { teju_literal4(0x7d9aef19dd9130f5, 0x7349e8642262dd85, 0xf7661a189bdbe623, 0xe8ca100d2d537724), teju_literal4(0x9aeab4aa3df79698, 0xa6b489335392dae2, 0x892f8ffb931dac0b, 0x4d9d327f24a39af6) }, // -38087
+  { teju_literal4(0x277970f5d2af290f, 0x3c8f7294c495e700, 0x0f9692058108819a, 0xb9f47e7422ac7c08), teju_literal4(0xeb5d1bb9ccbc81db, 0xa29955a65dea559f, 0x1a6c02971e3b0ead, 0x1775c842bedc9ff3) }, // -38151
+  { teju_literal4(0x4bf5c395372bc088, 0x6df23b55d969fbda, 0x952af466e3fa6c64, 0x70196e90beaf2a85), teju_literal4(0xb2caff6c1b57e2d5, 0x701fb8fa467f9213, 0x9bfe1259bb91eeb0, 0x1268deed76b3a63d) }, // -38215
+  { teju_literal4(0xf2f542c53d13461c, 0xada4bef37ac4b458, 0x635dae542883216a, 0x98aaf34b206ad495), teju_literal4(0x87d1ba91eadf9351, 0x4a26aa8a295fbb68, 0x5678db431a20f188, 0xd463f3c881b5b70f) }, // -38279
+  { teju_literal4(0x1806a40d58323bfb, 0x7939677850375fd3, 0x0b8583c00e79dbc2, 0xc8fcd3bc1fb0a7f3), teju_literal4(0xce5954976102f2dc, 0x15162fecc269d5d3, 0x790dfc97518c9110, 0xdae44e980b31242e) }, // -38343
+  { teju_literal4(0x950335a5c30b3cdf, 0x486ef016dd97ab70, 0x17068d009863a285, 0x351e58dc1d610474), teju_literal4(0x9cc08532d563854e, 0xa292c143738b165e, 0x9b489130389b8a32, 0x0dd49d3a32985f3b) }, // -38407
+  { teju_literal4(0xf2a1d888e9fb984d, 0xe0a1c35a1831c085, 0xfc78abdcf13667c0, 0xa365a34a63c4c5c9), teju_literal4(0xee26e4af2a66ff05, 0x71fb7fdaedca7190, 0xdd2a1dfd9ca485de, 0x09452db171bda928) }, // -38471
+  { teju_literal4(0x0b65efae74141949, 0x81cc31d2c61afda9, 0x582ea89f57f7dd59, 0xeb3d99b973963dc0), teju_literal4(0xb4e938a37d004410, 0x3737534045eb175a, 0x2f8cd41f93151686, 0xc2d8465cfeeaec2b) }, // -38535
+  { teju_literal4(0xcf40c2774e7fa56e, 0xd91de6657fd82e9a, 0xa5aaea8f3f2ee520, 0xe78c08287f2e6245), teju_literal4(0x896da05afa80cc5b, 0x702c97a30042068e, 0xc9fc0119e0b5336d, 0x9edf88341544f29e) }, // -38599
+  { teju_literal4(0x661114fdd44dabc7, 0x2c27adde681ac0d7, 0xdb8f63b053bd65f4, 0x4c07c5c399c3e963), teju_literal4(0xd0cb1f6838f8e2e5, 0xea78e0ba3e2c6c20, 0xc589a5366d4e39ae, 0xf92451b21f164a7b) }, // -38663
+  { teju_literal4(0x9fbd867ea4d0cf6d, 0xe178e8eac85f4c5b, 0x8e8c2fc05b98607b, 0xe95fecd6e2e85234), teju_literal4(0x9e9be688a76494d3, 0xd0d87a60cf51dd4f, 0x2669682c5eafff5d, 0x8f78f32fccca3954) }, // -38727
+  { teju_literal4(0xbc987a1a1062715e, 0x2f585f8d2284cec9, 0x2641e2ad8ea48524, 0xaf49bdc5a2dc89c0), teju_literal4(0xf0f92254b18bd673, 0xdaaa454802e4df03, 0x6b8eec3b431155c4, 0x0d00bd6666289814) }, // -38791
+  { teju_literal4(0x778330c6e1f16e18, 0x7d66a6484d8b45bc, 0x30f1b47b5da0fe00, 0xe1405440b1b73bb9), teju_literal4(0xb70dde40193ddd66, 0x45eca02ceb9f8fcd, 0x7efeaa47eb88cee1, 0x9a7a108af056b9a7) }, // -38855
+  { teju_literal4(0xb667e3babc90541f, 0x32718920b1a97262, 0x3378972d3ba7093c, 0x1ef63213c834c822), teju_literal4(0x8b0e674c58f62601, 0x00724174ba38e00b, 0x1bd0e05627ef1690, 0xf28301cd7ec81f65) }, // -38919
+  { teju_literal4(0xd625a0656d8fd5b0, 0x9c8efa6db2d265a7, 0x15c399e6f8843ae2, 0xca6acdf4b60edc3e), teju_literal4(0xd344540e6f8c27c6, 0xfbd35bd67f6d34c1, 0xe304a2d56b90a4a0, 0x5470d6825749961d) }, // -38983
+  { teju_literal4(0x2722a4ee899d76c6, 0x6e4763e6870ed19f, 0x1eb672bf663de8e2, 0x7c70e619753b54f9), teju_literal4(0xa07ce98caf12a51f, 0xd92abd8c9e6daf22, 0x7be9087247b7989d, 0x5f859673ec7cfe69) }, // -39047
+  { teju_literal4(0x91b637368e5be084, 0x55a387f9987f0496, 0x824f90ad740493e1, 0x46c7e043451f3e8a), teju_literal4(0xf3d3ee4f35c6dcd6, 0xc0d42cf68d13a91d, 0x7ca59dc4b8761ffe, 0x05638259e7635344) }, // -39111
+  { teju_literal4(0xd65e5524f2fd40d9, 0x9337dfa2c3668490, 0x96e68bdfd50d8971, 0xbbef312ef4ba676e), teju_literal4(0xb93903bce0d25650, 0xcb945bfb169acc68, 0x53b62383f45af3fb, 0x0aa60a44dac6351f) }, // -39175
+  { teju_literal4(0xdb14fc31c47bff9d, 0xd5331fde77d1d24e, 0xbe83609dce5b1519, 0x27b533d8ea7c045b), teju_literal4(0x8cb41e3254b4c09f, 0xaf10011557fd9d56, 0x15833f6971fe4213, 0xf6fb6c6e8c4673a6) }, // -39239
+  { teju_literal4(0xb84c7eb03a30804f, 0x2236f99ba0e02562, 0xa135b8bcbb23dc52, 0x999fff9b9e7a85a4), teju_literal4(0xd5c509058ecddd73, 0xc8945ace5e9ef305, 0xe587c4c4fc3bf744, 0x8b7411756d4a39c9) }, // -39303
+  { teju_literal4(0xb6bbb1251deb6dc9, 0x145424fc056332fd, 0x85a46985f31774ad, 0xf6ed50e894499a6e), teju_literal4(0xa2639f5317b6dad0, 0xdb0d47c637ecb982, 0x8f285276364e8f20, 0xe70756ff00160e9e) }, // -39367
+  { teju_literal4(0xd60848ac307355c1, 0x83fb62cbb632e8d2, 0x8c0edd81fd55e2f7, 0x1b5f185cf7749323), teju_literal4(0xf6b762914fc8445e, 0x6a2bedb4b8fddf8b, 0xed979f3a61659d92, 0x2a862ff751a8034f) }, // -39431
+  { teju_literal4(0x854ee1832ebf024c, 0xb2f11a8c372408a5, 0x0ba0bbf65e2fa703, 0x59a0c71c4d314d84), teju_literal4(0xbb6abccfd856a808, 0x761cada771b901d9, 0x4a548e3f5ea39d00, 0x3d8ce96a59bb17a2) }, // -39495
+  { teju_literal4(0x6223b6744b8391fe, 0x813c7039bcd5a329, 0x9a003e3b99a4f429, 0xd4543e63008d1574), teju_literal4(0x8e5ed4061cf36df1, 0x63cd4ff76e3b04d4, 0x670a803f3be8fcba, 0x0d76bfc2276aa8d1) }, // -39559
+  { teju_literal4(0x9e562eb84a44080b, 0x4bb46e7acea22851, 0xe8f1ecc9fcc5e3a0, 0xb8e19ecd32fb1945), teju_literal4(0xd84d550d4f925ea7, 0x9cebca5441cef270, 0x246fda5e38a0fcd3, 0x1093c1dc522d1dff) }, // -39623
+  { teju_literal4(0xa648b1b904796dec, 0xf4b7a6c6847d3491, 0xe18ed3266dbd1536, 0x8e339ca151968ee1), teju_literal4(0xa4501923d80890fc, 0x2687ed60a3dd3230, 0x10902762e75dd04e, 0xbb567c7c1e175f3d) }, // -39687
+  { teju_literal4(0x638cb99acbc577f0, 0x4d71ea60e8cb6fcd, 0x3be441ec0f6afebd, 0xacfda666c8820a91), teju_literal4(0xf9a3995c492eaa51, 0x0b01ea14a341a44c, 0xa86c4aac3beac206, 0x14a1df2405236578) }, // -39751
+  { teju_literal4(0xcb86cd5baad707e1, 0xc458fa2644b88f43, 0x78b092f92aea1e07, 0x3cb993b33a752165), teju_literal4(0xbda31d6acb6506da, 0xb9951921b5d40ce7, 0x45aef5359e2ce5be, 0x2439a8512d844184) }, // -39815
+  { teju_literal4(0x90fe9034d84dfb56, 0xb7ec348f5296755b, 0xfda18bc60dc222b3, 0xdb5838926f18e3f7), teju_literal4(0x900e97ee49c4856a, 0x178c4539e4bd810a, 0x44055587fd8c3288, 0x85ea89d0a7316a1b) }, // -39879
+  { teju_literal4(0xb106ea336fe132af, 0x5d4e900f6e488950, 0x40f7dfcffec369c2, 0xd252af999fc878c4), teju_literal4(0xdadd4f2a6838243e, 0xdd8b62576eb91474, 0x0277471c8828ed5f, 0x960daaba2b3b5f90) }, // -39943
+  { teju_literal4(0x49b59bcd5fcb4e19, 0x99ea774d537b8fbe, 0x5e2538a9e1a90a20, 0xb5b9d79c38ebe910), teju_literal4(0xa642687b4f4114ef, 0x364381823b9ae964, 0xf4613a656c68f72e, 0x6e1e2759341ad092) }, // -40007
+  { teju_literal4(0x01eb4374ddd10062, 0x1c8cc63734cd7a36, 0xd81d27f79a5f63ff, 0xff78886bec98613e), teju_literal4(0xfc98ad410b2c6880, 0xdce86db3ccd7e09c, 0x7ac821ebf2ac01ab, 0x18c5828ee911470a) }, // -40071
+  { teju_literal4(0x88d384027bb40197, 0x986930ccc06a73e3, 0x0d4859e5c265f61a, 0x02300a2f9f2bb023), teju_literal4(0xbfe239bc01e2248e, 0x7d2b597b5bc12322, 0x6ccdf030aa852967, 0x7634f67671fd324b) }, // -40135
+  { teju_literal4(0x828a711cc6f3a181, 0x873bb43993cd19ee, 0x346373cb84830c9f, 0x3675159b9e5a974c), teju_literal4(0x91c3793f65cc7907, 0x84a76eb10b7cab51, 0xf6c9791d15017f75, 0x1f197420cbd9af75) }, // -40199
+  { teju_literal4(0xf0c9982e17df80a2, 0xb3f1bbb26d62f79d, 0x3d2328db599a932f, 0x4fc8f907302a5b71), teju_literal4(0xdd750ea75de1bb97, 0x270e8b5334aaaa30, 0xb7c04717e194ed59, 0xcc593f2c4127e327) }, // -40263
+  { teju_literal4(0xd3e26f65efe1967e, 0x7b3c7469fff5ab0d, 0xe0d0a48c810a3348, 0x8559581b30560eec), teju_literal4(0xa83a9f0ae40bbfa2, 0x83d4a27681b20b61, 0x9262ad573c58c233, 0xcfbe6c25b505b058) }, // -40327
+  { teju_literal4(0x0c17d4aa6cdc8e60, 0xb0c2aecd4aef1822, 0x139604953d857627, 0xd16970283a477ea1), teju_literal4(0xff96b9211000a3d0, 0x0cd88e11f5c083e2, 0x000b59f9c5ecc2fb, 0xdc2b81505694b1bb) }, // -40391
+  { teju_literal4(0x6bff697f770a30d4, 0x75cd0a853cd7c5f2, 0xabd00e0c12b1352b, 0x54aada97662887c4), teju_literal4(0xc228262ef76c3ba6, 0x590d85befbcfd719, 0x7113be8ca9b78a19, 0x97bf38ba5108aa15) }, // -40455
+  { teju_literal4(0x05ee68414ae8edc1, 0x9c8845e1b2fdad77, 0x1b8c42c4c913bd4c, 0x860c0a4e34893585), teju_literal4(0x937d877c799a0e52, 0x1937d4c1004db4d7, 0x261c0d8103c14575, 0x13f725a42e9f8e24) }, // -40519
+  { teju_literal4(0x97fa8ba72d844431, 0xdd0e16eedf78cd7b, 0xfcce042d09f154e1, 0x469ba09d427ee7f2), teju_literal4(0xe014ab15582a41ba, 0x1aaa2adb4b4e6602, 0x2d25442eb09642c6, 0x46929c3498f64c46) }, // -40583
+  { teju_literal4(0x9d3085bbcd6b30e3, 0xeeb8bfc4d00d28bf, 0x50a111e7fae342e2, 0x0fcf7a98bd508cdf), teju_literal4(0xaa38ceb9a5581189, 0xbfd6b2aca42be434, 0x5b3142bae200d589, 0x5e950332fd558b3e) }, // -40647
+  { teju_literal4(0x23b89b4d9e4eb3c5, 0xdd6d07764068320d, 0x0de242cbe9f5794c, 0x3b3948b78da2902b), teju_literal4(0x814eec17aba65551, 0x1fb3b43080a837c6, 0x3fe618e518f4574c, 0xcee4607dce2a92b4) }, // -40711
+  { teju_literal4(0x6ab15a3cfd151175, 0xbdc99cb66f25e326, 0x20b24cdedc29c24c, 0x635704541abbe596), teju_literal4(0xc474f76d14f666d3, 0xd8bf497348a5cab9, 0x7b24dbb539ce2701, 0xf7bb90c6c06c435b) }, // -40775
+  { teju_literal4(0x2af5ec4f862bd8c7, 0x58cb467f785d004f, 0x71a3fdf8473e97ea, 0xfae51a79c9e05f90), teju_literal4(0x953cd25798a52e22, 0xc3bbd5b684cdabe1, 0x9285b64e3c8642bc, 0xd593d8cc88d2211c) }, // -40839
+  { teju_literal4(0x7fe05f4ed5803ee3, 0x0bb96d4c07d111f6, 0x9d924291b0dbf384, 0x80e17c6deb55d902), teju_literal4(0xe2bc3c4cf75be79f, 0x2b3628a0a26e83f9, 0xb2f6d1e28d4b7d29, 0x11c15127c7ad4692) }, // -40903
+  { teju_literal4(0xa24fc1209206887e, 0x9d02fc798e5aa228, 0x6c06b48c2b0de8e6, 0x8593eb5260db63e1), teju_literal4(0xac3d09a4ed13868a, 0x33c2e9ff5f78d86a, 0x42f478a29c06313e, 0x79481170e1281129) }, // -40967
+  { teju_literal4(0x1e34c0474896d3cc, 0x366ae93a090ceb90, 0x509ac84dd52ea3d0, 0x3c76850f1a223c53), teju_literal4(0x82d712f8aea7280d, 0xe4494836da86bad3, 0x97c00d3d94c61561, 0xd05df6137898c32a) }, // -41031
+  { teju_literal4(0x20f0d76684c8574d, 0x6f83e84874384025, 0xd2b72608f9cce1d8, 0x130c515755113d5e), teju_literal4(0xc6c8c25e6c96dbaf, 0xb0c14f759dcae113, 0xd44d237a9c580b6b, 0x86a39948357a3c35) }, // -41095
+  { teju_literal4(0x11ba617f24f85bf2, 0xef1cf23559897008, 0x34c1c99d517617e3, 0xcefdd1cfe62691e5), teju_literal4(0x970169b26ff94cc2, 0x54aefae46928b22b, 0xca8868a66dc1573e, 0xe84e52a3bece9451) }, // -41159
+  { teju_literal4(0xe37c558de95de77c, 0x891690af5eb58da5, 0x51a75fdbcc3b8e42, 0x6b7ad8ffcd5a62a9), teju_literal4(0xe56bda6f2d301a9c, 0x8a08f447c30efd5b, 0x67d3d10cd8665743, 0xc46ef596b13a094c) }, // -41223
+  { teju_literal4(0xccb3d9b1ac7178c6, 0x0430d94f95e4dab3, 0x222369b8d5bfa685, 0x13df45955942cf03), teju_literal4(0xae47622104d0e931, 0x36a625d4a51a0f6e, 0x41a1b2fe7184b204, 0x777a0fc84e08e42c) }, // -41287
+  { teju_literal4(0x0de6549b75705f58, 0x847a817785fb0805, 0x0fb26fdf020c71ae, 0x4ab87a3a82895a47), teju_literal4(0x8463df200a8405ae, 0xf72b1267e10f6808, 0xaeefa59278f0b015, 0x8dadf245c2805b49) }, // -41351
+  { teju_literal4(0xa7fdbf6b63a33152, 0x55a0334fa5c6704b, 0x634aa178c1ea69ee, 0x6d5e0650b9c1bd1a), teju_literal4(0xc9239c2a778eb3c7, 0x38784873b19f524b, 0xee9ebe1d8e111cd5, 0xfa0c1660e5dff983) }, // -41415
+  { teju_literal4(0x33769d2b7ce7eabc, 0xc6af66b3c3a8694c, 0x08a3c4c193dfbcc1, 0x85aa25dd5cad46d0), teju_literal4(0x98cb5d9ed6907b25, 0xd2b10bd8deef19cb, 0x00268b6df3953dda, 0xee53700a98de1e6a) }, // -41479
+  { teju_literal4(0xfecf426cf9f83eab, 0x413b26e1c33099e6, 0xebaeb04687c20d46, 0x959054593471d601), teju_literal4(0xe8239de618210330, 0x41adafb3bd837ad1, 0xfe88a464f00a25f4, 0xa15e098d3f1797ba) }, // -41543
+  { teju_literal4(0x635abd3fe76b41c0, 0x090c02a0df3d79ef, 0x0cc640ec6cddfe1b, 0xbd89a9c07cd02f51), teju_literal4(0xb057eab9cc62fdca, 0x45630f404186db34, 0x16a368692985ee87, 0x06a9c7168e51894c) }, // -41607
+  { teju_literal4(0xc060745e6c951053, 0x061d309dfe0eca1a, 0xdfa8edef8bce147c, 0x4baba528e4529213), teju_literal4(0x85f55ea472afde47, 0x486191a85c484051, 0x417e2ed3a8d499a7, 0x0b7adf0e474e80ca) }, // -41671
+  { teju_literal4(0xb60c040de614f5ee, 0x8ed62c59ef6711f6, 0x2e73ea5891737fb8, 0xdc4995e8261773ca), teju_literal4(0xcb859a38d6920348, 0x77b5b4fb8899d3b5, 0x99fbd0bb56f82494, 0xce2f14ecda2109e6) }, // -41735
+  { teju_literal4(0xc61034e910321ba6, 0xa9debab2aa70b537, 0x108cd0a7408678aa, 0xb3f8fa3910e9c0ab), teju_literal4(0x9a9abe5f5f644167, 0xccdf227e52475e55, 0xaf77ed16febf8126, 0xdc7d2c8e27c32762) }, // -41799
+  { teju_literal4(0x75bcef465e7b1280, 0xf956b971c8c6943e, 0xb07e67bb57df5589, 0x1971823e46a7185b), teju_literal4(0xeae39f65e15423a1, 0x6ee0e90d8e0bfd3e, 0x3878dff742aec986, 0xf31910fd55bf60b0) }, // -41863
+  { teju_literal4(0x8e4cc865f4d8ed20, 0x80d22f2e4869d305, 0xb448977acdd8ac9d, 0x5ab26a5d1c2caeb2), teju_literal4(0xb26eb63362706faf, 0x1a51cdac5c56cffd, 0x3776434fa7452c43, 0xab1d9b3140730558) }, // -41927
+  { teju_literal4(0x86d81b38f3dd10ab, 0x51936e88bd0ed027, 0xcafa0b6167e8b593, 0xfc40f5eb5b7d1d12), teju_literal4(0x878b9fc7549e8a34, 0xa8d14244893444af, 0x3ee201bdd2a422e9, 0x47d231dffdefc6ae) }, // -41991
+  { teju_literal4(0x5e467a34a3126a78, 0x28495fdb506f2b45, 0x70738528db835599, 0xeffa9be698dbe35b), teju_literal4(0xcdeed2321457110c, 0x69f039b6d93b35d1, 0x037c5f8d3e5dee70, 0x6d64ce670bd33af6) }, // -42055
+  { teju_literal4(0xae4835c06b8fabd4, 0x9426aa7a1379393c, 0xf8972b3d76f86bf0, 0x919d96797e6d92f3), teju_literal4(0x9c6f9c67ed397229, 0xfb9e8fd45bb39d11, 0xea9c7ae4db73a3d2, 0x5e40269ed234a423) }, // -42119
+  { teju_literal4(0x84f72d4d182e812d, 0x4099d3f237556779, 0x893a7fdff32e181b, 0x2f1845266c7c3906), teju_literal4(0xedabf7ed9d25f797, 0x329ae1a0936d3713, 0x6aced0c35086acce, 0x1faa2d6e2a9c4025) }, // -42183
+  { teju_literal4(0x5838b70bf3cab62e, 0xc508e51cb89874a5, 0xac7c544307c6dfe9, 0x65f5c30bc1784d61), teju_literal4(0xb48bd78acf06fd1c, 0xaff245eafe11f2f5, 0xa1b7e0d62b1fc1c2, 0x977d5558f548d7fd) }, // -42247
+  { teju_literal4(0xb2045d9f98268709, 0x3898d82842b6ab7a, 0x4f0c9adc5ae4701d, 0x3a853ee99709d592), teju_literal4(0x8926b0f559585b2c, 0xe2d8352d6e2f6af0, 0x1312cd830b0ccaa7, 0xa623a28ae351ba25) }, // -42311
+  { teju_literal4(0x4fe535c569492710, 0x7823ad5fbc87fd28, 0xff9029ff7616f1cc, 0xf231e8350aa45f40), teju_literal4(0xd05f5a006a739873, 0x7a19a24fe54d059e, 0x7bf55a59c6c50c78, 0xac9847d6f4315301) }, // -42375
+  { teju_literal4(0xac63a674601249b0, 0xd72f3914ac841a8a, 0x6c63bfe0cebfdac9, 0x4e74c83a6463c48f), teju_literal4(0x9e4a085e482c3644, 0xe898a51f167f8cf4, 0xe24cd284e182c2b7, 0x0d09e1e1e528c52c) }, // -42439
+  { teju_literal4(0x5ebe623ec6ad84af, 0x4a894d9f5d65e604, 0x40d36719a816f4f1, 0x9ecc1d6e100df177), teju_literal4(0xf07cc0c82e5e8da8, 0x40e9765d4a88415c, 0xb7afbba190b39222, 0xd2558385395c20de) }, // -42503
+  { teju_literal4(0x1fe5215ae6b833fe, 0x99a51f0a06b284a3, 0x5b66d126c2723cb7, 0xfd85a09ba045e6e4), teju_literal4(0xb6af61f6b033efff, 0x121a0f59c58d65f6, 0x19c0ed075eea6252, 0xd29d95264b76ba14) }, // -42567
+  { teju_literal4(0x3496a6aa1a09745f, 0x5db810aa0055c881, 0x0a3338d6edeca734, 0x6717d6b987496a68), teju_literal4(0x8ac6a0c6e896a459, 0x28eff1d35e36767e, 0x444f6911bf1b787a, 0x6db0e295671465f5) }, // -42631
+  { teju_literal4(0x04ec1adc1b7b0120, 0xc5655fb9c915fdce, 0x8fded7fb86fa8869, 0x3f0a87fbccdb3cc2), teju_literal4(0xd2d747d0888f127b, 0x6547c222e1b62c4c, 0xaa519558b10771b4, 0xbd73d3d1e8d8d6b2) }, // -42695
+  { teju_literal4(0x7799c7518a5cd899, 0xa390ec3f10e0667d, 0xaeb8ea68bb29c721, 0x72a7651566b6146d), teju_literal4(0xa02a131ab501a015, 0x71fe154d66ee1346, 0xd01435812cf4768e, 0x0738bfcff54246f9) }, // -42759
+  { teju_literal4(0x19e484c9a7333ceb, 0x486045c6aa5aea95, 0x4c85ba249f845f60, 0x85392b365d07d3a2), teju_literal4(0xf356138d2c172c13, 0xb12a153d52107d17, 0xd0a28c45cc7ba416, 0x37209262c343ee20) }, // -42823
+  { teju_literal4(0x3cddd4737525dcc7, 0xf389205c3d721562, 0xf7b3b7266aa207b5, 0x91de0f864898bc79), teju_literal4(0xb8d968e7e8a80483, 0xe58a8e83cf24c809, 0xea9027acbb8d6cd4, 0xe9719b39fce88395) }, // -42887
+  { teju_literal4(0xee01b37ab99030ef, 0xe6b382389dcec500, 0xbc93a51bc71405f3, 0x8fb2f184930dc0da), teju_literal4(0x8c6b7e00ad6de13d, 0x89482de821e90bf3, 0x618ebbb6d433e3e5, 0x14cddb370e574edd) }, // -42951
+  { teju_literal4(0x1e346b6b334758c1, 0xb4916a4effac4a6a, 0xcdf745459343014c, 0x236b5385fcb4dbe2), teju_literal4(0xd556b2125df118a8, 0x667fc36198909659, 0xaa216f4a0e8a2937, 0x6bc42f300840d2d7) }, // -43015
+  { teju_literal4(0xc04ccea4c6f511a4, 0x86644fae9d92bdcb, 0xc53621c4a80ff00a, 0x82111269d52b7ae9), teju_literal4(0xa20fcda88e4425d2, 0x5c00510ca3ea08dd, 0x8a957519d7ddac0e, 0xb0a6932f79bfdccd) }, // -43079
+  { teju_literal4(0x216ddba9a2fbe440, 0x5d810a78f781159f, 0x2fc903c59f1f1690, 0xe02d84320403c703), teju_literal4(0xf6380a21ca592a4a, 0xc89babf43493bf46, 0x57d1330aa1d2de7a, 0x0075c68f3d188aa2) }, // -43143
+  { teju_literal4(0x3608f2ac1d8dc20d, 0x1940ab680814d439, 0x16314c3f7003ba62, 0xff10c6a2beb16b6c), teju_literal4(0xbb0a000a506cf0d9, 0x462122f8ebd7406d, 0xfb39b8af00e48d57, 0x2daa5c80e0fa01c1) }, // -43207
+  { teju_literal4(0x83f491b298004592, 0xdad039d185837381, 0x449535f62984bd95, 0x2cf0ab91e4cb8c59), teju_literal4(0x8e1557941c8a3148, 0x4367712f871fb501, 0xada8333d3fe5d0f7, 0x90a883730b7a01af) }, // -43271
+  { teju_literal4(0x0b6844097cec59b6, 0xb85782a894f82561, 0xd26df4936f32e8a3, 0x99b145016857f3ce), teju_literal4(0xd7ddaf79e57309ce, 0x8b8f575e42943669, 0xc383efe8dfaf57b3, 0xc380e5610555246a) }, // -43335
+  { teju_literal4(0xac4a025c17c0be61, 0x84639b994175271d, 0xb5c51d22776a9275, 0xa3bbadc6c429bb13), teju_literal4(0xa3fb4946df30729f, 0x58256250cd44cedb, 0x560a08c7913c5889, 0x3db9090271d015c9) }, // -43399
+  { teju_literal4(0x01f04217f97d69ee, 0xe0a17707b58a461d, 0x5fced9be39c00e32, 0x038cb5169c4d59a8), teju_literal4(0xf922beb9c57e41b4, 0xbea195536380676a, 0x8644b80355b16e1a, 0xcae66fb1578b7840) }, // -43463
+  { teju_literal4(0xe9cf5e7bcd50f08c, 0xc28b2273caa9a830, 0x78d7d0383f4badb4, 0x4fbed323a03b6646), teju_literal4(0xbd413b4567b2d44c, 0xb0c877e2905ba6ac, 0x5ff481a190172753, 0x8494cf3f8e9a3b06) }, // -43527
+  { teju_literal4(0x866b7cae1961e7b0, 0x03973934142575dd, 0x377631cf44cf8f4b, 0x2f5b536ace772e04), teju_literal4(0x8fc43c9ffc02ec2d, 0xdba6b625bceb1de3, 0x8caf3eb791197afc, 0x48d4207fd01993e6) }, // -43591
+  { teju_literal4(0xbe0b4ba57ec163bb, 0x2008c4ed8dc6759c, 0xf5b20e4a5ca218a4, 0x1445208545c435c0), teju_literal4(0xda6c56fff3dc2e7c, 0x1cf31deb5a906a92, 0x4b1fec4adcd018a5, 0xf7d9b9157f529d6a) }, // -43655
+  { teju_literal4(0xe50ab65d47530228, 0x925f05c6a2370153, 0x737e6b28e8aff245, 0x4bb562d50b3a55be), teju_literal4(0xa5ec976900780e8f, 0x88c9aadb38e3395a, 0x5837edef08075d96, 0x25745bf168824282) }, // -43719
+  { teju_literal4(0x7a931ad8d7dda7ce, 0xb57d0250994abd58, 0x86b6a3000817d2f9, 0x8c94f11eb975182b), teju_literal4(0xfc164bd8505ab121, 0xd36e0ecbae44bcfa, 0x228886bf0c40e233, 0xac5611a902eba73f) }, // -43783
+  { teju_literal4(0xea961c96d2853012, 0xb4f7de4535ccd3ba, 0xd983eaba1b5453be, 0x2f4e635d9825371f), teju_literal4(0xbf7f2ebd0bbbe704, 0xcae4851f231f8183, 0x4ba46145f3190b31, 0x0e6f84acd58f98b2) }, // -43847
+  { teju_literal4(0x4467c4d4bfaf65f5, 0xeb9fd32a5393fa73, 0x040a894850d56957, 0xbe3b5212c0ef6c3b), teju_literal4(0x91783c70ecca21ab, 0x19acdd1b27418891, 0xc0f0e71d34f3ef99, 0xad97879149d42e8c) }, // -43911
+  { teju_literal4(0x6542bc3ed5f8a3db, 0x59a4d7dd0e904a9d, 0x9ceb5937d23d26f1, 0xe4bfeddc34a17eba), teju_literal4(0xdd02bfe308afb0bb, 0xde9b41c95fc52a26, 0xafc6db40cb378557, 0xf5e02c7e3964319c) }, // -43975
+  { teju_literal4(0x1b28e127b03179c3, 0xf5397a12dada5291, 0xd0327296865ff7e8, 0x048884ad54e16e60), teju_literal4(0xa7e3c9b736df6e78, 0x25a5f394aaa3dc90, 0x2478192d681d8486, 0x331f57bb5d570afb) }, // -44039
+  { teju_literal4(0xd748227db230c580, 0xb28f6d16fe597ae0, 0xca8dbb553c21eaa2, 0x9a52b82b55024c71), teju_literal4(0xff12cc510539a7bb, 0x61d1e53af466e90d, 0x85ded1c8a24ce43d, 0xb96997354beb9ace) }, // -44103
+  { teju_literal4(0x6f86df947e1e1788, 0x4401db156a45ab6e, 0x277cd4271771422b, 0xa7e1acd30fce35fa), teju_literal4(0xc1c3eed22decd6d1, 0xaa16c1d81a362073, 0x2f9a5e02585fd2db, 0x61843880193aaff6) }, // -44167
+  { teju_literal4(0xb67dd8078c3810a7, 0x4abbf9dc3199be84, 0x9d6e044fa22882ba, 0x044521dbadeb60ba), teju_literal4(0x93316681f5bce5e6, 0x46487892ad42164c, 0x38fd82570c15fcee, 0x70792c55f1177617) }, // -44231
+  { teju_literal4(0x95a0ae1c5bd63396, 0x7ac46e26e3f7ab87, 0x937d0678de6999c4, 0x38b026bf906d92de), teju_literal4(0xdfa101a82173d11e, 0x648abccb6f46813c, 0x3e0d9d70d70ae73e, 0x7c5dc61552c6f2ef) }, // -44295
+  { teju_literal4(0x08762c48ec749bc5, 0xe7882a8bbfb2d138, 0x78a7c4e58714535b, 0x06a3a1de0f5d9729), teju_literal4(0xa9e0f20f53bd0d55, 0x1c2957d9c30b1e92, 0xee1636df1dd203a2, 0x0f610507fb414e87) }, // -44359
+  { teju_literal4(0xf5225661c561c268, 0x3aabd93408bef456, 0x540740eb767ae64b, 0x3dd06760df026741), teju_literal4(0x810c2da46cda42f1, 0xe0ffbfb1c5fb8270, 0x12c995fbb8b008ce, 0x8dc56a13ca88056a) }, // -44423
+  { teju_literal4(0x08f068545ac4dfbb, 0xcba5a23a3432d8ca, 0x291e182b2b474b96, 0x19d69d1aba02c667), teju_literal4(0xc40f90238d08510a, 0x73ee0dbfcec51340, 0xb91963a9d07677e6, 0x7be8a29d141885bb) }, // -44487
+  { teju_literal4(0xe18bf902d23ce643, 0x6bde482be542decb, 0x9bc40ecd2aed6427, 0x14fb3cf2d04d8fae), teju_literal4(0x94efca7d10595a75, 0x7f1aab2fe0f84d3c, 0x2448c55bb8d0ee5b, 0xfed687c050390488) }, // -44551
+  { teju_literal4(0x57de7fbe1592c127, 0xde5eb15318ae1b61, 0x3dcfebc6c29ba833, 0xdb43466399c997e3), teju_literal4(0xe247341b8f79d975, 0x8ecc5a0711091d6a, 0xf204e10d7e388181, 0xedc15dcbe51210db) }, // -44615
+  { teju_literal4(0xf14e6f3b5460456e, 0xef80ee8100e00047, 0x719e477d153407ce, 0xd78ad5877331f98b), teju_literal4(0xabe42285575f4215, 0xed538a3d02bfc8d0, 0xa499a170de206282, 0x2b35c1b4b16a95c7) }, // -44679
+  { teju_literal4(0xc7a3c4631f4d627c, 0x28f939591e2b68db, 0x9e2e0cd5ab55759f, 0xa748b0e3fb2036f7), teju_literal4(0x82938a1b8ab6ce35, 0xe321c5ce537984d2, 0x101972c10e05105a, 0x8aca2cf9981d6ed3) }, // -44743
+  { teju_literal4(0x8e1bae57ea2aee35, 0x225c3d46be2c011e, 0x0faead147c8c8074, 0x7d7027013b6c39ca), teju_literal4(0xc662278e709c4d25, 0x767141df01a1268a, 0x26a8229af5e6df91, 0x9b9b75e33fefed44) }, // -44807
+  { teju_literal4(0x0e8ea454521b4e07, 0x7ccdfa376566cac0, 0x14541a45ceeeea5b, 0x3dd1f24f13827c1f), teju_literal4(0x96b3783bb71f7309, 0x59f83f903372b88b, 0xb248f345f63d7fdd, 0xa9ca4a3bb2482c41) }, // -44871
+  { teju_literal4(0x7760b637ab1ca9eb, 0x8c76d763f3bb5d3e, 0x25bcb5c27512c24d, 0x7d60599736674965), teju_literal4(0xe4f56f51d02e646d, 0x486847bf24b21e9a, 0xb33680f45a827e3f, 0x9e9657ae43c5c4d9) }, // -44935
+  { teju_literal4(0xdb64d6f3af5bf9c8, 0x4039d5e7b4365447, 0x707fd3a68a78a5b0, 0xa81c7d348995cec9), teju_literal4(0xaded6d64155e95f1, 0x3dbbc718b017c6aa, 0x14598d04e5eba881, 0x63b5744599c704f4) }, // -44999
+  { teju_literal4(0xd2dc6f6f76e56a0c, 0x5427eadda514b886, 0xf29c3cf1b54bef8b, 0x50298ac80c1d9268), teju_literal4(0x841f897325db9662, 0x9ff550e9a4d90fdc, 0xc59f5aa2009e98a4, 0x78b6f53a77604d4f) }, // -45063
+  { teju_literal4(0x8fdc1190a903589f, 0x1f74ebcded4b2ac9, 0xfddb0101292f5594, 0x975c65190902a687), teju_literal4(0xc8bbca2f66a7bfa9, 0xeba0876af32476e8, 0xc38471e2a2d26a36, 0x4df43d5a5d15210d) }, // -45127
+  { teju_literal4(0x342a51b94fae5d2a, 0x3ca88ed7250e7487, 0xa9a186fb37c9a341, 0xe05001885c371e9f), teju_literal4(0x987c7fc775a183e1, 0xded280293db63659, 0xdbb7aacdb7821dfc, 0x101216d59ad2f6bf) }, // -45191
+  { teju_literal4(0x413198038e71470a, 0x9843b65a2a414f17, 0x4362a7e1bc6a5299, 0xb47d524de0cefe11), teju_literal4(0xe7abcba867f9a831, 0xabaf8e70f7552b77, 0x7fee06c5a34e8d98, 0x064a303653efd4fe) }, // -45255
+  { teju_literal4(0x890f78ed7713715c, 0xba0c3e85c6f183b7, 0xe72f241422bab93a, 0xe8ae570ff1c82ee7), teju_literal4(0xaffce52ddae270da, 0x28a96447a818817d, 0xd4d0be6895ca0b1b, 0x509cb68e436bc795) }, // -45319
+  { teju_literal4(0xa9b50047266a864e, 0x0f3b3582532078ae, 0xd46ea780bbbf7897, 0xfb475155e7034ebd), teju_literal4(0x85b039baac17c3b5, 0xa034da6294ee8f3b, 0x6fbec177f8db17c0, 0xbd3e38f50ff9c707) }, // -45383
+  { teju_literal4(0x734c9f31e412e73a, 0x9bee97179d0ba9cd, 0x9f66c365f25c12b1, 0xc0398449cd02b10e), teju_literal4(0xcb1c8d63037f7149, 0x28543d4da2c00a28, 0xa43ceaa7edce7fc2, 0x86b99902ab7bd5d6) }, // -45447
+  { teju_literal4(0xa8ae7fda3da6f123, 0x61a4ee7ccf5e91b2, 0x121706cead68045b, 0x65e78905eab4d542), teju_literal4(0x9a4af15a7a49b788, 0x9f1815eb319a658a, 0x5ea5cbdbea1abbf3, 0xc6677fc25032f59b) }, // -45511
+  { teju_literal4(0xcef8b7790578323e, 0xbd6d6b948cc37876, 0x7798832ecfe9dbc6, 0xb68ff21774a49acb), teju_literal4(0xea6a61c6bfb7899d, 0x8494deba03ed3cdf, 0x1483bd2a879c21a9, 0xb53bf3faa31342e4) }, // -45575
+  { teju_literal4(0x931597190a80c431, 0xdbe0f98b7f0d95a3, 0xf6858d4d15e70ad9, 0xd0a5042d2bfa46a6), teju_literal4(0xb2129c9d16de0364, 0x0b869061169de36a, 0x758e64665e9bcee2, 0xd7ec2c7d56e6fbc3) }, // -45639
+  { teju_literal4(0xe5489c63362a5cf8, 0x76549b133779329f, 0x89877529797e281e, 0x77d0e7f77ab15339), teju_literal4(0x8745a92c2f2da04d, 0x5171c72bcec11d63, 0x169096926d196be7, 0xad5a59ce8630647d) }, // -45703
+  { teju_literal4(0x42360c460d0b5b0a, 0xb15f6ab7740c7704, 0x5c75dbbeba6e2330, 0xf054a72baca6226b), teju_literal4(0xcd8486c6a3f8ca58, 0xb9b9e6ffb25fbac3, 0xf1e7efe4cc2bee28, 0x298ae5a2e152b98b) }, // -45767
+  { teju_literal4(0xe57037ca7677032f, 0xdbad74c5702ab05a, 0x45cc4d2374d46785, 0x28e104d11d6ab5fd), teju_literal4(0x9c1edd6029d998cd, 0xf02977091e877080, 0xd60197d59906b685, 0xfc4cb3c09c055a9f) }, // -45831
+  { teju_literal4(0x404a924ce6a4eba3, 0xa03d04e5c7db60c6, 0x02e2e6ff89dbeba6, 0x9b2b5da07fbbe8a1), teju_literal4(0xed314a9f04cf54fd, 0xa39b3a61a1b146ee, 0x70ff5b21f690c1e5, 0xc38530ff97018ae5) }, // -45895
+  { teju_literal4(0x273a6eb528b4d3a8, 0xe000cf78a44c075b, 0x973c3d78c04f9040, 0x3209b4eea9c4c8e0), teju_literal4(0xb42ea6a5044b6748, 0xcc58cbb195cae1ad, 0x2c854e2b61c6f4fa, 0x7528e782d74e18bf) }, // -45959
+  { teju_literal4(0x086aae5600a9507a, 0x33b0874ab25e10c6, 0xf22c096aae8f9813, 0x95e5905c7749e493), teju_literal4(0x88dfe62ce6234754, 0x64543ee92a98758b, 0x96a525e1c2e78bce, 0xecf4a77f8e567e1d) }, // -46023
+  { teju_literal4(0x7fa61e2d3261721d, 0xcddd6999d7114088, 0x7bd7c46d5c312f77, 0x549dcd5704606649), teju_literal4(0xcff3cc3931e17790, 0xa5b637f98830ee39, 0xc589830ce0ce8935, 0x055379f2da940370) }, // -46087
+  { teju_literal4(0x3f14b61cd8952c1e, 0xd9ec5a62c6f841cd, 0xb358871fce687167, 0x66093fed09166e28), teju_literal4(0x9df85475b4a8edb9, 0x98b4ef87386489db, 0xa12cd51a2f0fe4c6, 0x0844030500f692ca) }, // -46151
+  { teju_literal4(0xc496c37c2c46ef3a, 0x928df51c72fe7fd8, 0x5a237255d9a499b5, 0xd73c7cb92b70598c), teju_literal4(0xf0009f6f0bf3114e, 0x675c752f857a54dc, 0x1c9a9c16ea5dc990, 0x49a5366749c26aee) }, // -46215
+  { teju_literal4(0x094f6a5a1a62c33d, 0xc999edf2a8e80ac9, 0x79339ec0e18fb54b, 0x10f73deeae47903b), teju_literal4(0xb6511672566b01e3, 0x3708fd812b51f755, 0x51d2c25cb361e989, 0x8bd47cd5c423ce88) }, // -46279
+  { teju_literal4(0x901c3529810c1055, 0xc5f7c8b7ab413668, 0x8cb2213efb78ae0f, 0xbe29f99d0e61deaf), teju_literal4(0x8a7eff4db01b8066, 0x27c646a21c324eb6, 0xa29b130076f5f9d8, 0xab8cc657e66596ab) }, // -46343
+  { teju_literal4(0x4d5eaad988872dfc, 0xde43ba5a96b923c2, 0x01716ac39565f2e3, 0x21f6f7889a5ebf1b), teju_literal4(0xd26a73dbeacae1d9, 0x5d779833256713e2, 0x252c0ac2f0e49e5a, 0x20b5cd03a5a95a1c) }, // -46407
+  { teju_literal4(0x1911445f9a7e2c7c, 0x6edac2b111f7404c, 0xc55a9c8158cb906f, 0xb23a7caafb6fecfa), teju_literal4(0x9fd7676aada93001, 0x254064d54866698e, 0x63ec3d7cf9c631ae, 0x0f667d6912772ab8) }, // -46471
+  { teju_literal4(0xe2fd00537ada85c5, 0x824ed6b8b2338d74, 0x554ffe5e5ccb54fe, 0x53320ad7310a9159), teju_literal4(0xf2d879c1368e7afa, 0x288e84eb68e9c0fb, 0xa33537b7f18a5f51, 0x84e31a1a1bbf5252) }, // -46535
+  { teju_literal4(0xfa9727b9617a766d, 0xbabbdf06216919ab, 0x1b43589677a6b858, 0xcfbaa43bf6755d8e), teju_literal4(0xb879ff6be70d4643, 0x96c85297771c8919, 0x4b8b8c81ea22f91d, 0x513f5eb10e27c221) }, // -46599
+  { teju_literal4(0x7d5ffc5258d1373b, 0xdee6fdeddc9d12df, 0x0dcc53ce9dc9793e, 0xe2bd74d384d8cc94), teju_literal4(0x8c23034b98bb6c82, 0x6e8bc6a894cf7da1, 0x08c67bf328b2b07f, 0xbb74c797f548aec2) }, // -46663
+  { teju_literal4(0xcc63ce94e7278baf, 0xb5b2a234d42cd39f, 0xa6ecfcfd4bec0fef, 0x16c0d6ef109a2a1d), teju_literal4(0xd4e894132930881c, 0xb490d7db6192ac41, 0x6bdd08eb63a9aa79, 0x00d85a42bfac700c) }, // -46727
+  { teju_literal4(0xfe0528db2325ba1a, 0xba2e98c51d3aa133, 0xb98c7f12f5bf8561, 0x51ac55693018e607), teju_literal4(0xa1bc2741a332ffa8, 0x272fad96a9488874, 0x4a028eefd86df4bb, 0xa0c226ae617dbf2e) }, // -46791
+  { teju_literal4(0xb8ee9bfdd0786b57, 0xcc5d471dc8600369, 0x486765273267e0e7, 0x499659fc00ff470d), teju_literal4(0xf5b8f36d5aedcb89, 0xa81390c586ced7ea, 0x042f81914c829be7, 0x1b95b79206fc9219) }, // -46855
+  { teju_literal4(0x2887c8c97e86c39b, 0x5f2fd4e10fc5aed7, 0xa1be7787efc7ce41, 0x7d1a6f5a6ed2b24f), teju_literal4(0xbaa9753366ed0710, 0xd1643ea2291e7f29, 0xbeea0436d1a8bc36, 0xd66d0eb19052f07a) }, // -46919
+  { teju_literal4(0x4ab0b7fc640ba56f, 0xff7260cea3584fa8, 0x8271812814977dbc, 0x05b2136c832a8999), teju_literal4(0x8dcc01105e21b7fe, 0x7161a20e2cfa3fef, 0x744353b1d977c667, 0xb13f6ee859faf7b9) }, // -46983
+  { teju_literal4(0x7d6f4992eebc0ffc, 0xd5d03faa4d582130, 0xdda66a5c40b4d0c1, 0x911057c1835a1d8a), teju_literal4(0xd76e438730005f75, 0x1a52e80c60ec13a3, 0x8c891c1161fe06f2, 0xdf3d97c59b37feb6) }, // -47047
+  { teju_literal4(0xdeecb2048196368a, 0x729852cff66c915d, 0x1b7487241d4ee4fe, 0x691a87330655aa67), teju_literal4(0xa3a6a530b9a2fcb1, 0x6d4886cb9cef526b, 0xbe4a3e39fa793440, 0xc89d050ce8711aad) }, // -47111
+  { teju_literal4(0x5f4b16b12d7c7f91, 0x7a56fb18bb87b911, 0xbf595b352e826e97, 0x22402a6dbf67a533), teju_literal4(0xf8a22699af248c6c, 0x1df34c3d6037e4c1, 0x41c94714ff95a25f, 0xb6f2fc62a893261b) }, // -47175
+  { teju_literal4(0xef5844c8de933366, 0x39377d7614a378d0, 0xedb72de7fe4e9262, 0xad6421dc7d0559fb), teju_literal4(0xbcdf8ba610209b2c, 0xaa794286031dc3a5, 0x2a837dc88b3061d0, 0x295af9e600134459) }, // -47239
+  { teju_literal4(0xc5dcacd83c77b231, 0x5a1046c870440d13, 0x9e89c5189d762c66, 0x6e910fc3c9e64bc8), teju_literal4(0x8f7a07b2f8741321, 0xbeec78fb0d567793, 0x49e36a35d5a51760, 0xb2c44345138be388) }, // -47303
+  { teju_literal4(0x1dae7b1346c56027, 0xdd3da5079a996803, 0x422aff948c1c5ff3, 0xf23cd9c05038ca99), teju_literal4(0xd9fb9924f88c73bf, 0x2960328925da3050, 0x73c8a7e78f83624c, 0x522981948c9ebe39) }, // -47367
+  { teju_literal4(0xc0922c810bfc0788, 0x05fceb8658e092e0, 0x9bd8dc880970a1b2, 0x04596c756c951800), teju_literal4(0xa596f2a247cb853c, 0x60deaecceaeedf41, 0xcb0d9103bea8a45f, 0xe3324b2d994b7c47) }, // -47431
+  { teju_literal4(0xf2dfbdd8dff627b2, 0x6c665bf34f99f072, 0x04cb72ddbcd54520, 0xe615ec0cb043cbeb), teju_literal4(0xfb942dbbb6bccbfb, 0xf3ab17484b799680, 0x451dfd27f308aff9, 0x2b3681cc3c0b2a7d) }, // -47495
+  { teju_literal4(0xc67b5d77b8caa780, 0x73b477cb311b9173, 0x2f7a51f352ad43f6, 0xd1f2864a29740a63), teju_literal4(0xbf1c56dd5aa82b0f, 0x1ebefc9523de2daf, 0xc2255ff8ee0123dd, 0x68e6fecad5d30cd7) }, // -47559
+  { teju_literal4(0xe2ea6ed03395d785, 0x30d325f830786458, 0xbf8682d1e43944cf, 0xebab97103ebb7849), teju_literal4(0x912d26782307c18b, 0x26196b8323eaef11, 0x04e7a41165adce66, 0xdc05331adf173212) }, // -47623
+  { teju_literal4(0x03aa508c4e137373, 0xa6aa4ca18eeff4e8, 0x7695c64639c48c8d, 0xd94c122475e4d099), teju_literal4(0xdc90ac1f02ed187c, 0x277c841880a39e99, 0x41263a6e55256f57, 0x1acaa17a22642286) }, // -47687
+  { teju_literal4(0x89fcc47ebe701633, 0x31b3b3cc236f4984, 0x0084b8edb9b0f1a9, 0x8aaba7400ba4e97f), teju_literal4(0xa78d21357540e60f, 0xb501924fa7c83b27, 0x08c61bd4d78b69fd, 0x78ee65253ccac91c) }, // -47751
+  { teju_literal4(0xb268eaa7dc56a2b9, 0x7e80c2da2aa980fb, 0x6a87cc570d22b3e4, 0xe64625e7dd72103d), teju_literal4(0xfe8f239933372530, 0x6f454f1fa7c79f8c, 0x670e1b82bae730f0, 0x00ca2344daedebb1) }, // -47815
+  { teju_literal4(0xfd621661b76b40ab, 0x0e57b6dfe44b945e, 0x98b4ddfcb37cdd8d, 0x31cbda70d0f4d346), teju_literal4(0xc15feb2fb31f9003, 0xa8bb580651fd604a, 0x8ccbf8e7b75243f1, 0x96045fc7ea40bd2b) }, // -47879
+  { teju_literal4(0xaf6717e6709bf126, 0x0afbb02e13765956, 0x457b85d9b027ff2c, 0x9a57023de51bc6e1), teju_literal4(0x92e56cd2e72a1f12, 0x223689a822b2d7eb, 0xae113190a9089c10, 0xeaf5dfe6e2b866cd) }, // -47943
+  { teju_literal4(0xb1715ea2a30528ae, 0x94cea1f5692ad148, 0x5c6c9e3d28bec888, 0xbdd11912f55b1b80), teju_literal4(0xdf2d93ee28db1021, 0x0c9e6bd1e1f6b999, 0xb595521a315e2893, 0x099b28699735545c) }, // -48007
+  { teju_literal4(0x8b293caf8569b91c, 0xde7c1b73d5714a14, 0x687ab24258464f62, 0x53e734da3325f4d2), teju_literal4(0xa98942beda859c6b, 0x148ce31cceef6a45, 0x4903dec21a65f6f2, 0xf64528991c1cd6d9) }, // -48071
+  { teju_literal4(0xd975faccb589ba55, 0x763340632b51d562, 0x204b1bbc4e315490, 0xfe88ed1d51965e53), teju_literal4(0x80c991a48bb21202, 0x4283fbb80ecf75ee, 0xbe68d54b18a510c5, 0x6a36c7772ac12823) }, // -48135
+  { teju_literal4(0x9c2d38febda51be5, 0x9dd36f6aead6cede, 0x561ee97036c99de1, 0x6a3923db2ebd6ebe), teju_literal4(0xc3aa5d31339a41e4, 0x66acb6a14e6f1611, 0x82e687d0563c2fb1, 0x4aa32ec9e7ebca8d) }, // -48199
+  { teju_literal4(0xde7c3978bc266f20, 0x402939c2ca15e5bf, 0x25f75bc499bde8c2, 0xeacd3f21959c98fe), teju_literal4(0x94a2ea65288e079e, 0x2ea184c205d23afa, 0x0e9d81c5e5874af5, 0x556055ebbd230636) }, // -48263
+  { teju_literal4(0x8a0c208c367faeb4, 0x542898e0cd14115c, 0xfa69e1c4dd270355, 0x34a1a5f60373bb1a), teju_literal4(0xe1d268527309265d, 0xe5d397acdb361556, 0xfd95125b99bd1245, 0xd3bb937b0bed1e93) }, // -48327
+  { teju_literal4(0x5bc66f9c7e89947d, 0x73eabaecbacd6bb7, 0x445ebfc138b174b9, 0xda3958902e3a8441), teju_literal4(0xab8b6949231c5905, 0x11fcf3c0eb0fe486, 0x44290cc8da946732, 0x1c995b0e92bb344b) }, // -48391
+  { teju_literal4(0xd65ee16d4a43387d, 0x2287720c572dda22, 0xb1af182a8b8154ed, 0xc54829f08e601d90), teju_literal4(0x8250241a3ecfd540, 0x49f4b7d10c8203dc, 0x7132b0a6a45abf53, 0x812722dabf68a5eb) }, // -48455
+  { teju_literal4(0xabd9d4c3bfce2ea6, 0x3fcd3907542a14fc, 0x4e87fabacb30bc03, 0xc38a8727acea614a), teju_literal4(0xc5fbc1b45eafe39b, 0x36239a909d4a3e64, 0x0dde7338ce29fdec, 0xffd078587834bc93) }, // -48519
+  { teju_literal4(0x128272f3b71415c1, 0x917fe9ae4bce5e87, 0xde35dc4f705a861e, 0x0329784231933da4), teju_literal4(0x9665af0033631e5f, 0x10b7fe604a4c2b4e, 0x7f4e5ccffef56f44, 0x3cde67ca072b81ff) }, // -48583
+  { teju_literal4(0x6053ae73fbc02374, 0xc3768404fe69255b, 0x85ccf23af2a10a3c, 0x900ddfff6105f3c3), teju_literal4(0xe47f4153f104d09d, 0xb2958014fd8cb11f, 0x6c08a29419b2644b, 0xf754a4c8e58aaea8) }, // -48647
+  { teju_literal4(0x56dfd5e4b5cc612c, 0x78e1b900ad40b9d7, 0x5f247b75f3d99511, 0x6ec38997022ec6ba), teju_literal4(0xad93a715b1858559, 0xe34dbcb68e641d7d, 0x73e4ee5314df7daf, 0x4cf734ed17f9fd50) }, // -48711
+  { teju_literal4(0x54977694480f5a5e, 0x128c2337d8ebf6f8, 0x677012c244d56f52, 0x3007ab75e1b8f0ee), teju_literal4(0x83db570bd07b8a44, 0x745d64bc492cfd96, 0xc1242b424622a7b4, 0x8c79c6103dce75fb) }, // -48775
+  { teju_literal4(0xa59d5823d5da1a96, 0xe981a0610c558598, 0xfc01500b1743c35e, 0x68fd12f3effad023), teju_literal4(0xc8542dcadcc01298, 0x9f638583e7b00dd8, 0xc77c8df81ec0c839, 0x585a42ee5dd56f5f) }, // -48839
+  { teju_literal4(0x54b4150b532e0551, 0x0045aa9b1d1e25b3, 0x27aeceebda88273d, 0xdf26d275b44a9e34), teju_literal4(0x982dcaa54c1bfff0, 0x218ae70842708578, 0xaf2cdc4515dd2ced, 0xd25974578598007e) }, // -48903
+  { teju_literal4(0x465e7edab06003cd, 0x8ea5000c95ea49ed, 0x1244e507825cbb14, 0xc9c230258153c3cb), teju_literal4(0xe734374393a57ef8, 0x001595708c87385a, 0xb177fedc7ed0aba8, 0x310ff907b5319db1) }, // -48967
+  { teju_literal4(0x464dcd3d32d8b9a0, 0x7e9d32cf358e6274, 0x1078a14976424c53, 0xa561200f480f1599), teju_literal4(0xafa20e9d452e1de3, 0x09bcc94c7d6b8dc4, 0xf3ba4627f6433b0b, 0x35cf5f94f95bdab7) }, // -49031
+  { teju_literal4(0x90dc74e1fda33b17, 0x205a46b71622b1cb, 0x141e4f16a7bccb33, 0x2ad8ac218ac3e662), teju_literal4(0x856b38816ca1798b, 0x39a3f7c84d261021, 0x7fd48c614cc6691e, 0xaad2521162c80f4b) }, // -49095
+  { teju_literal4(0x3244f50bfa554358, 0x28637836d404c54b, 0x1a3efffff9946b82, 0xbaf6bd4c3b9194d7), teju_literal4(0xcab3b6c63b743194, 0x8e269c9fc658c456, 0x559025986cc91597, 0x5b3871b6ca3c0566) }, // -49159
+  { teju_literal4(0xf75a93277a4ef6fb, 0xbfaecadfa722d803, 0x6d1d86a69bad1416, 0xf2d1a605c4b373f6), teju_literal4(0x99fb4d8640e87a3d, 0x772723309e2de6ea, 0xf2d12c0d6ef6fc41, 0x2902c05eee9735b4) }, // -49223
+  { teju_literal4(0x2c1e7b1b56b8b042, 0x33c25335e8ab6971, 0x86f503d6776e40a4, 0xfb3e0dd2e42cdbf3), teju_literal4(0xe9f162bc0a125f0c, 0x56a0eb974fa39688, 0x0fa1861e4c4fb97a, 0x27d4ee5503763732) }, // -49287
+  { teju_literal4(0x9091be2f6e07028b, 0xe2fdb188a7cb6dc4, 0x537ac119f4cad0d8, 0xfc8fc7a6c868c116), teju_literal4(0xb1b6b290a255c578, 0x87a32dea5496c752, 0xc089a41ff857bf96, 0xd1c9cf00a8f4239a) }, // -49351
+  { teju_literal4(0x630ea3d5eda4ea33, 0x055411577a28853e, 0x87eb7744b94d7873, 0xce99d4d5f2b45353), teju_literal4(0x86ffd6adcd1ea929, 0x8846e77c6daff336, 0xc002ec766b75b08a, 0x9472c2141b4f1552) }, // -49415
+  { teju_literal4(0x947ee87c9ac58cbb, 0xc2a1cc9e7b592a80, 0x3071293f165d43d3, 0x47c2bcd19b2954cb), teju_literal4(0xcd1a7238af85fb4e, 0x0ddb01899396ac68, 0x692f61296f40916f, 0xc4f51ab34c608954) }, // -49479
+  { teju_literal4(0xe42fcc6985d46b64, 0x84ed546d991c2641, 0x8f78c6a5b6ae3b92, 0x09fbba7e0fe78e4c), teju_literal4(0x9bce4805fce8f47d, 0x0a234ffc09ef6573, 0x5712d41cff553441, 0x9384e30211a8cd9a) }, // -49543
+  { teju_literal4(0x10c1b4b2e8f78881, 0xa1a655ba13ea8a12, 0x3d2f217634124785, 0x4044a9b2b149d5da), teju_literal4(0xecb6dca2a16669c4, 0xdccd2635fc86db94, 0x308858b610f080e0, 0x47bf152d07f1124d) }, // -49607
+  { teju_literal4(0xdf5b18049205d40c, 0xc10e26ad22908c8c, 0x8b19b6425c83c23d, 0x70acf8fd6d0a4af2), teju_literal4(0xb3d1a5d93bf207fa, 0x56465fa050368e02, 0x887a23348f0d30e5, 0xdb894fd9eec69ee7) }, // -49671
+  { teju_literal4(0xceae0bd0f0f43946, 0x193fdd3e6d662396, 0xbb5f4ff94c7c5b13, 0xfab0a47bfcc3dd4e), teju_literal4(0x88993feebacecc9c, 0x10b85d50438d229f, 0xa769022fb68f61c1, 0xb27460218e0a4f68) }, // -49735
+  { teju_literal4(0x038a942ba3ca3828, 0xac9238b6b8d72dfd, 0x755dabd47fc3e86a, 0x88d2655a9c95bdad), teju_literal4(0xcf8875f5d8d1be9e, 0x4621c83701e565ce, 0x382f46deefe95969, 0x4c6b3f2cbfe2d77d) }, // -49799
+  { teju_literal4(0x9d369c49fd833b01, 0x72415cb944a444b5, 0x2e4df912372e9dbe, 0x979a685e358aeecf), teju_literal4(0x9da6cab91d204138, 0x2444f75db97fc356, 0xd0d990724a859c4a, 0xecbb3d562cb4d371) }, // -49863
+  { teju_literal4(0xbec69b5ef3a9ad81, 0x70dd84272240904f, 0xd87b8be587db9a48, 0x0e60b0a48e5f2294), teju_literal4(0xef84be2826faacca, 0x38760a85cbc246db, 0x4ff9e38586fc7c31, 0xae47acd03d8be8c0) }, // -49927
+  { teju_literal4(0x65f47cfb4ee0b76e, 0xb93fcb5d67d87d1f, 0xfa77c736efb75b26, 0xe6e573641dfdd027), teju_literal4(0xb5f2fb99df94d475, 0x0cdd5a6f112d0ec2, 0xa606efe3688ce1b3, 0x2387e6a493d57eb2) }, // -49991
+  { teju_literal4(0x7b47d9d191916dd9, 0x04fe7b0a81b5437d, 0x4b42c9459c9dd812, 0x9895a599f92fbe9d), teju_literal4(0x8a3782cd90219662, 0xe667aed328901932, 0x21875cf7ed6eab09, 0x63df351c3ab060be) }, // -50055
+  { teju_literal4(0x502ec277cea86db3, 0xf1526a2e50a070d2, 0xf196263cd5eb2a89, 0xe5f54bdbbcb86570), teju_literal4(0xd1fdd81388bb3a10, 0x84add772e2c51437, 0x549b86e4f0dd8723, 0x41bb3f5097722a0a) }, // -50119
+  { teju_literal4(0xedad355a55af462e, 0x8ecab9dad41880cc, 0x539a07f398a961df, 0xbe70c6f50eb50db1), teju_literal4(0x9f84e6668729243b, 0x16d981d8bbdf1e29, 0xd724d5871bb0fd4d, 0x4b8175009ac61679) }, // -50183
+  { teju_literal4(0x49843d89b5f8ff01, 0x59d6b6816bbe8ffa, 0x6207dc13876a8b9f, 0xe28bc6180e737656), teju_literal4(0xf25b20c9cd5ed887, 0x86ffd0c542c040e3, 0xd46a5057e9a6959f, 0x66df1b36ba830bbc) }, // -50247
+  { teju_literal4(0x6585c32d69605176, 0x6d62dd6e146ba259, 0xbc42c127a0245dc7, 0xc003dcc4d038a71b), teju_literal4(0xb81ac72f635c493f, 0xbd6f8bf5d812f7b2, 0x2a84648e71bc3b50, 0x9600c123db75dac1) }, // -50311
+  { teju_literal4(0xf639ad60d8ac6e3f, 0xe1da349aa43cd6ac, 0xe0009e5f3123ddd5, 0xbcf00aca11d165b0), teju_literal4(0x8bdaadffbd3c0e5a, 0x200998d767634428, 0xc1588c8ee2a77153, 0x9c7bc9a386c05fc0) }, // -50375
+  { teju_literal4(0xf0350e7c9d89d414, 0x31ab4a8748daa32c, 0xab3882e374ac5937, 0xd2d3673e6513d5cb), teju_literal4(0xd47aaeea8aec224d, 0xf9451fc487f55ee6, 0x80f38728c484405a, 0x8623367ad131f5aa) }, // -50439
+  { teju_literal4(0xed63998c38389b55, 0x9fdb4cbec7957425, 0x31ca881167680669, 0x5dafa337ec983ded), teju_literal4(0xa168ac0801b4e64a, 0xfae33ff0941a9512, 0xf5a552b7a195bae6, 0xbd718e9aa98684f7) }, // -50503
+  { teju_literal4(0x42d2cce76b8497a9, 0x6f1fcf0fc8859fca, 0x642ae0fe96940905, 0x9caa7f7e9678aaa8), teju_literal4(0xf53a1e52140833fb, 0x1fb960ab5e4a8a31, 0x38aabbe4fcd182f7, 0xecd1f3b9dbd70d6e) }, // -50567
+  { teju_literal4(0x5178819749bfae8f, 0x44af7554d39a27a1, 0x538fd26710d0c1c3, 0x69852cb4663bb596), teju_literal4(0xba491c3155f1ff13, 0x99eb63aff9d3c5cc, 0xfc5e7ab05f53a596, 0xa34cb3a994e3c3f5) }, // -50631
+  { teju_literal4(0x42c4bdbd51a6c964, 0xe195a8630abe9a11, 0x4b6094d6bca84014, 0x53f120cd125dce96), teju_literal4(0x8d82d0674daa9dcf, 0xbf8b0ffca30ae77e, 0x1b8d109bf03c55f7, 0xd140e619560bd9dd) }, // -50695
+  { teju_literal4(0x9b3e8e748f3e0477, 0xa7bcb104f7d83eff, 0x3b383d5dc1364d59, 0x437b55177a5a94e9), teju_literal4(0xd6ff111770737408, 0xa77fde14f1fe8d88, 0x8d7c7ebd82db5ac9, 0xec11d1120b172586) }, // -50759
+  { teju_literal4(0xcee7bb774832b5df, 0x9e9132f72af35531, 0xe164aad0f0087470, 0x2b9327539e46df0c), teju_literal4(0xa3522ccaced860bb, 0xa44070e280c1b9c0, 0x2846d5c1518c8ba8, 0x80b0b8b951ffe514) }, // -50823
+  { teju_literal4(0xf3f60f8966c1ea7d, 0x0fd289d0ebcde92b, 0xf21a961160b7bea1, 0x260da97bd7c81462), teju_literal4(0xf821d0d9b1bf3038, 0x921627613fcb82d5, 0x5e7c8129225ac6fa, 0xdbdd0adcec88373b) }, // -50887
+  { teju_literal4(0x1d9a370a727bed74, 0xd3229cc16fd9f4ff, 0x3cd92c794161453a, 0x4ef38d650d5472b9), teju_literal4(0xbc7e0e72b0a012d8, 0xa41a6d61f634df90, 0x159e26c8789c24bd, 0xa07a609dafb11367) }, // -50951
+  { teju_literal4(0x8f80642a02d1c4fa, 0xf5eac5434f110411, 0xf8b64f7ab4a2ffaa, 0xa740b86efd3b67ae), teju_literal4(0x8f2ff9136fa89091, 0x6d7db3a36acd331e, 0x749bf97443e099e4, 0xb3973d1903def768) }, // -51015
+  { teju_literal4(0xb5d00b085a507683, 0x6984f16b5beed014, 0xaaec03111ba5de53, 0xe3c32d6becf8ec63), teju_literal4(0xd98b157b5d4cc7ae, 0xba1d85db108e07b0, 0xc85d035c4ac07a7a, 0x8a9124a7e55f437e) }, // -51079
+  { teju_literal4(0x9cd113fa0a3ed6a9, 0xce2967510a1080f2, 0x98d40f680019f746, 0x714cef2b36e9a90f), teju_literal4(0xa5417a10482cfb6b, 0x8efac3e015a33fc9, 0xaed30ca55e0306aa, 0xd6fa4f2a8373d4b9) }, // -51143
+  { teju_literal4(0xbcf453af0e4730d9, 0x940cf1eabe6462b3, 0xde47766114356d5f, 0xbd6b6b61d62ffd24), teju_literal4(0xfb1252c881d3ee72, 0xd5e3f1e44074a427, 0x52d803a7d6c66177, 0x7ac59afe3fd9ea85) }, // -51207
+  { teju_literal4(0x9649ffd041e22a8a, 0x0f35f60432d5961e, 0xf729f421190d75a4, 0xb6f4517b329749ae), teju_literal4(0xbeb9b2028b8240d6, 0x282de82699494c81, 0x45b7116aca53765a, 0x3a84d5005d076ef8) }, // -51271
+  { teju_literal4(0xcb3ed8eb7b93bd54, 0xa1993f2437c1f7da, 0xef93b4fa80c48183, 0x297c1acd787ba6e8), teju_literal4(0x90e23740fd01d891, 0xfd0a7d2e2999bb9a, 0xd1a52c453dbb46dd, 0x5f4a2b2bfca838d7) }, // -51335
+  { teju_literal4(0x4ec45744f4087f9b, 0x72f901ca45f95903, 0x55e353254b583472, 0x435d8b5c1a8589c1), teju_literal4(0xdc1ed33cd856f30e, 0x99dfc3df75f2e172, 0x255673937ffc28a7, 0x798bffdbe9b1163f) }, // -51399
+  { teju_literal4(0x8a2ee6ea2fe6b294, 0xd621b1cff07b405b, 0xeb6c234fecc9e59e, 0x0d1c9156a3ab789d), teju_literal4(0xa736a56e7ccb2848, 0xf83a58562c27d389, 0x0ea1c31ee3caea0e, 0x9109a560972a3d14) }, // -51463
+  { teju_literal4(0xf574b81ee037c7fd, 0x5a5034dce74454a7, 0x553e812fe917965a, 0x8a2eb26ce6edff6a), teju_literal4(0xfe0bbed6742224a3, 0xd0609643bb9f1fda, 0x9cfb36e1331a143d, 0xbee8e420ae58ab27) }, // -51527
+  { teju_literal4(0x3c3f9d4dc87b2e68, 0x5fc37ceb0881b148, 0x142ff11e4c788937, 0xaf7317536b43e9c7), teju_literal4(0xc0fc1b2cd3d97722, 0xb7c2a00ce9ecfa2b, 0x2cee6a8c6befa205, 0x06170cc49f2e120b) }, // -51591
+  { teju_literal4(0x725bc6913b853d59, 0x1958184222a2e460, 0x6488796ab798c517, 0x8fe01d530e69bdf6), teju_literal4(0x92999a5b0593f057, 0xbf69c94fe5940926, 0x49a6562bab1a2afc, 0xed53629b826a0d51) }, // -51655
+  { teju_literal4(0x4b6889f236611d9f, 0x1031c668fac1ec91, 0xf01d6125afd0dfb5, 0x46c92a44ac133a06), teju_literal4(0xdeba61c89dc15b35, 0xb49ffc0ef2855882, 0xf956e8e4315bb78e, 0x642fd7979a9006e5) }, // -51719
+  { teju_literal4(0x45c9fa5aa5441b43, 0xa0558447b20be067, 0x059fb4cbbb7df0c6, 0x154ec9fff225b380), teju_literal4(0xa931c0b0d123f853, 0x21ed40101c98ae8b, 0x45fb4b62e63fb690, 0x7473ff8272fb3899) }, // -51783
+  { teju_literal4(0x94c78d02daf74bcc, 0x35183a6a82edae1c, 0x9b7d8b570578e31e, 0x6fb389cf2f755c8e), teju_literal4(0x808718063ff67338, 0x85cbaa09c7d685e7, 0x4eb671a43157b816, 0xe4ec4a7b75c451a6) }, // -51847
+  { teju_literal4(0x9a91606e9d7efc4d, 0x4f153d61e5a02df6, 0x705d4cd9ac636132, 0xb089b633df0730bc), teju_literal4(0xc3455e7b04885896, 0x78b98b78cfc3fee3, 0x630dfd6d036f7d75, 0xacef4bec2c9a62f2) }, // -51911
+  { teju_literal4(0x8e59d2d959c3f605, 0x556bf6692b2f21e5, 0x328c972342e4ee29, 0x638eebfa6ee171f8), teju_literal4(0x945631fb5b72c721, 0xeceeced5a0c1262b, 0xd8029602670f4402, 0x0bff957fdd128288) }, // -51975
+  { teju_literal4(0xe8572c252a0da405, 0x55b456625bf310e0, 0xb899aa79aa7d1602, 0xb2ea6c091393e10d), teju_literal4(0xe15dd8d273f76f38, 0x89ebc9db9d401c69, 0x32535329c4e497af, 0x45440c8030dcf6a2) }, // -52039
+  { teju_literal4(0x076aa5c1a48768bc, 0xba2f39b89569ee1b, 0x4e9e36a9af8fb779, 0x7d0543cfdf7bc013), teju_literal4(0xab32ddd8a0bf770d, 0x89e382e798af80b3, 0x226a548866247b4d, 0x1a8b90f7cd69d5cc) }, // -52103
+  { teju_literal4(0xe104c4ed235dbabb, 0x02762cdbecbbc061, 0x1538841391a68281, 0xb25c96f1405f66d1), teju_literal4(0x820ce0e2cccd78e2, 0xd6f0511607a25e09, 0x2e7e7e26b1064342, 0xb34adc476fb51a92) }, // -52167
+  { teju_literal4(0xa6e7502a46df9300, 0x371a7c481364f936, 0x685de4558b468ec8, 0xf1249a094712be97), teju_literal4(0xc59590b4e0bf3d24, 0x9079098b1f0d733b, 0x0a8d7092a66728c2, 0x094549815ceaad6d) }, // -52231
+  { teju_literal4(0x087905a99b5b006c, 0x12a3d0c06fa359d4, 0xa0f0f468d493851a, 0xc45e52fa3647849b), teju_literal4(0x96180deb20b6b09d, 0x5bd903174eb239a5, 0x394004e9075f243d, 0xbdc96cca3080161f) }, // -52295
+  { teju_literal4(0x8a4fe6b75d143b5c, 0xcb49d7a3667ec0c4, 0xece080c39a724e95, 0x2d21701b9a55d230), teju_literal4(0xe40950560311db3b, 0x246c8984250c797b, 0xf33408f11c44185c, 0xcf82350859276ccc) }, // -52359
+  { teju_literal4(0x4c720f57bd8fa448, 0xd71ddb9e029aa524, 0x93dd26cd08cd897a, 0xdd4fc1f83058383d), teju_literal4(0xad3a0f1de1e58a91, 0x3d869437c8f4edc6, 0x5b48e37b60ad5e62, 0xd3f2d73163fc8f56) }, // -52423
+  { teju_literal4(0x6d729009a11fa815, 0xdfd1cdae5aac467d, 0x0bc939c3ff97e9e3, 0xd08627490e819b1e), teju_literal4(0x839747d7d5ae1c60, 0x285551cfa5733d80, 0xaf2a17bf326c2505, 0x9b116c446486cfbf) }, // -52487
+  { teju_literal4(0x308fdb963fdcd122, 0x39229b0eec69bab5, 0x04027f1592c8d57d, 0x4a4fd9519d0e05ae), teju_literal4(0xc7ecc6e130de505d, 0xf38c2ed7b7238080, 0x03568f6d2e103500, 0xf1bd1744bd0931b5) }, // -52551
+  { teju_literal4(0xbb73d98e5a7cec6b, 0x50c557f9d4232882, 0xb7d579d27e4c7eca, 0x4be6ee23d48caa70), teju_literal4(0x97df3e2356f86117, 0xe9e7218a390acb92, 0x313863f8ecf9a1b5, 0x52e94b45cc2f9afb) }, // -52615
+  { teju_literal4(0x23fcd850503d1068, 0xc449070483130f40, 0x26628fa8b93918b1, 0xdaa37e3f92a6500c), teju_literal4(0xe6bce097aed519fe, 0x70a9383cb7008d5e, 0x40b5bfcfc3e58e65, 0x5200515babe3a49c) }, // -52679
+  { teju_literal4(0xd1518217de0d1226, 0x173609335ed5c6ff, 0x11b5970f89509882, 0x63cc3495a0e57622), teju_literal4(0xaf4766efcb3727d3, 0x06e5ee50b7752e58, 0x3a3d732e074d34f2, 0x7b11684fdfde8fac) }, // -52743
+  { teju_literal4(0x8e18bafb7f39369a, 0x24e27739fac2717c, 0x7eceabffb270e896, 0x06cbedd3fbf44c47), teju_literal4(0x85265ae64860be84, 0x9ac394e8b0202fc6, 0xc4f0cf1491397400, 0x1a4b3eae44f1f1e1) }, // -52807
+  { teju_literal4(0x7b7750e57c09f3af, 0xff7815aee8c1ce88, 0x490d416d6eb11a96, 0x0f5f3b64dd6fed4e), teju_literal4(0xca4b1646819482f9, 0x9fb314d6165d4a9f, 0x9456de9d2c6e249a, 0xb063751bb080932d) }, // -52871
+  { teju_literal4(0x64cab03dd497eb77, 0x6cc444ec580d2b26, 0x6676a7c8c7e0301f, 0x80722b8241f2bef3), teju_literal4(0x99abd2cd70800e66, 0xee3ff7a356513a57, 0xbdbe817b001dad2f, 0xc57a627f56ce9095) }, // -52935
+  { teju_literal4(0x1af6048a18dd2b31, 0xd7e842c56763b542, 0x031a517476fc2ebb, 0x6c051c34ef46f1ec), teju_literal4(0xe978a22573452269, 0xb2b61171cde281e4, 0xfa13c6cf6f2574d4, 0x6c5fd16cf5a4c705) }, // -52999
+  { teju_literal4(0xdebada8f8fa5cd61, 0x2267796c7c3984f0, 0x86cddd825b7ce768, 0xe4cd54a8af523d12), teju_literal4(0xb15af7f57b3dbc54, 0x94df786d378fdee0, 0x8285fa602b296895, 0x3306d1fcb647413c) }, // -53063
+  { teju_literal4(0x61181056b0d52aa2, 0xc58e89a8a9f5b3a8, 0x6e538dadc4a7e9d3, 0x7cd6df4c1e3c250e), teju_literal4(0x86ba28398aa775b5, 0xbbb0a64237c392ed, 0x1356fff99b78d177, 0x001d6c47f0dc3b27) }, // -53127
+  { teju_literal4(0x64856fffbbeb55e5, 0x5f197325e5d605c3, 0x5f1ebabd5a41fb43, 0xd79ceb6de8899ea8), teju_literal4(0xccb0946be5421894, 0xfa04fb4ebb75c3eb, 0x15656de9fbd4a837, 0x23158c4f8ec43527) }, // -53191
+  { teju_literal4(0xfa73d2e4c38207cb, 0x61c26b970f212464, 0x3d3cdaec9c7d48a9, 0x58c024be0be810f1), teju_literal4(0x9b7ddc43e32cdd28, 0x487721570bea9453, 0x0a09e747f7e015bf, 0x7c7c9e0462d99140) }, // -53255
+  { teju_literal4(0xd86b0c0eab7b0fb9, 0x87fa7a501da76e18, 0xe562fb8ce7175d9b, 0xffa6f7f872999f72), teju_literal4(0xec3cadd7c3d60600, 0x87ff3f0b69f0a395, 0x3a1625a87ddb4d2a, 0x4546648467c6bfd2) }, // -53319
+  { teju_literal4(0xfefe4ba6db3dae74, 0xe012a3085b886fc2, 0xd8d0092d38f14d6a, 0xa63af20a777dbf4f), teju_literal4(0xb374d50ea1f6c04b, 0x96dfe8c1a0432b64, 0xb268cefab5b6d334, 0x1ce22d90479aaf74) }, // -53383
+  { teju_literal4(0xcd296d0f4f8f3a14, 0x2a561a2d55f10fe5, 0xe908283cfc973531, 0x4ac827b27acfed05), teju_literal4(0x8852be27fb0960d1, 0x938677da7ff0a603, 0x9468bfa24f873301, 0x71f81b72bc226f05) }, // -53447
+  { teju_literal4(0xab7c601f442556eb, 0x088fb7713fb8104f, 0xbe660ad6d89342bd, 0x69bf723409bdaefa), teju_literal4(0xcf1d5719b7a5af73, 0x6ca1ac250e2e5ae6, 0x2b6d263c802362f4, 0xe5a202d857e9ae85) }, // -53511
+  { teju_literal4(0xc3df1b0c65545533, 0x72f0e896ef9b036b, 0x5849ef92cf4b3ccc, 0x60efbffb3da2a04f), teju_literal4(0x9d556b12bd19d1a7, 0xbbaedec1bc26991f, 0x3fabe5eb0ae805de, 0x2291f7b94f885489) }, // -53575
+  { teju_literal4(0x4ad6635d14ee6188, 0x8e976a39b2a524f2, 0xb5cc86678f439d1f, 0x10b740589e531109), teju_literal4(0xef091cd26d416cf6, 0x3de83c3d09201f63, 0x18dd683ea71631ef, 0xb0287b02b50eed98) }, // -53639
+  { teju_literal4(0xb1defca75ad60a54, 0x90fe0644a1df49b8, 0x80f211b265207428, 0xd507067965d7446e), teju_literal4(0xb59511542c617654, 0xaf29b677d9c98fbe, 0x1638bd67e5ec99fb, 0xdf80b784cbe4c5f6) }, // -53703
+  { teju_literal4(0xdb0f57efc8e3be99, 0x6bd34e083f33e5ba, 0xc94bdb52725a1a01, 0x6a0e209432a7f948), teju_literal4(0x89f02b33732491dd, 0xde2e652b2eae985b, 0x982fe7c5d31f5b96, 0xb6d55c53534c484a) }, // -53767
+  { teju_literal4(0x4e2979c25051e0d6, 0x1341ed022df11fcb, 0x241afee6cd47b63b, 0x5b1cb1310772cfac), teju_literal4(0xd191745a63dab4d7, 0x2aaa1243216fb3ee, 0x5465a448b74b84d4, 0x6788f08fcc480eea) }, // -53831
+  { teju_literal4(0x7cd9acda36fb7e51, 0xc17c29aebeb19f49, 0xd2653770edb3efa1, 0x01ee41c96079ceeb), teju_literal4(0x9f328ff83b058b83, 0xc8354fc494283bd5, 0xec059f3fc5f621e1, 0x1517a02607c7a7c4) }, // -53895
+  { teju_literal4(0xcf2a055cd7f74b86, 0x04de5341c4b64df0, 0xef5b9760cd5b5f92, 0x5511489fd6656a09), teju_literal4(0xf1de08857a08f497, 0xa95bbf9c57c72bf3, 0xa1ae553a2848bacd, 0x5bc72e8d6fb243b9) }, // -53959
+  { teju_literal4(0x355a9b17f5cefe2a, 0x6769092719a64f1e, 0xa2377a69eccca872, 0xefeb57687acaceb0), teju_literal4(0xb7bbc018f214f009, 0xc0c02833d4b85d2d, 0xf264a9fa52c56885, 0x554fea4ffaeba4e2) }, // -54023
+  { teju_literal4(0x3d5f5c6bf23cff86, 0x8839b669b1924d75, 0x7b92a61286d135b6, 0x95ca57a6dfe9d94b), teju_literal4(0x8b927e09cb8b310b, 0x705c98a376c1103a, 0xc46bb881ebdea24a, 0x9ec4cd643b104067) }, // -54087
+  { teju_literal4(0xfdc88167a6f4504d, 0xa6d1a2c47b5f3cb8, 0xfbef15c67212a0f1, 0x3fb36f4cf5d2d62b), teju_literal4(0xd40d027b2cb04d9e, 0xf316b7cbdebe3979, 0xe40a0803ee71282b, 0x259992dffd665687) }, // -54151
+  { teju_literal4(0xcc240d231f3ca708, 0x4b8c9626a22c3e32, 0x55764343d868785a, 0x37bbc981401d8575), teju_literal4(0xa1155be56082232e, 0xb242d651b81e9cc3, 0xf6303953daa03723, 0x70086d55049d6631) }, // -54215
+  { teju_literal4(0x827ee3d6a22624d3, 0x84435eef0d852994, 0x5113e808b8927713, 0x561c07d169b0ab64), teju_literal4(0xf4bb8aae19ad8d15, 0xf1126cdb9cab7fcf, 0x5a0e888de362ada7, 0x590a59f53d675720) }, // -54279
+  { teju_literal4(0x757a6e182455dd73, 0xd9b9883c834d1044, 0x337b88d952c80c2e, 0xcfd6d7f59e940603), teju_literal4(0xb9e8f4ea64e4814c, 0x1df0b818b229f861, 0xbae1659f1fc8a491, 0x1a4313359219904c) }, // -54343
+  { teju_literal4(0xb53d987bac74c63c, 0x782a72929acc47d5, 0x6cdc176df04d8442, 0x0f960a697e90cc8b), teju_literal4(0x8d39c585613086a2, 0x28f81cebd8678a0a, 0xf04a7fe25ddd1574, 0xa97472344c14731a) }, // -54407
+  { teju_literal4(0x5022207834dbe39c, 0x24f674e6f75100fe, 0xe19ced2356bf8820, 0xdd0ea82c14bf7676), teju_literal4(0xd690180cf75fd026, 0x830a4cde8d89fad6, 0xcab5f895b311b773, 0x1ad449b82c803e47) }, // -54471
+  { teju_literal4(0x8bfd1a1f2e984780, 0x2562d6869fea82cc, 0xe68d59ff270ba418, 0xffd0cc507b934e44), teju_literal4(0xa2fddffe91f2909a, 0x6b2d57227ea3076d, 0x21730474aa6ad818, 0x9e18c028e8043346) }, // -54535
+  { teju_literal4(0x3fcefadac67222fe, 0x55bb80a144590b73, 0x92a219cfed753f18, 0xbb2e0ad61031c56d), teju_literal4(0xf7a1bd578aa40c57, 0xc151f67bad3b929d, 0x0d60087271b1530b, 0x50fd82508532035c) }, // -54599
+  { teju_literal4(0x3d61563cdc264c77, 0x1322f04bcb783457, 0xd722ad4b545ca78b, 0x93b5481358f45284), teju_literal4(0xbc1cc3914298dec4, 0x21e7c34de1bb2bd8, 0x0e105e5936de8ca0, 0x3e81aad8e134a02b) }, // -54663
+  { teju_literal4(0x3376a57b1a29f15e, 0x5c6e6780e5f102ca, 0x1f68620f882f8394, 0x93b082d84c3b3c21), teju_literal4(0x8ee610ad9c6aa89c, 0xb9603b79eb4639cc, 0x423b3514305e4c66, 0x6d0c71d609717e7e) }, // -54727
+  { teju_literal4(0x284fd525eb1a96b5, 0x26d7db21ba4edba2, 0x2b4c2500ac4832b7, 0x9627918e39260dbb), teju_literal4(0xd91acbe518aa01f9, 0xe837a5dab1245622, 0x89997a0ece1b1088, 0xa3bf3fd25314009d) }, // -54791
+  { teju_literal4(0x802ded4adb29aa5c, 0xdbbce05b07410b9c, 0x57fdc7dd75ae64d3, 0x5c660835db0ec093), teju_literal4(0xa4ec2d9c305b12c1, 0x36adf4193ab2f17a, 0x02789df4d045c5c3, 0xe7667a289fa14624) }, // -54855
+  { teju_literal4(0x697c96eb67a22447, 0x69749f04d25ad3b0, 0xb8b30a52a91b4818, 0xd653bbede7956a60), teju_literal4(0xfa90badc070f445c, 0x03d9d5fb85833caa, 0x20d7b772ca65ef88, 0x313a018f79423938) }, // -54919
+  { teju_literal4(0xd0d42b72da3cf273, 0x1f358f82051b76cf, 0xd5f8220464f2cb06, 0xc45ba1d3edc97109), teju_literal4(0xbe57401248c43701, 0x74abdbffee5cd321, 0x7340f8a00cc4430c, 0x05e5b2a3fa4b95bc) }, // -54983
+  { teju_literal4(0x8eca88b08b410c4e, 0x5eccbbe75ddfa9b2, 0x2ee2db816b575e27, 0x87d57b00fa01cd2c), teju_literal4(0x90976eb7798d9719, 0x8a4903ab02d3bb9b, 0xd6540521e909d1c4, 0xcfef84fc757027d4) }, // -55047
+  { teju_literal4(0x3440cce30f6ca791, 0xb90266a38f0138e3, 0xa5b8c998cf16d8b2, 0xed0c110138c5c99b), teju_literal4(0xdbad351e246261bf, 0xcff2b640a3c40d98, 0xf6954e60a4dcb4ac, 0xf954a0e328ef4289) }, // -55111
+  { teju_literal4(0x31c048e98c830b08, 0x3eae55bef2a50e54, 0x753c0d4ea7e49666, 0x67847dd6e087d95d), teju_literal4(0xa6e0564b370a2051, 0xbcb0853afff496cd, 0x47a0d577a01ae088, 0x75e29557cad58169) }, // -55175
+  { teju_literal4(0x8a266e1600acca92, 0x01909bc64c2bd638, 0x315fcd7596b00b4c, 0x3a9186d970e8e909), teju_literal4(0xfd889de5b44804ea, 0x5bebb450673decfc, 0xca1b7fb4f71d52d8, 0x974e6b7193563be8) }, // -55239
+  { teju_literal4(0x1e4a4c1ee589ea4b, 0x87583c4c2d48df1a, 0xfa9c69a17227c3a9, 0xb6d77f8e3ae3d682), teju_literal4(0xc0987eaeeab7a8ca, 0x492deb96c0940cef, 0x463fba005470b4f5, 0x530c103abc34845f) }, // -55303
+  { teju_literal4(0x9d3fd1b16ec350da, 0x1a559756aaa8bad3, 0x9165172247d46dfe, 0xd95eff669d86ce83), teju_literal4(0x924def061324a14f, 0x900e0a4650c0c4c2, 0x4cdfe08d70dee77d, 0x169fe1782ce7ecc2) }, // -55367
+  { teju_literal4(0x8ca4c6665ac1e2b8, 0x69cf71b3a01e7640, 0xf5423cfc3642d389, 0x01599ddd43886b0c), teju_literal4(0xde476b18bf6fdbd5, 0x0df27bad3532c4ca, 0xde45a5ec406a5810, 0x43d3d9d75a80e041) }, // -55431
+  { teju_literal4(0xb106e78854a90742, 0x6b09d26ceed022e7, 0xdb231e02c604d1df, 0x2a8d2e428b711c10), teju_literal4(0xa8da6bcddb1f7a8c, 0x584518a7b62ebd56, 0x6a4901c877b58266, 0x9cdc70499f28112e) }, // -55495
+  { teju_literal4(0x874f03bfe767eeae, 0xc651da0dafd43afa, 0x424f3ce2d89d7cab, 0x88da0aebeb496471), teju_literal4(0x8044c0b7ca9dc4e5, 0x98ebd8c4d3604785, 0xb4e5e6cfcfe121a9, 0x234fbf18b1136ce4) }, // -55559
+  { teju_literal4(0x26dd5079b9c06d67, 0x693fdbc3062ddd42, 0x453f0c582aa9ea32, 0x447522935500027f), teju_literal4(0xc2e093e609a08c84, 0xfec5ca3aac98463d, 0x513687f9bd6d1d4c, 0x04dd6730c062860b) }, // -55623
+  { teju_literal4(0x062df18cb6c70888, 0x271267054285d2e5, 0x3e6a3b2991536d06, 0x9e14c2a7fd1bdfaf), teju_literal4(0x9409a12b2dcefb6b, 0x84cec42ed0d7a280, 0x04a7860dad3edbab, 0x0c329b55974f4e13) }, // -55687
+  { teju_literal4(0xd60ea91a58f97ada, 0xd2158f76f5520363, 0xf7cc781770175372, 0x7e38aee157953107), teju_literal4(0xe0e9857c744a5e6c, 0xaf67d5b68490fdc1, 0xb5aedc7440d5949d, 0x9a345065fb955cc9) }, // -55751
+  { teju_literal4(0x9d2824b18b739145, 0x20a9870c4dd506fb, 0xca3e356c015aea92, 0x21ba17e2c811a811), teju_literal4(0xaada801c2cf70c59, 0x7634c6eb01652844, 0x6975c23926cba0f5, 0xdae9aef7c56e7885) }, // -55815
+  { teju_literal4(0xe6adc3a156426192, 0x61135a36e85f522d, 0x4787bde086b1ca13, 0x94c672d6aedc86ec), teju_literal4(0x81c9c0633fd47845, 0xf97106b995a410b8, 0xea32f5ed1bab21b7, 0x8682e747bb03dea8) }, // -55879
+  { teju_literal4(0x168bf30c5de46dea, 0x8b31e39301dfe2f7, 0x31bfbc29d0b48586, 0x8542b7404af932cb), teju_literal4(0xc52f9474aed41a3f, 0x6274b9cc81ab2405, 0xc7f6ed3c118d25e7, 0xc2e0964ff4bb0821) }, // -55943
+  { teju_literal4(0x45c41588ceada7f5, 0x238e5d3ef6e30feb, 0x77f414bd595fd2b8, 0x19912801d546980b), teju_literal4(0x95ca94e7c5c47c9c, 0x3e1f2eaa466b0218, 0xfca388084673e8eb, 0x8bd6b915f91b4620) }, // -56007
+  { teju_literal4(0x48a16c775d63a8f2, 0x14ba69336836cd38, 0xb6822fc9a1a165d5, 0xc1f82b78416438eb), teju_literal4(0xe3939c3889fcd8a4, 0xcefd021ad5af6073, 0xe81413a8f35ab7e2, 0xf74852191049ed9a) }, // -56071
+  { teju_literal4(0xbf724fcad545301d, 0x2e20eeacc7122878, 0xf427f4e878e6f6d5, 0x0db07be1ecb64fc9), teju_literal4(0xace0a564bb7d50ce, 0x53bb5547bd7739cd, 0xc7219927e98481ba, 0x28cae32085f6f7ec) }, // -56135
+  { teju_literal4(0x54288fe544199a4a, 0x2d423ba5d3cb9933, 0x594c378fe5573445, 0x33c8d3456393fdfe), teju_literal4(0x83535bc50a233576, 0x9e14848cc1e9d8db, 0x759a1fbb14b4ef00, 0xa9a374806d6ec363) }, // -56199
+  { teju_literal4(0x70380586045434d7, 0x435ef053e1b04125, 0x25c8101605d551c8, 0x1330877cda484ecd), teju_literal4(0xc7859556c85009aa, 0x0ab8c42fbe041c22, 0x5643cead5906887c, 0xe63204433af1eefc) }, // -56263
+  { teju_literal4(0x91f04d25e13b0e67, 0x065686f0583c1fb1, 0x717fc6d22e092dcc, 0xadb94e6e63da0c68), teju_literal4(0x9790da2c9e078ba4, 0x36db1cea9a5bada8, 0xce44899e72c3cce2, 0x4ca10c1a12f8a322) }, // -56327
+  { teju_literal4(0x6c2b51f51f7674bd, 0x74dbeaf8dba40585, 0x8e661d3f3c2db838, 0xf865410d2c940fe0), teju_literal4(0xe645c784ddb346e1, 0xd21d01690b66dc26, 0xd65db642c131a9c4, 0xeaf5a7cecc81580c) }, // -56391
+  { teju_literal4(0x66220d4be73cbe18, 0x648a218dc40fccd8, 0x3ff2e9afbb1fc046, 0x810e146ba0788d83), teju_literal4(0xaeecee0d39730db7, 0x042191d92b00437c, 0x296ef14c5b29e23a, 0x92577040437ee9d7) }, // -56455
+  { teju_literal4(0x036b7ec2a88bdbf9, 0xdbdb4c1aa1157517, 0xb8757451bb95bf02, 0x972c3e5c46ea1e61), teju_literal4(0x84e1a0d6dceb7ec0, 0x6f4f79e17603eeb5, 0xcc09c27016f63bf3, 0x5fe48db8a120b2c6) }, // -56519
+  { teju_literal4(0x417c1b09c8e76547, 0x3cf0885fcef18ade, 0xcc672e1fc6e12d83, 0x1610aff136f49f1c), teju_literal4(0xc9e2abc7e776dd6d, 0xa6d0e6f5892133d5, 0xff0510d749b69dac, 0xd92a158bcf5e9104) }, // -56583
+  { teju_literal4(0xc16b84cd1f65813c, 0xc0c550f71f177892, 0x0d118e4868517a51, 0x4deb48e1456b9a74), teju_literal4(0x995c811ad1494f83, 0x749e1e9e9d5ff9a3, 0x145a4cb0c40b505c, 0x70dada8e75651ee6) }, // -56647
+  { teju_literal4(0x549bc3bcb3add333, 0xce6bb6553a584566, 0x525267ec5b8b90ef, 0x122659d9f1213b2c), teju_literal4(0xe9001fe2bedc85e8, 0x8f82fe26977a8472, 0x9b5138b8830edd2c, 0xa0c93694da00c383) }, // -56711
+  { teju_literal4(0xbc68c4b1240e7382, 0x4e0d24109d36597f, 0x702c948b8c96d9ed, 0x8f4319b3f3a5751f), teju_literal4(0xb0ff6cb324a64052, 0xf065b02c6f1d49f7, 0x6f4d1d588b03e19f, 0x209bc4cfaf80e5a4) }, // -56775
+  { teju_literal4(0x2aa328039f996686, 0x02f274254f381352, 0x8b7649380ed37cd2, 0x21df5c4cb9b96a54), teju_literal4(0x86749dbccd9cda5a, 0xfb9e2f968e39ac88, 0x8b14a96cb59dbb92, 0x771ed7c619da2d1e) }, // -56839
+  { teju_literal4(0xbab492d56087e344, 0x398bb6d2bfd072ce, 0x2ab6fc5f742ce270, 0x049f6050baec30f3), teju_literal4(0xcc46ed44020e9f8c, 0x4e6047916f7105ca, 0xbac5ffe1cc7aa200, 0x5926db51eec6b24a) }, // -56903
+  { teju_literal4(0xdbc996a6016e2bbe, 0x2ba8127610be69e9, 0xdbc9d52766bac289, 0x4aa3ab552ad3e082), teju_literal4(0x9b2d9a0464854938, 0x36084bcc20b7aa9b, 0xf547393a72f4a17c, 0xd5225c15736d2e52) }, // -56967
+  { teju_literal4(0x68936158110e4613, 0xc65648734726f32c, 0x7f39a656caf15024, 0x44dfab3c8443bc0a), teju_literal4(0xebc2be1dcde7bd9c, 0xecf81f63b9c943de, 0x938e82d0485abe95, 0x6a5acd6d439f1419) }, // -57031
+  { teju_literal4(0x105335c4ea8d5530, 0x150d1ae298d612e5, 0xdf125ea3f929125f, 0x389afaea5717641b), teju_literal4(0xb318342c6f262c3c, 0xa6a2f2ea235d4b8d, 0xd4ed64877487edac, 0x5b3eae2778882bd3) }, // -57095
+  { teju_literal4(0xd89b7bbc7076416b, 0x2a86139dfde7cd72, 0xb4a8cdbe3bcfff9d, 0xf725c0149683cbc9), teju_literal4(0x880c60c5d43daacd, 0x5610435e051c5671, 0x21c613609e9df4f1, 0xb5b6b622a71b7e89) }, // -57159
+  { teju_literal4(0x2a32cec6824e7d0a, 0xde5e1bc637da6f3d, 0xa5822fbb35d59368, 0x57a8bfe39c8e175c), teju_literal4(0xceb26f883588e90a, 0xa0e569c789989392, 0x089d694a613ef544, 0xe289bcc7de4602f9) }, // -57223
+  { teju_literal4(0x5fef786567bbd7fe, 0xe193a507929da3fe, 0xbb0ff57b18159cf0, 0x488a13c7c6631473), teju_literal4(0x9d04356cdb598b2e, 0xdf782c1d627c442a, 0xe4b3b79b2cb2968c, 0x6b501662a6163dd5) }, // -57287
+  { teju_literal4(0xa827e61449e16e28, 0x28fcf045891a6dcd, 0x041ef81eddc77746, 0x155e271d1d4620c3), teju_literal4(0xee8dbb4cdda54bfe, 0x9b405933e2cb91f4, 0x5641f1a6651c68b5, 0x20edc59b3348fcd7) }, // -57351
+  { teju_literal4(0x019ad8b9f44a6231, 0x9d8ed0c831c0ba52, 0x6adfbe1ff718e85a, 0x5ee7503409734487), teju_literal4(0xb53757882a788e77, 0x69412ff6e1a4309f, 0x9ed9d16bfa7c4584, 0x2159401f5ae2853b) }, // -57415
+  { teju_literal4(0x5f19ee16b03999a0, 0xd406612dee25c66f, 0xbd33afbdc041b260, 0x435a70cea3a46016), teju_literal4(0x89a8f86c4d79d57b, 0x3994d8ca06ed22e1, 0x465028780eb0a13e, 0x167d261cb0a762a9) }, // -57479
+  { teju_literal4(0x0edf58188cc8a0f1, 0xd4e7b77fb3b0e852, 0x397e65c2649b1273, 0x1c693550f3daf7f2), teju_literal4(0xd12548938c9b23e4, 0x9028197f0e1baaf7, 0x28e6628bded5ccb9, 0x7f424dfd2c247d80) }, // -57543
+  { teju_literal4(0xfbdb837b8ba3221a, 0x264f82b282737225, 0x1ceb245ea3c5dae2, 0xe21c6e656531e3dd), teju_literal4(0x9ee06409ce20d2c2, 0xf50b497ebf494f06, 0xee1779bd9906e8f4, 0x471ff3bbd08ff317) }, // -57607
+  { teju_literal4(0x65260d4da0116108, 0xa274d3b00381799c, 0x8de27e531ca00965, 0xb7c444c0e4c37edd), teju_literal4(0xf16130d2d75330f9, 0x92f8f430f8e2b4fc, 0x2b7c087dc010c0ce, 0xa71751783d2fb87b) }, // -57671
+  { teju_literal4(0x2666bd124710c04a, 0xce327a0369e2d5d6, 0x6c9a4ae205d2d04a, 0xaf6ebffa83962b21), teju_literal4(0xb75cea0f34d608d5, 0x23ca5314ae69d705, 0x78c1b4aebf317e7d, 0x83ed2120245de691) }, // -57735
+  { teju_literal4(0x17914f7f60647565, 0xe1e96e53e5a1d3be, 0x81677b3b5f9d8bc1, 0x2b7ff194688c4bf1), teju_literal4(0x8b4a73567e3bd587, 0x08a6d6d40bd56b04, 0xa7e45031c90d5af2, 0x15d63a1f6cb6710f) }, // -57799
+  { teju_literal4(0xe9919ebdb6b210c0, 0x903f53639ced8a48, 0x39056c6429ace4c1, 0x66bda20af94044de), teju_literal4(0xd39f8ea7c72e0b58, 0xc27a1afccf641fed, 0xb60f0cab00db59a7, 0x6d7b0f748cc954f0) }, // -57863
+  { teju_literal4(0xd349a2b1b656a088, 0xe0f89152387d34a9, 0x3c4efb8ddb148602, 0x7aa08d81be608bf6), teju_literal4(0xa0c236c381d3d82c, 0x2a07b82225ad6035, 0x4bba5515e8e7613c, 0xbfe5ae6ffd4f05b4) }, // -57927
+  { teju_literal4(0x1d86104b63540ec7, 0x911d301d5da7cb45, 0xf26b10935077b510, 0x430c749caa4ebab4), teju_literal4(0xf43d385fa15d13e4, 0xad97330d2e6b0c06, 0xafcef8b48b9e4f87, 0x167a9e89f69a5294) }, // -57991
+  { teju_literal4(0x41ab0c4f9e02955f, 0x96388ca5c69c5241, 0xc27b0bf2ae3963e3, 0x2d69f225f3dd8f95), teju_literal4(0xb988ff44e873ec56, 0xe2336577d3d3b805, 0xe0aca7912a3dab09, 0x1cc200904d6203ae) }, // -58055
+  { teju_literal4(0xa54cb00a0ca98c8a, 0x75aae78070e551bf, 0x5f0303eb6a566ebb, 0x29f4391bfea9342c), teju_literal4(0x8cf0e05718d4e732, 0x5f9f3d47a57f7dca, 0xa64f2cfdee1a5a4e, 0xbd961da7531804a0) }, // -58119
+  { teju_literal4(0x209e23a0d9f67d8a, 0xaf3b9d769f464b9b, 0xce5fdf713c1052ee, 0x3c3ab59ba4f92f55), teju_literal4(0xd621584a24ab83dc, 0x508d4cfb091aca39, 0x98374cbf78fde4cc, 0x8230accf6a099a42) }, // -58183
+  { teju_literal4(0x19e61eb34ca8bce9, 0xb49dad917d849306, 0xf4a8a0d654139529, 0x95f0cb3036f97771), teju_literal4(0xa2a9beb581b7395c, 0x387a1417901d703b, 0xafc419f5c210027f, 0x0623006b32140a46) }, // -58247
+  { teju_literal4(0xd3245ed9122d7f93, 0xd19b1c1a90990a8c, 0x857d7c632a890710, 0x6b77862f6f6f782e), teju_literal4(0xf721ebf108d81417, 0x0761613e6c4813d1, 0x48cc675016953748, 0xc5edbedbaacbbcf6) }, // -58311
+  { teju_literal4(0xd4260d08f3681324, 0xfcd95a9fa6fa429c, 0x72c975bacbf49818, 0x671cfaa49b2520ba), teju_literal4(0xbbbbaae7cce19bd1, 0x47018124fba73888, 0xb07774523f5b9dfd, 0xa602b4aaa0b4cc35) }, // -58375
+  { teju_literal4(0x4b4177bc924a0007, 0xa1564134e96e3992, 0x6e8bf24d541dd6c1, 0x4e0631b00a84e035), teju_literal4(0x8e9c4e6dc3b90612, 0x87237510ec48c536, 0x7e9f98cc7a571d0e, 0xdb30eb91940cd907) }, // -58439
+  { teju_literal4(0x277c235bcebd69ef, 0x54ea43a85b7f448d, 0x2b7da9ae3b3ac4ed, 0x26c33909093887e4), teju_literal4(0xd8aabc4430b1f990, 0x001ae77958c62702, 0x5a060dec239e3664, 0x5a60511c1a276d19) }, // -58503
+  { teju_literal4(0xda43a6e34a9f6bdf, 0xe52d7e58d8bc1ea2, 0xb827f25773346aff, 0xde9d87a23f54c8a7), teju_literal4(0xa4970d2f3adb74ac, 0xe2be945b026d6e96, 0xdb67c9c94acbe915, 0x383b8aa7bbca269d) }, // -58567
+  { teju_literal4(0x2f50396d084dd7b5, 0x6df8e3cea16814b1, 0xcf68bbf39d84a17a, 0xae53fff25bf7fa72), teju_literal4(0xfa0f65d3adc2aed5, 0xa15c59088849f0dd, 0xbb5bdff10e24fa96, 0x2c3b748657f8b2b6) }, // -58631
+  { teju_literal4(0x30a471a8d1d8dc87, 0x936a64787333aac3, 0x3adfd04cf07caa92, 0x5c6a6dfa36f0bcf7), teju_literal4(0xbdf500f24a7fd2fe, 0x6e8756e389061ed8, 0xc9106ddf575c179e, 0xc9e27a5908093980) }, // -58695
+  { teju_literal4(0xb5acd9cbc966f6af, 0x21dd3945c4ba9b17, 0xca7c6e021fd55c15, 0xa7900e91e179e83d), teju_literal4(0x904cccc7a1d386c4, 0xa4b045654e5b1b4d, 0x2dda322a399927f4, 0x9d0459f59242a45d) }, // -58759
+  { teju_literal4(0xddc52992929edbcb, 0x37dcbab37083b88c, 0x136909a3e17491b8, 0x3810ae359c8b5a71), teju_literal4(0xdb3bd1a4923489d8, 0xc4529ad0237aeb60, 0x0d3dc6db6f0ff32d, 0x8dfdb2dea5bf0829) }, // -58823
+  { teju_literal4(0x4a33b1018179d33b, 0x009f87a5d629afc8, 0xf28a02ffce5d9c68, 0x70da725015afcdc8), teju_literal4(0xa68a33b4997478c9, 0xc87fd3edce8b640d, 0x1ba5583fe8915a37, 0x925b8a1632df6afc) }, // -58887
+  { teju_literal4(0xf9e5003a695bb588, 0x289b5630ca7cdb05, 0xf1fa2cdde6bdb317, 0x0d667bdf4c988c54), teju_literal4(0xfd05c0a3f2111dfe, 0xde93c177868b6a27, 0xb73ffd3c527c16dd, 0xd3c8f885af4880a2) }, // -58951
+  { teju_literal4(0xcc482415c7d70abf, 0xe46a24becb2a4f85, 0x73e61d2070fe3e81, 0xeae2474d7b9bd4cb), teju_literal4(0xc035159b6018313f, 0xdd15a33b463e48c7, 0xe7c51193081fbb29, 0xf447946d7bb0e144) }, // -59015
+  { teju_literal4(0xc4fdc5c65e5e5c5a, 0x3e9321ee69980134, 0x2ce850efe01db11a, 0x4f6928efd8fe3441), teju_literal4(0x92026abfdc79234f, 0x937b7f5f53831e2f, 0x9afee94bd200a478, 0xcae7734a992bbf7f) }, // -59079
+  { teju_literal4(0xedb4e5f1efa0ef42, 0xbfb6f3ed5c5b65f7, 0x4f3318c188a4feb5, 0xba6e08e30f19dcde), teju_literal4(0xddd4afbfdd0f52c8, 0x0506ab948f959eb8, 0x184dc48a1700557a, 0x06719e006908d5a2) }, // -59143
+  { teju_literal4(0x066aebdd73be7629, 0x3dca8b1e79271ae7, 0x2a3d7791c60f8210, 0x7040e3a758744126), teju_literal4(0xa88343fea80e6000, 0x2fdc9b9adf655c7e, 0xef754eec10b3abba, 0x02a6dcdceca1b503) }, // -59207
+  { teju_literal4(0x1cf5d5895cbffbfe, 0x5b09eb8de3a69c48, 0x0496dc588c405bb4, 0xbf382edf8098e6a6), teju_literal4(0x80028ba775c75624, 0xedb0b0e1cdb0dffd, 0x20016e3c9bb69188, 0xb912dce871905e0b) }, // -59271
+  { teju_literal4(0x9ee693e08045749a, 0xdb7d136ea5756263, 0x850011941d8d64d2, 0xd4797f59eb7f0ee8), teju_literal4(0xc27bfd575a9b7aa6, 0x30f87c76993baf13, 0xf93c185eb474d61b, 0xab5bdd5f9d8a6621) }, // -59335
+  { teju_literal4(0xb61bfb6a1572f595, 0x3e86cb99f3798bdc, 0xbe8f7bf4048a666a, 0xccf2a2337f6e1548), teju_literal4(0x93bd37e02efc600f, 0x5bad68f3f239ffbf, 0xda72d507b07d6059, 0xf57be52c4a902e1b) }, // -59399
+  { teju_literal4(0xe544d3866d3615aa, 0x450ede41c78bc80c, 0x34142105d7da2691, 0xe29885ac847ddb33), teju_literal4(0xe0756e316617594d, 0xbe2564a7cca26972, 0xe5cdbaa62f0c4e54, 0x3842359c1aba33d1) }, // -59463
+  { teju_literal4(0x9387c2cd12d9000d, 0xc1976e5f99aa09db, 0x539ac6d819188e7c, 0xe703e4abba5ae37a), teju_literal4(0xaa824ffc30a4fe10, 0x22113ac875b4e504, 0xf6401f003c2d18e1, 0x34d6b8d2169916fb) }, // -59527
+  { teju_literal4(0xfbe811a0c574e84f, 0x08712b89fdbc4a13, 0x086368c634fcc40d, 0x7863ba5216e1a2c3), teju_literal4(0x8186c289ac4e4ad6, 0x935139bd438831ff, 0xc58fea99c61d9697, 0xebf09c549bea31c2) }, // -59591
+  { teju_literal4(0xd6d1ac81484052b7, 0x86f92eb28af024a9, 0x207c316087d3d564, 0xafde4962b454a0a4), teju_literal4(0xc4c9ccd88f0d1562, 0x0723a0fa0b83f146, 0xadf773cad2381c0f, 0x926da38d35751b7c) }, // -59655
+  { teju_literal4(0xea164ce8660e1890, 0xdc983dd7b44ef3d7, 0xde5a548be2692c56, 0x32ca5bbbbd43dcbb), teju_literal4(0x957d43e173e93de0, 0xceb6527f22ce26ab, 0x0d6f29d0a63cb512, 0xed26a423b1308639) }, // -59719
+  { teju_literal4(0xd0adfd9f79087639, 0xce0e5c2d79683846, 0xcb63df95ca1e340e, 0x3cc0cf7ea0ccae09), teju_literal4(0xe31e24dc19ad8dbf, 0xbd019669f09f83c2, 0x6375eac263ac4be6, 0x57b49a30419bac5c) }, // -59783
+  { teju_literal4(0x4e8170af7ab4526d, 0x771471f9150cf012, 0x24589289a03056db, 0x0a0a0ac6f9c88c45), teju_literal4(0xac8769d25fa3f8be, 0xdb305b0e0429aab6, 0xd5038e2eef3cd48f, 0x44404daa1ecb4335) }, // -59847
+  { teju_literal4(0x52e62952a2c350d6, 0x45e59c8bca0925b5, 0x71ed4ffaa68b75fe, 0x3813a697739bf836), teju_literal4(0x830f92c14beb9245, 0xff0c4d4b58b2370e, 0xe67598597f9ee918, 0x1d47d689ed6f6f15) }, // -59911
+  { teju_literal4(0xa2fd88346fcae931, 0xa918b2260374adbb, 0x2ec385e708122a1a, 0x694d900efdaad57f), teju_literal4(0xc71e991016a25d8a, 0x843c64e60c71845b, 0x773726c21e57e1fc, 0xc37083e30514cafe) }, // -59975
+  { teju_literal4(0xb7303d1a7bc5a84d, 0xfaf8316cf6568eb7, 0xd17e7e205f6db1b0, 0x455335cb2c96b2a2), teju_literal4(0x97429eac33ed3d4b, 0x6c481415a31392e5, 0x103a4f498b9ed960, 0xe9e4931398c22a07) }, // -60039
+  { teju_literal4(0xea0c63027507e7ca, 0xb5f784967e46f86e, 0x5beccc44300044f6, 0x962891b63b57721f), teju_literal4(0xe5ceebeb54dc8d16, 0xe55361adedcaacc3, 0x76c97943e65925fd, 0x5b6d61c272697387) }, // -60103
+  { teju_literal4(0xc6cb6c45057ef6e4, 0xba2fbc41150c22e4, 0x5d3c9baf9791e5b9, 0x63ac70e177009537), teju_literal4(0xae92a3dd68d534c3, 0x29fd383d64b33bba, 0xe3b78d9e5c0716d6, 0x7db2d381417670e8) }, // -60167
+  { teju_literal4(0x81465fc415f685a1, 0x277e461adb63fef8, 0x26aa69416d4433fd, 0xff6ce7e8b3fc566a), teju_literal4(0x849d0a40d154eb51, 0xe2a2354918513feb, 0x79f0c8eb9e33f9c5, 0x95eba6815a483386) }, // -60231
+  { teju_literal4(0xb632f3922759c5c2, 0xb7077ab4fbeed46e, 0x66414c9751cd3b37, 0xd6d1fac965ea99d3), teju_literal4(0xc97a772e8d1c7d2a, 0xf7171c5845de0914, 0x139ac82a57195ae6, 0xff2545dfe41511e0) }, // -60295
+  { teju_literal4(0x6a694ee530329455, 0xd73c6a6dee258ab9, 0x54a1075f8bd3f26d, 0x79998d9059791320), teju_literal4(0x990d58593670c59c, 0xe4db6a4ce4b42753, 0xd84b273846dfa7f5, 0x0a8801df92b7e583) }, // -60359
+  { teju_literal4(0xea02c77c916751b1, 0xb7f228087f1ed937, 0x96b9472da7563125, 0x51ef4509784fd821), teju_literal4(0xe887dbd3c108d45e, 0x4c465ca1b1e9c554, 0x27858636d1efc56b, 0x70a8a65983228673) }, // -60423
+  { teju_literal4(0x175df8d9cec38328, 0xe541b7ffc93d8ff8, 0x6a0b46457cbf07c4, 0xbf0342edc9a30c9d), teju_literal4(0xb0a410b12e437231, 0x9580dbd1fc65b788, 0x3580cc24f67d899a, 0x7c61e240fc125127) }, // -60487
+  { teju_literal4(0x3875ff8e883fad02, 0xfa6b3275fb04dcf4, 0x2801eb63fb2bdd31, 0x300f1e1950ecf061), teju_literal4(0x862f3725056db7ae, 0xf83233636c4620f2, 0xa94701e9b76b1d8b, 0x4f43beca0bc207b0) }, // -60551
+  { teju_literal4(0xf6432a9b39c6c2be, 0x55e03ab045539a44, 0x309cb1f2f6361591, 0x38eb8dc16129c38f), teju_literal4(0xcbdd7ca4d1638aca, 0xc3b7d5cbe7360944, 0x1354ec7ed07b59af, 0xd23bedc7976f4392) }, // -60615
+  { teju_literal4(0xdbe08a7bf3d5eca9, 0xcef2f30453f0e6b0, 0xc00a658e433800e8, 0x01924526eb0f4db8), teju_literal4(0x9add813213e7124c, 0xdee19462948c477f, 0xe846f9197dee0936, 0x231044b818a5b60b) }, // -60679
+  { teju_literal4(0x8ac524616d5cbc2d, 0x423bb38e17744de1, 0x4f9a4f343c7abe89, 0x9a3862eb58e78452), teju_literal4(0xeb490d54323b3330, 0xee5dc890df9c4ba9, 0x656482c46ff3041e, 0xe8769bf81a2ebc9c) }, // -60743
+  { teju_literal4(0x767cc44f67cf2a6f, 0x8b5b63323d3c1ce4, 0x31f6f5a333c9c1fc, 0x5adb1852409bcb16), teju_literal4(0xb2bbc319e9170550, 0x9106a6a23a892b03, 0x4a0c02eb5013c008, 0x46ca3daba16045b4) }, // -60807
+  { teju_literal4(0x3f47880cba16a6ba, 0x4463be91483d8b8a, 0xcd217c311e49be6c, 0x4185b9d8f2f76475), teju_literal4(0x87c627b57d8d7c12, 0xff277b5f2d4d1e9d, 0xea6042eeca5438f5, 0xa71e12d0b83265a2) }, // -60871
+  { teju_literal4(0x65d0dc3dddfc23f1, 0xe6c94236261ff655, 0x23159dacd7c265f4, 0xb0466f4607902be1), teju_literal4(0xce47bf24c869c521, 0xee92b1b890ff5239, 0xd9f3cebf39ac9ae2, 0x73ef9a6a63c32a34) }, // -60935
+  { teju_literal4(0x2dd45b7bb72cc760, 0xfbb826c83f42feec, 0x2267c87667d917e5, 0x83873091ef9f7d18), teju_literal4(0x9cb329b1c9d9d891, 0x9eb1ad5c6752b50d, 0xe2b510bfc152ddb9, 0x063e57f1cfd6fe09) }, // -60999
+  { teju_literal4(0x0d4b39ec7f66fb3f, 0xffc93bfac7b0e586, 0x145923084fda024d, 0x33a5419be6bebf3e), teju_literal4(0xee129976880d61ca, 0xa1f38a99789fc3dd, 0x1f60f689142eb6f8, 0x2cc3ba50854abf55) }, // -61063
+  { teju_literal4(0x8d8b3875274f5cd0, 0xffade82675b27ba2, 0x213bf23acb2b7559, 0x5889d7e7ce5c09e6), teju_literal4(0xb4d9ce1cd472aab5, 0x5637286c996c0dc3, 0x8666708e643ab20b, 0xcba16d6274388370) }, // -61127
+  { teju_literal4(0x0381253853727a14, 0xb5298e97e914aa93, 0x1cdc57cba7c5f151, 0x1d8d57826620fd24), teju_literal4(0x8961ea651d4b6558, 0x286c50dc3ddf2b72, 0xf7ecd7a2663ed1ab, 0x9baf6f6dc4b2be12) }, // -61191
+  { teju_literal4(0xddab57609155c9e7, 0x393ea45809f326c2, 0x3992d92b674f7e08, 0x1333c086cc47f52a), teju_literal4(0xd0b954a2225dd769, 0xf175518c12a191d6, 0x346515f3557a9518, 0xcd20cb1967f955ab) }, // -61255
+  { teju_literal4(0x4eff8b2313ff6203, 0xe8892f112e91a5dd, 0x7e14caa48c243dd4, 0x8b1aa34f583e0f98), teju_literal4(0x9e8e628550b5e6cf, 0x646daa96f6d79aea, 0x0bb1406dd1079dd4, 0x555bf35719e5963a) }, // -61319
+  { teju_literal4(0x85b459f15815cefe, 0xe25efe753cf484da, 0xf38e447cf36f881d, 0x4bad9435e53f9466), teju_literal4(0xf0e499909140b720, 0x829fd434acd82f61, 0xf237a26a9423c988, 0x476e6446a016bc12) }, // -61383
+  { teju_literal4(0x38f01b157f677a8a, 0xd5b61e7ddba4c1f5, 0xe5b754a993238165, 0x3e00784653a16ab8), teju_literal4(0xb6fe44f8da5687b8, 0xcb61a2af569649f2, 0xc9088a5f6129d805, 0xc7d5dec3713d15a4) }, // -61447
+  { teju_literal4(0x7766c86a08b2960b, 0x4f498a5900927d39, 0xfc2652136d59d717, 0xf1df517135dc0955), teju_literal4(0x8b028dd299d36e5f, 0x5a4551d7eed0721e, 0x0d109b052b8d3857, 0xf9228eca6b577ee5) }, // -61511
+  { teju_literal4(0x7f5beeeb881cbd05, 0xbd393996e83e6f70, 0x952f8564c14b2719, 0x7ce60e56c5f3c4c1), teju_literal4(0xd3325353223326b6, 0xbab3ea00f2806ddf, 0x719b0fcb9abb0138, 0xbfdfc128cbb35573) }, // -61575
+  { teju_literal4(0x90e989eddfbe54c3, 0xff2fd382ca5fe42d, 0xd30ac63eeec5d2e9, 0x268b8a58ee0c3127), teju_literal4(0xa06f3c8c335e0f7d, 0x4db8945dedd84422, 0xf0e0858b2c9cb762, 0xdf24d6abccd1b95b) }, // -61639
+  { teju_literal4(0xae69ce1e3cf97234, 0x7effe1d9fc1b1404, 0x8a65d02fa7c8bc7c, 0x1b8139d76e6275e2), teju_literal4(0xf3bf2744f20713ad, 0x437ee62049e06fa0, 0x308b5fd5d5c22161, 0x3dd19741955dd22d) }, // -61703
+  { teju_literal4(0x7ca3574bf6038cb8, 0xfb599aa466c798d8, 0xcc8dc32ef05f9721, 0x515231b8b34004cd), teju_literal4(0xb9293b27428f7ab9, 0xcef2963519faf0c8, 0xa67a892867802ef2, 0x888aec268a0a6103) }, // -61767
+  { teju_literal4(0x60924ff35a9510f2, 0xf6034c3e1eb07f56, 0x9ea05d28191c7ca1, 0x9e59a749fa7e8cd5), teju_literal4(0x8ca820c8fec9d071, 0x9858de03a3568999, 0xff6fa1f1f81e45f3, 0x74a4c6ecfd4a8d80) }, // -61831
+  { teju_literal4(0x330f718df2619f76, 0x5f57970b1a3281cf, 0x44ebec437439aeca, 0x6c0f0b6a31ce8ae4), teju_literal4(0xd5b2d1b167873dff, 0x92a86053e11c4476, 0x24e3e1a6dcba6804, 0x6155ccdc050a35cd) }, // -61895
+  { teju_literal4(0x0ec9d48449577ec7, 0x4729cda51ffe9f4e, 0xfe86d94f5166b5db, 0x8ab627298a73b087), teju_literal4(0xa255c8d92889c13b, 0xdc0c9aaa37b9469d, 0x72d02b29730fd6ad, 0x6b93c9e2f1aeba1c) }, // -61959
+  { teju_literal4(0x85c40482a81f61fe, 0x57affc8410d873b7, 0x53a57bb8337759e4, 0x282b7c027962ef94), teju_literal4(0xf6a25c840d062e1f, 0x7b34ebc0e547cca7, 0x9d5ca31b90f76bdd, 0xb0946e35bb8be7d1) }, // -62023
+  { teju_literal4(0xac6b89b68e5047fc, 0xdcf6dfa19bb9eb86, 0x66145e680290cbc4, 0xcdebaeca8698ae63), teju_literal4(0xbb5ac45c63b8f13f, 0xffd394f32e133bbf, 0xa79859ca30c47263, 0x0b4e2e6578c9e9f3) }, // -62087
+  { teju_literal4(0x8509af0a69685ff8, 0xfc94d8c741074cc7, 0x6a996e68256c75b9, 0x5e07c74336e17181), teju_literal4(0x8e52b24034c17605, 0x232a4f0bc28df32b, 0xafaa339c1534d3a9, 0xac91a9804a8e2408) }, // -62151
+  { teju_literal4(0x73064e90aff84049, 0xfd415d6d496bab14, 0x6241ede327d55362, 0x46c930126904fd2c), teju_literal4(0xd83ae67abaeb83fb, 0xe449dc93bacdd2c7, 0x25935a2107595643, 0x345feb8593d25e2c) }, // -62215
+  { teju_literal4(0xc35aa43fc12934b8, 0x98fb18e8e8c9b953, 0x8eaa525cf1e44041, 0xa08ae7e913378bbe), teju_literal4(0xa44218b2adf4be2b, 0x7e69b231b4589fd2, 0x3caae3c61d696556, 0xc243f65e0a75e5f6) }, // -62279
+  { teju_literal4(0x9baebc9758d3ec71, 0x1e432474557186bb, 0x840f1c92a6129657, 0x065a83b50086ef37), teju_literal4(0xf98e538cef1d87e3, 0xf37e0a410482a579, 0xc899285363c0861a, 0x5906f016e774f428) }, // -62343
+  { teju_literal4(0x933d6497b4cab569, 0xf98c9e1b8bc3166d, 0x64b5b84c441475e4, 0x9711ea397af3fe96), teju_literal4(0xbd92f48856578ce8, 0x4e34a16695f66ce7, 0x14496c329c078edf, 0xa7f144ae28ef1891) }, // -62407
+  { teju_literal4(0x2ecd37981e0b66db, 0xd442c4912d44b424, 0xae4be40cae6d9383, 0x4bd556b8214ecaf1), teju_literal4(0x9002515d894a361a, 0x0c40efca17f17706, 0x789ae66666e23220, 0x2fe0b25c65cb6438) }, // -62471
+  { teju_literal4(0xa2a200ecf2b824ab, 0x34dba202a12bd73e, 0x7ea8612bc5371af8, 0x2c74d40d5370eb9f), teju_literal4(0xdacaa8b1dc9a7bb5, 0x4eea161b1b66ee63, 0x8f19a86a27a62870, 0x3a3018a7bdcb6aac) }, // -62535
+  { teju_literal4(0xd2b41a1cade15ac5, 0x90d8d620f349262d, 0x391f62f5aecfb40e, 0x2c3ca8d2bc3a82d9), teju_literal4(0xa6343d93a5657515, 0x3a4ea97a99aa9f8b, 0x616b0d1ce6fb333a, 0x35445155b5498271) }, // -62599
+  { teju_literal4(0xe8cc07992803678e, 0x1a659eeef0160a0b, 0x09584199df4e707d, 0xfd25cb0437dd6dc0), teju_literal4(0xfc8326ee3df7689d, 0x306e62aff348de4b, 0x13bee2f53c4a0cfa, 0x0c2df135402eb091) }, // -62663
+  { teju_literal4(0xadd456af9b427a58, 0x58d8374f6ea7ef6d, 0x4e9722aba5b37692, 0x895002606ed52ce2), teju_literal4(0xbfd1dfd7aa12f313, 0xf44131d6db7069b6, 0x32b03e4440655c8f, 0xaf04b044e256a814) }, // -62727
+  { teju_literal4(0xef8694743538c00f, 0x924d625f5f62e604, 0x1786661317eda9ad, 0xbbe8c7e40b2b0936), teju_literal4(0x91b70d74389bacdc, 0x8b5fbc537ad89e90, 0x81cac58a26d0ef9c, 0x2fd4113ebe8726a3) }, // -62791
+  { teju_literal4(0x614061dbee5b87e8, 0x1d2495ec6ab3734e, 0x8b1f9abf42702dc7, 0x576bf410d162d4c6), teju_literal4(0xdd622f9f559fe6af, 0xbe96456ddc09eef1, 0x85f433721ffb8034, 0x48dfaf077afa66eb) }, // -62855
+  { teju_literal4(0xeb793ec58249399d, 0x9173855ffd0da307, 0x4bd0263bb8c9c033, 0xd6d1533db7ba501d), teju_literal4(0xa82c492bf38f8fad, 0x629347c12ab96c91, 0xc9acbbf940be1129, 0xeddc11796d957231) }, // -62919
+  { teju_literal4(0x33b39be74cb4f037, 0x2db6b80c70e5117c, 0x7c43f68e626d8c87, 0x6dbf43096c661b20), teju_literal4(0xff80f187296d58fc, 0xa5527889793f430b, 0x1b92f4b8f8337029, 0xb427e91267a18e59) }, // -62983
+  { teju_literal4(0x43d968b3c291e920, 0xf2e93306372d635a, 0x45f480ed1be53ba5, 0xb8e20a66d5812525), teju_literal4(0xc2179ab41d15369b, 0x97c1407e21894d79, 0x97854cf293469fb4, 0xf6f6323a066caef6) }, // -63047
+  { teju_literal4(0x27d76f901acd7142, 0x5c6bc6b31556d131, 0xceaef831cce25b07, 0xc7db8811e95f40e1), teju_literal4(0x9370f605f8e194e1, 0xd937d0cd59f5caab, 0x8cfba180a0b0fa33, 0x4ec65438e69c7c57) }, // -63111
+  { teju_literal4(0x91a74e69328b9c84, 0x58f4550e3a4ba8ba, 0xd80c1713a5575e6f, 0xd0e14cf862d0001b), teju_literal4(0xe00192d24b7b35ca, 0x562651f7325f26a8, 0xdcff59f439b3c542, 0x85cc36f5f9f83dde) }, // -63175
+  { teju_literal4(0xcf5f5e3f2dc5f832, 0xa603864349c22fba, 0x1ba9c8ea2b3340b3, 0x14a2abcfb1f14e0e), teju_literal4(0xaa2a4d6120d85a20, 0xcaad69eebddcb143, 0x5abd577ff9419494, 0x99ecf56c713f05e9) }, // -63239
+  { teju_literal4(0x3de70aad2c90c891, 0x4765d54f39b7035d, 0x54a82a09aa9e8821, 0x7efb04b08e1f5fdf), teju_literal4(0x8143e7442fe45791, 0x2693ac6756a84d85, 0x699f466081822225, 0xd4b10ea07ffee409) }, // -63303
+  { teju_literal4(0x66d8ea9ae019e3c0, 0x3a1ce111697b7e23, 0x20f56fd58c1a825e, 0x6066a45d5318aac8), teju_literal4(0xc46439c555965e4b, 0xf3edd767582da7b8, 0x13afe0ed999c5978, 0x4a01ba2f4e3333ad) }, // -63367
+  { teju_literal4(0x7447f09cd9e6c445, 0x5677b1b2b6305835, 0x65f9906575547d2a, 0x4c60ddcd2b8aaca2), teju_literal4(0x95301ac3872e9327, 0x3a0604ddcb7aeaff, 0xb1de2b9e3b4c86dd, 0xc73c9b4d25210ad5) }, // -63431
+  { teju_literal4(0xa16db50a1ee3e81e, 0xee8f5f04b245c6a2, 0xac5d8c948ba763ca, 0x4b8de0148ae7cf0d), teju_literal4(0xe2a8ea215643cc81, 0x83fe1c2928b76b51, 0x2c9ac7107e3ba386, 0xa6cba8239d8c03fd) }, // -63495
+  { teju_literal4(0xa08af1fb5fb05bda, 0x5a8ea5f0f0b26c64, 0x21f56603a806a53a, 0xb5517fa07f3e08b9), teju_literal4(0xac2e5c4efc02b938, 0xabdd379abf50c95c, 0x0ec857afe46d0667, 0x1f469731520a3311) }, // -63559
+  { teju_literal4(0xa2bcc0fba92c03c1, 0xd86efc31a84f66ca, 0xf26a8cfdf73db7e9, 0x1d9136b22dd77609), teju_literal4(0x82cbecba8273ec52, 0xc231002014e332ee, 0x98ef4b298a4faf85, 0x11e92b6b63b256a9) }, // -63623
+  { teju_literal4(0x3cc9167c693cb4a7, 0x6bfc253d483e5ced, 0xfd04358a276a338e, 0x65cdd9e2359757c7), teju_literal4(0xc6b7d1f19d9a9eb0, 0x37300d393af27160, 0x3ac3f44ad556e6b9, 0x8b04eda8c9f8abf4) }, // -63687
+  { teju_literal4(0x60a53156fd5145ba, 0x630d0b35a22e7170, 0xdc804f7cf41a3609, 0x24cd61e043758834), teju_literal4(0x96f48b8d361a76fa, 0xbd52598dc6b3650a, 0x1ef63db307029a7c, 0x58295ed8a87d3199) }, // -63751
+  { teju_literal4(0x04678b8902d4f269, 0x9fbe373689998d7c, 0x640b9a5deff4bf36, 0x7e24c1f316b89ca7), teju_literal4(0xe5584dab5956b104, 0x75a0d5cc1385e9fc, 0x2cbddd3c5a116453, 0x552dc6d04de721ef) }, // -63815
+  { teju_literal4(0xcf239e8ac7dc4afe, 0xa32c6adfcbc645b7, 0x69f9f4310bb82481, 0xdd0978be68c3a815), teju_literal4(0xae3888483ec875b1, 0x1b2f8c30f5c65119, 0x3d1b69c445824de5, 0xbee2f866c7c104cb) }, // -63879
+  { teju_literal4(0xadab3cb673cea108, 0xdfcb78de30903faa, 0x61cca1193cba4b44, 0xb33f3ada101b9f8c), teju_literal4(0x84589711d628945b, 0x7ebcfbb4cd5f8ce8, 0xf5cb42b191770c4f, 0x78004ab28010240f) }, // -63943
+  { teju_literal4(0xaf76e04d4619ed09, 0x4338fc52f64b7109, 0x814dd3caa8233436, 0x4abd8120e08ee8c5), teju_literal4(0xc912785ea0e9f1a8, 0xee93283cbb930ebd, 0x68bd94f83e4e00c6, 0x777388fe390ec907) }, // -64007
+  { teju_literal4(0x049906c9fc5ecca0, 0xbbc2ccf2b0eb7365, 0x8e98ef3ff69fc759, 0x3db087c703409bf4), teju_literal4(0x98be58737e10fe22, 0x8fe40ce0117362cb, 0x5553142d86367323, 0xdc0160bc942ea1f5) }, // -64071
+  { teju_literal4(0x504a1b1d102bc12c, 0xe6ef76b8cc3f20f3, 0x8e03416eabe2dfde, 0x3f87baaba400d1bd), teju_literal4(0xe80fd5d85e955a9f, 0x15982f05a37a1646, 0x6d7008f9e1648821, 0xeb67c283a627aac4) }, // -64135
+  { teju_literal4(0x7af20dfb8735417b, 0x9ea69163312acb9c, 0xd975a8b6f4809db6, 0x524322c52e05c7c0), teju_literal4(0xb048e3d73466b4e2, 0x189343ac3388afc3, 0x40504a2b5ef6df46, 0x849391fdac82fe9e) }, // -64199
+  { teju_literal4(0x6228686f2d81eec6, 0x12c1ed3aaced8982, 0xd5007a2655f53153, 0xc6bae15dab8cd9e2), teju_literal4(0x85e9f45fab1e05b4, 0x3439c4caf993b0cc, 0xe7ba8cd6e5148486, 0x37a1a1a22ac89e39) }, // -64263
+  { teju_literal4(0xffd192589c55b959, 0x0d0bd06057ac9de7, 0xd0358397e8a7e939, 0x42db30d6c30a75ae), teju_literal4(0xcb7442722d47ca85, 0x9e009aefea66e5e7, 0x91eff6704a8aa41b, 0x177994135261d182) }, // -64327
+  { teju_literal4(0x2aca465d3bc296cc, 0x3607f9412408cdc4, 0xae5e278c3ec5f11c, 0x9744e7a2d5443667), teju_literal4(0x9a8d91b78f563cf3, 0x1be346c6ffe2c97d, 0x24b2793965d44786, 0x6082d0e2db2d7828) }, // -64391
+  { teju_literal4(0x7fe4831eef2cfdc8, 0xfb8911a9b7f5432b, 0xdcf9abdae89a5720, 0xff32764d7c638e6e), teju_literal4(0xeacf9b5a743d674e, 0xa46fe1435d14a098, 0x955d6ff82fd13a2a, 0x45aece3fec7648bd) }, // -64455
+  { teju_literal4(0xac712341febb4acb, 0x6c0bd68abc6eb765, 0xdf9212d637d9f826, 0x8e440255d3b73efc), teju_literal4(0xb25f81be62238894, 0x879d2588b8f92bab, 0xcf527a79bf7c356b, 0xaaa144f8327f7a36) }, // -64519
+  { teju_literal4(0x6eba1dc2b69320b6, 0xd5b9f82f8e2bdd34, 0xaf1ff4b7b57449d4, 0x69de0a8df831096d), teju_literal4(0x878012e437cccd09, 0xecaf803b9b503911, 0xe1ed020d5e408ebf, 0xb0dfaa26fc488b76) }, // -64583
+  { teju_literal4(0xc23f61b5e073c560, 0xeecb3aceddd32585, 0xd8ad92ed883dee21, 0x7854c21fa2dd176f), teju_literal4(0xcddd45d2f4f1b9cb, 0xb8a78b62895e7c88, 0xeeb700e87aceb6c1, 0xb9361ccdc841cc19) }, // -64647
+  { teju_literal4(0x133d036e46b59b3c, 0x914cde4cdc6c71f4, 0x06d5e3c6a92199b5, 0x1fb9d8d2245ae73e), teju_literal4(0x9c6247cbe5c5d98e, 0x24a7b25b2d3a21a6, 0xaac4c505b6c62573, 0x9386af7cb25674e1) }, // -64711
+  { teju_literal4(0x1bc41c69d02cf0f1, 0x9b105238c297cb2d, 0x3af4d5f6f1854aa0, 0x37f17696e9b7ccdf), teju_literal4(0xed97b72e8d6118f2, 0xa4b49bb6bd832c82, 0x8c2be9d23ca0c6dc, 0xa55e76c9e2d46e19) }, // -64775
+  { teju_literal4(0x0882e6fb02070ae1, 0x6c6f579190c1073b, 0xea6b4607543c864a, 0xf1a814a40c4932bd), teju_literal4(0xb47c74f931d291cb, 0x6b206b6a5d56e219, 0x34a598339e56eff9, 0xce91801af4937f8d) }, // -64839
+  { teju_literal4(0xaa08f02d77cc4490, 0x4417414a1fb933be, 0xa2b6b79248df59d7, 0x01f20cee54c75e4f), teju_literal4(0x891b010aea92d40e, 0x0b970fbbd9cbd472, 0x6922ee94ca75cafa, 0xf0d6720293e70cd0) }, // -64903
+  { teju_literal4(0x92021ddaea22e5ad, 0xf2d3966bb1386b66, 0xb755b982e7650847, 0x0120daa4280cb969), teju_literal4(0xd04d9869536be888, 0x4a279a6f73e0021a, 0xb2d7a105f6f0c76e, 0xd5c5b4667fd5b2db) }, // -64967
+  { teju_literal4(0xd840361ab083c2c4, 0xcb565593f5fae7dc, 0x6f492b5254161b36, 0xa4d9599f2115391c), teju_literal4(0x9e3c8b54de52593e, 0x1d1793165e0932ee, 0x4d8f5adc369f528b, 0x44424cb24b4a95a7) }, // -65031
+  { teju_literal4(0x63396ccb7e025709, 0x4b853fbc407b2117, 0xb8a4f284a7d15a55, 0xd9fb6ebf0cff4c0e), teju_literal4(0xf068429d6508926f, 0x1199787ddf095b40, 0x2f562c227bff4709, 0xb297b0cb3b9747ca) }, // -65095
+  { teju_literal4(0x4265499a79c264b6, 0xc830b90202947d0d, 0x8e33964fb02ad37e, 0x2f244e1dbec5aedf), teju_literal4(0xb69fd0bc9e5ec46f, 0x2879ac9e260c72d3, 0xd9a3717b3f2624b5, 0x2ecba6ded3f32ded) }, // -65159
+  { teju_literal4(0xd6cbe1ccf09fa2b3, 0x034ce70a18df02e0, 0x28afcc03541d394f, 0x856327c35fd46213), teju_literal4(0x8abacd6aecc4bd68, 0x5d841a2db9e219f7, 0xc88f2930429e2f01, 0x65cd6045ae5a7fab) }, // -65223
+  { teju_literal4(0x062c5aef18308b2b, 0x4b09fb7f80fccb22, 0x186c826338d5c459, 0xebef7e48345587e3), teju_literal4(0xd2c5506014a267fb, 0x03598daaa7aeb284, 0x660ebcccb70db1af, 0xb0fe0453a18f9071) }, // -65287
+  { teju_literal4(0xe100c5899875c21c, 0x83f410ab2d292d5c, 0xbbee8daa714e7ca6, 0x7b70d99f4fe13c61), teju_literal4(0xa01c6d294e49cec9, 0xb7a6f60cc102f07c, 0x7e60cfdc7ec24c24, 0xf04f27cb1c89204e) }, // -65351
+  { teju_literal4(0x6b20e82e42c562a8, 0x933d463f57448f27, 0xe18e63bebfd2e3c7, 0xa77c4ad87dd7cf91), teju_literal4(0xf341573c6403e540, 0x8941a489c882af40, 0x5e2c2efdbf46b555, 0x4a4ec2561335c3b8) }, // -65415
+  { teju_literal4(0x1c1d30d529faefdb, 0x55a6f6ce1388f69c, 0x74246374f5043413, 0x8a5b0dc3a259a3f1), teju_literal4(0xb8c9a877e25f6c25, 0x0b3ff861b1457a9e, 0x95ee1909080f056e, 0xc88e4b70786f9d5c) }, // -65479
+  { teju_literal4(0xdc90c64a2c9bedbd, 0x7704b498d68b89c6, 0x12659b7b234750fa, 0x7bd3ce55c9a03274), teju_literal4(0x8c5f86c7a74cbd93, 0x317f830d31010dcd, 0xf1a9657e74365834, 0x4aefd8ed38bc2ec9) }, // -65543
+  { teju_literal4(0xdcfb0debe15547f3, 0xb476783ce22a72f5, 0x867ff7fa72010116, 0xae8bc62f5353903e), teju_literal4(0xd54484253e66679a, 0x433cc6a109576c41, 0x3d867f30a5e2feb4, 0x9ea660f4543dc4a6) }, // -65607
+  { teju_literal4(0xfdd458b82bb13fe4, 0x0721467112b18021, 0x0ab234ce132d22ac, 0x41ae172b02773249), teju_literal4(0xa201fe531c6548b4, 0xae95e2322d0fe239, 0x0e4a255a504250e5, 0x2be8e22224f344bc) }, // -65671
+  { teju_literal4(0x27b48fcff0616518, 0x4a33596c1cfa0a07, 0x22cdc932c4247047, 0x853e78c3b0ec6845), teju_literal4(0xf6230eee89761878, 0x125ff89e3e8646d8, 0x29d7b763085bca69, 0x8a9418b88bfc5ed4) }, // -65735
+  { teju_literal4(0xdfd6372c84ad60bc, 0x6aed3da4e086122e, 0x7078ea1d32f26a6a, 0x707fc4f302ecdb5f), teju_literal4(0xbafa0fd528bea531, 0x64e90149c13098c3, 0x16633c2613e6bda0, 0xf48ac4257be821cb) }, // -65799
+  { teju_literal4(0x1b8169d0f84956c5, 0xee7eaad96d2dd748, 0x049f34ce6153dcd4, 0x76a5d0c43fecb7ce), teju_literal4(0x8e093c1148dba616, 0x97a19ebc2d00a7d5, 0x7c9db7ae705a8b79, 0x36ff836e67051484) }, // -65863
+  { teju_literal4(0xfcdf3137a600011a, 0x561f74ed473a4e87, 0x04313d7395cd560a, 0xd2afbec6e5dc5387), teju_literal4(0xd7cb4a6adc4e78e0, 0xde43d2370c5a9213, 0x3b6344786fe81c2a, 0xafdcb4dcd4b8df4d) }, // -65927
+  { teju_literal4(0x10e9bc5d5ba97c16, 0xad7ca87444679b15, 0x377fce0b5ce427e6, 0x0139692578a5ba79), teju_literal4(0xa3ed500fdba86eac, 0x9450cc71362852c3, 0x975e04fd4e468954, 0xb097e96c1c07b96d) }, // -65991
+  { teju_literal4(0x8596be1a3bd6e2cb, 0xbe96b83db3af4caf, 0xb22f682b1de5b549, 0x8a2c0009562134d3), teju_literal4(0xf90d83e556216ad3, 0x4f39615326a388bb, 0x3b981ae653ed278d, 0xf8ff496c2ce4a2ee) }, // -66055
+  { teju_literal4(0x2f7b18114667d1a1, 0x4a15acb09fcb94f8, 0xa265cd2643a7e355, 0xea71b2a3653396b2), teju_literal4(0xbd311aba3f778f0f, 0x1ea8721edda6e585, 0x8335e55fed1968d3, 0x546931bc8775b010) }, // -66119
+  { teju_literal4(0x4eff10a9f1c40775, 0xf56826cf6752689c, 0x89fd8fd8796dcce8, 0x714be691ce42445c), teju_literal4(0x8fb7fc654db0e6df, 0xa7a30a104c5a70fc, 0xfb5c75bd6150611b, 0x64cd0806b24418ec) }, // -66183
+  { teju_literal4(0xa539c6a3a418d763, 0x7c87155b05616f90, 0x592a2e428fb3e924, 0xd2ae18ed869aaf1d), teju_literal4(0xda59ba27ce011e08, 0x96dab71a84c53087, 0x99840c7d2d781e27, 0x5b997fc5c49a4e2d) }, // -66247
+  { teju_literal4(0xb8a44b044e9a4489, 0x6a8a5818fedfd9ef, 0x63bd53dc394945e0, 0x3185b7f9eba240d8), teju_literal4(0xa5de73d16816cddb, 0xb2ddbebc29af6634, 0xf2ef1b09e96c2184, 0x1b521482435206a3) }, // -66311
+  { teju_literal4(0x31c6b6138fb5524e, 0xcf803510977c11b9, 0xffd7a11dc214abd8, 0xd8cda17261194d34), teju_literal4(0xfc00d0a1ba7d2ab0, 0x2708c57d77abc488, 0x51b44df80d810e6d, 0xf099c6b2b54751a5) }, // -66375
+  { teju_literal4(0xbc9debcabf87f65d, 0x23fda6e786c0319c, 0x9406df7c611ba2ba, 0xf7a74f11356c5cf7), teju_literal4(0xbf6edd494c72916d, 0x114f0039104c160a, 0x627f42cd58bd6b3c, 0xb5a03f72b42efdc3) }, // -66439
+  { teju_literal4(0x0295a07c4428db81, 0x2ed2b200e03cafdf, 0x030b81e41c8e3a72, 0x7470d66bf0f5377b), teju_literal4(0x916bd70f08fe57e3, 0xc8195d60addd304f, 0xd4343471828d9fb2, 0xcefc589f1f0299c1) }, // -66503
+  { teju_literal4(0x9b9c20e165cb5e7f, 0x8fea4960da8e58b9, 0x05979889d1ea28ea, 0x9c79f1e380b3a128), teju_literal4(0xdcefea9897f0f6c8, 0x36c3f6906fa52696, 0xd034356a496622ab, 0xc54f32958c85148d) }, // -66567
+  { teju_literal4(0x0a10ea6cb55dd58b, 0x5c786752705bcdd6, 0x94a04de30188393d, 0xfa52dd78d55aba7a), teju_literal4(0xa7d57b3e85446489, 0x33d93e4a4b86106b, 0x29cc56bc9bdfc207, 0xd58d80eca1f722ab) }, // -66631
+  { teju_literal4(0x8908f70cbd7dcf45, 0x918e14946f1a7fdd, 0x806bea834d37009b, 0xecae055279d6a76f), teju_literal4(0xfefd0ff5079d97f1, 0x15e56dd86b31c1d8, 0xba7832ece24ac591, 0xc54e3bf7f7fbd058) }, // -66695
+  { teju_literal4(0xc0e1babe3b6eda4c, 0x34d64523fe5c0639, 0xc7d9b87bd322135c, 0x7fb0bcbcf6ff02a5), teju_literal4(0xc1b36be184861f80, 0xa410ec577c67fd2d, 0x37efcf23865773fa, 0xa7378c528b805685) }, // -66759
+  { teju_literal4(0x8baae58884efe0e3, 0x1fee8095c8cf96a6, 0xa319ad04a5ab4570, 0xcf925d630e2056dc), teju_literal4(0x9324db882fecabde, 0xd740ee6f30b0fd1e, 0x6fbdfa8e1d325281, 0x020d113945d18c81) }, // -66823
+  { teju_literal4(0x4d1ad0bf261fcdc4, 0x40e8154efd16db88, 0xff319b4cf5bc3f9a, 0x1c294c1a9882c586), teju_literal4(0xdf8df3403691f462, 0xc95874ce23b9d88b, 0x716a68060cc17d09, 0x5f5c8d9895a9a9e1) }, // -66887
+  { teju_literal4(0x5762fef674999bfa, 0xef8cc4e79b77a06d, 0x4cee8399ab35ce3d, 0x850836a0e3708314), teju_literal4(0xa9d278337ec70e4d, 0x9045088a609635dd, 0xaee76a54cc578379, 0x6a8512b59e89055b) }, // -66951
+  { teju_literal4(0x422aa8687f47820e, 0x0daaf3fb559ab269, 0x5ee75262226178a8, 0x98f33790f69fba06), teju_literal4(0x81012e80f17b2ec5, 0x2875ea26f2a96bfc, 0xeeeeff43efd4e648, 0xfad542bcf7c44fef) }, // -67015
+  { teju_literal4(0xd5b477e4c9beda69, 0x897c7f5433af9d07, 0xc2a454ab93a66e9b, 0x2becca52abcab281), teju_literal4(0xc3fedb1fe4a27916, 0xbed713a5add7da33, 0xdbeb7b09f07959d1, 0x5a62ab47d9667640) }, // -67079
+  { teju_literal4(0x4eb456a4eb62ee1d, 0x6de202e435afc009, 0x8d75c6c027bf02ee, 0xc3bf0d8db90de2db), teju_literal4(0x94e3197966457bc6, 0x5573b8d8f970a329, 0x9662ff39e95ffa08, 0xaea9f7b0b437b790) }, // -67143
+  { teju_literal4(0x3c223169b8b3607c, 0x0f963438cab2d271, 0x3283c4c80a6caf39, 0x34eedff17ac209dd), teju_literal4(0xe233ebe8f40f14cf, 0x64bae1d998314d4b, 0x08f4c0c03eefd602, 0xf9cd36a082b5a928) }, // -67207
+  { teju_literal4(0x70f6955df9c55729, 0x4c2f8b7b191ee0ec, 0x77b0638b69a43507, 0x08e3b02872e94bc6), teju_literal4(0xabd57cc2ca8e8335, 0x39b0e71037c803ba, 0x3e31e6207dad6c0f, 0xdf17a201f40337ad) }, // -67271
+  { teju_literal4(0x6532eb6352b84ff2, 0x3bd91b9609d2f072, 0xb635f3904711fb73, 0xd0f5a8d71736a74c), teju_literal4(0x8288699e9e802530, 0x54c5572dde80014a, 0x2b2a7a465478d594, 0x3b4a3d0019b75dc1) }, // -67335
+  { teju_literal4(0xf9ba02bd4fd59bba, 0x4ad8f5df97dc14b8, 0xe9e639c1563a1c30, 0x78ee9c3d502626e5), teju_literal4(0xc6513fdfed2efc80, 0xb815b6b1c777fd54, 0xaed80d7e0178d88e, 0xf51f1a19c235becc) }, // -67399
+  { teju_literal4(0xa5fe4b4dd5f36970, 0x93bf8daab32a8866, 0x45a733346b0a5cfc, 0xa4a76adf6792b5dd), teju_literal4(0x96a6a0baccc7e983, 0xce379a11ecca0453, 0x7a1b26d87000fe52, 0x707ef0f070355f91) }, // -67463
+  { teju_literal4(0x04ded6d80d65805e, 0xb2d99fbf765adfe5, 0xc68169a0c8067dfb, 0x972f8a008531e4ff), teju_literal4(0xe4e1eca540883b7f, 0x07f5401d8918a6e1, 0x8ab2aa0adf7958e9, 0xd1f5b2b99c688bef) }, // -67527
+  { teju_literal4(0x2824274f789416f6, 0x0a1556c636719af0, 0x3341f7549a43094c, 0xd7d0930707f2264b), teju_literal4(0xadde9b35ad28ad72, 0x2844f595865b6dea, 0x71202145178f5c56, 0xa7db96b4dc52613e) }, // -67591
+  { teju_literal4(0xda3ae19d0efac405, 0x08f0c8bb6393b18f, 0xace45d3342038cdc, 0xdf1fbeff6f0bf26b), teju_literal4(0x84144737a56585b1, 0x41a213e65f3f7a19, 0x5e258c126f1830e5, 0x7ce571dd012a1dc0) }, // -67655
+  { teju_literal4(0x4f10401277064230, 0xa86f50d32bacbe94, 0x1c7feb6ea6ae13bc, 0x92272ea0e30d7491), teju_literal4(0xc8aaaf3c5f9fb06b, 0x4435c9396f17e543, 0xd845dfc50341f4d1, 0x387bb39a7548142d) }, // -67719
+  { teju_literal4(0xd33b75d85c5d8685, 0xb158dc5a835df273, 0xdf84a514ed635dd8, 0x15be87b5893424e8), teju_literal4(0x986f8154912ce7ae, 0x3f336a47d71c9d9e, 0x8f8fd2cf502df032, 0x75b8c46e782cf70f) }, // -67783
+  { teju_literal4(0x724528caa9161862, 0x0d370b39b966af06, 0x6a510f3743d3d9cc, 0x95eef7820b031627), teju_literal4(0xe7980dd08cdfd549, 0x2476dc19f99ab2b8, 0xbea6ab78134a323d, 0x205abf6e8c8d7877) }, // -67847
+  { teju_literal4(0xeeff3766aaeea8fd, 0x523862276789102e, 0x95b69a000bacc4ff, 0xc5c49b367977870b), teju_literal4(0xafede60cdff82ab8, 0x17f53efafdcae004, 0x2e2726404f1f2415, 0x623d0060bdabda67) }, // -67911
+  { teju_literal4(0x6c04812a2dd8882b, 0x341bd6e60c8a6d02, 0xdd5bf6573a51fac9, 0xb1409700d3a791a2), teju_literal4(0x85a4d55a4141e1a9, 0x18c0ea7eb9c064bc, 0xdf8c087f385979f1, 0x32f053d5e31c374d) }, // -67975
+  { teju_literal4(0x3672ceb925942acb, 0xb1f711ead9228962, 0xc12047c838899c08, 0x5fa5540f2304948e), teju_literal4(0xcb0b3e8ffe49c0da, 0x42a53bc5d78d8665, 0xaf329c3109eebb4c, 0x849c74bf93c2d30a) }, // -68039
+  { teju_literal4(0x24d5c971e398e260, 0x14b49f1e91d101f2, 0x410547904dcca8cb, 0x49d5a3b7b69a0a23), teju_literal4(0x9a3dcb7f7fe0434d, 0xae07d7c3130a4a31, 0xcdc035f031acc512, 0xfed0b69ad2e0fd78) }, // -68103
+  { teju_literal4(0x3e154114f398110a, 0x88d6b6a59cee622c, 0xfd9b78b29cd8fdc0, 0x03d4b6b028655a33), teju_literal4(0xea56681028200c50, 0x43ad6ca6806ce6e3, 0xf354947ac49fd924, 0xb93e9612986888c5) }, // -68167
+  { teju_literal4(0x1cdf7ff29cc65e75, 0xb31a3baaa1e5b889, 0x90beff420ac81566, 0x52b0836b3445e911), teju_literal4(0xb20370013962e00f, 0x618d47902c9504a5, 0xf36d813802c47d25, 0xdd61be45a0b9c2ce) }, // -68231
+  { teju_literal4(0x48ebeef5f32a73b5, 0x8e479c32eaa5623f, 0xc44c0de2a6121d03, 0x3565bdef550bbcf4), teju_literal4(0x873a223f4d7cbbcc, 0x5058558c7dd8d12f, 0x66dfa3aced63496f, 0x186737824a1c16c4) }, // -68295
+  { teju_literal4(0x7119ea1857940147, 0xcf58c3f9242a8b6e, 0x176d6ec1ba97e954, 0x1165eff303afe8fc), teju_literal4(0xcd7303764e7dbeee, 0x4a0228715e8b9f2a, 0xc2fc98c02ab5f9f2, 0x269f5ce6727a2796) }, // -68359
+  { teju_literal4(0x1e2ada7ead215f16, 0x1a181d8570febd39, 0xd9a4612fc934b84f, 0x413cf8822b936b09), teju_literal4(0x9c118fa597739c36, 0x0a4c859d850d28f7, 0xb7e9b77c5102f8bd, 0xf89eb01c4feeb329) }, // -68423
+  { teju_literal4(0x8085ae15a5b7e8cf, 0x27c8c6a5f573f4c1, 0x5aa7a76f1acce1a4, 0xbb1b2fd1c9de7094), teju_literal4(0xed1d14541f7f683f, 0xb122783e0707888c, 0xfd819f4857439165, 0xd9fc90299d6f9454) }, // -68487
+  { teju_literal4(0xeccf294ca098dfd1, 0xd1908a348f1076d8, 0x4bb6abc053fb4bfb, 0x1277bb2b626ade3d), teju_literal4(0xb41f4c0456fe98d0, 0x23158c260986bff9, 0x3ea083f32c4ba512, 0x6b3f692ec4a7ee82) }, // -68551
+  { teju_literal4(0xec13e3959f6633d1, 0x9d3e55ae893b2b35, 0xbaaaa57a359e6c48, 0xb5bfe70e029c87a8), teju_literal4(0x88d43c4ac7143254, 0x1d7e94c65cdbc189, 0x61dc8517ef44c8fb, 0x1abf632f0b36a86c) }, // -68615
+  { teju_literal4(0x79b4d25c3c3136d5, 0x223343830b869e40, 0x68d1297dc4be71f7, 0x132844cd1f9d77a4), teju_literal4(0xcfe213cc5cee87c0, 0xc31a2ca0186e7c32, 0xac19f2412dec44fb, 0x456a0a383414412e) }, // -68679
+  { teju_literal4(0x3cdedb9385b3eb0d, 0xe1f61fbf8ce18651, 0xc9d9cd0591bb260a, 0x4bdc2ecd88aec0a4), teju_literal4(0x9deade629dd08837, 0x6cc080a35f623696, 0xe4ba197a32b04ade, 0x2b06fc55a261c5f5) }, // -68743
+  { teju_literal4(0xac99658a0b7f3c1b, 0x5a89a2c348dbcbea, 0x4e1f0819cc4bbdfa, 0x4c0aacdd87fe8c09), teju_literal4(0xefec2bd8210ccf19, 0xfcc5b007630678e0, 0x3aeca01404e21851, 0xa39abc930eefc950) }, // -68807
+  { teju_literal4(0xf91e601ded6c0525, 0x3e30b7b0bacd2c78, 0xa1f236ecd86c8b1f, 0xdbc2848a081abb7e), teju_literal4(0xb6418d4149c1bb93, 0x79035c2afe683d27, 0x5a22c93007301cb7, 0xe8db24b3c97539c7) }, // -68871
+  { teju_literal4(0x5033ee63dbc8a983, 0xb1872e718c292b37, 0x02191b6e86d3e1eb, 0x30aed7bbb71432fb), teju_literal4(0x8a73320c4f6ab3fd, 0xbe6fbd475a9ef15d, 0x1ae1dc6dd76b4bc0, 0x6d35a25425bc7b95) }, // -68935
+  { teju_literal4(0xadfe1a0665b7386a, 0xebf7928b366076df, 0xa45e6dc9d63b8093, 0x541a5bc34885b0a2), teju_literal4(0xd25885b1846bcb89, 0xf5634aa6335c3c80, 0x90ba3d7eb52fb9f6, 0x01d71307e1da7014) }, // -68999
+  { teju_literal4(0x4fc549727711d27c, 0x9177fa7b7f105787, 0x161f80a90ff00ad7, 0xdacb27cff5b8a721), teju_literal4(0x9fc9c884b72f2d42, 0x4eb6d74ddb1fa436, 0xef03492225775849, 0xa8ac8d1a27402a01) }, // -69063
+  { teju_literal4(0x7e1ce7b02d93f5bf, 0x2710ecb79c9d39c5, 0x81b7b2313507f6b6, 0xf559ea7e0b775122), teju_literal4(0xf2c3c824610af2ef, 0x608e58b4755ec6cd, 0x0546fe8c08d73439, 0xf68f41c42faac789) }, // -69127
+  { teju_literal4(0x56f7792443c7a4eb, 0xdd12f82a5eb21ef7, 0x914b588782858eaf, 0x9c81f158038e3cf4), teju_literal4(0xb86a471d443e323b, 0x83484acd674f8524, 0xf0e5901df00bd61a, 0x9cb676abc74a33ac) }, // -69191
+  { teju_literal4(0x2ed3d4ae09da1e64, 0xa3d1206ba920fcfe, 0x97923e4548d8a707, 0xead00be55aa81427), teju_literal4(0x8c17123fb0a164c8, 0xd124efbb38945b8c, 0x1c07277f57e35ead, 0x322d9f0b81ed8602) }, // -69255
+  { teju_literal4(0xb7a22e68adb90391, 0x569b46bef58ebca9, 0x0c0be44468241696, 0x8bd62cd044fe6f17), teju_literal4(0xd4d66f8836f7436a, 0x5d209e8fe8cba038, 0x57deee828cbb1dbf, 0x512e3b8ed32927b3) }, // -69319
+  { teju_literal4(0x0ab60402a5e3e67f, 0x4cf827be99724e59, 0xea20efa8771234ee, 0xa47830a44362a0b2), teju_literal4(0xa1ae5f0cfed6aeaf, 0x053dbf94c72ad495, 0x5086bdc0c4f29f7a, 0x54c9b04981288e5d) }, // -69383
+  { teju_literal4(0x3299503e6aa3f8fd, 0x41ffa6f3b2cbba9c, 0xffb416b18c31db19, 0xd2f2c87deb38fe18), teju_literal4(0xf5a4030e8203513b, 0x73a2df1c1a5c313f, 0x3a70c797c93a5843, 0x506e9f4deb64e381) }, // -69447
+  { teju_literal4(0x2c1b48ddf45855ed, 0xeef11b85502f4a0b, 0x05089dc9f34dee2f, 0x79da3c972befd88a), teju_literal4(0xba998d384aecb4bd, 0x7d407d88369e9ec1, 0xa04afac053c08651, 0x4adba5f0127c114b) }, // -69511
+  { teju_literal4(0xaa3754917c6759ee, 0x8dd2c52df1b527b9, 0xcd1fb4bdbff2ebb3, 0x914c9d36b1e24756), teju_literal4(0x8dbfebcd6383e57b, 0x9be2f364fcae92f4, 0x94ced9a427038e87, 0x807202b38ed3344e) }, // -69575
+  { teju_literal4(0x6626e022958d423e, 0x53bf5c64ca40f22c, 0xed32959285017388, 0x7a17d7f5a1f693e0), teju_literal4(0xd75be7f6c93bb996, 0xbbcd531fb4165ef0, 0x166004f3f3437307, 0xc98074dd6f73df85) }, // -69639
+  { teju_literal4(0x22227b72bec4d9a9, 0xaac6d65da958f771, 0x3f46743eb8d680ad, 0x2ae2c809a4d4d282), teju_literal4(0xa398b33021acda19, 0x34769c43d081b413, 0xc5de31fb02173a5f, 0x2431be605b3982fc) }, // -69703
+  { teju_literal4(0x0c922ee5e22dc05c, 0x00051ad95c9b83db, 0xcd422962acd4b499, 0x7d0de654ff4ab8e6), teju_literal4(0xf88cf6ba7f99015b, 0xf99916160fec6661, 0x7f856f1e79407c70, 0xdd4040b19ae1ae1e) }, // -69767
+  { teju_literal4(0x1d44aabd1b7d967a, 0xe0ccaea945e25e64, 0x144853056c83c7a1, 0xb1cad43ef9dcb657), teju_literal4(0xbccf736de68eb91b, 0xf63639400eee307e, 0x236412dcf08bf91a, 0x38532e7613c50efe) }, // -69831
+  { teju_literal4(0x666d027777b0a9c7, 0x2e9c7d55ecbcf4cd, 0xcf3482857145221f, 0x578e33dd12ea7ac1), teju_literal4(0x8f6dcdcb170a3f34, 0x95955f66914e7875, 0xa38af707b8986533, 0x3940a580b48a0534) }, // -69895
+  { teju_literal4(0x6bc8feb8b32e86a0, 0x02209983fa82992c, 0x42d1d0994ae28c46, 0xd834a017bd6d495e), teju_literal4(0xd9e905e8406d1d4d, 0x512ce1e08b02aab3, 0x574f32878d5ad7fc, 0x61b17ef1530198b4) }, // -69959
+  { teju_literal4(0x456e209e49d17b01, 0x9b5d0316929ae216, 0xb66237285240af10, 0x7d4c302aea755fad), teju_literal4(0xa588d656fa9a90b2, 0xa4d0a238c75e4fc4, 0x7a07529391881e34, 0x8c015d7c3b844611) }, // -70023
+  { teju_literal4(0x5609e1a7e01d582c, 0xe5c8f86e526b972b, 0x5cd73d1610079d7a, 0xa3c8adb39e5b7604), teju_literal4(0xfb7ebd9b9c23a88f, 0xe69ee0d62ae8650e, 0x775ecb8a81548763, 0x062d7847c449d23a) }, // -70087
+  { teju_literal4(0xd4ec2c6c4fc4fa78, 0xf2885a77f5745b9a, 0xd31787356823f47e, 0x0a534531af0126b1), teju_literal4(0xbf0c0dd5d8ad5dfa, 0xe43c2fd40d48f038, 0x7ce1fcf662425f75, 0xbabe5dba0b0ac372) }, // -70151
+  { teju_literal4(0xf212a4dbccb81d23, 0xa14951398a029070, 0x314a704a2c64f0bf, 0x5d10a7ed3bb5d689), teju_literal4(0x9120c77c3975c2bc, 0x1c7686487b1450d5, 0x30563ce5d3970392, 0x6a8e6860e5df5545) }, // -70215
+  { teju_literal4(0x08507bd4285eced3, 0xb2a133040141f95b, 0x8fb46df81ef91ec0, 0x934f9ff1f7392afc), teju_literal4(0xdc7de08d2298f1e3, 0x534fecaf0021d124, 0xdfc9d2e12c4be906, 0x8d5180bfde358cc7) }, // -70279
+  { teju_literal4(0xf3b6abfbf655bc3c, 0x8adda0a866f47d1b, 0x194ef7cf5b45ca7e, 0xfa5c59f5e911c09f), teju_literal4(0xa77eda1f30ca7a95, 0x7ad82b4d3612eb41, 0x1eb1b3ffd1bdf07e, 0x1ed4a272c3d34ab3) }, // -70343
+  { teju_literal4(0x62c1df3dc24dcbdc, 0x25a6557a81326d59, 0x1bbd6d60ce8b2d42, 0xa9bdf81c026dae4e), teju_literal4(0xfe797275511b0336, 0xc4968e40df2db21a, 0xf557590cc8466be4, 0xd23b49ca1117bee5) }, // -70407
+  { teju_literal4(0x0ee8c1480b234cfd, 0xa0fba3e673f6a28a, 0x8edac62e32156e21, 0x78059482f80ee835), teju_literal4(0xc14f70c4d23bb86c, 0x890b544909931879, 0xa8d180cbe0ff5199, 0x6790aead2950c556) }, // -70471
+  { teju_literal4(0x4d6ff097a7eeff81, 0x8e90f572438505cc, 0x838e1669e9d47265, 0xaad2dde58e4badec), teju_literal4(0x92d8e852830db9e0, 0xa5bea7a3936150d8, 0xab1a758f622a3b8c, 0x0d5e9897f1cfe107) }, // -70535
+  { teju_literal4(0xa879bfca3030d354, 0x24a43df2b360f868, 0x9d78ec02d572e2c3, 0x249d22544c401797), teju_literal4(0xdf1a8f5c496e7e64, 0xd51ceead007b9be9, 0x30dd6a7cbad910f0, 0xbda94dbba2ee3b9d) }, // -70599
+  { teju_literal4(0x7de2171f7fb14221, 0x34649b495d7441ac, 0x1867571445da047d, 0x600598f31a8a5763), teju_literal4(0xa97ad05bd7c7a274, 0xe258aeb17dd228d7, 0x596f568c993b270d, 0x28b68f8dafc50747) }, // -70663
+  { teju_literal4(0x4acb0c0546bb594c, 0xd0bceb756ba3808e, 0xc6486c8d214826fd, 0x5a8dd436d588a823), teju_literal4(0x80be982e212dc64f, 0x33a08adf16d3693f, 0x740a488d13d2a3c4, 0xf9658d482222f415) }, // -70727
+  { teju_literal4(0x80db03a459714d3f, 0x6097d853250f75b3, 0x4a992bca9571f174, 0x17e27c4badd723e9), teju_literal4(0xc399b0cd2c630105, 0x9ef3c95a2ba90b59, 0x96cf1315a6697e10, 0x0808054e7af0f163) }, // -70791
+  { teju_literal4(0x5ed431fee1d125ed, 0x6ccf74f6ffa62a14, 0x1de7fe3dd5ed8301, 0xb3baf4e07cf452c1), teju_literal4(0x94963fee8280d7eb, 0x4d7f287a49c13831, 0xc59af9ac07d9a06f, 0xc9563eebe73f6083) }, // -70855
+  { teju_literal4(0x98a93c9ee8e2cf14, 0x978f8d1a45e15265, 0xccf3b8cbab6ceb00, 0xc7fad4df4e9019a1), teju_literal4(0xe1bf2a13b78639af, 0x9efb93135ebeba76, 0xbfce7fe89ba8625d, 0x44aab0ac87953118) }, // -70919
+  { teju_literal4(0x22f293d224d599dc, 0xdda32e7895709f70, 0x45d14f15e34aed71, 0xec98a5d774b40967), teju_literal4(0xab7ccb161181a915, 0x5fb86159fb6c8a04, 0x9b2c87a8f5ebd9ce, 0x66882809f9aeb432) }, // -70983
+  { teju_literal4(0xe4221e9f3b4f6fab, 0x15b2982f8e76c144, 0x3c5816ed719c00b1, 0x32258fe017d3afdd), teju_literal4(0x8245095b9a267448, 0x1b80778c2b597762, 0x1537ec43cd06c7d2, 0x3de28c4de4cfaa3f) }, // -71047
+  { teju_literal4(0x5dfa1a7e84471d7b, 0x75dc4bc4d0765e29, 0xec44e5be1853ce1b, 0x8bdf1827383515dc), teju_literal4(0xc5eae2bfa37f2ff1, 0xb373b659d0310b5b, 0x6c42c8d2b14c943e, 0x67020957efeee2c8) }, // -71111
+  { teju_literal4(0xc92eb63a9f9da9c4, 0x80033cbf49ddf504, 0x70d57e969c5835f4, 0xf2df92bae87d52ab), teju_literal4(0x9658de202af0652b, 0x109b9b9afbfa04f1, 0xe63565ad357e9658, 0x32bf21d31eb1357e) }, // -71175
+  { teju_literal4(0x9c0aa2b29ddd41c3, 0x1d8befef7b1b2988, 0x724362a37f9b391b, 0xefdd375b117c8f1c), teju_literal4(0xe46bc8b9703005a3, 0xd803bcc3041842cf, 0xf2e815ea5726c40e, 0x5ce3676e65fa1ff6) }, // -71239
+  { teju_literal4(0x6391d5dfe8233c98, 0x85a887113eaf361e, 0x533c712dc62c9a0a, 0x674bebeb31bd9db2), teju_literal4(0xad84dc8db23c5133, 0xc99c667e5bc3876b, 0x1deacb99689e56a5, 0x9a4a354b2c1325ab) }, // -71303
+  { teju_literal4(0x190ec306ac84e016, 0xe95f0ba22ad130b9, 0x45424821165f9758, 0xadd2b9a6d98c7687), teju_literal4(0x83d01aa002796600, 0x9af0edf04ccf4598, 0xe276081033781991, 0x24ae5091a2160076) }, // -71367
+  { teju_literal4(0x36f44d3d79586c68, 0x4791670d0fffc552, 0x7065c9b73706ce73, 0xf021b0f471884d9b), teju_literal4(0xc8431bac1452aba6, 0xa86b130791eedbcc, 0xe77c15fa3a5deac3, 0xc74f0c522a128204) }, // -71431
+  { teju_literal4(0x5b9db27252f58020, 0xae89d74614a2eed0, 0x9fe6b071b7a1ce95, 0x910fa699a0f5d789), teju_literal4(0x9820d2e763aa30b2, 0xabcc1350ffec2567, 0x9e05a3270486f6e3, 0x2c33f943be0cd2f1) }, // -71495
+  { teju_literal4(0x546a5d745581129c, 0x483c1ad4c4c81c71, 0xbd8dfcc44d85b4cd, 0x062b7264abdf0adb), teju_literal4(0xe720839c51cfe2fc, 0x8dd3902f60ba17b9, 0x4be4a7641533fffb, 0x363256b9c9bffbde) }, // -71559
+  { teju_literal4(0x2179c759c22f032e, 0x56be158e43cc9f18, 0xe4bc124b2240ae80, 0x868ef95bb0b295ca), teju_literal4(0xaf931739e67035f4, 0x05c2a70bad2576e8, 0x4bbafefb125257ba, 0xceebeb00c5b1b367) }, // -71623
+  { teju_literal4(0xcb040282c98c4cd2, 0x64b4428ad6a5560b, 0xd0f5d72cb9922854, 0xd5c2280ca108c5f2), teju_literal4(0x855fda0253f89e64, 0x97bee010f76ec858, 0xcd7a9cacc677bee0, 0x5f521cbba6b95146) }, // -71687
+  { teju_literal4(0xbb6c3a4e98b29c27, 0xfb6976fed6e879b5, 0x0cefcbb66f7616cd, 0x0c2276e830ab775b), teju_literal4(0xcaa270e23b77c1f8, 0xc107883a57a6607b, 0x79ef04f4f0d682d7, 0x0f07732cec6102dc) }, // -71751
+  { teju_literal4(0xcbeb17823b141851, 0x83d8f6ae9f7729b3, 0xe8306bf9a6f7eb00, 0x0edabd5c231cf934), teju_literal4(0x99ee2e74999662b0, 0xa320359dfcb64384, 0x78b9520954763b2f, 0x92adb0f047d9f482) }, // -71815
+  { teju_literal4(0xcb955cc9cf2e72bf, 0x7b066049eb8399e9, 0xabd7489b921a7ed0, 0x09b6264e1786f37c), teju_literal4(0xe9dd7354f2d0de9e, 0xfeb12720904295e5, 0x90f3f8934edfcf43, 0xd260c8fbb1290963) }, // -71879
+  { teju_literal4(0x417436805593fb36, 0x861c91df5ae5e95c, 0x14094710e9962084, 0x7b0604b66c9c1c43), teju_literal4(0xb1a78dc9daa28f97, 0xa525940d68a97820, 0xf6f948227ff1ca8d, 0xb1f5f6c349976f85) }, // -71943
+  { teju_literal4(0x30065e4cc33b6828, 0x5ef03f962709ffa7, 0x3a1df0a19ff4f18a, 0x92553e10657a8fd7), teju_literal4(0x86f455b412c68d8b, 0x997be20dc62fe21f, 0x6cc1747e26b6e7f4, 0x87fbf72f35354aea) }, // -72007
+  { teju_literal4(0x86bc4efa2e765f12, 0x717154dd59facc52, 0xb97612544de914bb, 0x56e7848c03f97b47), teju_literal4(0xcd08f7f27716b7b0, 0x1b6a9aac994a5653, 0xb9a12061bb409d58, 0x3a4b15fb21dacc42) }, // -72071
+  { teju_literal4(0x12963262e95d844a, 0x3632389a05685b98, 0x0784c3d3b903e93b, 0xe0f954a923736ae7), teju_literal4(0x9bc10129525e5942, 0xe09f33e17d0b5554, 0xa2d5a6501d03a725, 0xdc930f28cdb31b97) }, // -72135
+  { teju_literal4(0x81d1d1f1e30ff1e8, 0xaee285439ebffa25, 0x8c5e558e2de74d0f, 0x18b4799fabcb12cc), teju_literal4(0xeca2b0c6813610b2, 0xd8150fb2f4f76f92, 0xa42be75d5a8cb262, 0x0c862eab16ec13fc) }, // -72199
+  { teju_literal4(0x810e01cf14bfc56d, 0x1467e9c1166ffd22, 0xaeec6a0622cc6291, 0x34987d136d2a5227), teju_literal4(0xb3c253256539fc19, 0x0561df5cf183a238, 0xa8dfe25697616a81, 0x689780fd80f9b2d2) }, // -72263
+  { teju_literal4(0x96e2b776db334b04, 0xac2bb88bbebfaf7f, 0xe3c5aaf5bf293a2c, 0x765c264e30ddf052), teju_literal4(0x888d9c11ce59013e, 0x3d319a9a07097903, 0x2b525a0e5e330ab2, 0xb9d6d50553cbeb54) }, // -72327
+  { teju_literal4(0xf3283a56fe1c1303, 0x2d396e9cafc1fc87, 0x455ad52918d18534, 0x12e65b59b3d04bbe), teju_literal4(0xcf76c6ae8ae74f5d, 0xbce4bde11899c220, 0x618957c3c6978984, 0x3ec635edd5ce2805) }, // -72391
+  { teju_literal4(0x6611c1d942f4926e, 0x19c0ab1135a2d3e8, 0x0236c23b9857c66f, 0xfcedbe2f65aeccef), teju_literal4(0x9d995b98c151c950, 0x330a0c5d411c8614, 0x259bd895243a9148, 0x68ff73a0c00bb4fa) }, // -72455
+  { teju_literal4(0x541922828286543c, 0x3a4975ed9e43af82, 0x9fb1e8176f3b34a1, 0x9f11125523226a70), teju_literal4(0xef70551fa4d19da0, 0x38e2fa8c236f2faa, 0xdb21d7146f45c2e9, 0x4a79a06fffecb58a) }, // -72519
+  { teju_literal4(0xa2553504924630ba, 0x2e947cfb682e0cb5, 0xf0e0845ac2afad1e, 0x618d3f1e2d084fa4), teju_literal4(0xb5e37a6db256535a, 0x5250cccdc15cdaa2, 0x135b86892587ecc7, 0x25e6a68621491a83) }, // -72583
+  { teju_literal4(0xfe4802f4a922b5a4, 0xfd164b1963eff1a3, 0xd6380df9a6323718, 0x212ac15488694bc5), teju_literal4(0x8a2bbba3a40355ee, 0x1996074be1a26c4c, 0x2af7d0ee6cd4fd0f, 0xc9f64ca48ec7a047) }, // -72647
+  { teju_literal4(0x5f3af7e1399027ea, 0x6678294da5135ff7, 0x13913b5b16bef2d8, 0xab06fb9c259f2849), teju_literal4(0xd1ebf32a6684bd0a, 0x1fc9867d6940aefd, 0xb5f920585af0ab3b, 0xfa51235c0731d7d8) }, // -72711
+  { teju_literal4(0x61dab5cac29c43ad, 0xd81750afbb633f4d, 0xc89f5d66a1bd5b31, 0x2b282dfba5b6f899), teju_literal4(0x9f774e885e0f6cca, 0x4dc9f2a524251e15, 0xdb7fcb74ae83af53, 0xdd002ce26ba47ac3) }, // -72775
+  { teju_literal4(0x475b331b68151a78, 0xc211107c2c1cd42a, 0x01f527e348c869ec, 0x261fa5826c33b7f9), teju_literal4(0xf24679db6429c123, 0x0aaed2951f6beb04, 0x0415c0fa61984184, 0x1f3584feb6533954) }, // -72839
+  { teju_literal4(0x0a52a7d7cfdd3268, 0x83bbe405c118d428, 0x022f17cd21d659de, 0xbca5e58aedad7e42), teju_literal4(0xb80b16fdf1b1a0e1, 0x4721b746e4f30177, 0xc7ccd2b405a75732, 0x58930c4ba373cff3) }, // -72903
+  { teju_literal4(0xdf5172980db0fc19, 0xe5c1478cb50022f4, 0xb32da421f62ce3fe, 0x3c3c7c0f2f2934a3), teju_literal4(0x8bcec31dc30c8aab, 0x98886d58dea64182, 0x1521b69d5dc3f184, 0x93f606ff4c5f7490) }, // -72967
+  { teju_literal4(0xf211ac162c50e4c9, 0xe170e921cdd77ec2, 0x462e6d824350d66e, 0x3754b1fdd30f5ea6), teju_literal4(0xd46893bcee1b1172, 0x3cf41ccc666ee64c, 0x1fb9959f0507eb8d, 0x16978c42ff76dbbc) }, // -73031
+  { teju_literal4(0x6b85e0857528ccce, 0xba2ba48105f107cb, 0x7acd0a3f2685c517, 0x30d78be0f11e9b65), teju_literal4(0xa15aeaf07cf697c3, 0x50baa1dd85986d1c, 0xa13687e990b13648, 0x7e54974567d058ae) }, // -73095
+  { teju_literal4(0x4b769cd29a6ac207, 0x8895d89ab74ea0db, 0x8f7978272c8e8b53, 0x078f0b899fe6e81a), teju_literal4(0xf52538c20c1403ff, 0x0b4681d9bf1f59f8, 0x14d60960b9143297, 0x5eb1008c0769499c) }, // -73159
+  { teju_literal4(0xc9f916c8d5d3864f, 0x2fb97b00ca3f7b52, 0xca8a73e1ebc808df, 0xcc0341ccd6912425), teju_literal4(0xba393c6c06906f99, 0x882b85f54729329a, 0x85626b089349cfb9, 0x6af2a6b9516acb69) }, // -73223
+  { teju_literal4(0xb57d203f694c40ab, 0xe1fe3420bc0372e2, 0xd1eb1d4fc0f0ac76, 0x91506b09e32d2cd7), teju_literal4(0x8d76c160f255e8b3, 0xb6bd634d25935ac1, 0x168bbf167ecc59b2, 0x5ea1513b30a105fb) }, // -73287
+  { teju_literal4(0x0fb2a59367a09629, 0x083b9f5569cd3541, 0x23629534e506b341, 0x727f0db6aa68737f), teju_literal4(0xd6ecbf00c5753ce3, 0x17e6638625e7ae44, 0x8301e885a1b35931, 0xb2d8be4883256643) }, // -73351
+  { teju_literal4(0xea98fc023cbd3374, 0xbfeb281bf00e832f, 0x7a33bfd11037eeb7, 0xe7eabc0baade8b4d), teju_literal4(0xa34441fce9671dfa, 0xe382b6ccf06d1d4e, 0x4dc4f472837894c2, 0x885bf4cb8ff94bba) }, // -73415
+  { teju_literal4(0xbbfa17d51f92a8ca, 0xfb7edf6e3b82346f, 0x09629e6a704d1f14, 0x522a0936afbe0353), teju_literal4(0xf80cabea1a0ed585, 0x84bc1ba907615654, 0xf3312ca184536719, 0x5a437a1abce3a484) }, // -73479
+  { teju_literal4(0x789a2b22d76132e0, 0xb37429e16d3560fc, 0x3ee939440cf3dc84, 0x91358738db4d1188), teju_literal4(0xbc6dfe8939c7a6d0, 0x8663f47f4f3bd608, 0x5d25fd239871c895, 0x2990488d2e9fa8e0) }, // -73543
+  { teju_literal4(0xea7defaf433ba1df, 0x4beaf475b19d8e39, 0xf76d5a2740205c8b, 0xbbfc839d9b670488), teju_literal4(0x8f23c57b1796fd68, 0xa78497ec6f3dd8b8, 0xdf7e5149801e565b, 0x97d774d8f9498db1) }, // -73607
+  { teju_literal4(0x5a1ceb8a8443acf3, 0x2b2744e850cf096e, 0x4dfc1f55b52035a5, 0x6f7bddc4d9930dce), teju_literal4(0xd9788bd51d72df5f, 0xa51de95d4ff10c99, 0x4a9e3a383ed796a4, 0xfc2681097fc0d772) }, // -73671
+  { teju_literal4(0xa20e8b49d6549f58, 0x4c19767cb884c8d6, 0x7329583cdc3069ec, 0x4444b7055d0f4b35), teju_literal4(0xa533650d81d502f1, 0x27fffaec014e96e6, 0x973c1e596f8868ae, 0xfb938c8afc4788f5) }, // -73735
+  { teju_literal4(0x87871d324e42c1b3, 0x1b82464f807b800e, 0x201a900dd15a3108, 0xbd8bd32b8104c0ed), teju_literal4(0xfafcedb92961db0e, 0x1660b16e28312b1a, 0x0726f845a9acc6bf, 0xd374195c935171da) }, // -73799
+  { teju_literal4(0x21b5beb870a1f37f, 0xcd73dca4ede5b49e, 0x8598a10072743e8e, 0x48de7bfc4e737aad), teju_literal4(0xbea97162edde4a8f, 0xbd15ae7ecfa9a345, 0x02453844ce83b243, 0x2048a90a7dfd6fe7) }, // -73863
+  { teju_literal4(0x8b00da203fb4be60, 0x812871e23a37d2f0, 0x36d65353a7932297, 0x0dd83e14075cd218), teju_literal4(0x90d5dea7c033b3ec, 0x89c442de4e443ac4, 0x90b74058d3abd701, 0xc3351c47d2b96b00) }, // -73927
+  { teju_literal4(0x8babc4098e306e19, 0x12b71ec3c6cbca91, 0xfaa89a40079f3f44, 0xf3f15725246cf249), teju_literal4(0xdc0c115e83ed319a, 0x3b314127368247d4, 0x577f398c7e0f3992, 0x192ac537279d3d36) }, // -73991
+  { teju_literal4(0x19efe56d9f9dda7f, 0x5e60360f208980c6, 0x90d04ec34cc53b49, 0xe7245873a6cdc5f1), teju_literal4(0xa72865b6d5b57f29, 0xc726f06d5d3f7c5d, 0xdc4b5a86bc012b3d, 0xab9a1cc05dac4e31) }, // -74055
+  { teju_literal4(0xe7cbb75c78a9bfaf, 0xd0b25d58165e31f8, 0xe7ce1c120119febe, 0x042a9e4ea4a1f871), teju_literal4(0xfdf618e4e30d60bf, 0xf734d57be1a802b4, 0xdf1a7a419f614af0, 0x39349eba44c18c42) }, // -74119
+  { teju_literal4(0x67e285e70c038f38, 0x7f9dcb5fcae6cec0, 0xdb25626a5ff7f785, 0xb7714b8142015519), teju_literal4(0xc0eba943555184a5, 0x6e42601dd42c4254, 0x314f9b43f9c19902, 0x5684cb2a66dc3a29) }, // -74183
+  { teju_literal4(0xa87970b38e5173f3, 0x00bb0bd7cc099008, 0x754ee2c812f535ce, 0x446963fd95ec8483), teju_literal4(0x928d1c50abb16a25, 0x2f740255560d7abf, 0xfa334e1fb140af7b, 0x3deb70206da7e539) }, // -74247
+  { teju_literal4(0xa8bdc548036d0760, 0xa093a00b99800e71, 0x875502aae85f693b, 0xa36f4f47bbd42905), teju_literal4(0xdea76707b612686a, 0x674401208221aa90, 0xe529bca2fdee2122, 0x01b89414c787f5a6) }, // -74311
+  { teju_literal4(0x80694c33e0360619, 0x62b0502e56526ea6, 0x3a102257be262b41, 0x8fece5fc35100490), teju_literal4(0xa92355c2c54af617, 0xba8c9a714b210f78, 0xfc9e22542455fb4c, 0xb21a015ca748d5e6) }, // -74375
+  { teju_literal4(0x7a1ba5c5ca863f1b, 0xf50767aae901e77d, 0xbbc57aa29b967e52, 0x1fc8e4c22452ca98), teju_literal4(0x807c2439f848b848, 0xd3d3a57c6f8b5c6f, 0x78b5865488fe3a1b, 0xe05f872dacc95c1a) }, // -74439
+  { teju_literal4(0x3ed02a916ca35a1e, 0xf05794ff3abfbfb3, 0xce8689b966ca6f9b, 0xb5de5d8c1cc5d795), teju_literal4(0xc334bab22b016f11, 0x78584b559937306d, 0x21709a854e729938, 0xf9b1d43fd34dc7fc) }, // -74503
+  { teju_literal4(0x0bb124fe0830d9d5, 0xbf8e76902f826369, 0xc9faa9174909d7cb, 0x9092297c9c2185f3), teju_literal4(0x94498e0e57cfebab, 0xf6677ffaf6207b62, 0xaadc63649c0c6593, 0x1b2e36c0f0f622c5) }, // -74567
+  { teju_literal4(0x0699e1eb6e2ec4b8, 0x69ccf289d5e33283, 0xecc4830c32f824e1, 0x8da5f5f4ab440e04), teju_literal4(0xe14aa482753f0aca, 0xbd7761116a37fb61, 0xb488548e630bc417, 0xa1704689ec940a24) }, // -74631
+  { teju_literal4(0x039b9dfdb3b8efd2, 0xbfbc71d366ddd17f, 0x87952799c189d4c2, 0xdb7782b0ee335d59), teju_literal4(0xab2447312355892b, 0xcb69ee5fee9545fd, 0xa20fc4977909b6ec, 0xf46f4329f1cf3525) }, // -74695
+  { teju_literal4(0xf1262165eee2bf3d, 0xca0a3557fee5c6c5, 0x23009578bb3aae6a, 0x651fd65b8a97a129), teju_literal4(0x8201cbdf78ca971d, 0x8291629888044704, 0x871b7eecd6fff04e, 0x7b627924d275a62f) }, // -74759
+  { teju_literal4(0x4bda94fd0a766ac2, 0x14f1c823752c0c5f, 0x894ba3e203206d56, 0xfa961b4daf13043d), teju_literal4(0xc584ba756ccd2c2c, 0x28d15cc23b854ffc, 0x21ccb8df41f8b459, 0xac755b7cbf49d422) }, // -74823
+  { teju_literal4(0x60855d901142d2e5, 0x3131dc8735fa0d3e, 0x051f626fa9b2208e, 0x2215b3f6a61d6e85), teju_literal4(0x960b43a88e4b4c15, 0x5e0629bfd64c540e, 0x43f17330ea1ae8e2, 0xf84b7d9704684fe2) }, // -74887
+  { teju_literal4(0xc954fdd1eead4236, 0xa615926aa2ec9116, 0x4efd345c1ea9a62f, 0xb621d71aeefad054), teju_literal4(0xe3f5e1c85e5cc910, 0xe1ab06d9d096e1cb, 0xd883562e6f32addc, 0x2ae77b5e4e2acc97) }, // -74951
+  { teju_literal4(0x040a69004ad87a5b, 0x49a2c821d757e23a, 0xb83f5c95f4566b34, 0x4e35366dce578beb), teju_literal4(0xad2b4c3858ae05b4, 0xa8d35bc0e9e0a00a, 0x1807d9a79f493eb9, 0xee856db4af3d1f5b) }, // -75015
+  { teju_literal4(0x304297a98cf21802, 0xa2a7df40a470a1ec, 0x75d8f34587105f77, 0x7d7b05c734ff08fc), teju_literal4(0x838c1138ba3b987d, 0x045f723244789923, 0xd3f66a88d0e9616e, 0x5757f35b54509c60) }, // -75079
+  { teju_literal4(0xce7daa4c2ef2f4f9, 0xec1bf0905225e47d, 0xb6511e3fb6530130, 0xad3cf0518d6269ae), teju_literal4(0xc7dbbd921864ecb8, 0xbd58828003bfb509, 0xbbd3bf1c9d2ecfd7, 0x089d0bc911e97f26) }, // -75143
+  { teju_literal4(0xeb891f796751acb6, 0xc115a4ecd890c981, 0x7905828ee6febdb1, 0x06cb6ed558c37252), teju_literal4(0x97d24d16f44ba911, 0xe9245d0769fad462, 0x1ec98c8624902b18, 0x53d24b734635eeaa) }, // -75207
+  { teju_literal4(0x6e350270a223cd52, 0xa00ab0e4815fd9fd, 0xb3a0c3e71c49a122, 0x75cdbddd07c1d39b), teju_literal4(0xe6a9371bc3ce7afd, 0x5a07eb5882d5b491, 0xf3412d4d78419efa, 0xc5e08a81f113168b) }, // -75271
+  { teju_literal4(0x26244fc4518d238b, 0x59af44cc37b27967, 0x1173635e7d8cfe39, 0x162f4ce8d97c5778), teju_literal4(0xaf38774609d0fca8, 0x8e82f1b8827ee6dd, 0x53f76a6bee358ba8, 0x9e19944b875d80b5) }, // -75335
+  { teju_literal4(0x4c65c548544c572b, 0x525590252c7030b3, 0xce55773e5e7e70fe, 0x308d49324d23ffa2), teju_literal4(0x851b024578e7d73f, 0x0c8281cd62c840a3, 0x6a54343977d0f835, 0x5b5e5eb6a7de91d5) }, // -75399
+  { teju_literal4(0xb3c147b6376f0fb4, 0xf2c08ddd1eb16f74, 0xd0c7c06d39999b0e, 0x2a939cef91958629), teju_literal4(0xca39d94cea58982d, 0x4cb28b50216aa466, 0x991436f0ef1ca85e, 0x41ea07418159037c) }, // -75463
+  { teju_literal4(0xaa3610bdcadd8c20, 0x1dbf38d4ebacc3a9, 0xc1558a3d277a19d2, 0x935eaca7a2f55679), teju_literal4(0x999eba819b87ec2d, 0x7eb2519c55490bcc, 0x7045ac0577ef7ef0, 0xcb9d7458718ab213) }, // -75527
+  { teju_literal4(0xa5746ab9e2dd4d88, 0x03400702df5a1305, 0x6ef0b3682c76f2c5, 0x0f34ca240cc93cf7), teju_literal4(0xe964bd0889f10171, 0x93c1a46cdb696158, 0x56d3aa3e2a20088e, 0x352805663045a442) }, // -75591
+  { teju_literal4(0x22c787e6e2eb16f3, 0x6ddcbff9bbee66e0, 0x07931eb0a19f2aa4, 0x44eb67ba3cbf760a), teju_literal4(0xb14bdaffbe5fe50e, 0x5a31b7f05fe464b3, 0x706b40fb28b838c1, 0x983be328d17e7cec) }, // -75655
+  { teju_literal4(0xf97f709121741ec6, 0x51c58e66fbaa4d6e, 0x93e9d11a5b8bf986, 0xcb9471009dcf4f09), teju_literal4(0x86aead2fe576b288, 0xd6c6dcfb0c1d2d50, 0x5d0bb390e869a30c, 0xbf4241ea689f4e54) }, // -75719
+  { teju_literal4(0x171ebd2763cb3dc6, 0xb6d1c4d32261402a, 0xd4cbe572367dac3b, 0xb90b672943c80612), teju_literal4(0xcc9f232b1f69dfce, 0xc886df380ab7c05d, 0x9312f5392d2fbac8, 0x4b7ab5a34e807c20) }, // -75783
+  { teju_literal4(0xc64c256d2ecf8402, 0x15df2b641cbcc8c1, 0x7450d6576bf31f0c, 0x4d360c318e92befc), teju_literal4(0x9b709c419520b364, 0x6a1c734627eba67e, 0xabcad39dce3d9a04, 0x9a606bd9c12139a1) }, // -75847
+  { teju_literal4(0x575b694b66478901, 0x2bec6a446ab65266, 0x72cda7607cc67d9e, 0x29d1e5e67be0f5b4), teju_literal4(0xec288c650638e011, 0xae03dae8bd3c27f1, 0xa30f5b5d64687ea9, 0x956ade6c4e9815ad) }, // -75911
+  { teju_literal4(0xe9b4a2351f4e3c80, 0x443a48f3bfe78786, 0xa2fe7d72a5b744ed, 0xa3b3ffd55068bee7), teju_literal4(0xb3658a438a9e3b8f, 0x3f359e5c41badfbb, 0xf5354a064446cf9d, 0xc577e194a8e59882) }, // -75975
+  { teju_literal4(0x0b3e48e848a66c1f, 0x0838bf350c0786e7, 0x8e5533fbe54c3807, 0xb1a1749a96bb0471), teju_literal4(0x8847204d25ab2717, 0x82c811749bd380fc, 0x685f755b288e442e, 0xbc8dad8b2eb9da56) }, // -76039
+  { teju_literal4(0x8afda848e8f60a7b, 0x611e7a70dfa2af59, 0xf71af139f96dd8ad, 0x881d415298656a41), teju_literal4(0xcf0bb0f3382899d2, 0x6a10a6a9ccc68e7f, 0xf37db10f1656be07, 0xab727fa6c9a15f25) }, // -76103
+  { teju_literal4(0xe6d3bcd514e8a877, 0x8cbb3abd687f8053, 0x280224721ccd4c2f, 0xf1299f902248a61b), teju_literal4(0x9d4802e186389765, 0xe16b06e0050d3eee, 0xf478778a63b73168, 0xd533bdb74d2a0b5c) }, // -76167
+  { teju_literal4(0xf2905fc62f39ca6f, 0x0ebcd88814502732, 0x309753fb4ad5b19e, 0x7c729ebfc0cd41d1), teju_literal4(0xeef4be52e0f47ad5, 0xf46c98c505304d7e, 0xb1a437e919e88e5d, 0x7ffe1c49b296c796) }, // -76231
+  { teju_literal4(0x1a3cadc843a83028, 0xaf13b5621e306589, 0x56656ee03f9a784f, 0x7961c211c1db640d), teju_literal4(0xb5859828baf0a3c3, 0xa8f35ca6d492432b, 0x6fca7270cfc0396c, 0xaadb530b486113c6) }, // -76295
+  { teju_literal4(0x8522e0caa0186f0e, 0x3e95e59a20fb59a9, 0x84c288ce4e37f956, 0xdbfd9f30017de7b0), teju_literal4(0x89e46a1dd6aa9f09, 0xeb3cebdffbfd2548, 0x1c191f1c416c29c2, 0xc8aaa7059d2134e4) }, // -76359
+  { teju_literal4(0x54c4745604711d6a, 0x017b8dcd040645cb, 0x314a5a3114d76428, 0xb5e03402f4ce492a), teju_literal4(0xd17f98adbee05686, 0xe0b99a60d0f77461, 0x5c3b9ca0642d8dc6, 0x9ef84fce727730a9) }, // -76423
+  { teju_literal4(0x5761ff4a49053d60, 0x8471511222516d46, 0xa2ebd22a0b7a5284, 0x10e06fda152d36a2), teju_literal4(0x9f24ff1e3e4f162c, 0x21790d7ef7bb241f, 0xa813a1994ff0fc4e, 0x1c49b2084b72d40f) }, // -76487
+  { teju_literal4(0x46ac438880847461, 0x84512f5a20067ad9, 0x42aa1de54b4d9032, 0xcdbfa9496aa32bbe), teju_literal4(0xf1c96c3ff9bafb96, 0x499198ccc56b0a12, 0x3eb4e020fd29762f, 0x75e0f536cdb0fb91) }, // -76551
+  { teju_literal4(0x0b9b41779516dc6c, 0x87e3d6f4ba87702c, 0xe14a083cd4fe9370, 0x670bc8f6bd4937c9), teju_literal4(0xb7ac18008164220d, 0xf0a07ee5fbe4c315, 0xb7cbe8fc2a1d2cb7, 0x8c7be7a6ea6a5804) }, // -76615
+  { teju_literal4(0x05310f56205449dc, 0x956cba5a3e1709b9, 0xd2834bd82aa1ee17, 0x22b550c85528844c), teju_literal4(0x8b86994e90ced851, 0x0b3127d56af4becb, 0xa9557745c71d09d6, 0x2d03c832a734eb15) }, // -76679
+  { teju_literal4(0x3a7f96642342a36d, 0xc0c5eb0008a1a7b6, 0x29e8f40df042d448, 0x2286e676f067c840), teju_literal4(0xd3faf0a60fde3697, 0xbfdaff33b96ed330, 0x73f8f130171f5d22, 0x1156d92c7cb52e53) }, // -76743
+  { teju_literal4(0xcef105419a6a9b18, 0x42a54de87c3dcb81, 0x997a72eb24ecd99c, 0xb1035edbb05bdeb2), teju_literal4(0xa107a1e74f637892, 0x4fb83cab36506211, 0xbeb36c4ff62c909e, 0xb054274340564a09) }, // -76807
+  { teju_literal4(0x75f69acb612acf09, 0xd4bf1fea2ce3e558, 0x8778866efa1a308f, 0x881f232d96cd647b), teju_literal4(0xf4a6afe74e8ffbe8, 0xf53e82cf913f33d9, 0x225225ba1e8b2ac5, 0x514440a5f615b37f) }, // -76871
+  { teju_literal4(0xd3e3526d3cffbe5c, 0xb50f4eff7bd7e262, 0x0dfb1046709b5213, 0xa29b82411e4ee823), teju_literal4(0xb9d91d56a543974c, 0xf7b4aa9472804c81, 0x098f3aad3f3d5b4d, 0xd1564b891819c709) }, // -76935
+  { teju_literal4(0x25816f39cf62bceb, 0xc71afa38863b4a9f, 0x0f51c788c82eaf47, 0x8a660fe703640b31), teju_literal4(0x8d2dbcb86d078ff5, 0x2dd6e461da196f4f, 0x72baf58dca4bca2c, 0xf9a1ebc607f126ab) }, // -76999
+  { teju_literal4(0x20bf490e0cb8f1fa, 0x56af31257d3a9bdc, 0x56dbd888597bdf99, 0xc640af1feac96d53), teju_literal4(0xd67dcf6b24161ecd, 0xafd35310dfa7055d, 0xc3ed92440e2704df, 0x35603a375d3b7d52) }, // -77063
+  { teju_literal4(0x7ff442fc520ab696, 0x94ab12aa0e2ea779, 0xead445aaf289cb11, 0xb740ede29d4106a7), teju_literal4(0xa2effc5fa7e519c0, 0xf65963916441d4c2, 0xf722916675db20eb, 0x698de9603b535dfb) }, // -77127
+  { teju_literal4(0x769047ec3fcfce90, 0xfda32fd7b1d87694, 0x19f15124d9c5b512, 0x4baae0fd88a1478c), teju_literal4(0xf78ca351e5c42847, 0x3651f6514aef84f0, 0x31f27eff47d95086, 0xb1dc3f07c27ad7c8) }, // -77191
+  { teju_literal4(0xf4f905a7aa3309b7, 0x688bfe81c2c0c8e7, 0x966a39226498bdaf, 0x2c85532995ded8ad), teju_literal4(0xbc0cbbf234c1ba60, 0x261beaef343da1d1, 0x9f0b909d17d42e77, 0xb85bb685bb206d95) }, // -77255
+  { teju_literal4(0x3f825e2cb83c1c7f, 0x8403da846418de3a, 0xf8cfeae3481ed00b, 0x5a3f706fb68866d1), teju_literal4(0x8ed9e3618bd0ae8f, 0xdb3f77a8879bc2dc, 0x3e6e9720078e7e44, 0x1c6c33987eaa0455) }, // -77319
+  { teju_literal4(0x1d6641212a15407b, 0x770a8606a68be854, 0x9a919de7cca73310, 0xb9f147c860bb8675), teju_literal4(0xd9084bd05e2e7b3e, 0x90009e8257db5f4e, 0xee798da988174d0f, 0x5b5fb938a1c7895d) }, // -77383
+  { teju_literal4(0xa8c90767029c6851, 0xfdbee2eb75e65107, 0xd6099c4c3a185ee3, 0x1f69e17c3fd3c38e), teju_literal4(0xa4de1fde2e7687ab, 0xae7e9086049d9530, 0xdd848b864b9b003a, 0x5f41e1e52dd12c48) }, // -77447
+  { teju_literal4(0xd9b9679e1dc296bb, 0x3afe4c7b7c6dc3e7, 0x947166e0d8aabcb6, 0x56363211da459993), teju_literal4(0xfa7b60d7ba9b2a4d, 0x7cf37c992d2ee394, 0xf0964e0bf48e7da5, 0xdcc8f6e75f6855d5) }, // -77511
+  { teju_literal4(0x640e02212580bbbe, 0xb6de31c3d6da2fd6, 0x77522e0a3ac65d36, 0xb33045b11da5f296), teju_literal4(0xbe4707d638bdde5e, 0x6395a7c293f60eff, 0x22ff2eb1016e6916, 0x617eb3eb43c69698) }, // -77575
+  { teju_literal4(0x3cc55dd8a57c8611, 0x1d0c80faf5796f2f, 0xd092117170a31a8d, 0xd84bee373c7a037f), teju_literal4(0x908b1c7d9dc1c0b7, 0x35da4b0213fdba65, 0x073befa741c98dc9, 0x4a003ed77a927798) }, // -77639
+  { teju_literal4(0x1a359f1f0ebb4a68, 0xe91b7402ab679dae, 0xfa2ff78e978dfa8f, 0xa9f909d3fc674d44), teju_literal4(0xdb9a7cee59f9d9b2, 0xc7046b03a8087f42, 0xacbdfd5a74a53730, 0xc16bfa311f5d7dc5) }, // -77703
+  { teju_literal4(0x56cffae06209b503, 0x4434da82b2bcb9d2, 0x7ff7721a18606314, 0xa3594b0e6240b10e), teju_literal4(0xa6d21dee5f89046d, 0xf93de87e7383024c, 0xa24035033bccd7a5, 0x2e39fc0df2139347) }, // -77767
+  { teju_literal4(0x5da91e13e54e7084, 0xbff654deb84a486f, 0x0f75b0e5f482e8a3, 0x86a4907a2caf93c7), teju_literal4(0xfd730320acbf411c, 0x318708100243406f, 0xc7c5cdb8e7ee7e77, 0xfaeee0cf274b8a3a) }, // -77831
+  { teju_literal4(0x5b3ab7611777b469, 0xb3743616b464eb23, 0x78ec475bc85c1587, 0xa51a244a662c6af6), teju_literal4(0xc08815426aa9e783, 0x1286f910928d80ab, 0x7424a5b0764395ac, 0x5de97bbbb7fa102d) }, // -77895
+  { teju_literal4(0x0930096b925273cc, 0xb0d1294cdff33e08, 0x4458fa3943d03c11, 0x39723b37e63e240c), teju_literal4(0x9241776e6dbb949f, 0xcc9cf55e7de2ea80, 0xbe76b0c8294f642d, 0x0e588324b0e73657) }, // -77959
+  { teju_literal4(0xc7fcbc0c914d74f0, 0x45fe76dbf8d27050, 0xbd300cf1b30b660f, 0x8ca0a21b461be9f1), teju_literal4(0xde347a23be65b919, 0x3b55b1ad3cfa890c, 0xc91b5980d04f4755, 0xc83bde9386694d30) }, // -78023
+  { teju_literal4(0x40e2372c7c6a4eb1, 0x00f733ca239e236d, 0x186b8725857b57e3, 0x3a5cbf0767852775), teju_literal4(0xa8cc0850ecd6011a, 0xfa5c1f103e22564d, 0xf51784daa497f812, 0xf0773040a909525f) }, // -78087
+  { teju_literal4(0xd83aad7246e09f68, 0xadc3d96f1399ebf6, 0x4486cc0d47d19e96, 0x3af3f915478936ff), teju_literal4(0x8039d292b945842c, 0xa615d9cd7a9d314c, 0x76a13a1f65969ffc, 0x63158a3e8d5d39ca) }, // -78151
+  { teju_literal4(0x353ef1894fb2332f, 0x82a52e2cc0267c0e, 0x782237904adfac47, 0x05fbcb0f7744e121), teju_literal4(0xc2cff8b3ec97e42f, 0x85c6ad12187bf9c0, 0xd6db8c6d8babb2b2, 0xe2b959b8c0f1826e) }, // -78215
+  { teju_literal4(0x53689e0ce45950b5, 0x5627084f4d55c752, 0x9d585885145473ef, 0xb82a92cf06b226ed), teju_literal4(0x93fd03c46cb8e4ee, 0x4849b47c78de051a, 0xbb2e31bad8e4afd5, 0xd76ce0812eaf83e1) }, // -78279
+  { teju_literal4(0x9458e0e3b9d89cdd, 0x8151606c7e98438b, 0x5403e0a2bd42ba5a, 0x9eb57889ffa1f42f), teju_literal4(0xe0d65b1611e6023a, 0xa03ed68750b245ef, 0xcd89869fc3e69014, 0x015567ca20ec0140) }, // -78343
+  { teju_literal4(0x640bf18cba6778b3, 0xca6384ba0075a12d, 0xcaa46b7b0e9067dd, 0xf3cdba29f920ac58), teju_literal4(0xaacbf0fc5ebc3b8c, 0x573781f74cd0f238, 0xcefffbbe802eca3e, 0xe67a1f832c61e861) }, // -78407
+  { teju_literal4(0x4ee772e47bcf33dd, 0x842924240039fef6, 0xa8baa453c2ab13ae, 0xd10ef642c3fddfe3), teju_literal4(0x81beb1184719040d, 0xd3acaf57d7926449, 0xa5689d6ba287e791, 0x04a622c68ad3ef7c) }, // -78471
+  { teju_literal4(0x03fb6c97a8155237, 0x9ec498a82e423448, 0x1040acb5e7900269, 0x2e21bbbd2dafae93), teju_literal4(0xc51ec6e60375d2f5, 0x92803e674b0bcafa, 0xa525c5a9a7e34ae5, 0x7a6a60ba215fe240) }, // -78535
+  { teju_literal4(0x201061232f59fe11, 0xeb982d9228da7551, 0x0d01670f3ebe8535, 0xeaf5325c73226422), teju_literal4(0x95bdd13f3f470793, 0x55112883166ef11d, 0xefdc9d9ed21183a4, 0xb687852a057b6da6) }, // -78599
+  { teju_literal4(0x81be9d3880b2bbac, 0x4a1178f01652afe3, 0x5bc890a8027f194b, 0x264eb2631fa93bc8), teju_literal4(0xe38037b29164b477, 0xb60aba682c113a49, 0x487c4507a40a4f40, 0xab52e55e3cd1b8ab) }, // -78663
+  { teju_literal4(0xa370b295b42eba07, 0xb5e56a9863136dd4, 0x604f4ab446ea5ce4, 0x23f676b975b6609c), teju_literal4(0xacd1ea1db78639e8, 0x83a296b7153255f3, 0x5a6b124b858109a3, 0x20cd80c2383fab4d) }, // -78727
+  { teju_literal4(0xa8bdee885bc69cba, 0x1decd5382583bc54, 0x89a266c7fbe9da78, 0xbac7790f4524bff9), teju_literal4(0x83482aefa2e8610f, 0xe8582aa2f72d3ad2, 0xcbb0e2c41609ebbf, 0xe69350434710d0df) }, // -78791
+  { teju_literal4(0xf977d3e86cf4bdbd, 0x0790b4ecd89203d0, 0x78c7afc969308359, 0x54297f89a8c410a6), teju_literal4(0xc77494d2d37e3271, 0x6d416fd75d43efb2, 0x93db37fca2d78d83, 0xc88858801a4c45c0) }, // -78855
+  { teju_literal4(0x1cd46a1013a0132c, 0xb02a55b7d14d7e4b, 0x3a7c91bdb3437808, 0xccd83fc8545a5def), teju_literal4(0x9783efce4caba69a, 0x4407a26b1afc812c, 0xdd9b4a0dce42925b, 0x1407f8500beab438) }, // -78919
+  { teju_literal4(0x14548472fe2a5666, 0xdd060e07866a4d0a, 0xa18ccb84a2f28040, 0x68de849f3431f06a), teju_literal4(0xe632282f09bd683d, 0x9cccb477b47a137d, 0xb1f586c2e0df07c6, 0xf1cb83e354e77a02) }, // -78983
+};
+
+static teju_constexpr const teju_u1_t pow5[] = {
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001), // 0
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000005), // 1
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000019), // 2
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000000007d), // 3
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000271), // 4
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000c35), // 5
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000003d09), // 6
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000001312d), // 7
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000005f5e1), // 8
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000000001dcd65), // 9
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000000009502f9), // 10
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000002e90edd), // 11
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000e8d4a51), // 12
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000048c27395), // 13
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000016bcc41e9), // 14
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000071afd498d), // 15
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000002386f26fc1), // 16
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000b1a2bc2ec5), // 17
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000003782dace9d9), // 18
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00001158e460913d), // 19
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000056bc75e2d631), // 20
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0001b1ae4d6e2ef5), // 21
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000878678326eac9), // 22
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x002a5a058fc295ed), // 23
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00d3c21bcecceda1), // 24
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0422ca8b0a00a425), // 25
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x14adf4b7320334b9), // 26
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x6765c793fa10079d), // 27
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000002, 0x04fce5e3e2502611), // 28
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000000a, 0x18f07d736b90be55), // 29
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000032, 0x7cb2734119d3b7a9), // 30
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000000000fc, 0x6f7c40458122964d), // 31
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000000004ee, 0x2d6d415b85acef81), // 32
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000000018a6, 0xe32246c99c60ad85), // 33
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000007b42, 0x6fab61f00de36399), // 34
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000002684c, 0x2e58e9b04570f1fd), // 35
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000000c097c, 0xe7bc90715b34b9f1), // 36
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000003c2f70, 0x86aed236c807a1b5), // 37
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000012ced32, 0xa16a1b11e8262889), // 38
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000005e0a1fd, 0x2712875988becaad), // 39
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000001d6329f1, 0xc35ca4bfabb9f561), // 40
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000092efd1b8, 0xd0cf37be5aa1cae5), // 41
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000002deaf189c, 0x140c16b7c528f679), // 42
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000e596b7b0c, 0x643c7196d9ccd05d), // 43
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000047bf19673d, 0xf52e37f2410011d1), // 44
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000166bb7f0435, 0xc9e717bb45005915), // 45
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000701a97b150c, 0xf18376a85901bd69), // 46
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000023084f676940, 0xb7915149bd08b30d), // 47
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000af298d050e43, 0x95d69670b12b7f41), // 48
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00036bcfc1194751, 0xed30f03375d97c45), // 49
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00111b0ec57e6499, 0xa1f4b1014d3f6d59), // 50
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00558749db77f700, 0x29c77506823d22bd), // 51
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x01aba4714957d300, 0xd0e549208b31adb1), // 52
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x085a36366eb71f04, 0x147a6da2b7f86475), // 53
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0x29c30f1029939b14, 0x6664242d97d9f649), // 54
+  teju_literal4(0x0000000000000000, 0x0000000000000000, 0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d), // 55
+  teju_literal4(0x0000000000000000, 0x0000000000000004, 0x140c78940f6a24fd, 0xffc78873d4490d21), // 56
+  teju_literal4(0x0000000000000000, 0x0000000000000014, 0x643e5ae44d12b8f5, 0xfee5aa43256d41a5), // 57
+  teju_literal4(0x0000000000000000, 0x0000000000000065, 0xf537c675815d9ccd, 0xfa7c534fbb224839), // 58
+  teju_literal4(0x0000000000000000, 0x00000000000001fd, 0xca16e04b86d41005, 0xe46da08ea7ab691d), // 59
+  teju_literal4(0x0000000000000000, 0x00000000000009f4, 0xf2726179a224501d, 0x762422c946590d91), // 60
+  teju_literal4(0x0000000000000000, 0x00000000000031c8, 0xbc3be7602ab59093, 0x4eb4adee5fbd43d5), // 61
+  teju_literal4(0x0000000000000000, 0x000000000000f8eb, 0xad2b84e0d58bd2e0, 0x898765a7deb25329), // 62
+  teju_literal4(0x0000000000000000, 0x000000000004dc9a, 0x61d998642bbb1e62, 0xafa4fc47597b9fcd), // 63
+};
+
+static teju_constexpr const uint32_t corrections[] = {
+  0x5aa669a9,
+  0x6a5966a9,
+  0xa5655aa9,
+  0xaaa6aaa9,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x65565555,
+  0x55565555,
+  0x55555955,
+  0x5a555955,
+  0x5a65a6a9,
+  0x6a6aa9aa,
+  0xaa5aaaaa,
+  0xaa66996a,
+  0x9aa5aa65,
+  0xaa9a9a9a,
+  0x9a6aa65a,
+  0x9aaaa5a6,
+  0x55955955,
+  0x55565965,
+  0x55559555,
+  0x55965565,
+  0xba6aaa99,
+  0xaaa9aaaa,
+  0xaa6aaaaa,
+  0x9aaaaae6,
+  0x55695665,
+  0x6a965aa5,
+  0x65659656,
+  0xaa65a555,
+  0x55555555,
+  0x55565555,
+  0x55555555,
+  0x59559559,
+  0x66aaa9a5,
+  0x5566a6a9,
+  0x6a6aaa9a,
+  0x9aa66aa6,
+  0x55656a55,
+  0x55995955,
+  0x5565566a,
+  0x65565565,
+  0x55595655,
+  0x655955a9,
+  0x55559555,
+  0x65555556,
+  0x95555555,
+  0x55955655,
+  0x59956555,
+  0x55655655,
+  0x96aa99a9,
+  0x66566956,
+  0xa5aaa599,
+  0x59666555,
+  0xa6abaaa9,
+  0xaa69aa6a,
+  0x596aa69a,
+  0x6aa9a6aa,
+  0x55555555,
+  0x69555555,
+  0x55555555,
+  0x55555555,
+  0x99a566a9,
+  0x99aa96aa,
+  0xa56aaaa9,
+  0x9aaa9696,
+  0xabaaaea5,
+  0x69aa9aa9,
+  0xaae5a6a9,
+  0x5aa9abaa,
+  0x55555655,
+  0xa5556555,
+  0x56599565,
+  0xa5555555,
+  0xa6aaa969,
+  0xaa69a6a9,
+  0x6a9aaa96,
+  0xaaa596a6,
+  0xa69aa995,
+  0xaaaaaaaa,
+  0x666a9669,
+  0x5a9a5a9a,
+  0x5a555555,
+  0x55555556,
+  0x5a555555,
+  0x55565555,
+  0x95955559,
+  0x59955966,
+  0x5955a5a9,
+  0x56659699,
+  0x959995a5,
+  0x95955555,
+  0x56556555,
+  0x69966665,
+  0x5595a555,
+  0x55555555,
+  0x55655555,
+  0x55555556,
+  0xa5a5a959,
+  0x6aa55a66,
+  0x595559a5,
+  0x699a965a,
+  0x5a555655,
+  0x95955559,
+  0x95595955,
+  0x55556555,
+  0x969a6aa5,
+  0x999a9aa6,
+  0xa66a9a99,
+  0x6aa6aa6a,
+  0x59665969,
+  0x95569a56,
+  0xa669556a,
+  0x559a5569,
+  0xa5aaaa99,
+  0xaa6aaaaa,
+  0xaabaaa9a,
+  0xaa5aaaa6,
+  0x969a59a5,
+  0x96559559,
+  0x6569555a,
+  0x65669555,
+  0x59a6aaa9,
+  0x6a6aaaa5,
+  0xaa5aa996,
+  0xaa5a69a9,
+  0xa59a9a59,
+  0xa5a5a969,
+  0x66aa9595,
+  0x9aa9555a,
+  0x6a69a6a5,
+  0x56aaaa9a,
+  0xaa9a6995,
+  0xa5aa5565,
+  0x6aaa5a69,
+  0x9965a99a,
+  0x5a69a696,
+  0xa6aa66a9,
+  0x55566955,
+  0x95695965,
+  0x55569556,
+  0x59555955,
+  0x65a9aa99,
+  0x966999a9,
+  0x965aa6a5,
+  0x5696696a,
+  0x6aaaaaa9,
+  0x69ea9aaa,
+  0xaa6aa79a,
+  0xa9aaeaaa,
+  0xaa9666a5,
+  0xa69aaaaa,
+  0xa66a9aa9,
+  0xa5aaa9aa,
+  0x6aa6aaa9,
+  0x95aaaaaa,
+  0xaaaaeaa6,
+  0xaa9aa9aa,
+  0xa6aaa9a5,
+  0xa996aa69,
+  0x9aa6aa69,
+  0xaa99aa6a,
+  0xa9a9aa99,
+  0x9aa66a95,
+  0x669aaa9a,
+  0xa6aa6a9a,
+  0x6a96a9a9,
+  0xa9a69a9a,
+  0x99595aaa,
+  0xa9699a9a,
+  0xaaa96a95,
+  0x96aa66a6,
+  0x96aa66a9,
+  0x95a669a5,
+  0x5a555555,
+  0x6659555a,
+  0x56565559,
+  0x565a5995,
+  0xa69aaaa9,
+  0xa6a6aaa6,
+  0xa5aaa969,
+  0x6669965a,
+  0x56559655,
+  0x6a959659,
+  0x55955559,
+  0x5555a555,
+  0xa9ab9a65,
+  0xaaabaf9a,
+  0xaa6aa7aa,
+  0xaabaaaaa,
+  0x59555595,
+  0x559555a5,
+  0x5a566555,
+  0x5599a555,
+  0xaaa59aa5,
+  0x6aa5a6aa,
+  0xaa6aa69a,
+  0xaaaaa99a,
+  0x96555555,
+  0x55565955,
+  0x5556a999,
+  0x55555565,
+  0x99599655,
+  0xa6556995,
+  0x95955556,
+  0x55656555,
+  0x65959555,
+  0x59556a59,
+  0x555599a6,
+  0x55669655,
+  0xa659a9a5,
+  0x56aaa56a,
+  0x69996a66,
+  0xa5aa566a,
+  0xb9aaaa59,
+  0xaaaaeaae,
+  0xeabe6aea,
+  0xaaaea9a6,
+  0xaaaaa9a5,
+  0x66aaaa69,
+  0x5aa9aaa9,
+  0x5965966a,
+  0xaaa5aaa9,
+  0xaa9aa6aa,
+  0xaa5aaaa6,
+  0xa79a9a6a,
+  0x56656665,
+  0x66a69655,
+  0x6569996a,
+  0x999a5595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0x65656569,
+  0x99595a96,
+  0x95556555,
+  0xfaae5aa9,
+  0xaaabaaaa,
+  0xbaeaea9a,
+  0xaaa5abaf,
+  0x6a6655a5,
+  0x56a55996,
+  0x96659665,
+  0x69955a65,
+  0xaa669aa5,
+  0x69a6aa55,
+  0x56659a99,
+  0x9aa5a596,
+  0x55555599,
+  0x55555559,
+  0x55555955,
+  0x59555599,
+  0x66aaaaa9,
+  0x6aaa96aa,
+  0xaaaaa5a6,
+  0xaaaaaaa6,
+  0x9aae6a69,
+  0x6aa6aaaa,
+  0xb9aaaa6a,
+  0x996aa6aa,
+  0x9669aa55,
+  0x9a69a9aa,
+  0xa6aaa6aa,
+  0xa99996aa,
+  0x65a6a5a9,
+  0xa9a6a6a9,
+  0xa959aa9a,
+  0x69aa6669,
+  0xa69a5aa5,
+  0xa66aa9a6,
+  0x65a66a69,
+  0xa9a55aa9,
+  0x96966a59,
+  0x5aaa6a66,
+  0x5a96a56a,
+  0x66a555a6,
+  0x5a9555a9,
+  0x55955a69,
+  0x65955599,
+  0x5666a555,
+  0x56569695,
+  0x965669a9,
+  0x5555a995,
+  0xaa5a9959,
+  0x556a6955,
+  0x55556555,
+  0x59555595,
+  0x59595555,
+  0x55a9a695,
+  0x65655956,
+  0x55595665,
+  0x55666595,
+  0xa9aa9aa9,
+  0xaaa9abaa,
+  0xaa9a69ea,
+  0xaaaaa9aa,
+  0xaaaaaaa9,
+  0xaaabaaaa,
+  0xaaabaaaa,
+  0xaa7aa7aa,
+  0x9a99a5a9,
+  0x66a9566a,
+  0xa9695a55,
+  0x5aa65595,
+  0xaaab9a69,
+  0xbab9aaa9,
+  0x9aaaaaaa,
+  0xee596aaa,
+  0x55695555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5aaa9699,
+  0xaa69eaaa,
+  0x96aaa9aa,
+  0xa6aeaaa6,
+  0xaa5a5a65,
+  0x5aaa59a5,
+  0xa9aa96a6,
+  0xa699aa9a,
+  0x9a6a95a5,
+  0x655556a6,
+  0x5a5a5555,
+  0x56556566,
+  0x69ebaaa9,
+  0x9ea5aaaa,
+  0xaab9abaa,
+  0x9aaab9aa,
+  0xa6999aa5,
+  0x9a6a9a55,
+  0x5a595969,
+  0x96969a59,
+  0x6a66a699,
+  0xa969969a,
+  0xaa9aa9a6,
+  0xaaaaaaa6,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0xaa555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95aa5a69,
+  0x6a5696a9,
+  0x5a66999a,
+  0x995aa99a,
+  0x6a999559,
+  0xaa5965a5,
+  0x5a5aa96a,
+  0x69a9a599,
+  0x65555a55,
+  0x5569a555,
+  0x65955955,
+  0xa9695a55,
+  0xaaaaafb9,
+  0xbafaeeaa,
+  0xbab9aaee,
+  0xaeaaabae,
+  0xaaa966a5,
+  0xa596a59a,
+  0x9a9a9aaa,
+  0xa5aa9a99,
+  0x55965555,
+  0x95555555,
+  0x55556955,
+  0x55555555,
+  0x56556555,
+  0x55555956,
+  0xa9565955,
+  0x55555559,
+  0x5a6aaaa9,
+  0xaaaaa5aa,
+  0x5aa56696,
+  0xa6aaa956,
+  0x6ae65aa9,
+  0xaaa6aa7a,
+  0xaa6a9aae,
+  0xaaaaabaa,
+  0x59555555,
+  0x55555555,
+  0x555a5995,
+  0x55555966,
+  0x6aa65659,
+  0x995aa69a,
+  0x5a65a696,
+  0xa95999a5,
+  0xa655a955,
+  0xa556aaa9,
+  0x6a6a59a6,
+  0x9aaa965a,
+  0x5a959665,
+  0x65a99555,
+  0x6555566a,
+  0x55555696,
+  0xaaa6aa69,
+  0x6aaa5a9a,
+  0x99aa9aaa,
+  0x5aa69aaa,
+  0x5a99aa95,
+  0xa69aaa6a,
+  0x99a6a965,
+  0x66a95566,
+  0x56559595,
+  0xaa655699,
+  0x59a96555,
+  0xa696a665,
+  0x9a59a6a5,
+  0xa59aa9aa,
+  0x66a66aa5,
+  0x5aa9a6aa,
+  0x596aa6a9,
+  0x99a96a96,
+  0xa6aa66aa,
+  0xa6599aaa,
+  0x59559699,
+  0x6aaa5955,
+  0x69a65696,
+  0x99a65a99,
+  0x565a56a5,
+  0xa559a996,
+  0x66595955,
+  0x55569555,
+  0x6969a655,
+  0x5955565a,
+  0x9aa9aaa6,
+  0x965aa99a,
+  0xbbaeaaf9,
+  0xaaaa9e7e,
+  0xbaabaabe,
+  0xaebaaa9a,
+  0xa5656a69,
+  0x6aaa96a6,
+  0x555955aa,
+  0xa6aaa569,
+  0x79aaaa79,
+  0xbaaaeaaa,
+  0x9aa5abaa,
+  0xaaaaeaea,
+  0x695969a5,
+  0x996656a6,
+  0x9965555a,
+  0x6aa66a69,
+  0xaaa9a6a9,
+  0xaaa5aaae,
+  0xaaaaa65a,
+  0xaaa9aaab,
+  0x55655555,
+  0x55555555,
+  0x59555555,
+  0x55555555,
+  0x9aaaaa99,
+  0x69956695,
+  0x55565559,
+  0x559556aa,
+  0x59555595,
+  0x55555555,
+  0x55565559,
+  0x55555655,
+  0x6a555555,
+  0x5595a555,
+  0x55555565,
+  0x55595995,
+  0xaab9aaa9,
+  0xae69eaaa,
+  0xaeaaa9aa,
+  0xaaaa6aab,
+  0x6a595a55,
+  0xa5969556,
+  0x99a699a5,
+  0x96555a99,
+  0xaa65a6a5,
+  0x5a69a9aa,
+  0xa66aa666,
+  0x5aa56a9a,
+  0xaaa6afa9,
+  0xbaaaeaaa,
+  0xaabafbae,
+  0xafaaaaaa,
+  0x56966969,
+  0x955aa595,
+  0x65596955,
+  0x69a55665,
+  0xaa6aa7a9,
+  0x9aaaa6aa,
+  0xae6a6aa6,
+  0xaaaeaaea,
+  0x969a5a69,
+  0xaaa69565,
+  0x66aaa56a,
+  0x6956655a,
+  0x9aaaaa65,
+  0x6aa9aaa9,
+  0x656aaa99,
+  0xaa56a969,
+  0xaaabaa69,
+  0xaae5aaaa,
+  0x9aa9aaaa,
+  0xeaaaaaaa,
+  0xa6666599,
+  0x6a6a6656,
+  0x6a59956a,
+  0x69a65aaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555595,
+  0xeaaaaaa5,
+  0x7aabaeaa,
+  0x6eabaaaa,
+  0xaaaaabaa,
+  0x966a5569,
+  0x9555a695,
+  0x5566a669,
+  0x55569965,
+  0x69a565a5,
+  0x6669a6aa,
+  0x59696a6a,
+  0x65a9a656,
+  0x55555995,
+  0x55556555,
+  0x65655565,
+  0x95a55595,
+  0xaaa5a6a9,
+  0x9a6a66a9,
+  0x6a9a659a,
+  0x6a995aaa,
+  0x96556955,
+  0x55565595,
+  0x55955655,
+  0x55555595,
+  0xaaaa9a55,
+  0xaa959aaa,
+  0xaa9aa9a6,
+  0x69aaa5aa,
+  0x66956569,
+  0x665959a6,
+  0x56999569,
+  0x66555556,
+  0xa59a5695,
+  0x6aa966a5,
+  0x55666659,
+  0xa9a6596a,
+  0xa6a6aa95,
+  0x9a66a6a6,
+  0xa6a56aa6,
+  0xaaaaa9a6,
+  0xfafbeeb9,
+  0xaaeaeeba,
+  0xbafeeaaa,
+  0xaeaaebee,
+  0x56559555,
+  0x55a65595,
+  0x5555555a,
+  0x55555656,
+  0x55a69a65,
+  0x9a555559,
+  0x69aaa599,
+  0x999a5565,
+  0x96aaa695,
+  0xa6955965,
+  0xa9a65695,
+  0x69aa6a66,
+  0xaaaaaba9,
+  0x6aa9eaa6,
+  0xaaaaaaaa,
+  0xaaaabaaa,
+  0x55a65559,
+  0x59556955,
+  0x59555555,
+  0xaa95a555,
+  0x5aa5a6a5,
+  0xa659a9a9,
+  0x6559aa55,
+  0x59a65a65,
+  0xaaaaae99,
+  0xaaaaaaaa,
+  0xae6eaaaa,
+  0xaa9e6a96,
+  0x969aaa59,
+  0x66966965,
+  0x6965aaa9,
+  0xaaaaaaaa,
+  0x5a69aa99,
+  0xaaaaeaaa,
+  0xa65a66ea,
+  0xaa9aaaa6,
+  0xaa955995,
+  0x5aa9a565,
+  0x6555a6a9,
+  0x95555a65,
+  0x6a6569a9,
+  0xaa6996a6,
+  0xa6aaa9a5,
+  0xaa5aa9aa,
+  0x66556965,
+  0x6a9a9aa5,
+  0x655aa656,
+  0x9956a9a9,
+  0xa66aaaa9,
+  0xaa9aa9aa,
+  0x65a6a99a,
+  0x65a6aaaa,
+  0xaaaaaaa9,
+  0x6aa6a5aa,
+  0xa9aa6996,
+  0xaaa96a69,
+  0x66aaa969,
+  0xaaab9aaa,
+  0x6aa996aa,
+  0x9aaa9a99,
+  0x59955555,
+  0x55555565,
+  0x65956955,
+  0x566a5555,
+  0x69aaaa95,
+  0x6aa6aa9a,
+  0xaaaaaa96,
+  0x96aaa9e6,
+  0x95665965,
+  0x55555555,
+  0x55695555,
+  0x65555555,
+  0x5555a555,
+  0x55655555,
+  0x65655596,
+  0x95566555,
+  0x59a69aa5,
+  0x6a9aaa6a,
+  0xaa695aaa,
+  0xaa59565a,
+  0x65555559,
+  0x66565556,
+  0x65555a59,
+  0x65a55565,
+  0x696a6955,
+  0x596999aa,
+  0x9669a55a,
+  0xaa966565,
+  0xa66a6aa9,
+  0xa9a6aaaa,
+  0x66aaaa7a,
+  0x69699699,
+  0x66599a99,
+  0xaa69a956,
+  0xaa996a6a,
+  0x9aa996aa,
+  0x6aaaaa79,
+  0xbaabaaaa,
+  0xaaaaaaaa,
+  0xae6aa7ae,
+  0x55555559,
+  0x56555559,
+  0x69955555,
+  0x65555955,
+  0x55a556a5,
+  0x99695556,
+  0x596aa995,
+  0x55556655,
+  0xaa5aaaa9,
+  0x65aa5a9a,
+  0x69a9a5aa,
+  0xaa65999a,
+  0xaaaaa6a9,
+  0xaa9a6aa6,
+  0x9a5aaaaa,
+  0xaaaaaaaa,
+  0x65565a95,
+  0x556a6956,
+  0x5aa99a55,
+  0x99aa9a95,
+  0xa6aaa9a5,
+  0xaaa9aa9a,
+  0xa9aa6aa5,
+  0x66a65aaa,
+  0xa5969555,
+  0x55565655,
+  0x5a959569,
+  0x565996a5,
+  0x9a99a999,
+  0x6656aa66,
+  0x65a5aa66,
+  0x6a6a5669,
+  0x5969aaa9,
+  0xaa9969a6,
+  0xaa6e7aea,
+  0xebaaaa6a,
+  0x66555569,
+  0x6656559a,
+  0x95959a99,
+  0x99695559,
+  0x66955555,
+  0x9a5a5595,
+  0x55655555,
+  0x55965955,
+  0xba6aeaa9,
+  0x9aaaeaaa,
+  0xaaaeb9ab,
+  0x9baaa9ea,
+  0x55565555,
+  0x65555555,
+  0x55965955,
+  0x55555555,
+  0x9a69a655,
+  0x99656995,
+  0xaa5965aa,
+  0x96a69655,
+  0x55555555,
+  0x55555555,
+  0x59555555,
+  0x55555555,
+  0x5669a6a5,
+  0x96565999,
+  0x9a96a9a9,
+  0x696a956a,
+  0xa6669a65,
+  0xa96aa999,
+  0x5aa65555,
+  0x999aa996,
+  0x5a5555a5,
+  0x55955555,
+  0x95959a55,
+  0x55555659,
+  0x595596a5,
+  0x95a966a9,
+  0xaa956596,
+  0x965965aa,
+  0xaaaaaa65,
+  0xa9a9aaaa,
+  0xaa69aaae,
+  0xaabaaaa6,
+  0x995aaa99,
+  0xa6966aa6,
+  0x9a955a95,
+  0x59a59695,
+  0x55655655,
+  0x9a5595a6,
+  0x59a95556,
+  0x595595a6,
+  0x9a6a9aa9,
+  0xaa96aa6a,
+  0x6aabaaaa,
+  0xaaaaaaa9,
+  0x596aaaa9,
+  0xaa6a6596,
+  0x9a9a65aa,
+  0xaa9a9a6a,
+  0x55955555,
+  0x55565555,
+  0x55555555,
+  0x55555555,
+  0x99596a99,
+  0x5a9a69a6,
+  0x55aaa655,
+  0xaa6aa9a6,
+  0x96a9a669,
+  0x9a695696,
+  0x59a956a6,
+  0xaa6996a6,
+  0x65a65a55,
+  0x69aaa666,
+  0x5aa65669,
+  0x69a99a99,
+  0x6a66a699,
+  0xa999695a,
+  0x665669a9,
+  0x55a966a5,
+  0x6aaa6965,
+  0xa5a9a6a5,
+  0xa9955a99,
+  0x6aa9969a,
+  0x5a95a995,
+  0xaa6956a9,
+  0x55a556a9,
+  0x96aa965a,
+  0x6a6555a5,
+  0x59966696,
+  0x5aa65a99,
+  0xa65aaa96,
+  0x56595655,
+  0x56569569,
+  0x55599695,
+  0x555565a5,
+  0x65655595,
+  0x56555596,
+  0x55555556,
+  0x95566555,
+  0x55a5a555,
+  0x5569a655,
+  0x56595555,
+  0x99669569,
+  0x95659555,
+  0x9556965a,
+  0x66955559,
+  0xa9569995,
+  0x55555555,
+  0x65655555,
+  0x55555559,
+  0x55555555,
+  0x66956555,
+  0x66aaa6a5,
+  0x6aaa5a55,
+  0x6a65a59a,
+  0x9965aa95,
+  0x96599a96,
+  0x9aaa6956,
+  0x56a669a5,
+  0xa9aa6aa9,
+  0x95656aa6,
+  0xa96a6665,
+  0x5969aa96,
+  0x56556555,
+  0x55566555,
+  0x55555555,
+  0x66555555,
+  0x55595555,
+  0x95556955,
+  0x65555665,
+  0x59a55995,
+  0xaae6aa79,
+  0x6aaaaaba,
+  0xbaaaa69a,
+  0xaeb9aaaf,
+  0x55556555,
+  0x99955955,
+  0x555656aa,
+  0x95555665,
+  0xa5555a55,
+  0x65556655,
+  0x56559a55,
+  0x55555956,
+  0x55555555,
+  0x55565555,
+  0x95555559,
+  0x55555555,
+  0x59659695,
+  0xa5555569,
+  0x655aaa96,
+  0x96a6aa95,
+  0x95555555,
+  0x55599655,
+  0x55956555,
+  0x65555565,
+  0x96a55699,
+  0xa65aa9aa,
+  0x66aaaa6a,
+  0xa9a55aa9,
+  0x6a66a695,
+  0x5565596a,
+  0xaa65a595,
+  0xa6a6a95a,
+  0x565a9555,
+  0xa6a99569,
+  0x69555a95,
+  0xa6996a56,
+  0x95599aa9,
+  0x5a569996,
+  0x6a96a565,
+  0x55555595,
+  0xa9a6aea9,
+  0xaaaaaaba,
+  0x9aa99669,
+  0xaa6aa6aa,
+  0x59955565,
+  0x56596956,
+  0x5a966a99,
+  0x59a69a65,
+  0x55695555,
+  0x5555a955,
+  0x65655655,
+  0x555595a6,
+  0x55595959,
+  0x5695a5a9,
+  0x65965a55,
+  0x5965aaa9,
+  0xaa6aaaa9,
+  0x9aaaaaaa,
+  0xeaaaaaea,
+  0xaaaaba69,
+  0x69aa5a65,
+  0x55965a65,
+  0x9a99a556,
+  0x69aaa696,
+  0x5955a555,
+  0x55956595,
+  0x95965555,
+  0x55556655,
+  0xa995a969,
+  0x5a5a9559,
+  0x9aaa96a5,
+  0x599665a6,
+  0x55556555,
+  0x59655665,
+  0x55595555,
+  0x55555569,
+  0xaa66a569,
+  0xaaaa65a6,
+  0xaaaaaaaa,
+  0xaaaaaa55,
+  0x66aa96a5,
+  0x65656696,
+  0x5695569a,
+  0x966aaa55,
+  0xaa9aa9a5,
+  0x966aa6aa,
+  0xa9a9aaa9,
+  0x95a669aa,
+  0x55656555,
+  0x95555555,
+  0x55555969,
+  0x55555556,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x6955a659,
+  0x55556565,
+  0x599a6565,
+  0x95655656,
+  0x66aaa6a9,
+  0x95669a66,
+  0x665aa69a,
+  0x995aaa65,
+  0x55555555,
+  0x56595655,
+  0x95569565,
+  0x59555555,
+  0x99a6a665,
+  0x5a65aaa5,
+  0x9aa999a6,
+  0xa95a6996,
+  0x5659a665,
+  0x9a555996,
+  0x599a969a,
+  0x5aa5695a,
+  0xaaa6a6a9,
+  0xaa5aaaaa,
+  0xaa9aaaab,
+  0xaaa6aaaa,
+  0xa9a69a65,
+  0xa9a9a656,
+  0xaa6a6a59,
+  0xaaa9a56a,
+  0xaaaaaa95,
+  0xaaaaa5aa,
+  0x6aaaa9aa,
+  0x6696a9aa,
+  0x55555695,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xabafeaa9,
+  0xbabaafaa,
+  0xaaebefae,
+  0xaaaafbab,
+  0x6a995955,
+  0x59559a56,
+  0x5565a955,
+  0xa5955669,
+  0x6996a995,
+  0xa5a56a5a,
+  0xaa6aaa99,
+  0x99a6aa5a,
+  0x95556995,
+  0x569aa555,
+  0x5a5a5556,
+  0x59a69a99,
+  0x66956569,
+  0x5559559a,
+  0x9a996aa5,
+  0x569a6556,
+  0x55995995,
+  0x69569a6a,
+  0xa6566656,
+  0x555aaa56,
+  0x9965a5a5,
+  0x9a5a6696,
+  0xa59969a5,
+  0xa695aaa6,
+  0xa9699a55,
+  0x6aa96aa5,
+  0x65656659,
+  0x69669a56,
+  0xa55a69a5,
+  0xa9aa6aa6,
+  0x6995aaaa,
+  0x6a5aa96a,
+  0x9a666695,
+  0x5a95a65a,
+  0x665a699a,
+  0xa6a96a5a,
+  0x59565555,
+  0x69555555,
+  0x65665555,
+  0x55555559,
+  0x6a66a9a5,
+  0x96696aaa,
+  0xaaaaaaa5,
+  0xaa9a5aa9,
+  0xaa5aaa65,
+  0x9a6aa695,
+  0xaa6a9a9a,
+  0x9a6a669a,
+  0x95556555,
+  0x95555555,
+  0x55555695,
+  0x559599a5,
+  0x6e65aaa9,
+  0x9a6aabaa,
+  0xabaaaaea,
+  0xaaae6aaa,
+  0xa6556655,
+  0xa9556569,
+  0xa595a559,
+  0x55a55555,
+  0x9aaaa959,
+  0xa65a69a6,
+  0xaaa6696a,
+  0x6aaa9a9a,
+  0x6a9b99a9,
+  0xaa6aaaaa,
+  0x5969aaaa,
+  0x9eaaa99a,
+  0x95555555,
+  0x65555556,
+  0x55aa5555,
+  0x56955559,
+  0x9aaa6665,
+  0xaa6996a5,
+  0x66556a6a,
+  0x9aa96a6a,
+  0xa9569565,
+  0x69659aaa,
+  0x9995a965,
+  0x5aa95666,
+  0x55955555,
+  0xa55a5955,
+  0x55995956,
+  0x55965996,
+  0xba9aaea9,
+  0xaa6a9a9a,
+  0xaa69aaaa,
+  0xaa6a69aa,
+  0xa69aaa99,
+  0xa6966a9a,
+  0xa6966a65,
+  0xa9aaaa66,
+  0x9969a555,
+  0x55555565,
+  0x55955556,
+  0x59696555,
+  0xaa996a55,
+  0x66a696a9,
+  0xa9a6966a,
+  0x656aa69a,
+  0x595595a5,
+  0x95555655,
+  0xa9a5a565,
+  0x59555955,
+  0xaaaaae59,
+  0xaabaabaa,
+  0xaa6aa6aa,
+  0xaaaa6aaa,
+  0xa5556a95,
+  0xa5656969,
+  0xa69a5669,
+  0x65699a59,
+  0x9aa9aa99,
+  0x6abaa59a,
+  0x9a9aa6aa,
+  0xaaa9a6a5,
+  0xaaaaaaa9,
+  0xbaebaeae,
+  0xbabaaaaa,
+  0xaabeebee,
+  0x55955555,
+  0x55699556,
+  0x55655565,
+  0x55555695,
+  0x95559565,
+  0x95596596,
+  0xa5559655,
+  0x95695695,
+  0x55555555,
+  0x55555555,
+  0x55695565,
+  0x55565555,
+  0x999999a5,
+  0x96955956,
+  0x66595695,
+  0x9a9a5a6a,
+  0xb99aaa69,
+  0x6aeaaaa9,
+  0x6a79aaaa,
+  0xaeaaabaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xbefbaa99,
+  0xaebaebae,
+  0xaeaaeaaa,
+  0xa6aaaabb,
+  0xaaafaae9,
+  0xeaabaeba,
+  0xbabbabba,
+  0xbab9a6ae,
+  0xaaaaaaa9,
+  0x9a7aa5ab,
+  0x9ba9aaaa,
+  0xaaaa6a6a,
+  0xa6a69999,
+  0xa5aa9a59,
+  0x9a959a9a,
+  0x65a6599a,
+  0x55596555,
+  0x55595559,
+  0x55555955,
+  0x59555565,
+  0x69a6a669,
+  0x5aa966aa,
+  0xa96a99aa,
+  0x955a66a6,
+  0xaaaaaaa5,
+  0xaaa69ab9,
+  0xb9ab9eba,
+  0x69aaaaaa,
+  0x55956a65,
+  0x65556565,
+  0x55555655,
+  0x95595555,
+  0x55555555,
+  0x55555595,
+  0x55555555,
+  0x55559555,
+  0xaaaa9599,
+  0xaa9aaaaa,
+  0xa59a5a99,
+  0xa6a69565,
+  0x95559555,
+  0x995955a9,
+  0x55565595,
+  0x66555565,
+  0xa5965555,
+  0x55a99595,
+  0x65695955,
+  0xa5599555,
+  0x9aa9a6a9,
+  0x6a5a6599,
+  0x5a59aaaa,
+  0xaaa9aa55,
+  0x99569a55,
+  0xaa969665,
+  0x9aa5a596,
+  0x655aa696,
+  0x65555555,
+  0x55555555,
+  0x55555955,
+  0x55555555,
+  0xbae6a7a9,
+  0xaabaaa9a,
+  0xaaaaaaaa,
+  0xaaaaaaea,
+  0x55555555,
+  0x55555555,
+  0x55556555,
+  0x55555555,
+  0x996596a5,
+  0x9a656a95,
+  0x6555669a,
+  0x95555565,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa56a955,
+  0x95696aa9,
+  0x69aa6566,
+  0x565a9a55,
+  0x55555595,
+  0x55555556,
+  0x65555595,
+  0x59655556,
+  0xaaaea5a5,
+  0xa9a69a6a,
+  0x6596aaa9,
+  0xaaaaa6aa,
+  0x59556659,
+  0x969aa595,
+  0x56655a56,
+  0xa595569a,
+  0xa69aaaa9,
+  0xa9a99aaa,
+  0xaaa6a55a,
+  0x696aa5a6,
+  0x55555555,
+  0x55555a95,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55559555,
+  0x55555555,
+  0x5a995555,
+  0x9a555555,
+  0x55569695,
+  0x59659555,
+  0xa9569a95,
+  0x65556696,
+  0xa5595596,
+  0x55955569,
+  0xaaeaaeb9,
+  0xbabaea9e,
+  0xae6aaaae,
+  0xeebaaaaa,
+  0x5aaa6a59,
+  0x965a5a66,
+  0xa9559a66,
+  0x6a6a5599,
+  0xaa6aa5a9,
+  0x9569a96a,
+  0x9a6669aa,
+  0x9aa9a9aa,
+  0xaa565aa5,
+  0xa9a9a9a9,
+  0xa69a996a,
+  0x6969a65a,
+  0x9aaaaa99,
+  0x966aaaaa,
+  0xa69aaaa6,
+  0xa9a55aaa,
+  0xaae6aab9,
+  0xa9aaab9a,
+  0x6aa9ab9a,
+  0xaaaabaea,
+  0xa5a99669,
+  0x69999556,
+  0x6a56556a,
+  0x5aaaaa56,
+  0x55565555,
+  0x55555555,
+  0x55555555,
+  0x55555955,
+  0xbbabaab9,
+  0xaaaaaeba,
+  0x7aaae6aa,
+  0xaebaebee,
+  0x599a9a95,
+  0x6a9a6696,
+  0x65555565,
+  0xaa56a959,
+  0x6aaaaaa9,
+  0xaaaaaa5a,
+  0xaaaaaa9a,
+  0xaaaaaaa6,
+  0x695a66a9,
+  0xa6969969,
+  0x99569996,
+  0x69a6a95a,
+  0x6ea9aaa9,
+  0x5ab9abaa,
+  0xaaaaaaaa,
+  0xaaaabaab,
+  0xaa699555,
+  0x95a69559,
+  0x56a55955,
+  0x65655595,
+  0xaa556a65,
+  0x96699aa9,
+  0x9aa6a566,
+  0xa6556a66,
+  0x6aaa9eb9,
+  0xaaaaabaa,
+  0xaebaa6aa,
+  0xaaaaaaa6,
+  0xa6aa6aa9,
+  0xa656aa65,
+  0x69a9aaa6,
+  0xaaaa9599,
+  0x9a655559,
+  0x59555596,
+  0xa5966659,
+  0x55555555,
+  0xb9aa9aa9,
+  0xbaa6aabe,
+  0xaaaaaa9b,
+  0xaeaaaaaf,
+  0xa97aa595,
+  0xa699a9aa,
+  0xaaaaaa6a,
+  0xaa5a9aa6,
+  0x65699965,
+  0x96655969,
+  0x656a95aa,
+  0xa55a9556,
+  0x55556555,
+  0x59555559,
+  0x555955a5,
+  0x55555555,
+  0x9aaaaaa9,
+  0xaaaaaaa6,
+  0xab9aa9aa,
+  0xaaaa6ea9,
+  0x55955559,
+  0x5a555aa5,
+  0x95559595,
+  0x5a595555,
+  0x9569a959,
+  0xa6996559,
+  0x5a65595a,
+  0x959669a9,
+  0x6996aaa5,
+  0x9aa5aa59,
+  0x55a9a6aa,
+  0xaaa9959a,
+  0x99556655,
+  0xa9a5595a,
+  0x55659aa9,
+  0x69556599,
+  0x66a69a95,
+  0x66aaa599,
+  0x5a9a59aa,
+  0x6669a955,
+  0x6aaaaeb9,
+  0xaeeaaeaa,
+  0xaeaaebab,
+  0xeaaaaaee,
+  0x59555559,
+  0x65665555,
+  0x65596955,
+  0x6556595a,
+  0x69995655,
+  0x55559655,
+  0x555aa559,
+  0x55955656,
+  0x55955655,
+  0x55955555,
+  0x55555565,
+  0x55555a95,
+  0xaa559a95,
+  0x5aaa6996,
+  0xa56aa696,
+  0x965a6995,
+  0xa9a66a69,
+  0xa9a6aeaa,
+  0x66aaa69a,
+  0x9aa9abaa,
+  0x65555565,
+  0x69599555,
+  0x969a5559,
+  0x55965655,
+  0xa9aaaaa9,
+  0xaaaa96a9,
+  0xaa69a9a6,
+  0xa95aa9aa,
+  0xebefaae9,
+  0xbaabaebf,
+  0xaaeaaffe,
+  0xbebeabaa,
+  0x55655995,
+  0xa9a55965,
+  0x55655559,
+  0x59a555a5,
+  0x65aaaaa9,
+  0xa6aa9aa9,
+  0xaa995a6a,
+  0x5a6aaaa6,
+  0x65956555,
+  0x56966556,
+  0x555555a5,
+  0x55695559,
+  0xaa659655,
+  0x5959995a,
+  0x5669a6aa,
+  0xaa965656,
+  0x96996a65,
+  0x5699a6aa,
+  0x9a9a5665,
+  0x55a6555a,
+  0x99a55555,
+  0x55555655,
+  0x9555959a,
+  0x9aa55555,
+  0xaaaa9e69,
+  0xaaabab9a,
+  0xaaaaebee,
+  0xeabfebe6,
+  0xaa9a6aa9,
+  0xa6aaa9a9,
+  0x95aa9aa5,
+  0x6aa69eaa,
+  0x9995a6a5,
+  0x5aa6596a,
+  0xa9a6955a,
+  0x565a6656,
+  0xabaabab9,
+  0xaaabaab9,
+  0xbaeaea6a,
+  0x9aaaabaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaaaaa69,
+  0xaaa6a699,
+  0x5569aa9a,
+  0x9a5a95a9,
+  0x55a96aa5,
+  0xa5aa6aa6,
+  0xa9aa99a9,
+  0xa9a699aa,
+  0xaa65a699,
+  0xaa699aa9,
+  0xaaaa69a6,
+  0xaaa9a9aa,
+  0xaaae59a5,
+  0x6a96aa6a,
+  0x6aaaaaae,
+  0x99a9aaaa,
+  0x5a559555,
+  0x55555555,
+  0x65555555,
+  0x56565555,
+  0xa9969aa9,
+  0xa9a59aaa,
+  0x9666a6aa,
+  0xaaa9aaaa,
+  0xa99a6699,
+  0xaa59aaaa,
+  0x99a6aaaa,
+  0x69aa9969,
+  0xa9596655,
+  0xaa5aa69a,
+  0xa999a5aa,
+  0x65996a9a,
+  0x9a6999a9,
+  0xaaa59a6a,
+  0xa6a69aa9,
+  0x5a66a95a,
+  0x55565555,
+  0x55595555,
+  0x55559555,
+  0x55555555,
+  0x55555555,
+  0x55555595,
+  0x55555559,
+  0x59655595,
+  0xa99a6655,
+  0xa9aa6559,
+  0x6aa659aa,
+  0xa96a6a6a,
+  0xaaaaaaa9,
+  0xaa6aaaa9,
+  0xaa5aa5aa,
+  0x9a5aa99a,
+  0x56665555,
+  0x56555559,
+  0x95955569,
+  0x65555655,
+  0x56555555,
+  0x65559555,
+  0x55555555,
+  0x55555555,
+  0x69a66aa9,
+  0xaa596696,
+  0xaaaa9a9a,
+  0x6a6a6a96,
+  0x65995aa9,
+  0x9aa66956,
+  0x5a965655,
+  0x6a966aaa,
+  0x996a5959,
+  0xa656aa9a,
+  0xa969995a,
+  0x996669aa,
+  0x99966955,
+  0x666a556a,
+  0x959aaa66,
+  0x55a9a665,
+  0x666a9995,
+  0x559a66aa,
+  0x5aa5aa66,
+  0x9559a959,
+  0xa9a6aaa9,
+  0x6a65abaa,
+  0xaaaaa6aa,
+  0xaaaaaa9a,
+  0x965a6559,
+  0xaa555a9a,
+  0x699669a6,
+  0x596a9565,
+  0xaaaaa699,
+  0x9a6ae6a6,
+  0xa69a6a9a,
+  0xaaaeaaab,
+  0xeaaaaaa9,
+  0xb9e7aeaa,
+  0xbaaae6aa,
+  0xaab9eaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x559656a9,
+  0x559565a5,
+  0x595555a9,
+  0x59995595,
+  0xaa595969,
+  0x5a995569,
+  0x6a9699a9,
+  0xa5665a95,
+  0x9a59a699,
+  0x9a56a6a6,
+  0x66695559,
+  0xaa59955a,
+  0xaaa69655,
+  0x6a9aa955,
+  0x9655a6a9,
+  0x6a96a6a6,
+  0x5a6995a9,
+  0x566a96a6,
+  0xa559995a,
+  0x655666a9,
+  0x99559955,
+  0x55595569,
+  0x95656655,
+  0xa595555a,
+  0x96996999,
+  0xa5a56a9a,
+  0x659a556a,
+  0x66a69659,
+  0x9aa69a69,
+  0x5aa9aaaa,
+  0xaa5aaaaa,
+  0x9aaaa9e5,
+  0x69eaaab9,
+  0x7aabafba,
+  0xba6aaaaa,
+  0xaabaebae,
+  0xa5565555,
+  0x655a6595,
+  0xaa556565,
+  0x55966666,
+  0x6aebaea9,
+  0x9a6aeaaa,
+  0x9ea9aaaa,
+  0xa69a7aab,
+  0x955555a9,
+  0xa556555a,
+  0x595559a5,
+  0x6a669655,
+  0x56a55555,
+  0x55555556,
+  0x55596555,
+  0x55a55565,
+  0x55595565,
+  0x65555555,
+  0x95555599,
+  0x56555559,
+  0x9a9aa955,
+  0x969a669a,
+  0xa69a59a5,
+  0x696a6969,
+  0xa9aa9aa9,
+  0xaaaaabaa,
+  0xaaa9aaaa,
+  0xa6aab9ea,
+  0x55559555,
+  0x55655555,
+  0x55555555,
+  0x55555555,
+  0x55959655,
+  0x56595555,
+  0x65566696,
+  0x66595a59,
+  0x65555555,
+  0x55555555,
+  0x59555556,
+  0x55559555,
+  0x9aa6a999,
+  0xa599699a,
+  0x95955666,
+  0x55a6a9a6,
+  0x55555555,
+  0x55655555,
+  0x55556955,
+  0x59555555,
+  0xaaa595a5,
+  0x56656599,
+  0xa69a9a55,
+  0x6a699a6a,
+  0x565556a5,
+  0x95955566,
+  0x66966599,
+  0x96595955,
+  0x6a96aa65,
+  0x6aaaaa9a,
+  0x66aaaa99,
+  0x5aaaaa9a,
+  0x66995565,
+  0x9599a99a,
+  0x5aa5959a,
+  0x95a56659,
+  0xa9a96555,
+  0x55656559,
+  0x55659966,
+  0x55565556,
+  0xaa9aaa65,
+  0xaaaaaa6a,
+  0x6aa65ea9,
+  0xbaa6a6aa,
+  0x5a66a6a5,
+  0xa99aa66a,
+  0xa559a95a,
+  0x595a5a66,
+  0x55555555,
+  0x55556955,
+  0x55555595,
+  0x55555555,
+  0x55555655,
+  0x59669559,
+  0x65955565,
+  0x95555556,
+  0x56555555,
+  0x55655559,
+  0x55565596,
+  0x55595955,
+  0xaaaeaaa5,
+  0xaaa79e6a,
+  0x6aaa9aaa,
+  0x6a6aaa9a,
+  0x9a6aa6a9,
+  0xaaa9a6aa,
+  0xa6656966,
+  0xa66a6665,
+  0x65955569,
+  0x9a996555,
+  0x5a996596,
+  0xa56565a6,
+  0x59556555,
+  0x55566a55,
+  0x55655559,
+  0x65555555,
+  0xba6aa7a9,
+  0xaeb9aaaa,
+  0xaaaaa9aa,
+  0xaaae6aab,
+  0x55555555,
+  0x5595a555,
+  0x95555555,
+  0xa5555695,
+  0x996aaa99,
+  0x9a9a659a,
+  0xaa59969a,
+  0xa9aaa569,
+  0xaae699a5,
+  0xbaaaaa9a,
+  0xaa65aaa9,
+  0x9aa9aaaa,
+  0x99556655,
+  0x59596695,
+  0x56a6a5a5,
+  0xaa6a6a5a,
+  0x55555555,
+  0x55559556,
+  0x5555595a,
+  0x65665555,
+  0xaaa96a95,
+  0xaa9a9aaa,
+  0xa9aaaaa9,
+  0xaa69aaaa,
+  0x9aaaaaa9,
+  0x9a99a9a6,
+  0xaa9aa9aa,
+  0xe5aa696a,
+  0x69aaaaa9,
+  0x6aeaa55a,
+  0x99a9aa9a,
+  0xaabaa696,
+  0x55555555,
+  0x55655555,
+  0x55595555,
+  0x55555555,
+  0x9abaab99,
+  0xaaaaaaae,
+  0xaa9abaa6,
+  0xa69eaaa7,
+  0xaa9a5a69,
+  0xaaa6a9aa,
+  0xa5a69a99,
+  0xaa6a9aa9,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x56659995,
+  0x95559655,
+  0xa5569559,
+  0x95559a96,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0x55555655,
+  0x6aa6aa69,
+  0xaaa66aaa,
+  0x5a9965aa,
+  0x699a6596,
+  0x6a95a5a5,
+  0x56559965,
+  0x6a56aa59,
+  0x59665699,
+  0xa9a6aa99,
+  0x6559669a,
+  0x9a9565a5,
+  0x55a669a9,
+  0xaa555a95,
+  0x6565a655,
+  0x6aa66aaa,
+  0x59a59a55,
+  0x65556955,
+  0x96aa5a55,
+  0x59a56659,
+  0x65656965,
+  0x69a5a699,
+  0x5a66aaaa,
+  0x9aaa65a6,
+  0xaa9aa99b,
+  0xaaa66aa5,
+  0x5666aaaa,
+  0x6aa9a6a9,
+  0xaaa6959a,
+  0x6aa99595,
+  0x55556569,
+  0xa559595a,
+  0x95aa5959,
+  0xaaaaaea9,
+  0x9a6aaa9a,
+  0xaaa9eaab,
+  0x9a9abaab,
+  0x955555a5,
+  0x56559659,
+  0x55655565,
+  0x55555655,
+  0x59655555,
+  0x555a5555,
+  0x55555559,
+  0x55555995,
+  0xaaab9aa9,
+  0xbeebeaba,
+  0xbab9aaaa,
+  0xaa6aeaae,
+  0x55655559,
+  0x659a56a6,
+  0x555955a9,
+  0xaaa5955a,
+  0x95659665,
+  0x6a656699,
+  0xa9a5a6a9,
+  0xa5956666,
+  0x569a6665,
+  0x55559555,
+  0x566a5956,
+  0x695a5a55,
+  0x6aa6aaa9,
+  0xae69aaaa,
+  0x9aaaaaaa,
+  0xaaaa6aa5,
+  0xa6569569,
+  0xa69a6699,
+  0x66655699,
+  0x555a9696,
+  0xa5a55655,
+  0x5a9aa996,
+  0x5556a565,
+  0x9a56a555,
+  0x66a555a5,
+  0x9956a669,
+  0x666596a6,
+  0x6a95655a,
+  0x55555565,
+  0xa5555655,
+  0x55569965,
+  0x59666555,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95955565,
+  0x59596a96,
+  0x65595556,
+  0x55a96565,
+  0xa9aa69a5,
+  0xa69aaaaa,
+  0xaa59aaa5,
+  0xaa6a69aa,
+  0x6aaa9aa9,
+  0xaaaaa69a,
+  0xaeaaeaaa,
+  0x96aaaaaa,
+  0x95555a55,
+  0x59555655,
+  0x65956a55,
+  0x69655599,
+  0x6a569a55,
+  0x569a5695,
+  0x59565566,
+  0x95956a65,
+  0xaafaaaa9,
+  0xaabbeeee,
+  0xaeaeabaa,
+  0xabbabbee,
+  0x5959a595,
+  0x56a6596a,
+  0x5556a955,
+  0x555555aa,
+  0xaaa7a6a9,
+  0x9ab9aa9a,
+  0xaabaeaaa,
+  0xaaaaa9aa,
+  0xeeeebee9,
+  0xeabbaefa,
+  0xaeebeebf,
+  0xbabaeaea,
+  0xaa6aa669,
+  0x95a959a6,
+  0xa6a969a6,
+  0xaa5a6a9a,
+  0x55a66595,
+  0x5a5555a5,
+  0x5555a595,
+  0x55656655,
+  0xa66a5aa5,
+  0x9aaa65aa,
+  0xea966a66,
+  0xaaaa9a99,
+  0x9a99a559,
+  0xa96a5aaa,
+  0xa9a9a5a5,
+  0x9a599965,
+  0xa7ae7aa9,
+  0xa696aa6a,
+  0xaae6ae69,
+  0xbaaaa69a,
+  0x55555595,
+  0x56655555,
+  0x5565655a,
+  0x5565a555,
+  0x965a5959,
+  0x6555555a,
+  0x99699a55,
+  0x596699a9,
+  0x55596a69,
+  0x56996556,
+  0x56565a65,
+  0x6966966a,
+  0x96699999,
+  0x55669956,
+  0x59556995,
+  0xa5965995,
+  0x66aaa969,
+  0x6a96aa66,
+  0x66aaaa69,
+  0x56aa9aaa,
+  0x65555595,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0xa5a65665,
+  0x59565595,
+  0x6559a56a,
+  0x655569a5,
+  0x699a5565,
+  0x56a56995,
+  0xaa955566,
+  0xaaa55996,
+  0x69a65555,
+  0xaaaa6a5a,
+  0x9a6565a9,
+  0x995a6a96,
+  0x5aaa9969,
+  0xaa559a65,
+  0x56a96a6a,
+  0x95a9aaa9,
+  0x956a6555,
+  0x96555599,
+  0x6a555555,
+  0x55655969,
+  0x69aa9aa5,
+  0x6a96a6a5,
+  0xaa65a69a,
+  0x6a6aa9aa,
+  0x9aaaaaa9,
+  0xa6aaaaa9,
+  0x65969a6a,
+  0xa9a66a6a,
+  0x5a69a959,
+  0x55a5a656,
+  0x56956595,
+  0x9aa56955,
+  0x565a5555,
+  0xa5595555,
+  0x55955956,
+  0x55655655,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa9baaa9,
+  0xaaaa96aa,
+  0xaa6aeaae,
+  0xaaaae9a6,
+  0x969a9569,
+  0x56956596,
+  0xa5a69966,
+  0x695a5599,
+  0xaaa5a6a9,
+  0x9abaabae,
+  0xaaaaa6aa,
+  0xa6aaaaab,
+  0x55555655,
+  0x55555555,
+  0x55555655,
+  0x55555555,
+  0x56a65995,
+  0x95595599,
+  0xa565a596,
+  0x56659666,
+  0xaaaaaaa9,
+  0x6a5a96aa,
+  0x6aa99aa9,
+  0xaa69aa6a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69a5a655,
+  0x5a665996,
+  0x55596955,
+  0x5a66a596,
+  0xaa5a9a65,
+  0x59a6696a,
+  0xaa9aaa96,
+  0x9aaaa5aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaaaaaa5,
+  0xba66aaaa,
+  0xa96aaaaa,
+  0xaaa96596,
+  0xaaa95a55,
+  0x96995565,
+  0x66a59569,
+  0x5a699995,
+  0xa95a9995,
+  0x599959a9,
+  0x55699695,
+  0x5a99a99a,
+  0x95569595,
+  0xa9556559,
+  0x5595a59a,
+  0x59655699,
+  0x596a9565,
+  0x6659a9a5,
+  0xaa6555a6,
+  0x99566669,
+  0xa5a65a95,
+  0x69559655,
+  0x56956555,
+  0x5996a95a,
+  0xa6aa66a9,
+  0xa6a696a9,
+  0xa6a69966,
+  0x5a5596aa,
+  0xaaaaa7a9,
+  0xaea9aaaa,
+  0xaa6a6aab,
+  0xa6aa6aa9,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x56555555,
+  0x55556555,
+  0x955a5969,
+  0x5956a95a,
+  0x59a665aa,
+  0x99699a66,
+  0x96595555,
+  0x95a65656,
+  0x559a5996,
+  0x55965659,
+  0x9aa56569,
+  0xa9956956,
+  0xaa566559,
+  0xa55aa559,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5aaa5569,
+  0x69a969aa,
+  0x5a669655,
+  0x5a95a965,
+  0x7aeaaaa9,
+  0xaaaaaa9a,
+  0x9aaaeaae,
+  0xaaaaa9ab,
+  0x65a995a9,
+  0xaa5a5969,
+  0x95556955,
+  0x99599559,
+  0xaaa6aaa9,
+  0xaaaaa9a6,
+  0x96aaaaaa,
+  0xa66aaa69,
+  0x65655569,
+  0x65a95595,
+  0x65556a55,
+  0x5a955565,
+  0x55595955,
+  0x5a6a6965,
+  0x5556a995,
+  0x55599555,
+  0x9596a955,
+  0x56599996,
+  0x5a55aa96,
+  0x6656669a,
+  0x95a56565,
+  0x59659565,
+  0x69559655,
+  0x66556655,
+  0x665996a5,
+  0x96a696a6,
+  0x66956a6a,
+  0x96999a66,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0x55555555,
+  0x55555555,
+  0x65555965,
+  0x56a55655,
+  0x59555555,
+  0xbaa79a59,
+  0xa9b9aaaa,
+  0x9aaaa6aa,
+  0xea996aa6,
+  0xa69aaaa9,
+  0xa9aa6a69,
+  0x5aaaaaa5,
+  0xaaa995aa,
+  0x99656659,
+  0xaa6566a5,
+  0xaaa69656,
+  0x9669aa6a,
+  0x56955aa5,
+  0x99a69aaa,
+  0x65a59aa6,
+  0x96aaa65a,
+  0x9a9aa9a5,
+  0x9aaaaaaa,
+  0xa6a96aa9,
+  0xa9aa6aa9,
+  0xaae6aaa9,
+  0x9a69aa9a,
+  0xaaa9a59a,
+  0xa6aaaaaa,
+  0xfaaabaa9,
+  0xaafaeaaa,
+  0xbaabaebe,
+  0xeabaaaaa,
+  0x9a96a6a9,
+  0x9aa569aa,
+  0x6aaaa5aa,
+  0x566a6669,
+  0xa9e7aeb9,
+  0xbaabef9a,
+  0xaaaaa6ae,
+  0xaaa9a7ea,
+  0x555a6555,
+  0x56566a56,
+  0x55955969,
+  0x66556565,
+  0x65a56669,
+  0x666aa6aa,
+  0x996aa99a,
+  0x9a5569aa,
+  0xabaabea9,
+  0xaaaaaeba,
+  0xaefaeaae,
+  0xaabaaaee,
+  0x9a6aa659,
+  0x6a556aaa,
+  0x9aaaaaaa,
+  0xa69aaa66,
+  0x55555565,
+  0x55555555,
+  0x55556955,
+  0x55555555,
+  0x6696a555,
+  0x6696a5a6,
+  0x65996995,
+  0xa5669966,
+  0xa66aaaa9,
+  0x6aa5aaaa,
+  0xaaa9a9a6,
+  0xaaaaa5aa,
+  0xebefbe69,
+  0xaaabaeaa,
+  0xaaebaeaf,
+  0xaaaaaaaa,
+  0xaaa5a669,
+  0x5a99695a,
+  0x96aaaaaa,
+  0xa6aa5aa5,
+  0x55555555,
+  0xa5555556,
+  0x55555556,
+  0x69555556,
+  0xaa9595a9,
+  0x665565a5,
+  0x5aa99569,
+  0x65996995,
+  0xba6aeaa9,
+  0xaea9aaaa,
+  0xafaaaaaa,
+  0xaaaaaaaa,
+  0xab9aaaa9,
+  0xbaaa6a7a,
+  0xaaebaaaa,
+  0x9aa9a69a,
+  0x6a956695,
+  0x9a995965,
+  0x599965a5,
+  0x96565566,
+  0x59565569,
+  0xa5a69569,
+  0x95569566,
+  0x566a6a96,
+  0x56555659,
+  0x95655565,
+  0x59595559,
+  0x555a9999,
+  0x55695555,
+  0x55555565,
+  0x55a55565,
+  0x9555a555,
+  0xeaafaaa9,
+  0x6aaa9a7a,
+  0xaaeaa6aa,
+  0xaeaafbaa,
+  0xaa6aa995,
+  0x9696aa96,
+  0xa996969a,
+  0xa5a6aaa9,
+  0x55565565,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x5a59a699,
+  0xaaaa6569,
+  0xaa9a596a,
+  0xa6a65955,
+  0x59a9a6a9,
+  0xaebaeaaa,
+  0xaaa9aaaa,
+  0xabaaaaaa,
+  0xaaa99aa9,
+  0xaa9a99ba,
+  0xaaa6aa6a,
+  0xaaa5aa5a,
+  0x59555555,
+  0x55595569,
+  0x55555555,
+  0x55555555,
+  0x695aa969,
+  0xaa66aa6a,
+  0x6aaaa69a,
+  0x9aaaa9aa,
+  0x55956555,
+  0x56955655,
+  0x59965956,
+  0x955955a5,
+  0x9a969a59,
+  0x59a6a9a6,
+  0x96956556,
+  0x99a66a56,
+  0x95999559,
+  0x6656a655,
+  0x66559565,
+  0x5566a556,
+  0x95555555,
+  0x55555595,
+  0x55555559,
+  0x55555555,
+  0x6aaaaaa9,
+  0xaa69a6aa,
+  0x6aaaea9e,
+  0x9aaa6a96,
+  0x995a9555,
+  0x95559556,
+  0x95aa566a,
+  0x956a6965,
+  0x5669aa99,
+  0x6aaaa696,
+  0xaa696666,
+  0xa66a66a6,
+  0xeaebaa79,
+  0xaaabafae,
+  0xbebeeaae,
+  0xaeaefbae,
+  0x655995a5,
+  0x6595559a,
+  0x56966655,
+  0x65555595,
+  0x55595555,
+  0x5555a555,
+  0x55555a55,
+  0x59555595,
+  0x55555955,
+  0x65555556,
+  0x55555555,
+  0x56555555,
+  0xa65a9659,
+  0x99699955,
+  0x65569a69,
+  0x99a959a6,
+  0x99a5aa69,
+  0xaaa6aa65,
+  0x955699a6,
+  0x5aa95696,
+  0x5a69a999,
+  0x6955656a,
+  0x965aaa69,
+  0x55aa9aa5,
+  0x59596655,
+  0x65659655,
+  0x6556a5a6,
+  0x59555566,
+  0x55555655,
+  0x55955555,
+  0x65556559,
+  0x55969655,
+  0xa969a6a9,
+  0xaa6aaa96,
+  0xaa6aaaa6,
+  0xaaaabaa9,
+  0x55555655,
+  0x69a55595,
+  0x5a595555,
+  0x59a55555,
+  0xaa96aa99,
+  0xaa9aaa96,
+  0x9baaa969,
+  0x6aaa6a6a,
+  0x55559555,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0x96955959,
+  0x55565995,
+  0x66555959,
+  0x56955555,
+  0xaaa9a569,
+  0x9a6a6aaa,
+  0xa99666a6,
+  0x9a6aa9a9,
+  0xaaaa5a69,
+  0x6a9baaaa,
+  0x6aaaa7aa,
+  0x59a9aaaa,
+  0x55555555,
+  0x55655555,
+  0x995655a5,
+  0x95955555,
+  0xbaa7aa99,
+  0xaaa99aaa,
+  0x6aaaabaa,
+  0xaaaaaaaa,
+  0x9655aa55,
+  0xa5565655,
+  0x56a59965,
+  0x59565695,
+  0x9a69a655,
+  0x966a66a6,
+  0x95a5a6a6,
+  0xa65a5a5a,
+  0x59569955,
+  0xa9955555,
+  0x56695555,
+  0x5a659955,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaaba659,
+  0x5aa5a6aa,
+  0xaa6aaaa6,
+  0x6aa9aaaa,
+  0xaaaaaee9,
+  0xa9aaaeaa,
+  0xa9bbaebe,
+  0xaaa9ebae,
+  0xaa6a56a9,
+  0x966956a6,
+  0xaa9aa69a,
+  0xa6aa9996,
+  0xbaebaa69,
+  0xaaebaaae,
+  0x9ebaa7ae,
+  0xeebafaa7,
+  0x55555555,
+  0x55555555,
+  0x59955555,
+  0x55555559,
+  0x69959a99,
+  0x5599a659,
+  0x6aaaaa5a,
+  0xa655655a,
+  0xaaaeaaa5,
+  0xaaabaaba,
+  0xaaeaaeaa,
+  0x9aaaa6ae,
+  0x55559555,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0xaaa6aea9,
+  0xaaabaaae,
+  0xaaaaaaea,
+  0x9eaeaba6,
+  0xaa5a6aa9,
+  0x96aa9aaa,
+  0x99a99699,
+  0x6aaaa9a6,
+  0x99a5aa99,
+  0x55a5a96a,
+  0xaa966999,
+  0x6a9a559a,
+  0x9aaaa665,
+  0x99966a6a,
+  0x55a56999,
+  0x9a55a965,
+  0x55959aa5,
+  0xa5665996,
+  0xaa595596,
+  0x5a5599a5,
+  0x55565555,
+  0x95955555,
+  0x69955555,
+  0x59566556,
+  0x56555555,
+  0x55596656,
+  0x69695669,
+  0x695a6659,
+  0xa569a699,
+  0x6a6aaa6a,
+  0x9aa565aa,
+  0xaa9aaa96,
+  0x5955a555,
+  0x55555555,
+  0x55555555,
+  0x55555569,
+  0xa99aa665,
+  0x66a9a955,
+  0x9a5a69a5,
+  0x96969665,
+  0xa6aa9a69,
+  0xaaaa6a59,
+  0x6aaa9aaa,
+  0x6a6aaaa6,
+  0x55555555,
+  0x55555595,
+  0x55565555,
+  0x55555555,
+  0x56559555,
+  0x5555a559,
+  0x55695565,
+  0x6599a555,
+  0x65555669,
+  0x665565a5,
+  0xaa5a9965,
+  0x55555659,
+  0x5aaaaa99,
+  0xaa6a6aaa,
+  0xaa6aaaaa,
+  0xe69a9aaa,
+  0x55a659a5,
+  0x669556aa,
+  0x95655a95,
+  0x5a996595,
+  0x55955555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x696a9a59,
+  0xaaaaaa9a,
+  0x9aaa6aaa,
+  0xa69aa9aa,
+  0x95655569,
+  0x66a5a95a,
+  0x5556555a,
+  0x65555659,
+  0x69a65999,
+  0x5696a999,
+  0x5699aaa5,
+  0xaa665a55,
+  0xa69699a9,
+  0xa555aa59,
+  0x5a6956aa,
+  0xa9a56aaa,
+  0xa695a699,
+  0x9a6a66a6,
+  0x5569a5a9,
+  0x9aaa5959,
+  0x55556aa5,
+  0x96669666,
+  0x5a556596,
+  0x95a5966a,
+  0xaaeaae69,
+  0x6aa6ae6a,
+  0xbaaaa6aa,
+  0xaa69ab9a,
+  0x59555955,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0xa5966aa9,
+  0x5565a666,
+  0x956996a5,
+  0x56a56996,
+  0x55655559,
+  0x55569955,
+  0x59665965,
+  0xa5959556,
+  0x55555655,
+  0x555555a5,
+  0x55565555,
+  0x56555556,
+  0xa9a6a5a5,
+  0x555696aa,
+  0x959aa6a6,
+  0x6a69a69a,
+  0x99aa59a9,
+  0x5665a5aa,
+  0xa66a6aa9,
+  0x699a96a9,
+  0x65599555,
+  0x5665a666,
+  0x5665966a,
+  0x555956a9,
+  0x55555555,
+  0x59556955,
+  0x55569555,
+  0x55556555,
+  0x5595a555,
+  0x59555555,
+  0x555a5595,
+  0x55556555,
+  0x655655a9,
+  0x69a59966,
+  0x6959aa55,
+  0x5a955955,
+  0x596555a9,
+  0xa55a6a69,
+  0x9a6a6555,
+  0x559aaaa6,
+  0x56555555,
+  0x55559595,
+  0x96a95655,
+  0x665555a5,
+  0x55955a55,
+  0x55555555,
+  0x55555655,
+  0x55955595,
+  0x5a656655,
+  0x55555595,
+  0x95955559,
+  0x65655555,
+  0x55665669,
+  0x59995555,
+  0x56565565,
+  0x55659555,
+  0xaa966a65,
+  0x9a5aa5a6,
+  0xa65a6a56,
+  0x6956a969,
+  0xaafaaaa9,
+  0xaaaaeaaa,
+  0xaabaaaa6,
+  0xabaea9ea,
+  0x99695565,
+  0x56555955,
+  0x55969555,
+  0x55555555,
+  0x956aaa65,
+  0x9a6669aa,
+  0x569695aa,
+  0xaaaa9655,
+  0x69969955,
+  0x65555569,
+  0x59555659,
+  0x5a995995,
+  0x59555a55,
+  0x55955596,
+  0x56556565,
+  0x55595665,
+  0x69a95659,
+  0x566a9a5a,
+  0xa66956a6,
+  0x959aa596,
+  0xebafbae9,
+  0xeaaaeebe,
+  0xaaaaafba,
+  0xaaaaabea,
+  0x6aa6a659,
+  0xaaaa69aa,
+  0xaa5969aa,
+  0xa6ae6a69,
+  0x55a9a655,
+  0x55566556,
+  0x5a699555,
+  0xa5555656,
+  0xa96a6565,
+  0x5a9565aa,
+  0xaaa55556,
+  0x99a69666,
+  0x6a969a95,
+  0xa9aaaa6a,
+  0x6aa6aaaa,
+  0xaaaaaa99,
+  0xeaaeaaa9,
+  0xaaaaaaaa,
+  0xaaaaaaba,
+  0xaaaaa79a,
+  0x6a669699,
+  0x95a6aa65,
+  0xa66aa996,
+  0xa65a96a5,
+  0x55555555,
+  0x55665555,
+  0x55555556,
+  0x55555595,
+  0x55555965,
+  0x95596595,
+  0x56555565,
+  0x96955955,
+  0x65aaaaa9,
+  0x9966aa6a,
+  0xaa6a969a,
+  0xaa666aaa,
+  0x595a9555,
+  0x59a99565,
+  0x6a969695,
+  0x5a5aa555,
+  0x9a6a6aa9,
+  0xaa9665aa,
+  0x9569aaaa,
+  0x96996969,
+  0xaaaaaaa9,
+  0x6aabaa99,
+  0xaaa9abaa,
+  0xaeaaeaaa,
+  0xaa9aa699,
+  0xaa5aaaaa,
+  0xa9969aa6,
+  0xaaa99a55,
+  0x95aa96a9,
+  0xaa65aaa6,
+  0x666a6aa6,
+  0x6aa6aaa9,
+  0xa65aaa65,
+  0x565a5696,
+  0x99a6655a,
+  0x56a9a696,
+  0x55559555,
+  0x55555555,
+  0x555a5555,
+  0x56555555,
+  0x55955565,
+  0x65965565,
+  0x55559555,
+  0x99559555,
+  0x595a5995,
+  0xa5695965,
+  0x65555599,
+  0x6a559555,
+  0x55556555,
+  0x55a59665,
+  0x55599595,
+  0x95555559,
+  0xeaee9aa9,
+  0x7aaaaaae,
+  0xaaebaeaa,
+  0xaaaeeaaa,
+  0x559a9669,
+  0x9a6656a6,
+  0x96aa5665,
+  0x5556656a,
+  0x6a969aa9,
+  0xaaaa9aaa,
+  0x9979aaaa,
+  0x9ab9a996,
+  0x55555555,
+  0x56555555,
+  0x59559555,
+  0x55555555,
+  0xa56aa659,
+  0x9aa5a69a,
+  0x5a9aaa96,
+  0x9566569a,
+  0xa6aaa969,
+  0x66aa99aa,
+  0x69a6a699,
+  0x5aa6a6aa,
+  0x6a6aaa95,
+  0xa5aaaaa6,
+  0x9aaa6aaa,
+  0xaaa9aa6a,
+  0xbabbaab9,
+  0xaabaa6aa,
+  0xaeaaeaae,
+  0xabbaaaa6,
+  0x95a966a5,
+  0x95665959,
+  0xaa555955,
+  0x5aa9aa99,
+  0xa5559655,
+  0x65569656,
+  0x5a9a6555,
+  0x55955a55,
+  0xa6a96665,
+  0xaa9aaa9a,
+  0x69aa96a6,
+  0xa9aaaa9a,
+  0x9a699569,
+  0x5595aa56,
+  0x955959aa,
+  0x5556a599,
+  0xa9eaaaa9,
+  0xbaa6eb9a,
+  0xabaabaaa,
+  0xaaaeaae6,
+  0x5659a699,
+  0xaa5a5a59,
+  0x69a6556a,
+  0x66565a5a,
+  0xaaaaaaa9,
+  0xa96aeaaa,
+  0xaaaa66ab,
+  0xaa69aaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5555a555,
+  0x95655555,
+  0x55565955,
+  0x55695a55,
+  0x6aa595a9,
+  0xa995695a,
+  0x655aaa65,
+  0x565a6995,
+  0x65aaaa69,
+  0xa69aaa96,
+  0x9699a95a,
+  0xa9a6aaa9,
+  0x55655555,
+  0x56665565,
+  0xa5595956,
+  0x96655555,
+  0xaaa55aa9,
+  0xaa9699a5,
+  0xaaaaaa69,
+  0x9aa9a55a,
+  0xaa666669,
+  0x9aa9556a,
+  0xa6aa5a5a,
+  0x655aa966,
+  0x5956a6a5,
+  0x5965a6a5,
+  0x69595656,
+  0xa6655565,
+  0x55555655,
+  0x65555555,
+  0x55555555,
+  0x56955559,
+  0x59a96aa9,
+  0xaa6656a5,
+  0x96aaa9a6,
+  0xa6aa6aa9,
+  0xaaaaaab9,
+  0x7aaaabaa,
+  0xaaaaa7ee,
+  0xaabaaaaf,
+  0x55655555,
+  0x55555655,
+  0x55555559,
+  0x95655565,
+  0x665a9a55,
+  0x6559569a,
+  0x9a5aaaaa,
+  0x66a5a9aa,
+  0xa6595555,
+  0x55565596,
+  0x56595665,
+  0x55565555,
+  0x595a5955,
+  0x56695aa6,
+  0x55569969,
+  0x55599555,
+  0xaaaaaaa9,
+  0xbaebaaaa,
+  0xaab9aaae,
+  0xaaa9eaae,
+  0xa956a6a9,
+  0x96a96aa6,
+  0xa6aa59a9,
+  0x65a69aaa,
+  0x699a6955,
+  0x556a6a5a,
+  0x99555a96,
+  0x56665556,
+  0xa69a66a9,
+  0xaaaa66a9,
+  0x56995a69,
+  0x6a5a96a6,
+  0x69659a69,
+  0x55959656,
+  0x55665995,
+  0x65a65559,
+  0x55555555,
+  0x55565559,
+  0x5a659569,
+  0x555555a9,
+  0x6aa56aa5,
+  0x96aaaa96,
+  0x6a9aaa65,
+  0x6aa6aa69,
+  0xa55aa6a5,
+  0x6996965a,
+  0x6959a995,
+  0x565a5595,
+  0xabaabae9,
+  0xa9aaafaa,
+  0xaaeaaeba,
+  0xbaaee6aa,
+  0x696a9669,
+  0x9aa99966,
+  0xa65a6aaa,
+  0xaaaaaa6a,
+  0xaaaaaab9,
+  0xaaeaaeaa,
+  0xae69aaaa,
+  0xaaaafaee,
+  0x669659a5,
+  0x9a566966,
+  0x55565999,
+  0x69955955,
+  0xaa99a665,
+  0x55699a9a,
+  0x9aaa9996,
+  0xa6566556,
+  0x55555555,
+  0x55555555,
+  0x55565555,
+  0x55559555,
+  0xa6599555,
+  0x9a955955,
+  0xa56956a5,
+  0x959a6996,
+  0x555a9995,
+  0x59669955,
+  0x5aa55556,
+  0x969aaa65,
+  0xa5aa6999,
+  0xaaaaaaaa,
+  0xaa9aaaa9,
+  0x6aaaa966,
+  0x56999595,
+  0x569aa655,
+  0x55555995,
+  0x956a9996,
+  0xaaaaaaa9,
+  0xa9aaaeaa,
+  0xaaaaaaaa,
+  0xaeaaaaaa,
+  0xa9699a65,
+  0xaa6a5696,
+  0xa9a5aa66,
+  0x5a9a96a6,
+  0xbeebaea9,
+  0xbeababae,
+  0xae6aaaae,
+  0xee6aebaa,
+  0x66a655a5,
+  0x569569aa,
+  0x69a69a55,
+  0x599a5a9a,
+  0xa5965555,
+  0x55569a96,
+  0xa5556959,
+  0x596a6a55,
+  0x55555555,
+  0x65555559,
+  0x55555555,
+  0x55655565,
+  0x9a6aa699,
+  0xaa9aaa65,
+  0x9656669a,
+  0xaa96565a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5555a555,
+  0x55565965,
+  0x5566959a,
+  0x95965955,
+  0x95569555,
+  0x55555555,
+  0x55599556,
+  0x95556555,
+  0x55555555,
+  0x55555555,
+  0x56655565,
+  0x99555555,
+  0x99555555,
+  0x55555555,
+  0x55555555,
+  0x55955555,
+  0x55555555,
+  0x56569555,
+  0x9aa65699,
+  0x95a6aa9a,
+  0x9965a656,
+  0x559a5565,
+  0xa95559a9,
+  0x55a65556,
+  0x55aa6666,
+  0x5965a565,
+  0xa995a959,
+  0x559955a6,
+  0x669995a5,
+  0xe6aaa9a5,
+  0xaaaaaa7a,
+  0xbaeaa6aa,
+  0x9aa9aa9a,
+  0x555995a5,
+  0x5655a556,
+  0x5999a69a,
+  0x66556a59,
+  0x6aaaaa65,
+  0x66eaa669,
+  0x5a6aaaaa,
+  0xaa65a6aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55955565,
+  0x95a555a5,
+  0xa559555a,
+  0x55556565,
+  0x55565555,
+  0xfaeaaab9,
+  0x7aabaeaa,
+  0xaafbeaae,
+  0xeeaaabae,
+  0x9aaaaba9,
+  0xa6a9aaaa,
+  0xa69a6ae9,
+  0xaaaaaaa9,
+  0x55555555,
+  0x55555555,
+  0x55655655,
+  0x55556595,
+  0x55955565,
+  0x56955555,
+  0x66956a56,
+  0x65955699,
+  0x55955955,
+  0x955555a5,
+  0x55555695,
+  0x55955656,
+  0x69959a69,
+  0xa6565a5a,
+  0x99a656aa,
+  0xa96aaa96,
+  0xa9559955,
+  0x55559a95,
+  0x5959a559,
+  0x55555955,
+  0xaaeaaaa9,
+  0xba7aa69a,
+  0xaaaeebae,
+  0xeaaeaaea,
+  0x95559555,
+  0x55555565,
+  0x56555555,
+  0x59555956,
+  0xaaa6aaa9,
+  0x9aaaa695,
+  0xa666aaa6,
+  0xaaaaaa9a,
+  0x69595595,
+  0x565a5555,
+  0x65695655,
+  0x59565999,
+  0xa565a695,
+  0x55565965,
+  0x55995a55,
+  0x6656aa95,
+  0x65959565,
+  0x5a5a995a,
+  0x5a659565,
+  0x55569655,
+  0xaa9aa5a9,
+  0x9aaa9566,
+  0xa6aa9aa5,
+  0xaa966aaa,
+  0x55655555,
+  0x55559555,
+  0x55555555,
+  0x55555555,
+  0xeae79ea9,
+  0xaaebaeba,
+  0xbe6aabae,
+  0xaeaae6ae,
+  0x55555555,
+  0x9555555a,
+  0x55555555,
+  0x55555555,
+  0x69656655,
+  0x56655556,
+  0x96a56699,
+  0x55995696,
+  0x6a9a5aa5,
+  0x96a69665,
+  0xa5a9a6a9,
+  0xa95a56a6,
+  0x59555555,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0x9596aa55,
+  0x5a669669,
+  0x5a5aa659,
+  0x5a6a6a69,
+  0xaa669969,
+  0xa9a666aa,
+  0x66a55aaa,
+  0x656a9a69,
+  0x555a9699,
+  0x55969699,
+  0x95565999,
+  0x9555a559,
+  0xaa595655,
+  0x965a55aa,
+  0x65655595,
+  0x6565569a,
+  0x59556659,
+  0x9a556a66,
+  0x5a5a56a5,
+  0x9a596566,
+  0xa9aaaea5,
+  0xb9a6aaaa,
+  0x9aaaa69a,
+  0xaaaaaaaa,
+  0x59a96555,
+  0x56655555,
+  0x669a6556,
+  0xa5665959,
+  0x6a96aa99,
+  0xaa59666a,
+  0x9969a665,
+  0x69a5656a,
+  0xebeebea9,
+  0xaeababba,
+  0xb9abeaba,
+  0xaaeaaaae,
+  0x5969aa99,
+  0x5aaaa65a,
+  0xaa5a6966,
+  0xaaaaaa69,
+  0xaaa69aa9,
+  0xaafaabaa,
+  0xaaaaaaea,
+  0xaeaefbae,
+  0x65555595,
+  0x55555565,
+  0x95555569,
+  0x66965555,
+  0x556a9559,
+  0xa959565a,
+  0x569a6996,
+  0x56656595,
+  0x59995a59,
+  0x96a69655,
+  0x6a965696,
+  0x56a655a6,
+  0x9aa6aaa9,
+  0x69a9a9aa,
+  0xaaaa69aa,
+  0xa6999a5a,
+  0x6aaa6aa5,
+  0xaaaaaa9a,
+  0x69a99a5a,
+  0x9aaaaa9a,
+  0x5a9a6aa5,
+  0xa6a96aa9,
+  0xa5a66a69,
+  0x65a6aa55,
+  0x66999a95,
+  0xa665aaaa,
+  0x9a66a9aa,
+  0x999a6596,
+  0x96955555,
+  0x55595556,
+  0x55555555,
+  0x55555955,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69aaaea9,
+  0xaaa66a99,
+  0x99aa97aa,
+  0xaaa9e6a6,
+  0x9a555555,
+  0x65595955,
+  0x55555556,
+  0x65655559,
+  0xaae9aaa9,
+  0xaaa9aaae,
+  0xaabaa9aa,
+  0xab9e6aaa,
+  0x996aa965,
+  0x66965999,
+  0x6a556aa9,
+  0x99569655,
+  0xaaa9a6a9,
+  0x9aa9a9aa,
+  0xa696a996,
+  0x966a6aa9,
+  0xaa9a6a69,
+  0xa9969a55,
+  0x9a56aa9a,
+  0x9996aaaa,
+  0x695a5a95,
+  0x95969a59,
+  0x9a56a5a5,
+  0x69aaa956,
+  0x9a999a55,
+  0x9aa9aa66,
+  0xaaa695aa,
+  0x969aa5aa,
+  0x55595955,
+  0x55595656,
+  0x96655665,
+  0x55596555,
+  0xaaa99aa9,
+  0xaa6a69aa,
+  0x96aa66a6,
+  0xa69aa5aa,
+  0x56965a69,
+  0xaae9a959,
+  0xa9a6aaaa,
+  0xaaaaa59a,
+  0x55555955,
+  0x99556aa9,
+  0x6a959559,
+  0x65a55556,
+  0xaa6aa699,
+  0xa9aaaa9a,
+  0x9eaaa6a6,
+  0xaaaaaaea,
+  0xa6565659,
+  0xa65a5655,
+  0x65a66a59,
+  0x5655956a,
+  0x595a6665,
+  0xa655a5a9,
+  0x6aa69a95,
+  0xa6a59559,
+  0xaaa6aea9,
+  0xaaaaaaaa,
+  0x9aaaaaab,
+  0xaebaeaaa,
+  0xaa5a56a5,
+  0x9696a956,
+  0x659999a6,
+  0x5696aa96,
+  0xaaaa9a99,
+  0xa97aeaae,
+  0xaaaaaaab,
+  0xaaaaaaaa,
+  0xfbfa9ab9,
+  0xaaabeabe,
+  0xbeaaaaaa,
+  0xeaaaabae,
+  0xaaaaaaa5,
+  0xaa9aaaa5,
+  0xaa99aa99,
+  0xaaaa6669,
+  0xaaaaaaa9,
+  0x6a69aa6a,
+  0x9a69966a,
+  0x5a66aaa6,
+  0xaaaaa9a9,
+  0xa66a6a6a,
+  0x969a6a69,
+  0xa9aa59aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xababaaa9,
+  0xaabbebae,
+  0xaaabebae,
+  0xaa6aaaea,
+  0x969aa559,
+  0xaa65a965,
+  0xa6996aaa,
+  0x59a55969,
+  0xbaaaaea9,
+  0xaaa9ebae,
+  0xaaa9aa9a,
+  0xaaaaba9a,
+  0x65559955,
+  0x65a56555,
+  0x65595559,
+  0x559a6a55,
+  0x5a559595,
+  0x955a6a59,
+  0x55956aa6,
+  0x6a6aa695,
+  0x599a9595,
+  0x569696a6,
+  0x55955596,
+  0x5a555699,
+  0x55555955,
+  0x555656a5,
+  0x55556555,
+  0x55555965,
+  0x56965a69,
+  0x9669a96a,
+  0x5aa69aaa,
+  0xaaa96a96,
+  0x555659a9,
+  0x95595555,
+  0x5aa65669,
+  0x56566655,
+  0xaaaaaa99,
+  0xaaaaabaa,
+  0x9aaaa9aa,
+  0xaaaaaaa5,
+  0xa5595965,
+  0x9aa695a9,
+  0x696a55a9,
+  0x9555565a,
+  0x66655555,
+  0x55995599,
+  0x96a55555,
+  0x95a55559,
+  0x69969695,
+  0xaa55aa99,
+  0xaaaaaa59,
+  0x5a99969a,
+  0x555a5565,
+  0x559655aa,
+  0x555699a5,
+  0x95556559,
+  0x59959595,
+  0x55655955,
+  0xa65a5956,
+  0x95969566,
+  0x66a9a5a5,
+  0x699a6a69,
+  0x9969595a,
+  0x99569a65,
+  0xaa655559,
+  0x669969a9,
+  0x969699a9,
+  0x655655a9,
+  0x66a55a95,
+  0x5aa5665a,
+  0x65a96aa6,
+  0x95a9a69a,
+  0xaa999a95,
+  0x9a5659a5,
+  0xaa969a59,
+  0x6a956959,
+  0x6a655565,
+  0x56a9a965,
+  0x656a6656,
+  0x566a555a,
+  0x55555955,
+  0x5555a55a,
+  0x55565555,
+  0x55565555,
+  0x65555555,
+  0x55555555,
+  0x55595655,
+  0x55555555,
+  0x56a695a9,
+  0x5a5aaaaa,
+  0x9a6aa69a,
+  0x6a55aaa9,
+  0x55966555,
+  0x95569955,
+  0x599665aa,
+  0x96599659,
+  0x5aaaa699,
+  0xaaaa65aa,
+  0x969aaaaa,
+  0xa6aaa96a,
+  0xa59a6a69,
+  0x6a96995a,
+  0xaaa5aa6a,
+  0x5aa9aaaa,
+  0x6a966965,
+  0xaaaa6a96,
+  0xaaa6aa69,
+  0x699a9aaa,
+  0xbae6eb99,
+  0xaabaeaaa,
+  0xafaaaaaa,
+  0xaaaa6aaa,
+  0xa6aa6aa5,
+  0xa5aa6a66,
+  0x6aaa59aa,
+  0xaaaa5aaa,
+  0x6a66aa59,
+  0xaa9a5aa5,
+  0x699aa966,
+  0x66a65665,
+  0x6aaba965,
+  0xaaa69eaa,
+  0xa96aa79e,
+  0xaaaaaa9a,
+  0xa9566669,
+  0xa666999a,
+  0xa696a9a9,
+  0x5aaa696a,
+  0x55655599,
+  0x56699556,
+  0x6a956555,
+  0xaa665956,
+  0xebaeaef9,
+  0xaaabaeba,
+  0xaafaaeaa,
+  0xbbbaabef,
+  0xaa99aaa9,
+  0xaa9a69aa,
+  0x9a566996,
+  0x6a695a99,
+  0xa6665969,
+  0x65a5a969,
+  0x9a656695,
+  0x5969a596,
+  0xa5a96655,
+  0xaa955a96,
+  0x959655a5,
+  0x5aa69959,
+  0xaae9aaa9,
+  0xaabaa7aa,
+  0xaeaa7a9b,
+  0xaaaaaaea,
+  0xaaa9aaa5,
+  0x96659669,
+  0x669a6aa5,
+  0xa6a6959a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95aa6965,
+  0x6a55959a,
+  0x966596a5,
+  0x69995a56,
+  0x95959995,
+  0x965a9a69,
+  0xa6965956,
+  0x66a559a9,
+  0xaa6996a9,
+  0xaaa9aaae,
+  0xaaaaaa9a,
+  0x9aaabaaa,
+  0x5659a965,
+  0xa5695569,
+  0x9aa6969a,
+  0x69969555,
+  0x55555555,
+  0x55555555,
+  0x56555555,
+  0x55955555,
+  0x69599565,
+  0x55555559,
+  0x95956595,
+  0x59569555,
+  0x55555595,
+  0x55995555,
+  0x55555a56,
+  0x65556995,
+  0x59695a59,
+  0x595a656a,
+  0x695aa699,
+  0x56aa6a99,
+  0xebaeeaa9,
+  0xaaebafbe,
+  0xfaabae9a,
+  0xafaeebee,
+  0xaabaaaa5,
+  0xa69aa9aa,
+  0xa69aa9aa,
+  0xaaa6aaa9,
+  0xaaabaab9,
+  0xbafaa6aa,
+  0xaebaba9a,
+  0xaebaaaaa,
+  0x9a656655,
+  0xaa995555,
+  0x56656a65,
+  0x69666955,
+  0x55566555,
+  0x56699555,
+  0x55555555,
+  0x55559555,
+  0x955a5965,
+  0x55a5a969,
+  0x95659aaa,
+  0x5a659a56,
+  0x55555655,
+  0x55565555,
+  0x55955555,
+  0x55555555,
+  0xaaa6aaa9,
+  0xbeeae7ea,
+  0xaebeaaaf,
+  0xaebaaaa7,
+  0x95596555,
+  0x99695655,
+  0x65555555,
+  0x6a59955a,
+  0xa5aa66a9,
+  0x9a69aaaa,
+  0xaaaaa966,
+  0xa69666aa,
+  0xaaabaa69,
+  0xb9ea9aaa,
+  0xbabbabef,
+  0xaa6aabaa,
+  0x9aa5aa69,
+  0x9595a59a,
+  0x9a5a6696,
+  0x5995aa69,
+  0xa5569655,
+  0x9565695a,
+  0xa6a96655,
+  0x55a55556,
+  0x56999565,
+  0x95959a56,
+  0x59555a6a,
+  0x95965559,
+  0x9569aa99,
+  0x6a6a9a5a,
+  0xaa5656a6,
+  0xaaaaa9aa,
+  0x99665655,
+  0x69565555,
+  0x9569a655,
+  0x66555a55,
+  0x9a6aaa95,
+  0x56596566,
+  0x9a9a6a95,
+  0x5a6a5a65,
+  0x65a56555,
+  0x95599595,
+  0x59a5959a,
+  0x5595556a,
+  0x55555555,
+  0x96555555,
+  0x5555556a,
+  0x6a555655,
+  0xa9a9eaa9,
+  0xaaaaaaa6,
+  0xaaaaaaab,
+  0xa69eaae5,
+  0x65a69665,
+  0xa656aa95,
+  0xa599aa5a,
+  0x695a965a,
+  0x59695555,
+  0x55956555,
+  0x55595555,
+  0x55555555,
+  0xa9a69ea9,
+  0x9a65a69a,
+  0x9aaa9a9a,
+  0xaa9a69aa,
+  0x599a6a95,
+  0x9a555996,
+  0x6996955a,
+  0xaaaa6656,
+  0x55a55655,
+  0x59695555,
+  0x95556565,
+  0x55955955,
+  0x55555555,
+  0x55555555,
+  0x69555555,
+  0x55655599,
+  0x596996a9,
+  0x55a95996,
+  0xaa965959,
+  0x55955656,
+  0xbaa69fa9,
+  0xaabaaaae,
+  0xaebaeaae,
+  0xa6aaaaea,
+  0x55996655,
+  0x95555556,
+  0x55555a55,
+  0x55559566,
+  0xa965aa69,
+  0x9aaaaa9a,
+  0xa66aaaaa,
+  0xaaaaaa96,
+  0x95555995,
+  0x59a55aa6,
+  0x95aa5a6a,
+  0x696aaa56,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0x55565965,
+  0xa9aa9aa9,
+  0xaaa9aaae,
+  0xaabaaaa6,
+  0xa69ab9ea,
+  0x9a555555,
+  0xa5556665,
+  0x59555555,
+  0x55599595,
+  0xa65596a5,
+  0x996aa965,
+  0x95595a95,
+  0xa5596959,
+  0x95555555,
+  0x595a6555,
+  0x5555555a,
+  0x55655995,
+  0xa55a69a5,
+  0x5a9555aa,
+  0xa6969969,
+  0xa5959695,
+  0xa9a6aa99,
+  0xa96a97aa,
+  0xaaaaabaa,
+  0x9a9aaaaa,
+  0xa5555555,
+  0x55955565,
+  0x55555596,
+  0x55595655,
+  0x55655955,
+  0x65a999a6,
+  0x5a955596,
+  0x96a5555a,
+  0xa556a9a9,
+  0xa9aa9a69,
+  0xaaaaa6a9,
+  0xaaa6a6aa,
+  0x65555559,
+  0x55556955,
+  0x56955659,
+  0x96555555,
+  0x55695559,
+  0x5a5566aa,
+  0x556aa555,
+  0xaa596599,
+  0xaa595699,
+  0x69955555,
+  0x65559a55,
+  0x6a999a56,
+  0x55955669,
+  0x955955a5,
+  0x99669596,
+  0x95a96965,
+  0xba96aa65,
+  0xb9aaaa9a,
+  0x9ebaaaaa,
+  0x9abaaaaa,
+  0xa65aa699,
+  0x969a66aa,
+  0xa5a55a6a,
+  0x655569a5,
+  0x69659995,
+  0x56a69699,
+  0x9a56969a,
+  0x95a966a6,
+  0xfbaabfa9,
+  0xaaeaaeaa,
+  0xaeaabeba,
+  0xaabaaa9a,
+  0x5aa6a6a9,
+  0x95696696,
+  0x96999556,
+  0xaa55959a,
+  0xa9aa6969,
+  0x959a656a,
+  0x59695565,
+  0x65a5aa95,
+  0xaa59a6a5,
+  0xaa99aaaa,
+  0xaaa6a6a9,
+  0x69a69aaa,
+  0x56559665,
+  0x55555555,
+  0x66555565,
+  0x56555565,
+  0xa69aa9a9,
+  0xaae66a69,
+  0x6aaaaa6a,
+  0x9aa6aaaa,
+  0x6a66a699,
+  0x959a9aa6,
+  0xaa5aa9aa,
+  0xaa6a559a,
+  0x55655965,
+  0x95965555,
+  0x595699aa,
+  0xa5655955,
+  0x95555555,
+  0x55955555,
+  0x55555555,
+  0x55555555,
+  0xaa569555,
+  0x55959aa5,
+  0x55695699,
+  0xa65696a5,
+  0xa6599955,
+  0x95a6a5a5,
+  0x9a6aaaa5,
+  0xa9555a9a,
+  0x59555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0x55555555,
+  0x59555555,
+  0x95956955,
+  0x99565965,
+  0x5aa69555,
+  0x56a55966,
+  0xaaa9a7a9,
+  0x9abaa6aa,
+  0x9baaaaa6,
+  0xeaaaa9ea,
+  0xa6a9a969,
+  0xaaa9999a,
+  0xaaaaaa69,
+  0x5a55aa59,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa6ab9aa9,
+  0xb9aaaa9a,
+  0x99a9966a,
+  0x9aa666aa,
+  0x56595565,
+  0x95955556,
+  0x55999955,
+  0x56a95996,
+  0x9a59aaa9,
+  0x6a659a9a,
+  0x6aa9a956,
+  0xa6aaaa96,
+  0xeaa7aab9,
+  0xaaebaaba,
+  0xa9aae7ae,
+  0xafaaaaaa,
+  0x95559555,
+  0xaa6a9655,
+  0x6a5566a5,
+  0x599aa955,
+  0x6aeaaaa9,
+  0xaea9a6aa,
+  0xaabaeaae,
+  0xabaaaaaa,
+  0x95596a95,
+  0x95a66aa9,
+  0xa9569a96,
+  0x66955555,
+  0x55555555,
+  0x565556a5,
+  0x55555555,
+  0x55555555,
+  0x6aa65a99,
+  0x656666a9,
+  0xa966aa6a,
+  0x9969a6aa,
+  0x5a555555,
+  0x59555666,
+  0x55595955,
+  0x55665555,
+  0xb9aaaea5,
+  0x7aa6e69a,
+  0xaeaaaaaa,
+  0xaaaaa9a6,
+  0x5a596995,
+  0xa659566a,
+  0x5655556a,
+  0x599696a5,
+  0x5a599595,
+  0x9a559695,
+  0x56969aa9,
+  0xa95a565a,
+  0xa5aa6aa9,
+  0x65abaaa9,
+  0x7aa9aaaa,
+  0x99a9aa99,
+  0xa69995a9,
+  0x59656596,
+  0x6a5566a5,
+  0x5a959a69,
+  0xaaababa9,
+  0xaea9aaaa,
+  0x9aaaaa9a,
+  0x9aaa6aaa,
+  0x56555595,
+  0x65555a65,
+  0x6569a956,
+  0x6955a55a,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0x55555655,
+  0xeaabeba9,
+  0xaabaaebf,
+  0xbaaeebaa,
+  0xaeaaabaf,
+  0x6aa96699,
+  0xaa5656aa,
+  0xaaaa9a66,
+  0x6a965aa5,
+  0x66a6aa65,
+  0xaaa9aaaa,
+  0xaaa6a6aa,
+  0xa6aa6aa6,
+  0xa699a6a5,
+  0xaa96a995,
+  0xa5a66a65,
+  0x6999a669,
+  0x595695a9,
+  0xa565a656,
+  0xa55a99a9,
+  0x96996a95,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0x5a555655,
+  0x66a99a59,
+  0x9aa95555,
+  0x656556a6,
+  0x55956696,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x56a65965,
+  0x95956a9a,
+  0x659599aa,
+  0x6595566a,
+  0x9a69a5a9,
+  0x99aa99a6,
+  0x9a596695,
+  0xa5aaaaa9,
+  0x95555555,
+  0x5555555a,
+  0x95555555,
+  0x55555556,
+  0x695955a5,
+  0xaa6556aa,
+  0x655a5665,
+  0xaa5559aa,
+  0xbaeaaba9,
+  0x9aa9aaae,
+  0xaabae6aa,
+  0xaaae6a96,
+  0xfbebaef9,
+  0xeaabaaba,
+  0xaaebaeee,
+  0xbabaabae,
+  0xaaaaaaa5,
+  0xaa6a9aa6,
+  0xa6a9aaaa,
+  0xaa9a6a6a,
+  0xaaaa9aa9,
+  0x6aaaaaaa,
+  0xa969aa6a,
+  0xaaaaeaae,
+  0x99559659,
+  0x655666a5,
+  0x9959656a,
+  0x6696a555,
+  0xa6556555,
+  0x5555655a,
+  0x56655555,
+  0x55596555,
+  0xebaebab9,
+  0xaaeaafba,
+  0xaeefafbe,
+  0xafaaea9f,
+  0x5955a599,
+  0x995a6695,
+  0x555965aa,
+  0x5a6a59a6,
+  0xa5aaaaa9,
+  0xaaaaaaaa,
+  0xaaa9aa9a,
+  0x9e6aaaaa,
+  0x56655595,
+  0x55555555,
+  0xa5569956,
+  0x55555555,
+  0x69a5a6a9,
+  0x6a65aa99,
+  0xa9aa6996,
+  0x66696a9a,
+  0xaa6aaa95,
+  0x5aa65969,
+  0x99a6aaaa,
+  0x6aa9a96a,
+  0x6aa6a699,
+  0x69a655a5,
+  0x666a99a5,
+  0x569a59a6,
+  0xbaab9fb9,
+  0xbaabaaaa,
+  0x9aaaab9f,
+  0xeba9ebaa,
+  0xa5955555,
+  0xaa995665,
+  0xa9566aa5,
+  0x696aaa65,
+  0xaaa5a6a9,
+  0xa9aaa69a,
+  0xaaa96996,
+  0x5aa9aa96,
+  0x5555a555,
+  0x55955655,
+  0x55556955,
+  0x55555555,
+  0x59656655,
+  0x55555596,
+  0x659965a5,
+  0xa6565556,
+  0xa6aa9aa5,
+  0xaaa6aa9a,
+  0xaaaaa699,
+  0xaaaaaaaa,
+  0x55555969,
+  0x95565955,
+  0x65595595,
+  0x65555555,
+  0xa659aa59,
+  0xaa6aaaa9,
+  0xaa69aaaa,
+  0xaa9a66a5,
+  0xaa695959,
+  0x665a5659,
+  0x59969569,
+  0x5a655659,
+  0x55565555,
+  0x9aa56556,
+  0x55966655,
+  0x95556556,
+  0x55555565,
+  0x55555555,
+  0x55555555,
+  0x55a55556,
+  0x596a6995,
+  0x5959a559,
+  0x9556696a,
+  0xa9965669,
+  0x65955555,
+  0x5656a695,
+  0x99655555,
+  0x6555a555,
+  0x55555555,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0x99a695a5,
+  0x69599996,
+  0xa95a5696,
+  0x96695999,
+  0xaaa6aaa9,
+  0xb9aae6ae,
+  0xaeb9abaa,
+  0xaeaa6aaa,
+  0x596559a5,
+  0x656656a5,
+  0xa9a95a59,
+  0x55565995,
+  0x56966559,
+  0x56566959,
+  0xa996a695,
+  0x55596596,
+  0x9a956955,
+  0x65965a55,
+  0x6556a559,
+  0x5a59556a,
+  0x99aaeaa9,
+  0xaaaaaaea,
+  0xa6aaa69a,
+  0xe6aa5969,
+  0xaaa6aea9,
+  0xaa6aabaa,
+  0xaebaa6aa,
+  0xaebe6ae6,
+  0x55956995,
+  0xa5a6aa99,
+  0x56aaa966,
+  0xa9569695,
+  0xa9a96669,
+  0xaa6aaa9a,
+  0xa65a6a96,
+  0xa6aaaaaa,
+  0x55655555,
+  0x559599aa,
+  0xaa556559,
+  0x55655656,
+  0x55565555,
+  0x5699a655,
+  0x5a99a669,
+  0x65565a65,
+  0x65555555,
+  0x55555555,
+  0x55555555,
+  0x59555555,
+  0x95556655,
+  0x65655555,
+  0x5655555a,
+  0x55955565,
+  0xa5aa96a5,
+  0xaa599665,
+  0x9a9965aa,
+  0xaaa66a6a,
+  0xa959a995,
+  0x596a6556,
+  0x6a959a69,
+  0x56a5659a,
+  0x565995a5,
+  0x5559555a,
+  0x9565a955,
+  0x65655665,
+  0xaaeaaea9,
+  0x9aaaab9a,
+  0xaaaaabea,
+  0x9a9aaaa6,
+  0x55555555,
+  0x69565595,
+  0x55955556,
+  0x59965555,
+  0x56aa65a9,
+  0xa96aaaa5,
+  0xa6a9699a,
+  0x9a6aa966,
+  0xa9a69aa9,
+  0x56a6aa6a,
+  0x696996aa,
+  0x6965aa6a,
+  0x5965a565,
+  0x95555595,
+  0x56555555,
+  0x5a996565,
+  0x55a55955,
+  0x55559996,
+  0xa996a996,
+  0x56999596,
+  0xa55a5965,
+  0x966655a9,
+  0xa6a69965,
+  0xa96555a5,
+  0x66a55969,
+  0xa995959a,
+  0x656a66a9,
+  0x565a665a,
+  0xa9aaaab9,
+  0xaae6eaba,
+  0xbabaabaa,
+  0xaebebbae,
+  0x99995555,
+  0x5555959a,
+  0x5556556a,
+  0xaaa59555,
+  0x6a966a59,
+  0x65695559,
+  0x96a9aa99,
+  0xa6565a95,
+  0x55566559,
+  0x55555555,
+  0x59955655,
+  0x55955555,
+  0x5a6aa699,
+  0xaabaa9aa,
+  0xaa5a699a,
+  0xa6aaaa69,
+  0xaaaa9e65,
+  0x6aaaaaba,
+  0x9a7aaa9a,
+  0xaaaaaaaa,
+  0xa9595995,
+  0x65596696,
+  0x995a5955,
+  0xa95a65a6,
+  0x56555655,
+  0x55555555,
+  0x55955555,
+  0x55555555,
+  0xa6996a59,
+  0x99956a59,
+  0x59555aa6,
+  0x69559a6a,
+  0x55565695,
+  0x55965555,
+  0x95955555,
+  0x955a6569,
+  0x55555555,
+  0x55555555,
+  0xa5555555,
+  0x55555555,
+  0x59555569,
+  0x595965a5,
+  0x55955566,
+  0x55565955,
+  0xaaa6aaa9,
+  0xaaaaaa9a,
+  0xaebaaaab,
+  0xa6aaaaaa,
+  0xaaaabae9,
+  0xaaa69aaa,
+  0xaaea9aba,
+  0xbea6e6ae,
+  0x99696a59,
+  0x66aa55a6,
+  0xaa59a655,
+  0x5a95a959,
+  0xa6aaaaa9,
+  0xbaabae5a,
+  0x9aaaaaaa,
+  0x6aaaaaa6,
+  0x56556959,
+  0x955556a9,
+  0x55565569,
+  0x655565a5,
+  0xa9965655,
+  0xa5659696,
+  0x5965a996,
+  0x9655a6a9,
+  0x55555555,
+  0x55955555,
+  0x65555665,
+  0x56555555,
+  0xa56a5669,
+  0x96595596,
+  0x565966a6,
+  0xa5595595,
+  0xb9aaabb9,
+  0xaaebaaae,
+  0xaaaafaaa,
+  0xeeaaeaaa,
+  0xa55aaa65,
+  0x96aaa695,
+  0xa95666aa,
+  0x9a6aa66a,
+  0xbae5aaa9,
+  0xaa6aea9a,
+  0x9aaaa9aa,
+  0xa69aa5a6,
+  0x656aa9a9,
+  0xa9965a99,
+  0x699a5559,
+  0x5965aaa9,
+  0x59a69aa9,
+  0x9a5aa69a,
+  0x6aaa69aa,
+  0xaa969969,
+  0xa5565a65,
+  0x556a65aa,
+  0x5a5aa59a,
+  0x9a69a955,
+  0x56555555,
+  0x559a5a56,
+  0x56555555,
+  0xa555565a,
+  0x95555555,
+  0x55655955,
+  0x55555555,
+  0x55965556,
+  0x55999655,
+  0x69aa99a6,
+  0x69965a99,
+  0x59556969,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x65555665,
+  0x95655555,
+  0x95559556,
+  0x55559555,
+  0x6aa9a5a5,
+  0xa66aa669,
+  0x6996a9aa,
+  0xa9a66a69,
+  0x66a59659,
+  0xa5a59595,
+  0x66655556,
+  0x55a56aa5,
+  0xbaeaaaa9,
+  0xaaaaae6a,
+  0xaaebaaea,
+  0xaa6afaae,
+  0x59969595,
+  0x56955aa5,
+  0x5a955599,
+  0x95669565,
+  0xaaaaaab9,
+  0x7aeaaa6a,
+  0xaaa9abaa,
+  0xaaaa69aa,
+  0xa5595aa5,
+  0x555a6966,
+  0x65a56666,
+  0x5a9a9a55,
+  0x9aa6aa99,
+  0x9aaae6aa,
+  0x9a9aaaab,
+  0xaaaebae6,
+  0xaaa6a9a9,
+  0xaaaa99aa,
+  0xaaaaaa9a,
+  0xaebaa6aa,
+  0x99a9a555,
+  0xa6aa69a6,
+  0xa69a6aa6,
+  0xa9aa96aa,
+  0x55556565,
+  0x65555555,
+  0xa5555555,
+  0x55555556,
+  0x66665a59,
+  0x5a955959,
+  0x55555a95,
+  0x55655565,
+  0x59666699,
+  0x6aaa96a6,
+  0x9a65966a,
+  0x9656a9a6,
+  0x95a6a959,
+  0x6996a966,
+  0xa6a996a5,
+  0x6999a6a9,
+  0xa9aaa5a9,
+  0xa5aa96a9,
+  0x555aaaa9,
+  0x55959695,
+  0xa6aaaaa9,
+  0xa6a99659,
+  0xaaaaaa9a,
+  0xa9a5a96a,
+  0x55556595,
+  0x65555565,
+  0x55555969,
+  0x95666555,
+  0x996a56a9,
+  0xaaaaaaaa,
+  0xa6aa66a6,
+  0xaa6aa9aa,
+  0xaaeaaaa9,
+  0xaabbabba,
+  0xbaeaaaae,
+  0xaabaeaae,
+  0x5a6955a5,
+  0x6a6999a6,
+  0x5955aa56,
+  0x6695965a,
+  0x5565a699,
+  0x955aa656,
+  0x59a5a959,
+  0x995a5596,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x66655955,
+  0x556aaa59,
+  0x6a569959,
+  0x66656aa6,
+  0x55555665,
+  0x59665666,
+  0x59655a96,
+  0x55695555,
+  0xaa6a6a95,
+  0xa66a69a6,
+  0xaaa9a9a9,
+  0x96a65aaa,
+  0x55555555,
+  0x55556555,
+  0x55555655,
+  0x55559555,
+  0x69596595,
+  0x5555666a,
+  0x9556aa95,
+  0xa5a99596,
+  0x6a6aa6a9,
+  0xa96aa559,
+  0xa5a56a5a,
+  0xa66aaa95,
+  0x69a6aaa9,
+  0xbaa7aaaa,
+  0xa96aa6ae,
+  0x9aaaa6ea,
+  0x5a6aaaa9,
+  0x6699669a,
+  0x569959a5,
+  0x95a99a6a,
+  0x6aea9ea9,
+  0x9aa5abae,
+  0xaa6aea9a,
+  0xaa6aa9a6,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5a696669,
+  0xaaa9a6a9,
+  0x965aa69a,
+  0x6aaaaaa5,
+  0x55659559,
+  0x55595955,
+  0x55565556,
+  0x555556a6,
+  0xaa69a999,
+  0xaa9aa5aa,
+  0xaaaa6a6a,
+  0xa9aa6aa9,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x59595555,
+  0x9aa59aa9,
+  0x9aa9aaaa,
+  0x5aa9aaaa,
+  0xaaaa69aa,
+  0xaaebaaa9,
+  0xaaebae9b,
+  0xaa7aaaeb,
+  0xabaefbeb,
+  0xaa9aa955,
+  0x966a655a,
+  0xaa9665a5,
+  0x66a65969,
+  0x555566a9,
+  0x59569595,
+  0x55a95556,
+  0x959aa956,
+  0x96695995,
+  0x55665555,
+  0x955a6956,
+  0x69565659,
+  0x55655559,
+  0x59559995,
+  0x66695555,
+  0x5a65959a,
+  0xaaeaaab9,
+  0xaaeaafaa,
+  0xafaaabae,
+  0xabbaabea,
+  0xa6aa6965,
+  0xa65a69aa,
+  0xaaaa9a99,
+  0xaaaaaaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x555a9555,
+  0xeaeaaea5,
+  0xaaaaaaba,
+  0xaaa69aaa,
+  0xaa79eaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0x69aaa6a9,
+  0xa5a99566,
+  0x5aaa966a,
+  0x9a55a956,
+  0x55555555,
+  0x55556655,
+  0x55555556,
+  0x69555555,
+  0xaa5966a9,
+  0x9965a6a9,
+  0x599a96a5,
+  0x5a569699,
+  0xabaebab9,
+  0x6aabaeaa,
+  0xbaebeeea,
+  0xaabaeaae,
+  0x9a69a6a9,
+  0x9aa55a96,
+  0xaa9a659a,
+  0xa65a9a99,
+  0xaaabae79,
+  0x6aa6969a,
+  0xaaaaea9a,
+  0xaa69e6ea,
+  0x6a59aaa5,
+  0xaa9a6aa9,
+  0xa9969aaa,
+  0xaa96aaaa,
+  0x595555a5,
+  0x65555555,
+  0x55555555,
+  0x555a5555,
+  0xa9aa9a69,
+  0x659699a5,
+  0xaaa99995,
+  0x696aaa66,
+  0x99a99659,
+  0x66aa69aa,
+  0x65aaa59a,
+  0xaaa95aaa,
+  0x55955555,
+  0x55555555,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xbe65aaa9,
+  0xaeaaeaaa,
+  0xaeaab9aa,
+  0xa79ea9aa,
+  0xebae9aa9,
+  0xaaaaae6a,
+  0xaaeaea59,
+  0xaa6aabaa,
+  0x65a65655,
+  0x55995555,
+  0x95555a55,
+  0x55595555,
+  0x55a55955,
+  0x69955655,
+  0x9966665a,
+  0x55555665,
+  0x55566a95,
+  0xaa995565,
+  0x6a565a69,
+  0x6a95aa69,
+  0x9a969aa9,
+  0x65596a65,
+  0x9a59659a,
+  0x556659a9,
+  0xaaaa9aa9,
+  0x6aaa9aaa,
+  0xaaaaaa69,
+  0xaa69aaaa,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0x55555555,
+  0xaaaaaab9,
+  0xaaaaa6a9,
+  0x9aa5aaaa,
+  0xaa6969aa,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x55565555,
+  0xa69a6659,
+  0x966a955a,
+  0x5655a9aa,
+  0x965a6aa6,
+  0xaaa566a9,
+  0xa5a6aa5a,
+  0xaaa99599,
+  0x9a69aaaa,
+  0x55a55655,
+  0x55555555,
+  0xa5555555,
+  0x55555555,
+  0xaaa6aa69,
+  0xaaaaa6aa,
+  0xae6aaa9a,
+  0xaaaa66a7,
+  0x5a566995,
+  0xa5696659,
+  0x69956a56,
+  0x5a966595,
+  0x9669a959,
+  0x9a6aaa56,
+  0x6699959a,
+  0xa699a9aa,
+  0xa5aa6a69,
+  0x65596aaa,
+  0xa9a5a699,
+  0xa6a9aa59,
+  0x9959a555,
+  0x999595aa,
+  0x9a69a669,
+  0x95965966,
+  0x55659665,
+  0x55555659,
+  0x55555569,
+  0x55555965,
+  0xa5996a65,
+  0xa69959a9,
+  0x6666a9a9,
+  0x66a69a5a,
+  0x65555595,
+  0x55659695,
+  0x96a65559,
+  0x55595555,
+  0xaa6695a5,
+  0xaaa9aa65,
+  0x99aa9a95,
+  0x9a96a95a,
+  0xaa6aaa95,
+  0xaa9aa6a6,
+  0xaa6aa969,
+  0xaaaaa9aa,
+  0xaaa69a69,
+  0xaaaaa6aa,
+  0xaaa9aaae,
+  0x5aa96aaa,
+  0x5566a959,
+  0x9a555555,
+  0x59995565,
+  0x55655555,
+  0x56a66659,
+  0x5569a556,
+  0x56a56595,
+  0x569655a9,
+  0xa5aaaa95,
+  0x6aa9aaaa,
+  0x6a656695,
+  0x55599a96,
+  0x59666955,
+  0x5655995a,
+  0x5aaa59a9,
+  0x95a9596a,
+  0x65559555,
+  0x59599566,
+  0x65656556,
+  0x99556656,
+  0xa65aa595,
+  0xa6a6aa5a,
+  0x955aaaa5,
+  0x5a96a55a,
+  0x5aa99695,
+  0x9aa9a59a,
+  0xa66a6996,
+  0xaaaaaaa6,
+  0xaaa65555,
+  0xaaa66a6a,
+  0xa96aaa59,
+  0x5aa596aa,
+  0x9555a955,
+  0x95a95596,
+  0x565a556a,
+  0x56a5a999,
+  0x65555555,
+  0x55555a99,
+  0x95955655,
+  0x59556596,
+  0xaaefbae9,
+  0xaaaaaeae,
+  0xaaeaaaaa,
+  0xbaeae7af,
+  0x6aa6aa99,
+  0x9a6a65aa,
+  0xa6a9a9aa,
+  0xa6aaaaaa,
+  0xa6aa9aa5,
+  0xa5aa9a9a,
+  0xa5aaa6aa,
+  0x9aa6aaaa,
+  0x99a66aa9,
+  0x5aaaa9aa,
+  0x96aa6a69,
+  0xa99a996a,
+  0x55555555,
+  0x55555555,
+  0x59555555,
+  0x95555555,
+  0x56555565,
+  0x55555555,
+  0x56565955,
+  0x55555555,
+  0x6655a6a5,
+  0xa6656a9a,
+  0x595a6996,
+  0x659a5995,
+  0x95555655,
+  0x5a965955,
+  0x55555555,
+  0x55555555,
+  0x5a9999a5,
+  0x669566a6,
+  0x5a6a6a66,
+  0xa9a9a569,
+  0xaaaaa669,
+  0x9996a69a,
+  0x99a6aa9a,
+  0xa6a6666a,
+  0x95555a55,
+  0x56555555,
+  0x55555555,
+  0x55555555,
+  0xaaa5aa69,
+  0xa9996a9a,
+  0xaa9aaae6,
+  0xaaaa9aa9,
+  0x55569555,
+  0x5a595595,
+  0x55565a95,
+  0x55955a56,
+  0x9699a699,
+  0x99996699,
+  0x99565aa6,
+  0xa9a65aa5,
+  0x55695559,
+  0x5a655995,
+  0x5a65655a,
+  0x5595556a,
+  0xbaefbaa9,
+  0xaafbaaba,
+  0xbafaeebe,
+  0xaeaaabaa,
+  0x9a65aaa5,
+  0x96596aaa,
+  0x96a9959a,
+  0x55aaa969,
+  0x6656a969,
+  0x96955965,
+  0x5565a555,
+  0x59699656,
+  0xaa5555a5,
+  0x95699a55,
+  0x5a5956a5,
+  0x55956955,
+  0xaaaaaa99,
+  0xa96aa6aa,
+  0xaa6aaaa6,
+  0xaaaabaa6,
+  0xfaaaaa79,
+  0xb9aaeaba,
+  0x7ae6abaa,
+  0xaaaaeaaa,
+  0xaaa5eaa9,
+  0xaaaaaaa6,
+  0xaaaaaaea,
+  0xabaaaaaa,
+  0x65aa9965,
+  0xaa695556,
+  0x56a9a6aa,
+  0x6a556965,
+  0x9655a999,
+  0xaaaa6699,
+  0x9a6a9699,
+  0x569a6a5a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x96a56a65,
+  0xa69556aa,
+  0x69969aa6,
+  0x66a69a99,
+  0x55555555,
+  0x56555555,
+  0xaa655555,
+  0x55559595,
+  0xa565a555,
+  0x5559a56a,
+  0x5a955699,
+  0x5a695955,
+  0x6695a5a9,
+  0x56a95a55,
+  0xa6565595,
+  0x6a99a6a9,
+  0x95699659,
+  0x99699669,
+  0x995aaa65,
+  0x9aaa5556,
+  0x55555555,
+  0x59555556,
+  0x55a59956,
+  0x5a559556,
+  0xaa699665,
+  0xa6a96696,
+  0x969aa5a6,
+  0x55695aa9,
+  0x699aaa69,
+  0xaa69aaaa,
+  0x9aaaaaaa,
+  0x6a69aa66,
+  0x595a5565,
+  0xa5595556,
+  0x55556555,
+  0x95955595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa6a6aa55,
+  0x96955695,
+  0x596aa5aa,
+  0x9995a6a9,
+  0x6a5aa565,
+  0x5695a656,
+  0x66a965a6,
+  0x95665959,
+  0x5695a555,
+  0x55595555,
+  0x55555556,
+  0x55555555,
+  0x9a5959a5,
+  0xa6a65aaa,
+  0x9996a5a6,
+  0x6aa6aa9a,
+  0x9a965a59,
+  0xa966aa96,
+  0xaaaa6aa6,
+  0xa65aa9aa,
+  0x55555555,
+  0x95555a95,
+  0x55555555,
+  0x55555555,
+  0x55559655,
+  0x996a65a6,
+  0x69a99665,
+  0x9955a669,
+  0x659669a5,
+  0x6aa6655a,
+  0x9aa9aa9a,
+  0x5aaa956a,
+  0x55955565,
+  0x9659a565,
+  0x69999655,
+  0x55555659,
+  0x59555a95,
+  0xa9a6565a,
+  0x56556695,
+  0xa6a56a65,
+  0x99959a65,
+  0x995666a5,
+  0x59a996a5,
+  0x5699a995,
+  0x9aa6a9a9,
+  0xaa9a66aa,
+  0xaaaaaaa9,
+  0x6a9a9a65,
+  0xbae69aa9,
+  0xaeaaeaaa,
+  0xaa6aaaaa,
+  0xae9aaaab,
+  0x9a5a59a9,
+  0xa6a59565,
+  0xaaaa9aaa,
+  0xa696956a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x565995a5,
+  0x699a599a,
+  0xaaaa5655,
+  0x59a55a9a,
+  0x95555955,
+  0x55555555,
+  0x55555555,
+  0x56555555,
+  0x55555565,
+  0x65699556,
+  0x55555655,
+  0x56595a59,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa9a99659,
+  0x99a9a699,
+  0xa655aaaa,
+  0xa65aa966,
+  0x55569965,
+  0xa565a55a,
+  0x6a656665,
+  0x5a69a595,
+  0x96555555,
+  0x59555596,
+  0x95a65555,
+  0x55595655,
+  0x55555555,
+  0x55655555,
+  0x65555655,
+  0x55655556,
+  0xaaa9aaa5,
+  0x995aaa6a,
+  0xaaa9a9aa,
+  0xa9a5695a,
+  0x6aa9a6a5,
+  0xaa666aaa,
+  0xa69a66aa,
+  0x9a5aa959,
+  0x55555555,
+  0x55569555,
+  0x55555555,
+  0x55555555,
+  0x95599555,
+  0x55565955,
+  0x565555a5,
+  0x55965655,
+  0x55555555,
+  0x55a55555,
+  0x65a55555,
+  0x55959555,
+  0xfaaeaae9,
+  0xeaabaebe,
+  0xbafaaaba,
+  0xaa7aaaaa,
+  0x99665669,
+  0x5a569596,
+  0x56595555,
+  0x55596969,
+  0xaaaa9ea9,
+  0xaafaaeaa,
+  0xae7abaaa,
+  0xafaaebaa,
+  0x55565565,
+  0x55565996,
+  0x56655995,
+  0x55555969,
+  0x5a595555,
+  0x55555559,
+  0x65559555,
+  0x95555555,
+  0xa6a969a9,
+  0xaaaa9a69,
+  0xa9aa9a6a,
+  0xa669a66a,
+  0x66a69a69,
+  0x5a955555,
+  0x5a965965,
+  0x6955596a,
+  0x9a966a69,
+  0x65565669,
+  0x9995aa55,
+  0x9aa96695,
+  0x965aa9a9,
+  0x9aa9a996,
+  0xaaa6596a,
+  0x6996696a,
+  0x55555555,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0xaaaaaa69,
+  0x96aa66aa,
+  0x6656966a,
+  0x65aa6659,
+  0x6669a6a9,
+  0x9a969aa6,
+  0x96a9aaa6,
+  0x9a565965,
+  0x55555555,
+  0x56565555,
+  0x55699555,
+  0x55555556,
+  0x969aa6a9,
+  0x9aaaaaaa,
+  0x9aa5aa6a,
+  0x69969a69,
+  0x6a65a9a5,
+  0x5a55a6a9,
+  0x59a66695,
+  0xa55a5666,
+  0xebaabaa9,
+  0xaaebaaba,
+  0xbeebaaaa,
+  0xaa6eabea,
+  0x56555955,
+  0x55556955,
+  0x65555555,
+  0x55559569,
+  0x59699a59,
+  0x69a6a59a,
+  0x9566a699,
+  0xa5aa9996,
+  0xa596aaa9,
+  0x966a6955,
+  0x55556969,
+  0xa5569969,
+  0x5655a665,
+  0xa656965a,
+  0xa69a5566,
+  0x555a9999,
+  0x669aa669,
+  0xaa5aa956,
+  0x69aaa959,
+  0x69a5696a,
+  0x96a55a95,
+  0xaa6a59a6,
+  0x9669a9a6,
+  0x5599995a,
+  0x65665565,
+  0x55555555,
+  0x95555555,
+  0x55555555,
+  0x55a9a9a5,
+  0x6aa6a969,
+  0x96a59a59,
+  0x69599955,
+  0x55556955,
+  0xa9565555,
+  0x95566655,
+  0x6a696665,
+  0x99596955,
+  0x56a65a65,
+  0x99a6956a,
+  0x96a95a65,
+  0xaaa9aa99,
+  0xa6aaa9a6,
+  0x66aaa9a9,
+  0xa9aa5a6a,
+  0x6aabaaa9,
+  0x6eaaaaaa,
+  0xaaaaaaaa,
+  0xaeba69a6,
+  0x969a6aa9,
+  0x9a99aa55,
+  0x6aa65599,
+  0xa5aaaa99,
+  0xa5a556a5,
+  0x5a696a66,
+  0x6a595595,
+  0x9a596956,
+  0xeaa6aaa5,
+  0xaaabaaaa,
+  0xaaeaeaaa,
+  0xaaaaaaaa,
+  0x59565a65,
+  0xa6955556,
+  0x95555555,
+  0x55995555,
+  0x66a56969,
+  0xaa6999a6,
+  0x9a6655a9,
+  0xaaa9a555,
+  0x55955555,
+  0x55a9a999,
+  0x66955556,
+  0x95955a55,
+  0xaa66aaa9,
+  0xaaa9aaa9,
+  0x6a99aaa6,
+  0xa69a6aaa,
+  0x95565959,
+  0x6696555a,
+  0x56655959,
+  0x5555965a,
+  0x99559555,
+  0x55565a55,
+  0x9565a555,
+  0x5a699955,
+  0x55565a55,
+  0x59555595,
+  0x55659555,
+  0x5a555559,
+  0x55655555,
+  0x55555565,
+  0x56955555,
+  0x55555555,
+  0xaa6aaa99,
+  0xaeaaab96,
+  0xabaaa9ea,
+  0xaaaa6aaa,
+  0x99555a55,
+  0x55a55555,
+  0x55565655,
+  0x59655955,
+  0xaaa96aa5,
+  0xaa6aa6aa,
+  0xa6aaa95a,
+  0xaaaaaaaa,
+  0x9a9aaa69,
+  0xa66aaaaa,
+  0xaa6996a6,
+  0xa66aa5a6,
+  0xaa6aa9a5,
+  0xaa9956a6,
+  0x6aaa6a95,
+  0x56aa6a5a,
+  0x65955655,
+  0x95595955,
+  0x5555555a,
+  0x56599595,
+  0xeaaaaa65,
+  0x69aa9aaa,
+  0xbaaaaaaa,
+  0xaa7aabaa,
+  0x6aaa9999,
+  0x959a69aa,
+  0xaa959669,
+  0x5aaa9a6a,
+  0x6aebae99,
+  0x9abaaaaa,
+  0xaa7aa6ae,
+  0xaa9aaaaa,
+  0x6656aa65,
+  0xa9559965,
+  0xaa569a69,
+  0x66a65aa6,
+  0x659659a5,
+  0x59655966,
+  0x66596995,
+  0x55aa6595,
+  0xaaaaaaa9,
+  0xbeebaebe,
+  0xbabaaaae,
+  0xaaaafaaa,
+  0xaa695599,
+  0xa96a6596,
+  0x66a99965,
+  0x9666aa99,
+  0x65665a59,
+  0x65555559,
+  0x996aa659,
+  0x55555955,
+  0x56a96a59,
+  0xa695969a,
+  0xa5a6a556,
+  0x969599aa,
+  0x9aa66a59,
+  0xaaa56aa6,
+  0x9969aaa6,
+  0x9aa965a6,
+  0xaaaaaeb9,
+  0x69bbaaba,
+  0xaa6aabaa,
+  0xae7aaaaa,
+  0x6aa56955,
+  0x556aaa96,
+  0xa69aa566,
+  0xa69a966a,
+  0x9a9595a5,
+  0x56a56666,
+  0x5a596a95,
+  0x66a6559a,
+  0x9a655aa9,
+  0x66656955,
+  0x65a5656a,
+  0x5955aa95,
+  0x956996a9,
+  0x5999a996,
+  0x56a99596,
+  0x9a956a5a,
+  0x69aa9969,
+  0xaaa6aa9a,
+  0xaaa9a65a,
+  0x6a69aaae,
+  0xaa5a6aa9,
+  0xaa9965a9,
+  0xaa695aa9,
+  0x69aaaa6a,
+  0xa5555aa9,
+  0x6a69a65a,
+  0x6a6565a6,
+  0x569556a6,
+  0xa69aaa55,
+  0x65695969,
+  0x66a65a6a,
+  0xa65566a5,
+  0x55555655,
+  0x56555555,
+  0x55555555,
+  0x55995559,
+  0xa9a65965,
+  0x99a69a6a,
+  0x65a96a59,
+  0xaa999595,
+  0xa65a55a9,
+  0x6a99a956,
+  0x669699a9,
+  0xa66aa9a9,
+  0xaaa666a9,
+  0x96a5aaaa,
+  0x99a6a5a6,
+  0xaaaaaaa6,
+  0xaaaa6aa9,
+  0x6aa6aaa9,
+  0xaaea99ba,
+  0xa6aaaaae,
+  0x5965a659,
+  0xaa6659a6,
+  0xaaa9a6aa,
+  0xaaa9aa66,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa696a99,
+  0xa669955a,
+  0x969a5666,
+  0x9565555a,
+  0x65599955,
+  0x66655559,
+  0x9aa55699,
+  0x955aa559,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x699aaaa9,
+  0x65a96a6a,
+  0x9aa665aa,
+  0x5699aa95,
+  0xebeaaea9,
+  0xaaaaaeaa,
+  0xaaaaaeaa,
+  0xaaa5aaaa,
+  0x65556655,
+  0x556aa696,
+  0xa99996aa,
+  0xaa569a55,
+  0xa9969aa5,
+  0xa5a99aaa,
+  0x9969aaaa,
+  0xaaaae9aa,
+  0x55555555,
+  0x95555559,
+  0x55555555,
+  0x59655555,
+  0xa96aaa99,
+  0xaaa9aaaa,
+  0xaaaaaaaa,
+  0xaa6aaaa6,
+  0xaa9a69a9,
+  0xaaeaaaae,
+  0xaaeaaa9a,
+  0xa969abae,
+  0x55555655,
+  0x65555959,
+  0x55555559,
+  0x59555555,
+  0x55555955,
+  0x55565555,
+  0x55555555,
+  0x55555555,
+  0x9a556965,
+  0x5aa665a5,
+  0x55555665,
+  0x665a995a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa6a69a69,
+  0xaa9a6a6a,
+  0xaaaa9a99,
+  0xaaa5aa5a,
+  0xaa5a99a5,
+  0x55556995,
+  0xa659a966,
+  0xa5a66a59,
+  0x5a969555,
+  0x6555555a,
+  0x55996696,
+  0xa6a556a9,
+  0x6595aa95,
+  0x69555555,
+  0x55569556,
+  0x5959a955,
+  0x9aa9a559,
+  0x5a65a69a,
+  0x9aaa69a6,
+  0xaa596a9a,
+  0xeaaaeaa9,
+  0xaaeaaeba,
+  0xbaeaab9a,
+  0xefbaaaeb,
+  0x69995665,
+  0x565695aa,
+  0x65666969,
+  0x5a656959,
+  0xaaa6aaa5,
+  0x6aa996a9,
+  0x9a69a6aa,
+  0xaa6a69a6,
+  0x555a5559,
+  0x9a599966,
+  0x55a65a99,
+  0x66a66aa9,
+  0x9aa59669,
+  0x9aaae696,
+  0x66aa69aa,
+  0xa6aa6aaa,
+  0xeeaaaaa9,
+  0xbaabebba,
+  0xbaaaabef,
+  0xaebaabfe,
+  0xaa6aa9a9,
+  0xaaaaaaa6,
+  0xa6aa6a6a,
+  0xa9a6aaa6,
+  0x55555555,
+  0x55555555,
+  0x55555655,
+  0x55555555,
+  0x665655a5,
+  0xa5665956,
+  0x65556966,
+  0xa5555555,
+  0x596966a9,
+  0x55a95695,
+  0x655a5596,
+  0x65565595,
+  0xa9abaaa9,
+  0xaaaaaa6a,
+  0x6aaa9a5a,
+  0xaa66a69a,
+  0x96566665,
+  0x9659595a,
+  0x5a595966,
+  0x56556955,
+  0xaaaaaa69,
+  0xaea9aaaa,
+  0xaa6aabae,
+  0xabaaa9aa,
+  0x65956555,
+  0x955565aa,
+  0x55955565,
+  0x55555655,
+  0x55665555,
+  0x55555555,
+  0x55696596,
+  0x95555556,
+  0xa6a6aaa9,
+  0xaaaaa9aa,
+  0xaaa5a69a,
+  0x9aaaaa9a,
+  0x6a5a6569,
+  0x695a66aa,
+  0x5aaa9a65,
+  0xa5a6aaaa,
+  0x55656565,
+  0x59555555,
+  0x55555555,
+  0x55555559,
+  0xaa9aaaa9,
+  0xa5969a65,
+  0xaaa99aaa,
+  0xa9a9a66a,
+  0xaa6a5955,
+  0x695666a9,
+  0x55959a56,
+  0x99a95959,
+  0xaaaaaaa5,
+  0xaaab9aba,
+  0xa9aa96aa,
+  0xaaa9eaaa,
+  0x55555555,
+  0x55559565,
+  0x55555655,
+  0x69559556,
+  0x55555555,
+  0x65555555,
+  0x69555555,
+  0x95555569,
+  0x55955555,
+  0xa5556555,
+  0x59555555,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0xaa9a9a69,
+  0xa6aaaa69,
+  0x9aaaa6ae,
+  0x9aaaaaaa,
+  0x56555555,
+  0x55565555,
+  0x55555a95,
+  0x55555595,
+  0xa6965a55,
+  0xa9a55666,
+  0x5aaa65a9,
+  0x66a5a596,
+  0x55555555,
+  0x55555555,
+  0x55569555,
+  0x55556695,
+  0x95aa9a95,
+  0x9aa95aaa,
+  0xa66aaaa6,
+  0x9a9a59a9,
+  0xb9a6aaa9,
+  0x7aaaaeaa,
+  0xaaaaaaaa,
+  0xaaaaa7e7,
+  0x65599555,
+  0x55596555,
+  0xa55a9555,
+  0x55955555,
+  0xa6a56a55,
+  0x5aa5a659,
+  0x9a6aaaa6,
+  0x9a66a5a6,
+  0x55555555,
+  0x55555555,
+  0x55559595,
+  0x96555555,
+  0x5a655959,
+  0x995595a5,
+  0x59956565,
+  0x9955a559,
+  0xa9a96a69,
+  0xaaa6a6a9,
+  0x5a65959a,
+  0xaa699aaa,
+  0x55556595,
+  0x55595595,
+  0x59555555,
+  0x55559556,
+  0x665aa555,
+  0x5a556699,
+  0xaaa56599,
+  0x55a55999,
+  0xeb9e7aa5,
+  0x69e7aaaa,
+  0xaaabaeae,
+  0xaaaaabae,
+  0xaa6a9669,
+  0x9666656a,
+  0xaa5a666a,
+  0xa656a599,
+  0x96995a99,
+  0x655a6699,
+  0x55695966,
+  0x59595a9a,
+  0x95555655,
+  0x9565555a,
+  0x55555565,
+  0x56555655,
+  0xaaa9a565,
+  0x5a65a5aa,
+  0x9aaa69aa,
+  0x9aaa69a9,
+  0x5a9559a9,
+  0xaaaaa695,
+  0x65a6995a,
+  0x55599695,
+  0xa565a699,
+  0x66596a9a,
+  0xa6a6a596,
+  0x9555aa65,
+  0xaaabaab9,
+  0xaaa9abaa,
+  0xaaaaaaaa,
+  0xaaaaaaaa,
+  0x566a6a55,
+  0x59a95aa5,
+  0xa959a569,
+  0xa9956a55,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaae5669,
+  0xa5aa9aaa,
+  0xa9aaa66a,
+  0x6aa6abaa,
+  0xaaa69a65,
+  0x95595999,
+  0xa66a65aa,
+  0xa6aaaa59,
+  0xa6969a69,
+  0xa9a99a9a,
+  0xaa6aa6aa,
+  0xaaaaa956,
+  0x9a9659a5,
+  0x669aaaaa,
+  0x5a5a6a55,
+  0xaa56a95a,
+  0x6a69aa95,
+  0x6aa9aa5a,
+  0xaa59a956,
+  0x969aa996,
+  0x95555565,
+  0x69a65555,
+  0x66555565,
+  0x55555555,
+  0x95696565,
+  0x9599a965,
+  0x9aa9595a,
+  0xa56959a5,
+  0xaa9aaa65,
+  0x6a69669a,
+  0x9aa9aa96,
+  0xaaaa69a9,
+  0x66aa65a5,
+  0xaaaaaa69,
+  0xa9aa99a9,
+  0x69a96a5a,
+  0x9a6aaaa9,
+  0x5969aaaa,
+  0x969aa956,
+  0xaa966696,
+  0xa7eaaa69,
+  0xaae7abb9,
+  0xbae9aa9a,
+  0xaaaaaaaa,
+  0x95a9a955,
+  0x959aa595,
+  0x59696655,
+  0x59559969,
+  0xb9aaaaa5,
+  0xb966aaaa,
+  0xaa6aa6ae,
+  0x5ea9aa96,
+  0x55555555,
+  0x56555555,
+  0x555a5555,
+  0x65555a95,
+  0x59655a55,
+  0x55a9596a,
+  0x55666a5a,
+  0x9a9aa9a6,
+  0x5a966965,
+  0x66699655,
+  0x6aaaa699,
+  0x66aaaa6a,
+  0x55965955,
+  0x95555556,
+  0x95555995,
+  0x55559555,
+  0xa9a6aaa5,
+  0x99699aaa,
+  0x6aa99aa9,
+  0xa9a669a6,
+  0x56556555,
+  0x55555555,
+  0x55555655,
+  0x565a5555,
+  0x99aa99a5,
+  0xaa65965a,
+  0x665aa666,
+  0x99aa9956,
+  0x65556a59,
+  0xa6959a6a,
+  0x6a56996a,
+  0x65a95655,
+  0x595595a5,
+  0x55565566,
+  0x56965a65,
+  0x95555555,
+  0x55565555,
+  0x95555555,
+  0x55955595,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555955,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaabaaa9,
+  0xa9a6ae6e,
+  0xbaaae6ee,
+  0x9ea9faaa,
+  0x59555aa5,
+  0x95565556,
+  0x59565695,
+  0x99596a55,
+  0xa6ab9a59,
+  0x59aaabaa,
+  0x9aaaaaa6,
+  0x9a9a6aaa,
+  0x569a6aa5,
+  0xa595a96a,
+  0xa5a659a9,
+  0x6aa56695,
+  0x555a9555,
+  0x55565569,
+  0x55555555,
+  0x55595555,
+  0xbaebaea9,
+  0xbaebeebe,
+  0x9aaaabaa,
+  0xaababbef,
+  0x55555595,
+  0x65955555,
+  0x55555565,
+  0x55555559,
+  0x65a69999,
+  0x6a659699,
+  0x6999a6a9,
+  0x995555aa,
+  0xaaaaaaa9,
+  0xa9aa69aa,
+  0xa9a66ea9,
+  0x6aa6a6a9,
+  0x55555a65,
+  0x99595555,
+  0x95555565,
+  0x56956556,
+  0x55955695,
+  0x65565556,
+  0x96665555,
+  0x95555659,
+  0x55695555,
+  0x55555595,
+  0x55555555,
+  0x95555556,
+  0x9a959555,
+  0x55555655,
+  0xa59555a9,
+  0xa5a55955,
+  0xaaaeaae9,
+  0xa9abae6e,
+  0xbaeaaeaa,
+  0xaaaaaaaf,
+  0x56556aa5,
+  0x56655965,
+  0x565655a6,
+  0x65555555,
+  0x69aaaa69,
+  0x69a6a9a5,
+  0x5aa996aa,
+  0xaaa6aaaa,
+  0x6a966659,
+  0x6aaaa5a5,
+  0xa56a5a99,
+  0xa9aa9a5a,
+  0x699aa659,
+  0xa9a9a6aa,
+  0x99a5a696,
+  0x9a5a9966,
+  0x59956a55,
+  0x55555556,
+  0xa556955a,
+  0x5a555569,
+  0x9aa656a5,
+  0x556965aa,
+  0x559a996a,
+  0x6a6999a9,
+  0xbaaa9ba9,
+  0xbaebabae,
+  0x9aaaaaaa,
+  0xefaaabaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa9a6aa65,
+  0xa56a9a9a,
+  0x5a6aa5a6,
+  0x6a6a5aaa,
+  0x56555555,
+  0x55555555,
+  0x55696955,
+  0x55556595,
+  0x65555595,
+  0x5a555565,
+  0x955a5569,
+  0x565659a6,
+  0xb9aa9a79,
+  0xaaabaaaa,
+  0x9a6a9aaa,
+  0xaaaaaa96,
+  0xa5aa5995,
+  0xa6696a99,
+  0xaa6a9a69,
+  0xaa9699a5,
+  0x69655a55,
+  0x59656559,
+  0x55995555,
+  0x965555a5,
+  0x55556565,
+  0x55959656,
+  0x69999965,
+  0x555aa569,
+  0xaaa9aa95,
+  0xaa9a6a9a,
+  0xaaaa6aaa,
+  0xe6aaaaaa,
+  0xa5559569,
+  0x9659a556,
+  0x65696655,
+  0x59955595,
+  0xa69a9955,
+  0x6a96a5a6,
+  0x69566969,
+  0x59aa9999,
+  0x5555a555,
+  0x9665a566,
+  0x99a55996,
+  0x6555a569,
+  0xaaae5a69,
+  0xaaeaaa7a,
+  0xbaabaaa9,
+  0x9aa6aaae,
+  0xae69a695,
+  0xaa5aaa9a,
+  0xa6aaaaea,
+  0x99aaaaa5,
+  0x5aa65a69,
+  0x95659655,
+  0x55a555a6,
+  0x95aa56a5,
+  0x55556595,
+  0x55955596,
+  0x55655555,
+  0x55556a55,
+  0x9a66a969,
+  0x6aaa969a,
+  0x9aaa55aa,
+  0xaaa99aaa,
+  0xabaaaa69,
+  0xa9aaaa6a,
+  0x7aebaaae,
+  0x9a6aaaaa,
+  0x99a5a555,
+  0xaa5aa555,
+  0x956aa956,
+  0x99665555,
+  0x69aa95a9,
+  0x996a656a,
+  0x6595a669,
+  0xaa6a6aa5,
+  0x55555555,
+  0x59555555,
+  0x55555555,
+  0x55555555,
+  0x6a999655,
+  0xa6595aa9,
+  0xa55966a6,
+  0x566665aa,
+  0xaa665a65,
+  0x66965aaa,
+  0x6aaa9699,
+  0xaaa9aa9a,
+  0x65555655,
+  0x56555555,
+  0x95595555,
+  0x55555555,
+  0xa5aa5aa9,
+  0x656aa659,
+  0x6a665a5a,
+  0x965666aa,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5a655555,
+  0x55555555,
+  0x55555595,
+  0x55555556,
+  0xa9aaaa69,
+  0xb9aaaaba,
+  0xbae9aa9b,
+  0xaaaaabab,
+  0x6aa9e6a9,
+  0xaa5aaaaa,
+  0xaaaa6aaa,
+  0xa9aaa96a,
+  0x699a9655,
+  0x59a66a99,
+  0x59a9966a,
+  0x655599a5,
+  0xa9556569,
+  0x66965a66,
+  0x56a65955,
+  0x695595a5,
+  0x999596a9,
+  0x66969a59,
+  0x665aa9a6,
+  0x5556a9a5,
+  0x959a9955,
+  0x55969aa5,
+  0x66a6a695,
+  0x99a9559a,
+  0x9a556995,
+  0xa5556655,
+  0x96996a69,
+  0x6a555995,
+  0xaaebaa99,
+  0xa97aaaaa,
+  0xae6aaaae,
+  0xaaaea9eb,
+  0xa55666a9,
+  0xaa5a99a5,
+  0xa959a995,
+  0xa6a696a9,
+  0x55555655,
+  0x9555a555,
+  0x55556555,
+  0x65955565,
+  0x5a555955,
+  0xa9595965,
+  0x59595699,
+  0x5595a556,
+  0xaaa65aa9,
+  0xaaaa65aa,
+  0xaaae9aaa,
+  0xa69aaaa9,
+  0xaaaaafa9,
+  0x5aaaaaae,
+  0xaaaae69a,
+  0xaa9aaaa6,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x6996aa95,
+  0x9aaaa6a6,
+  0xaaaaa6aa,
+  0xaa99aaa5,
+  0xaaa6aaa9,
+  0xaaaa99aa,
+  0xaaa9aaaa,
+  0x9aaaaaaa,
+  0x55569555,
+  0x55655555,
+  0x65555556,
+  0x55565555,
+  0x65a7a699,
+  0xaa6aaa9a,
+  0x9aaaaaab,
+  0xa69aaaab,
+  0xaaaaaae9,
+  0xe996aab9,
+  0xb9abaeba,
+  0x6aa9a6aa,
+  0x5659aaa9,
+  0x555a5595,
+  0xa569a555,
+  0x59555559,
+  0xa5a55969,
+  0x66999a5a,
+  0xaa55a59a,
+  0x69a96aa9,
+  0xaa9a6aa9,
+  0xa6aaa9a6,
+  0xa6a6aaaa,
+  0x99aaaaaa,
+  0xaaaaa669,
+  0xaaa9aa9a,
+  0xaeaaa966,
+  0xa69aaaaa,
+  0x5a5659a5,
+  0x6a99a659,
+  0x65999a56,
+  0x696596aa,
+  0x55655555,
+  0x55555555,
+  0x65555555,
+  0x65555555,
+  0x9a956a69,
+  0xa6a56a59,
+  0xa5a9aa65,
+  0x99a9a6a6,
+  0x95955559,
+  0x5a56956a,
+  0x9aa599a5,
+  0x655659aa,
+  0xaaaaaaa9,
+  0x6aa5ebaa,
+  0xaaaaeaa6,
+  0xaa59a9a6,
+  0xaaaaaa69,
+  0xaa969aaa,
+  0xa9aaaaaa,
+  0x6aaaa699,
+  0x5555aa59,
+  0x56555aa5,
+  0x95969555,
+  0x69655655,
+  0xaaa66995,
+  0x6a96955a,
+  0x6aaa9995,
+  0xa56aa6a9,
+  0x66599555,
+  0x555a5569,
+  0x55555595,
+  0x55555955,
+  0x6aaaaaa9,
+  0xaab9aaaa,
+  0x9aaaaaaa,
+  0xaa9aaaab,
+  0xbbafbaa9,
+  0xbaebaaaa,
+  0xaeeaaeaa,
+  0xeaaaebaa,
+  0x55555555,
+  0x55555565,
+  0x55555555,
+  0x55555555,
+  0x6aaaa565,
+  0x66aaa96a,
+  0xaa99a59a,
+  0xa5556a5a,
+  0x96a6aa95,
+  0xaa9a5999,
+  0xa5a6996a,
+  0x95565aaa,
+  0xa5555555,
+  0x55555556,
+  0x55555555,
+  0x59555555,
+  0x69a6aaa9,
+  0x96a96599,
+  0x655a5a5a,
+  0x59a6aa56,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa6599a5,
+  0x65555aa5,
+  0x656a695a,
+  0x99a69595,
+  0xa65aa565,
+  0x6aa95969,
+  0x69aaa9a9,
+  0x959aa569,
+  0x95569555,
+  0x56555555,
+  0x5a955555,
+  0x555555a6,
+  0xaa9aa655,
+  0x69a69aa9,
+  0xaaaba699,
+  0x5a699a5a,
+  0x9a69a5a5,
+  0x55995566,
+  0x95596965,
+  0x95665555,
+  0x69995659,
+  0x59959555,
+  0x5a56a9a5,
+  0xa5556595,
+  0x55555555,
+  0x55555955,
+  0x55555655,
+  0x55555555,
+  0x65659965,
+  0x66596995,
+  0x65666566,
+  0x55a9a569,
+  0x55595655,
+  0x56556559,
+  0x95555555,
+  0x5a595555,
+  0x5669aa95,
+  0xa55a6596,
+  0x66969a96,
+  0x99565999,
+  0x65a69a95,
+  0x6a655655,
+  0x5a666a9a,
+  0x9a95aa9a,
+  0xa65555a5,
+  0xaa6aaaa9,
+  0x65a69aa6,
+  0x59aa9aaa,
+  0x55555555,
+  0x95555969,
+  0x55556655,
+  0x56999955,
+  0xaaaaae69,
+  0xaaabaaae,
+  0x6aaaaaaa,
+  0xaeaaaaae,
+  0x55655565,
+  0x55555555,
+  0x55555555,
+  0x55555659,
+  0xa99699a5,
+  0xa599a6a5,
+  0x656596a6,
+  0xa9a66996,
+  0xa5599a55,
+  0xaaaaa96a,
+  0x655aaa6a,
+  0xa5a69a59,
+  0x55955595,
+  0x656a5655,
+  0x559a99a5,
+  0x556a6695,
+  0x55955555,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0x55555555,
+  0x55565555,
+  0x65555555,
+  0x55555555,
+  0x6a9a9aa5,
+  0x5a6aa6aa,
+  0x5aaaa59a,
+  0x9aaaaaaa,
+  0x5a595695,
+  0x99a6999a,
+  0x565955a5,
+  0x5599a6a9,
+  0x99599a99,
+  0x9aa9aaa6,
+  0x5a96aa96,
+  0xa6aa66a9,
+  0xaaabaaa9,
+  0xbaeaaaaa,
+  0xaeeaaaaa,
+  0xaeaaabab,
+  0x656a6555,
+  0x69599595,
+  0x55aa5a65,
+  0x65566665,
+  0x69aa9a69,
+  0x6a5a5a6a,
+  0x9a6696a5,
+  0x666a6556,
+  0x55955555,
+  0x55555555,
+  0x55555555,
+  0x55659555,
+  0xa9559655,
+  0x95555996,
+  0x55696696,
+  0x9665a9a5,
+  0x7aeaaeb9,
+  0xbaeaeaba,
+  0xbabae79e,
+  0xae6aaaaf,
+  0x5aa69695,
+  0xa6956955,
+  0x55559655,
+  0x9556966a,
+  0xa5a6a969,
+  0x6a69aa99,
+  0xaab9ab9a,
+  0xa6aa69a6,
+  0x56555555,
+  0x55569566,
+  0x55599555,
+  0x55a65655,
+  0x9aaaaa99,
+  0xa96aa5a6,
+  0xaaa9a69a,
+  0xab9aaa69,
+  0x55565555,
+  0x95955555,
+  0x55695555,
+  0x56555555,
+  0x5a6a5565,
+  0x5a969995,
+  0x95655555,
+  0x555596aa,
+  0xaaaaaaa9,
+  0x6aa6aa5a,
+  0xaeaa9aaa,
+  0xaaaaaaaa,
+  0xaa9a6ae9,
+  0xaa9a9aa5,
+  0x6aa7aa6a,
+  0xaae9a69a,
+  0x59696955,
+  0x56655659,
+  0x6a659566,
+  0xa5959555,
+  0xaaa7aaa9,
+  0xaafbaa69,
+  0x9a6aab9a,
+  0xae69abaa,
+  0x5a599695,
+  0x955966aa,
+  0xa6555a59,
+  0x9a569a5a,
+  0x6aaaaba9,
+  0x5aaa96ae,
+  0xaaa9eaa6,
+  0xabaaba9a,
+  0x55595555,
+  0x65555a59,
+  0x55595555,
+  0x55559655,
+  0x59a55995,
+  0x56995596,
+  0x565a6595,
+  0x96955955,
+  0x55995a55,
+  0x56555559,
+  0x55555555,
+  0xa5595555,
+  0x996a5565,
+  0xa69aaa96,
+  0x96a59a69,
+  0xa5a96669,
+  0x6995a655,
+  0x55596999,
+  0x59695665,
+  0x655a5a95,
+  0xeaaaaea5,
+  0x69a6aaaa,
+  0xa9a7aeaa,
+  0xaa6a9baa,
+  0x55555555,
+  0x59556555,
+  0x95696695,
+  0x55655556,
+  0x59555555,
+  0x95955595,
+  0x55665599,
+  0x59a66555,
+  0x9565a9a5,
+  0xaaaa56a6,
+  0xaaaa9aa5,
+  0xa6a69669,
+  0x65555955,
+  0x95569695,
+  0x55569665,
+  0x59555555,
+  0x55a55555,
+  0x55595555,
+  0x55595559,
+  0x55559555,
+  0x6aaaaaa9,
+  0xaaaaa9a6,
+  0xabaaaaaa,
+  0xa6aa9aa9,
+  0x6aaaae69,
+  0xa9a696aa,
+  0xaaaa9659,
+  0xaaa9aa9a,
+  0x66565555,
+  0x65995955,
+  0x56555555,
+  0x95955595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x6a959959,
+  0x969a6aa9,
+  0x56aa6a9a,
+  0xa996a5aa,
+  0x659a5555,
+  0x565aa596,
+  0x956a5a65,
+  0x96655966,
+  0x56956555,
+  0x55555659,
+  0xa9555669,
+  0x556aa995,
+  0x55995a99,
+  0x56666699,
+  0x56a65a95,
+  0x5566655a,
+  0x55555555,
+  0x59955655,
+  0x5a555955,
+  0x555a6965,
+  0x66595665,
+  0x69a65565,
+  0xa69669a5,
+  0x55a99695,
+  0x65555565,
+  0x955655a9,
+  0x9955555a,
+  0x55556555,
+  0x55555555,
+  0x59956655,
+  0x955a565a,
+  0x55555556,
+  0x5aa66595,
+  0x69999969,
+  0x5956aa9a,
+  0x699a6a99,
+  0x9a66a699,
+  0x99aa969a,
+  0x955969aa,
+  0xa9aa66a6,
+  0x69565555,
+  0x55555565,
+  0x555556a5,
+  0x55555655,
+  0x95555595,
+  0x6555a559,
+  0x559565a5,
+  0x55655555,
+  0x656696a9,
+  0xaaa65656,
+  0x55556559,
+  0x5a655555,
+  0x969aa5a5,
+  0x569aa955,
+  0xa6559969,
+  0x6aa6a966,
+  0x6a556655,
+  0x56959555,
+  0x65556a55,
+  0x65595565,
+  0x96569569,
+  0x556aaa66,
+  0x96a5555a,
+  0x59655a95,
+  0xa969a999,
+  0x9a9aaaa6,
+  0xa6aaa9aa,
+  0xaaa6a9a9,
+  0x56559655,
+  0x66656555,
+  0x5a556659,
+  0x96555595,
+  0x665555a5,
+  0x96669969,
+  0x959a5a59,
+  0x59965aa6,
+  0x56a99a59,
+  0x555696a5,
+  0xa6a96aaa,
+  0xaaaaaaaa,
+  0x99555569,
+  0xaa956aa9,
+  0x66a59596,
+  0x95559569,
+  0x59555665,
+  0x56555999,
+  0x55655566,
+  0x56559555,
+  0x55655655,
+  0x55565555,
+  0x55555559,
+  0x59555555,
+  0xa6a666a5,
+  0xa5aa95a9,
+  0xa696995a,
+  0xaa9aa55a,
+  0x55555595,
+  0x695a6a65,
+  0x55995555,
+  0xa6595695,
+  0xa9a69965,
+  0x65595555,
+  0x55559556,
+  0x9559959a,
+  0xaa6a5a95,
+  0x555a9aa9,
+  0x96a65555,
+  0x5aaa96a5,
+  0xa6aa9a69,
+  0xa569a66a,
+  0xa669565a,
+  0x99699a5a,
+  0x56595569,
+  0x5965a556,
+  0x55555555,
+  0xa6965566,
+  0x69a65569,
+  0x5656aa5a,
+  0xa6a95665,
+  0xa66a6a95,
+  0xeaaaaea9,
+  0xbafbaabe,
+  0xaeb9eaaa,
+  0xefaaabef,
+  0xa9a959a5,
+  0xa95aa6aa,
+  0xaaaa9a56,
+  0xa9959aa9,
+  0x9aaaa969,
+  0xaa96a956,
+  0x96566aaa,
+  0x959556aa,
+  0x55555555,
+  0x6a555595,
+  0x56556955,
+  0x55555555,
+  0x9a69a699,
+  0xaabaaaaa,
+  0x9aaa69aa,
+  0xaaaaaa65,
+  0x65555555,
+  0x55569595,
+  0x5a555595,
+  0x65655655,
+  0xa59965a5,
+  0xaa5965a5,
+  0x969aa695,
+  0x5555665a,
+  0x65595565,
+  0xa9959599,
+  0x66556595,
+  0x65556556,
+  0x99599a55,
+  0x65a56965,
+  0x655a6665,
+  0xa9655655,
+  0x5a6aaa99,
+  0x9969aa66,
+  0x66596a9a,
+  0x95aaa665,
+  0xaaaaaaa9,
+  0x6aaaaaba,
+  0xa969eaaa,
+  0xaeaaaaae,
+  0x59569599,
+  0x55595655,
+  0x55596959,
+  0x59556555,
+  0x65aa9665,
+  0x56aa96aa,
+  0x9aa95666,
+  0x5aa969aa,
+  0xaa9aaaa9,
+  0xaaa69aa5,
+  0xb9a69aa9,
+  0xa9a9aaa9,
+  0x56956655,
+  0x96595555,
+  0x65595695,
+  0x55555555,
+  0x6a969965,
+  0x9566a669,
+  0x696696a9,
+  0x969a695a,
+  0xa65a6599,
+  0x955956aa,
+  0x969a55a5,
+  0x65a95595,
+  0x6a96aa99,
+  0x5a6aa6aa,
+  0x9965a59a,
+  0x9aaaa9aa,
+  0x56aaa6a9,
+  0xa56656a6,
+  0xa6aa966a,
+  0xaaa9aa9a,
+  0x5aa55959,
+  0x5696955a,
+  0xa696a655,
+  0x995959a5,
+  0x5699aa69,
+  0x69a559aa,
+  0x5a55a966,
+  0x955a5695,
+  0x6aa5a555,
+  0x96966a55,
+  0x959a596a,
+  0x5556a665,
+  0x95955555,
+  0x9a56a659,
+  0x9a55aa96,
+  0x666995a6,
+  0x565555a5,
+  0xa5565559,
+  0x555a5556,
+  0x55555565,
+  0x95a56555,
+  0x99666596,
+  0xaa595565,
+  0x56656969,
+  0x95955595,
+  0x65555595,
+  0x55565559,
+  0x56556555,
+  0xa9996999,
+  0xaaa9aaaa,
+  0xe99a9a59,
+  0xa9a6aa6a,
+  0x965a9565,
+  0x95995555,
+  0xa6555695,
+  0x5559656a,
+  0xa6aaaaa9,
+  0x6a96aaa9,
+  0xa9ebaa55,
+  0x995aa66a,
+  0x59659555,
+  0x565655a5,
+  0x55a665a6,
+  0x555566a6,
+  0xaaeaaea9,
+  0xbaeaabaa,
+  0xaaaaaaaa,
+  0x9aaaaaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69565955,
+  0x99596596,
+  0xa99a5996,
+  0x6696a9a9,
+  0xabaeaab9,
+  0x6aeaaaaa,
+  0xbeebaaae,
+  0xaa6aaaae,
+  0x55555665,
+  0x56555555,
+  0x56555a95,
+  0x56556555,
+  0x6556a655,
+  0x6a999aa9,
+  0x666a9a55,
+  0x9665aaa5,
+  0x56956aa5,
+  0x65595556,
+  0x59555555,
+  0x65956595,
+  0x95555595,
+  0x55555555,
+  0x555a5559,
+  0x55556555,
+  0x655a9565,
+  0x9969aaa9,
+  0x995a5655,
+  0xaaa99696,
+  0x5a59a655,
+  0x66956995,
+  0x5a59a995,
+  0x9955a656,
+  0x55555555,
+  0x5555559a,
+  0x55559555,
+  0x55555955,
+  0x55aa96a9,
+  0x969a6aa9,
+  0x56999a69,
+  0xa5969a69,
+  0x99555559,
+  0x55556595,
+  0x555655aa,
+  0x56966566,
+  0xebabaab9,
+  0xa9e6aaaa,
+  0xbeabaaaa,
+  0x9ebaaa9e,
+  0x5565a559,
+  0x55996a96,
+  0xaa696555,
+  0x66a99569,
+  0x6aaa9eb9,
+  0xbeaaaaaa,
+  0xaa6aaaaa,
+  0x9aba6aa6,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x565a9555,
+  0x55a9555a,
+  0x56a96555,
+  0x96a99556,
+  0xaaaaaaa5,
+  0xaaa6a9aa,
+  0xaaa69aa9,
+  0x69baaaaa,
+  0xa65699a5,
+  0x96a566aa,
+  0x96566599,
+  0x5aaaa995,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0x55555555,
+  0xa69569a5,
+  0xa66a5a59,
+  0x95aaaaa6,
+  0x69a69665,
+  0x65655565,
+  0x555555a5,
+  0x5559595a,
+  0x5655a965,
+  0xa9a99969,
+  0x65a6a5a5,
+  0x6959959a,
+  0x9a65a599,
+  0x55555555,
+  0x55555555,
+  0x55556555,
+  0x55555559,
+  0xaabaaa69,
+  0xaaa5eaae,
+  0xaaaafaaa,
+  0xaaaaaaea,
+  0x6a9969a5,
+  0xa65559a5,
+  0xa6a599a6,
+  0x9a6a5656,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa9a9a69,
+  0xaaa69a66,
+  0x696996aa,
+  0x6aa5aaaa,
+  0x55556595,
+  0xa555a995,
+  0x55556559,
+  0x55555555,
+  0xa9aa9aa9,
+  0x59aaa5aa,
+  0xaaaaaa9a,
+  0xa9aaa599,
+  0x55556955,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x56a5aa65,
+  0x56aaa5a5,
+  0x6569959a,
+  0x95556699,
+  0xa9a6aa55,
+  0x6aaaaaa6,
+  0x6669966a,
+  0xaaaaaa59,
+  0xa5555555,
+  0x55655695,
+  0x55555559,
+  0x55555555,
+  0x6ae7aa59,
+  0xaa6aaaaa,
+  0xaeb9eaaa,
+  0xa6aabaea,
+  0xaa5a55a9,
+  0x95aa99a5,
+  0xa65699aa,
+  0x5966a999,
+  0x95555555,
+  0x55655559,
+  0x55595555,
+  0x55595555,
+  0x56569955,
+  0x55569555,
+  0x55565555,
+  0x59655955,
+  0x99aa9995,
+  0x6696aaa9,
+  0x9665aa65,
+  0x95a69665,
+  0xa99a96a9,
+  0x599a99aa,
+  0x5a55aaa5,
+  0x5a996aa6,
+  0xab9a6ae9,
+  0xa6a6a969,
+  0x6aaa6a6a,
+  0xba69a6aa,
+  0xaa65aa59,
+  0xaa6966a6,
+  0x56966a69,
+  0xa6a96666,
+  0x55a95955,
+  0xaaaaa966,
+  0xa9a9aa6a,
+  0x6aaaa6aa,
+  0x96556555,
+  0x55a969a6,
+  0xa5565955,
+  0x695669a9,
+  0xa956a695,
+  0xa56696a9,
+  0x5569a566,
+  0xa5955996,
+  0x55955995,
+  0x59555555,
+  0x55556995,
+  0x96695695,
+  0x55659595,
+  0x59595595,
+  0x95565a59,
+  0x65559555,
+  0x659aaa69,
+  0x6aaaaaaa,
+  0x5a69aa9a,
+  0xaa6aaa96,
+  0x96595aa9,
+  0x9aa669aa,
+  0x65966a65,
+  0x66a6aa99,
+  0x55955555,
+  0x55956995,
+  0x65659555,
+  0x5559a569,
+  0xebafbaa9,
+  0xaaebaeae,
+  0xfafeeefe,
+  0xaaaafaaf,
+  0x99569665,
+  0x5aa56a95,
+  0x99aa9696,
+  0xaa565955,
+  0x6aaaaaa5,
+  0x6aaaaaaa,
+  0x5aa69aa9,
+  0xaaaaaaaa,
+  0x95555555,
+  0x65595565,
+  0x555a5555,
+  0x55565655,
+  0x696a9659,
+  0xaaa5a69a,
+  0xaa6a56a6,
+  0xaa99659a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55596559,
+  0x66555966,
+  0x95a999a6,
+  0x956a6655,
+  0xa696aa69,
+  0xa9aaaaaa,
+  0x9aa9aaaa,
+  0xaaa5a696,
+  0xa55aa999,
+  0xaa6a6aaa,
+  0x65aa66aa,
+  0xa996aaaa,
+  0xaaa5aa99,
+  0xaeaaabae,
+  0xaaa5a6aa,
+  0xaa6aaaaa,
+  0xa9555995,
+  0x55a66965,
+  0x96969669,
+  0x66999665,
+  0x55555555,
+  0x55955559,
+  0x55555695,
+  0x55555555,
+  0xbaaaafa9,
+  0xaaeaea9e,
+  0xaebae7aa,
+  0xabbef9aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa69aaa9,
+  0x9aaaa6ae,
+  0x9aaaa6a6,
+  0xeb996ae6,
+  0xa69a9595,
+  0xa5a696a9,
+  0x5596aa99,
+  0x96a596aa,
+  0xaaa9e695,
+  0x6669a9a6,
+  0x9a9aa9a9,
+  0xa696aaaa,
+  0xa9aaaa69,
+  0xaa99969a,
+  0x9a596a5a,
+  0x6aaa9a96,
+  0x56556965,
+  0x96aaaa99,
+  0xa6a99aa9,
+  0xa5969959,
+  0x55a55555,
+  0x556559a5,
+  0x966559a6,
+  0x95555566,
+  0x56969959,
+  0x95555696,
+  0x55959569,
+  0x9a59a595,
+  0x55555555,
+  0x55555955,
+  0x55555555,
+  0x55555555,
+  0x9a9665a5,
+  0x6aa5a5aa,
+  0x96a9a65a,
+  0x99a6a565,
+  0xa69a6aa5,
+  0x5a569965,
+  0x69a66a9a,
+  0x65aaaaa5,
+  0xaaaaaaa9,
+  0x9e69aaa6,
+  0xaaaa6aaa,
+  0xabaaaaa6,
+  0xeaaaaeb9,
+  0xaaeaaabe,
+  0xaaeaaa9e,
+  0xaa6aaaab,
+  0x9565a555,
+  0xa5aa59a5,
+  0xa65aa9a6,
+  0x59aa966a,
+  0x65955955,
+  0x5955a955,
+  0x55555565,
+  0x55555555,
+  0x659a6a55,
+  0x9a9565a9,
+  0x659aaa69,
+  0x696aa559,
+  0x999a5699,
+  0x59559595,
+  0x66a95596,
+  0xa69a5596,
+  0x959a9955,
+  0xaa599669,
+  0x6aa55695,
+  0x55aa5699,
+  0xaaaa6595,
+  0x6659aaaa,
+  0xa69aba6a,
+  0xa69a9aa9,
+  0x5955a559,
+  0x99995559,
+  0x55555556,
+  0x59596956,
+  0x56aa6655,
+  0x9666a6a9,
+  0xaa99a656,
+  0x9a959699,
+  0x6aa59a95,
+  0x9565a966,
+  0x966aa6a5,
+  0x9a6a66a5,
+  0xaa969aa9,
+  0xa9a6aaaa,
+  0x696a9a9a,
+  0x9aaaa669,
+  0x5a955555,
+  0x55555595,
+  0x55555555,
+  0x56555555,
+  0x6959aaa5,
+  0x9965a655,
+  0xaa6aaaaa,
+  0x96a9a599,
+  0x969566a5,
+  0xa69656a9,
+  0x659a666a,
+  0xa9696a5a,
+  0xaa69aa55,
+  0x9a6aa996,
+  0x565aa6a9,
+  0x96aaaaa6,
+  0x59a56aa5,
+  0x699a99a5,
+  0x95669659,
+  0xa6699659,
+  0x65556595,
+  0x55595699,
+  0xa6559555,
+  0x95a99956,
+  0x69aa5955,
+  0x9aa5aa99,
+  0xa969a6aa,
+  0x9a9aaaaa,
+  0x9965a565,
+  0x99566566,
+  0x69965a66,
+  0xa9595695,
+  0xa5556659,
+  0x55666656,
+  0x55555556,
+  0xa9695555,
+  0xa6a555a5,
+  0x69565966,
+  0x5a65a659,
+  0x55595559,
+  0x56556595,
+  0x55595555,
+  0x65555556,
+  0x65665565,
+  0x5aa65699,
+  0x5aa5a596,
+  0xa5a99569,
+  0x96956666,
+  0x55556555,
+  0x55555999,
+  0x55569565,
+  0x95555556,
+  0x55955655,
+  0x5a666555,
+  0x56559565,
+  0x5a955659,
+  0xa5aa99a9,
+  0x56a65a95,
+  0x5aaa9a55,
+  0xa5aa9a55,
+  0x5aa55695,
+  0x969a6956,
+  0x659559a9,
+  0x6a555a66,
+  0xaaabaaa9,
+  0xae69abaa,
+  0xaa6aaaa6,
+  0xaaaaaaa6,
+  0x55556565,
+  0x55655559,
+  0x55555a69,
+  0x69556555,
+  0xaab9aaa9,
+  0xaaaaa59a,
+  0xa69aaaa6,
+  0xa7aaa96a,
+  0x59555555,
+  0x55655955,
+  0x55565655,
+  0x59555555,
+  0x6a596aa5,
+  0xa9a5a566,
+  0x95966965,
+  0x95a59569,
+  0x55555695,
+  0x95555595,
+  0x55655555,
+  0x55556555,
+  0xfbefaea9,
+  0xbebbafbe,
+  0xaaebeebe,
+  0xaab9aaea,
+  0xaa5aaa55,
+  0x99959556,
+  0x9a656559,
+  0x66a95a69,
+  0x65665965,
+  0x565a9669,
+  0x5965a659,
+  0x95556555,
+  0x55a65aa5,
+  0x96566656,
+  0x65599a65,
+  0x65a6556a,
+  0x55555555,
+  0x55555555,
+  0x55655555,
+  0x55565555,
+  0x566a9655,
+  0x55569559,
+  0x96955999,
+  0x555a9596,
+  0xaa6aeba9,
+  0xae99aaa6,
+  0xaaaaa9aa,
+  0xeaa6a9aa,
+  0xaaabaaa9,
+  0xaaeaa6aa,
+  0x9aa6aaaa,
+  0x9aaaeaa6,
+  0x55595565,
+  0x95999655,
+  0x555659a9,
+  0x55aa5595,
+  0x65555555,
+  0x55559559,
+  0x55555555,
+  0x69a95555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0x55595955,
+  0x5a995955,
+  0x55955555,
+  0x65955965,
+  0x55556a95,
+  0x55559559,
+  0x59969995,
+  0x55999555,
+  0x56659559,
+  0x555595a6,
+  0x555a5656,
+  0x66655669,
+  0x95559599,
+  0x5a55a596,
+  0x565965a5,
+  0xebbeaa69,
+  0xbabaaeaa,
+  0xbaebeaaa,
+  0xaebefaae,
+  0xaa65a6a9,
+  0x9a9aa99a,
+  0xaaaaa6aa,
+  0xea9a69a5,
+  0x569a9695,
+  0x96565a99,
+  0x6959a669,
+  0xaa55a9a5,
+  0x66969599,
+  0xa6969a69,
+  0xa556556a,
+  0x96965a95,
+  0x55555555,
+  0x55555595,
+  0x55555555,
+  0x55555555,
+  0xaaaa99a5,
+  0xa9a56a65,
+  0xaaa6966a,
+  0x995aa66a,
+  0x55655555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa996969,
+  0x5655aa59,
+  0x5a96aa99,
+  0x6969a665,
+  0x55555565,
+  0x69555555,
+  0xa5666555,
+  0x555556a5,
+  0xaaaaaa69,
+  0xaa6aa69a,
+  0xaaaa6aa6,
+  0x9aaa7aaa,
+  0xaa96aa69,
+  0xaaaa6a6a,
+  0xa6a66659,
+  0x6a69aaaa,
+  0x9aaa96a5,
+  0xaaa5aaaa,
+  0x96a9aaa6,
+  0xaaa9a966,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55955555,
+  0x56559555,
+  0x595695a5,
+  0x95565695,
+  0xae6aaa59,
+  0xaaa9aa96,
+  0xaa5ea9aa,
+  0xaaaa6aab,
+  0xe9a6aeb9,
+  0xbaaaaabe,
+  0xaaaaaaaa,
+  0xaaaaaaea,
+  0xa5655665,
+  0x99566aa6,
+  0x5555a559,
+  0x65656699,
+  0xaaa6aea9,
+  0x9aaaaaaa,
+  0x9abaea9e,
+  0x6a9a6a9a,
+  0x59a59595,
+  0x95555a65,
+  0x56559566,
+  0x5a5a5555,
+  0x555655a5,
+  0x55555996,
+  0x65955555,
+  0x56555555,
+  0xa6aa6aa5,
+  0x66abaa6a,
+  0x6aaaa69a,
+  0x6aaaa6aa,
+  0xa9aa6699,
+  0xaa5aaaa6,
+  0x9a6a6559,
+  0x699a9aa9,
+  0x95956955,
+  0x65a55556,
+  0x96555659,
+  0x95556a55,
+  0x55556595,
+  0x555a5555,
+  0x65555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55595555,
+  0xa5655a69,
+  0xa9a6aaa9,
+  0xaaaa96aa,
+  0x9aa65aaa,
+  0x55956659,
+  0x59a6a556,
+  0x5666aa65,
+  0x5a959555,
+  0x69555555,
+  0x5555555a,
+  0x55555595,
+  0x55959555,
+  0xaa5aa669,
+  0xa6a99699,
+  0x59966a6a,
+  0x5699995a,
+  0x59a9aa55,
+  0xa6655566,
+  0x969a6996,
+  0xaaa99565,
+  0x66565569,
+  0x69995a5a,
+  0x9aa6a559,
+  0x955a95a6,
+  0x59965565,
+  0x55555565,
+  0x65655655,
+  0x595a5559,
+  0xb9aaa699,
+  0xaaa5aa5a,
+  0x9abaaa96,
+  0xaaaaaaa6,
+  0x696a6965,
+  0xa9aaa9aa,
+  0x59a699a9,
+  0x6959aa59,
+  0xaa6aaaa9,
+  0xae7a6aa6,
+  0xaa99aaab,
+  0xaaaaaaaa,
+  0x59565565,
+  0x59a55a99,
+  0x59555a65,
+  0x56659a69,
+  0x56955555,
+  0xa5696555,
+  0xa5556555,
+  0x66569a59,
+  0x65555659,
+  0x59556659,
+  0x9a99595a,
+  0x9aa66a9a,
+  0x55555555,
+  0x59555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0x69aaaa69,
+  0xaaaa5aaa,
+  0x9aa5aaaa,
+  0x9a6aaaa6,
+  0xa699a995,
+  0xa6566a6a,
+  0x6655aa65,
+  0xaaa96969,
+  0x9596a6a9,
+  0x9a969a6a,
+  0x99a6a966,
+  0x9aaa65a6,
+  0x96596995,
+  0x55655955,
+  0x5aa99956,
+  0x69999955,
+  0x99baa799,
+  0xaa9a65aa,
+  0xa69aa9aa,
+  0xa7aaaa6a,
+  0x65655559,
+  0x5aaaaa99,
+  0x55695569,
+  0x5a695999,
+  0xaa996999,
+  0xaa6a69a9,
+  0xa9aa9965,
+  0x5aa69aaa,
+  0xa5659659,
+  0xaa655a6a,
+  0xa96a9966,
+  0x95966659,
+  0x55595655,
+  0x56a56555,
+  0x95a55655,
+  0x59596569,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95599555,
+  0x56a56955,
+  0x6565a669,
+  0x995565a5,
+  0x55556a65,
+  0x9aa96959,
+  0x5a555699,
+  0x99a6a665,
+  0xba6aaa99,
+  0xaaa9eaaa,
+  0xaaaeaaaa,
+  0x965eaaea,
+  0xeaaaaaa9,
+  0xaaabaaaa,
+  0xbaebee9a,
+  0x9aaaaaaa,
+  0x5a55a555,
+  0x96596655,
+  0x65556656,
+  0x59955559,
+  0x55955555,
+  0x555a5a55,
+  0x56555656,
+  0x55655559,
+  0x6655a9a5,
+  0xaa5a6959,
+  0xa956a565,
+  0x669955aa,
+  0x6aa69a99,
+  0x6a55a956,
+  0x9a665565,
+  0xaa566956,
+  0xfbaeaea9,
+  0xbaaaabaa,
+  0xbafbaaae,
+  0xaabafaee,
+  0x55569a65,
+  0x555a6565,
+  0x569a6a59,
+  0x55669965,
+  0xaaa7aa69,
+  0xaaaaabaa,
+  0xaa66a6aa,
+  0xaaa96a96,
+  0xaa955565,
+  0x55656555,
+  0x659a5565,
+  0x55959955,
+  0x9aaaaaa9,
+  0x5aaaa69a,
+  0x9aaaaaaa,
+  0xaaaaaaea,
+  0xebeaaab9,
+  0xaafbaeae,
+  0xabbfeaaa,
+  0xaabeeaef,
+  0x96959595,
+  0x55599555,
+  0x55559956,
+  0x59565a95,
+  0x95559555,
+  0x55556555,
+  0x55665559,
+  0x56656555,
+  0xa6a56a99,
+  0xaa9a9aaa,
+  0xaaaa9aaa,
+  0x6aa69a99,
+  0xaaa5aa99,
+  0x9aaaaaaa,
+  0xaaaaa6aa,
+  0xa6a979aa,
+  0x96669665,
+  0xa5565659,
+  0xa965a655,
+  0x56a66555,
+  0xa6956559,
+  0x569566aa,
+  0x99599595,
+  0x696695a5,
+  0x9aa69a95,
+  0x5a59aaa6,
+  0x5a6aa696,
+  0x5a56655a,
+  0x95996595,
+  0x9a5569aa,
+  0x6a99a666,
+  0x6a65a569,
+  0x6a99aa65,
+  0x5aa9aaa5,
+  0xaa5aaa9a,
+  0xaa6aaa96,
+  0x959a5555,
+  0x5aa96a66,
+  0xa5a56699,
+  0x6a69aa59,
+  0x556a5a69,
+  0x565a5566,
+  0x5555555a,
+  0x596a5955,
+  0x69ebaaa9,
+  0xaaaaabaa,
+  0xafbaaa9a,
+  0xaaaaaaaa,
+  0xa669aaa5,
+  0xa66a9aaa,
+  0x69966a69,
+  0x6aa6aa6a,
+  0x55659559,
+  0x55a55556,
+  0x555a5565,
+  0x55555969,
+  0xa6569665,
+  0x555659a6,
+  0x6695aa59,
+  0x56566665,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0x69556555,
+  0x55955595,
+  0x965a5559,
+  0x6a565995,
+  0x556a95a6,
+  0x55599955,
+  0xa5656559,
+  0x95959565,
+  0x6565a555,
+  0x55555555,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x6556a695,
+  0x695aa969,
+  0x59655a95,
+  0x55a56699,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x65555555,
+  0x6aaa9a59,
+  0xa955aaaa,
+  0x9a66aa96,
+  0x9569aaa6,
+  0x659565a9,
+  0x55965965,
+  0x99955999,
+  0x65555955,
+  0xa9656555,
+  0x5aaaa996,
+  0x959a5695,
+  0x65a56555,
+  0x65565655,
+  0xa99595a6,
+  0x9599a569,
+  0x996956a9,
+  0xaa569995,
+  0x6a65a5aa,
+  0xaa9aa66a,
+  0xa95a6666,
+  0x55955555,
+  0x55555555,
+  0x5555a555,
+  0x55555555,
+  0x55955555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x65699555,
+  0x695a5996,
+  0x55a55a96,
+  0x969aaa55,
+  0xaaabaaa9,
+  0xbefaaaaa,
+  0x9abaebab,
+  0xaabaabae,
+  0x9a556995,
+  0x65599559,
+  0x966699a5,
+  0x55a65596,
+  0x955a59a9,
+  0x99a99569,
+  0x95aa5556,
+  0x596a69aa,
+  0x95559565,
+  0x55555a55,
+  0x56555555,
+  0x55655955,
+  0x55655665,
+  0x5a959566,
+  0x55955569,
+  0x66a65555,
+  0x9a5a5565,
+  0x6a6a6a9a,
+  0x5966a969,
+  0x99aaaa96,
+  0x9a9a6a99,
+  0x99aa6a99,
+  0xa6a65aaa,
+  0x69a99a6a,
+  0x69969aa5,
+  0x5a659a6a,
+  0x9a6aa95a,
+  0x556a6aa6,
+  0xfbeeaea9,
+  0xbefbaaba,
+  0xaabbafaa,
+  0xbeaaeaae,
+  0x9966a555,
+  0xaa55a6aa,
+  0x6695999a,
+  0x999659a5,
+  0x69965995,
+  0xaaaa6a99,
+  0x599995a9,
+  0x96a96a5a,
+  0x65996699,
+  0x999aa696,
+  0x696a9a6a,
+  0x6aa5aaa9,
+  0x6959a959,
+  0xa5a9a5a9,
+  0x5aa65599,
+  0x955995a6,
+  0x6669aa55,
+  0x96566559,
+  0x956a955a,
+  0x5a569656,
+  0xaaaa9a99,
+  0x6a996aaa,
+  0xaa996ae6,
+  0xa6a99a6a,
+  0xaaeb9eb9,
+  0xa9ebea9a,
+  0x9aaaabaa,
+  0xaaaae9aa,
+  0x55555555,
+  0x655a5555,
+  0x55555555,
+  0x55555555,
+  0xaaa9aa99,
+  0xaa6aaaaa,
+  0xaeaaa69a,
+  0xaa996aab,
+  0xabaa9aa9,
+  0xa9abaaba,
+  0xaaeaaaaa,
+  0xaaaaa7ae,
+  0x5995a595,
+  0x95565965,
+  0x5596655a,
+  0x555565a6,
+  0xa9aa9a65,
+  0x6aaaaa56,
+  0x6965a6aa,
+  0xaaa5a99a,
+  0x69696565,
+  0x9a5a99a5,
+  0x55565a59,
+  0x5a665555,
+  0x6565a965,
+  0x9a95a66a,
+  0x995a556a,
+  0xa55a69a5,
+  0x659a9995,
+  0x55595595,
+  0x65656955,
+  0x9a555999,
+  0x55555555,
+  0x55555559,
+  0x55555555,
+  0x59555555,
+  0x55569aa9,
+  0x5aa59699,
+  0x69655aa6,
+  0x9a69566a,
+  0x65a956a5,
+  0x66aa65a5,
+  0xa9965a66,
+  0x699695a6,
+  0xa9a6eba9,
+  0xaaaaab9a,
+  0xaaaa6aaa,
+  0xaa9ab9aa,
+  0x965a9a69,
+  0x65699aa5,
+  0x66a69a5a,
+  0xaaa9569a,
+  0x69695699,
+  0x555a6559,
+  0x6a695595,
+  0x5a559555,
+  0x55a69569,
+  0xaa55aaaa,
+  0x9a9a965a,
+  0xa9a9599a,
+  0x55596995,
+  0x5a566a6a,
+  0x9a66aa66,
+  0x56aa66a9,
+  0x9aaa9a99,
+  0x5a6a966a,
+  0x5699aaaa,
+  0xaaaaaa9a,
+  0x55555555,
+  0x55555555,
+  0x95555555,
+  0x55555556,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaaaaa79,
+  0xbaaaeaae,
+  0xaaa9eaae,
+  0xaaaaaaea,
+  0x9a6aa9a9,
+  0xaaaaa965,
+  0xa9a95aaa,
+  0xaaa69a6a,
+  0x96669565,
+  0x55955665,
+  0x56969595,
+  0x56955665,
+  0x55655655,
+  0x65655565,
+  0x666a5555,
+  0x56555655,
+  0x5aa9a9a5,
+  0x565a6a66,
+  0x96a99a65,
+  0x955a6a65,
+  0x6aaa9ea9,
+  0x9a69aaaa,
+  0x9aa9aaaf,
+  0xaaaaa9aa,
+  0x55555555,
+  0x55555555,
+  0x55555595,
+  0x65655555,
+  0x55955665,
+  0x659a5965,
+  0x9969696a,
+  0x695a5965,
+  0xaaaaaaa9,
+  0xaaebafaa,
+  0xaabaeaae,
+  0xebaaaaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x6aaaaaa9,
+  0xaaa6966a,
+  0x9aa9aa6a,
+  0xaaaeaaaa,
+  0x95566599,
+  0xaa965565,
+  0x556a66a5,
+  0xa6a95655,
+  0x6565a559,
+  0x65655596,
+  0x95559956,
+  0x95565669,
+  0x55966a55,
+  0x696a9a55,
+  0x66a56656,
+  0x99a6a6a5,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0xa5955555,
+  0x96555555,
+  0x65655559,
+  0x5a595955,
+  0x5a559559,
+  0x65995556,
+  0x65595555,
+  0x55555555,
+  0x56a69569,
+  0x556aa5a6,
+  0x66665696,
+  0x5656aa55,
+  0x55565555,
+  0x65569969,
+  0x5959a556,
+  0x96555555,
+  0x595a9555,
+  0x565966aa,
+  0x5a6955a5,
+  0xa5555a69,
+  0xaaa65695,
+  0x59699699,
+  0x6a666695,
+  0x56666569,
+  0xa6aa6aa9,
+  0xaaaaaaaa,
+  0x69aaaeba,
+  0xbae9aa9a,
+  0xaaa6aaa9,
+  0xaa6aa9a6,
+  0x66a9aaaa,
+  0xaaa9aa66,
+  0x59559555,
+  0x55555695,
+  0x55695595,
+  0x55555555,
+  0x95669559,
+  0x5a5a6666,
+  0x5a65a966,
+  0x95599959,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaa96aa9,
+  0xaa96a999,
+  0x9aaa9aa6,
+  0x6aa9aa96,
+  0xa5659555,
+  0x55596956,
+  0x55955595,
+  0x55655965,
+  0x55555555,
+  0x55555565,
+  0x55555595,
+  0x5569555a,
+  0xa66a66a5,
+  0x96a9aaa6,
+  0xa79a6a66,
+  0xaa9a9a69,
+  0x66a99aa9,
+  0x9aaaaaa9,
+  0x9a6aaa96,
+  0xaa5aa9ab,
+  0xeaaaaaa9,
+  0xa9aaaaaa,
+  0xbaaaaeba,
+  0xaaa6aaaa,
+  0x6a56aaa9,
+  0xaa655555,
+  0xa65a59a6,
+  0x5a659555,
+  0x56a59955,
+  0x5695559a,
+  0x696a9a56,
+  0x656a69aa,
+  0x55555555,
+  0x55556555,
+  0x55555555,
+  0x55565555,
+  0xbaea9a99,
+  0x6aaaea9a,
+  0xaabaa9a6,
+  0xa6aaa6e6,
+  0xbaafaa69,
+  0xaae6afa9,
+  0xaeeaeaaa,
+  0xaaaaeaaa,
+  0xa6599595,
+  0xa55a6966,
+  0xa6596996,
+  0xa655a559,
+  0xaaa69a69,
+  0x6aaaaa99,
+  0x99a9aa9a,
+  0xaeaaa7a6,
+  0x96a995a9,
+  0xa56a6aaa,
+  0x99966aa5,
+  0x66aa9a69,
+  0x7a66aaa9,
+  0xaaaaa7aa,
+  0xaab9aaa7,
+  0x969abaaa,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x55555555,
+  0x55969669,
+  0x9596a6a9,
+  0x6aa69a5a,
+  0x56956a95,
+  0x66aa9a65,
+  0xaaaaa6aa,
+  0xaaaaaa5a,
+  0xaeaaaa96,
+  0x69569a95,
+  0x96655555,
+  0xa6a66666,
+  0x6aa99566,
+  0xaaaaeaa9,
+  0xaaaaabaa,
+  0x9aaaaa9a,
+  0xaaaa6aaa,
+  0x5695aa65,
+  0x99665aa5,
+  0xa55a9559,
+  0x6555a556,
+  0x599a5569,
+  0xa6556656,
+  0xa69555aa,
+  0x95669a69,
+  0xa9ab9aa5,
+  0xaaa6966a,
+  0x9a6aa69a,
+  0x9aaaea9a,
+  0x6965aa59,
+  0x969a5969,
+  0x5a5aa5a5,
+  0x6a965a9a,
+  0x55955655,
+  0x95599555,
+  0x95555555,
+  0x95555559,
+  0x59595555,
+  0x955656a9,
+  0x65555555,
+  0x55555595,
+  0x5a659555,
+  0x59555555,
+  0xa5556656,
+  0x56565555,
+  0xa5655a95,
+  0x66599999,
+  0x5aa9aa6a,
+  0x595aa6a6,
+  0x95999595,
+  0xaa95a956,
+  0xa6555665,
+  0x65969596,
+  0x5565a555,
+  0x955555aa,
+  0x59a66a55,
+  0x95655656,
+  0x99969955,
+  0x65569955,
+  0x6596a595,
+  0x6a5955a5,
+  0x59555555,
+  0x95565565,
+  0x56555555,
+  0x95555595,
+  0xaaaaaa69,
+  0xaaaa9a99,
+  0xaea9a6aa,
+  0xaeaa6a96,
+  0x595555a5,
+  0x56565955,
+  0x96955a65,
+  0x55595556,
+  0x6aaaa6a9,
+  0x6aa9aa9a,
+  0xa96a6aa6,
+  0xa6aa6a9b,
+  0x55595599,
+  0x59665a59,
+  0x65599a55,
+  0x5965559a,
+  0x59559555,
+  0x59956996,
+  0x5a556959,
+  0x55555999,
+  0x69666569,
+  0xa9559a6a,
+  0xaaa9a65a,
+  0x9a9aa5a5,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaaa9aa99,
+  0xaeaaaba6,
+  0xa69a6aaa,
+  0xaaaeb9a9,
+  0xeaabaaa5,
+  0x6aeaae6a,
+  0x6aaaabaa,
+  0xaaaae79a,
+  0x9aa969a5,
+  0x9a6aa6a6,
+  0xaa9ab966,
+  0xa6aa9aaa,
+  0x699666a5,
+  0xaa69969a,
+  0x9965aa9a,
+  0x6a996a95,
+  0xaa6a69a9,
+  0xaa65aa6a,
+  0x59aa9a5a,
+  0xaa96aa6a,
+  0x556566a5,
+  0x65599966,
+  0x95695566,
+  0xaa566695,
+  0xaaaaa979,
+  0x6aaaaaaa,
+  0xba6aaaaa,
+  0xaaaaeb9a,
+  0x9a556695,
+  0x66aaa9a6,
+  0xa9aa9a55,
+  0xa9aa9666,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa695a999,
+  0xa6655999,
+  0x566695a9,
+  0x6a956a59,
+  0x665a9a59,
+  0x695559aa,
+  0x9a566656,
+  0xa6965955,
+  0x55555555,
+  0x55555555,
+  0x55956555,
+  0x55559555,
+  0xa9599555,
+  0x56695955,
+  0x66695566,
+  0x65559955,
+  0xaaa69595,
+  0x6aa5a6a9,
+  0xa96a9aa9,
+  0x56aa6a96,
+  0x55555555,
+  0x56555555,
+  0x56559555,
+  0x55555555,
+  0x6aa9aa99,
+  0xaaaaa9a6,
+  0x96aaaa9a,
+  0xaaa9a5aa,
+  0xbaeaaab9,
+  0xaaab9aaa,
+  0xaaaaaaea,
+  0x9aaaeaae,
+  0x559a5955,
+  0x569559a6,
+  0x99565959,
+  0x5965a955,
+  0x95995999,
+  0x95559656,
+  0x596a955a,
+  0x59556595,
+  0x9669aa99,
+  0xa966a5a5,
+  0xa95a5aa9,
+  0x69a66669,
+  0x9a6aa699,
+  0xaa6aa9aa,
+  0xa69aaaaa,
+  0xaa99a5aa,
+  0x5aa96595,
+  0xa59a9a99,
+  0xaaa56999,
+  0x6a6a9aaa,
+  0x969a65a5,
+  0x6a699a9a,
+  0x9aa69a6a,
+  0x6aaa9aaa,
+  0x695695a5,
+  0x5956a565,
+  0x996aa955,
+  0x95695699,
+  0xaa9aaaa9,
+  0xaaa69ea5,
+  0x69aaaa6a,
+  0xa96aeaae,
+  0x55565555,
+  0x5555695a,
+  0x56955555,
+  0x55595555,
+  0xaaaaa9a9,
+  0x69aaaaaa,
+  0x6aaa9aaa,
+  0xa9aaaa9a,
+  0x55555555,
+  0x55555555,
+  0x55565555,
+  0x55555555,
+  0x6aaaaa99,
+  0x6669a66a,
+  0x9a69aaa5,
+  0x965a699a,
+  0x55555565,
+  0x55555565,
+  0x55955555,
+  0x55555555,
+  0x65555955,
+  0x556a9596,
+  0x95995596,
+  0x65559a55,
+  0x55555555,
+  0x55555956,
+  0x55555555,
+  0x55555555,
+  0x666599a9,
+  0xa5a5a5a9,
+  0x56566a95,
+  0x65aa69a9,
+  0x555aa555,
+  0x5aa59669,
+  0x696555a9,
+  0xaa5a9999,
+  0x965a6569,
+  0xa996696a,
+  0x66696a95,
+  0x6aa566aa,
+  0x955a6565,
+  0x65556655,
+  0x559559a5,
+  0x55555555,
+  0x69a59a99,
+  0xa56699a9,
+  0x9959a69a,
+  0xaa6aaa56,
+  0x55555555,
+  0x55556955,
+  0x55965555,
+  0x55555955,
+  0xaa6a9699,
+  0xaa659a6a,
+  0x9a9a6aa6,
+  0xaaaa69aa,
+  0xa6aa5955,
+  0x5aaa9a69,
+  0xa66999a5,
+  0x9a69969a,
+  0x555a5555,
+  0x55595555,
+  0x55555556,
+  0x55555555,
+  0xaaebaab9,
+  0xbae9aa9a,
+  0xaaaaaaae,
+  0xaabebaaa,
+  0x55555555,
+  0x55555555,
+  0x5559955a,
+  0x55555555,
+  0xaa6aa6a9,
+  0x9a6aeaaa,
+  0xaa9aa9aa,
+  0xa66aaaaa,
+  0x55555555,
+  0x55556555,
+  0x55565555,
+  0x59555565,
+  0x996a9655,
+  0x5595955a,
+  0x99996599,
+  0x65555566,
+  0xaaabaaa9,
+  0x7aaaebae,
+  0xaaa9aaaa,
+  0xaeaaaaaa,
+  0x55555565,
+  0x55955655,
+  0x55555665,
+  0x55555555,
+  0xa6656955,
+  0xa66a9655,
+  0x5a5a5556,
+  0x66665a55,
+  0xabaaafb9,
+  0xbebeeaba,
+  0xabeeabae,
+  0xeeaafbae,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55596555,
+  0x6996a965,
+  0x69556669,
+  0x6659a69a,
+  0xa96a9596,
+  0x56965a65,
+  0xa9965565,
+  0x6965aa69,
+  0xa5a6599a,
+  0x9aa5a6a9,
+  0x9a69aa9a,
+  0xaaaa6aa6,
+  0xa69a6a9a,
+  0x99956595,
+  0x655565a5,
+  0x55555555,
+  0x56655959,
+  0xa566aaa5,
+  0xaa6a69aa,
+  0xaaaaaaa9,
+  0x9a66aaa6,
+  0x95a95955,
+  0x69699555,
+  0x5959a669,
+  0x599a5556,
+  0x55aa6599,
+  0x669a5569,
+  0x6956559a,
+  0x5695a969,
+  0x99555555,
+  0x95a56555,
+  0x56555569,
+  0x56556959,
+  0xa9659695,
+  0x66aaa96a,
+  0xa5596659,
+  0x9565a6aa,
+  0x6a666569,
+  0x66555a56,
+  0x95996aa5,
+  0x95a65a56,
+  0x55555955,
+  0x55565556,
+  0x65556565,
+  0x5a656556,
+  0x5999aa55,
+  0xa565a965,
+  0xa9956959,
+  0x55a55569,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69959a95,
+  0x69595a56,
+  0xa55a56aa,
+  0x55669a96,
+  0x69595555,
+  0x5959669a,
+  0x9699aaa9,
+  0x69966955,
+  0x69aa9699,
+  0x9a699a9a,
+  0x6a6a969a,
+  0x966aa5a6,
+  0x699a69a9,
+  0xa6969aa9,
+  0xa9aaaaa9,
+  0xa5aa5a59,
+  0x65559959,
+  0x55556655,
+  0x55555556,
+  0x6a9956a5,
+  0x6a9aa9a9,
+  0x66aaaa6a,
+  0xa9aaaa9a,
+  0x59aa9a6a,
+  0x55555555,
+  0x55555555,
+  0xa5555555,
+  0x55555555,
+  0x55565555,
+  0xa5555555,
+  0x55559555,
+  0x55555655,
+  0x56555a55,
+  0xa9965969,
+  0xa5a5a655,
+  0x55696559,
+  0x55566555,
+  0x55595555,
+  0x65555595,
+  0x55555556,
+  0x65656955,
+  0x56a55569,
+  0x55955555,
+  0x55555555,
+  0x5a6aaaa9,
+  0xaa9aa9a6,
+  0xabaa9a6a,
+  0xa6aa9a69,
+  0x96595655,
+  0x59696659,
+  0xaaa6955a,
+  0x9a55a566,
+  0x9aaaaaa5,
+  0x9a96a66a,
+  0xaaaa5aaa,
+  0xa6aaaa6a,
+  0x59669aa9,
+  0x9aaaaaaa,
+  0xaa9aa99a,
+  0xa6aa6aa6,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x55565555,
+  0xa555a599,
+  0xa6a5a6a5,
+  0x9aa5a999,
+  0x69a6aa66,
+  0xa9aaaaa9,
+  0x5aaaaa9a,
+  0x9aa9eaaa,
+  0x9aaaaaab,
+  0x66559569,
+  0x59565a55,
+  0x65956956,
+  0x66565699,
+  0x6a6aa969,
+  0x9aa5a566,
+  0xaaaa9aaa,
+  0x9aaa9a65,
+  0xa5669a59,
+  0x595a9555,
+  0x55655566,
+  0x65665955,
+  0xa66aaaa5,
+  0xa6aaa9a6,
+  0x9aaa5a59,
+  0xaa9aaaa9,
+  0x55555555,
+  0x55555559,
+  0x55555955,
+  0x55556555,
+  0xa66aaaa5,
+  0x6aaaaaa9,
+  0xaaabaaaa,
+  0x6969aaaa,
+  0x55655555,
+  0x96555555,
+  0x55955555,
+  0x55555555,
+  0x66a6a559,
+  0x9555a999,
+  0x56566665,
+  0x65656566,
+  0x95596699,
+  0xaaa5a5aa,
+  0x95aa59a9,
+  0x6596a5a9,
+  0xa95a6699,
+  0x5a996a66,
+  0x59595556,
+  0xa6a66695,
+  0xe6aa6aa9,
+  0x7aa66aba,
+  0xaaebaaaa,
+  0x9aaaa79a,
+  0x55555955,
+  0x55555555,
+  0x5555555a,
+  0x55555555,
+  0x55696955,
+  0x55956555,
+  0x59559959,
+  0xa596a9a6,
+  0x55965559,
+  0x55595555,
+  0x65565669,
+  0x65596565,
+  0x65595a69,
+  0x6aa6aa99,
+  0x5a69aa96,
+  0x96a9aaaa,
+  0x65595955,
+  0x55a66565,
+  0x5a659999,
+  0x656a55a5,
+  0xa5a9a6a9,
+  0xaa6a65a6,
+  0xa656996a,
+  0xa65996aa,
+  0xaa6aa565,
+  0x9a9a9a59,
+  0xaa69999a,
+  0x9a6aa596,
+  0x96569565,
+  0xaaa5a559,
+  0x55959566,
+  0x5556566a,
+  0x9a696595,
+  0x99659a66,
+  0xaa99965a,
+  0x9596a5a6,
+  0xbaaeaeb9,
+  0xaaabaaba,
+  0xbefaaaaa,
+  0xaa69aaaa,
+  0x9999a555,
+  0x5a595599,
+  0xa59a5995,
+  0xa5969a96,
+  0x55655555,
+  0x55555655,
+  0x59555555,
+  0x69555555,
+  0x99569595,
+  0x99555565,
+  0x59a69969,
+  0x6a565559,
+  0xaa56a599,
+  0x999aaa9a,
+  0x5aa9696a,
+  0x965aaa9a,
+  0x56955995,
+  0x66559555,
+  0x55a5a565,
+  0x65566565,
+  0x55a9a559,
+  0xa55aa596,
+  0x999a996a,
+  0x59959a9a,
+  0x55595955,
+  0x55559555,
+  0x55559555,
+  0x55559555,
+  0x9a9966a9,
+  0xaaa95a6a,
+  0x959a99a9,
+  0xa5a69a9a,
+  0x55555665,
+  0x95555955,
+  0x6a556555,
+  0x5a6a5595,
+  0xa5996655,
+  0x55a59a56,
+  0x66556595,
+  0x9665699a,
+  0xaa6aa565,
+  0x66a9699a,
+  0xa959aaaa,
+  0x699a69a5,
+  0x9a569aa9,
+  0x69a69699,
+  0x999a9559,
+  0xa95a6666,
+  0x659aa695,
+  0xa5969a6a,
+  0x5996969a,
+  0x55aa95a6,
+  0x5eaaaaa9,
+  0xaaaaeaaa,
+  0x96aaaaaa,
+  0xea9aaaa6,
+  0xfaebaaa9,
+  0xbaabaeba,
+  0xbaaaaaae,
+  0xaaaaabae,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555556,
+  0x65aa9ab9,
+  0xaaa6aa9a,
+  0x9e69a6aa,
+  0xae5aa996,
+  0x59555555,
+  0x55555555,
+  0x55555555,
+  0x55555565,
+  0x55a55555,
+  0x59555555,
+  0x56555555,
+  0x55555555,
+  0xa9bbaaa9,
+  0xaaabaaba,
+  0xbaaaebaa,
+  0xafaaeaaa,
+  0xa5a9aaa9,
+  0xaaa56aa6,
+  0xaaa99a96,
+  0xa9999a6a,
+  0x66555555,
+  0x55555996,
+  0x5a559a65,
+  0x5559a555,
+  0x969aa9a9,
+  0x9a9655aa,
+  0x9a569aa5,
+  0x6999966a,
+  0x9a9aaa99,
+  0x956995aa,
+  0x6556a6a6,
+  0x665a6999,
+  0x59a65955,
+  0x65a69666,
+  0x6aa9a69a,
+  0x9a69aa99,
+  0xa59559a9,
+  0xa9666995,
+  0x9a9a5aa9,
+  0x55a6a669,
+  0x55566559,
+  0x59555555,
+  0x56559655,
+  0xa6569566,
+  0x65555555,
+  0x55556596,
+  0x55aa5555,
+  0x59555555,
+  0x995aa6a9,
+  0xaaa9a555,
+  0x9a9aa9a6,
+  0xaaaa6959,
+  0x55555555,
+  0x55555556,
+  0x55595555,
+  0x55555555,
+  0xaa9aa655,
+  0xa6a5656a,
+  0xa6959aa6,
+  0x6a96aa6a,
+  0x55565555,
+  0xa666a565,
+  0x565956a5,
+  0x96955559,
+  0xaaaabaa9,
+  0xa996aeaa,
+  0xaaebaaaa,
+  0xaaaaaa9a,
+  0x5a55a699,
+  0x6a666595,
+  0x56a959a5,
+  0x9556aaaa,
+  0x55aaa969,
+  0xaaabaaa9,
+  0xaa66a6aa,
+  0xaaa6aaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69599965,
+  0x5a595699,
+  0x5a659559,
+  0x6a955996,
+  0xab9abaa5,
+  0xaa9aaaba,
+  0xaaebaeaa,
+  0xa9aaa6aa,
+  0x69665a69,
+  0xa569a9a6,
+  0x555969a6,
+  0x9a69596a,
+  0x56966a55,
+  0xa5a69959,
+  0xa9656a9a,
+  0xa9aa55aa,
+  0x65955a59,
+  0xa65a5566,
+  0xa5959556,
+  0x65665955,
+  0x69565555,
+  0x65555565,
+  0x56565595,
+  0x659955a5,
+  0xa959a565,
+  0x959a55a6,
+  0xa56a66a9,
+  0x96996555,
+  0xaa69aaa9,
+  0x6a9969aa,
+  0x9a5a6aaa,
+  0xaa6a9556,
+  0x55555555,
+  0x55555955,
+  0x55595555,
+  0x55555556,
+  0x699a5aa9,
+  0x9aa9a599,
+  0x9a65996a,
+  0x6955a9a9,
+  0xaaa96555,
+  0xaa6a665a,
+  0xaaaa6a95,
+  0xa659699a,
+  0x55666555,
+  0xa5659955,
+  0x56559a65,
+  0x65995555,
+  0x555565a5,
+  0x69555555,
+  0x55595555,
+  0x56995556,
+  0xaa56aa69,
+  0xa9abaa96,
+  0x6a69a6aa,
+  0xa9a9a666,
+  0x6a6aa9a9,
+  0xaa5965aa,
+  0x69665a5a,
+  0x695a6aa9,
+  0x9a695699,
+  0x5a5a9a5a,
+  0xa96966aa,
+  0xa6a9a9a9,
+  0xa6aaaa69,
+  0x56aaa9aa,
+  0x659a595a,
+  0x9566aaaa,
+  0xaa59a669,
+  0x9a5959a9,
+  0xa55966aa,
+  0x9a96aa56,
+  0xaeebaeb9,
+  0xaae9ab9a,
+  0xae6afbea,
+  0xabaae9aa,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0x55555555,
+  0xaa6aaa99,
+  0x9aaaaa9e,
+  0xae5aa9a6,
+  0xeaaaaaab,
+  0xffabaab9,
+  0xa9a6aeaa,
+  0xaeababaa,
+  0xaeaaaaea,
+  0x6569a695,
+  0x95695596,
+  0xa6695956,
+  0x59655a65,
+  0x656aaa69,
+  0xaaa55659,
+  0xa9aa5aaa,
+  0xa99a659a,
+  0x9a696655,
+  0x96656565,
+  0x55595595,
+  0x65555559,
+  0xa9aa6a69,
+  0xaa5aaaaa,
+  0x69aa599a,
+  0xaaaa69aa,
+  0x96965655,
+  0x66955a5a,
+  0x6a95a55a,
+  0x5695655a,
+  0x55a55555,
+  0x96996556,
+  0x66a566a9,
+  0x5696a656,
+  0x559556a5,
+  0x999956a5,
+  0x55659a66,
+  0xa9655665,
+  0x56996a99,
+  0x96aa9aa6,
+  0xaaa6aa69,
+  0x69aaaa95,
+  0x5aaa9a99,
+  0xaaa996a9,
+  0xaa5aaa56,
+  0xaa99aaa6,
+  0xaaaa9a95,
+  0xaaa9a6a6,
+  0xaaa5965a,
+  0x5aa6aaa9,
+  0xa9a5a569,
+  0xa6959aa5,
+  0x96a9a6a6,
+  0xa9aa6a99,
+  0xaa966a65,
+  0x666a659a,
+  0x69a66959,
+  0x69995a9a,
+  0xaa995555,
+  0x99a6aa65,
+  0x655a6aaa,
+  0x695a5a99,
+  0x55a99659,
+  0x59aa9696,
+  0xa559aa96,
+  0x965a6566,
+  0xfaaa9ea9,
+  0xaeebaeae,
+  0xbaeaabee,
+  0xafbaabee,
+  0x55555555,
+  0x5a565a59,
+  0x55596655,
+  0x55955565,
+  0xa995a9a5,
+  0x9a69aaaa,
+  0xa55a96aa,
+  0x99a9a966,
+  0x596a5695,
+  0xa6695569,
+  0x56569a95,
+  0x559a9559,
+  0x6a65aaa9,
+  0x9a6aaaaa,
+  0xaa6a6aaa,
+  0xeb9eaaa5,
+  0xfaeaafb9,
+  0xaaabeebe,
+  0xbabaeaab,
+  0xaaaefbaf,
+  0x9aa9a599,
+  0x96aaaaaa,
+  0xa6a5a969,
+  0x659a9a69,
+  0x95965659,
+  0x99555955,
+  0x5565559a,
+  0x9555665a,
+  0xa65aa555,
+  0xa6565aa6,
+  0x695a99aa,
+  0x6955959a,
+  0x695556a5,
+  0x65695669,
+  0xa9565595,
+  0x95955565,
+  0x9a9aa9a5,
+  0xa9aaa9aa,
+  0x6a66aaaa,
+  0x59a9a6aa,
+  0x56595565,
+  0x55696995,
+  0xa6665665,
+  0x66995995,
+  0xaaaaaea9,
+  0x9e69aaae,
+  0xaaaaaaaa,
+  0xaaaaaaaa,
+  0x669aaaa5,
+  0x9a5999aa,
+  0x6a969a9a,
+  0xa5a6aa99,
+  0x9a6aaaa9,
+  0x5aa9a6aa,
+  0x56aa6aaa,
+  0xabaa6a69,
+  0x55565a55,
+  0x96aaa699,
+  0x5aaa66a9,
+  0x596aa65a,
+  0x55555555,
+  0x95595565,
+  0x55555555,
+  0x65555555,
+  0xa9eaaa59,
+  0xaeaaa66a,
+  0xaabaa6a6,
+  0xaaaaaaea,
+  0x9a55a5a9,
+  0xa59a996a,
+  0x696a99aa,
+  0x6aa6aaaa,
+  0x996596a5,
+  0x696a6656,
+  0xa6a66a9a,
+  0x6996aaa9,
+  0xbaebaab9,
+  0xaeebabaa,
+  0xaab9aaef,
+  0xaaaafaaa,
+  0x56955595,
+  0xa6a55596,
+  0x6a955aa5,
+  0x66965a69,
+  0x65a55569,
+  0x65665566,
+  0x56559695,
+  0xa5969596,
+  0xaaaebea9,
+  0xaaeaafaa,
+  0xaeeaafba,
+  0xbeaabaee,
+  0x55595565,
+  0x99595555,
+  0x55555a69,
+  0x55565556,
+  0x966a9569,
+  0x6aa69a99,
+  0x9aa9a6aa,
+  0xaaa9aa96,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555956,
+  0x5555a555,
+  0x55556555,
+  0xeaafbeb9,
+  0xaafaaaae,
+  0xbefaaabe,
+  0xabbeeaaf,
+  0x596556a5,
+  0x56556555,
+  0x55955a95,
+  0x555a9656,
+  0x55555555,
+  0x55555555,
+  0x59555556,
+  0x56959555,
+  0xa5596595,
+  0x99a96555,
+  0x95555555,
+  0x599655aa,
+  0x96aa5a59,
+  0x9669569a,
+  0xa56a5596,
+  0x699a569a,
+  0xaaaabeb9,
+  0xa9aaaaa9,
+  0x6abbaeaa,
+  0x9eaaaaaa,
+  0xa965aa69,
+  0x6a9a669a,
+  0x96596aaa,
+  0xaaaaaaa5,
+  0x5a565569,
+  0x95a55655,
+  0x55959559,
+  0x56696555,
+  0x56556555,
+  0x55695555,
+  0x55555559,
+  0x55695955,
+  0xa6a56a99,
+  0xaa96565a,
+  0x5565565a,
+  0x669a9956,
+  0xeafeaab9,
+  0xaeabffaa,
+  0xaaafeeae,
+  0xaaaaeaae,
+  0x96655555,
+  0xa5595559,
+  0xa6659556,
+  0x95665595,
+  0xbaea9ea9,
+  0xaae6a69a,
+  0xaaaaea9e,
+  0xaebaaaeb,
+  0xa65a9995,
+  0xa6aaaaa5,
+  0xa9aa9aaa,
+  0x65aa6aa6,
+  0xaa669a69,
+  0x966aa6a9,
+  0x9aaa6966,
+  0x9a9a66aa,
+  0xeaae9eb9,
+  0xaabbafba,
+  0xbeebaaaa,
+  0x9abaebae,
+  0x6566a555,
+  0x5a655959,
+  0x9a95a6a6,
+  0x59966666,
+  0xa9aaaa69,
+  0x66a9aa9a,
+  0xaa6aaa59,
+  0x5e796996,
+  0x9a9aa699,
+  0xa65a6999,
+  0x69aaaa65,
+  0x56666aa9,
+  0xaa6aa6a9,
+  0x9aaaabaa,
+  0xaeaaa9aa,
+  0xaa99baa6,
+  0x55555555,
+  0x55559555,
+  0x59559556,
+  0x55555556,
+  0x59655995,
+  0x5569a555,
+  0x55659695,
+  0x59596556,
+  0x55595555,
+  0x55555555,
+  0x55555555,
+  0x55565555,
+  0x56555a95,
+  0x55556595,
+  0x5599a955,
+  0x959a65a6,
+  0x69aa6a95,
+  0x5a655a9a,
+  0x56556696,
+  0xa65a9a95,
+  0xaaa79aa9,
+  0xaabaaeaa,
+  0xbeaaabae,
+  0xaea9aaaf,
+  0xaa659aa9,
+  0x5aa969a5,
+  0x996aa656,
+  0x69a99655,
+  0x95659965,
+  0x6956a555,
+  0x6695a9a6,
+  0x9595656a,
+  0x59556a95,
+  0x65aa6969,
+  0x69956a55,
+  0x59a59aaa,
+  0xa969a6a9,
+  0xa9a9aba6,
+  0xa6aaaaaa,
+  0xaaaabaeb,
+  0x96a69aa9,
+  0xaaaaae6a,
+  0xaaaaa65a,
+  0xa9a99aaa,
+  0x56a55959,
+  0x559a9a5a,
+  0x5a969955,
+  0x6a665956,
+  0xa9abaaa9,
+  0xaaaaaa9a,
+  0xafaaa7ab,
+  0xaaa96aea,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5a69a595,
+  0xaa66a69a,
+  0x9999a96a,
+  0x966aaa99,
+  0xeaa6aa69,
+  0x69aaaaaa,
+  0xb9aaaa5a,
+  0xaaaaaaaa,
+  0x56a55555,
+  0x55556655,
+  0x95556555,
+  0x69555955,
+  0x5a669aa9,
+  0x5a9a5555,
+  0x6aa59a5a,
+  0xa6a9a99a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa96a699,
+  0x9aaa9566,
+  0xa6aa66a5,
+  0xa6a66996,
+  0xaaa9a9a5,
+  0xaaa56aa9,
+  0xa6699aaa,
+  0x99aaaaa9,
+  0x96aa5699,
+  0xa69aa6a6,
+  0xa69a699a,
+  0x696aaa69,
+  0x7aaaaaa9,
+  0x6a6ae69a,
+  0xaaaaa696,
+  0xaaae6aaa,
+  0x9a666a99,
+  0x5a696665,
+  0x6596aa6a,
+  0xa599965a,
+  0x5a655595,
+  0x56699569,
+  0x9595a555,
+  0x55565556,
+  0x7afaafb9,
+  0xaaabaaaa,
+  0xae6aa69a,
+  0xaaaaeaea,
+  0xaa566995,
+  0x556a5aaa,
+  0xaa59a955,
+  0x595a9aa5,
+  0x59559955,
+  0x55556555,
+  0x95555555,
+  0x5556a555,
+  0x95655a55,
+  0x95a55559,
+  0x55699956,
+  0x56966595,
+  0xa5659559,
+  0x69596696,
+  0xa59a59aa,
+  0xaa95a596,
+  0x65959599,
+  0x959a9a55,
+  0x55559965,
+  0xa6595596,
+  0x55555555,
+  0x56555565,
+  0x55555566,
+  0x65655555,
+  0x65aaa655,
+  0x95a56a96,
+  0x55555a99,
+  0x9555a99a,
+  0xaaaab9e5,
+  0xe9a65aa9,
+  0xb9aa9aa6,
+  0xaaa9aaa9,
+  0xa9a9a669,
+  0x6aa56a65,
+  0xa696a966,
+  0x99aa696a,
+  0xaa6aaa99,
+  0x9a96aaaa,
+  0x69696a66,
+  0x5699aa5a,
+  0x5659a959,
+  0x5555a595,
+  0x59555595,
+  0x55956555,
+  0xaaaaa659,
+  0x9a6a56aa,
+  0x99aaa95a,
+  0x66aa669a,
+  0xaaa96a69,
+  0xa9a6aaaa,
+  0xa9eaae6a,
+  0xaaaaaa9a,
+  0x9aa9aa99,
+  0x99566aa6,
+  0xaa9aa996,
+  0xea9aaaaa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x59956595,
+  0xa665aa59,
+  0x5555555a,
+  0x65555566,
+  0x5a59a699,
+  0x95a6a699,
+  0xa9a5599a,
+  0xaaa996a6,
+  0x59595555,
+  0x55555569,
+  0x59555955,
+  0x55555555,
+  0x55695665,
+  0x59595a65,
+  0x9a6556a6,
+  0x55955565,
+  0x6aa69a65,
+  0xa9aa9aaa,
+  0x5aa6ea6a,
+  0x9eaaa9aa,
+  0x59555595,
+  0x55a56555,
+  0x59955555,
+  0x95655955,
+  0x56655559,
+  0x59655659,
+  0x56596565,
+  0xa5595595,
+  0xa6959a65,
+  0xaa96a5a9,
+  0xa996aa59,
+  0x6a6aa6aa,
+  0xaaaaaaa9,
+  0xa65aaaa6,
+  0xaaaa6aea,
+  0xaaaaaaaa,
+  0x969aaaa9,
+  0xa996966a,
+  0xaaaa9a99,
+  0x5aa9a99a,
+  0xa69aa9a5,
+  0xa6aa69a9,
+  0x69996aa6,
+  0xa995aa69,
+  0xaa6aab99,
+  0x6e69aaaa,
+  0xae6a6ae6,
+  0xaa9aaaa6,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x65a9a6a5,
+  0x965695a6,
+  0x959a6a66,
+  0x55669a55,
+  0x55695955,
+  0x55555565,
+  0x55555555,
+  0x55555555,
+  0x56a95959,
+  0x6a69a96a,
+  0x6a6a6669,
+  0x6556a556,
+  0xaaaaa6a9,
+  0xaaa9aaaa,
+  0xaa9a6aab,
+  0xa6aa66ea,
+  0x55665655,
+  0x655a9565,
+  0x69995555,
+  0x55555a55,
+  0x9569aa95,
+  0xaa66a965,
+  0x56a69aa5,
+  0x69aa9a6a,
+  0x65656595,
+  0x6665559a,
+  0x595a5655,
+  0x556a6aa5,
+  0x55555995,
+  0x55565965,
+  0x655a5966,
+  0x99555569,
+  0x56569665,
+  0x65a5aa9a,
+  0xa55a59a6,
+  0x96566699,
+  0x9aa95a65,
+  0x69aa5665,
+  0xa5aa665a,
+  0x56659aaa,
+  0xaaaaaaa9,
+  0x666a6aaa,
+  0xaaaaaaaa,
+  0x55aaaaaa,
+  0xaaebaaa9,
+  0xaeaaea9a,
+  0xaebaeaae,
+  0xeeaebaab,
+  0x55556595,
+  0x55569966,
+  0x5a655555,
+  0x6a565555,
+  0x5a669695,
+  0x9a956696,
+  0x5a656a96,
+  0x96a9699a,
+  0xf9aaaeb9,
+  0xbaebaebe,
+  0xbaeae6ef,
+  0x9eaeeaae,
+  0xa9aaaa65,
+  0xa699aaa6,
+  0x9aaa6aaa,
+  0xaa6aaa66,
+  0xa5aa9965,
+  0x55a9a66a,
+  0x99569695,
+  0x56aaa595,
+  0x995565a5,
+  0x55a56955,
+  0x59555959,
+  0x99555555,
+  0x65566999,
+  0x6669a9a5,
+  0x66995a59,
+  0x699a95a5,
+  0x95a99aa5,
+  0x66a65a9a,
+  0x69a9a6aa,
+  0x69669aa6,
+  0x69a95695,
+  0x596996a9,
+  0x55595966,
+  0x9995a6a5,
+  0x69565a55,
+  0x56555669,
+  0x96565566,
+  0x55655555,
+  0x95956555,
+  0x65566a66,
+  0xa5a955a6,
+  0x65566999,
+  0xaaa9a6a9,
+  0x9aaa969a,
+  0xa6aaa5a6,
+  0xaa9aa6aa,
+  0x55555555,
+  0x69965559,
+  0x95655655,
+  0x5555555a,
+  0x665aa559,
+  0xa6aaa6a6,
+  0x5aa96695,
+  0xa6666a69,
+  0xa5555555,
+  0x55556555,
+  0x95566565,
+  0x559a5556,
+  0x55955555,
+  0x55555655,
+  0x55555555,
+  0x55595555,
+  0xaaa5a669,
+  0x6a6aa9a6,
+  0x95aa6695,
+  0x959aa966,
+  0xbaabaaa9,
+  0xaaaaaaba,
+  0xbeaaa6aa,
+  0x9a6aaaae,
+  0x59555555,
+  0x59555555,
+  0x55695555,
+  0x59655565,
+  0x66aaa669,
+  0xa9b9a6aa,
+  0xaaaaabaa,
+  0xa69a6aaa,
+  0x559a66a9,
+  0xa9a99aa6,
+  0x65966a6a,
+  0x6a5996a9,
+  0xa969aa99,
+  0xa96a6aaa,
+  0xaaaaa996,
+  0xaa9aa9aa,
+  0xbae6aea9,
+  0xaabbafaa,
+  0xaa6aab9e,
+  0xafbaaa9b,
+  0x996956a9,
+  0x56996a5a,
+  0xa6a95aa6,
+  0x9a966a69,
+  0xbeaba6a9,
+  0xaabaa69a,
+  0xaaaaeaaa,
+  0xa7aaaaea,
+  0x9696a9a9,
+  0x966a665a,
+  0x6559a669,
+  0xa965aa96,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555655,
+  0x55555555,
+  0x55555555,
+  0x65559555,
+  0x65559565,
+  0x55596556,
+  0x55555955,
+  0x56655659,
+  0xebaebae9,
+  0xbaabaaba,
+  0xaefbaabe,
+  0xbaaaaaae,
+  0x9aaa9a59,
+  0xaa6aa99a,
+  0xaaaa659a,
+  0x9aaa9aa9,
+  0xa5595655,
+  0x55995696,
+  0x65a5956a,
+  0xa966a955,
+  0x96aaa595,
+  0xa6aa6aaa,
+  0xa9aa9a6a,
+  0xaaa6aaaa,
+  0x55a996a9,
+  0xa6aa6659,
+  0x9696969a,
+  0x5a59a596,
+  0x9a6aaaa9,
+  0x5aaa5aaa,
+  0xaaa7aeaa,
+  0x9a66aa9e,
+  0x5996a969,
+  0xaa96a659,
+  0xa65665aa,
+  0xa966aa69,
+  0xa95a5a55,
+  0xa656565a,
+  0x9a666669,
+  0x6559a59a,
+  0x6a556555,
+  0x55555555,
+  0x55555965,
+  0x55955955,
+  0xaa69aaa9,
+  0x9aaaaaae,
+  0x9a79a5aa,
+  0xaa9aaaea,
+  0xeaaaaaa9,
+  0xaaaaa96a,
+  0xb9aaaea9,
+  0x5aaaaaaa,
+  0x5966a559,
+  0xa5555555,
+  0x56a65956,
+  0x96969565,
+  0xaaaaaea5,
+  0xa9a9aaaa,
+  0xaaa6aaaa,
+  0x5e79a9a6,
+  0x96aaa955,
+  0xaaa969a9,
+  0xa6a69aa6,
+  0x65965965,
+  0x596a9555,
+  0x9659aa56,
+  0x55659556,
+  0x55956965,
+  0xa5595565,
+  0x55555955,
+  0x59a55556,
+  0x59996555,
+  0x6a95a6a9,
+  0x9969a556,
+  0x5a6aa6a6,
+  0xaa965a69,
+  0x55555a55,
+  0xa5a55555,
+  0x59659659,
+  0x55a56a56,
+  0x55556955,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa7aa6a9,
+  0xaeb9e6aa,
+  0xaeaa6aaa,
+  0x96aabaa7,
+  0xab9eaa65,
+  0xa9abaea6,
+  0xaaaaa79a,
+  0x99aaa6aa,
+  0x59696a65,
+  0xa65aaaa6,
+  0x595a5aa6,
+  0xa9a66a99,
+  0x55a59965,
+  0x69a66aaa,
+  0x9a69a66a,
+  0xa5a6a666,
+  0x669a55a9,
+  0x66556599,
+  0x5556aa66,
+  0x65a55a59,
+  0x5aa9aaa5,
+  0x99aaaa99,
+  0xaaaa69a6,
+  0xa69aaae6,
+  0xaa969965,
+  0xa596aaa6,
+  0xa9aaa699,
+  0x6a5a9a65,
+  0xaab9aaa9,
+  0xaaaa6a96,
+  0xa6aa69a9,
+  0x6a5a9aaa,
+  0x5aa95569,
+  0x596a9a5a,
+  0x59659996,
+  0x996a6a66,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa9aa9a59,
+  0x596aa6a6,
+  0x6a9a66aa,
+  0xaaaaa9aa,
+  0xebabae79,
+  0xbefbaaba,
+  0xbfaaabaa,
+  0xefbafaaf,
+  0x9a69a695,
+  0xaa9aaa5a,
+  0xaa99a5a9,
+  0x695a9aa6,
+  0x66a6aaa9,
+  0x96a6aa9a,
+  0xaa69a6aa,
+  0x96a9aaaa,
+  0x56555555,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x9a6aaa99,
+  0x9a6aa6aa,
+  0x6aa955aa,
+  0x9a9a9999,
+  0xa6aaaaa5,
+  0xaa9aa969,
+  0x695a9a9a,
+  0x5a559aa5,
+  0xaa79a9a9,
+  0x9a9aaaaa,
+  0xaaaabaaa,
+  0x65a6aaaa,
+  0x5a559955,
+  0x56655559,
+  0x99555555,
+  0x55555555,
+  0xa65559a5,
+  0x9555a66a,
+  0x69a5566a,
+  0x6656a565,
+  0x569a6959,
+  0x56a96566,
+  0xa659955a,
+  0xaa659696,
+  0xa5a69965,
+  0x66a65a65,
+  0x6959965a,
+  0x56a596aa,
+  0x59a9aa55,
+  0xa6a9a696,
+  0xaa9aa956,
+  0x6a995aa9,
+  0x55965695,
+  0xa955599a,
+  0x5aa56656,
+  0x95555995,
+  0x956a5595,
+  0xa5a6a556,
+  0x55a55595,
+  0x6696a956,
+  0x55555655,
+  0x56699555,
+  0x56956695,
+  0xa65569a9,
+  0x55559555,
+  0x55595555,
+  0x65556555,
+  0x65559596,
+  0x59556669,
+  0x6a95695a,
+  0x5a66a665,
+  0x65566955,
+  0xaeaaa6a9,
+  0xae6aabaa,
+  0xaaaaeba6,
+  0xa6aaaaaa,
+  0xa5559955,
+  0x95566996,
+  0x69aa6a6a,
+  0xa95a6a99,
+  0xaa66aaa9,
+  0xaebaa99a,
+  0xa6aaaaa6,
+  0xaaaaaa6a,
+  0x559556a5,
+  0x659aa5aa,
+  0x65999a96,
+  0x9a69a655,
+  0xaa596999,
+  0x96a666a6,
+  0x5aa6aaa5,
+  0x9aa669a9,
+  0xaaaba6a9,
+  0xaaa9aaaa,
+  0xaaaaaaea,
+  0xe69aa5e6,
+  0x65555555,
+  0x6aa565a5,
+  0x95aa5956,
+  0x9555599a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xaa9aaa69,
+  0xbaaaafaa,
+  0xaaaaaa9a,
+  0xaa7aa6ae,
+  0xa66aaa95,
+  0xaa6aa595,
+  0xaa965669,
+  0xa9aa996a,
+  0xa6959695,
+  0x59659559,
+  0x6665a5a6,
+  0x96a95556,
+  0x59995695,
+  0x565aa559,
+  0x55569565,
+  0x69695656,
+  0x5a555559,
+  0x5955955a,
+  0x96595555,
+  0x5596559a,
+  0xaaabeaa9,
+  0xaabbafaa,
+  0xae6aaaaf,
+  0xaebaabab,
+  0x55a55655,
+  0x95a56555,
+  0x95556955,
+  0x56655965,
+  0x6aa5a655,
+  0x55a9a669,
+  0x56699559,
+  0x55569a95,
+  0x95555955,
+  0x55555955,
+  0x55555555,
+  0x595a9559,
+  0x95655565,
+  0x55655565,
+  0x95555555,
+  0x5a655556,
+  0xa9966a65,
+  0xaa96aaa5,
+  0x99a95a59,
+  0x5a6aa699,
+  0x9a996aa5,
+  0x9a6aa69a,
+  0xa5a6aaa5,
+  0xa9566559,
+  0x656a9a95,
+  0xaaaaa6a9,
+  0x9aa66a66,
+  0xaa6a6aa6,
+  0xa6aaaaa9,
+  0x6aaa9a6a,
+  0x65aaaaa9,
+  0x9aa9aa9a,
+  0x55559555,
+  0x59555555,
+  0x65555559,
+  0x55555555,
+  0x69566969,
+  0x65569659,
+  0xa5566555,
+  0x65959955,
+  0x59655565,
+  0x55595555,
+  0x55555595,
+  0x55555695,
+  0xaaa59a65,
+  0xa6aaaaaa,
+  0x6aaaaaa6,
+  0xa6aaa5aa,
+  0x555a5955,
+  0x55555555,
+  0x55555555,
+  0x55599655,
+  0x5aa99aa5,
+  0xa596aaaa,
+  0x969969aa,
+  0xa596596a,
+  0x59655965,
+  0x65556655,
+  0x6669566a,
+  0x56aa66a5,
+  0x665a5995,
+  0x56a9a559,
+  0xa56a5956,
+  0x5656559a,
+  0x99965a55,
+  0x9a65a65a,
+  0x65969665,
+  0x6a5aa569,
+  0xa6555555,
+  0x59665655,
+  0x65559655,
+  0x55556595,
+  0xa5a69a95,
+  0xa9a5556a,
+  0x596665aa,
+  0xa55659a9,
+  0xbaabaab9,
+  0xbaaaa6ae,
+  0xaa79fbaa,
+  0xaa6aaaaa,
+  0x599955a9,
+  0xa56a696a,
+  0x665aaaaa,
+  0x5a6a5a9a,
+  0x55a69599,
+  0x9a69aaa9,
+  0x56995959,
+  0xa6a69555,
+  0xebaaaab9,
+  0xbaabaaaa,
+  0xaafbaaaa,
+  0xaaaaebea,
+  0x5aa6a599,
+  0x6a656659,
+  0xaa9966a5,
+  0x96a69aaa,
+  0xa99baaa9,
+  0xaaa9aaaa,
+  0xaaa9eaaa,
+  0xaabaa9aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69aaaa99,
+  0x6aa6a6aa,
+  0xaa9a69e6,
+  0xaa9a6aa6,
+  0x6aaa6665,
+  0x6a659a55,
+  0x6aa9959a,
+  0x956666a9,
+  0x65695655,
+  0x56555559,
+  0x556965a5,
+  0x56555955,
+  0xaaaaaea9,
+  0xaab9ebae,
+  0xaeaaebae,
+  0xaa9ebaeb,
+  0x66a965a5,
+  0x9a95696a,
+  0x566aa6a9,
+  0xa9aa6a59,
+  0x55659999,
+  0xa6655669,
+  0x9a595556,
+  0x96596a56,
+  0x65965665,
+  0x55569555,
+  0x95555559,
+  0x65555a59,
+  0xaaa969a5,
+  0x5aaaa996,
+  0xa6aaaa55,
+  0x6999aaaa,
+  0x5596aa55,
+  0x699a5959,
+  0xa95aaa99,
+  0x99a9956a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55565565,
+  0x55555555,
+  0x995559a5,
+  0x6656a6a6,
+  0x65659965,
+  0x56665655,
+  0x5a6a6aa5,
+  0xaaa9baaa,
+  0xaaaa9aa9,
+  0xa9aaaaaa,
+  0x6aaaaaa9,
+  0x9a6aa7aa,
+  0xaa6aeaaf,
+  0x9a5aaaaa,
+  0x55555695,
+  0x95556a59,
+  0x65995559,
+  0x5555a556,
+  0x59a9a669,
+  0x9a6aaa95,
+  0xaa9a699a,
+  0xa5aaa9a9,
+  0x55995555,
+  0x99555565,
+  0x59559595,
+  0x55a955a9,
+  0xaa9aaa55,
+  0x6aaaaa9a,
+  0x66aa9aaa,
+  0xa6aa9aaa,
+  0xbaaba7a9,
+  0x9eaaaa9a,
+  0xaa6aebaa,
+  0xe66aa9a6,
+  0x5aa96aa5,
+  0x99a5565a,
+  0x665656aa,
+  0x6aaaaa6a,
+  0x6aa9aa69,
+  0xaaa9a59a,
+  0xaa9aaaaa,
+  0x9a6aaa6a,
+  0x595965a5,
+  0x555a5595,
+  0x55569655,
+  0x55556666,
+  0x5aaaa9a9,
+  0xa5596a99,
+  0xa5aa5aa5,
+  0x999a6aa9,
+  0x55599655,
+  0x69555956,
+  0x65a95595,
+  0x99695995,
+  0xabaebae9,
+  0xe9aa9eaa,
+  0xbaabaeba,
+  0xaaa6eb9e,
+  0xa5555595,
+  0x55555556,
+  0x55555555,
+  0x55556955,
+  0x55555555,
+  0x56569559,
+  0x55555559,
+  0x56565555,
+  0x559a59a5,
+  0xa6aa6696,
+  0xa6a66aa9,
+  0xa669aa69,
+  0xa5555555,
+  0x55555559,
+  0x55559555,
+  0x55555655,
+  0x9a99a9a5,
+  0xaa956a9a,
+  0x9956aaaa,
+  0xaa69a659,
+  0xaaa5aaa9,
+  0x9aaa66aa,
+  0x9aa9aaa6,
+  0xaaaa9a6a,
+  0x66965595,
+  0x56555665,
+  0x55556669,
+  0x59a5a565,
+  0xa56aaa55,
+  0x66a9a9a6,
+  0xa99a9669,
+  0x669a96aa,
+  0xaab9a6a9,
+  0xaaaaa6aa,
+  0x9e6aaaaa,
+  0xaa9aa9ea,
+  0x96aa6a59,
+  0x659a59a9,
+  0xaaaaa569,
+  0xaa599a9a,
+  0x56665955,
+  0x9a9a5955,
+  0x55a55659,
+  0x66959555,
+  0x6a9699a5,
+  0x696a6a59,
+  0xaa6655a9,
+  0x56699a9a,
+  0x55695555,
+  0x5a55a955,
+  0x56655669,
+  0x5966955a,
+  0x55555655,
+  0x65655695,
+  0x55555655,
+  0x55956595,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5a695aa9,
+  0x55595596,
+  0x5596699a,
+  0xa55a6a55,
+  0x56aaaa69,
+  0xa5a6aa99,
+  0x9a69aa9a,
+  0x9aaaaaaa,
+  0xaa6aa6a9,
+  0xaaaaa9a9,
+  0xa9a69a66,
+  0x69aa6a66,
+  0x55556555,
+  0x55595659,
+  0x55955555,
+  0x55595555,
+  0xabaa9a65,
+  0x69aaae6a,
+  0x69e6aaaa,
+  0xaa6aaaae,
+  0x55556555,
+  0x55556655,
+  0x56555565,
+  0x95555555,
+  0x99a55995,
+  0x6a655555,
+  0x9a69a565,
+  0x55696a99,
+  0x65556955,
+  0x566a9955,
+  0x59a5655a,
+  0xa696a66a,
+  0x6966aaa9,
+  0x59a5969a,
+  0xaaaa9a96,
+  0xa6aaa956,
+  0x955a5955,
+  0xaa5955a5,
+  0x56a566a5,
+  0xa956565a,
+  0x69959655,
+  0x69699655,
+  0x965a59a5,
+  0xaa56a95a,
+  0x55555555,
+  0x55555565,
+  0x55555555,
+  0x55655655,
+  0x56695595,
+  0xa5996999,
+  0x5599556a,
+  0x65569a56,
+  0x99a95559,
+  0x5a65a696,
+  0x59569599,
+  0x555996a5,
+  0x55955555,
+  0x5655555a,
+  0x56965555,
+  0x55559555,
+  0x6aa65a65,
+  0xa65a5595,
+  0xa5996695,
+  0x96a65569,
+  0x55556a55,
+  0x6655555a,
+  0x59655659,
+  0x656596a5,
+  0x95555555,
+  0x65555555,
+  0x65555555,
+  0x55555a55,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0xa6aa5a79,
+  0xaaaaa96a,
+  0xbaaaa69a,
+  0xaaaaaaae,
+  0x95959565,
+  0x55555966,
+  0x56556555,
+  0x55555959,
+  0x65a65995,
+  0x65a59a96,
+  0xa96569a5,
+  0xa695a955,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x9a65aaa9,
+  0xa565995a,
+  0x56956966,
+  0x96969965,
+  0x56555595,
+  0x55555555,
+  0x55559555,
+  0x55556555,
+  0x55559555,
+  0x55555555,
+  0x56959956,
+  0x69555565,
+  0x55555595,
+  0x55655555,
+  0x55555555,
+  0x55655556,
+  0xaaaa59a9,
+  0xa55a9555,
+  0x6aa699a5,
+  0x556665a5,
+  0x9a5595a9,
+  0xaa556559,
+  0x9659a995,
+  0x555a556a,
+  0x96655a65,
+  0xa5a9a969,
+  0xa59595a6,
+  0x555556a9,
+  0x95956595,
+  0x5555559a,
+  0x96aa9555,
+  0x55555959,
+  0x69a6aa99,
+  0xa966a69a,
+  0xa965aaaa,
+  0xaa9a56aa,
+  0x55555a95,
+  0x55565565,
+  0x55a56555,
+  0x5555aa55,
+  0x596a5995,
+  0x56556555,
+  0x56559996,
+  0x55556995,
+  0xa6aaa9a9,
+  0xa9a69a69,
+  0x6a96a6aa,
+  0x966aaaaa,
+  0x95565565,
+  0xa6555aa6,
+  0x5a595955,
+  0x66959a5a,
+  0x65a55959,
+  0x999a5559,
+  0x5a696555,
+  0x96696556,
+  0x56556965,
+  0x55995955,
+  0x65a55959,
+  0x55555555,
+  0x699a9a95,
+  0x59a9996a,
+  0xa6a966aa,
+  0xaa96a959,
+  0xbeabaab9,
+  0xbaebaeba,
+  0xaabaa6aa,
+  0xeaaaabea,
+  0x669556a5,
+  0x56a9a9aa,
+  0x9aa66569,
+  0xaa9aaa96,
+  0xaaabaaa9,
+  0xaa6aaaaa,
+  0xaaa9aaaa,
+  0x97aea9a6,
+  0x55555555,
+  0x65955555,
+  0x55555959,
+  0x955a9565,
+  0xaaa99a99,
+  0x9aaa66a6,
+  0x9a9aaaa6,
+  0xa6aaaa6a,
+  0xaaa6aea9,
+  0x6aaaaa9e,
+  0xaaaaaaae,
+  0xaaaaeaaa,
+  0x56595555,
+  0x55555555,
+  0x56555955,
+  0x55555555,
+  0xaaaaa699,
+  0x9669aa9a,
+  0xaaaaaa9a,
+  0xa66aaa96,
+  0xbbeabee9,
+  0xbaebeaba,
+  0xbaebbfbe,
+  0xffbeabee,
+  0x95aaaaa9,
+  0x9aaa6aa6,
+  0xaaa96a9a,
+  0xaa696a96,
+  0x55555595,
+  0x95555555,
+  0x59555555,
+  0x55959655,
+  0x9a6aa6a9,
+  0x9aaaa9aa,
+  0x99aa95a9,
+  0x695a5aa9,
+  0x69a6aa99,
+  0xa66aaa99,
+  0xaa69a9a6,
+  0x5a6aaaaa,
+  0xe6eebeb9,
+  0xaaab9abe,
+  0xbaebaebe,
+  0xaa7aaaae,
+  0x59695659,
+  0xaa599599,
+  0x99555956,
+  0x65a55659,
+  0x69555555,
+  0x55556555,
+  0x55555555,
+  0x59559955,
+  0xa65aa599,
+  0x6a99a6aa,
+  0xa6a6aa65,
+  0x6aaa59a6,
+  0xbaa9aaa9,
+  0x9aaa9aaa,
+  0xaaaaa9aa,
+  0x96a9a9a6,
+  0xabaabaa9,
+  0xaafaaaba,
+  0xbaab9eae,
+  0xaa6aaaae,
+  0x9a66aa99,
+  0xa959a669,
+  0xa56965aa,
+  0x66aa5669,
+  0x69a6aaa5,
+  0x699a9669,
+  0x96a9a6aa,
+  0xa969a955,
+  0x55555565,
+  0x55956595,
+  0x55565695,
+  0x555a595a,
+  0x9596aa59,
+  0x5599aa55,
+  0x5a565a96,
+  0x569a6596,
+  0xbbfeabb9,
+  0xaaabaaba,
+  0xbafbffef,
+  0xaeaabbaf,
+  0xa6699aa5,
+  0xa569aaaa,
+  0x665a69aa,
+  0xaa9a69a9,
+  0x59965aa9,
+  0x99999655,
+  0xa96a9aa9,
+  0x5aa59969,
+  0x95555555,
+  0x99695559,
+  0x65a59559,
+  0x6aaa5965,
+  0x7aaaaa69,
+  0xaabaaaaa,
+  0xaaaaaaaa,
+  0xabaaaaaa,
+  0xabaeaa69,
+  0xa9faaaba,
+  0x6efaaaaa,
+  0x9aaaaaaa,
+  0x55595555,
+  0x55595556,
+  0x55565559,
+  0x99555655,
+  0xa9a6aaa9,
+  0x69aaa6a9,
+  0xa9aaaaaa,
+  0x9aaaa59a,
+  0x55596655,
+  0x5669556a,
+  0x9565956a,
+  0x55555555,
+  0xaa65aa55,
+  0x6a9aa65a,
+  0xaa5aaa95,
+  0x66aa6a96,
+  0xa6a56a69,
+  0xa9aa6a65,
+  0x6aaaa65a,
+  0x996aaaa9,
+  0x59955555,
+  0x55a95569,
+  0x99996555,
+  0x55669565,
+  0xaaabaaa9,
+  0xa9aa96aa,
+  0xaa6a96aa,
+  0xaa7a69aa,
+  0x55555555,
+  0x55595556,
+  0x99555566,
+  0x595a5555,
+  0x65a5aaa9,
+  0x9aa9a66a,
+  0xa6aaa9aa,
+  0xa6aaaaab,
+  0x55595655,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x5a655655,
+  0x65595565,
+  0x665aa56a,
+  0x5a559655,
+  0x55569a65,
+  0x69996696,
+  0x5a669995,
+  0x99566596,
+  0x69559655,
+  0x55555955,
+  0x55655599,
+  0x55555556,
+  0x55655565,
+  0x69556995,
+  0x5555559a,
+  0x56a56966,
+  0xa9aa5ab9,
+  0xaaaaaaa9,
+  0xaaa5ab9a,
+  0xaa6aaaaa,
+  0x56a95955,
+  0x6665aaa9,
+  0x55a56569,
+  0x95955559,
+  0x99a66a55,
+  0xa5a95666,
+  0x9a6a5699,
+  0x5999aa66,
+  0x55955569,
+  0x65565965,
+  0x5555a555,
+  0x5a599555,
+  0x55555555,
+  0x55555955,
+  0x55555555,
+  0x55555555,
+  0x99a695a5,
+  0x6aa6aaaa,
+  0xaaa65aaa,
+  0x69a9aa59,
+  0x55555655,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x6ae79ea9,
+  0xaaa9eaaa,
+  0xaa6ae6ae,
+  0xaaaaa9a6,
+  0x96595955,
+  0xa5569565,
+  0x65565696,
+  0x65965659,
+  0xaaa69599,
+  0x9a66a665,
+  0xa659a9aa,
+  0x6a66a5a9,
+  0x696a9965,
+  0x55559a59,
+  0xa659a66a,
+  0x5aa596a6,
+  0x55555555,
+  0x65955959,
+  0x5995556a,
+  0x69a956a9,
+  0x65aaaa55,
+  0xa659a66a,
+  0x6965a69a,
+  0x995665a6,
+  0x96556a55,
+  0xa55aa555,
+  0x55559a65,
+  0x65559565,
+  0x6595a555,
+  0x55655595,
+  0x559a5565,
+  0x56a65596,
+  0xbae6aaa9,
+  0xa9a79aaa,
+  0xaaa9aa9a,
+  0xaaaaaaaf,
+  0x669955a5,
+  0x55556556,
+  0x96565566,
+  0x69555955,
+  0xa666a695,
+  0x6a65a66a,
+  0xaa9596a9,
+  0x565a6696,
+  0x969aa6a5,
+  0xa5a59556,
+  0xaaa66a66,
+  0xaaa96aa9,
+  0x9a6aaaa9,
+  0x5969a5aa,
+  0x9aaa6aa9,
+  0xaa9aaaaa,
+  0x66966969,
+  0xaaaa9aaa,
+  0x9aa9aa9a,
+  0x9aa9eaaa,
+  0x5a66a695,
+  0xaa5a59aa,
+  0xaa96a956,
+  0x59a5aa69,
+  0xaafaaaa9,
+  0x9aaaaaaa,
+  0xaaaaa9a6,
+  0xaa5aaaaa,
+  0xaaaaaaa9,
+  0xa9ebea6a,
+  0xaaabaeba,
+  0xbeaaaaaa,
+  0x56966955,
+  0x66aa5595,
+  0x599669a6,
+  0x5699966a,
+  0xaaaaaeb9,
+  0xaaebaeaa,
+  0xaa6aea9a,
+  0xaaaaeaaa,
+  0x95965565,
+  0xa65a696a,
+  0xa6aa596a,
+  0x696659a5,
+  0x6559aaa9,
+  0xa9a9aa99,
+  0x596a99aa,
+  0xa56aa996,
+  0x55556555,
+  0x55555655,
+  0x55555556,
+  0x55555959,
+  0x555596a5,
+  0x66955555,
+  0x9556a669,
+  0x655a9555,
+  0xbaeaaaa9,
+  0xaaebabaa,
+  0xaaaafbaa,
+  0xaabaeaaa,
+  0xa59aa599,
+  0x6665a56a,
+  0xa996a659,
+  0x6996a96a,
+  0x6afaaba9,
+  0xaabaebae,
+  0xaeaa6aaa,
+  0xeaaaa9aa,
+  0xaaaaa969,
+  0x6aa669aa,
+  0xa6969a59,
+  0xaa6aaa9a,
+  0xaa6aa659,
+  0xaaaaaaaa,
+  0xaaaaaaaa,
+  0xabaa9aaa,
+  0x5aaaaa55,
+  0xaaa696a9,
+  0xa69696a9,
+  0x69aa65a6,
+  0x6665a665,
+  0x59556565,
+  0x95666565,
+  0x5556a655,
+  0x596995a9,
+  0x6aa96699,
+  0xa9a66596,
+  0x659a699a,
+  0x95a95595,
+  0x5aa5555a,
+  0x5566aaaa,
+  0x696556a5,
+  0x59555655,
+  0x55559555,
+  0x56996556,
+  0x95555565,
+  0x65669a65,
+  0x6a99a656,
+  0xaa6666aa,
+  0x59aaa9aa,
+  0x59955995,
+  0x95595559,
+  0x556a9aa5,
+  0x6a555966,
+  0x6aaa9699,
+  0xa596a666,
+  0x559a99a6,
+  0xaaaa5665,
+  0xa9595a65,
+  0xa966996a,
+  0x6955a956,
+  0xa6a59a6a,
+  0xa6aa6aa5,
+  0x6a955596,
+  0x5aaa6699,
+  0xa696a969,
+  0x56555555,
+  0x55556555,
+  0x55555559,
+  0x55555555,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x95a55695,
+  0x5956666a,
+  0xa5565556,
+  0xa56596aa,
+  0xe6a6aea5,
+  0xa9aaaabe,
+  0xbaa6eaaa,
+  0x6aaaabab,
+  0x56599a65,
+  0x95559555,
+  0x55555595,
+  0x95955559,
+  0x5aa99a59,
+  0xa9a9669a,
+  0x6aa6a6a9,
+  0x96aaa5aa,
+  0x55555555,
+  0x59955555,
+  0x99555655,
+  0x55555599,
+  0x55555655,
+  0x5655955a,
+  0x59555555,
+  0x55559696,
+  0x65555555,
+  0x55555559,
+  0x56665665,
+  0x55559655,
+  0x95555555,
+  0x555a5559,
+  0x95555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555559,
+  0xa5956a65,
+  0x65555555,
+  0x5a565559,
+  0xaa699659,
+  0xa95aaaaa,
+  0x5aa56a55,
+  0xaa599995,
+  0x55555555,
+  0x55555555,
+  0x55556955,
+  0x55555555,
+  0x55555669,
+  0x55595556,
+  0x59555555,
+  0x55555566,
+  0x69a65665,
+  0x559566a5,
+  0x69556655,
+  0x59699966,
+  0x96a55995,
+  0x5a6566a5,
+  0xa6659aa9,
+  0x6595aa65,
+  0x99655599,
+  0x596a9656,
+  0x966aaaa6,
+  0xaa6aa9a9,
+  0x9a955965,
+  0x66a66955,
+  0x99569659,
+  0x9995556a,
+  0x55555655,
+  0x966a6665,
+  0x96a65555,
+  0x56559965,
+  0x55565565,
+  0x95555555,
+  0x55655556,
+  0x95555555,
+  0x665a6aa9,
+  0x6a55a969,
+  0x656a6965,
+  0x599aa6a6,
+  0xaa599599,
+  0x5a66a66a,
+  0x96a96a5a,
+  0xa559666a,
+  0x55555555,
+  0x55695569,
+  0x55555555,
+  0x55559555,
+  0xaa596a55,
+  0x9665a565,
+  0x96955556,
+  0x6999965a,
+  0xa9a69ea9,
+  0x9a66a6aa,
+  0x9a69aa6a,
+  0xaa6a65aa,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x9a6aea99,
+  0xaaa9e696,
+  0xaaa96aea,
+  0xaaaabaaa,
+  0x55595aa5,
+  0x55956656,
+  0x69696655,
+  0x55665a9a,
+  0xaa956999,
+  0x6669a6a9,
+  0x969a96a9,
+  0x6aaa996a,
+  0xaaa69659,
+  0x956aa95a,
+  0x6aaaaa96,
+  0xa696a969,
+  0xaaaeaaa9,
+  0xa6a6aaaa,
+  0x69aaaaaa,
+  0x6aeaa6a9,
+  0xa9a99a69,
+  0x6aa65aa6,
+  0xa5556aa9,
+  0x6a6a6969,
+  0xaaeaaaa9,
+  0xaabaafae,
+  0xaebaaaae,
+  0xeaaeaaeb,
+  0xa9a696a5,
+  0x966965a6,
+  0x969665aa,
+  0xa9a96aa9,
+  0x55aa5aa5,
+  0x9965a6a9,
+  0xa9aa666a,
+  0x5a5a6996,
+  0xeaaebef9,
+  0xeaabafba,
+  0xbafbafba,
+  0xbebaebee,
+  0x6a65a6a9,
+  0x9966596a,
+  0x56aa99a6,
+  0x9aa95aa5,
+  0xa9995a59,
+  0x6a66669a,
+  0x5a695666,
+  0x59a66a56,
+  0x569a5695,
+  0xa6a96a96,
+  0xa6aa6569,
+  0x9aaaa66a,
+  0x65a99565,
+  0x59656559,
+  0x56696596,
+  0x56596a95,
+  0xa69aaa55,
+  0xa9aa5699,
+  0xa99aaa66,
+  0xaaaa5aaa,
+  0x556a9655,
+  0x99665556,
+  0x596a565a,
+  0xa9a655a5,
+  0x96955959,
+  0x6555565a,
+  0x59595555,
+  0x56656a55,
+  0x00000005,
+};
+
+#define teju_calculation_sorted 0u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000000001), teju_literal4(0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff, 0xffffffffffffffff) }, // 0
+  { teju_literal4(0xcccccccccccccccc, 0xcccccccccccccccc, 0xcccccccccccccccc, 0xcccccccccccccccd), teju_literal4(0x3333333333333333, 0x3333333333333333, 0x3333333333333333, 0x3333333333333333) }, // 1
+  { teju_literal4(0x5c28f5c28f5c28f5, 0xc28f5c28f5c28f5c, 0x28f5c28f5c28f5c2, 0x8f5c28f5c28f5c29), teju_literal4(0x0a3d70a3d70a3d70, 0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a3, 0xd70a3d70a3d70a3d) }, // 2
+  { teju_literal4(0xac083126e978d4fd, 0xf3b645a1cac08312, 0x6e978d4fdf3b645a, 0x1cac083126e978d5), teju_literal4(0x020c49ba5e353f7c, 0xed916872b020c49b, 0xa5e353f7ced91687, 0x2b020c49ba5e353f) }, // 3
+  { teju_literal4(0xbc01a36e2eb1c432, 0xca57a786c226809d, 0x495182a9930be0de, 0xd288ce703afb7e91), teju_literal4(0x0068db8bac710cb2, 0x95e9e1b089a02752, 0x5460aa64c2f837b4, 0xa2339c0ebedfa43f) }, // 4
+  { teju_literal4(0x58cd20afa2f05a70, 0x8ede54b48d3ae685, 0xdb76b3bb83cf2cf9, 0x5d4e8fb00bcbe61d), teju_literal4(0x0014f8b588e368f0, 0x8461f9f01b866e43, 0xaa79bbadc0980b24, 0x2070b8cfbfc6540c) }, // 5
+  { teju_literal4(0xde8f6cefed634549, 0xb62c77574f722e1a, 0xc57e23f24d8fd5cb, 0x790fb65668c26139), teju_literal4(0x000431bde82d7b63, 0x4dad31fcd24e160d, 0x887ebf22c01e68a0, 0xd349be8ff327aa68) }, // 6
+  { teju_literal4(0x5fb648fcc913daa8, 0x57a27e44a97d3c6b, 0xc1193a63a91cc45b, 0xe5032477ae8d46a5), teju_literal4(0x0000d6bf94d5e57a, 0x42bc3d3290760469, 0x1b4c8ca08cd2e1b9, 0xc3db8c8330a1887b) }, // 7
+  { teju_literal4(0xacbe0e98f503f888, 0x1186e60dbb7f727b, 0xf36b7213ee9f5a78, 0xc767074b22e90e21), teju_literal4(0x00002af31dc46118, 0x73bf3f70834acdae, 0x9f0f4f534f5d6058, 0x5a5f1c1a3ced1b4b) }, // 8
+  { teju_literal4(0x88f2cfb83100cb4e, 0x69e7c79c58b316e5, 0x97157d372fb9787e, 0x8e47ce423a2e9c6d), teju_literal4(0x0000089705f4136b, 0x4a59731680a88f89, 0x53030fdd7645e011, 0xabac9f387295d242) }, // 9
+  { teju_literal4(0xb4fd5cbe70335bdc, 0x7b94c185ab570494, 0x516ab2a4a3251819, 0x4fa7f60d3ed61f49), teju_literal4(0x000001b7cdfd9d7b, 0xdbab7d6ae6881cb5, 0x109a365f7e0df99d, 0x2255b971b0845d40) }, // 10
+  { teju_literal4(0x5765df5949a3df2c, 0x18b759e788ab00ea, 0x76aef08753d43805, 0x0fee64690c913975), teju_literal4(0x00000057f5ff85e5, 0x92557f7bc7b4d28a, 0x9ceba4797f9c651f, 0x6d445849f01a790c) }, // 11
+  { teju_literal4(0x77e12cab7520c63c, 0x04f1786181bbccfb, 0xb156301b10c40b34, 0x3662e0e1cf503eb1), teju_literal4(0x000000119799812d, 0xea11197f27f0f6e8, 0x85c8ba7eb31f476c, 0xaf7411a863387e9c) }, // 12
+  { teju_literal4(0x4b2d08ef176cf472, 0x67637e79e6bf28ff, 0x2377a3389cf4023d, 0xa47a2cf9f6433fbd), teju_literal4(0x0000000384b84d09, 0x2ed0384ca19697c8, 0x1ac1bee623d30e48, 0xefe4038813d81952) }, // 13
+  { teju_literal4(0xdbd5ce9637e2974a, 0x14ad7fb1faf30833, 0x0717ed71b8fd9a0c, 0x54186f653140a659), teju_literal4(0x00000000b424dc35, 0x095cd80f538484c1, 0x9ef38c946d909c74, 0xfcc733e803f80510) }, // 14
+  { teju_literal4(0x5f2ac2ead7fa1e42, 0x0422b323989701a3, 0xce37fc49f1cc5202, 0x7738164770402145), teju_literal4(0x0000000024075f3d, 0xceac2b3643e74dc0, 0x52fd828415e9b8e4, 0x328e3d94cd980103) }, // 15
+  { teju_literal4(0xdfd55a2ef7fed2da, 0x00d3bd6d84eb0053, 0xf60b3275305c1066, 0xe4a4d1417cd9a041), teju_literal4(0x000000000734aca5, 0xf6226f0ada6175f3, 0x43cc4d4d9dfb8b60, 0xd6e93f84291e669a) }, // 16
+  { teju_literal4(0x5ff7786fcb32f6f8, 0x6690bf7c4dc899aa, 0x6468a3b109ac0347, 0xc75429d9e5c5200d), teju_literal4(0x000000000170ef54, 0x646d496892137dfd, 0x73f5a90f85ff1be0, 0x2afb731a6e9fae1e) }, // 17
+  { teju_literal4(0xaccb18165bd6fe31, 0xae1cf318dc5b51ee, 0xe0e1ba569b88cd74, 0xc1773b91fac10669), teju_literal4(0x000000000049c977, 0x47490eae839d7f99, 0x173121cfe7996bf9, 0xa2324a387c865606) }, // 18
+  { teju_literal4(0xef5bd19e125e32d6, 0xbc6c309e9278a9fc, 0x93605877b8b4f5e4, 0x26b172506559ce15), teju_literal4(0x00000000000ec1e4, 0xa7db69561a52b31e, 0x9e3d06c32e51e265, 0x2070753e7f4e1134) }, // 19
+  { teju_literal4(0x2fdf29ec6a12d6f7, 0xbf48d6861d4b5532, 0x83e011b18b576460, 0xd489e3a9addec2d1), teju_literal4(0x000000000002f394, 0x219248446baa23d2, 0xec729af3d610607a, 0xa0167dd94ca936a4) }, // 20
+  { teju_literal4(0xd65fd52f486a2afe, 0x5974f7b46c42443d, 0x4d9336bd1bde4746, 0x90e860bb892c8d5d), teju_literal4(0x000000000000971d, 0xa05074da7beed3f6, 0xfc16ebca5e03467e, 0xecd14c5ea8eea487) }, // 21
+  { teju_literal4(0x5e132aa30e7ba232, 0xdeb0fe5748da0da5, 0xdc50a48c38c60e41, 0x502e79bf1b6f4f79), teju_literal4(0x0000000000001e39, 0x2010175ee5962a64, 0x98d1625bac670e19, 0x6290427954fc874e) }, // 22
+  { teju_literal4(0xac6a3bba3618ba0a, 0x2c89cc77db5ecf87, 0x9276874f3e8e02d9, 0xdcd618596be30fe5), teju_literal4(0x000000000000060b, 0x6cd004ac94513bad, 0xb829e078bc149c6b, 0x7a1cda1844328176) }, // 23
+  { teju_literal4(0xbc153f253e04f202, 0x08e85c17f8ac8fe7, 0xea17b4a972e933c5, 0x2c2ad1ab7bfa3661), teju_literal4(0x0000000000000135, 0x7c299a88ea76a589, 0x24d52ce4f26a85af, 0x186c2b9e740a19e4) }, // 24
+  { teju_literal4(0x58d10ca10c67639a, 0x01c8126b31bc1cc7, 0xfb9e575516fb70c1, 0x08d55d224bfed7ad), teju_literal4(0x000000000000003d, 0xe5a1ebb4fbb1544e, 0xa0f76f60fd488123, 0x04e26f1fb0ced1fa) }, // 25
+  { teju_literal4(0xab5d02869c14ad85, 0x338e6a157058d28e, 0x658611776aff168d, 0x01c445d3a8cc9189), teju_literal4(0x000000000000000c, 0x612062576589dda9, 0x5364afe032a819d3, 0xcdc6e306568fc398) }, // 26
+  { teju_literal4(0x2245cd4e1f3755e7, 0x70b615377cde9082, 0xe11ad04b156637b5, 0xcd27412a54f5b6b5), teju_literal4(0x0000000000000002, 0x79d346de4781f921, 0xdd7a89933d54d1f7, 0x2927c7014483271e) }, // 27
+  { teju_literal4(0x3a0df5dc6ca4aac7, 0xe3579dd7e5c61ce6, 0xf9d229a89de13e57, 0x8f6e403baa978af1), teju_literal4(0x0000000000000000, 0x7ec3daf941806506, 0xc5e54eb70c4429fe, 0x3b6e5b0040e707d2) }, // 28
+  { teju_literal4(0x7202cac5af542227, 0xfa44b92b2df46c2e, 0x31f6d521b92d0c77, 0xe97c733f221e4efd), teju_literal4(0x0000000000000000, 0x195a5efea6b34767, 0xc12ddc8b02740866, 0x0be2df000cfb0190) }, // 29
+  { teju_literal4(0x7d33c22789773a07, 0xfeda8b6f0930e26f, 0xa397c439f1d5cf4b, 0x2eb27d7306d2dc99), teju_literal4(0x0000000000000000, 0x051212ffbaf0a7e1, 0x8d092c1bcd4a6814, 0x68c6f96668ff0050) }, // 30
+  { teju_literal4(0xb2a3f3a181e4a534, 0xcc921be301d693af, 0xed84c0d863912975, 0x6fbd4c4a34909285), teju_literal4(0x0000000000000000, 0x01039d66589687f9, 0xe901d59f290ee19d, 0xae8e31e148330010) }, // 31
+  { teju_literal4(0x56ed97204d2dbaa4, 0x28ea0593cd2aea56, 0x62b42691ad836eb1, 0x16590f420a835081), teju_literal4(0x0000000000000000, 0x0033ec47ab514e65, 0x2e99f7863b696052, 0xbc82d6c6a80a3336) }, // 32
+  { teju_literal4(0x1162b7d342a2beed, 0xa1c86783f5d56211, 0x46f0d483891a4956, 0x9e11cfda021a434d), teju_literal4(0x0000000000000000, 0x000a6274bbdd0fad, 0xd61ecb1ad8aeacdd, 0x58e6f7c154ced70a) }, // 33
+  { teju_literal4(0x36ad57f70d53bfc9, 0x205b47e7312aad36, 0xa7c9c41a4e9edb77, 0xb936c32b9a0540a9), teju_literal4(0x0000000000000000, 0x000213b0f25f6989, 0x2ad2f56bc4efbc2c, 0x44fafe59ddc2f7ce) }, // 34
+  { teju_literal4(0x0aef77fe35dd8cc1, 0xd34574c7d6a222a4, 0x87f52738761fc57e, 0x583e2708b8677355), teju_literal4(0x0000000000000000, 0x00006a5696dfe1e8, 0x3bc3caaf276325a2, 0x743232dec5f3cb29) }, // 35
+  { teju_literal4(0x356317ffa45f828d, 0x2a41175b2aed3a20, 0xe7fdd4a4e46cc119, 0x44d93b01be7b1711), teju_literal4(0x0000000000000000, 0x0000154484932d2e, 0x725a5bbca17a3aba, 0x173d3d5fc130c23b) }, // 36
+  { teju_literal4(0xa44704ccba798082, 0xa20d04abd562a539, 0xc7ff90edc748f36b, 0x742b72338c7f049d), teju_literal4(0x0000000000000000, 0x00000440e750a2a2, 0xe3ababf286b20bbe, 0xd172a5dff37026d8) }, // 37
+  { teju_literal4(0x540e3428f2184ce6, 0xed35cdbbf77a210b, 0x8e66502f8e41ca48, 0xb0d57d3d827fcdb9), teju_literal4(0x0000000000000000, 0x000000d9c7dced53, 0xc7225596e7bd358c, 0x904a212cca49a15e) }, // 38
+  { teju_literal4(0xdd9c70d4fd380f61, 0x62a45c58cb186d02, 0x4fae100982d9f541, 0xbcf77f72b3b32925), teju_literal4(0x0000000000000000, 0x0000002b8e5f62aa, 0x5b06ddeafb25d782, 0x834206a28edb86ac) }, // 39
+  { teju_literal4(0x5f85b02a990b3646, 0xad541278289e7c33, 0xa98936684d5ecaa6, 0xbf64b316f0bd6ea1), teju_literal4(0x0000000000000000, 0x00000008b61313bb, 0xabce2c62323ac4b3, 0xb3da0153b62be7bc) }, // 40
+  { teju_literal4(0xacb4566eeb68a474, 0x8910d07e6e8618d7, 0x21e83e14dc462887, 0xbfe0f09e3025e2ed), teju_literal4(0x0000000000000000, 0x00000001be03d0bf, 0x225c6f46d6d88dbd, 0x8a5ecd10be08c7f2) }, // 41
+  { teju_literal4(0x228a77afc8ae874a, 0x81d029b2e2e79e91, 0x6d2e72d0f8dad4e7, 0xf32cfcec700793c9), teju_literal4(0x0000000000000000, 0x000000005933f68c, 0xa078e30e2af81c59, 0x1bac8f69bf9b5b30) }, // 42
+  { teju_literal4(0x6d4ee4bcc1bc8175, 0x4d29a1f093c7ec83, 0x7c3c7d5cfe922a94, 0xca3c3295b00183f5), teju_literal4(0x0000000000000000, 0x0000000011d7314f, 0x534b609c6efe6c11, 0xd255b648598578a3) }, // 43
+  { teju_literal4(0xaf762dbf59f2804a, 0xa908539683f4c8e7, 0x18d8e5df661d3bb7, 0x5ba5a3b78999e731), teju_literal4(0x0000000000000000, 0x0000000003917043, 0x10a8acec1632e269, 0xf6ddf141ab811820) }, // 44
+  { teju_literal4(0x2317a2bfdeca19a8, 0x8834dd8480ca8e94, 0x9e91c793146c3f24, 0xabeded8b1b852e3d), teju_literal4(0x0000000000000000, 0x0000000000b6b00d, 0x69bb55c8d13d607b, 0x97c5fd0d224d04d3) }, // 45
+  { teju_literal4(0xd3d186f32c8ed1ee, 0x81a42c4db35bb61d, 0xb9505b1d6a7c0ca0, 0xef2f95e89f1aa2d9), teju_literal4(0x0000000000000000, 0x000000000024899c, 0x4858aac1c372ace5, 0x84c1329c3a0f675d) }, // 46
+  { teju_literal4(0x90c38163d5b629fc, 0x805408dc5712579f, 0x8b76789f7bb268ec, 0xfca31dfb530553c5), teju_literal4(0x0000000000000000, 0x0000000000074eb8, 0xdb44eef38d7d55c7, 0x80f37085a53647df) }, // 47
+  { teju_literal4(0xe9c0b37a5df13b98, 0xe67734f8de36de53, 0x1be47e864bf07b62, 0x98ed6c65770110c1), teju_literal4(0x0000000000000000, 0x0000000000017624, 0xf8a762fd82b2aac1, 0x8030b01abaa474c6) }, // 48
+  { teju_literal4(0x61f3571879303f1e, 0x947e3dcb5fa492dd, 0x6bfa7fb475967f13, 0xb82f7c144b00368d), teju_literal4(0x0000000000000000, 0x0000000000004ad4, 0x31bb13cc4d56eef3, 0x8009bcd22554175a) }, // 49
+  { teju_literal4(0x46ca449e7ea33fd2, 0xea7fa5f579875092, 0xaf32198a7deae637, 0x24d64c040f000ae9), teju_literal4(0x0000000000000000, 0x0000000000000ef7, 0x3d256a5c0f77c963, 0xe66858f6d44404ab) }, // 50
+  { teju_literal4(0x748eda861953d990, 0x954cbacab1e7dcea, 0x230a051bb2c89471, 0x6dc4759a69666895), teju_literal4(0x0000000000000000, 0x00000000000002fe, 0x3f6de212697e5b7a, 0x614811caf740cdbb) }, // 51
+  { teju_literal4(0xe41c921ad1dd91e9, 0xb775bef556c7f8fb, 0xa09b9a9f23c1b749, 0xe2c0e45215147b51), teju_literal4(0x0000000000000000, 0x0000000000000099, 0x3fe2c6d07b7fabe5, 0x46a8038efe402925) }, // 52
+  { teju_literal4(0x2d9f506bc392b6c8, 0x57e45964448e64ff, 0x201f1eeca0c057db, 0x93c02daa04374bdd), teju_literal4(0x0000000000000000, 0x000000000000001e, 0xa6608e29b24cbbfa, 0xa7bb33e9660cd507) }, // 53
+  { teju_literal4(0x3c5310158d83be28, 0x119411e0da82e0ff, 0xd3396c95b9c01192, 0x50c0092200d7dbf9), teju_literal4(0x0000000000000000, 0x0000000000000006, 0x214682d523a8f265, 0x54bf0a61e135c434) }, // 54
+  { teju_literal4(0x7277033782b3f2d4, 0xd050d0602bb3c699, 0x90a515b78b8cd050, 0x768ccea066919265), teju_literal4(0x0000000000000000, 0x0000000000000001, 0x39dae6f76d88307a, 0xaa8c9bad2d0ac0d7) }, // 55
+  { teju_literal4(0xb07e33d7e6f0ca2a, 0x901029acd58a5aeb, 0x8354378b1be8f676, 0x7e1c295347b6b6e1), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x3ec56164af81a34b, 0xbbb5b8bc3c3559c4) }, // 56
+  { teju_literal4(0xf0193d9194968ed5, 0x50033b88f782122f, 0x1a440b1bd261cae4, 0x7f9f3b770e57be2d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0c8de047564d20a8, 0xbf245825a5a44527) }, // 57
+  { teju_literal4(0x966b72b6b7514fc4, 0x4333d8b4fe4d36d6, 0x38740238c3ad2894, 0x19863f17cfab2609), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0282c674aadc39bb, 0x596dab3ababa743b) }, // 58
+  { teju_literal4(0xeae24a248b104327, 0x40a3f82432dc3e2a, 0xd81733a4f3ef6e84, 0x051ad96b2988a135), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00808e17555f3ebf, 0x11e2bbd88bbee40b) }, // 59
+  { teju_literal4(0x2efa0ed41bd00d6e, 0x4020cb3a709272d5, 0x5e6b0a5430c97c80, 0xcdd22b7bd51b5371), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0019b604aaaca626, 0x36c6f25e825960cf) }, // 60
+  { teju_literal4(0x0965362a6bf66916, 0x0cd35bd87cea16f7, 0x79489baa70284c19, 0xc2c3a24bf76bdd7d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000524675555bad4, 0x715afd461a11e029) }, // 61
+  { teju_literal4(0x01e10ad548cae1d1, 0x35c3df2b4c2ed164, 0xb1db525549a1a8d1, 0xf3c0ba0f317bf919), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00010747ddddf22a, 0x7d1232a79ed06008) }, // 62
+  { teju_literal4(0x66c69bc441c22d29, 0xd78d9308a8d629e0, 0xf05f1077752054f6, 0xca59becfd6b26505), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000034a7f92c63a2, 0x1903a3bb1fc34668) }, // 63
+  { teju_literal4(0x47c1525a738d3c3b, 0x9182b701bb5e0860, 0x3013034b176cddca, 0xf54526299156e101), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000a87fea27a53, 0x9e9a53f2398d747b) }, // 64
+  { teju_literal4(0x418d10787d82a5a5, 0x83808b0058ac6813, 0x3cd09a4237e292c2, 0x310dd46eb6aaf9cd), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000021b32ed4baa, 0x52ebaa63a51c4a7f) }, // 65
+  { teju_literal4(0xa6b5d018191a2121, 0x1a4ce899ab55ae6a, 0x3f5ceba6d7fa1d5a, 0x09cf90e2f1556529), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000006bd6fc4255, 0x43c8bbad876c0ee6) }, // 66
+  { teju_literal4(0x87bdf66b38386d06, 0x9edc2e8522445615, 0x3fdf625491986c45, 0x3529836096aaadd5), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000159165a6dd, 0xda5b58bc4e48cfc7) }, // 67
+  { teju_literal4(0x4e593148a4d815ce, 0x1fc5a2e76d40de04, 0x3ff97a10e9eb48da, 0xa43b80aceaeeef91), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000004504787c5, 0xf878ab58dc74f65b) }, // 68
+  { teju_literal4(0xa94509db542b378f, 0x9ff453c7e2a692cd, 0xa6651869c86241c5, 0x540be688fbc9631d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000dcdb1b27, 0x98182244f8e43145) }, // 69
+  { teju_literal4(0xeea7685f10d57183, 0x1ffdaa5b2d5483c2, 0xbae104e1f4e0738d, 0xdd9bfae8325b7a39), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000002c2bd23b, 0x1e6b3a0dcb60d6a7) }, // 70
+  { teju_literal4(0x96217b46369116b3, 0xd332bbabd5ddb3f3, 0xbef9cdc6ca934a4f, 0x92b8cbc80a124ba5), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000008d59072, 0x3948a535f579c487) }, // 71
+  { teju_literal4(0xead37f0e0ae9d157, 0x2a3d58bbf792bd97, 0x2631f5f48eea420f, 0xea24f58e686a0f21), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000001c45016, 0xd841baa4644b8db4) }, // 72
+  { teju_literal4(0x622a4c9c689529de, 0x3ba5de8bfe508c51, 0x6e09fdfdb62eda03, 0x2ed4311c7b48696d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000005a766a, 0xf80d2554140f1c57) }, // 73
+  { teju_literal4(0xe06edc1f481dd52c, 0x72545fb599434f43, 0x7c6865ff8ad62b9a, 0x3c90d69f4bdb4849), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x00000000001217ae, 0xfe690777373638de) }, // 74
+  { teju_literal4(0xc67c926ca805f76f, 0x4a10dff11ea70fda, 0x4c14e1331bc46f1e, 0xd8e9c486425f0e75), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000039e56, 0x32e1ce4b0b0ad82c) }, // 75
+  { teju_literal4(0x8e18ea15bb3464af, 0xdb9cf9969fbb032b, 0xa8d0f9d7058dafd2, 0xf82ec0e7a6dfcfb1), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000b944, 0x70938fa89bcef808) }, // 76
+  { teju_literal4(0xb604fb9df23dadbc, 0xc585cb8486589a3b, 0xee9031f7cde9232a, 0x31a2f36187c65cbd), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000250d, 0xb01d8321b8c2fe68) }, // 77
+  { teju_literal4(0xf1343252ca0c55f2, 0x8de78f1a8144eba5, 0x961cd6cb292ea0a2, 0x09ed63e04e5adf59), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000769, 0x23391a39f1c09948) }, // 78
+  { teju_literal4(0xc9d73d43c2027796, 0xe92e4fd219da9587, 0x846c2af56ea2eced, 0x352f7a600fabc645), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000017b, 0x6d71d20b96c01ea8) }, // 79
+  { teju_literal4(0xc1f7d90d8d33b184, 0x9509432a052bb781, 0x80e26efde2ed6295, 0xd76fe5466988c141), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000004b, 0xe2b05d35848cd2ee) }, // 80
+  { teju_literal4(0x59fe5e9c4f70bd1a, 0x84350d6ecdd58b19, 0xe693afcc6095e084, 0x5e499441484e8d0d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x000000000000000f, 0x2d56790ab41c2a2f) }, // 81
+  { teju_literal4(0x11ffac85a97cf29e, 0xe73dcf7c8f911bd1, 0xfaea565c13512ce7, 0x460eb74041a94f69), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000003, 0x09114b688a6c086f) }, // 82
+  { teju_literal4(0x69ffef4deeb296ec, 0x94a5f64c1cb69f29, 0xfefbaadf37103c2e, 0x413624a673884315), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x9b69dbe1b548ce7c) }, // 83
+  { teju_literal4(0x7b999642c956eafc, 0x1dbacadc05be1fd5, 0x32ff222ca49cd8d6, 0x0d0ad4214a4e73d1), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x1f152bf9f10e8fb2) }, // 84
+  { teju_literal4(0x7f1eb7a6f5116232, 0x6c588ef8cdf2d32a, 0xa3cca06f541f5e91, 0x35cef739dba94a5d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x06376f31fd02e98a) }, // 85
+  { teju_literal4(0xb30624bafdd046d6, 0xe2781c98293090a2, 0x20c2867caa6cac83, 0x712964a52beea879), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x013e497065cd61e8) }, // 86
+  { teju_literal4(0xbd67a0f232c3415e, 0x2d4b38eb3b701ced, 0x39c0814c2215bc1a, 0x49d5142108c954e5), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x003fa849adf5e061) }, // 87
+  { teju_literal4(0x5914b9ca0a270d12, 0xd5dbd82f0be338fc, 0x3ec019dc06d1259e, 0xdb9104069b5b7761), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000cbb41ef979346) }, // 88
+  { teju_literal4(0xab6a8b8eced49c36, 0xf7925e6fcf2d71cc, 0x0c8cd1f8ce29d452, 0xf8b69a67b8abe4ad), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00028bd9fcb7ea41) }, // 89
+  { teju_literal4(0xef154f1c8fc41f3e, 0x3183ac7cc30916c2, 0x68e8f6cb5c6ec410, 0x98248547f1bbfa89), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000825ecc24c873) }, // 90
+  { teju_literal4(0xfc9ddc9f4ff4063f, 0xa380bc18f3ce9e26, 0xe1c8315bdf495a69, 0xb8074ddb3058cbb5), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00001a12f5a0f4e3) }, // 91
+  { teju_literal4(0xff52c5b97664013f, 0xed80259e972952d4, 0x938e7045930eabae, 0xbe67dc5f09ab5bf1), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000536fdecfdc7) }, // 92
+  { teju_literal4(0x9976f4584ae0cd0c, 0xc919a11fb7d51090, 0xea4fb00dea362256, 0x2614c5ac9b88abfd), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000010aff95cc5b) }, // 93
+  { teju_literal4(0x51e49744dbc68f68, 0xf50520398b2a9ce9, 0xc87656692ed7a077, 0xa1375abc1f1b5599), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000035665128df) }, // 94
+  { teju_literal4(0x1060eb0dc58e1cae, 0x97676cd84f0885c8, 0x5b4ade15095e534b, 0x203e4558d3057785), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000aae103b5f) }, // 95
+  { teju_literal4(0x9ce02f02c11c6c22, 0xeb14af5e7634e78e, 0x78a892d101dfaa42, 0x39a60dde909ab181), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000222d00bdf) }, // 96
+  { teju_literal4(0x52933c9a269f48d3, 0xc89dbcac7e0a94b6, 0x1821b6f699f98873, 0xa52135f9501ef04d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000006d5ccf2c) }, // 97
+  { teju_literal4(0xdd50a5b86e1fdb5d, 0x8e85f288e6021dbe, 0x04d38afe1ecb81b0, 0xbaa03dfea99fc9a9), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000015df5ca2) }, // 98
+  { teju_literal4(0xf9102124e2d32bdf, 0x82e796e82e006c59, 0x342a4eff9fc24d23, 0x588672cc88532855), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000000045fdf53) }, // 99
+  { teju_literal4(0x650339d42d5d6f2c, 0xb3c7eafb3c667c11, 0xd73ba9665326dc3a, 0x44e7b08f4e770811), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000dff977) }, // 100
+  { teju_literal4(0xe100a52a6f79163c, 0x23f4c898a5ae18d0, 0x5e3f21e143d49272, 0x0dc7f01ca94b019d), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x00000000002ccb7e) }, // 101
+  { teju_literal4(0x6033543bafe50472, 0x6d975b51babc6b5c, 0xdfa639f9da5db6e3, 0x9c5b3005bb7566b9), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000008f57f) }, // 102
+  { teju_literal4(0x79a3dda589943416, 0xe2b7df10588c1578, 0xf987a531f8792493, 0xec123ccdf24aae25), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x000000000001cab3) }, // 103
+  { teju_literal4(0xb1ed92bab51da404, 0x93be5fd011b59de4, 0xfeb4baa398183a83, 0xfc03a5c2ca0eefa1), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000005bbd) }, // 104
+  { teju_literal4(0x2395ea25576c5400, 0xea59465cd05785fa, 0x995758871e6b3ee7, 0x32672126f5362fed), teju_literal4(0x0000000000000000, 0x0000000000000000, 0x0000000000000000, 0x0000000000001259) }, // 105
+};
+
+#include "teju/src/teju.h"
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,23 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#ifndef TEJU_TEJU_GENERATED_IEEE256_H_
+#define TEJU_TEJU_GENERATED_IEEE256_H_
+
+#include "teju/src/config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+teju_export
+teju256_fields_t
+teju_ieee256(teju256_fields_t binary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEJU_TEJU_GENERATED_IEEE256_H_
@@ -15,8 +15,14 @@ extern "C" {
 #define teju_exponent_min         -149
 #define teju_mantissa_width       24u
 #define teju_storage_index_offset -45
-#define teju_calculation_div10    teju_built_in_2
-#define teju_calculation_mshift   teju_built_in_2
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_2
+#endif
 
 #define teju_function             teju_ieee32_no_uint128
 #define teju_fields_t             teju32_fields_t
@@ -35,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { 0x1ae4f38c, 0xb35dbf82 }, // -45
   { 0x7bea5c70, 0x8f7e32ce }, // -44
   { 0xc643c71a, 0xe596b7b0 }, // -43
@@ -117,7 +123,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 0u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
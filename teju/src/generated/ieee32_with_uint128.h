@@ -12,6 +12,7 @@
 extern "C" {
 #endif
 
+teju_export
 teju32_fields_t
 teju_ieee32_with_uint128(teju32_fields_t binary);
 
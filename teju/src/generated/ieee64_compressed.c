@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./ieee64_compressed.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                64u
+#define teju_exponent_min         -1074
+#define teju_mantissa_width       53u
+#define teju_storage_index_offset -324
+#define teju_storage_compression  16u
+#define teju_storage_index_top    292
+#define teju_range_function       teju_ieee64_compressed_range
+#define teju_range_minimum        -66
+#define teju_range_maximum        -23
+#define teju_range_index_offset   -20
+#define teju_range_small_integers 1u
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_2
+#endif
+
+#define teju_function             teju_ieee64_compressed
+#define teju_fields_t             teju64_fields_t
+#define teju_u1_t                 teju64_u1_t
+
+#if defined(teju64_u2_t)
+  #define teju_u2_t               teju64_u2_t
+#endif
+
+#if defined(teju64_u4_t)
+  #define teju_u4_t               teju64_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+#define teju_multiplier(upper, lower) { lower, upper }
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { 0x25e8e89c13bb0f7a, 0xff77b1fcbebcdc4f }, // 292
+  { 0xae3da7d97f6792e3, 0x8dd01fad907ffc3b }, // 276
+  { 0x6f773fc3603db4a9, 0x9d71ac8fada6c9b5 }, // 260
+  { 0x58fae9f773886e18, 0xaecc49914078536d }, // 244
+  { 0x985915fc12f542e4, 0xc21094364dfb5636 }, // 228
+  { 0x7d633293366b828b, 0xd77485cb25823ac7 }, // 212
+  { 0x86fb897116c87c34, 0xef340a98172aace4 }, // 196
+  { 0x29ecd9f40041e073, 0x84c8d4dfd2c63f3b }, // 180
+  { 0xcab10dd900beec34, 0x936b9fcebb25c995 }, // 164
+  { 0xc13e60d0d2e0ebba, 0xa3ab66580d5fdaf5 }, // 148
+  { 0x0d819992132456ba, 0xb5b5ada8aaff80b8 }, // 132
+  { 0xfc89b393dd02f0b5, 0xc9bcff6034c13052 }, // 116
+  { 0x59787e2b93bc56f7, 0xdff9772470297ebd }, // 100
+  { 0x75a44c6397ce912a, 0xf8a95fcf88747d94 }, // 84
+  { 0x1b8e9ecb641b58ff, 0x8a08f0f8bf0f156b }, // 68
+  { 0xe546a8038efe4029, 0x993fe2c6d07b7fab }, // 52
+  { 0xdde50bd1d5d0b9e9, 0xaa242499697392d2 }, // 36
+  { 0x88f4bb1ca6bcf584, 0xbce5086492111aea }, // 20
+  { 0xd3c36113404ea4a8, 0xd1b71758e219652b }, // 4
+  { 0x0000000000000000, 0xe8d4a51000000000 }, // -12
+  { 0x4000000000000000, 0x813f3978f8940984 }, // -28
+  { 0xe4820023a2000000, 0x8f7e32ce7bea5c6f }, // -44
+  { 0x01d762422c946590, 0x9f4f2726179a2245 }, // -60
+  { 0x3b25a55f43294bcb, 0xb0de65388cc8ada8 }, // -76
+  { 0x3ba5d0bd324f8394, 0xc45d1df942711d9a }, // -92
+  { 0xe80e6f4820cc9495, 0xda01ee641a708de9 }, // -108
+  { 0xc0678c5dbd23a49a, 0xf209787bb47d6b84 }, // -124
+  { 0x0b8a2392ba45a9b2, 0x865b86925b9bc5c2 }, // -140
+  { 0xdd945a747bf26183, 0x952ab45cfa97a0b2 }, // -156
+  { 0x43fab9837e699095, 0xa59bc234db398c25 }, // -172
+  { 0x0c11ed6d538aeb2f, 0xb7dcbf5354e9bece }, // -188
+  { 0x31ec038df7b441f4, 0xcc20ce9bd35c78a5 }, // -204
+  { 0x2e44ae64840fd61d, 0xe2a0b5dc971f303a }, // -220
+  { 0x169840ef017da3b1, 0xfb9b7cd9a4a7443c }, // -236
+  { 0x1ad089b6c2f7548e, 0x8bab8eefb6409c1a }, // -252
+  { 0xca7cf2b4191c8326, 0x9b10a4e5e9913128 }, // -268
+  { 0x546345fa9fbdcd44, 0xac2820d9623bf429 }, // -284
+  { 0xe0470a63e6bd56c3, 0xbf21e44003acdd2c }, // -300
+  { 0x5fa60692a46151eb, 0xd433179d9c8cb841 }, // -316
+};
+
+static teju_constexpr const teju_u1_t pow5[] = {
+  0x0000000000000001, // 0
+  0x0000000000000005, // 1
+  0x0000000000000019, // 2
+  0x000000000000007d, // 3
+  0x0000000000000271, // 4
+  0x0000000000000c35, // 5
+  0x0000000000003d09, // 6
+  0x000000000001312d, // 7
+  0x000000000005f5e1, // 8
+  0x00000000001dcd65, // 9
+  0x00000000009502f9, // 10
+  0x0000000002e90edd, // 11
+  0x000000000e8d4a51, // 12
+  0x0000000048c27395, // 13
+  0x000000016bcc41e9, // 14
+  0x000000071afd498d, // 15
+};
+
+static teju_constexpr const uint32_t corrections[] = {
+  0xa5556955,
+  0xe99a9aa9,
+  0x69565555,
+  0xa99a9965,
+  0x5566aa95,
+  0x59656559,
+  0xa65a96a5,
+  0xa9a6a969,
+  0xaaabaea9,
+  0x5a555555,
+  0x55a9a999,
+  0x95959695,
+  0x69555565,
+  0x5a595655,
+  0xeaaaaa69,
+  0x65555555,
+  0xa9aaab99,
+  0x55555555,
+  0xaaaaaa55,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x69eaaea9,
+  0xaaaa9669,
+  0x55555555,
+  0xaaa9aaa5,
+  0x55555655,
+  0x665a9695,
+  0xa5a66aa9,
+  0xaa9baaa9,
+  0x99966695,
+  0x95555555,
+  0xa9aaa5a5,
+  0x6555aa95,
+  0x65565565,
+  0xaa696a69,
+  0xaa565955,
+  0x59655559,
+  0x0002aaa9,
+};
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers_range[] = {
+  { 0x0000000000000001, 0xad78ebc5ac620000 }, // -20
+  { 0x0000000000000001, 0x8ac7230489e80000 }, // -19
+  { 0x0000000000000001, 0xde0b6b3a76400000 }, // -18
+  { 0x0000000000000001, 0xb1a2bc2ec5000000 }, // -17
+  { 0x0000000000000001, 0x8e1bc9bf04000000 }, // -16
+  { 0x0000000000000001, 0xe35fa931a0000000 }, // -15
+  { 0x0000000000000001, 0xb5e620f480000000 }, // -14
+  { 0x0000000000000001, 0x9184e72a00000000 }, // -13
+  { 0x0000000000000001, 0xe8d4a51000000000 }, // -12
+  { 0x0000000000000001, 0xba43b74000000000 }, // -11
+  { 0x0000000000000001, 0x9502f90000000000 }, // -10
+  { 0x0000000000000001, 0xee6b280000000000 }, // -9
+  { 0x0000000000000001, 0xbebc200000000000 }, // -8
+  { 0x0000000000000001, 0x9896800000000000 }, // -7
+};
+
+#define teju_calculation_sorted 0u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { 0x0000000000000001, 0xffffffffffffffff }, // 0
+  { 0xcccccccccccccccd, 0x3333333333333333 }, // 1
+  { 0x8f5c28f5c28f5c29, 0x0a3d70a3d70a3d70 }, // 2
+  { 0x1cac083126e978d5, 0x020c49ba5e353f7c }, // 3
+  { 0xd288ce703afb7e91, 0x0068db8bac710cb2 }, // 4
+  { 0x5d4e8fb00bcbe61d, 0x0014f8b588e368f0 }, // 5
+  { 0x790fb65668c26139, 0x000431bde82d7b63 }, // 6
+  { 0xe5032477ae8d46a5, 0x0000d6bf94d5e57a }, // 7
+  { 0xc767074b22e90e21, 0x00002af31dc46118 }, // 8
+  { 0x8e47ce423a2e9c6d, 0x0000089705f4136b }, // 9
+  { 0x4fa7f60d3ed61f49, 0x000001b7cdfd9d7b }, // 10
+  { 0x0fee64690c913975, 0x00000057f5ff85e5 }, // 11
+  { 0x3662e0e1cf503eb1, 0x000000119799812d }, // 12
+  { 0xa47a2cf9f6433fbd, 0x0000000384b84d09 }, // 13
+  { 0x54186f653140a659, 0x00000000b424dc35 }, // 14
+  { 0x7738164770402145, 0x0000000024075f3d }, // 15
+  { 0xe4a4d1417cd9a041, 0x000000000734aca5 }, // 16
+  { 0xc75429d9e5c5200d, 0x000000000170ef54 }, // 17
+  { 0xc1773b91fac10669, 0x000000000049c977 }, // 18
+  { 0x26b172506559ce15, 0x00000000000ec1e4 }, // 19
+  { 0xd489e3a9addec2d1, 0x000000000002f394 }, // 20
+  { 0x90e860bb892c8d5d, 0x000000000000971d }, // 21
+  { 0x502e79bf1b6f4f79, 0x0000000000001e39 }, // 22
+  { 0xdcd618596be30fe5, 0x000000000000060b }, // 23
+  { 0x2c2ad1ab7bfa3661, 0x0000000000000135 }, // 24
+  { 0x08d55d224bfed7ad, 0x000000000000003d }, // 25
+  { 0x01c445d3a8cc9189, 0x000000000000000c }, // 26
+};
+
+#include "teju/src/teju.h"
+
+#ifdef __cplusplus
+}
+#endif
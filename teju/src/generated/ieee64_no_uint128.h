@@ -12,6 +12,7 @@
 extern "C" {
 #endif
 
+teju_export
 teju64_fields_t
 teju_ieee64_no_uint128(teju64_fields_t binary);
 
@@ -15,8 +15,14 @@ extern "C" {
 #define teju_exponent_min         -1074
 #define teju_mantissa_width       53u
 #define teju_storage_index_offset -324
-#define teju_calculation_div10    teju_built_in_2
-#define teju_calculation_mshift   teju_built_in_2
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_built_in_2
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_built_in_2
+#endif
 
 #define teju_function             teju_ieee64_with_uint128
 #define teju_fields_t             teju64_fields_t
@@ -35,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { 0x6c07a2c26a8346d2, 0x9e19db92b4e31ba9 }, // -324
   { 0x46729e03dd9ed7b6, 0xfcf62c1dee382c42 }, // -323
   { 0x385bb19cb14bdfc5, 0xca5e89b18b602368 }, // -322
@@ -657,7 +663,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 0u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
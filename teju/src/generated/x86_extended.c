@@ -15,7 +15,14 @@ extern "C" {
 #define teju_exponent_min         -16445
 #define teju_mantissa_width       64u
 #define teju_storage_index_offset -4951
-#define teju_calculation_mshift   teju_built_in_1
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_synthetic_1
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_synthetic_1
+#endif
 
 #define teju_function             teju_x86_extended
 #define teju_fields_t             teju128_fields_t
@@ -34,7 +41,7 @@ typedef struct {
   teju_u1_t const upper;
 } teju_multiplier_t;
 
-static const teju_multiplier_t multipliers[] = {
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
   { teju_literal2(0x950d528b55d2269e, 0x2a8a5e16d69be58b), teju_literal2(0xe94af2fa351a6c4b, 0x503a4465e86f5340) }, // -4951
   { teju_literal2(0xdda442091174ebb1, 0xbba1e4df1216513c), teju_literal2(0xbaa25bfb5daebd09, 0x0cfb69eb20590f66) }, // -4950
   { teju_literal2(0x7e1d01a0dac3efc1, 0x62e7ea4c0e7840fd), teju_literal2(0x954eaffc4af230d4, 0x0a62bb2280473f85) }, // -4949
@@ -9904,7 +9911,7 @@ static const teju_multiplier_t multipliers[] = {
 
 #define teju_calculation_sorted 0u
 
-static struct {
+static teju_constexpr struct {
   teju_u1_t const multiplier;
   teju_u1_t const bound;
 } const minverse[] = {
@@ -12,6 +12,7 @@
 extern "C" {
 #endif
 
+teju_export
 teju128_fields_t
 teju_x86_extended(teju128_fields_t binary);
 
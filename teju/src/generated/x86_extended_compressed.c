@@ -0,0 +1,1059 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+// This file was generated. DO NOT EDIT IT.
+
+#include "./x86_extended_compressed.h"
+
+#include "teju/src/literal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define teju_width                128u
+#define teju_exponent_min         -16445
+#define teju_mantissa_width       64u
+#define teju_storage_index_offset -4951
+#define teju_storage_compression  32u
+#define teju_storage_index_top    4913
+
+#if !defined(teju_calculation_div10)
+  #define teju_calculation_div10  teju_synthetic_1
+#endif
+
+#if !defined(teju_calculation_mshift)
+  #define teju_calculation_mshift teju_synthetic_1
+#endif
+
+#define teju_function             teju_x86_extended_compressed
+#define teju_fields_t             teju128_fields_t
+#define teju_u1_t                 teju128_u1_t
+
+#if defined(teju128_u2_t)
+  #define teju_u2_t               teju128_u2_t
+#endif
+
+#if defined(teju128_u4_t)
+  #define teju_u4_t               teju128_u4_t
+#endif
+
+typedef struct {
+  teju_u1_t const lower;
+  teju_u1_t const upper;
+} teju_multiplier_t;
+
+#define teju_multiplier(upper, lower) { lower, upper }
+
+static teju_constexpr const teju_aligned teju_multiplier_t multipliers[] = {
+  { teju_literal2(0x1534b2effea8293f, 0x8a684fbc0fcffa67), teju_literal2(0xa51bc0ea649ef9d2, 0xdb8b3b77f1567b18) }, // 4913
+  { teju_literal2(0xf0341a92af8f32c0, 0x970340f455abd286), teju_literal2(0xcb830756d75c9018, 0x9196622c57825ebc) }, // 4881
+  { teju_literal2(0xb929271e3e725899, 0x129accecdfb04a89), teju_literal2(0xfad902c448c53621, 0xa9d6bfd9dcdc2936) }, // 4849
+  { teju_literal2(0xd8309c6988812f95, 0x9c297740a5b98484), teju_literal2(0x9a98c9daf1864c50, 0xb37fe9b396e97739) }, // 4817
+  { teju_literal2(0x51b2cef5c51b79d8, 0xfe7cfa6ed1cf5917), teju_literal2(0xbe8e287ad508c0f3, 0xef5b27f174660724) }, // 4785
+  { teju_literal2(0x601cd33f1580f1ac, 0x1e5cf22efacb7642), teju_literal2(0xeae0a6f7744f4da6, 0x6f6c02c7e19864d6) }, // 4753
+  { teju_literal2(0x54e0322cc3934279, 0xb4288a117603d476), teju_literal2(0x90c1249a5adf149a, 0x19dcf2b005f80905) }, // 4721
+  { teju_literal2(0x394688fd0036b9c5, 0xa2b1c3becef90a42), teju_literal2(0xb26c748ae31e7cb3, 0x1b5613cb417ce0bf) }, // 4689
+  { teju_literal2(0x07ab464984839856, 0x27824e605076e1d2), teju_literal2(0xdbec93eeb8bf2a57, 0x0e1baa7e8113a6e3) }, // 4657
+  { teju_literal2(0x9abb5bd9103908cb, 0x8e8f33d2811acbc4), teju_literal2(0x8789e8f6968c5ff5, 0x2a262a8ba38d6769) }, // 4625
+  { teju_literal2(0xf21ac314e5a55fc3, 0x767aa6e7316890ad), teju_literal2(0xa71079e1780a9a1c, 0xa624c55bbb96a5cf) }, // 4593
+  { teju_literal2(0x9af9232733d230b5, 0xecaeafdea7e20c2e), teju_literal2(0xcdec3781e54d19ec, 0x09a960cff387a955) }, // 4561
+  { teju_literal2(0x964d8341e3d1fc19, 0x5cfcbb1355ed3f9f), teju_literal2(0xfdd1c102901c9260, 0xe4945b295b54245b) }, // 4529
+  { teju_literal2(0xfbb8d8af6467e364, 0xd8809d238c68783a), teju_literal2(0x9c6da1f59581cc15, 0xb6ecd2d83406a7f5) }, // 4497
+  { teju_literal2(0x9ac6ece1c1a3197f, 0xba41c88f602c942e), teju_literal2(0xc0d00d9c2f3a5ec6, 0xa60a3caf9c5492cd) }, // 4465
+  { teju_literal2(0x013b6fe0ca74d166, 0xf4b92281c7fce619), teju_literal2(0xeda8f67d0934e91a, 0xe2c5c420f04a7618) }, // 4433
+  { teju_literal2(0x319614090904880f, 0xd68b7a2c3f148bec), teju_literal2(0x92782367aaa5cde1, 0x9815890f2e69b32a) }, // 4401
+  { teju_literal2(0xc14cad3fe86af630, 0x4e3dd1de32b70eb7), teju_literal2(0xb4898f0a7419eb40, 0x0dda840534aadf37) }, // 4369
+  { teju_literal2(0x2bcfd679673bbedc, 0xb0d8eb0ee49a82cb), teju_literal2(0xde878a1815a387a7, 0xff604454df4d3c12) }, // 4337
+  { teju_literal2(0x6489a1e8b32af581, 0xed60681c69a8ce8a), teju_literal2(0x8924f4f1d0d594d4, 0xb68ca69e948149ad) }, // 4305
+  { teju_literal2(0xa1adf1d543b8c2f3, 0xbebf7642b3f900aa), teju_literal2(0xa90b2161b86ce01d, 0xc57cc00d21e926bd) }, // 4273
+  { teju_literal2(0xc9bcbe1c9a4fb482, 0x6253cee0147c2684), teju_literal2(0xd05cb76a5fb3dcc9, 0x034b8e21562fee4e) }, // 4241
+  { teju_literal2(0xecf45df109313ef4, 0xcc8183093a1c1724), teju_literal2(0x8069c12ce9b3837c, 0xbe8a58aae910c328) }, // 4209
+  { teju_literal2(0x38c2e990379bfe8e, 0xaa692bde1c62cf69), teju_literal2(0x9e4807ec0b3eb600, 0xd69bc2611f068532) }, // 4177
+  { teju_literal2(0x6569ebf1af79e902, 0x1c95537003af7561), teju_literal2(0xc318cb51060b3908, 0x0b9e63990be30fd5) }, // 4145
+  { teju_literal2(0xbb0e5870e75a235a, 0x2cb96ff781963315), teju_literal2(0xf079b63a21a98c8d, 0xa7482884f791a1e8) }, // 4113
+  { teju_literal2(0x3efd76eb31b13797, 0x2fe788a9bf8a262d), teju_literal2(0x9434558b1a341307, 0x9afb2cac5a241769) }, // 4081
+  { teju_literal2(0x7d160418850dd199, 0xab2177fa0b1d6957), teju_literal2(0xb6ad1289b8d49049, 0xd79115ec3b46da45) }, // 4049
+  { teju_literal2(0x5c987371f3f2be17, 0x9eb0898ff3712432), teju_literal2(0xe12a66f160e0a78f, 0x25d9b53bb91bb655) }, // 4017
+  { teju_literal2(0x7921f015622cc652, 0xf0af75bc3617b3d3), teju_literal2(0x8ac4df80d1c34218, 0x99e626f7d10d8ed7) }, // 3985
+  { teju_literal2(0x0e3c7943f2230011, 0xe17b9e1c57a5cf63), teju_literal2(0xab0bc968651e1e69, 0x93466c45e642d8e5) }, // 3953
+  { teju_literal2(0x5568c90035f43284, 0xc2864f49667c742b), teju_literal2(0xd2d49d3cae6e9602, 0xbf37c4ffa445d42b) }, // 3921
+  { teju_literal2(0xfe76dad52cf30db4, 0x4fdfe2b1eae7045c), teju_literal2(0x81ef310f643bc7cc, 0xb47f8ddd5983b875) }, // 3889
+  { teju_literal2(0x2a54df507d4bae4a, 0x627c89945bdebc86), teju_literal2(0xa0280c9660f98ce1, 0x9899dac7550329a4) }, // 3857
+  { teju_literal2(0xa498135976a3809c, 0xd0fe1fc43cede257), teju_literal2(0xc568765c5e5195d3, 0xdfdb4a5b6e12719e) }, // 3825
+  { teju_literal2(0x039d86cee79859b4, 0xc26b5e6ddfe07094), teju_literal2(0xf352ffc601ec5750, 0x6c9575c6e482ab20) }, // 3793
+  { teju_literal2(0x186dcae6698fa20e, 0x8eab7df960b4d572), teju_literal2(0x95f5caca3128278f, 0x73837e6c7686831d) }, // 3761
+  { teju_literal2(0x63ba715a67d66cd9, 0x70ad9246d14c89e0), teju_literal2(0xb8d71279550ef61b, 0x97a05f76a200216e) }, // 3729
+  { teju_literal2(0x0eb27eadc15986e1, 0x2ef5574b2f8f997d), teju_literal2(0xe3d54270c90c81c3, 0x9a2188566a0fdfb5) }, // 3697
+  { teju_literal2(0x83776c4febda01cf, 0xceeca20156ae8c0f), teju_literal2(0x8c69b768149a552e, 0x8f87797888260584) }, // 3665
+  { teju_literal2(0x1a74635f27633295, 0x78a6372a476e4c36), teju_literal2(0xad1284294bbf8dce, 0x07d1215cf5d87536) }, // 3633
+  { teju_literal2(0x7a04b70eaf7f29b7, 0xa57d0a58138f6cd3), teju_literal2(0xd553ff6878216d7e, 0x859c3d35d2ebc4ed) }, // 3601
+  { teju_literal2(0x74872779576a577c, 0xcdc0f9da5ccf4e35), teju_literal2(0x83793dfc83fd2f9b, 0x9150140eb5101a96) }, // 3569
+  { teju_literal2(0x6d31141e7406f91a, 0x4981a20ab3981277), teju_literal2(0xa20dc0ffba0ed556, 0x409c74dca858c514) }, // 3537
+  { teju_literal2(0x3bbc856a3bb9ddf0, 0x128f89514d90bc56), teju_literal2(0xc7bf23c033b0ce6a, 0x91dc59635738a687) }, // 3505
+  { teju_literal2(0xb7db9967ae3fb2f5, 0x1ce35cc0e4e89c58), teju_literal2(0xf634ed058a313619, 0xcf3a4d7dd3dd46c0) }, // 3473
+  { teju_literal2(0x83c4bc610cb4cb94, 0x804ced3405b669b2), teju_literal2(0x97bc931a4bb319b5, 0x596b90e9902aeb28) }, // 3441
+  { teju_literal2(0x58ca229cdd5d5b9c, 0x826fb1a3916423de), teju_literal2(0xbb07a284e123c1b8, 0xdb01efc7dc997c8e) }, // 3409
+  { teju_literal2(0xa11025b085633daf, 0x71c80cd339da8a3c), teju_literal2(0xe68834d527ce83fd, 0x1fd4de0e57453c50) }, // 3377
+  { teju_literal2(0x4efb970079c0861a, 0x20dc8188e56fac9e), teju_literal2(0x8e138b98dda660a9, 0xef18708f8a563661) }, // 3345
+  { teju_literal2(0x774baf6fd3f48565, 0x6c4eef3ec4accfec), teju_literal2(0xaf1f640f6daeb46d, 0x6ff1e57a78640b52) }, // 3313
+  { teju_literal2(0x67e9e5afc9d78670, 0x426e53f41dd94b72), teju_literal2(0xd7daf4a16e26063d, 0x35c38fa96c18fa93) }, // 3281
+  { teju_literal2(0xc2bae749f2b899e2, 0x09e9cbe8d2ffff05), teju_literal2(0x8507f5f20469867b, 0x7115c25f431329f8) }, // 3249
+  { teju_literal2(0x47e9917bbcf49f2d, 0x702d478c36517293), teju_literal2(0xa3f93666e9e5f150, 0xb54f787ede8754da) }, // 3217
+  { teju_literal2(0xc839429ba37c8d1f, 0x2f175e5b2059acf4), teju_literal2(0xca1ce8be378ca015, 0x1164c2a350752cfb) }, // 3185
+  { teju_literal2(0x8a5070c4cbd5a018, 0xd1da99f377017035), teju_literal2(0xf91f982c21fe39c7, 0x0185f947de3083e8) }, // 3153
+  { teju_literal2(0x4c3b522278b774bd, 0x235173ad13d70901), teju_literal2(0x9988bea12ba6bf1f, 0xa39d993e226ac919) }, // 3121
+  { teju_literal2(0xa3026ee169251804, 0x97dc24c71a611ac9), teju_literal2(0xbd3ed6939cd2df21, 0x5f8d7250db61e4ab) }, // 3089
+  { teju_literal2(0x78be78e9d0de8a25, 0xd95dff66036db2f1), teju_literal2(0xe94356a6de40e582, 0xe445a32f1c19a115) }, // 3057
+  { teju_literal2(0xd307c122653fe5f7, 0x23650b7fd22691ac), teju_literal2(0x8fc26b31c20b78e6, 0x0f1afce62f5cc13d) }, // 3025
+  { teju_literal2(0xa8ca2982d2b3a3d2, 0xe651266b10ca2a74), teju_literal2(0xb1327bbda76e8f9f, 0x4185edc543459d93) }, // 2993
+  { teju_literal2(0x99007638decaf363, 0x9597f11cbf7c64ca), teju_literal2(0xda6993e01ae506b3, 0x94356c5a52aa743c) }, // 2961
+  { teju_literal2(0x7c0af9380a503500, 0x803a2733746e0f2a), teju_literal2(0x869b67180f3a8993, 0x71a5392d3d5e42ff) }, // 2929
+  { teju_literal2(0x894747501216d93a, 0x77c766e2557f9a4e), teju_literal2(0xa5ea7e3f10b1cc99, 0xd22be82c3522017d) }, // 2897
+  { teju_literal2(0x6974676425d022de, 0xe3ad3a00d883516b), teju_literal2(0xcc81dad8923f94f1, 0xbe9b46e7264ca05b) }, // 2865
+  { teju_literal2(0x5100f8d52ec91f4f, 0x8a7ff51cf8aca386), teju_literal2(0xfc131bbca652b7c5, 0xd7a0a3c44ae1a8aa) }, // 2833
+  { teju_literal2(0xc47426db680a15c4, 0x492df90eaa78998d), teju_literal2(0x9b5a5db58b3b9968, 0xa6343957ea0361b6) }, // 2801
+  { teju_literal2(0x433c1ceda3401786, 0x78e61d097207a711), teju_literal2(0xbf7cc2c9242ae754, 0x36e66c3d1444119c) }, // 2769
+  { teju_literal2(0x8009059216f34d22, 0x0bb65b3f6554d858), teju_literal2(0xec06c0b8b3ee52f3, 0x7bc1c3a68f8d0d4b) }, // 2737
+  { teju_literal2(0x29c62da8df057fb8, 0x08e28d1e3ba6d40b), teju_literal2(0x9176657f3133f6d9, 0x058b69ba277a8f07) }, // 2705
+  { teju_literal2(0xfdbc3168d6b6839b, 0xca6bbcb1158559ee), teju_literal2(0xb34bde0f5a0c7247, 0x5c180e775768871b) }, // 2673
+  { teju_literal2(0x5e5ebbe40b373ffc, 0x2ecb5120c4749c6d), teju_literal2(0xdcfff462b2a16c90, 0x64adcfac58ee9c6a) }, // 2641
+  { teju_literal2(0x9738fc5e78bd126b, 0x3a9f5f0634487126), teju_literal2(0x88339fc1bd1fd41a, 0x386666b38c371a5d) }, // 2609
+  { teju_literal2(0x3ad2e63686bb2b40, 0x94e9c17a04c22cad), teju_literal2(0xa7e1aa303a0ceb21, 0xc5c528d54b6ccbfa) }, // 2577
+  { teju_literal2(0xc28e7ebc7a77fc69, 0xe434572e13742b70), teju_literal2(0xceee0fd2a69b60e0, 0x5365a23409f994f1) }, // 2545
+  { teju_literal2(0x6ef6faeb01f7dbbe, 0x26cd164c597751c6), teju_literal2(0xff0f928a5aa0a8d9, 0x7f44b62b69ded794) }, // 2513
+  { teju_literal2(0xa16b21e5250b56b3, 0x88e24a7a40947f0b), teju_literal2(0x9d3180dfb193d89a, 0x161dac3d5d3c8523) }, // 2481
+  { teju_literal2(0x4129da8c6896d077, 0xce1fbb19d95d0c50), teju_literal2(0xc1c17b8626972c79, 0x204e88af4b4f3830) }, // 2449
+  { teju_literal2(0xf941f57f4a7629fc, 0xef87408331f839a3), teju_literal2(0xeed28c28b873dd27, 0xce631b790b04f8c4) }, // 2417
+  { teju_literal2(0xc94b6d273d3fe581, 0x31fbbb5cc8b9dcd9), teju_literal2(0x932f89fbffdf0240, 0x4eb9c8a6f806c065) }, // 2385
+  { teju_literal2(0xb12bf25bcddcfeb7, 0xa2d9b5a29007d4a8), teju_literal2(0xb56b9e1916869b59, 0xcf473c41cc6c22e3) }, // 2353
+  { teju_literal2(0x76c1a61ca5807d6a, 0x27ea550939acf2cd), teju_literal2(0xdf9e2dade6bd15c7, 0x8a8521806a7222a4) }, // 2321
+  { teju_literal2(0x9ae73ae4881dd8a0, 0xcdacf9ea50136dca), teju_literal2(0x89d0ae6d97f30a6f, 0x54344d5264173085) }, // 2289
+  { teju_literal2(0x30901e117e086f5d, 0x8c272db3b8baef5a), teju_literal2(0xa9decc17fd767acd, 0x1bcf29f0f1967e4f) }, // 2257
+  { teju_literal2(0xfc7dcdf4c351cf56, 0x8f41736f61d27c53), teju_literal2(0xd1619db1d7ba2390, 0xabf358355cc3356f) }, // 2225
+  { teju_literal2(0xbb10070b766b310f, 0xc8a400687812866c), teju_literal2(0x810a8bdcee506a48, 0x82c5738b1a35b8e2) }, // 2193
+  { teju_literal2(0xa034fa85d7ee3358, 0xa23ef9ce12d4fe4c), teju_literal2(0x9f0e38da0900c180, 0xb95a7c7389ede647) }, // 2161
+  { teju_literal2(0x94573b9a80667742, 0x8ca3071943b4aaa2), teju_literal2(0xc40d15692018ec11, 0xe602d15c86cf32a3) }, // 2129
+  { teju_literal2(0x8398d63d44f111ce, 0xeb3be36686abb2c7), teju_literal2(0xf1a6d26127cf2e15, 0x8c52685b0e334982) }, // 2097
+  { teju_literal2(0xd24371628bd55b7e, 0x17025d09343a4380), teju_literal2(0x94ede851f4d4d31d, 0x34a7db93fb7c5602) }, // 2065
+  { teju_literal2(0x4a11553f5ab70b2b, 0xbf2e49d49f06d88a), teju_literal2(0xb791cf294b3a9a7e, 0xb7df5e1ef7aab8f3) }, // 2033
+  { teju_literal2(0x3b22e6b1e58d2d96, 0xf294d5ae9593b425), teju_literal2(0xe244578dbb7dff34, 0xf9d84b242e3143d1) }, // 2001
+  { teju_literal2(0xc7a6f6e24ef10f5b, 0x16e16408ca32c246), teju_literal2(0x8b72a1c61e76e351, 0x17b1a43b943cafda) }, // 1969
+  { teju_literal2(0x6faf5bff0865c629, 0xfce2cc032fefbb31), teju_literal2(0xabe1f60a20b61b82, 0x41b147c29379172a) }, // 1937
+  { teju_literal2(0x72fe712d686629cf, 0x8d61f4d53d5ab89e), teju_literal2(0xd3dc9abe512795c5, 0x769d41b0e4314279) }, // 1905
+  { teju_literal2(0xe6b8f367a8215733, 0xbf2dd5924ac726a2), teju_literal2(0x8291e3610d8538dc, 0xb6355d435d047d1f) }, // 1873
+  { teju_literal2(0x1771733cd0977e46, 0xd68ec0c9448cc078), teju_literal2(0xa0f09691b70fcdbc, 0xffc3b91d1f9e7ed5) }, // 1841
+  { teju_literal2(0x54e7c71068c0e5b9, 0x765220195286261d), teju_literal2(0xc65fa54f14b23acb, 0x9454bd0619f5f11a) }, // 1809
+  { teju_literal2(0x77a2c831535c055c, 0x7956a681db5aec62), teju_literal2(0xf483ad1951611ee1, 0x7a040bc678378f3d) }, // 1777
+  { teju_literal2(0xc955f3da5c0a6529, 0x9762a9db4938964d), teju_literal2(0x96b1905a5745a970, 0x042f003deb101379) }, // 1745
+  { teju_literal2(0x98cb9080b909a4d2, 0x00406528e6966af9), teju_literal2(0xb9be84c8f361ab3e, 0x8cf30c74404f9b3a) }, // 1713
+  { teju_literal2(0x64d9696800f2ed98, 0xc4e3d25610e0bfc2), teju_literal2(0xe4f28a16605bcfea, 0x0248cc2ab63d88cd) }, // 1681
+  { teju_literal2(0x286c87572ff96595, 0x2009384270000374), teju_literal2(0x8d1988a249a5bcb1, 0xb156120f8495221a) }, // 1649
+  { teju_literal2(0xbbd35dd8b87aa09b, 0xa0ac243e624e3cd3), teju_literal2(0xadeb3a513c2c2183, 0x4f86abb3dbb59e3e) }, // 1617
+  { teju_literal2(0x8e49659675860aa3, 0x5009038e2542ac73), teju_literal2(0xd65f1d83d1693d28, 0xcd677273cd62c389) }, // 1585
+  { teju_literal2(0xe442f4b9bc9a01a1, 0x52e7ab963628d48b), teju_literal2(0x841dddb6a79b7f2b, 0x30e2c728833d6bef) }, // 1553
+  { teju_literal2(0xeb75cbfb2a973744, 0x0a561e386bde10e8), teju_literal2(0xa2d8ab273664eba3, 0x7486d51206d6f23a) }, // 1521
+  { teju_literal2(0x091767836942fa7a, 0x0fc931f8e44c775c), teju_literal2(0xc8b940544e095179, 0x314ac2720c086eb4) }, // 1489
+  { teju_literal2(0xa022f4508a86a1aa, 0x1b2659351b5c4495), teju_literal2(0xf769365681ace2e7, 0x4c0d5973efd8bee4) }, // 1457
+  { teju_literal2(0xe009a2163e23c109, 0x278a3e0170e25712), teju_literal2(0x987a921e7ed88947, 0xb910bee5a5540ad9) }, // 1425
+  { teju_literal2(0x2cfac7286fe5df41, 0x264edde0ec1c036d), teju_literal2(0xbbf1d2bc48a141cb, 0xf76e8128b6518b80) }, // 1393
+  { teju_literal2(0xbffd1f06c660a709, 0xe746d0e5629beb57), teju_literal2(0xe7a8dda50add5f3c, 0x38513d0dbf906e48) }, // 1361
+  { teju_literal2(0x288af246aae3ce14, 0x864edbe2080489d4), teju_literal2(0x8ec57206139477dd, 0xf41c2e2eaa5a82c2) }, // 1329
+  { teju_literal2(0xcb32d3882eb14f57, 0x34ab776c8a63a8dc), teju_literal2(0xaffaab6f6114279c, 0x4308efbc1a3a1aa4) }, // 1297
+  { teju_literal2(0xcd40cbf19f131f89, 0x9945ec36c0851eaf), teju_literal2(0xd8e93cd276ecd79e, 0x4ecace702b43c88e) }, // 1265
+  { teju_literal2(0x591e02f7c2bddceb, 0x6b62a22a31060c45), teju_literal2(0x85ae88ecfcdd961e, 0xccd72ef9a371bef4) }, // 1233
+  { teju_literal2(0xa23b5fda4bbb4b08, 0x71391d849c1e6112), teju_literal2(0xa4c687eef267545f, 0x5f2d4b03f5ce0635) }, // 1201
+  { teju_literal2(0x164dc562e9203ba6, 0xa38386b76043d8bd), teju_literal2(0xcb19fbd51b4af6ef, 0xe8888ca7c224028c) }, // 1169
+  { teju_literal2(0x860846558ad1ff2e, 0x502aae232378d0e8), teju_literal2(0xfa57886ceedc145c, 0xbf38850ead4328ae) }, // 1137
+  { teju_literal2(0xd530ce22620291cf, 0xad13c28706411f9c), teju_literal2(0x9a48fdd8656ed890, 0x58915c6ad52c271a) }, // 1105
+  { teju_literal2(0x49d00b2dc0bff115, 0xc329903613e53ad2), teju_literal2(0xbe2bcd0376b61765, 0xb250b70a541f328c) }, // 1073
+  { teju_literal2(0x749bdb132a9af87f, 0xb1e143c748e1704f), teju_literal2(0xea676ae0d40dfaf7, 0xcd24abdefd2cada9) }, // 1041
+  { teju_literal2(0xf8fb277c055696c5, 0x9281ac348e8172bf), teju_literal2(0x90766d22ffee6702, 0xf71d6515e9de5944) }, // 1009
+  { teju_literal2(0x40d8d706095c7eda, 0xcf7c2d06bf22e8b9), teju_literal2(0xb2105c1ec1bfd85f, 0x44fd23639818960d) }, // 977
+  { teju_literal2(0xc4f4174d2dcabbf1, 0x9f76338795b73ee7), teju_literal2(0xdb7b0fbf8f6444cd, 0x3bdb125a42b0f59f) }, // 945
+  { teju_literal2(0x25a440d8b1620532, 0xe1073937d4d58994), teju_literal2(0x8743f33df0feed29, 0x274ebc67c3e21943) }, // 913
+  { teju_literal2(0xa3fdf0df4bf82c5f, 0xe3b842fffc41d2bd), teju_literal2(0xa6ba3e71e4c67f5a, 0xf8e5a3f79e8e7e8f) }, // 881
+  { teju_literal2(0xbf2eca6d4f6b3c42, 0x04fa81e5139a6351), teju_literal2(0xcd81ed6e9352d6e8, 0x1ffc3da994cbd7d0) }, // 849
+  { teju_literal2(0xcbf614a0e41f7cb4, 0xc08525f38560553b), teju_literal2(0xfd4ebe00a8100860, 0xfe8dba0a5b23e126) }, // 817
+  { teju_literal2(0x8ab3d9bef04f3b25, 0x705f7d3d5f1817ca), teju_literal2(0x9c1ce3f33aa20b8d, 0x3eae8b74122f27a7) }, // 785
+  { teju_literal2(0x91446f04e931302e, 0x9da42a0a2555c27e), teju_literal2(0xc06c87db51401769, 0xa3b91954d4ff9bc2) }, // 753
+  { teju_literal2(0x8daa2e33cada5f9d, 0x5f5c88bc4a5e2ad2), teju_literal2(0xed2e4abb98924aa8, 0x529383978b534326) }, // 721
+  { teju_literal2(0x1e3be949faedd323, 0x70e7dd2835ad34df), teju_literal2(0x922c8958a60f24a5, 0xee0797cc3b4bf764) }, // 689
+  { teju_literal2(0x759e2b119494f071, 0x8ea94a3907261a64), teju_literal2(0xb42c5f525bcfe78f, 0xa5284724434206ce) }, // 657
+  { teju_literal2(0x69c9614ef30e9bb9, 0xfc8ff8815a01d5ac), teju_literal2(0xde14ada669964aae, 0x359f7560e7aed97e) }, // 625
+  { teju_literal2(0x03057e556e20f656, 0x117bd62389bea458), teju_literal2(0x88de2b0e8c6b16c8, 0xb85988a55f9c5921) }, // 593
+  { teju_literal2(0x5be2963448d6c010, 0xaf28b23365670282), teju_literal2(0xa8b3e06e34dccab3, 0xe66fbe0b300ad6d8) }, // 561
+  { teju_literal2(0x6f0f78b5905fa2bd, 0x66e1ffae75d2bd8e), teju_literal2(0xcff12aff5920aab0, 0x57efe5a3489b2d36) }, // 529
+  { teju_literal2(0xc8fd69f087119ed9, 0xce06943d7782fec7), teju_literal2(0x8027790343c474e0, 0x917474a07ee8fa50) }, // 497
+  { teju_literal2(0x20a7ebb1bba8726b, 0x2543971111985e9a), teju_literal2(0x9df6550bf9009c9e, 0xb96c0361aaa1ae3d) }, // 465
+  { teju_literal2(0x513a4853722bf0e1, 0x1aa9776859b53b61), teju_literal2(0xc2b417be0bb5a18b, 0x0d10a44eb535d7b4) }, // 433
+  { teju_literal2(0xa31d45756c49ca25, 0x74e6401ce9d112cd), teju_literal2(0xeffd9672db64c4c3, 0x8eb5f3b4980e3ec0) }, // 401
+  { teju_literal2(0xe5b6510631d3d88b, 0xbe2b5bac7678c044), teju_literal2(0x93e7d6353cbf3c53, 0xe435cfb11ece8d26) }, // 369
+  { teju_literal2(0x2b627f56aba49cb5, 0x29d72147ccbdb42e), teju_literal2(0xb64ec836a47146f9, 0x9748e2826cdee284) }, // 337
+  { teju_literal2(0x3bc465dcd7f5422a, 0xa2c28f54968b57b3), teju_literal2(0xe0b62e2929aba83c, 0x331acdabfe94de87) }, // 305
+  { teju_literal2(0x7b1880e52e1e4ca3, 0x4c96b02e3236105e), teju_literal2(0x8a7d3eef7f1cfc52, 0x482835ea666b2572) }, // 273
+  { teju_literal2(0xef5a043f803153fd, 0x26636c3d448028af), teju_literal2(0xaab37fd7d8f58178, 0xc8e5087ba6d33b83) }, // 241
+  { teju_literal2(0xf45911f7ebaa346a, 0xddc5c6ee25020219), teju_literal2(0xd267caa862a12d66, 0xd072df63c324fd7b) }, // 209
+  { teju_literal2(0xc0e7a5bc6b81191c, 0xc7509e1cbf8e2ad2), teju_literal2(0x81ac1fe293d599bf, 0xc6f14cd848405530) }, // 177
+  { teju_literal2(0xd655d349b644b8da, 0xbb81385bf1617c1e), teju_literal2(0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633) }, // 145
+  { teju_literal2(0x54d440177aaa1de1, 0x8b47cc8543993e68), teju_literal2(0xc5029163f384a931, 0x0a9e795e65d4df11) }, // 113
+  { teju_literal2(0x3695dad7e8858901, 0xf7bbf4030b97c25a), teju_literal2(0xf2d56790ab41c2a2, 0xfae27299423fb9c3) }, // 81
+  { teju_literal2(0x2eb5b82ea93e5f5c, 0x24637c2249e8ce86), teju_literal2(0x95a8637627989aad, 0xdde7001379a44aa8) }, // 49
+  { teju_literal2(0xff8df0157db98d37, 0x4fd70f6d0af85a22), teju_literal2(0xb877aa3236a4b449, 0x09befeb9fad487c2) }, // 17
+  { teju_literal2(0x0000000000000000, 0x0000000000000000), teju_literal2(0xe35fa931a0000000, 0x0000000000000000) }, // -15
+  { teju_literal2(0x0000000000000000, 0x0000000000000000), teju_literal2(0x8c213d9da502de45, 0x4526f422cc340000) }, // -47
+  { teju_literal2(0xf547206e475c8d00, 0x0000000000000000), teju_literal2(0xacb92ed9397bf996, 0x49c2c37f07965404) }, // -79
+  { teju_literal2(0x543fe4cf5a5b4dbe, 0xe8beff1ca8465183), teju_literal2(0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a) }, // -111
+  { teju_literal2(0x2e3bf2bf11bfa6af, 0x813c808dbf33dbfa), teju_literal2(0x8335616aed761f1f, 0x7f44e6bd49e807b8) }, // -143
+  { teju_literal2(0x40e60e65a6b545f3, 0x7820e519a2a400af), teju_literal2(0xa1ba1ba79e1632dc, 0x6462d92a69731732) }, // -175
+  { teju_literal2(0x6b8a22ee0864f155, 0xc841da962c669f70), teju_literal2(0xc75809c42c684dd1, 0x52c07b78a3e60868) }, // -207
+  { teju_literal2(0x38b16d4f62290d27, 0xbffc41f8861c19cd), teju_literal2(0xf5b5d7ec8acb58a2, 0xae10af696774b1db) }, // -239
+  { teju_literal2(0xa681ab003d821aed, 0xc9075e5162aef832), teju_literal2(0x976e41088617ca01, 0xd5be0503e085d813) }, // -271
+  { teju_literal2(0xbe643f001dea2bc7, 0xd6898606dc1740fd), teju_literal2(0xbaa718e68396cffd, 0xd30560258f54e6ba) }, // -303
+  { teju_literal2(0x20e706276d7e79b0, 0x8718438960573071), teju_literal2(0xe61136f2227e3b09, 0xcec3b1aaa30dd91c) }, // -335
+  { teju_literal2(0xd15f10bb4f481bb7, 0x92f77d3f7877a4b1), teju_literal2(0x8dca36028bf3d489, 0x350595680d93ffc3) }, // -367
+  { teju_literal2(0xaf8ee89abf423995, 0x3d37d18086acabe1), teju_literal2(0xaec4ffd3d61994b7, 0xa51fa93180964e38) }, // -399
+  { teju_literal2(0x53aff06c3bb9b95c, 0xfab988e6ee83b6a5), teju_literal2(0xd76b8a1770470b7a, 0xf248b450625df091) }, // -431
+  { teju_literal2(0x5da70f3f827498ea, 0xc45ae7921288148e), teju_literal2(0x84c34b92d357570a, 0x3757b69e2f1cc77e) }, // -463
+  { teju_literal2(0x8522896dd0f0d4a8, 0xb4ee2f9498f3ea3c), teju_literal2(0xa3a49362c8b88a2d, 0x58d0c252c7e4fc32) }, // -495
+  { teju_literal2(0x82bf6bcc0c47f4c1, 0x02515d8abaf56494), teju_literal2(0xc9b496156ef99c25, 0xeed2f994af8716f3) }, // -527
+  { teju_literal2(0xb983e459e578cd71, 0x0b0ebf387e1b7d59), teju_literal2(0xf89f01ac5b6d3070, 0xa220ee09422f2650) }, // -559
+  { teju_literal2(0x5876e2b16977a491, 0x251ae493d9bbbcbd), teju_literal2(0x99397f09c45f0fda, 0xa1293c7fae29e9bd) }, // -591
+  { teju_literal2(0xee0980eed6a44da5, 0x789aafe4cfe08211), teju_literal2(0xbcdd2830850f005f, 0x967a6b2da71e3c20) }, // -623
+  { teju_literal2(0x4170fe3e753e2a9b, 0x7acf1e71eaaddef3), teju_literal2(0xe8caefe668901c0d, 0xf76eb045c98279ad) }, // -655
+  { teju_literal2(0xbfeacfaee268a43b, 0x79a27d1cccb4b381), teju_literal2(0x8f783734fb3b9033, 0xebd279ed41c305db) }, // -687
+  { teju_literal2(0x1ee7c7c81e9c99eb, 0xb597fd80537f3202), teju_literal2(0xb0d70560ecc880f0, 0xfda84abbcac8f32b) }, // -719
+  { teju_literal2(0x91126af1b3638089, 0x2dfe3dad5870042e), teju_literal2(0xd9f8d7721d1a5cd9, 0x54e7561e8e2f089e) }, // -751
+  { teju_literal2(0xc475c2cd722a6a0a, 0x1e8a71535f30b977), teju_literal2(0x8655ec7b208bd47a, 0x7d90849c966e61f2) }, // -783
+  { teju_literal2(0xf240a1636f988c99, 0x6b192d7dfa735cca), teju_literal2(0xa594da8d9b678ca6, 0x81b54136fd8f2b04) }, // -815
+  { teju_literal2(0xdf7740a5d4305a6c, 0x652ccde713dc6de7), teju_literal2(0xcc184bcec9823c64, 0x39bb2b193ba11fbe) }, // -847
+  { teju_literal2(0xb22c0fe656184fbe, 0xcb6303aef06afa38), teju_literal2(0xfb90ff454b08bc96, 0x5e21318a89a3d53d) }, // -879
+  { teju_literal2(0xa885b7eb2c3acd1a, 0xdea570af5bf73999), teju_literal2(0x9b0a2dc82db08f58, 0x86e963b41e94d349) }, // -911
+  { teju_literal2(0xe531547fa907d352, 0xcdf28ca72a50f548), teju_literal2(0xbf19ec2971fb7650, 0xcdc80d328b8fd7ed) }, // -943
+  { teju_literal2(0x9d14d413a1fe2784, 0xf7a03b0f3e89e082), teju_literal2(0xeb8cecd469a8d1c1, 0xb185735597077f7c) }, // -975
+  { teju_literal2(0x932468cbb05e63d8, 0xec0a47f42a0bc284), teju_literal2(0x912b50797cc12ee4, 0xe0f4913621027dfe) }, // -1007
+  { teju_literal2(0xba9fbc9108127db3, 0xb611c6c613c7d9ce), teju_literal2(0xb2ef525222e127d1, 0x589526e3b4712dde) }, // -1039
+  { teju_literal2(0x2677cacbf0261c69, 0x0fdbb4535b5673f9), teju_literal2(0xdc8de20ffd4add42, 0xf9653861eb70b3c0) }, // -1071
+  { teju_literal2(0xe965b22d2a9335fd, 0x8646baba9bec4588), teju_literal2(0x87ed526f88f2ec7c, 0x2168607014467a47) }, // -1103
+  { teju_literal2(0xbdabe2b358c04397, 0x772f142e22a1b614), teju_literal2(0xa78b02c704ab17a3, 0x32bcd35ca9915052) }, // -1135
+  { teju_literal2(0x49bc32a245ec7157, 0xaf76398b69c45ca9), teju_literal2(0xce8340a86317e620, 0x825c36f3c7bb6c35) }, // -1167
+  { teju_literal2(0x1e77b53b86b29377, 0xaf2dd1a34edea7df), teju_literal2(0xfe8beb7cc4723591, 0xf8c9991cd457c1ea) }, // -1199
+  { teju_literal2(0xf2235a04769709a6, 0x4a6dc1425910d3da), teju_literal2(0x9ce05dc380a4a3ba, 0xcbb5a497988394b5) }, // -1231
+  { teju_literal2(0xe4ca879b5e7a3ae6, 0x2e64a3010f7edd3b), teju_literal2(0xc15d79277520bd17, 0x0718ea9ac0ac2192) }, // -1263
+  { teju_literal2(0x0782a254900d586d, 0xdec3f36fe339c4af), teju_literal2(0xee5746cd3e726f43, 0x474646a54bd67b3f) }, // -1295
+  { teju_literal2(0x427b9010721ea514, 0xabaee4a50d5e7521), teju_literal2(0x92e39142e7cdfe5a, 0x65331ec97405d73d) }, // -1327
+  { teju_literal2(0xb03c70370f8ace2b, 0x25b3c39d9bde48e6), teju_literal2(0xb50df9b230284c77, 0x9de6b0a8b1da21ac) }, // -1359
+  { teju_literal2(0x6bd71cffc7eb570e, 0xc14e89ee5b31b790), teju_literal2(0xdf2ac1699e9439c7, 0x95fd636b836f5776) }, // -1391
+  { teju_literal2(0x74ced40f06e88c38, 0x1bfecc383d4e782b), teju_literal2(0x89898be71b29ac7e, 0x5f09296b28f3d766) }, // -1423
+  { teju_literal2(0x553dabcaddd0b6d8, 0x4b14023872e9d3d9), teju_literal2(0xa9871de3634c3640, 0xb6cb26343b66bea6) }, // -1455
+  { teju_literal2(0x9ed9af94c9a6e6ef, 0xb20b22f16abe33da), teju_literal2(0xd0f58a9c4107874c, 0xfd81978ff2c62609) }, // -1487
+  { teju_literal2(0x123d9c27db939c59, 0xbff87211b83868b8), teju_literal2(0x80c7f0b4b1637535, 0x81f6e3faff2b5bbb) }, // -1519
+  { teju_literal2(0x1ac8af2b727c9c7d, 0xa0a464cdd4522ad1), teju_literal2(0x9ebc1fad8521b648, 0x379d77acbb714836) }, // -1551
+  { teju_literal2(0x3b378afe877adfe3, 0x9f85600fa8c3b3a0), teju_literal2(0xc3a7e3be65f3519f, 0x4fda0b57de29b863) }, // -1583
+  { teju_literal2(0x4de0c266a9d263ce, 0x1e99c874f9b6286b), teju_literal2(0xf12a172e04a6494f, 0xc2ac0588ba16f6c2) }, // -1615
+  { teju_literal2(0x0811f3ee6235fda9, 0xceec8a68bc7f1a57), teju_literal2(0x94a10932ed791daa, 0x2bc2a33c0b7d34bf) }, // -1647
+  { teju_literal2(0x3014fc5b892d476c, 0xbc4713f288aec9a1), teju_literal2(0xb7330ec58be3eb7a, 0x0653e3fcd4afcf62) }, // -1679
+  { teju_literal2(0xdb77d6811eb6bf32, 0xb3b73d536431e920), teju_literal2(0xe1cf8d3ebcc5b589, 0x46029693b15b595c) }, // -1711
+  { teju_literal2(0xaca3a975993a2626, 0xf6882b632cdffc88), teju_literal2(0x8b2aa784c405e2f1, 0xc41cf207a71d87e4) }, // -1743
+  { teju_literal2(0xc0dd0170287fbca7, 0xe9d8f66589ed797e), teju_literal2(0xab893ded286517ac, 0x45636ff9c6290786) }, // -1775
+  { teju_literal2(0xf0936b40ddf7bc2c, 0xaa0de4845e24291b), teju_literal2(0xd36f3fe70e9720c4, 0xf7b57f1d67e043bc) }, // -1807
+  { teju_literal2(0x443aa79de9d456a1, 0x7776b1c1596cbffd), teju_literal2(0x824e7e39f3d2c44a, 0x961496bce3897ceb) }, // -1839
+  { teju_literal2(0xc33c485a2f49bba1, 0xf7413e470d913990), teju_literal2(0xa09d846aa41ae2ba, 0x2aa559d69dfa955e) }, // -1871
+  { teju_literal2(0xb94d53a134a7b3fa, 0x7fb9ff53bd8e4a41), teju_literal2(0xc5f940c083a1d171, 0xa0c0fade3fb01f6c) }, // -1903
+  { teju_literal2(0xff6120aec808efb3, 0xb207c25f3beb63f4), teju_literal2(0xf40577a0c5984f47, 0x42de9d0f6189125e) }, // -1935
+  { teju_literal2(0x745f4b3a58e025ec, 0x47591cfc0c560363), teju_literal2(0x9663c81aa6bcf878, 0x10b9dcacd117b9df) }, // -1967
+  { teju_literal2(0x5fdc9a93cd5ddfee, 0x22d7d83c95aead93), teju_literal2(0xb95ea50b1bfd01da, 0xa1f54c583bbfbcba) }, // -1999
+  { teju_literal2(0xfd973fa7db41539c, 0x38ed911cec4613c4), teju_literal2(0xe47c5d9719a00f5a, 0x6a0f7f5916238756) }, // -2031
+  { teju_literal2(0x663608c783eeedb4, 0x28260df91abfc39e), teju_literal2(0x8cd0b417d39fe54a, 0x7734c6b5d9a934c6) }, // -2063
+  { teju_literal2(0xb237eedf215bd6d4, 0x94376a97a8989957), teju_literal2(0xad9175257b5c818a, 0x8d57c911af0068bd) }, // -2095
+  { teju_literal2(0xaa919492db9b0b28, 0xd047589dc3907a41), teju_literal2(0xd5f07708e7257017, 0x33045380e2dfe905) }, // -2127
+  { teju_literal2(0x484bed8254a4171a, 0x2782cf4f22197a14), teju_literal2(0x83d9ac2c1a288c93, 0x0d7c09fd1854fd18) }, // -2159
+  { teju_literal2(0xaf9d55bb99a26460, 0xf4642a8760df714a), teju_literal2(0xa2849d12811acd73, 0xd1414d6ab777475a) }, // -2191
+  { teju_literal2(0x2ddab3d53dc58090, 0x55b61b234f268eb5), teju_literal2(0xc851a53f3256656d, 0xa4fc6bafd959da28) }, // -2223
+  { teju_literal2(0x4c651bd8c6d05c6f, 0x4829239c83622cd5), teju_literal2(0xf6e9821d5f7d8f89, 0xdf6922166f06ed0b) }, // -2255
+  { teju_literal2(0x1c00fc20b86daf97, 0xd00e493ba2827d7e), teju_literal2(0x982bddfb243ba7a4, 0xd133fa01bee9c6f4) }, // -2287
+  { teju_literal2(0x8a2dd242de1ba275, 0x8dfbf92494638cd7), teju_literal2(0xbb90d03ce63472e6, 0xc03bf6b0fc6b2cd8) }, // -2319
+  { teju_literal2(0x0c349bc993f5a45b, 0x08ca3c20511aa530), teju_literal2(0xe7314ac357420f85, 0xc7a316e8f046682a) }, // -2351
+  { teju_literal2(0x74cef8c5154fcb27, 0x8ade121e9705cf3c), teju_literal2(0x8e7bc09c83efcca7, 0xe6499582abe43581) }, // -2383
+  { teju_literal2(0x63df9b2fe264d778, 0xeb1ebdb78de6d587), teju_literal2(0xaf9fd604dfd290fe, 0x1aef73741ae8948e) }, // -2415
+  { teju_literal2(0x4f509493259368ae, 0x109810dd4af1a084), teju_literal2(0xd87946c622ae93c4, 0xd0107abc3f99157f) }, // -2447
+  { teju_literal2(0x5c2ff565eed2283e, 0xf4072b0d2b6b6ea8), teju_literal2(0x8569889322e3c5f3, 0xb174f0759580287e) }, // -2479
+  { teju_literal2(0x14b556b7961ffb17, 0x8e1ff2895422f811), teju_literal2(0xa4717af095a01f25, 0xfc8794ad3f299058) }, // -2511
+  { teju_literal2(0x08f0b6630ec29538, 0x36e2936452503223), teju_literal2(0xcab1268bbab6208f, 0x18c4c651ce378c78) }, // -2543
+  { teju_literal2(0x3f54c896f6e9137f, 0x5e77d86033b1489c), teju_literal2(0xf9d650ea71762f8a, 0x1cafdda8c52099cb) }, // -2575
+  { teju_literal2(0x1340743418fbc6b6, 0x543364673c455b1d), teju_literal2(0x99f95b05ffb7523b, 0x0e2d7ca2cbfc14e0) }, // -2607
+  { teju_literal2(0x25e8049fbae4cf09, 0xd8642ba3a777f663), teju_literal2(0xbdc9a450c37157ba, 0xa498db8c4372771c) }, // -2639
+  { teju_literal2(0x39a628648590bcfc, 0x1c7d65b732d1f3c1), teju_literal2(0xe9ee6d5dd52b7f1f, 0xe084948e8a4a3788) }, // -2671
+  { teju_literal2(0x53d1fad383215aa1, 0x8d1fca5da06c7c98), teju_literal2(0x902bdc3c8102f0b6, 0x2b81ccc1c4b02c07) }, // -2703
+  { teju_literal2(0xec4eeed7251f8d71, 0xd65cd9335aaf3547), teju_literal2(0xb1b4733bdd84ae7a, 0x28e628ce0f99b8b1) }, // -2735
+  { teju_literal2(0xf3d7e4c0c49da507, 0x318ca583616a9f08), teju_literal2(0xdb09c62824bceced, 0xd096867263eaa1bf) }, // -2767
+  { teju_literal2(0x46058fa8655aafdd, 0xc9ff824f443fb8d3), teju_literal2(0x86fe21a199ea61d0, 0x6f4f485a55dd03d8) }, // -2799
+  { teju_literal2(0x2a4849a465d0eb2a, 0xcc8c483cd72aa87f), teju_literal2(0xa6642f84ce512a08, 0xa2c4132ca4c2fc38) }, // -2831
+  { teju_literal2(0x3c7b56800d90a7b2, 0x8afb8eb6fc44c4e9), teju_literal2(0xcd17da380ba51f58, 0xf2032a894f56109a) }, // -2863
+  { teju_literal2(0x75cdba23b7e8ef0f, 0x0befe292210822ab), teju_literal2(0xfccbfe9e4a633910, 0x5c5c483a881ea4b4) }, // -2895
+  { teju_literal2(0x3f4c4cf6e5fc1c0f, 0x339af1b64396f9a6), teju_literal2(0x9bcc4f9def43b8db, 0xfde84c552a4949bb) }, // -2927
+  { teju_literal2(0xb855917f2e161faf, 0xc4b9321923f61d2d), teju_literal2(0xc0093579152f1637, 0xc6c6cad4155d177b) }, // -2959
+  { teju_literal2(0x8679c55dd3de9997, 0xb9b1a86bdd9db7c3), teju_literal2(0xecb3de4b8fde61c5, 0x7db6be4d04685651) }, // -2991
+  { teju_literal2(0xb09c8ddee275b7b6, 0x9ba39cd7505c68cb), teju_literal2(0x91e1164f72ce76dc, 0x33cfb38db4d9111f) }, // -3023
+  { teju_literal2(0x870b51121c0f86bf, 0xc58eb9b0973dedc7), teju_literal2(0xb3cf5fb3aa2eaa6d, 0x4178276c2bb9df64) }, // -3055
+  { teju_literal2(0x3ac67777e8f2ad99, 0x6c18f5b7827c8387), teju_literal2(0xdda20c7e2dcd9769, 0xf16d4b8d06ee7354) }, // -3087
+  { teju_literal2(0x6c2c529044be455c, 0xb5553b03f2e617e3), teju_literal2(0x889785b51995990e, 0x73d4d83b444fab48) }, // -3119
+  { teju_literal2(0x4ea525edbca70790, 0x87f374293818450e), teju_literal2(0xa85ccc842a0c4d8d, 0xb1c0bd87e156ad99) }, // -3151
+  { teju_literal2(0x4087633aec252f04, 0x2c065012cfa30379), teju_literal2(0xcf85d6177e564925, 0x49b4086188fce331) }, // -3183
+  { teju_literal2(0xf17b239a9b999810, 0x0956fb56ae2cffb7), teju_literal2(0xffcaa61fda90b795, 0x491ad455ab2aa00e) }, // -3215
+  { teju_literal2(0x75bd9c1967db3233, 0x7b59cf411ef2e283), teju_literal2(0x9da4cc575a362597, 0x2d0f5c876d06b7b2) }, // -3247
+  { teju_literal2(0x1742cbd92e50287d, 0x2be0537d5b9703a6), teju_literal2(0xc24f98257d11b08a, 0x8f5f8b822f591072) }, // -3279
+  { teju_literal2(0x78ff0f92a3b5cf89, 0x504ea5c6d7837d15), teju_literal2(0xef81b6bd03266277, 0xc10ba8997903a0b4) }, // -3311
+  { teju_literal2(0xf7d77ad00aea4299, 0x7b8fa822986f4490), teju_literal2(0x939b7e5b88a3da74, 0x64e8546cbc768f4e) }, // -3343
+  { teju_literal2(0x91ef7506715c9d81, 0xa35e47e0cdcd9560), teju_literal2(0xb5f0ae8ed56f0ae3, 0x1985c8508443835a) }, // -3375
+  { teju_literal2(0x6f6650374c5d58dc, 0x35856fa8ec1c33fb), teju_literal2(0xe042315e2f2fe795, 0x1353817373416ea1) }, // -3407
+  { teju_literal2(0x9e9c4d73c4e8af1f, 0xd7b05f8162ba7ffe), teju_literal2(0x8a35c356cd4596ef, 0x8c7d73142b668250) }, // -3439
+  { teju_literal2(0x076e407683c6c4eb, 0x7be31112124e3e47), teju_literal2(0xaa5b63d95adabe5e, 0x3cb0a68c1ca3920d) }, // -3471
+  { teju_literal2(0xbf00c6e049a45c75, 0xb0f5392261ffd0a0), teju_literal2(0xd1fb303f9cada975, 0x49740e5c14c0bb0a) }, // -3503
+  { teju_literal2(0x60e8d08b36dbd4f6, 0x8d6dc02a9e8ed8fe), teju_literal2(0x81693153d41e5d28, 0x730e2f958841b119) }, // -3535
+  { teju_literal2(0x80a5ec39599b4ad4, 0x7a0a48d077896f80), teju_literal2(0x9f82e1f8efd909f2, 0x2f4bda368de5b3b7) }, // -3567
+  { teju_literal2(0x7cd592df9c925518, 0xa896836ec8eded3c), teju_literal2(0xc49ce10396a6d1e5, 0xc0c37459c284b5dd) }, // -3599
+  { teju_literal2(0x49013babffde2948, 0x0127442a91a626c6), teju_literal2(0xf258102f0f0e7c5a, 0x93e0a8a4d71b4bca) }, // -3631
+  { teju_literal2(0x73ca24ab1ec4aac3, 0xbab576abb66c1113), teju_literal2(0x955b2416064c61a4, 0xacd17697f8708a23) }, // -3663
+  { teju_literal2(0x6f40de6ebf15e5df, 0x8700823899be2548), teju_literal2(0xb8187329f6b4a487, 0xe8086d8da90c738a) }, // -3695
+  { teju_literal2(0x410e24c16e22cba0, 0xd371a60e8d2e6c34), teju_literal2(0xe2ea4ca5a16773a2, 0x770819096ea8edee) }, // -3727
+  { teju_literal2(0x052c2b1f8d6d57ac, 0xb16f72e074337f09), teju_literal2(0x8bd8e93bf58123a8, 0x755b5d2a81a6f1c5) }, // -3759
+  { teju_literal2(0x462a4cbf60c8f78b, 0x26a85c9e6162f347), teju_literal2(0xac6007a568cb6993, 0xc60de5d34d3ce177) }, // -3791
+  { teju_literal2(0x176f4c6bf1951f33, 0xa3acc8af5bf6aa58), teju_literal2(0xd477ff08e9fc6c78, 0xf3f09dc9df46cd77) }, // -3823
+  { teju_literal2(0x2417c0aa7731e697, 0xf4037d94d1ed8619), teju_literal2(0x82f1a7e06381f4d0, 0xc90abdcee5ae4987) }, // -3855
+  { teju_literal2(0xfb4f235c60a0fa36, 0xa48dd8982b2a269c), teju_literal2(0xa166a17c3fe8a4ee, 0xae95e02b27439b75) }, // -3887
+  { teju_literal2(0x5d770f4ce92e0218, 0xb875570b2eafe047), teju_literal2(0xc6f124ffb35a30de, 0x3af4390ad93b01ee) }, // -3919
+  { teju_literal2(0x525671f5ba6b7fb5, 0x6ba798979d8fd80e), teju_literal2(0xf537046bdf8d0077, 0xd40edb702efa0000) }, // -3951
+  { teju_literal2(0xc5d2783c12853ee8, 0x921e9cfd9b90fcaa), teju_literal2(0x97201763d2d0816f, 0x13bb47f4ad17b397) }, // -3983
+  { teju_literal2(0x988935a78beb5937, 0x98e4d010d836b6d9), teju_literal2(0xba46c11c5d3babf9, 0xcdde654ce0c444d8) }, // -4015
+  { teju_literal2(0xbc5c2ff56f995e42, 0xea81d52589baaf70), teju_literal2(0xe59a767a5d18451a, 0x7f2ccd0794d5beb6) }, // -4047
+  { teju_literal2(0x119525ce9b365075, 0x83a8a9dc2044faf3), teju_literal2(0x8d8106466da5ffa3, 0x2c0b16049f55f606) }, // -4079
+  { teju_literal2(0xc5ecbe8cbbab3586, 0xf03091bc157017e5), teju_literal2(0xae6aca4056bbbb74, 0x0d95bc57b0b905d1) }, // -4111
+  { teju_literal2(0x64e61ccd198ab905, 0xeee9b37dd9fed970), teju_literal2(0xd6fc590fae1d9f63, 0x38a54cddb0f68c19) }, // -4143
+  { teju_literal2(0x8cd6a2ca83e629aa, 0x796f19a49867941f), teju_literal2(0x847ec4a4e91e3c61, 0x6fbbec3af2869ffa) }, // -4175
+  { teju_literal2(0xe0bb75e9768f97fd, 0xed66af8247dbff6a), teju_literal2(0xa3501c0e54de1b17, 0x7b06beef23b5d2a6) }, // -4207
+  { teju_literal2(0x25e3eb45914ab6a0, 0xf5c26c1e484b78d7), teju_literal2(0xc94c794598a3f3d2, 0x3a857f556a15cd7c) }, // -4239
+  { teju_literal2(0x08596a85a556c9ba, 0x5411f4e1ddb10c53), teju_literal2(0xf81ead8bd6ee3251, 0x0f2779bdd1fa8b6f) }, // -4271
+  { teju_literal2(0x2326859e95b57ffc, 0x93529cd9313ecd83), teju_literal2(0x98ea685a08f042c5, 0xa185ca655dab03e0) }, // -4303
+  { teju_literal2(0xaa7f9b886cfe360b, 0x95d28c56af8ac6cd), teju_literal2(0xbc7bac38c2207f0f, 0x559907db159eeeba) }, // -4335
+  { teju_literal2(0xefc6a0268fca4f37, 0x3315c5748bea22cb), teju_literal2(0xe852c74b7684e63c, 0x48aa380ddb0deef1) }, // -4367
+  { teju_literal2(0x7b62a54ed6233032, 0x9a3481b1fba6dac3), teju_literal2(0x8f2e2985332eae98, 0x75458a1c8300e014) }, // -4399
+  { teju_literal2(0x3a6b06d53ef38dfb, 0x3e7c9fd201697fa8), teju_literal2(0xb07bbe39c914237f, 0x016917ac58b689c9) }, // -4431
+  { teju_literal2(0xfc8b17ad90f9dd50, 0xd9670effce338adb), teju_literal2(0xd9885534c2faeabc, 0x259133c075f62351) }, // -4463
+  { teju_literal2(0x9bc2d0bee39d9c6d, 0xe66afa80654aafa8), teju_literal2(0x861095baf5242bb8, 0x47d929ad08922aaf) }, // -4495
+  { teju_literal2(0x273997e78dc23b70, 0x91a1fe21fd6b12ea), teju_literal2(0xa53f6310500e7b08, 0xa5d2ad8228202cac) }, // -4527
+  { teju_literal2(0xe1e195782f5f0134, 0x5767d33766a2683f), teju_literal2(0xcbaef3414077d804, 0x4cfe7157a7c10967) }, // -4559
+  { teju_literal2(0xe5de05155c79cbc8, 0xf8b64847df2816dc), teju_literal2(0xfb0f25f67b05cdfb, 0xcfbc2ecd1116e643) }, // -4591
+  { teju_literal2(0xb82c72ced11b511a, 0x4372be14807a8f1a), teju_literal2(0x9aba273e8951c9cc, 0x354e8bea0fcf2a4b) }, // -4623
+  { teju_literal2(0x90d0726ecc7cf773, 0xa4f34a42ae40ed72), teju_literal2(0xbeb7488dfc8e78ad, 0x52b328eee13169b1) }, // -4655
+  { teju_literal2(0xcf4f81ac2ba25b95, 0x11d25874a6f3f456), teju_literal2(0xeb1357d21ba61658, 0x0a8da18e1c35b584) }, // -4687
+  { teju_literal2(0x6f262e359278c00e, 0x74219f58baef5303), teju_literal2(0x90e06234ee928010, 0xfd56108c03e9393d) }, // -4719
+  { teju_literal2(0x9e64d1684b1c06c7, 0x02c41e5140b84275), teju_literal2(0xb292f659ae7e415c, 0xd696b92d60ed0ee5) }, // -4751
+  { teju_literal2(0x358155820507ed3a, 0x5c48c6bd76be94bb), teju_literal2(0xdc1c0a9e648092c1, 0xf8d8acceb3088534) }, // -4783
+  { teju_literal2(0x18b44eed4db6d10d, 0x1b369b7dbc47201b), teju_literal2(0x87a72966da73d103, 0x9bc6a3bca0209943) }, // -4815
+  { teju_literal2(0x047f0a3c6afc5f4f, 0x13a6fef6e3c65898), teju_literal2(0xa734881807a33983, 0xe69237dd4f248c86) }, // -4847
+  { teju_literal2(0x6b8b1be71ed2192c, 0x04e6c148a0f6222e), teju_literal2(0xce18a89f9bfbf08c, 0xafecb10991d4f53a) }, // -4879
+  { teju_literal2(0xd5d2902400da1d18, 0xaa736b12e8560b19), teju_literal2(0xfe088863652fe3c2, 0x5b7a59c9c347c420) }, // -4911
+  { teju_literal2(0x2caeec18d1137261, 0xe3d1b54e3a326f19), teju_literal2(0x9c8f64888e6b3001, 0x5a6f3a38fc14c5e0) }, // -4943
+};
+
+static teju_constexpr const teju_u1_t pow5[] = {
+  teju_literal2(0x0000000000000000, 0x0000000000000001), // 0
+  teju_literal2(0x0000000000000000, 0x0000000000000005), // 1
+  teju_literal2(0x0000000000000000, 0x0000000000000019), // 2
+  teju_literal2(0x0000000000000000, 0x000000000000007d), // 3
+  teju_literal2(0x0000000000000000, 0x0000000000000271), // 4
+  teju_literal2(0x0000000000000000, 0x0000000000000c35), // 5
+  teju_literal2(0x0000000000000000, 0x0000000000003d09), // 6
+  teju_literal2(0x0000000000000000, 0x000000000001312d), // 7
+  teju_literal2(0x0000000000000000, 0x000000000005f5e1), // 8
+  teju_literal2(0x0000000000000000, 0x00000000001dcd65), // 9
+  teju_literal2(0x0000000000000000, 0x00000000009502f9), // 10
+  teju_literal2(0x0000000000000000, 0x0000000002e90edd), // 11
+  teju_literal2(0x0000000000000000, 0x000000000e8d4a51), // 12
+  teju_literal2(0x0000000000000000, 0x0000000048c27395), // 13
+  teju_literal2(0x0000000000000000, 0x000000016bcc41e9), // 14
+  teju_literal2(0x0000000000000000, 0x000000071afd498d), // 15
+  teju_literal2(0x0000000000000000, 0x0000002386f26fc1), // 16
+  teju_literal2(0x0000000000000000, 0x000000b1a2bc2ec5), // 17
+  teju_literal2(0x0000000000000000, 0x000003782dace9d9), // 18
+  teju_literal2(0x0000000000000000, 0x00001158e460913d), // 19
+  teju_literal2(0x0000000000000000, 0x000056bc75e2d631), // 20
+  teju_literal2(0x0000000000000000, 0x0001b1ae4d6e2ef5), // 21
+  teju_literal2(0x0000000000000000, 0x000878678326eac9), // 22
+  teju_literal2(0x0000000000000000, 0x002a5a058fc295ed), // 23
+  teju_literal2(0x0000000000000000, 0x00d3c21bcecceda1), // 24
+  teju_literal2(0x0000000000000000, 0x0422ca8b0a00a425), // 25
+  teju_literal2(0x0000000000000000, 0x14adf4b7320334b9), // 26
+  teju_literal2(0x0000000000000000, 0x6765c793fa10079d), // 27
+  teju_literal2(0x0000000000000002, 0x04fce5e3e2502611), // 28
+  teju_literal2(0x000000000000000a, 0x18f07d736b90be55), // 29
+  teju_literal2(0x0000000000000032, 0x7cb2734119d3b7a9), // 30
+  teju_literal2(0x00000000000000fc, 0x6f7c40458122964d), // 31
+};
+
+static teju_constexpr const uint32_t corrections[] = {
+  0x6aaaaa99,
+  0x96aa9699,
+  0x55555555,
+  0x55555555,
+  0x5aa55999,
+  0x5a9a99aa,
+  0xa9a699a5,
+  0x695696a9,
+  0x99a55669,
+  0x59a65965,
+  0x55555555,
+  0x55555555,
+  0x56559955,
+  0x6a566569,
+  0x55555555,
+  0x55555555,
+  0x5a956555,
+  0x599a55a9,
+  0xaaaa5a65,
+  0x69aa9aaa,
+  0x659a9999,
+  0x9a6a9a9a,
+  0x9a65aaa9,
+  0x66a969a5,
+  0x55555955,
+  0x56565565,
+  0x55a65aa9,
+  0xa5959559,
+  0xae6aeaa9,
+  0xaaaaaaaa,
+  0x95595955,
+  0x55559556,
+  0x66669965,
+  0x56655665,
+  0x69599aa9,
+  0x59699659,
+  0xa9596559,
+  0x965565a5,
+  0xeaaeaaa9,
+  0xaaaa9eaa,
+  0x55555555,
+  0x55555559,
+  0x56a65a95,
+  0xa6a96aa9,
+  0xeaaaeae9,
+  0xeaeaaaaa,
+  0x99aa9a95,
+  0xa5aa669a,
+  0x595966a5,
+  0xa6665566,
+  0x55565955,
+  0x5a956a59,
+  0x6aaaaba9,
+  0xbaaaaa5a,
+  0x5a5566a9,
+  0x56666559,
+  0x55566595,
+  0x59a5a555,
+  0xaa959969,
+  0x55a99a56,
+  0xa699a699,
+  0xaa6a9a66,
+  0x9a6a9599,
+  0x55655556,
+  0x99aa69a5,
+  0x65a65aa6,
+  0x6aa69ea9,
+  0xa9a6a6aa,
+  0x555555a9,
+  0x6696a566,
+  0x95596955,
+  0xa6a6a5a6,
+  0x6aabaaa9,
+  0xaaabeaae,
+  0x55555555,
+  0x55559555,
+  0x9659a565,
+  0x56566a96,
+  0x9a9a65a9,
+  0x9a69696a,
+  0x6aaa9a99,
+  0x9aaaa7ae,
+  0xa966aa69,
+  0x6a5aa596,
+  0xabeeeeb9,
+  0xbaeaaeaa,
+  0xaaa65a79,
+  0xa566aaa9,
+  0xa9a9ab99,
+  0x6aaaa5aa,
+  0x9a696aa5,
+  0xa5999a96,
+  0x6aa6aaa9,
+  0xa9aaa6aa,
+  0x5965a699,
+  0xa9669569,
+  0xaaaaa9a9,
+  0x9a5a69aa,
+  0xfaabaab9,
+  0xbaeaaaaa,
+  0x66959a95,
+  0x566aa69a,
+  0x99555555,
+  0x55555696,
+  0x9a5655a5,
+  0x56555569,
+  0xa6565969,
+  0x96665556,
+  0xa9a5aaa9,
+  0xaa6a6a6a,
+  0xaa9aa9a5,
+  0xaa6aaa9a,
+  0x59559695,
+  0x65555955,
+  0x9a66aa99,
+  0x9aaaaaa6,
+  0x965aaa99,
+  0xaaaaa59a,
+  0xaaabaaa5,
+  0xaaab9eba,
+  0x65655555,
+  0x55596659,
+  0x66a56565,
+  0x956a6a55,
+  0xe6aa9a69,
+  0xaaaa9aba,
+  0x69aa5969,
+  0xa6a9a659,
+  0x95559959,
+  0x65999595,
+  0x6a99a5a9,
+  0xaa996559,
+  0x5596a955,
+  0x95995665,
+  0x9a59a555,
+  0x56599559,
+  0xaa9a6aa5,
+  0x696aa596,
+  0xaaaaaaa9,
+  0xaabaeaaa,
+  0x6669a5a9,
+  0xa959a669,
+  0xaa9aaa95,
+  0xa69aa9aa,
+  0x996a5a55,
+  0xa96a5a5a,
+  0xaaebea99,
+  0x6ab9aaaa,
+  0x55555555,
+  0x55595aa5,
+  0x65aa5555,
+  0x55959555,
+  0xaaaaaba9,
+  0xaafaaaaa,
+  0x55556555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55565695,
+  0x65555565,
+  0x566a9a59,
+  0x9aaaab9e,
+  0x56555555,
+  0x55556555,
+  0xa5aaa969,
+  0x9a955966,
+  0xaa9aa699,
+  0x5995a569,
+  0x6695a669,
+  0x95a966a9,
+  0xaaaebae5,
+  0xb9aaaaaa,
+  0xaa655a65,
+  0x5555595a,
+  0x9a655a59,
+  0x55556555,
+  0x59555655,
+  0x555a5559,
+  0xaaa6aa65,
+  0xaaaa9aaa,
+  0x665969a5,
+  0x59956595,
+  0x99696a65,
+  0x96aa5556,
+  0xfaa79aa9,
+  0xa9aaaeaa,
+  0x6aa69a99,
+  0x6965965a,
+  0x9a65a5a9,
+  0x9a59aa5a,
+  0xaaafbea9,
+  0x6aaaae6a,
+  0xa9a59665,
+  0x69695669,
+  0x6aa996a9,
+  0xaa9a66aa,
+  0x55555555,
+  0x55555555,
+  0x65555655,
+  0x5565a955,
+  0x55555655,
+  0x9a955565,
+  0xa65aa9a5,
+  0xa6a9a6aa,
+  0x5a559955,
+  0xa5956665,
+  0x79a9aa69,
+  0xae66aaaa,
+  0x99556569,
+  0xa699a566,
+  0x959aaa99,
+  0x59956699,
+  0xaaabaab9,
+  0xaeaaaaae,
+  0xaaaaa6a5,
+  0x995965aa,
+  0x95555a55,
+  0x55555599,
+  0xaaeaaea9,
+  0xbaeaaaaa,
+  0x55569655,
+  0x696a5696,
+  0x959a5aa5,
+  0x96555599,
+  0xfaaaaa69,
+  0xbabbaaaa,
+  0xa9aa96a5,
+  0xa559a6a5,
+  0xaaa9a9a5,
+  0xaaaaa9aa,
+  0xeaabbaa9,
+  0xaaa6aab9,
+  0xa9a7aa99,
+  0xaa69aaaa,
+  0x55555555,
+  0x55555555,
+  0x9a9aa695,
+  0xaa66996a,
+  0x6a655665,
+  0x5a956555,
+  0xa9555555,
+  0x96999569,
+  0x565955a5,
+  0xaaaa6aa9,
+  0xbaeaaea9,
+  0xbaaa9aaa,
+  0x66695a95,
+  0x665555aa,
+  0x56995595,
+  0x56965a66,
+  0x96595555,
+  0x9565559a,
+  0x5a555555,
+  0x95559556,
+  0x9a699a59,
+  0x96aa5aa6,
+  0x55555559,
+  0x55596559,
+  0x5596a965,
+  0x55655956,
+  0x56595655,
+  0x55559595,
+  0x55599555,
+  0x56555555,
+  0x5656a955,
+  0x69aa565a,
+  0x55699555,
+  0x6556655a,
+  0x55555555,
+  0x55555555,
+  0x95656995,
+  0x569a6599,
+  0xa5655a95,
+  0x5aa59659,
+  0xaaaaaba9,
+  0xaa6aa5a6,
+  0x5959a6a9,
+  0x65569555,
+  0xaaea9fa9,
+  0xaaaaaaaa,
+  0x559566a5,
+  0x56695956,
+  0x9aa55555,
+  0x66965596,
+  0x55555555,
+  0x55595565,
+  0x9aa9aaa9,
+  0xaabaaaaa,
+  0xa55a69a9,
+  0x95599599,
+  0x5565a565,
+  0x69655a96,
+  0x69aaa6a9,
+  0x6aa95aa9,
+  0x59aa9aa9,
+  0xa65aa9aa,
+  0xabaeaaa9,
+  0xaaaaae6a,
+  0xa6aa9a69,
+  0xa9a5a656,
+  0xaa59aa95,
+  0x596955a5,
+  0x65595595,
+  0x96a95565,
+  0x6595a595,
+  0xa56a6969,
+  0x95555555,
+  0xaaaaaaa9,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x959a5599,
+  0x95595556,
+  0x65595555,
+  0x55555555,
+  0x95666599,
+  0x59959555,
+  0x55555555,
+  0x55555996,
+  0xaa699555,
+  0x5a95a655,
+  0xaa565599,
+  0x65aa56a9,
+  0x5a659655,
+  0x9a695559,
+  0x66696699,
+  0x566aa9aa,
+  0xa9a6a9a5,
+  0x69a6aa6a,
+  0x5a5a65a5,
+  0x955a966a,
+  0x5aa9a965,
+  0xaaaa59aa,
+  0xaaefaab9,
+  0x7aea9eaa,
+  0x69a999a5,
+  0x5959a59a,
+  0x5a6aa6a9,
+  0xaaaa65aa,
+  0x69aa6aa9,
+  0x9a9995a5,
+  0xaeebaea9,
+  0xaaeaa79e,
+  0x5aa55695,
+  0x5a5aa565,
+  0x59555555,
+  0x55555555,
+  0x9a555aa5,
+  0x56999a99,
+  0xa96966a9,
+  0x99569969,
+  0x9aa5a5a9,
+  0x69a5a599,
+  0x96595669,
+  0xa56a5565,
+  0x6a5aaa69,
+  0x956a6695,
+  0x5a66a6a9,
+  0xa5aa65aa,
+  0x569559a5,
+  0x56a56555,
+  0xa6eaaaa9,
+  0xaaa6a6aa,
+  0x95959555,
+  0x9996a555,
+  0x55555595,
+  0x95555565,
+  0xaaaaaea9,
+  0xbaabae7e,
+  0x55656a65,
+  0x66565955,
+  0x69a66a55,
+  0x9aa96955,
+  0xaa9eaaa5,
+  0x69aaaaa9,
+  0x55999555,
+  0x966599a5,
+  0xa9a99a59,
+  0xaa55669a,
+  0x5a965695,
+  0x556a9599,
+  0x55569595,
+  0x55555956,
+  0x95655559,
+  0x5a956555,
+  0x9a995aa5,
+  0xaa9a5a59,
+  0xa6eaaa69,
+  0x7aaa9aba,
+  0x56559a55,
+  0x59559a55,
+  0x55569695,
+  0x6a95a965,
+  0xaaa6aaa9,
+  0xaaaa99aa,
+  0xaaaa9595,
+  0x6aa5665a,
+  0x65555555,
+  0x55555a65,
+  0xabeaaaa5,
+  0xaaaaae6a,
+  0xa9a69969,
+  0x6a66a569,
+  0x95656655,
+  0x6966a565,
+  0x59aa6559,
+  0x56699a56,
+  0x596a65a9,
+  0xaaaa9a59,
+  0x99a56965,
+  0x9a655999,
+  0x55a95555,
+  0x55556555,
+  0xaaaa99a5,
+  0xaaaa5aaa,
+  0xaaa69a59,
+  0x6aaa96aa,
+  0x96aaa699,
+  0x599a6aa5,
+  0xa69a6aa5,
+  0x65a699aa,
+  0x95555555,
+  0x55655555,
+  0xaaaaaaa9,
+  0xaa7aa5aa,
+  0x99565555,
+  0x5555a55a,
+  0x59996969,
+  0xa96a5a5a,
+  0x5a659669,
+  0xa9665565,
+  0xa696a555,
+  0x556a6a95,
+  0x65565965,
+  0xaaa95569,
+  0xaaa9a6a9,
+  0xa5699aaa,
+  0x9a6599a9,
+  0x9a9aa99a,
+  0x9aaa6955,
+  0xaaaaaaa9,
+  0x5aa55a69,
+  0xaa555556,
+  0x596aaa99,
+  0xa9969656,
+  0x6a659555,
+  0x9a59a659,
+  0x595a5565,
+  0x56595659,
+  0xa655aaa9,
+  0xa5a99a69,
+  0x55596595,
+  0x65599996,
+  0xeaabeeb9,
+  0xaaebeeba,
+  0x569a5599,
+  0x59569665,
+  0xaa696a99,
+  0xaaaaa9a6,
+  0xebafba69,
+  0xbaabeeaa,
+  0x59a99a55,
+  0x5a659996,
+  0x55669659,
+  0x5959aaa9,
+  0x5565a565,
+  0x55659555,
+  0xa9aaaaa9,
+  0x6eaaa6aa,
+  0xaa699699,
+  0xa9aa9965,
+  0xaa9666a9,
+  0xaa9aaaa9,
+  0x55659555,
+  0x59555559,
+  0xa96a9959,
+  0xaa66a6a9,
+  0x55556555,
+  0x55555555,
+  0xfaafee79,
+  0xbaeaafae,
+  0x96a6a959,
+  0x99a6aa9a,
+  0x9a69a699,
+  0xaaaa6aaa,
+  0x5659a699,
+  0x56555555,
+  0x56a69969,
+  0xa9aa9695,
+  0xa66aaa99,
+  0x9aaa9a66,
+  0x6a9a6aa9,
+  0xa6aaa969,
+  0xa5695a59,
+  0x59a66965,
+  0x95a59955,
+  0x69955655,
+  0x566959a5,
+  0xa59aa69a,
+  0x55555555,
+  0x55555555,
+  0x55555555,
+  0x55955555,
+  0x5955a555,
+  0xa6569565,
+  0x9a95a5a5,
+  0xaa965969,
+  0x55555555,
+  0x55555559,
+  0x6aaaaa69,
+  0x6aaaa5aa,
+  0x56966595,
+  0xa56a696a,
+  0x65596655,
+  0x5965a5a5,
+  0x595aaa95,
+  0xaaaaaaaa,
+  0x55665655,
+  0x55555565,
+  0xaaabaeb9,
+  0xaaabaeae,
+  0xbaeaaaa9,
+  0xaaaaa6aa,
+  0x565aa655,
+  0x5659a566,
+  0xabaaaab9,
+  0xeaaaae7a,
+  0x95955a55,
+  0x55596699,
+  0x5aa6aaa5,
+  0xaaaaaa9a,
+  0x59555955,
+  0x95555555,
+  0x95699a69,
+  0x5695a556,
+  0x59556555,
+  0xa69956a5,
+  0x669a6aa5,
+  0xa659a9a6,
+  0x55555555,
+  0x55555555,
+  0x6aa6a559,
+  0x9a659666,
+  0x55a5a595,
+  0x555a5555,
+  0xa6596995,
+  0xa96656aa,
+  0xb9aa9aa5,
+  0xaaa5aaaa,
+  0x65555659,
+  0xa9565955,
+  0xa9a9a5a9,
+  0x66a69555,
+  0xaaa6aa69,
+  0x69a6a696,
+  0x56655695,
+  0x55655655,
+  0x9a59a5a5,
+  0xa5aa69a6,
+  0xa56aa669,
+  0x6a965a56,
+  0xa65569a5,
+  0x6595999a,
+  0x55995555,
+  0x566a5555,
+  0x9aaaaa69,
+  0xaaaa9aaa,
+  0x565a66a9,
+  0x55aaaa59,
+  0x55a565a9,
+  0x56559599,
+  0x955a6569,
+  0x59565599,
+  0x55565595,
+  0x55555555,
+  0xaa6aa699,
+  0xaaaaaa9a,
+  0x55959555,
+  0x55555695,
+  0xa9aaa9a9,
+  0xa5aaaeaa,
+  0x55555555,
+  0x56555995,
+  0x55555555,
+  0x55555555,
+  0xaaa96a65,
+  0x65a6a96a,
+  0xa9a65665,
+  0x5655a696,
+  0x55655659,
+  0x5595555a,
+  0x55556555,
+  0x55555555,
+  0x65656555,
+  0x56555955,
+  0x55a55555,
+  0x555a5965,
+  0x96565999,
+  0x955955a5,
+  0xa5aa69a9,
+  0xa5a66aaa,
+  0x6a656a55,
+  0x56a59a99,
+  0x969a5999,
+  0x65a56a95,
+  0x9a999659,
+  0x6595a699,
+  0x55555555,
+  0x55555555,
+  0x556595a5,
+  0x59555555,
+  0x9a9a69a9,
+  0xaa66aa99,
+  0x0003aaa9,
+};
+
+#define teju_calculation_sorted 0u
+
+static teju_constexpr struct {
+  teju_u1_t const multiplier;
+  teju_u1_t const bound;
+} const minverse[] = {
+  { teju_literal2(0x0000000000000000, 0x0000000000000001), teju_literal2(0xffffffffffffffff, 0xffffffffffffffff) }, // 0
+  { teju_literal2(0xcccccccccccccccc, 0xcccccccccccccccd), teju_literal2(0x3333333333333333, 0x3333333333333333) }, // 1
+  { teju_literal2(0x28f5c28f5c28f5c2, 0x8f5c28f5c28f5c29), teju_literal2(0x0a3d70a3d70a3d70, 0xa3d70a3d70a3d70a) }, // 2
+  { teju_literal2(0x6e978d4fdf3b645a, 0x1cac083126e978d5), teju_literal2(0x020c49ba5e353f7c, 0xed916872b020c49b) }, // 3
+  { teju_literal2(0x495182a9930be0de, 0xd288ce703afb7e91), teju_literal2(0x0068db8bac710cb2, 0x95e9e1b089a02752) }, // 4
+  { teju_literal2(0xdb76b3bb83cf2cf9, 0x5d4e8fb00bcbe61d), teju_literal2(0x0014f8b588e368f0, 0x8461f9f01b866e43) }, // 5
+  { teju_literal2(0xc57e23f24d8fd5cb, 0x790fb65668c26139), teju_literal2(0x000431bde82d7b63, 0x4dad31fcd24e160d) }, // 6
+  { teju_literal2(0xc1193a63a91cc45b, 0xe5032477ae8d46a5), teju_literal2(0x0000d6bf94d5e57a, 0x42bc3d3290760469) }, // 7
+  { teju_literal2(0xf36b7213ee9f5a78, 0xc767074b22e90e21), teju_literal2(0x00002af31dc46118, 0x73bf3f70834acdae) }, // 8
+  { teju_literal2(0x97157d372fb9787e, 0x8e47ce423a2e9c6d), teju_literal2(0x0000089705f4136b, 0x4a59731680a88f89) }, // 9
+  { teju_literal2(0x516ab2a4a3251819, 0x4fa7f60d3ed61f49), teju_literal2(0x000001b7cdfd9d7b, 0xdbab7d6ae6881cb5) }, // 10
+  { teju_literal2(0x76aef08753d43805, 0x0fee64690c913975), teju_literal2(0x00000057f5ff85e5, 0x92557f7bc7b4d28a) }, // 11
+  { teju_literal2(0xb156301b10c40b34, 0x3662e0e1cf503eb1), teju_literal2(0x000000119799812d, 0xea11197f27f0f6e8) }, // 12
+  { teju_literal2(0x2377a3389cf4023d, 0xa47a2cf9f6433fbd), teju_literal2(0x0000000384b84d09, 0x2ed0384ca19697c8) }, // 13
+  { teju_literal2(0x0717ed71b8fd9a0c, 0x54186f653140a659), teju_literal2(0x00000000b424dc35, 0x095cd80f538484c1) }, // 14
+  { teju_literal2(0xce37fc49f1cc5202, 0x7738164770402145), teju_literal2(0x0000000024075f3d, 0xceac2b3643e74dc0) }, // 15
+  { teju_literal2(0xf60b3275305c1066, 0xe4a4d1417cd9a041), teju_literal2(0x000000000734aca5, 0xf6226f0ada6175f3) }, // 16
+  { teju_literal2(0x6468a3b109ac0347, 0xc75429d9e5c5200d), teju_literal2(0x000000000170ef54, 0x646d496892137dfd) }, // 17
+  { teju_literal2(0xe0e1ba569b88cd74, 0xc1773b91fac10669), teju_literal2(0x000000000049c977, 0x47490eae839d7f99) }, // 18
+  { teju_literal2(0x93605877b8b4f5e4, 0x26b172506559ce15), teju_literal2(0x00000000000ec1e4, 0xa7db69561a52b31e) }, // 19
+  { teju_literal2(0x83e011b18b576460, 0xd489e3a9addec2d1), teju_literal2(0x000000000002f394, 0x219248446baa23d2) }, // 20
+  { teju_literal2(0x4d9336bd1bde4746, 0x90e860bb892c8d5d), teju_literal2(0x000000000000971d, 0xa05074da7beed3f6) }, // 21
+  { teju_literal2(0xdc50a48c38c60e41, 0x502e79bf1b6f4f79), teju_literal2(0x0000000000001e39, 0x2010175ee5962a64) }, // 22
+  { teju_literal2(0x9276874f3e8e02d9, 0xdcd618596be30fe5), teju_literal2(0x000000000000060b, 0x6cd004ac94513bad) }, // 23
+  { teju_literal2(0xea17b4a972e933c5, 0x2c2ad1ab7bfa3661), teju_literal2(0x0000000000000135, 0x7c299a88ea76a589) }, // 24
+  { teju_literal2(0xfb9e575516fb70c1, 0x08d55d224bfed7ad), teju_literal2(0x000000000000003d, 0xe5a1ebb4fbb1544e) }, // 25
+  { teju_literal2(0x658611776aff168d, 0x01c445d3a8cc9189), teju_literal2(0x000000000000000c, 0x612062576589dda9) }, // 26
+  { teju_literal2(0xe11ad04b156637b5, 0xcd27412a54f5b6b5), teju_literal2(0x0000000000000002, 0x79d346de4781f921) }, // 27
+  { teju_literal2(0xf9d229a89de13e57, 0x8f6e403baa978af1), teju_literal2(0x0000000000000000, 0x7ec3daf941806506) }, // 28
+  { teju_literal2(0x31f6d521b92d0c77, 0xe97c733f221e4efd), teju_literal2(0x0000000000000000, 0x195a5efea6b34767) }, // 29
+  { teju_literal2(0xa397c439f1d5cf4b, 0x2eb27d7306d2dc99), teju_literal2(0x0000000000000000, 0x051212ffbaf0a7e1) }, // 30
+  { teju_literal2(0xed84c0d863912975, 0x6fbd4c4a34909285), teju_literal2(0x0000000000000000, 0x01039d66589687f9) }, // 31
+};
+
+#include "teju/src/teju.h"
+
+#ifdef __cplusplus
+}
+#endif
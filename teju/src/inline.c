@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/inline.c
+ *
+ * External definitions of the inline functions in the public headers.
+ *
+ * In C99, an inline function defined without extern in a header doesn't
+ * provide an external definition. Hence, when the compiler decides not to
+ * inline a call (e.g., in debug builds) the link fails unless exactly one
+ * translation unit provides the external definition. This is that translation
+ * unit.
+ */
+
+#include "teju/bfloat16.h"
+#include "teju/binary256.h"
+#include "teju/double.h"
+#include "teju/double_double.h"
+#include "teju/float.h"
+#include "teju/float16.h"
+#include "teju/float128.h"
+#include "teju/fp8.h"
+#include "teju/long_double.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern inline
+teju16_fields_t
+teju_bfloat16_to_binary(uint16_t bits);
+
+extern inline
+teju16_fields_t
+teju_bfloat16_to_decimal(uint16_t bits);
+
+extern inline
+teju16_fields_t
+teju_fp8_e4m3_to_binary(uint8_t bits);
+
+extern inline
+teju16_fields_t
+teju_fp8_e4m3_to_decimal(uint8_t bits);
+
+extern inline
+teju16_fields_t
+teju_fp8_e5m2_to_binary(uint8_t bits);
+
+extern inline
+teju16_fields_t
+teju_fp8_e5m2_to_decimal(uint8_t bits);
+
+extern inline
+teju32_fields_t
+teju_float_to_binary(float value);
+
+extern inline
+teju32_fields_t
+teju_float_to_decimal(float value);
+
+extern inline
+teju64_fields_t
+teju_double_to_binary(double value);
+
+extern inline
+teju64_fields_t
+teju_double_to_decimal(double value);
+
+#if defined(teju_has_float16)
+
+extern inline
+teju32_fields_t
+teju_float16_to_binary(float16_t value);
+
+extern inline
+teju32_fields_t
+teju_float16_to_decimal(float16_t value);
+
+#endif // defined(teju_has_float16)
+
+#if defined(teju_has_float128)
+
+extern inline
+teju128_fields_t
+teju_float128_to_binary(float128_t value);
+
+extern inline
+teju128_fields_t
+teju_float128_to_decimal(float128_t value);
+
+#endif // defined(teju_has_float128)
+
+#if defined(teju_has_x86_extended)
+
+extern inline
+teju128_fields_t
+teju_long_double_to_binary(long double value);
+
+extern inline
+teju128_fields_t
+teju_long_double_to_decimal(long double value);
+
+#endif // defined(teju_has_x86_extended)
+
+#if defined(teju_has_uint128)
+
+extern inline
+teju128_fields_t
+teju_double_double_to_binary(double hi, double lo);
+
+extern inline
+teju128_fields_t
+teju_double_double_to_decimal(double hi, double lo);
+
+#endif // defined(teju_has_uint128)
+
+#if defined(teju_has_uint256)
+
+extern inline
+teju256_fields_t
+teju_binary256_to_binary(uint256_t bits);
+
+extern inline
+teju256_fields_t
+teju_binary256_to_decimal(uint256_t bits);
+
+#endif // defined(teju_has_uint256)
+
+#ifdef __cplusplus
+}
+#endif
@@ -30,7 +30,7 @@ extern "C" {
  *
  * @returns The sum x + y.
  */
-static inline
+static inline teju_constexpr
 teju_u1_t
 teju_add_and_carry(teju_u1_t x, teju_u1_t y, teju_u1_t* c) {
 
@@ -67,7 +67,7 @@ teju_add_and_carry(teju_u1_t x, teju_u1_t y, teju_u1_t* c) {
  *
  * @returns M * m >> s.
  */
-static inline
+static inline teju_constexpr
 teju_u1_t
 teju_mshift(teju_u1_t const m, teju_multiplier_t const M) {
 
@@ -189,7 +189,7 @@ teju_mshift(teju_u1_t const m, teju_multiplier_t const M) {
  *
  * @returns The value of q.
  */
-static inline
+static inline teju_constexpr
 teju_u1_t
 mshift_pow2(uint32_t const k, teju_multiplier_t const M) {
 
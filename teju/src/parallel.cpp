@@ -0,0 +1,299 @@
+// SPDX-License-Identifier: APACHE-2.0
+// SPDX-FileCopyrightText: 2021-2025 Cassio Neri <cassio.neri@gmail.com>
+
+/**
+ * @file teju/src/parallel.cpp
+ *
+ * Implementation of teju/parallel.h.
+ *
+ * This is the only C++ translation unit of the library since there's no
+ * portable C99 way to create threads and to perform atomic operations.
+ */
+
+#include "teju/double.h"
+#include "teju/float.h"
+#include "teju/parallel.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief The number of bytes of input processed in each chunk.
+ *
+ * Input and output of a chunk together must fit comfortably in L2.
+ */
+std::size_t constexpr chunk_bytes = 32 * 1024;
+
+/**
+ * @brief A range [begin, end) of chunk indices which can be shrunk
+ *        concurrently from both ends.
+ *
+ * The owner pops chunks from the front and thieves steal from the back. Both
+ * ends are packed into a single 64-bit word so that either operation is a
+ * single compare-and-swap.
+ */
+struct alignas(64) range_t {
+
+  /**
+   * @brief Sets the range to [begin, end).
+   *
+   * @param  begin          The first index of the range.
+   * @param  end            The one-past-the-last index of the range.
+   */
+  void
+  assign(std::uint32_t const begin, std::uint32_t const end) noexcept {
+    bits.store(pack(begin, end), std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Takes the first chunk of the range.
+   *
+   * @param  chunk          On success, receives the index of the chunk.
+   *
+   * @returns true if a chunk has been taken and false if the range is empty.
+   */
+  bool
+  pop(std::uint32_t& chunk) noexcept {
+    auto current = bits.load(std::memory_order_relaxed);
+    for (;;) {
+      auto const begin = get_begin(current);
+      auto const end   = get_end(current);
+      if (begin >= end)
+        return false;
+      if (bits.compare_exchange_weak(current, pack(begin + 1, end),
+        std::memory_order_relaxed)) {
+        chunk = begin;
+        return true;
+      }
+    }
+  }
+
+  /**
+   * @brief Takes the last chunk of the range.
+   *
+   * @param  chunk          On success, receives the index of the chunk.
+   *
+   * @returns true if a chunk has been taken and false if the range is empty.
+   */
+  bool
+  steal(std::uint32_t& chunk) noexcept {
+    auto current = bits.load(std::memory_order_relaxed);
+    for (;;) {
+      auto const begin = get_begin(current);
+      auto const end   = get_end(current);
+      if (begin >= end)
+        return false;
+      if (bits.compare_exchange_weak(current, pack(begin, end - 1),
+        std::memory_order_relaxed)) {
+        chunk = end - 1;
+        return true;
+      }
+    }
+  }
+
+private:
+
+  static std::uint64_t
+  pack(std::uint32_t const begin, std::uint32_t const end) noexcept {
+    return std::uint64_t{begin} << 32 | end;
+  }
+
+  static std::uint32_t
+  get_begin(std::uint64_t const bits) noexcept {
+    return static_cast<std::uint32_t>(bits >> 32);
+  }
+
+  static std::uint32_t
+  get_end(std::uint64_t const bits) noexcept {
+    return static_cast<std::uint32_t>(bits);
+  }
+
+  std::atomic<std::uint64_t> bits{0};
+};
+
+/**
+ * @brief Gets the decimal representations of given values.
+ *
+ * @tparam TFloat           The type of values.
+ * @tparam TFields          The type of decimal representations.
+ * @tparam to_decimal       The function converting a single value.
+ */
+template <typename TFloat, typename TFields, TFields (*to_decimal)(TFloat)>
+class job_t {
+
+public:
+
+  /**
+   * @brief Constructor.
+   *
+   * @param  values         The given values.
+   * @param  decimals       The output array of decimal representations.
+   * @param  n              The number of values.
+   */
+  job_t(TFloat const* const values, TFields* const decimals,
+    std::size_t const n) noexcept :
+    values_  {values  },
+    decimals_{decimals},
+    n_       {n       } {
+  }
+
+  /**
+   * @brief Runs the job using a given number of threads.
+   *
+   * @param  threads        The number of threads or 0 for the number of CPUs.
+   */
+  void
+  run(unsigned threads) noexcept {
+
+    if (n_ == 0)
+      return;
+
+    // Ensures the number of chunks fits in the 32 bits available to range_t.
+    auto const min_size  = (n_ - 1) / UINT32_MAX + 1;
+    auto const size      = chunk_size < min_size ? min_size : chunk_size;
+    auto const n_chunks  = static_cast<std::uint32_t>((n_ - 1) / size + 1);
+
+    if (threads == 0)
+      threads = std::thread::hardware_concurrency();
+    if (threads > n_chunks)
+      threads = n_chunks;
+    if (threads <= 1)
+      return convert(0, n_);
+
+    auto ranges = std::unique_ptr<range_t[]>{new (std::nothrow)
+      range_t[threads]};
+    if (!ranges)
+      return convert(0, n_);
+
+    for (std::uint32_t i = 0; i < threads; ++i)
+      ranges[i].assign(
+        static_cast<std::uint32_t>(std::uint64_t{n_chunks} * i / threads),
+        static_cast<std::uint32_t>(std::uint64_t{n_chunks} * (i + 1) / threads)
+      );
+
+    size_     = size;
+    ranges_   = ranges.get();
+    n_ranges_ = threads;
+
+    // Threads that fail to start leave their ranges to be stolen by others.
+    std::vector<std::thread> workers;
+    try {
+      workers.reserve(threads - 1);
+      for (unsigned i = 1; i < threads; ++i)
+        workers.emplace_back(&job_t::work, this, i);
+    }
+    catch (...) {
+    }
+
+    work(0);
+
+    for (auto& worker : workers)
+      worker.join();
+  }
+
+private:
+
+  static std::size_t constexpr chunk_size = chunk_bytes / sizeof(TFloat);
+
+  /**
+   * @brief Converts values[begin, end).
+   *
+   * @param  begin          The first index.
+   * @param  end            The one-past-the-last index.
+   */
+  void
+  convert(std::size_t const begin, std::size_t const end) const noexcept {
+    for (std::size_t i = begin; i < end; ++i)
+      decimals_[i] = to_decimal(values_[i]);
+  }
+
+  /**
+   * @brief Converts a given chunk.
+   *
+   * @param  chunk          The index of the chunk.
+   */
+  void
+  convert_chunk(std::uint32_t const chunk) const noexcept {
+    auto const begin = chunk * size_;
+    auto const end   = n_ - begin < size_ ? n_ : begin + size_;
+    convert(begin, end);
+  }
+
+  /**
+   * @brief Converts chunks from the thread's own range and, when that's
+   *        exhausted, steals chunks from other threads' ranges.
+   *
+   * @param  id             The thread index.
+   */
+  void
+  work(unsigned const id) noexcept {
+
+    std::uint32_t chunk;
+
+    while (ranges_[id].pop(chunk))
+      convert_chunk(chunk);
+
+    // Since no new chunks are ever created, a complete round without stealing
+    // anything means the job is finished.
+    auto victim = id;
+    for (unsigned failures = 0; failures < n_ranges_; ) {
+      victim = victim + 1 == n_ranges_ ? 0 : victim + 1;
+      if (ranges_[victim].steal(chunk)) {
+        convert_chunk(chunk);
+        failures = 0;
+      }
+      else
+        ++failures;
+    }
+  }
+
+  TFloat const* values_;
+  TFields*      decimals_;
+  std::size_t   n_;
+  std::size_t   size_     = chunk_size;
+  range_t*      ranges_   = nullptr;
+  unsigned      n_ranges_ = 0;
+};
+
+/**
+ * @brief Adapts teju_double_to_decimal for use as a template argument.
+ */
+teju64_fields_t
+double_to_decimal(double const value) {
+  return teju_double_to_decimal(value);
+}
+
+/**
+ * @brief Adapts teju_float_to_decimal for use as a template argument.
+ */
+teju32_fields_t
+float_to_decimal(float const value) {
+  return teju_float_to_decimal(value);
+}
+
+} // namespace <anonymous>
+
+extern "C" {
+
+void
+teju_double_to_decimal_parallel(double const* const values,
+  teju64_fields_t* const decimals, size_t const n, unsigned const threads) {
+  using job_t = job_t<double, teju64_fields_t, double_to_decimal>;
+  job_t{values, decimals, n}.run(threads);
+}
+
+void
+teju_float_to_decimal_parallel(float const* const values,
+  teju32_fields_t* const decimals, size_t const n, unsigned const threads) {
+  using job_t = job_t<float, teju32_fields_t, float_to_decimal>;
+  job_t{values, decimals, n}.run(threads);
+}
+
+} // extern "C"
@@ -37,7 +37,7 @@ extern "C" {
  *
  * @returns true if n is multiple of pow(2, e) and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_multiple_of_pow2(int32_t const e, teju_u1_t const n) {
   assert(0 <= e && (uint32_t) e < teju_width);
@@ -54,7 +54,7 @@ is_multiple_of_pow2(int32_t const e, teju_u1_t const n) {
  *
  * @returns true if n is multiple of pow(5, f) and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_multiple_of_pow5(int32_t const f, teju_u1_t const n) {
 
@@ -80,7 +80,7 @@ is_multiple_of_pow5(int32_t const f, teju_u1_t const n) {
  *
  * @returns The value of m after the rotation.
  */
-static inline
+static inline teju_constexpr
 teju_u1_t
 ror(teju_u1_t const n) {
   return n << (teju_width - 1u) | n >> 1u;
@@ -94,13 +94,133 @@ ror(teju_u1_t const n) {
  *
  * @returns The teju_fields_t object.
  */
-static inline
+static inline teju_constexpr
 teju_fields_t
 make_fields(int32_t const e, teju_u1_t const m) {
   teju_fields_t const fields = {e, m};
   return fields;
 }
 
+/**
+ * @brief Returns teju_log10_pow2(e) or, if the exponents of the floating-point
+ *        type exceed the range of this function (e.g., for binary256),
+ *        teju_log10_pow2_wide(e).
+ *
+ * @param  e                The exponent e.
+ *
+ * @returns The integer part of log_10(pow(2, e)).
+ */
+static inline teju_constexpr
+int32_t
+log10_pow2(int32_t const e) {
+  #if teju_exponent_min < teju_log10_pow2_min
+    return teju_log10_pow2_wide(e);
+  #else
+    return teju_log10_pow2(e);
+  #endif
+}
+
+/**
+ * @brief Returns teju_log10_pow2_residual(e) or, if the exponents of the
+ *        floating-point type exceed the range of this function (e.g., for
+ *        binary256), teju_log10_pow2_residual_wide(e).
+ *
+ * @param  e                The exponent e.
+ *
+ * @returns The residual e - e_0 (see teju_log10_pow2_residual).
+ */
+static inline teju_constexpr
+uint32_t
+log10_pow2_residual(int32_t const e) {
+  #if teju_exponent_min < teju_log10_pow2_min
+    return teju_log10_pow2_residual_wide(e);
+  #else
+    return teju_log10_pow2_residual(e);
+  #endif
+}
+
+/**
+ * @brief Gets the multiplier for a given exponent f.
+ *
+ * If teju_storage_compression is defined, then only every
+ * teju_storage_compression-th multiplier is stored and the others are
+ * reconstructed from the closest stored one above. More precisely, for f = f_b
+ * - j, where B + 1 is the multiplier for f_b, the multiplier for f is (B *
+ * pow(5, j) >> s) + c where s = e_0(f_b) - e_0(f) - j and the correction c is
+ * in [1, 3]. (See cpp/generator/generator.cpp.)
+ *
+ * If teju_storage_hot_min is defined, then the multipliers for f in
+ * [teju_storage_hot_min, teju_storage_hot_min + teju_storage_hot_size[ are
+ * stored in multipliers_hot and the others in multipliers.
+ *
+ * @param  f                The exponent f.
+ *
+ * @returns The multiplier for f.
+ */
+static inline teju_constexpr
+teju_multiplier_t
+get_multiplier(int32_t const f) {
+
+  #if !defined(teju_storage_compression) && defined(teju_storage_hot_min)
+
+    // Multipliers for f above the hot window are shifted down in the cold
+    // table by teju_storage_hot_size positions.
+    uint32_t const h = (uint32_t) (f - teju_storage_hot_min);
+    if (h < teju_storage_hot_size)
+      return multipliers_hot[h];
+    return multipliers[f - teju_storage_index_offset -
+      (f > teju_storage_hot_min ? (int32_t) teju_storage_hot_size : 0)];
+
+  #elif !defined(teju_storage_compression)
+
+    return multipliers[f - teju_storage_index_offset];
+
+  #else
+
+    uint32_t          const t = (uint32_t) (teju_storage_index_top - f);
+    uint32_t          const j = t % teju_storage_compression;
+    uint32_t          const s = (uint32_t) (teju_log2_pow10(f + (int32_t) j) -
+      teju_log2_pow10(f)) - j;
+    teju_u1_t         const c = (corrections[t / 16u] >> (2u * (t % 16u))) % 4u;
+    teju_multiplier_t const B = multipliers[t / teju_storage_compression];
+    teju_u1_t         const p = pow5[j];
+
+    // Let x := pow(2, N). Then B * p = r2 * x * x + r1 * x + r0 with r2, r1, r0
+    // in [0, x[.
+
+    #if defined(teju_u2_t)
+
+      teju_u2_t const s0 = 1u * ((teju_u2_t) B.lower) * p;
+      teju_u2_t const s1 = 1u * ((teju_u2_t) B.upper) * p + (s0 >> teju_width);
+      teju_u1_t const r0 = (teju_u1_t) s0;
+      teju_u1_t const r1 = (teju_u1_t) s1;
+      teju_u1_t const r2 = (teju_u1_t) (s1 >> teju_width);
+
+    #else
+
+      teju_u1_t l1, r2, c1;
+      teju_u1_t const r0 = teju_multiply(B.lower, p, &l1);
+      teju_u1_t const r1 = teju_add_and_carry(teju_multiply(B.upper, p, &r2),
+        l1, &c1);
+      r2 += c1;
+
+    #endif
+
+    // Shifting by 1 and then by N - 1 - s, rather than by N - s, prevents
+    // undefined behaviour when s == 0.
+    uint32_t  const n     = teju_width - 1u - s;
+    teju_u1_t const upper = (teju_u1_t) (r1 >> s | 1u * r2 << 1u << n);
+    teju_u1_t const lower = (teju_u1_t) (r0 >> s | 1u * r1 << 1u << n);
+
+    teju_u1_t carry;
+    teju_u1_t         const l = teju_add_and_carry(lower, c, &carry);
+    teju_u1_t         const u = (teju_u1_t) (upper + carry);
+    teju_multiplier_t const M = teju_multiplier(u, l);
+    return M;
+
+  #endif
+}
+
 /**
  * @brief Shortens the decimal representation of m * pow(10, f) by removing
  *        trailing zeros from m and increasing e accordingly.
@@ -114,11 +234,11 @@ make_fields(int32_t const e, teju_u1_t const m) {
  *
  * @returns The fields of the shortest close decimal representation.
  */
-static inline
+static inline teju_constexpr
 teju_fields_t
 remove_trailing_zeros(int32_t f, teju_u1_t m) {
   // Subtracting from zero prevents msvc warning C4146.
-  teju_u1_t const minv5 = 0u - ((teju_u1_t) -1) / 5u;
+  teju_u1_t const minv5 = (teju_u1_t) (0u - ((teju_u1_t) -1) / 5u);
   teju_u1_t const bound = ((teju_u1_t) -1) / 10u + 1u;
   while (true) {
     teju_u1_t const q = ror(1u * m * minv5);
@@ -144,7 +264,7 @@ remove_trailing_zeros(int32_t f, teju_u1_t m) {
  *
  * @returns true if x is a "small integer" and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_small_integer(int32_t const e, teju_u1_t const m) {
   return 0 <= -e && (uint32_t) -e < teju_mantissa_width &&
@@ -162,7 +282,7 @@ is_small_integer(int32_t const e, teju_u1_t const m) {
  *
  * @returns The shortest decimal representation of x.
  */
-static inline
+static inline teju_constexpr
 teju_fields_t
 to_decimal_small_integer(int32_t const e, teju_u1_t const m) {
   assert(is_small_integer(e, m));
@@ -172,7 +292,7 @@ to_decimal_small_integer(int32_t const e, teju_u1_t const m) {
 /**
  * @brief The mantissa of uncentred floating-point numbers.
  */
-static
+static teju_constexpr
 teju_u1_t const mantissa_uncentred =
   teju_pow2(teju_u1_t, teju_mantissa_width - 1u);
 
@@ -184,7 +304,7 @@ teju_u1_t const mantissa_uncentred =
  *
  * @returns true if x is centred and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_centred(int32_t const e, teju_u1_t const m) {
   return m != mantissa_uncentred || e == teju_exponent_min;
@@ -197,7 +317,7 @@ is_centred(int32_t const e, teju_u1_t const m) {
  *
  * @returns true if f allows for ties and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 allows_ties(int32_t const f) {
   return 0 <= f && (uint32_t) f < sizeof(minverse) / sizeof(minverse[0]);
@@ -212,7 +332,7 @@ allows_ties(int32_t const f) {
  *
  * @returns true if m yields a tie and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_tie(int32_t const f, teju_u1_t const m) {
   return allows_ties(f) && is_multiple_of_pow5(f, m);
@@ -230,7 +350,7 @@ is_tie(int32_t const f, teju_u1_t const m) {
  *
  * @returns true if m wins the tiebreak and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 wins_tiebreak(teju_u1_t const m) {
   return m % 2u == 0;
@@ -245,7 +365,7 @@ wins_tiebreak(teju_u1_t const m) {
  *
  * @returns true if m * pow(2, e) is closer to the left and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_closer_to_left(teju_u1_t const c_2) {
   return c_2 % 2u == 0u;
@@ -256,20 +376,21 @@ is_closer_to_left(teju_u1_t const c_2) {
  *
  * @param  e                The exponent e.
  * @param  m                The mantissa m.
+ * @param  M                The multiplier for f = log10_pow2(e).
  *
  * @pre is_centred(e, m) == true.
  *
  * @returns The shortest decimal representation of x.
  */
-static inline
+static inline teju_constexpr
 teju_fields_t
-to_decimal_centred(int32_t const e, teju_u1_t const m) {
+to_decimal_centred(int32_t const e, teju_u1_t const m,
+  teju_multiplier_t const M) {
 
   assert(is_centred(e, m));
 
-  int32_t           const f   = teju_log10_pow2(e);
-  uint32_t          const r   = teju_log10_pow2_residual(e);
-  teju_multiplier_t const M   = multipliers[f - teju_storage_index_offset];
+  int32_t           const f   = log10_pow2(e);
+  uint32_t          const r   = log10_pow2_residual(e);
   teju_u1_t         const m_b = (2u * m + 1u) << r;
   teju_u1_t         const m_a = (2u * m - 1u) << r;
   teju_u1_t         const b   = teju_mshift(m_b, M);
@@ -310,7 +431,7 @@ to_decimal_centred(int32_t const e, teju_u1_t const m) {
  *
  * @returns true if m yields a tie and false, otherwise.
  */
-static inline
+static inline teju_constexpr
 bool
 is_tie_uncentred(int32_t const f, teju_u1_t const m) {
   return m % 5u == 0 && is_tie(f, m);
@@ -324,14 +445,14 @@ is_tie_uncentred(int32_t const f, teju_u1_t const m) {
  *
  * @returns The shortest decimal representation of x.
  */
-static inline
+static inline teju_constexpr
 teju_fields_t
 to_decimal_uncentred(int32_t const e) {
 
   teju_u1_t         const m   = mantissa_uncentred;
-  int32_t           const f   = teju_log10_pow2(e);
-  uint32_t          const r   = teju_log10_pow2_residual(e);
-  teju_multiplier_t const M   = multipliers[f - teju_storage_index_offset];
+  int32_t           const f   = log10_pow2(e);
+  uint32_t          const r   = log10_pow2_residual(e);
+  teju_multiplier_t const M   = get_multiplier(f);
   teju_u1_t         const m_a = (4u * m - 1u) << r;
   teju_u1_t         const m_b = (2u * m + 1u) << r;
   teju_u1_t         const b   = teju_mshift(m_b, M);
@@ -386,6 +507,7 @@ to_decimal_uncentred(int32_t const e) {
  *
  * @returns The shortest decimal representation of x.
  */
+teju_function_specifier
 teju_fields_t
 teju_function(teju_fields_t const binary) {
 
@@ -396,11 +518,50 @@ teju_function(teju_fields_t const binary) {
     return to_decimal_small_integer(e, m);
 
   if (is_centred(e, m))
-    return to_decimal_centred(e, m);
+    return to_decimal_centred(e, m, get_multiplier(log10_pow2(e)));
 
   return to_decimal_uncentred(e);
 }
 
+#if defined(teju_range_function)
+
+/**
+ * @brief Finds the shortest decimal representation of x = m * pow(2, e) for e
+ *        in [teju_range_minimum, teju_range_maximum].
+ *
+ * Multipliers are read from multipliers_range, which contains only those for
+ * the window, and small integer checks are compiled only if the window contains
+ * such integers. Values outside the window and uncentred values are delegated
+ * to teju_function.
+ *
+ * @param  binary           The binary representation of x.
+ *
+ * @returns The shortest decimal representation of x.
+ */
+teju_function_specifier
+teju_fields_t
+teju_range_function(teju_fields_t const binary) {
+
+  int32_t   const e = binary.exponent;
+  teju_u1_t const m = binary.mantissa;
+
+  if ((uint32_t) (e - teju_range_minimum) >
+    (uint32_t) (teju_range_maximum - teju_range_minimum) ||
+    m == mantissa_uncentred)
+    return teju_function(binary);
+
+  #if teju_range_small_integers
+    if (is_small_integer(e, m))
+      return to_decimal_small_integer(e, m);
+  #endif
+
+  int32_t const f = log10_pow2(e);
+  return to_decimal_centred(e, m,
+    multipliers_range[f - teju_range_index_offset]);
+}
+
+#endif // defined(teju_range_function)
+
 #ifdef __cplusplus
 }
 #endif